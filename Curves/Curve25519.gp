@@ -0,0 +1,8 @@
+model=montgomery
+p=57896044618658097711785492504343953926634992332820282019728792003956564819949
+n=7237005577332262213973186563042994240857116359379907606001950938285454250989
+A=486662
+B=1
+h=8
+gx=9
+gy=14781619447589544791020593568409986887264606134616475288964881837755586237401
\ No newline at end of file
@@ -0,0 +1,8 @@
+model=edwards
+p=57896044618658097711785492504343953926634992332820282019728792003956564819949
+n=7237005577332262213973186563042994240857116359379907606001950938285454250989
+a=-1
+d=37095705934669439343138083508754565189542113879843219016388785533085940283555
+h=8
+gx=15112221349535400772501151409588531511454012693041857206046113283949847762202
+gy=46316835694926478169428394003475163141307993866256225615783033603165251855960
\ No newline at end of file
@@ -0,0 +1,7 @@
+p=115792089210356248762697446949407573530086143415290314195533631308867097853951
+n=115792089210356248762697446949407573529996955224135760342422259061068512044369
+a4=115792089210356248762697446949407573530086143415290314195533631308867097853948
+a6=41058363725152142129326129780047268409114441015993725554835256314039467401291
+h=1
+gx=48439561293906451759052585252797914202762949526041747995844080717082404635286
+gy=36134250956749795798585127919587881956611106672985015071877198253568414405109
\ No newline at end of file
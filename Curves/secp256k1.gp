@@ -0,0 +1,7 @@
+p=115792089237316195423570985008687907853269984665640564039457584007908834671663
+n=115792089237316195423570985008687907852837564279074904382605163141518161494337
+a4=0
+a6=7
+h=1
+gx=55066263022277343669578718895168534326250603453777594175500187360389116729240
+gy=32670510020758816978083085130507043184471273380659243275938904335757337482424
\ No newline at end of file
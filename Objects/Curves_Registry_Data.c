@@ -0,0 +1,6158 @@
+/** @file Curves_Registry_Data.c
+ * Built-in curves, generated by Curves_Registry_Generator. Do not edit.
+ */
+#include <gmp.h>
+#include "Curves_Registry.h"
+
+static const mp_limb_t Parameters_w256_001[] =
+{
+0xddf0257e532761afU, 0xb14bc267f3a78a59U, 0x8bfd2007a4774173U, 0x13a4b1a5227c3aedU, 
+0xf65ff7d45bac1b29U, 0x89610cbfb0c84f09U, 0x8bfd2007a4774173U, 0x13a4b1a5227c3aedU, 
+0x9cbe24a50f9a0889U, 0xeaafa5b61c5a4939U, 0x4fb80db68728a8b5U, 0x57c7c9c9403c6d6U, 
+0x3ab5eb394d468341U, 0xa0851f618419cb13U, 0x5dfbac473838372aU, 0x9b3208e7721de70U, 
+0x1U, 0x0U, 0x0U, 0x0U, 
+0xa97901fa3699d854U, 0xebc2c58225109303U, 0x3af11bb2909cbbcaU, 0x10e30c883bd97265U, 
+0x57784875e1b455caU, 0xc460073bf6715b24U, 0x8437675bd79d43d7U, 0x1afaa6ebaad5d7cU, 
+};
+
+static const mp_limb_t Generator_Table_Points_w256_001[] =
+{
+0xa97901fa3699d854U, 0xebc2c58225109303U, 0x3af11bb2909cbbcaU, 0x10e30c883bd97265U, 
+0x57784875e1b455caU, 0xc460073bf6715b24U, 0x8437675bd79d43d7U, 0x1afaa6ebaad5d7cU, 
+0xe2238e53237134fbU, 0x45afbfa1d9feb81aU, 0x1463e566136a557eU, 0x1e8de205f6d174dU, 
+0x33ffaff4a59621fcU, 0x40fe276cf09e0f41U, 0xe8a3828f48f1a321U, 0x50134ada29f450cU, 
+0x8425c0efedea53cbU, 0x65af0b2a81179256U, 0x683721175896230cU, 0x1c50cb392acacbfU, 
+0xd3df4bd4995a648U, 0x4efada6c12ebf870U, 0xb5a8104449feb173U, 0x1350401eaf4cb1d3U, 
+0x7fbc97ba1d4feaadU, 0x8ed78de3f6f64af6U, 0x7fa00b4b5e0532b5U, 0x11133cbce126cacaU, 
+0xbf741c185360957aU, 0x1af717a5e204d376U, 0xb7421fc47a546d3bU, 0xc8717a2826e6697U, 
+0x4749b8291630d0b4U, 0x7539e510b792f74U, 0x8dea2d5a890b64b5U, 0xc69b95243ba911cU, 
+0x55b3d538d34b7bebU, 0xc9e92055e51b15e0U, 0x5e0ee6780608babeU, 0x7b77e84233b05fdU, 
+0x9a87fc1c20289f88U, 0x1563ce55b7f5ea96U, 0x25a67521c0aced3eU, 0x1187cdd74888d9fU, 
+0x333afc31e3703667U, 0x8049ed8230d15413U, 0x4b0e3d28795832f7U, 0x34b6552ef26267cU, 
+0x6da57bdcb5005754U, 0x33615b1e4d60137U, 0x55ceec371329a7c0U, 0x756bdc3f9cd501eU, 
+0x96c37e2c2f58a659U, 0x888589d24a8e6e21U, 0x645525cec9b9632dU, 0x12fc5680c2a61cb0U, 
+0x6672c90fdcdcf918U, 0xad671eee3dc24477U, 0x3f62fad952e0f0dU, 0x130ff495c0a98cb7U, 
+0x8f845f740589c557U, 0xcf7cd2e473af7e37U, 0x6ee7892d12dd01c3U, 0xc8ab131b5e5f14U, 
+0xceb66bd235e13d69U, 0x215f87ff0d423d64U, 0x6b0daca7a294c43dU, 0x13698675a37cb10cU, 
+0x62fba3177953ab6U, 0x62e9661025fbe004U, 0x615880f269d3a37dU, 0xcb9d28b9159a422U, 
+0xa1dd7dda9f29cd9dU, 0x61e789aabda64db8U, 0x5915e15a72f133bdU, 0x7ec8be487e20a16U, 
+0x53f55073f09dfdf0U, 0x94ed16daa5de97adU, 0x143e8a555fe486e4U, 0x7e84d936cef43U, 
+0xbae848ffb9685cc2U, 0x754de64a66afe363U, 0xe7d3eda4febfff7dU, 0x40e7298e0d78d08U, 
+0x41ff04334af420a2U, 0x3874a0e776a498ccU, 0x670753544d5d366aU, 0xc4555de6fe499d1U, 
+0x682fda2ed1834f9fU, 0xb1710ac1c4d86e3fU, 0xe36531d8d17e5f71U, 0x54b9bb2a12ce088U, 
+0x6ece8d70e6bc3b4dU, 0xfbe9420c8de1cbe8U, 0x2118d65395c293deU, 0xe56ab3a1818ce5eU, 
+0x65b559e23ef3274fU, 0x183a203834faa8c2U, 0xcf70b88d5c3f69b9U, 0xaa149e0f88dd781U, 
+0x1e0e341b8acef498U, 0x2ec14d2db2d6b281U, 0x536db72b323dbf05U, 0x192d193f649e8b2U, 
+0x970902392c70873fU, 0x687a451ce738b9b8U, 0xcc72041845aa200cU, 0x10c0393ae669dee4U, 
+0x4401e9ee30cc911aU, 0x14329c080c38bba0U, 0x991e32f526fd999fU, 0xf755be78924e981U, 
+0x5660d72104e8e228U, 0x3a1c1d909e03fdc1U, 0x359ee8df19952e82U, 0x4f5fd82b94ad232U, 
+0xb7ce9e9fb15444deU, 0x2b376063d4fb007cU, 0xcade07cbf2dd6751U, 0xcdde01aa73de813U, 
+0x98911923f8dd8263U, 0xe842b792ff94e8dcU, 0x7a27c504f1d31445U, 0xed184ee063c0195U, 
+0xbd6d5c44fda5284bU, 0xc87b51c834fb5249U, 0x8b811871ff11e5bU, 0x137103e7e4e8f917U, 
+0x734b373888ac7a15U, 0xf12c7bd8998f8d8eU, 0xd793d34fd88c7f00U, 0x82361c9fb170578U, 
+0x805667a4b9286a1U, 0xb34e10db4f81ec20U, 0x2611ee65ff0ea588U, 0x13572ff05eeab658U, 
+0xf840893fd6f8a19bU, 0xe18dbca39cb31d64U, 0x4ae75ddffec5e151U, 0x378d7bc395adb96U, 
+0xd6d870c26250ca8eU, 0xbf2372f61f07ceffU, 0x16b23cf1d0cf8cbeU, 0x127b083146dd07a9U, 
+0x74899031965188b7U, 0xa87a08876ad727e3U, 0xcece66275bb268fbU, 0x133d45eb59cd088U, 
+0xc5f3f67b0fcb2bd9U, 0x1bb680af101d7ca5U, 0x6276760b528c9529U, 0x105ccd54062a3383U, 
+0x7de49926d4aba1a3U, 0xdf04237eede48c53U, 0xe1fb1ae215ec6d76U, 0x5aab31bbfda9a54U, 
+0x5274a28ee0da7bccU, 0x607ddf9df5cea89U, 0x77bd00c7acbdf42aU, 0xb752eac9ea54348U, 
+0x1f8c60e4cc0de0bfU, 0xa080e8b659930108U, 0xa8bf4ff7a0e61ed3U, 0x1d3e9cba53a6415U, 
+0xc0abe63865b32c0fU, 0xce49344d88cbd3f5U, 0x49839d1a3d3f7e9dU, 0xc439d7b49369c3bU, 
+0x5afc7f1c17adf424U, 0x3dab044469a853bbU, 0x4c3655cdbcb1694cU, 0x25c4ab02167a74bU, 
+0xf897a47819ab6e4cU, 0xcdf35176ca661127U, 0xee0c57c431d88dbU, 0x9e6ff71b0094af9U, 
+0x56c46095f52aa8c1U, 0x8b16e6f7401823feU, 0xbf8d2989c08bb0ccU, 0x9856d9daec13b2fU, 
+0x47646f8806ad79edU, 0x19cdff51d180f6baU, 0xfd45db69a9871622U, 0x81b011e2a585c46U, 
+0xdf7871c6e1b57a8aU, 0x9fffdf200c4edf3cU, 0x855a2b4db3effe46U, 0xd0ca152b102a3b1U, 
+0xe07136622ede7dfaU, 0x9c798ef159c6d884U, 0xe31272201f74840eU, 0x6dc7cace4f6dfb4U, 
+0x15f11f7781ad1404U, 0x18017db6875c129fU, 0xc9f029aaaa258619U, 0x10fbd11d854e8ffeU, 
+0x71a8279e0af2cc7aU, 0x2b44045ca638953bU, 0x9ccdfbf5983e184aU, 0x12f18def34f0a3b5U, 
+0x525e9e79755835aU, 0x76eb117a6488ce6U, 0x523910d5ae8541a9U, 0x12b80d5b0f1363dbU, 
+0x80a6bd2942707333U, 0x8ca98105c552d2a4U, 0xf45366c8b69e0586U, 0x44ff7c63fe74876U, 
+0x8f8f67093cf5e204U, 0x4a1eda869f4405bU, 0xbbba3df1c0d4e99dU, 0xbac61b43daef0edU, 
+0x86b040cff428096eU, 0x677ec685c5c25c32U, 0x8bb20df83bbaf024U, 0x129975856cfac539U, 
+0xea50ec1916f3af87U, 0x27490138df5c4349U, 0xa27fb144a8ddaf9aU, 0xc466040442bd057U, 
+0xd098a4575b77c768U, 0xa12aac9740b2be33U, 0xbeefaa853de22325U, 0x101ae2ae9395bedU, 
+0x1c4bc7dd9e643159U, 0x60e5e4473bc8b405U, 0x865dfdb101befb49U, 0x6a89d5084359888U, 
+0x68825895a44f3a3cU, 0x1e49d08d8164760eU, 0xa419f93389d6f41eU, 0x119da3890593441bU, 
+0xe4f8d10c76a6ac36U, 0x2d13d12341a97236U, 0xb3d653b267d5cb2eU, 0x76ca13498ff9fd5U, 
+0x7415e3db2e3b91dU, 0x9ab3cc2b25c35448U, 0x7620f626b276a042U, 0xcf7cb12269b5001U, 
+0x997b6a7e79fbe6b0U, 0x1c6be706e7e399c6U, 0xb279e336ee4867c7U, 0x9405ff1fc2c2aebU, 
+0xa8d34e9e2050ecf2U, 0x41230db670eace3bU, 0x84c18bfc554469c9U, 0x4c645ae68e6d21bU, 
+0xf597a6872de3f813U, 0x536618205163985fU, 0xf50a56106b056866U, 0xb0b7ad7eff00c56U, 
+0xefda37fe07573d14U, 0xd43db3df45a7463cU, 0x8417c0ffbb7c002eU, 0x22fb960ecacdcccU, 
+0x6166c9e7d65ef9efU, 0x9e051f2b1c73d3e8U, 0x7c92641128f6891bU, 0xe651dbcf0cfcbb9U, 
+0xb0dc0f02de609dfbU, 0x5c42b19635dc38b5U, 0x45a8320a00efc535U, 0x1672c500ee637c3U, 
+0xbe3d1c702a5ab396U, 0x859be3eef761627U, 0xbe991d9df524e24U, 0x9379432463b75dfU, 
+0x68986cbcff68e8d3U, 0xdf1d2a5c43f737a5U, 0x87ae214a65a2d0ddU, 0x121854fefca5f02dU, 
+0x1bf87dfc4bb77fcaU, 0xd3a34db658cc0c71U, 0x637e38ffa797e42aU, 0x2bdaa19a55c230U, 
+0xb4c6eea510d9f81U, 0x25ab39b0956827b8U, 0x69318c47dc7c7362U, 0x4c87142d352863eU, 
+0x96e7427d4a8516dU, 0x792348a157a08553U, 0xb34e498f0ea5e7f2U, 0x63ea2df82fdc581U, 
+0xf9596d4d462de4cU, 0x246f2b9768309abfU, 0x9fd9ec9ad0ff2576U, 0x7c90199fa6055c1U, 
+0x9a895ba0787f821aU, 0x416cedad5c21b7efU, 0xbd92845663569679U, 0xc36cd1be1f71eecU, 
+0x6a935406b4f315ceU, 0xa3573ad402b671eeU, 0x74ad10fd1bf27dd6U, 0x635a9a42397f50eU, 
+0x79b4c06f843e2408U, 0x8250f354f0091cdfU, 0xf2a159538dc1eff6U, 0x764872d9794898U, 
+0x2211b42cb13cfdefU, 0x7614e0c3c49df2ccU, 0xc8b3b2c8d0d5a6dU, 0xe0e40db4b1bda7bU, 
+0x4ee1434e9b33100fU, 0x2b2063a576eecd5dU, 0x811bbe9c4faa684U, 0xb6265e8d17d500dU, 
+0xcb51bbd9bc696629U, 0xcb05caf024ba56c0U, 0x14a01a6a32c579daU, 0x757e916096541afU, 
+0x69941a16327e5761U, 0x51bc0a03ac6402d7U, 0x844837c4ea86abd5U, 0x4936ac42e9d8523U, 
+0xe89e2f2cdca7e196U, 0xff52f8ac66ea10dcU, 0x3ee8c8964e8e2deU, 0x1ba0f1564c4828bU, 
+0x52be739fd550b6b3U, 0x20a2a93a81a1bd9dU, 0xe4f49e3f617302c2U, 0x1298d6738354ef93U, 
+0x5535696dbae9e6b6U, 0xf63362853a30627fU, 0xd7b8610afa825aceU, 0x2a4fc62fabf99b8U, 
+0x7297992bd899ed17U, 0xfcb752a2ac73f99cU, 0x2d34c0338f25b555U, 0x10edd4a340e28528U, 
+0x9d872d9b61e76732U, 0xaee0bda06d1a5f4fU, 0xdc690566d2141002U, 0xe1aa1c657c2e351U, 
+0xbad6eebf9b0db0aeU, 0x313926ddfff97c53U, 0xa1aaed06ad9cf83cU, 0xdaf644fc8eedb71U, 
+0x527b9352b5d940d1U, 0x8e72c7ff56707572U, 0x3d23a24ec9fbdbb8U, 0x6c2e655d5e631a9U, 
+0x3e95179cea2cf900U, 0x787c581944000fa8U, 0xf977492046c48b06U, 0x95e035d514ffde6U, 
+0x2889cba64badd1c6U, 0x580bb0ad050bdad3U, 0xeb898228817f4c27U, 0xce27a8c1d628bf4U, 
+0x5bda92f94175ca51U, 0x5b8dc30d54a8f0f2U, 0x75d26a3b48e82576U, 0x737afe231ab0f09U, 
+0xbe818f00b1629270U, 0x3bd8a1533877525aU, 0x7a87b693f55e5f6dU, 0xec33fe99e75ea42U, 
+0x9fefb6f79d50d86fU, 0x3afd72672520d9f7U, 0x4f257ef7455cff62U, 0xaa748d7e42f09caU, 
+0x787eae0533f9eca2U, 0x5896e651759f8e50U, 0xd9c56a7d1d9f6d75U, 0x2e7204e98ff2c80U, 
+0x916dabb0a7a9364aU, 0x80a296b19f588446U, 0x91d1514062a6bea9U, 0xa9af7604d1fe104U, 
+0xc258bc980e97de3aU, 0xb2cd8d641452311aU, 0x91f81c20e68730ceU, 0x575f9688963ca18U, 
+0xc64bf1878a057b14U, 0x44bafd01dff5e044U, 0x428c142d18c21ee3U, 0x1d3945585f2d282U, 
+0xb47b30c318dd07dcU, 0xefe5e96643868df1U, 0xd8e1f0c8cd92725dU, 0x100d127270d57ccbU, 
+0xaa66bae94ba4b6e5U, 0x4809f6cf0bf5b9e6U, 0xad3c402377e8d123U, 0x235f7f4fa2cc119U, 
+0xff071caf9a0959f5U, 0xb30d66203342cf1aU, 0xe4942bc566760f6aU, 0xf98ba70c2f3978dU, 
+0xbb6a464945b1de2eU, 0xd150fde485652a5cU, 0xdb6c804473544168U, 0xf010416d90f6f1fU, 
+0x980cc383fe58721eU, 0x493d278a02776ec2U, 0x42c76d2de29ce634U, 0x8f620b6368f97a5U, 
+0xd37d01dc4db7cc7bU, 0xb005ce99d21dbd10U, 0x93eec6e52ec72ea2U, 0xcac895858dc5816U, 
+0x9891b9db38ccd12fU, 0x58f08d53fd063180U, 0x278838506b9f7a19U, 0xce2b9af74ebcbf9U, 
+0x7928e65814c498e4U, 0x9fca09ccd0734c8fU, 0x80cd5b904e2ca2a2U, 0xf6f4eb22fa075feU, 
+0xe9764218503c755eU, 0x5ae7031ba66c89ecU, 0x57762a2730db1d12U, 0x1f1e38f11643db4U, 
+0x638feb69af20fd27U, 0x74168f54faeb8c1fU, 0x29c0c8d365e21d2cU, 0x74d390dd723ed22U, 
+0xd4a7a1ffeec6171eU, 0x4fcd4f3606af0860U, 0x51ab9c699757ca21U, 0x759376bd78f717dU, 
+0x2610ec2c160ab77fU, 0x3362881bb54badbU, 0xcc2bd059ed8146aaU, 0xa4cce21a6544358U, 
+0x507f1cb80df4c592U, 0xfc209fa3f5592220U, 0x4f7d2338fb2e9a80U, 0x138f2dac68d453d0U, 
+0x14193d6fa8c54306U, 0x93bdc2fcbecd4ddbU, 0x70cdc06c6caa077eU, 0xbfc4d58fb4abc27U, 
+0xbf7c32a46f5d1d9eU, 0x2fe07295fc50d24bU, 0x280bf59a70a61047U, 0xd746ee8ec29711fU, 
+0xc9515b048d9956c4U, 0x35405066c348af8fU, 0xb6252d6afd30b963U, 0xc0be5ef7ddc55d5U, 
+0xc98fb464f1c1da2bU, 0x3d076d28b5c2eafbU, 0xfea2381a4628913U, 0xbb5187b837b7671U, 
+0xc67b0dc1d389584aU, 0x2527aeee32313861U, 0x2014aab1ea02208cU, 0x10d0078740a7106fU, 
+0x2ec7f80879358249U, 0xd0a96838c606cb1eU, 0x662dcc3a315d9efdU, 0x1298f256a9bf97cbU, 
+0x9a29561bd60e4b44U, 0x3e7e920b128c401cU, 0x4ebeab172280274aU, 0xe2cc2c4bdce0ce1U, 
+0x89f9156293b4fc7dU, 0x8d829c664a6fbd19U, 0x1ff0820d5406d685U, 0x115c655bd095f1fdU, 
+0x76f176291be32e36U, 0x75dbcf335ffa22beU, 0xc8512da143fc9939U, 0x38550e478e8ce71U, 
+0x604813bfa10811b7U, 0x8bacb54a46dc0c55U, 0xbe59f109b58d2936U, 0x34c90612eadfae3U, 
+0xa0c2855cae2517a4U, 0xfdaf6a288a14aecdU, 0x23d5e494e8bc8d72U, 0xf0a883c6ceeb847U, 
+0xc51c192450b6eecdU, 0x4cbafb1250563da1U, 0x6ba1d7e178f84e9U, 0xef8d2f2d0965e38U, 
+0xa91a12e6d4c67f56U, 0x46317cdd6e512f40U, 0x5fec6d7afa0c14d2U, 0xdb83ce2c414dd7aU, 
+0x6d6f070084924f8eU, 0x15fa5e8b5d361451U, 0xd4dead29942476bU, 0x11224476727e4aU, 
+0x9b185447142aa389U, 0x4bf2e1602a0aadb8U, 0x55dd05309a4443c6U, 0x76ad8373cd850beU, 
+0xe3eb1923d0de4c39U, 0x121d7a29dee5c42fU, 0x670936d66b5b5035U, 0x2c1322eb31a9044U, 
+0x3c3ae57d7c7493a6U, 0x53d3a95a85a6c87eU, 0x7bd0760fc0a05820U, 0x157a30e497081b0U, 
+0xc0996b390222f8c2U, 0xe7fbd67e7563015dU, 0x472b0798168e0893U, 0x1183db6b4b161084U, 
+0x7062f254a2d53600U, 0x269924d20952b3b7U, 0x3d44da4775b6f992U, 0xabf2d459399664fU, 
+0x586ce6b1f9a81dcaU, 0xfd4b3b4aa0f94003U, 0x3bfb956bd1590fddU, 0x7755be7fe237953U, 
+0xed985d0b9d244788U, 0x4a2548caf3342b71U, 0xfd8a7641eab90c89U, 0x3922e34f0416e27U, 
+0x92f3fffb310c5b4cU, 0x44e8f7822af1ffbeU, 0x6673734ea2396bf8U, 0xb142fe7f3c9086bU, 
+0x2bfb41b0e79de0d4U, 0xeafdd1acf651aa4dU, 0x35d253063dbfa1d8U, 0x130006de3dc2d344U, 
+0xd599709fc3cf57cbU, 0xd81c67b3e3e69717U, 0x7fd07c1b61b2c583U, 0xaa0867e6d7e2326U, 
+0x1f8913aa687a2debU, 0xf3501185eea4d6b1U, 0xf9a9cd3485281d1fU, 0x9d7da4088c4c41cU, 
+0xaddaf99dfa0bec40U, 0xd1e2833e29fa7a6fU, 0x9654f784a8d49599U, 0x10a325574ec4e170U, 
+0xf517f15c64f8182U, 0x29daf774c7d6a347U, 0xaef53c5e3f0e2090U, 0xd65019a96283c6aU, 
+0x2cf95ebf47834281U, 0xd3be26aba278f291U, 0x60d5d712ace5a4d2U, 0x133e667aeff28989U, 
+0x5ca2ace96adf852eU, 0xec5e174b91d55368U, 0xc59aaf9dae45f706U, 0xe73e19b2952c5e9U, 
+0x1d45b6da520476dbU, 0x8f36550b9ba504a7U, 0x255cfbb8220a9529U, 0x202c559abc8044fU, 
+0x84998d6b4d750438U, 0x314b687e629f5c98U, 0x4c6a93fae7e3bf42U, 0x1302683bb58dafa8U, 
+0x2b8261dc10172539U, 0x6fd43b474e2689f2U, 0xf200e84b46a84600U, 0x128f337ce41caa5fU, 
+0x3b5369e55379e1edU, 0xffd477b755574db0U, 0x50d642154d6a989cU, 0xc2d154e0c3814b9U, 
+0xf7c73093aa412688U, 0xd293deee9b98f7c4U, 0xddaccca250e27982U, 0x306b8e15ae12f72U, 
+0xa4eb14eea52ec78cU, 0x541ade4e0893f193U, 0x8a233dec711ad21aU, 0x7ad3fe916cab26bU, 
+0x4ab1d411421293c7U, 0x542efdbf73c966d0U, 0xd49022594f286cbU, 0xde8dcdef352d8e4U, 
+0x6d04821278eab109U, 0xec090e0bbf2236a3U, 0x438f9e256b674d83U, 0xf87d81b28aac0d2U, 
+0xa7372fcd487b7624U, 0x7f66237520720d09U, 0xcf3fe159c055db7dU, 0x868d8cee555659eU, 
+0xa78cc24897b5bf28U, 0x27cd5af60a2f589fU, 0x12880170c673f7b7U, 0x11e12ccd744154b0U, 
+0x2c9e0bbe997f31e8U, 0x854769dc2be47287U, 0x447f8ce2474ce646U, 0x986881420932907U, 
+0xdce40826429c57deU, 0x2b8911ba4813572dU, 0xa2bd1457fdb2d885U, 0xd70b8c14f7e2a79U, 
+0xe1b99bbe6041618eU, 0x4e558ba496d08145U, 0x6dba4c4494ca4a82U, 0x116926a809252c14U, 
+0xc8d3ec5f1ed63938U, 0xbcb13a52df41f248U, 0x39bd7d2d3f36f532U, 0xe05f40c08b29a62U, 
+0x7fbca9fb398838f0U, 0xa4ed909ab26902f1U, 0xe34aa6653090e33aU, 0x1847165f6c07be4U, 
+0x7e52b4ab4c674aaeU, 0x8b1e7175ddab1d81U, 0x4e3e3ec524987519U, 0x9ad0316b8981c9eU, 
+0xc88ef33b29472cf8U, 0xc1b6855134016d91U, 0xbc60c90260793cceU, 0xd34f19235955d68U, 
+0xdca60b4aad73742dU, 0xf593dac816a28062U, 0x76a2df9b6cb1a941U, 0xaf7a1601f8fffe5U, 
+0xad2cf69dfac253a6U, 0x8b337f93e2fdff01U, 0x3ad05f9eb9ad2de8U, 0x9898e81dae891acU, 
+0xbcc945b126568eecU, 0xe6165950cd662d81U, 0x8e80bcecf3a7900eU, 0x9c7a158c816ecbfU, 
+0xd26dfadb95a0a731U, 0x90edd7f55a69a85bU, 0x552b5f9740ea7468U, 0xd0ee33c09021ef3U, 
+0x19b90d850a713014U, 0x42e4dc4c99c14abbU, 0x4b81e2004df2f898U, 0xc663459105223dfU, 
+0x10adba48c081e793U, 0xc057336ae74f9669U, 0x9f223d4d4a9d523fU, 0x9dc4a2d3be8f741U, 
+0x842036bbce1f67dfU, 0x108e50df2c81ac14U, 0xa74abc923d2153b4U, 0x20a3cfb3693e936U, 
+0x52e30002f9e0b0a0U, 0x3b0cc9c94a4ad76fU, 0xb1b23937c85f515dU, 0xe46eb779d57674eU, 
+0x4d22c411e2cd7d10U, 0x97506beae213eb41U, 0xc0297420073d152bU, 0x10a978dc7619a58fU, 
+0x4c2de74ac32615dcU, 0x76e5010447342b57U, 0x2d224b3a74b6742cU, 0x1153729e179ee087U, 
+0xf43109dc06aa05b1U, 0x5d0f99303e9dd070U, 0x8a903329793ddeebU, 0xaf2c4f0103bbc1aU, 
+0x68896097c778714fU, 0x7ff96ecd3b91e45fU, 0x340279a6f94a6e6aU, 0xb070b8412879019U, 
+0x299d89d8367cf4b2U, 0x5f4ae84459ba96faU, 0xe8d900865c7e8485U, 0x6995bd2452fcbeU, 
+0xa570e9a256dd90b2U, 0xed6bff03d575e464U, 0x9ffc68689462161U, 0x130b04dff87bb454U, 
+0xd5e953dd88ff93U, 0xe5563d48408bba3aU, 0x9fa41f78df031966U, 0xc6231c17601d299U, 
+0xf3c57fbd506eb8c9U, 0xd6b59602e7b564b5U, 0xb52ef4b8dc4555a3U, 0x121bb220d6b456d9U, 
+0x8fad5c25826cf542U, 0xca74d67b827f425U, 0x617e75846e9e231bU, 0x5fa43ea1e956eecU, 
+0x373e934c90aac0ecU, 0xfa94c6d9572d2e6dU, 0x9b26a7d12403ef7eU, 0xfb7645acc5d9486U, 
+0xa7831757057d746eU, 0x5a8b231f197e757fU, 0x78b3c56d809c35a2U, 0xaf0912bd624faf2U, 
+0x730a0fb62ba393e9U, 0xc0a20619ad47c172U, 0x43f1ced7c774ec58U, 0xd5f69f77256c76dU, 
+0x7e5c03f15c42686eU, 0xef9bf11219d3b71eU, 0xd7ec10fe92daf967U, 0x139c3e3f4f8d2932U, 
+0xcc49eb1f1282840bU, 0xb2c7c3a289c82092U, 0xbf830eeb0e87687cU, 0x10ef25834f4ff040U, 
+0x3f9d67f4dbaaa2b4U, 0x52b2a76ef6c595d6U, 0x293036219c31d71U, 0xb4bb12d11417ec2U, 
+0x130cb2eac43eadf4U, 0xb603dbcba6ed8489U, 0x6efacde0443a3754U, 0x2a071d4e4ce6f7aU, 
+0x932b1f1fef748652U, 0x4cfa9afe1bffe03U, 0x19ed73f493f33113U, 0x10e21bc8bb214af3U, 
+0x5e5d518ddd39b540U, 0xd8ce5bef75b4fa27U, 0xdcab6090b3d3eac7U, 0x10c8f8818ecbffedU, 
+0x409b07195a3205aaU, 0x6764a078853e610eU, 0x239aa6ab772dc783U, 0xaa748f63b03cca7U, 
+0x1171be109261d991U, 0xfc5aa71e358a18f8U, 0x4d8cf5c075287331U, 0xcb8db7a78604046U, 
+0x6a7404625f0d7209U, 0xa325c97eb702c83fU, 0x7c625e0f6d2ec817U, 0x103f394c6c5aa188U, 
+0x3cc5cd2876e99590U, 0xafe1761eef5f8923U, 0x7c77e357f47a0895U, 0xfa29ee348135122U, 
+0x6cc2a8ecf117ab75U, 0x886a4f8908f56e7aU, 0xaf8395def5c8653aU, 0x1250d43e77e2a26fU, 
+0xc15cc9c832de9cf0U, 0x30b18024de024b53U, 0x9b7d7ba85d2d1964U, 0xe535312e3bdc605U, 
+0x3defbf480e6da5e9U, 0x14421713bdab535aU, 0xf0ccfa5bf1c29532U, 0xdb53d7171f00dc4U, 
+0x3ebf64fb67cee75U, 0x82781320d70993f6U, 0xb19e681ab1593caeU, 0x33fa82caa224091U, 
+0xbfb3141c06c2de6bU, 0x82faf55bf91495f6U, 0xe7f0bc53772455e1U, 0x227f63177c020a9U, 
+0x5f1511bd84d212b0U, 0xb428ff64dbd56b55U, 0xea641cef27bdb641U, 0x10ee14155ba80842U, 
+0x9c3e4513ea5fe71aU, 0x2be8558500819861U, 0x6665e9a600b29846U, 0x3ba432f2d27bc3fU, 
+0x9a39c190f021fd12U, 0xfb0d687f1d2a955fU, 0x6adda712256382abU, 0x4b3d25b32f3beffU, 
+0x1f1bd9b273b842f3U, 0xf08f15ce165fc655U, 0x396e16c4499b29bU, 0xa686e259a9a57efU, 
+0xc98b0edb14bc031bU, 0x9de3ffde7b44d99cU, 0x9c285c21b463b79U, 0x10e77cf817f9c3f4U, 
+0x254d08c910c906f1U, 0xfcef5d71de578552U, 0xf5cde69e27cd89b2U, 0xc72b4e2cd18dceU, 
+0x5b65c2c1e1ca072aU, 0x2a544aaa67cac66dU, 0xfc0c29a06b0f715dU, 0x31ac7f30eafdc95U, 
+0xe7a38969e63f7296U, 0xd513c7d265003f3dU, 0xf9410b38ce03c53U, 0x113a93f196959f4cU, 
+0x6809cb7f27307909U, 0xb8e7afabe3434422U, 0x9449aad99720da3bU, 0xc8d568fe912cd09U, 
+0x15d7f37e78603ebdU, 0x3a9b7c27a43731ffU, 0x6b9018813e574d2cU, 0xdaa2dc10de9169cU, 
+0xccf0c28861b6dce7U, 0x8912eb718b729405U, 0x400146bca8a74cddU, 0x35ff4bf4f254929U, 
+0x206b09b36d343a4U, 0xd727e7efa062d6bcU, 0xa5499630d7c32705U, 0x23f75e0a3968fb9U, 
+0x159889c5c4ce19a5U, 0x6d73a746a66320bfU, 0x5df59c12e409cdacU, 0x3c101526b1301c1U, 
+0xae0ff397925cb822U, 0x15e3744008d14ca3U, 0xdd864c40939fda76U, 0xa57e46b99a86b6dU, 
+0x50b2c7740ca743faU, 0xbd48a452d73b8014U, 0xcfe8e2762eb8e38cU, 0x17747f181d7f592U, 
+0x436fd2d2a2d3431fU, 0x788882b8e98b239U, 0xba3ef2ec336656b6U, 0x135eba2ab1f3d6a2U, 
+0xb02e4f22b6d85647U, 0x9495f8490627e6daU, 0x1adda83231ba751cU, 0x4b62ad9384659cU, 
+0xa56321654ba83acaU, 0xb5795b8aa4675e4bU, 0x68c7733fb087c7faU, 0x61919bf1af4f4edU, 
+0x4a727d8b2951e5c1U, 0x8fba72b078ce230eU, 0x73dd9a33c5eaf9bdU, 0x9e33092f7837b86U, 
+0x6f5d4f69686d973U, 0x54698d812a1c7aa7U, 0xf2df4cf6ddb83f9bU, 0x1215e06af57bac3bU, 
+0x7e7c7060acf3659dU, 0x22c32296cfaab2fdU, 0x5ee76ca93fc3dd2fU, 0x46278cd373be22fU, 
+0xd642e7c1689cafe4U, 0xe8c67268fede3ca9U, 0xf3760053bdb5e566U, 0xac67783e0698268U, 
+0x641ad6ac8e05e424U, 0x575ae1b6f33eead0U, 0xae2dd957255355cfU, 0x9f97f8112db16cdU, 
+0xefc89c6f76b5e627U, 0x77d3c1703bd322e5U, 0xfc9329069daadd23U, 0xaa00e5b7372f4c2U, 
+0xcf8d979bb1549f4dU, 0x86879d283a302d3fU, 0x88c6a7843c7f0035U, 0x3e0790f2e5d089eU, 
+0xc9627cddf0679798U, 0xb2207f9effba9b5aU, 0x7125d68999ab0e85U, 0xf28e75458416572U, 
+0x4d019605c260b652U, 0xd03c27010b0accf4U, 0x1d281918762c2c5bU, 0xc440cd24f9b8951U, 
+0xf9e6a63d99917a9cU, 0x6b3ab2f90cd2cb8eU, 0x874beaaffa2da541U, 0x13afe54dc311d59U, 
+0x602a4a2d0758d07aU, 0xb27a8f3556bc774bU, 0x11a96fb03a4822f4U, 0xf40448ff1cdddfaU, 
+0xbca96ff86523ffefU, 0x4d9aa173fb8cc4abU, 0x5d1a4db2000c1c4dU, 0x133cfc33969e94f0U, 
+0xad6a41ad2027937bU, 0x7a1e86b630d09867U, 0x81da7fcaa6e48709U, 0x1a17baf7373dd79U, 
+0xe1ece58289367badU, 0x877e0aecc4edf50eU, 0x64f3f12094d7fb27U, 0xbf76be3febed374U, 
+0x57e05845e010f3dcU, 0x91100fb6607afddfU, 0x360797d74d77593U, 0x1eec245038237aaU, 
+0x5e541067df6fe816U, 0xcba3067bb6cdb78cU, 0x2fc9d92691c3f962U, 0x7d5144fe50426a1U, 
+0xc6f44639d18ee2dfU, 0x54351ce626fe9509U, 0x3b6473106845fc72U, 0xc25619f879409e3U, 
+0xb11efb0115bb827U, 0x882c607a0e1c71a7U, 0x6383000182862cdaU, 0xde35fa666d32710U, 
+0xb0c895eedc7cd04bU, 0xb82197482e7f0ac2U, 0xb54b40fc5601bfd2U, 0x5be581ad4194453U, 
+0xe47ac40373d72b53U, 0x6c238247843f9e3eU, 0xbc48623190db4c68U, 0x12da6c36ab3cbaf1U, 
+0xbb6b36fd0ca13d54U, 0x5b92a23f289fef4dU, 0x6eabd75500894a2aU, 0x6bea6649ef215d6U, 
+0xff3fe97ddb60326eU, 0xe9d36b0d41692a2bU, 0x39e968b758761ca9U, 0x49199fbbbec20e2U, 
+0xc98b7d0ebe52cfaU, 0x8837581a6f5b46a2U, 0xdf7354ae0c4a1c8bU, 0x2c4f6d5da5d3356U, 
+0x57768457d66decc5U, 0x1c40df951a9cf353U, 0x550fa62284c3451eU, 0xaf8669d84c6b46cU, 
+0xfa0b4b2381e956aU, 0x3939d456f1697818U, 0x87d65f7d49e369b6U, 0x567cf20e1cef72U, 
+0x5536c8dbcaf8169dU, 0x93c920e2cb4b9df3U, 0x1e0d51e1f65ba9cdU, 0xc25d6b4c977747bU, 
+0xe55b435e2c07846eU, 0x1e69c7752541ef85U, 0xe17025a6024f8a4bU, 0x112d6dabe5349deU, 
+0x2c479baac73a1b8cU, 0xf136a798ccf0596bU, 0x5d5ae5e681d442acU, 0xd0b1eef5efff14fU, 
+0x904afa6d150b3282U, 0x34de832c902cd3e7U, 0x2fd668b341f33604U, 0x1215744274929c07U, 
+0xc34a1aae9985b631U, 0x9f6fc7275e6f70bU, 0x1405911809fa6305U, 0xecc22524eb093a7U, 
+0x97ecf7c1a116981eU, 0x4860e98f07c37d5bU, 0x58c7eb6d939bed61U, 0x131d11d8793db123U, 
+0x58442854d6a91f76U, 0x9218da357adb783dU, 0x76b11abcb5cc1640U, 0xc266649a2ee5a41U, 
+0x67461a486b18cadcU, 0x4c09849ed1131f89U, 0xa7ccf79672cb716bU, 0x1108ca5afb3b69d3U, 
+0xf052e22cc4c74933U, 0xec13d575f7a0ed97U, 0xc15fab7efa9c25d1U, 0x36aab7f322409b5U, 
+0x7be93165a921659eU, 0xd73e245280c46ed6U, 0x9615ccc339d640a8U, 0xfa9a98e5db8a7f1U, 
+0xc81c34ad0c86aa1eU, 0x1aa5e607862bc762U, 0x5e385de1eb3f8b6aU, 0x29e46e64384e818U, 
+0xbd403cf142c4fb1bU, 0x61eee238bd54856U, 0x2b5932c83aba63dfU, 0x5028c13ed63f646U, 
+0xa90cebb9aa9af21bU, 0x628e3028eacd34bbU, 0x787f476ca95da48eU, 0xf92342a9e0012bbU, 
+0x479c6e7c803c9469U, 0x869d187cf21a0e96U, 0x66a50e21be47d7d1U, 0x57afe5fe86f1212U, 
+0x873137d00478199U, 0x82692691663626e3U, 0xa3887d4f061a1de2U, 0x4f141d6ca63c954U, 
+0x4394b22add5afd1fU, 0x264de3554076ca3dU, 0xc0374b0245c3c143U, 0x10cbb90e9bc48f8U, 
+0x3a36b31c14f2f2f2U, 0x360bef0f38b432e7U, 0xb605018d489333c4U, 0x282e155875aff6dU, 
+0x5001a9fbeb720751U, 0x59a23945e4af3f5bU, 0xea5d6f96a7ae910cU, 0x107a590b445a1e2eU, 
+0xf6a3545002442f97U, 0xee6661057ed3a5d7U, 0xeda918e39e70362aU, 0x11db4ed926d7fa6cU, 
+0xc1d8446d80daaab5U, 0x7b70f2f74aef649aU, 0xbde4687456ea0758U, 0x9f8add361ea26abU, 
+0xde7f5e42cf27c307U, 0x822f76eda56825adU, 0x8e340dac47ecb80U, 0x10089d17333039c0U, 
+0xacf646372897e06bU, 0x5759a0294c6f28b1U, 0x613133d7381deaf8U, 0x15f02af05d6f652U, 
+0x68eacbe0ad55b26cU, 0x7c701ae3479410fU, 0xac09c7b68abfa0ccU, 0x138c3d02ab8c9d6cU, 
+0x2108d8fd1c8df257U, 0xd72685c45efbfa0U, 0xa8e357f4ea5a384fU, 0xc87f3bb2119b288U, 
+0x74e2f8f2cac3233aU, 0x292ef961b5feda67U, 0x3d7e89f07ee5e611U, 0xe6f43371980a52aU, 
+0xd52c524fc981e2b0U, 0x45fb86cf6d57c6eeU, 0xdf1e57acae8a8c9bU, 0xb7500d78839a4caU, 
+0xf2ff8fb2a20951fdU, 0x5067561b213593c0U, 0x3b3b41ba9cbe600aU, 0x1157a1197699aac3U, 
+0x4ac7194163a4c5e2U, 0x5c8d29afb65426b2U, 0x6967d0db13ce9fbeU, 0xbadfd1506bf6358U, 
+0x56ebb9acbf254b98U, 0xb20f5780c5df72aaU, 0xd067770310512476U, 0xc270dc88724178U, 
+0xc94b7495d4fe5bb2U, 0x249b660ed12c24a9U, 0x14be14d5e3210f4bU, 0xf59cab280e2be8bU, 
+0x8344fe426e06f32bU, 0xca3424fb79c91409U, 0x2e6c427798a0fc6bU, 0x45d3fbaead13d3cU, 
+0x734d1bd134895908U, 0x262b7ab8aa2e7c29U, 0xc782487760c81a8fU, 0x10c8b9700b208583U, 
+0x33a956d3fcd1fe9aU, 0xbedb660e2b0fda6dU, 0x17590ff9e42fe04eU, 0x3552bb5916bd23cU, 
+0x4a271fc228f68637U, 0x351e77979a1ca4bdU, 0x636dbf49a58f33d3U, 0xade53bb1e17a4c7U, 
+0xe7338212b2227d1bU, 0xe07d0ca4edd4a1dcU, 0x8c0546c64145ca43U, 0x469e0dd3558c20eU, 
+0xab650039b7903bf8U, 0xb6c013c6e7399791U, 0x269e414d9336400eU, 0x130534ed74325c0U, 
+0x18376d508cf2ce85U, 0xe0d9ca03a62781dcU, 0x1b0e259c21fad615U, 0xb362c8f4ebe1cdeU, 
+0x6881739dcaa55db6U, 0x6de5a7b64a5c825bU, 0xd9148256f272ac1dU, 0xd93bdfd11c3f7a9U, 
+0x3aa9a25d40a09595U, 0x8f4db09148e1ce27U, 0xad67dfc4633269abU, 0x2e31b43e1ef84a2U, 
+0x3cce378ed6474b8aU, 0xadc45689347efeeeU, 0xc1373b3e20eeae38U, 0x236656c90960f0bU, 
+0x52e38f993e4fcc72U, 0x32be004bb332301dU, 0x26ef5b8865ed0018U, 0x122714f6aa171196U, 
+0x26bee579f0879653U, 0x4fe9df079413b0c0U, 0xd0a2876ceffb2c19U, 0xd7935d24e1b9726U, 
+0x11fc789ff1f380d9U, 0xfec5d5d31735ab45U, 0x584ba1089f60b18fU, 0x424d6aaecd2dcaaU, 
+0x912da74c9b7f8bceU, 0x496f8973805e2922U, 0xc6b0a4232e63a7fcU, 0x7e898afbf164417U, 
+0xf5e88d321d47cfe9U, 0xf7d9261aa472f45aU, 0x5db87be0b281d5f2U, 0x858ab7954330b34U, 
+0xbea004d2b9957ad4U, 0x78a801810042b12dU, 0xdeaf53019acf6fe3U, 0x12e2df2edbbb2ccfU, 
+0xde03332be8fb37f0U, 0x35c184cd79cb8cfcU, 0xf99b43fcd8b3f0e2U, 0x9aa3d3941a4e843U, 
+0xdb5c2dab6129a399U, 0xa2765914f6d266aU, 0xc0b1fd9aaab8d7c1U, 0xbf6284e86b3bb4eU, 
+0x6b326c78a827a103U, 0x66425329f6be5685U, 0x3e976e76bef7a154U, 0x108a717a8718ef84U, 
+0xb4480a5eacd5f069U, 0xe2d808d469e1341aU, 0xb73793f23d1b4fc8U, 0x2276ee976096db3U, 
+0x39826c3817425036U, 0x36cef5472a799b33U, 0xbcaaf7926232b1dbU, 0x12ed9ea7112f8946U, 
+0xff01de44a17a989fU, 0xdd8ff365f919a46dU, 0x68c532d40bd47e9eU, 0x901e972dee046beU, 
+0xc33cf9852335190aU, 0x24b9722d42d56e2fU, 0x3ed82f76a5f46ec2U, 0x129fb2553c5a8f47U, 
+0xb874aa3dd4f134f9U, 0x6749277d34496318U, 0xeb9a21d629e84888U, 0x454f67a717df0d0U, 
+0xd0632ee4a74c5fb1U, 0x1a832f5f2707435cU, 0x7df75a75afc2f8U, 0x11fde03bfe953876U, 
+0xe199bf4e8c4540caU, 0xc3c234b2f854f062U, 0x9d66e59bdf49cf50U, 0xa28cd775c5500a9U, 
+0xfaa98747d1425f82U, 0x765fbc6fa8dc2e12U, 0xa0332caa9a81e3c2U, 0x6afa2f1d31fbb8bU, 
+0xe88ad8ae2c6e0b6cU, 0xbcbadd80e281491eU, 0x2c2db25df10aabb4U, 0xc81739f294ef520U, 
+0xe56cc0b48df0eabdU, 0x347edf73ee8e804dU, 0x1f192c3edb11a617U, 0x6907b419ec2bc2fU, 
+0xf6a580b693da7fa9U, 0x1a0bf73703d1512eU, 0x1ef7a2f831177999U, 0x8456cae81e12762U, 
+0xb856f52a6d0bda6dU, 0x51553b6bd2e95624U, 0x72e5024a3c37f907U, 0x10182a43dc9c06d8U, 
+0xc75d1f71cc5d85f0U, 0x6e73c5955928cc09U, 0x10429ab1c1c53e59U, 0x6ef345e7d0d622U, 
+0x68a2b87933cb6b32U, 0xc68b919777197b16U, 0x7423d7d287ea105eU, 0x1f9a3a3e9ac02e1U, 
+0xdd248aa9407ef9edU, 0x86615b21549d19f9U, 0x4c2b674d79912beaU, 0x6036aa154315b7fU, 
+0x9b69b7350923779cU, 0x1fedfec6e6709b1eU, 0xa14ad7981a97527dU, 0x816c59d9c593cb7U, 
+0xd27554ea10087d8U, 0x1fb9dba3c4ecc709U, 0x8457eb089bfcebffU, 0x44e2a708cd0fbf6U, 
+0xd70f5e5482c2ffd5U, 0x90efa17798f30bbeU, 0x5724600590732084U, 0x10a29cbcccaa602dU, 
+0x876fbada1629d4c0U, 0x85387ccdf6721239U, 0xee5a2feb68ed505aU, 0x437b2f1922cfd7cU, 
+0xd9cd36eaff61cdb3U, 0x3f61e2d0c91658e8U, 0x695c93f17abd2f6cU, 0xa7dbb463242a925U, 
+0x90935f1bf7c4e0dbU, 0xe34b348fd8ba6062U, 0xd53f4edec07585fcU, 0x6d43cf1805bce30U, 
+0x3c6046be26ecb7d7U, 0x2d59d8216eb770ddU, 0x6206513dfb3f101aU, 0xacbda54972ca204U, 
+0xc8189d72560febdeU, 0x8af7adff22793a1dU, 0x473a9f7081f1ced8U, 0xfe672e8e1ffd98cU, 
+0x4df1458927e2fc44U, 0x8aa426f8359f9d85U, 0x5a79ed01ffe830cbU, 0x6c00b64ffd6ea4dU, 
+0xb915073b181d977aU, 0x2d257a4bcc1add35U, 0xd688a429774c7275U, 0xb3baa0b7379b279U, 
+0xd125ca6cde92dca6U, 0xb37aa3760c89ad06U, 0xbc6e4d86495adf23U, 0x11908c1e644afec4U, 
+0x6591f22f9101f2fdU, 0x59cf7f25ffe11129U, 0x1cd5daf4c828cf6aU, 0x17c6b4cfbadaaf9U, 
+0xe953849711f97ffaU, 0x48bc52532264ea24U, 0x5bc6205a61de4226U, 0x134ce4669619b39bU, 
+0xac42831143241b3aU, 0x96216473c58dbccU, 0xdd93d3cd184f140U, 0x1e0c33f3d0b5b7cU, 
+0x328140efddc6403bU, 0xb5ee77c08400b473U, 0xbaa4c9f002fb114cU, 0x11c637ac6dbf0024U, 
+0x9e21a29c7cf7c991U, 0x7cf9bb208ff2f482U, 0xe7df0eb061aca559U, 0xbd7af3f7699fdb7U, 
+0x51e0e1798a14376aU, 0x889ca085c1923455U, 0x30ddd328a6c85972U, 0xb0bd50778df8561U, 
+0xdf5dfa721473ed3dU, 0x89708b952d492f33U, 0x92cc6556e75cba56U, 0x1322fb5fe3b69909U, 
+0x85d9bad2deac8429U, 0x33a130bf9b8363fdU, 0x9a53fe6cece43f37U, 0x10c830c467c49a1U, 
+0xe87ca4c55e9665a8U, 0xb92e7fd4044500ccU, 0x1e34cdf9cb72fff5U, 0xa5fc84af2715f0cU, 
+0x78ddfc39c95c9b3fU, 0xb6a1c25dd1020d22U, 0x9038805dfebc4824U, 0x680c4a40a2a3838U, 
+0x34ba9118500b6db7U, 0x65c9baa63faa3f8U, 0x34f413a585654829U, 0xd089172e0802be1U, 
+0x4361ceaf147fd956U, 0xbb3f3c7fb76871aeU, 0x895a80d3df97c8d0U, 0x90eb23ef0cf7a6cU, 
+0x4a4109f5f6dcb146U, 0xb2fca6393470e8ccU, 0x779c946bec8bcbccU, 0x3815e01c2effd82U, 
+0x932c9ca30442bc8eU, 0x737de1f20812b438U, 0x1abf187e1fea195cU, 0x3006bc75783e32aU, 
+0x9d77c5e737167016U, 0x81f2e8d4c0e57afeU, 0x3a102d45b9bd7b1fU, 0x57a0c094a942efU, 
+0x130027a65d3ef95fU, 0x322eb0e49713cac0U, 0x7a724bd0a014dc78U, 0x102de74d520fdd8cU, 
+0x3566aa77382b21beU, 0xd293b849976a9ff9U, 0x68cf7dac65ba699U, 0x272778708ffe9c6U, 
+0xca85222580c01726U, 0xeffacf189b5e8cb1U, 0x8df0acf10d558b51U, 0x6b280b9e5176346U, 
+0xd1deabe8a026cecaU, 0x7c6b3b062cad75cU, 0xd3bb9c47e8510cd8U, 0x11fd155a9e80031U, 
+0x37f77ab54434f156U, 0xd1c4d61ba4c141d8U, 0x72434efeac7ab37cU, 0x5268a811beb77feU, 
+0x3a0b3cbfc2545884U, 0xb5335f44e4d62c6fU, 0x9f29265aaf43e5ddU, 0xf584508effb0e7fU, 
+0x117f7f430b0d198fU, 0x20adeac5ceddd695U, 0x8b44fbd08a37b01bU, 0x12b773e05ae98e2fU, 
+0x8490f592f33a649aU, 0xccbd8794e0a24f54U, 0xde50ac1273813283U, 0xfa12e6139b6a2c0U, 
+0x39f675366aecaa35U, 0x36ab2e6126b04d63U, 0x11260d580de63171U, 0x8287fdfa9d1eab8U, 
+0xade912c201120d57U, 0xb4de820b8142bb77U, 0x34d1e2c743924636U, 0x4fb4ef128f70063U, 
+0xce353cbc16131b63U, 0xa865dd6d3e6801aU, 0xfa6721fc0afa9a84U, 0xbb3326d16129d56U, 
+0x6ecff13b897a7d84U, 0xbbe53b21ea7cd28fU, 0xaf4c8103d7c194e3U, 0x2284c8138cfc924U, 
+0xe636154fc26fac39U, 0x822ce628ea5a398aU, 0xeb7031bb82ba4906U, 0x464f9a442d143efU, 
+0x2c7ea00b3c3d9cf6U, 0x4d4cbf19f7ecd75aU, 0x7a977195fc808309U, 0x3d406ec673eb16fU, 
+0xe6a7ff19e51048deU, 0x40b33250cb0ce237U, 0xa99c80c3fc01cdbeU, 0xceeab14b9b069fdU, 
+0xf5d1dde9a42ff652U, 0xa7162fe11e89f722U, 0x76031d368186c713U, 0x476197af503e0b2U, 
+0x6c9807a2ff01ae9eU, 0x2ef5097a468c356aU, 0xadb818213a3e09a3U, 0x5e831a12599d485U, 
+0x5e3aa3d0db293d7U, 0x2603b8b80f63be73U, 0xc1dcccacae4ed280U, 0x11360926a93d3f6fU, 
+0x3bb806e2a8f51243U, 0x76be256ffae3360fU, 0x2742c376464614e5U, 0xc81b4069b95a581U, 
+0xb0036cd961b9f926U, 0x34d276b48f023aabU, 0x54e5ad5b141c670dU, 0x4b2da14caa9bb63U, 
+0xbfd0dd2e208e7bU, 0x7fac7e87636be917U, 0xd62eb1350ff54e17U, 0xf0054cf68ba9abdU, 
+0x91a1219f2f13f950U, 0xd71d220e99d75711U, 0x4752929ce79c0dbdU, 0x103220ee00646734U, 
+0x1d588af6779cd0d8U, 0xa7a3a0a826e449beU, 0xd75735b34257f4c2U, 0x103b6dc9adda23a8U, 
+0xcfeaf6b8f0300772U, 0xc732ae4c37a83592U, 0x703ec7272d577091U, 0x47d9bb01ff80cf7U, 
+0xc76e923c4f8303e6U, 0xbf1d861612616aaeU, 0xb0fa30ab88c59fa6U, 0x646a2dc8930daa1U, 
+0x59080bc2795f940U, 0xbce00380368f5cdU, 0x1f5133ce8c8ea9fU, 0x104288dc110965b8U, 
+0x3f46ace21baa71d7U, 0x8ead309e5191542aU, 0xf87b2a8be9b502faU, 0x6c2c78ea14df0a4U, 
+0xc02bf2ddec5a5952U, 0x23771786fed3755fU, 0xa6ee460cca711354U, 0x115f2bcea827c3bdU, 
+0xa0c3ab5e1633549aU, 0x903c1e05c1431ceU, 0xa9907f5cfa932753U, 0x8791b3b03d9cbb4U, 
+0xc3682c33a5f1e09U, 0x7da156d909e5d305U, 0x55a86373c988589cU, 0x5c3840a9b667ae5U, 
+0x6d87011b3e6841bdU, 0x34f4633e487d69fU, 0x9d85ec814ca9251aU, 0x1165fa472e5bbc54U, 
+0xfdd8130641db34baU, 0x98af282f41f070c0U, 0xeecce9890579c9bcU, 0xd88caf651802e72U, 
+0xb9fa3ef6cd926270U, 0x196867d6e1281237U, 0x5ebeb75d66645a3cU, 0x3667b5b4dbc7c22U, 
+0x54b5da04672064aaU, 0x61ab2abf5c2ffbceU, 0x9d7b57c336edec38U, 0x1138caf1f37bafccU, 
+0x3a5e0e83336f393eU, 0x8df57d3ff7963323U, 0x80c0709b84e95fafU, 0xf577f7131076bb5U, 
+0x48688a22ba48a5d1U, 0x29fcc29309e8dda5U, 0xadbb85a4323f247aU, 0x12f0d78f437b6282U, 
+0x1aa4a733ab608653U, 0x98df677603dc1e37U, 0xd68080ca8eded9b0U, 0x4483e525812c195U, 
+0x84030705ff06a5ecU, 0x70b9f0d0675295d5U, 0x6ec9d4b22976936cU, 0x6fb6f9a6f2f7e9eU, 
+0x51fe3c0f01563ed4U, 0xc1ee34fe7f9fd711U, 0x90dfa985ee5371e8U, 0x5bd2efd5cab34b1U, 
+0xd97cc10fb854e038U, 0x118ba9f904509439U, 0x98495d6a8184f076U, 0xaeab3fc0a5cddccU, 
+0x88f4a962b9225b5U, 0x716a85fd1da796b9U, 0x1c0d45aad8cd99eaU, 0x835dcb620596d58U, 
+0x2e26818c3ffa7536U, 0xd83c5686d496467bU, 0x99e4af00833c1be0U, 0xe896c193e45d758U, 
+0x593682704645bf1fU, 0xd3dd2ce8b195c83cU, 0x4d0bbfd84e109633U, 0xb4ed97218588d6fU, 
+0x5ce3431fff7db0c2U, 0x2a7e1fd7b26e8374U, 0xb83621f5552b8d67U, 0x1265b7c89a5bf547U, 
+0xb8293e0ea88dd5f8U, 0xb446cdfe5d5e079aU, 0xd667a137a7910c77U, 0xfce853e74ceb67cU, 
+0xe166a0c924293991U, 0x8aa93ac72fe41564U, 0xae0c78e3f0ca752eU, 0xa88193aec6596e3U, 
+0x8600ea9cd0edf9bcU, 0xb2115c964236c78aU, 0xcb1a19dca2182e1fU, 0x11b47eaa374f67f0U, 
+0x3deceb1e408518dcU, 0x8d3c43b2a4db5bb8U, 0xf47ad23d66e7cbd2U, 0x12f4df3481c0d869U, 
+0xfa828e74aa6b499cU, 0x145580d8708ed931U, 0x76e8e90539a30ccdU, 0x1110d397a5e92e18U, 
+0x9f74dc303d03b0d2U, 0x33a784a16d240dd1U, 0x7f4a273512c13fabU, 0x1073a7bd57386170U, 
+0x41c8761f3be45357U, 0xe92ba313e4e6e2d9U, 0x1b6557906349b95eU, 0x8248d33de7978e8U, 
+0xe97bd7eab8273d22U, 0x45ad1f8deb6952dbU, 0x52e7694cf6e0c4d9U, 0x61b96f07352bc8bU, 
+0x943913e61af8714aU, 0xa8f4b000d04c41a2U, 0x4018c9ecae15f9eU, 0x4edc5bfb5b6efa7U, 
+0xa81ce859e31f4793U, 0x23443ca6959cdbafU, 0x5a84c9a621100865U, 0x7e7600f115a7385U, 
+0xeb0b79be68964a13U, 0x4a2c80f3eec76870U, 0x1a09f845353cd632U, 0x12aa8f018bbd2a2U, 
+0xe7012b00a9a2757cU, 0xfa3649192ecf5f2eU, 0xe4c5c84a36220bffU, 0x11195ffdf534a424U, 
+0xbe405a064b2208f6U, 0x73fd5539a4a9e996U, 0x318f1081bb3be03dU, 0xadcb4f9d785785bU, 
+0x2073a1cbe485913fU, 0xaf0d4870fafab4b1U, 0xadbbf5a333599eb4U, 0x466e10d138a7060U, 
+0xc31427d90f74829aU, 0x75ffd7eefbc4c781U, 0xcdbd33bf403bb526U, 0x139de369b517319aU, 
+0x8a0f90ec4d59bc43U, 0x49aa3066fcbacae4U, 0xab90604a92ff0ed2U, 0xfb1f60e283e6e2aU, 
+0xb53fac35924e3d19U, 0x34d6177be1447da1U, 0xba81de644ecd99deU, 0x10030526e4eb7cecU, 
+0x57a270d6a5bc993U, 0xcdf5679542401438U, 0x15a6480bd61e0f9eU, 0xf552b8d2818525U, 
+0x7a0d540f9a8b551cU, 0x5705cf291901b60eU, 0x483cc3b3a7643aadU, 0x8ca46e44fee0ec3U, 
+0xbfdad388592e1103U, 0x83442623573d00a1U, 0x44dcd084e5a6d03aU, 0x113c8f51926c556eU, 
+0x2091c7668c770cddU, 0x969900ae51437c8aU, 0xddae2cd488d1c51fU, 0xbf4cdf1acdd3d10U, 
+0x5cf33ed260d5cdcU, 0xd379b7b887b92b37U, 0x3253b2c9e49860fbU, 0x1078eeccd10147ffU, 
+0x7f981708bbfc071dU, 0x4d59b2f66b2706d7U, 0xa6e38076cfd56efcU, 0x27d00c48b5448c6U, 
+0xaf88bf92d2aff7bfU, 0xd4a79dd34af94bcaU, 0x97ad7eba3801c513U, 0x11db2e907fd67a5U, 
+0x2ada4e3d31105636U, 0x4c478f2ecacc3e41U, 0xd373c9cb4754b32U, 0x10c790405e04ff85U, 
+0x792aa26d8a982fc0U, 0x75f0ba6976cc4c34U, 0x2d6ef123b0a33475U, 0x137a664c1c046deU, 
+0xa4dcde7068a896eU, 0xc5a4dfb43eb04b2cU, 0xc5a84b9d56ba5429U, 0xc32dcdcc497d436U, 
+0x5b94d5c9283194d9U, 0xe04e9ed43d3c1bc9U, 0xba1c696de71bcd1U, 0x64311e00c694ed9U, 
+0x39ec806ec3bb360eU, 0xcb856b8305c9b4b6U, 0xa063ead61e29e04aU, 0xf0024efcc03da5eU, 
+0x47eb157f23831519U, 0x6b3b5f8193e06832U, 0x80f2d82333f17ba3U, 0xbd483ba7dbc6b6fU, 
+0xf7fb1f265220360fU, 0x79c309d1b56958a9U, 0x8446af83dd3e524cU, 0x2cd0b1146373960U, 
+0x6857378618057b12U, 0x5c643159e31c182cU, 0x666d55fedf3a5f25U, 0xd97532e36430322U, 
+0xc3f463fa01900f1aU, 0xc513c063f027cbd6U, 0x3c742bb322608683U, 0x12b5dfaa7886bc17U, 
+0x84e0f63537c4e56fU, 0x87293c3ced863936U, 0x60c861177e27f7efU, 0x58c94134e0ecda8U, 
+0x76e6fd65dc42e99U, 0xb47e617e36730b2U, 0x550c3c747ac9a7bcU, 0x7350854817ccf8U, 
+0x5b1faa1b82dd966cU, 0xe0bef3ef517a9ee1U, 0x5d8f65705c3d0f0cU, 0x94ae06293a90d1U, 
+0xb0afbfda1b1c323aU, 0xec143f43e6b175b6U, 0x69b1f3030632eb1U, 0x9bc86d64935258cU, 
+0x59b98e8f167f5abcU, 0x5817d28f4354e1b7U, 0x7cb7685283be2e90U, 0x25bc6c5b29a6609U, 
+0x868c17e057e570ecU, 0xace4e821ae213e3cU, 0x5674d60da5abea57U, 0x1123013daa7d81d3U, 
+0x5f5a82808414d3beU, 0x980594064346585fU, 0x2c5a2a21b870f42bU, 0x7a8986aa39ee3ffU, 
+0xc3c36c41fd150d55U, 0x6a7391b79d27652fU, 0xc5b29bc32d8df6ceU, 0x874558d3302cf98U, 
+0x164fa158aea72880U, 0xa3fd686f57235ecbU, 0x9fe6d4db785274e4U, 0x914c31e1810a724U, 
+0x6153ca96645ce987U, 0x8ab9fdfeb895f330U, 0xaf6d24a2121f16c1U, 0xc98fdf68149732cU, 
+0x593772b190f508ecU, 0x9ba9fbefb387bf9eU, 0x7481b2126e86b627U, 0x9dda0a9482b37eU, 
+0x87844dfebe2ba1fdU, 0xf169c1e6e876bd53U, 0x2099104a6ca12954U, 0x10031b1086e10638U, 
+0xefcb4e16e80e9b7eU, 0x8c2e455930f775c7U, 0xd8ebe1401f4d10f1U, 0xc7ee34d2812a9e6U, 
+0xcfca624142787dccU, 0x137b6505a4e05db6U, 0x19d472dcc49a936eU, 0x7666a099c157421U, 
+0xc735eef3e848d9c3U, 0xb3b501c0c8452d2aU, 0xe39d73906c051b32U, 0x2a4afa665f627d8U, 
+0xbc0f0b60f7aed453U, 0xb9b8e19dc908e1d2U, 0x457b3196fa855dc8U, 0x78149775c30df74U, 
+0x2c5768b89e2e4735U, 0xdf075eeff268534bU, 0xa1f70355b8d5abc9U, 0x24476939067ca95U, 
+0x72ff95e748c0398U, 0x5cb66c0ee5182e14U, 0xdb3fa48ac59bdcdcU, 0xd947cdb3c16603bU, 
+0x5dce8ac59ed387c7U, 0x27a21f292ebe3611U, 0x82f4614bf78aacbdU, 0x9e7e6fe6f2e91ecU, 
+0x6c029b77bf8bc5afU, 0xbaf27ff8f61ecb8eU, 0x2c9414a3460f1bedU, 0x8894cdc99a75dacU, 
+0xe4cc1e25cf4d8d7dU, 0x10b3b86e935e8ba2U, 0x36cc2c02446f2d92U, 0x4332f2c7f3bf5c0U, 
+0xbdd7a3725f62744bU, 0xe4433a58a4c9f9acU, 0x724a4c9c5e285db2U, 0xd13e442d0ad897cU, 
+0x9a0d13abcb6b6c2U, 0x51d4015bc1271da5U, 0xceffc21b8f7da778U, 0x1366b4a0edd6b713U, 
+0xe2b62082f4d3c7dcU, 0x9a8f8fb79690164dU, 0x4f63ba1ba958571eU, 0xd51c966232855b3U, 
+0x5541c06e5626cf0U, 0x2ea1fb3951cdaf37U, 0xdb993a3595d1359U, 0xcb9d5cc89327409U, 
+0xefbc74879865711cU, 0x4a47cc5e1ed35a59U, 0x1c9f975339a41c01U, 0xb04307a3bf6cc32U, 
+0x1043b1d1c7da999U, 0xef1c6d957dca76ddU, 0x78b33ec061a36104U, 0x3ffc2608493b59dU, 
+0xd0a078e188d4da3cU, 0xf9cdf82690d3a522U, 0x63531c6060181e42U, 0x10e85a580333705U, 
+0xa852a91209fdfc08U, 0xbb346da7ecc22fafU, 0x142208e6aebd4077U, 0x89f05d47043f4b1U, 
+0x92180f41b90cacfU, 0x3c7d0ec3b90abe8U, 0x6e7fa72d6f269f4eU, 0x7d59ec8a74a64U, 
+0x8800eb8a483a3dd3U, 0xcd81bc60be645cbfU, 0xa052bbd80b54cf2fU, 0x11f45a5343134f1eU, 
+0x64c0775e57acbdcU, 0xc01f01c9e9b77408U, 0xfd20dde1eef4154dU, 0x69b8866ff434b1eU, 
+0x6c7003144ee675ffU, 0x6ee0bccbca405cfcU, 0x1c6dacc6169e5db9U, 0x1333c1604909a5f3U, 
+0x99219bcf3064dc37U, 0xdd4aebead56ac9e6U, 0x5e762847418acd82U, 0xb39395cede2f086U, 
+0x79b90073fe419807U, 0xedc3fc1bba60c5dbU, 0xa38358e077f2095aU, 0x1060d2df1dd1a81cU, 
+0x22d53f29297ad687U, 0x2604fd3b9a0f5f06U, 0xf6836e0b10b6dfc0U, 0x5f228dbf0ce0b48U, 
+0x9a7022ab4521f928U, 0x5263a15f3552fdebU, 0x681a33db5d21970dU, 0x3db7a6515de2a09U, 
+0x72b54f36701f7facU, 0xf028461a49a28cdcU, 0x4717565b1c8178abU, 0x21ba9002c197e0dU, 
+0x8a9c7b20cc4b41fU, 0xa8e2a3d5db9820a7U, 0xe7f702ad2290e705U, 0x3a0ceb4dbcba86cU, 
+0x265712301b6f151eU, 0xdc6ccbf173f7cc6fU, 0xf1a2576fe6fed73dU, 0xd7bb79b0b7a872dU, 
+0x8d10990bac2380f9U, 0x3057ecc56810e7d5U, 0x5e8c58bda8aff24eU, 0x109a24366fd54c44U, 
+0xf64f58308c6b2438U, 0x1671f565353af37aU, 0xdb25bbace80f6f2bU, 0x101834b4a7327ae4U, 
+0x239e9a40515cccf7U, 0x47eb70cf7213fce2U, 0x3ba78dc1051366ebU, 0x6359e0e68488f7cU, 
+0x19653089b2a6305dU, 0x6c49d8c7a83c2f59U, 0x91f299f14d34d520U, 0xdd90e7ac00df0aU, 
+0x27476b9a3cc471c8U, 0x5f0bcab057363dfaU, 0xfb90e45059805dc2U, 0x9906647e8ddc952U, 
+0x38a52e74fef0e975U, 0x71f2ec3684e7b3efU, 0x5218e7436462b7f9U, 0x93ad5ac0872a20bU, 
+0x9d7ff232a304113U, 0x39832ed71ea21f6U, 0xc0db3905b1d6fcefU, 0x111f2d6f962f7c9aU, 
+0x41dcfbfef149ef07U, 0x6901d8f8b30e16f8U, 0xc76d73b3db906bbbU, 0xad30257e4e3f882U, 
+0xd40eea03302f52bcU, 0xb12c489235e65fa0U, 0x5b5f551ec2f83772U, 0x861a919042994b0U, 
+0x746a8cf28404cf5fU, 0x920cb40ec3eaeb92U, 0xe8e207286deced48U, 0x1000bf16dc09c6ccU, 
+0x674885f754d65c5dU, 0xda43f840f5064483U, 0xd1b8f697806b37U, 0x80c0801cba23bc4U, 
+0x2e66b47f00b16784U, 0x8fe4fcb5dc06a71eU, 0x9c7ab9faef341aacU, 0x11da31708be1ee16U, 
+0x5effbba0f36bc07eU, 0x12f07e8591fe84afU, 0x53150ac004afe279U, 0x12e094a0f5f62bd6U, 
+0x5362c60fc195621fU, 0x9469d0d0fd68e58dU, 0x9269714363a3d14aU, 0x54fd5c67c916ccdU, 
+0x55516dcec836d58aU, 0x8650deb5b7518c48U, 0x25efd1c41e396b9dU, 0xbc1cd453b6f7bceU, 
+0xe5ab3be677b3a79bU, 0x40cee090ef74977cU, 0x4a48cb16320710b1U, 0xf47521ab3ab42cbU, 
+0xac5c4148b9af0284U, 0x8c6b24035a8411adU, 0x6a48f63bcd0ca97U, 0x11dea586c5e5b003U, 
+0xb75939046a4a7d69U, 0x920275b894e480d8U, 0xc4e6f2481d9bf359U, 0x6f846bd539276e3U, 
+0x4271750550e04025U, 0xdf714f7be118de41U, 0xa68991c654a78a9U, 0x1272b8b796473e9eU, 
+0xb91b589c64d43276U, 0x10fedac37573dfe5U, 0xfc17c2dc2fc1dfc6U, 0x49c3167995e72dbU, 
+0x6baad74a7d4fabe8U, 0x47cd3dde74437fa2U, 0xf0ffb7c0d2fb2c6dU, 0x5c1cd70a0f85427U, 
+0x46caa16fc03ec4abU, 0x1d53419da1892e9aU, 0xb6884233cd49813bU, 0xebf58591cf3f431U, 
+0x2ad9f3dc71a83155U, 0xc99f583827291da3U, 0x569425eb5c5d16dfU, 0x89ad1ab5a553294U, 
+0x833ac17f938e546eU, 0xdbdedf10b14b7fb4U, 0x889a9218cfb069aeU, 0x6abd84f642bedf0U, 
+0xadb9e65a5959e444U, 0xca7fb3ad41b205e9U, 0xe9b8f826bcb53cd3U, 0x9465ba011926623U, 
+0x5f7487fda602c5d8U, 0x9764ec12b5c42b14U, 0x6419cc7204201ee9U, 0x10445b0e3ab4d647U, 
+0xc94a5f0410e8da1eU, 0xbd5bd76b51c581c4U, 0x5dc86070ea711d8aU, 0x351ec301e904cd5U, 
+0x4276075d27c08f99U, 0x6ab1a38b2f3aec6fU, 0x3787fc5e01c92e7cU, 0xeaad3a0ad081320U, 
+0x1256e50635f2d05cU, 0x226e118a94f3f46dU, 0xe5752279618a4f0U, 0x91a8096884386dU, 
+0x73c12b5ff523732dU, 0xdd24c0c8a877a0efU, 0xfcf6fff5ea981aa5U, 0x9a46d2bf448b813U, 
+0xe67c7a5639c4255bU, 0x872c3e68c1fbf8c7U, 0xed2a78ead487a62dU, 0x1338a842d6f2a485U, 
+0x7af49c48024e3d28U, 0x5937ae31401774a1U, 0x49d1047759067b55U, 0x108c016b14a1a67bU, 
+0xd2fe7af54d6f7e31U, 0x6ea71e1f5628e1d9U, 0x976810f9e9042cf1U, 0x1b70d6bd482ac2dU, 
+0x5cee880253eff504U, 0xb17e8270407adc12U, 0x5e741c85e7d5bf9cU, 0x98abbb739ac4164U, 
+0xf28cb3d25b3f4c54U, 0xb9dff6f27e9acb74U, 0x75941bfa4b374db5U, 0x50edaec3ff78e2cU, 
+0x2889507b0fc0b8c8U, 0x248eae97b63a9830U, 0x8a8376bc340c3ce7U, 0x92de1dfee5da7dcU, 
+0x97b037ffe003f194U, 0x1bae24c1fc4e29a9U, 0x1593c6aa156ed13aU, 0x639add10573e004U, 
+0x5ae4a9dbe928e1efU, 0x1c005cddb1731f06U, 0xb97f14c9284d19d2U, 0xbc87648a0f6c0e0U, 
+0x197cd6284a930a79U, 0x13220adf0c690f91U, 0x11ed941341ca9ba1U, 0xa01b6a631252ad6U, 
+0x2b6ae4ebc517da03U, 0x2e627352736fe950U, 0xb2e77dc97f96524cU, 0x3dfd8d6ef1c5efaU, 
+0xbf02f78400ef4068U, 0x99adef1caab08b2cU, 0x5ad3f2a68b18637aU, 0x10d588e0886ee11U, 
+0x3815a26d424ec0efU, 0x89c59414b1641d43U, 0x2773f6bd4d6df34aU, 0xd03bebcdf77b895U, 
+0x8e4287ee78141f3bU, 0xac246fd6f95eb96bU, 0x27225ce330c358c9U, 0xea753548e340fdfU, 
+0x96528b59bb020815U, 0xe6c1512820337b9eU, 0x385155f5371f7b59U, 0x5af6bd82fb16d7fU, 
+0x263255356db28dcbU, 0xa8a8517ebe6d22eU, 0x1155ba76f9552144U, 0xc710d48c53127a6U, 
+0x58e035f2b68c0f49U, 0xd5013206437b439bU, 0x103b04fdc38bc84U, 0x165eb63350f823fU, 
+0x14f2ef51d5dbe1fcU, 0x3c65baf80955c230U, 0xa32a395823444aeeU, 0xb17be48a4e2a738U, 
+0x9848f90fac6eca45U, 0xf9b8c52ce6d5ac81U, 0x53783dacbd910a71U, 0xbd119a340ca686aU, 
+0x6c8faf5e0b569c99U, 0x19d96ae646bbd124U, 0x3cae2cc22ef014f7U, 0xbe5aded6ad21ff2U, 
+0x104e1a22c6224e50U, 0xe543bc203dcc5ffbU, 0x9622a79f0d56d7c0U, 0x109d00bd6fb5a083U, 
+0x15f1a090817c1aa3U, 0x26c4124a7611836aU, 0x792c075745f81472U, 0xfb2eed7e757d345U, 
+0x4e69f70b1876a98bU, 0xa9a4c02fff9524b9U, 0x888bcbaa51fd65deU, 0xb4889192893be82U, 
+0x81ca2512e4ceeeadU, 0x7a1c1dd3715c2d35U, 0x94c0e1735df4006cU, 0x7656971cce10065U, 
+0xcbead8c6eadff370U, 0x7086be5af7706a5eU, 0x95a9f7ea7225d537U, 0xc8fc0f211310ce3U, 
+0xad2e75fdc489b6d8U, 0x4f8561b77c0a3718U, 0xba3baed19aac085eU, 0xd850a176344f957U, 
+0xc328c4a1edf8f228U, 0xaa1b38f8eeb4c8a3U, 0xac6042967883f44cU, 0xb925d62fbbc8dcfU, 
+0xff679ff6da329816U, 0x5131b2285b79d7ffU, 0xed3767bd427f93cbU, 0x82419e40b6cbd30U, 
+0xac7483f2bb5ed188U, 0x444207fb0a9036aeU, 0x5a09464b975e4ee9U, 0x1530706d917bb9bU, 
+0x561823647c4ba03fU, 0xc8bb6578cc637f03U, 0xf15c87bd6e761f2aU, 0xff2695923e46a2dU, 
+0x4f83d3967c0256d7U, 0xee13efe917bb1a62U, 0xec0066ca883bc817U, 0xc89586fc6544b83U, 
+0x18f11ecabe1e8d2U, 0xb532cec0950e8acaU, 0x33360e2c91ade712U, 0xb17c1a83397f7a8U, 
+0x8a9c8337e4ba7445U, 0xb4c49c2cf1029caaU, 0x9a2e1d8c09cc9940U, 0xd868404a87184d1U, 
+0x9c6b0bc407e8c225U, 0x410bd69a6a9adf00U, 0x962924598b097cb5U, 0xc69d88e74da9839U, 
+0x2bdbbf118839b8acU, 0xce979c1d26d01599U, 0x678ad1cccdf7eee0U, 0x102b9e27a2e552efU, 
+0x4549afce4ef26641U, 0x80d1c343405abd15U, 0x6d33efcb4fbed832U, 0x1042773312e8dfd3U, 
+0x2c501eabaef1fe00U, 0x30a3a354646f11e2U, 0x5427911a3d7b969U, 0x9620d80c7e9d2c8U, 
+0x1ed0c1bfad9963cdU, 0x5ad0dc139064a16fU, 0xa390af57fc28111dU, 0xa14e7ff15838224U, 
+0x3b89c22ba3d5fe72U, 0x1947fcf5dbff0107U, 0x7834c5bd3b635afbU, 0xea2951e6dcc2c62U, 
+0xb5c39449fcaa7c02U, 0x88f74064ba84f666U, 0x7b9dc9f4bf2c9d3eU, 0x139a89ffbf467284U, 
+0xaa458e0b6930a0f3U, 0xe8d8ce4ad4b75215U, 0xb3ba79f6bf294779U, 0xdfade729f1454edU, 
+0x1fb41af0d7357378U, 0x432a2d9dfb85927cU, 0x19efd08a88d41ef4U, 0xac98feade448bacU, 
+0xb064996cc944b4e2U, 0x4474206b3c5ef4f2U, 0x3006d70296dbe61dU, 0xac3de48f2f048d6U, 
+0xff59118644e98334U, 0x3f2ec8e5d4a0e5bU, 0xa913975d201af50U, 0x942d342c160c175U, 
+0xf6fa83ceb03c9cafU, 0x6034facbf2fd2e78U, 0xd475a23d6b1fb001U, 0x532c8abdcbb3550U, 
+0x57be1217e225d166U, 0x81d8bfefadfe9401U, 0xf138c517c1de6ed6U, 0x122247cfde6506cbU, 
+0x4e99f7cde89c3c63U, 0xd1b8e842529f0309U, 0xe0348cd651a34268U, 0x803bea76b44e1abU, 
+0xa3eb8179cec6ed84U, 0x2553877453f8aadU, 0x303aa41dd4251ca0U, 0x471612fd2e27b97U, 
+0xe00736bce1062972U, 0x7a876af217d3a3c2U, 0x862e411a60da1477U, 0xbc7964f1656ee9aU, 
+0x6242e5e1518dd61cU, 0x940a1a8fdf143496U, 0x9681e6ea1cd42a6eU, 0x5cf829ffa221b2aU, 
+0xb5beac4662c2b486U, 0x95722ed10f58d051U, 0xe0be0aa42e88c85cU, 0xd5c09b64ae512f3U, 
+0xb0498a9899dcf790U, 0xc5bb57f0ba0fda8bU, 0x2a1610dc0b646879U, 0xe845b9118dc06deU, 
+0xed55178b866710d3U, 0x2c2d15513764cba3U, 0x2cd77922ed57c753U, 0xa1fdb2fd5ac055bU, 
+0x6f72f831033bf117U, 0x84782ea47db2d5f9U, 0xeef50cee69d8ae59U, 0x137875c96b772437U, 
+0xe86c2b82461b045cU, 0x87e44f6aa125f951U, 0xde3a4d6981d31aa0U, 0x975cf6ed3854c2cU, 
+0x30e3a0379a673b24U, 0xcbd000ccb7100917U, 0x401294118e75efecU, 0x9d979853b721613U, 
+0x495f956cf4a1e00cU, 0xe24d4d851758627bU, 0xdcbb851e91f02258U, 0xe8963f0d800e00dU, 
+0xa7e79b2b8c4bd462U, 0xd241463415df6718U, 0x1a75697c40b7294bU, 0x4a0a619be9e55e2U, 
+0xe3178bbf4a2e7e26U, 0x52e5a8444f9ef8a4U, 0x89837eceb3436f2bU, 0x72d803fe9fea21eU, 
+0x702cb66eb8e61c35U, 0x719be07002071877U, 0xf4eeb2060024a018U, 0xde3b5a224ac92f4U, 
+0xede9eca5cc1fae46U, 0x700f0b8250c8b12eU, 0x480aaf31dd90177dU, 0x113df6f30c4ed01bU, 
+0x692eb00538f6426U, 0x60c64a997170074dU, 0x7a7ef34c6767357bU, 0xbcf61f89bc58239U, 
+0x42cd5b9b0a358e8U, 0xb9436630f7aab4a7U, 0x508df2395b00b517U, 0x812086db4639f58U, 
+0xbf861e0fff8e1ccaU, 0x22e493b88a9d119bU, 0x1a9f296e4f51139U, 0xfd76a4c6c92e29cU, 
+0xe63578eda2cdac8dU, 0xc17d266ab41c78b1U, 0x2c77d7ed23de25fdU, 0x948f6c9a9058684U, 
+0xb5aedbea45ba372fU, 0x1315e409d29978aeU, 0x3bca500456e4d0bfU, 0x5ec94a7fdd92533U, 
+0x5e1afba7d6f8110cU, 0x92e458d14488ac52U, 0xc83ee46ee9dbdea1U, 0x3b286b953158271U, 
+0xec958903d7775ddaU, 0xf7d2b14ed27afd85U, 0x542a87e3564df06dU, 0x701b2d2f75a4a86U, 
+0xdf9bf7e64ff5c841U, 0xa7c73ae64f93cbe6U, 0xfad453043cc6c6f7U, 0x7c280161c7d0579U, 
+0xe7fa50459cf6a242U, 0xa3a98be335b898b8U, 0x65b0753c20c82c6fU, 0xe13263b7942c908U, 
+0x934e017581406393U, 0xf1ced583c396424eU, 0xb799131cb01ba4d1U, 0xb3ec6ee46071ea1U, 
+0xe0ff223d09dbc16cU, 0x4bb89b8989bc01a8U, 0xb1bd8db3542828c5U, 0xa813316640d2f9cU, 
+0x273d5984ef0c5945U, 0xf19a10c54adfe027U, 0x8ccae42b679301a3U, 0xd3b7152d2547eb4U, 
+0x78e117c662e3b235U, 0x1983bcc1dff525b5U, 0x99b43c6d4cca88d9U, 0xaf24c86af5ef9a4U, 
+0xb8079f58c8dbbc71U, 0xd505a59f08329aaeU, 0xdd124f7ec06430a2U, 0xd64cd0b30282969U, 
+0x348af6a0860b61f6U, 0x47ed565acd23d504U, 0x6b9359b0fa447d3bU, 0x782e78c5b84b416U, 
+0xb6438edf75247ddeU, 0xfaabfe896ae30607U, 0xfbc594dd2729e69bU, 0x40ab291fcbb24c3U, 
+0x197bc1d484d0f2dfU, 0xa15f53134110eec4U, 0x9b9edc328b53e210U, 0x81eccd7f01f85fdU, 
+0x6e00dcc5ff3bd5b1U, 0xbeda8c29bb9470a5U, 0xca02859bcbb0daeU, 0x62aaa3b8451253aU, 
+0xa38c8b220c3ed472U, 0xa0ec11a592bdf590U, 0xdfbae7e32eead4a3U, 0x54a538ae05e4b3fU, 
+0x79fa47db34074258U, 0x15c3c7529cd479f5U, 0x2cb6a91f27f77c07U, 0x677dffb6acb2955U, 
+0x1cfceac47e66a398U, 0x8b8083e948f2573bU, 0x51950292233a280fU, 0x44c462a6ed0e5f1U, 
+0xfe137c4d325005e6U, 0xae9441b8030f5081U, 0xf05c41686ab50775U, 0xe565b5407ef8b36U, 
+0xc39036cd8eb3fe66U, 0xfaed0c130706c0a9U, 0xad1bc0efcb2faf4cU, 0x2a499d6c0dd9de3U, 
+0x42321bc4c9d9f981U, 0xb015755430042e10U, 0x946e95ccfe330e8cU, 0x816f4692dc3f931U, 
+0x6895982bc034c595U, 0xabc3c4edaa2a9e4cU, 0x4e2b0c22f7edf3f9U, 0x5cf65f64c9b726U, 
+0xc13f64cdcddce4adU, 0x445f61ba1506dff8U, 0xb17186e039338ff1U, 0xc4e3d843375a6fdU, 
+0xf539fa29e438b0d7U, 0xbb38abc01dbd41aaU, 0x47f5f38dd97b1c57U, 0x4de081cfb71b598U, 
+0x7f8c4c5024d8787cU, 0x8a59d6f4e977dd18U, 0x53fa319ecd4565d0U, 0xbfd26ce048ed908U, 
+0x641579d28dde3c04U, 0x4e9b103924032f09U, 0xa4dd5a5f539adcc5U, 0xe65b416f5aa2baU, 
+0x1a1641aea17e3cf1U, 0xaa404ace5179c6d4U, 0x6810b731caf6169aU, 0x3e78097efeb9997U, 
+0xe13d1857c5b9580U, 0x80e4b1c706dc6152U, 0x4535fab3ce2f9723U, 0xc50e24780fac96U, 
+0x9a88e9a495dcfbcbU, 0xbffc0d568d4a880eU, 0xd0de0f85b919fb12U, 0xc771eaf5904ef2dU, 
+0xd373c9f8bb2b181cU, 0xd5b1b7d6a7a28849U, 0xe5ac93e8ae6be95bU, 0x116193b28aaa98ddU, 
+0x3f90bba2bc27c407U, 0xb5b32cb9436cf74fU, 0xef1a898adb2e18dfU, 0xef95ada1f799d80U, 
+0x169a7c116ccc99a9U, 0x267f4d6ba7cd32dcU, 0xe65429c8012d2e15U, 0x257bba47225f010U, 
+0x4259b8e98e006f7bU, 0xd6ed85dc0a3a9c68U, 0x367c8ba5f26d6a46U, 0x3efb79fb9a1006dU, 
+0xd433936afc7717e9U, 0x31695cb20ae99080U, 0xe0676f5c1d6aeb12U, 0x1924b8c002b2b03U, 
+0x9123f953779fb536U, 0xdd64c07ec9c93b56U, 0x189879d5083cdb68U, 0xdaf0577afb187bbU, 
+0xfe2210f1cd219ff1U, 0xdd9a6c7fea02d63eU, 0x4cbe09c720c18f02U, 0x1b3419afdb67fd1U, 
+0xda5379b0efcefd65U, 0x8e56e8d386a223c4U, 0xdc2d56a8cf4a7c28U, 0xd01d15db3e0cbcdU, 
+0x843ade50e03ff400U, 0x87c6339c53225a19U, 0x8f24e532ada8c3c5U, 0x6e5382dfafccd5U, 
+0x78c26c727a501829U, 0x62c644d318af64d3U, 0x7a6ff348084fa767U, 0xb6ac9008ecc7a52U, 
+0x77aa74f95943295cU, 0x706d9dfa98f44688U, 0x963b01e357653db0U, 0x1062f5b2c1eeb2aU, 
+0x34bb0cbb1b15c416U, 0x346d7f902fc617f0U, 0x6ba9dfc43f7e4a45U, 0x5f40fc7ebc7bb97U, 
+0x9685cfcd194f6801U, 0x9103891afb3ba33aU, 0x3e5fc53d6ca8a77bU, 0xdf66268940a2af7U, 
+0xdda31703ea09c4ecU, 0x619d90f9a84a6f97U, 0x123b87e5ae8c8a8eU, 0x84a453d6abe1515U, 
+0x7e33b3b6bddaca61U, 0xa87c22f311495241U, 0xc038053ee6204fc9U, 0x9a0b83b00816a53U, 
+0x55c998575ed29dd3U, 0x234a1f019f8e17b8U, 0xe01ca1fac7c6efbaU, 0x12fba83fa93a7071U, 
+0x8e0fd2bc1ef21337U, 0xd2eeb7f593020c57U, 0xfc43686bda9a479aU, 0x44018d69f86792bU, 
+0x82963487f68b0aafU, 0x4ecb4df306da686bU, 0x11a89c48638897b6U, 0x346f53e4384eacaU, 
+0x2113b702aaf4dfa4U, 0xfc5e63b79a752f31U, 0x27234a139c84752aU, 0xf88460b7924833U, 
+0x58f9b056354c79f5U, 0x46c315e4894b6efU, 0xf617a5f1a268d559U, 0x643a3bae7c83e33U, 
+0xaee7af9f786979baU, 0xcdff3ec548b46368U, 0x911a2c53c4d9072cU, 0xb7974b29c5d65ceU, 
+0x526d27908a70f1a1U, 0xeb5723b5147caf26U, 0x123d10cfbaa1b877U, 0x6d46ca37ec4dfefU, 
+0x2316be5dc9cef2f9U, 0xa16a65f69af64740U, 0xa5c4e3bf613463d5U, 0x572b1193819c31cU, 
+0x2985a41e060c186bU, 0x38d34a6b5d24c07bU, 0x285e6d8d1c7d17e0U, 0x10463351ffb082a1U, 
+0xa92aa66ada08460U, 0xc5098298e5487173U, 0xaa4e3f4f913eaf5aU, 0x8b8c7faba5ae279U, 
+0xab415ba6c8362288U, 0x18dbdc16c8633338U, 0x36aa43240c01fbcaU, 0xcd2f85a2494fc42U, 
+0x44a0bf9f701722dfU, 0x5a0c0085417ff7c1U, 0xf81ed41b987758e9U, 0x4fa03481faaa4d7U, 
+0xb3b0c9e1d858c21cU, 0x30d0851001a5506bU, 0xb0453149c072ee4dU, 0x54d337f4f7f308U, 
+0x617c27f57b58ed25U, 0xe9a79e5bc2d02c14U, 0xb7339b08aac9fcdU, 0xb1840b8c2379f19U, 
+0xefa19ae51e3a6cd0U, 0x804e3a8ecaf46740U, 0x51fe2383bef43ed5U, 0xeb414b01d25421dU, 
+0xb658f5e157a2aa14U, 0x93fe25492e81be5dU, 0x61dc0d89362dbe41U, 0x10d0daf1d3b5b7c9U, 
+0x3609a4ddcf1a5bd2U, 0x3ea5ba811e90c1e5U, 0x9fdd2d221d474aa5U, 0xf97951d3e3a3134U, 
+0x725a9b3e4fc0cb28U, 0xbf9cc32f57d91fdeU, 0xec8ff6e5f987c95eU, 0x4d6eca7ebe69ee8U, 
+0x480fb63f366db456U, 0x90971b33ca465585U, 0x3fdd4af16e9a7a47U, 0x8cffc4de50d7c5fU, 
+0x89bc91c3f0b91f85U, 0xf7382db126981b34U, 0xbdeda2ce40209294U, 0x7d436fd011b7af9U, 
+0x794437d8c2bfd2bdU, 0x5433a6e53b5842cdU, 0x9d4a6800fb177b65U, 0xf39fdef49f65cdeU, 
+0x9a710a8746d99142U, 0x2a4e220ff16ef298U, 0x40cce648f36b5c5fU, 0x3838353a28e27deU, 
+0xb665e0e16678d1c1U, 0xb48c163100f05e97U, 0xf49a9807d8907976U, 0x90d5a78f7d70f92U, 
+0x84f871ee8737a4b1U, 0xcdc8bc35dd76247bU, 0xf7355c2d1d2fa427U, 0x794cc45af704097U, 
+0x2a4187c243d6d5eeU, 0xb8a006a1a6bb24b6U, 0x82448ac5b9499a02U, 0xec78030891bd528U, 
+0x3a34265b08f05d57U, 0xa82e8547e4a4e2b7U, 0xf6ce7edc7250a619U, 0xe93a1958f5293aU, 
+0x2315ce78907dd2ceU, 0x76e6aee78094939aU, 0xdbcdb7bb02dd3940U, 0x5b57cbedc1dc8bdU, 
+0x3d5cf79ee4aa8afeU, 0x15f1a1c7016890c1U, 0x3d15ed81ec106d3cU, 0x830a8abcd6cb1U, 
+0xdac6fac2d48debe9U, 0x5894883482596dc2U, 0xcda8a8356ed429e2U, 0xc61a3e2ac92e886U, 
+0xfce9b03c21b85239U, 0x96008d108d8313cfU, 0x644bc0243fc65bf8U, 0x2776add553d70bU, 
+0x8d6b7a10db60d99dU, 0xe0164465a94bf470U, 0x29d4f29ed9a54d9U, 0x12828676b460cfbU, 
+0xcf5b0b55ac39ba5fU, 0x5648759c006185f1U, 0x5bc6fd16ff1abf3bU, 0xca07f6cdaa82718U, 
+0x2e81a448c0eb3f84U, 0x9528a243e59747f8U, 0xa092fbdbf97e2337U, 0x786cbf1ca9ad73eU, 
+0xcf475a25aedd2c16U, 0xeede01e760710e72U, 0x6116fc1ff9a0ddbcU, 0xd37b106a4bc8a19U, 
+0xd01f17d70ea539cfU, 0x6df3176a33c80d12U, 0xf2e533e2024a66b0U, 0x242acffe15bc77eU, 
+0x124ff8e40bae7407U, 0x8874d5efec57ef42U, 0x8a392320836f6368U, 0xfdff9540fc3c80fU, 
+0x94ee062c19adedc7U, 0x4cdd97ab2cedecf9U, 0x25833567afeb30dbU, 0x6c0c67da4dea2caU, 
+0x6e6dde72ccdc66f7U, 0x86363a309bf080a8U, 0x7ed626805da20375U, 0xfa04054904b84a5U, 
+0x1b435adc0460e9fbU, 0x43da4df663fa0f1cU, 0xa87f4198ab99936bU, 0x993d7099848f99fU, 
+0x116f3a6302f4440eU, 0x98b40989d71780efU, 0xde8ca0abb1ef7e5cU, 0x2356ecbf32c1e4bU, 
+0x11c7ce22392bf155U, 0x374d585022c2dc5aU, 0xfe9fa90f739a280fU, 0xe0d5f91df0a7322U, 
+0x5e138da048f51a95U, 0x89016375be1b98f3U, 0x8bbbede79025bb4fU, 0xdea77bd77a404a1U, 
+0xaa2a4c66c4a70191U, 0x87cfa7ae60c92324U, 0x368806acca3790daU, 0x9594d39e518f9c3U, 
+0xc18e7dcf3813b83cU, 0x2494fe0a89ae7dbfU, 0x89f231f6cad25e81U, 0x71ebe5fda72890U, 
+0xbcff80c28a5537b2U, 0x8637f4658fe71e2bU, 0x6b9a6f0fdb04e4a5U, 0x378cc6ffe1fa711U, 
+0xe4e9f995dd103750U, 0x8b84d4570758a928U, 0xb3558e7d62e7fc69U, 0xf4f566d5c6c8f20U, 
+0x4f774d6428d994e5U, 0xe71e891bc19c2635U, 0x6feda3bfb03a987bU, 0x42c049039fc4128U, 
+0x201595e3260ff269U, 0xc74727158ce28031U, 0xd4d10ed57362f101U, 0xd2c82d1502c9362U, 
+0x588444d19c600a50U, 0xc30864757682e2c2U, 0x39da035b9381c212U, 0xd9a9127c07ceeddU, 
+0xdb6ed3818a75ffe2U, 0xaec48601b955b4c5U, 0x711e5bfede415465U, 0x11f5472954e5ebb3U, 
+0xcd00a9c36806dc2U, 0x639420f9a98246a2U, 0x1a429f04ddb9f6f8U, 0x30203b9b43d741eU, 
+0x6aca2bb82489321eU, 0x862d9a9dab2060d5U, 0x73bee369dbe0e47dU, 0xc4e6ea5e7abaf6fU, 
+0xb0b84e45e7d37e60U, 0xe630234e5530c66fU, 0xc13fa6ea35f6f709U, 0xcce7572dad414c8U, 
+0xd380d007802296baU, 0x21d1d95c1a7b0d3eU, 0x2f18e43a4f08dca9U, 0x112507e2eb754bd3U, 
+0x1691db7fc217c3b4U, 0x26f9e3a7f4f96519U, 0x64e285598a2eb178U, 0x777faa189d60fc5U, 
+0x7bf5a4d85d9db906U, 0xd7ae98fad3864e03U, 0xc51a6a3087fdefb6U, 0x120d07e611848408U, 
+0x88f9ec780a81fcbfU, 0x899cb1c3441b05bbU, 0xb638aa7e5380dcb4U, 0x68eade9e70ff52dU, 
+0x741dafae8822a6d9U, 0x63305c0cffa97738U, 0x9c8ef668bc566a37U, 0x21c740e7190ab65U, 
+0x8d7f2cec4e8a0ee2U, 0x9e469807b8e5d2fU, 0x2817bffa727c62c9U, 0xc834293466ba3aU, 
+0x1cc607eba3edc79cU, 0x467dd642aae740c6U, 0x5b6fde98aa07c16cU, 0x8e82dbb3e57ac24U, 
+0x67a9cefc7302f4a3U, 0x5c6dc39f4ce6b90cU, 0xe6f37f442a9f2a98U, 0xa5585de71ae2713U, 
+0x95e1353bdb228d7aU, 0x66ed41a22e2f0552U, 0xc91bdfc01e773a44U, 0x10a004ae62ce385U, 
+0xdbd2549f9a09fc53U, 0x711c88c9c6443497U, 0xe40267e6fc949d95U, 0x7b2f0bceef34a4aU, 
+0x6520742dbb032ab2U, 0x13102f185e71d98eU, 0x396fbfe870beeaefU, 0x4517b04d4a74c1U, 
+0x96cb7f7e84465eb9U, 0xa7c6a0413edbf5b3U, 0x2d17087e0b762fdaU, 0x273b8d96aaec50bU, 
+0xddb19aacbad4e974U, 0x32e8367e99d7010dU, 0xa11e66a92a781068U, 0x1149ebdd051a1fa2U, 
+0xfc34132537261f0U, 0xb1668e7b7de57bc3U, 0x8d81d789602a632eU, 0xafc6b33e202d9cdU, 
+0xcc58e6f8372903b1U, 0x1f8bf59658a187a9U, 0x7b37f9db57ec38afU, 0xd712c359e7b5cd3U, 
+0x29a5d0099c962537U, 0xcbe0813488adb636U, 0xe67f45ba66150cf0U, 0x1023afae64728282U, 
+0x2af81a06464be3fU, 0x6beeb25ecd449480U, 0x87b88f2bf9309819U, 0x598cfadd5cab0f6U, 
+0x6335146fc04f85c8U, 0x78f453dda2e32babU, 0x70c38312d3d699feU, 0x639fbd8a5f362e8U, 
+0xe1ff6e76cd4e06a6U, 0x5d66dd53e2fd3d53U, 0x3d2a3d582cfa0d2eU, 0x136bf91d8e211e3cU, 
+0x25a8b569db317df3U, 0x62abe0b952517e94U, 0x41de2f4c3086306eU, 0x115fe501e4549563U, 
+0x6130a7bf557b6b35U, 0x62764e7152d1bb5U, 0x6ab79f1d6f24f6b8U, 0x8a628390bb92b65U, 
+0x992f5bc22cba1f73U, 0xd027fed37e4751b5U, 0xd8bc62dfcf0fec4fU, 0xb3e609b16f9b02fU, 
+0xe922660a7148276cU, 0xf707c34ec1c7d26cU, 0x74b241350412fe80U, 0x10542d6191027469U, 
+0xbd5cb719a7e5ed45U, 0xbefc3973d8d2383fU, 0x89d805e57bf93f1fU, 0x84dfab57b2ba091U, 
+0x19c0b3074b2c6c9eU, 0x3f31254d4d6f63a6U, 0x8f36498b7e323110U, 0xf74faf08d473559U, 
+0xbf1ca0523ad21c0bU, 0xbd7824515e93a6dcU, 0xbfc871ce7878d78aU, 0x5a0c8dfe87c4393U, 
+0xf8dd7651919eb130U, 0x3cf0685ef62d3a9bU, 0x4f32fb2079016d97U, 0x28c421fe4ee7445U, 
+0x1c185ab401b2361fU, 0x57aad605951d688dU, 0x319630e45efc8945U, 0x774579f0e3fdfa2U, 
+0x6d14b1ab362cf400U, 0x38fae1794225b30aU, 0xa44c8ff9ab6f6ec4U, 0x34596f113792953U, 
+0x6be8c8fa59e79d9dU, 0x4b7a7556350c7ddeU, 0x8924bcc3f351a73cU, 0x627a546baa8fb78U, 
+0xcbf3f23a24d712abU, 0x646c2ed833b82cadU, 0x955999b1ea4c9ea7U, 0x1627057eea80f11U, 
+0x1935f533f896fcc4U, 0x36c2f93b37823df5U, 0xc9cc2b243ab2ed0cU, 0x1133abba329f4c2eU, 
+0x490df55ff552a73eU, 0xa9bb3397b2e49e31U, 0x44be17dcdb8baee7U, 0xb033d5c629f9a2dU, 
+0xce1301f0582d80a0U, 0x4c2dd8c9a9aeec7eU, 0xa992ca4e629896eeU, 0x21ac4b268a02562U, 
+0xd452ff70042594c5U, 0x40fd7a6ae39e292U, 0x1df7a6c90510c4b8U, 0xa3b4dd03d62f6dbU, 
+0x65a8bad515137130U, 0xfc1832bdc5b75b65U, 0x48f4119f6ca64d79U, 0x394707f79eef3dU, 
+0xc41310c79b4014e4U, 0xae1644c53cab2f3dU, 0xb01a726cf3c1817eU, 0x107446b381ef66a1U, 
+0xbfe4bfe9d49b23d9U, 0x27982107561d9d34U, 0x74e8cd9455f0f8cU, 0x9d9164f43b436faU, 
+0xabc59c5855244427U, 0xb798fe64ac76dea8U, 0xda36a8ab83a5b34eU, 0x953bd8b5b84c5afU, 
+0x4127694383680773U, 0x55e31c38c4d9e8eeU, 0x6edc3e77d9b0d6f1U, 0xb4dc14c19c09a58U, 
+0xe22340e23f1a8a31U, 0xb175b29fa69b37d9U, 0x1cf09b0de7ca5e07U, 0x21389f734c51f11U, 
+0xfdcb219ee08745f5U, 0x304d83407796e84U, 0x821823612ddadfaeU, 0x30cddf918973d22U, 
+0x9620ad8aa1ca3353U, 0xfa21e1b2d4ffecU, 0x1fd82836d865b317U, 0x11d9b813d754d989U, 
+0x74cd67604a2679beU, 0xd7831fcb527d52fU, 0xec18a0a8a0b13b24U, 0xdc604b2026cd565U, 
+0xb73176498a3e4cf7U, 0xbfc84120344a174aU, 0xb4042b8bcae243fdU, 0x11810cc6b722c63cU, 
+0xcf45e09168c800afU, 0xa79f59edfaa36ef0U, 0x5b42262e0a7c2983U, 0x527af282ebd0050U, 
+0xde0ca4cbbb0e64e7U, 0x8eae119d163dc561U, 0x5e09b976f35dde2aU, 0x6a2964940edc552U, 
+0x37cd6ac4767dcf68U, 0xddb81dd1e09ca5f0U, 0x9a4439de15d613deU, 0x20387bae17abd6aU, 
+0x7e67585fd7b714daU, 0x2f376b5df24004efU, 0xa46be82969f8be7eU, 0x47012592e366bedU, 
+0xae6f8f27efaecb8U, 0x10dc07f0dc199b83U, 0x13f331f1b0d23319U, 0xa1a3f415edfe5b7U, 
+0xb7dea5cf5114be9fU, 0x92159ce2f9440594U, 0x516d52b91b81835cU, 0x1296ca4d8d41e6ecU, 
+0x91a54ce0118e1d5aU, 0x20975c333adbaaeU, 0x889e9590dbd3152fU, 0x4921df3d85f7d51U, 
+0x2b0355a001a31208U, 0xd2a63f705f5f6446U, 0xac0fa7a2d7c12dfcU, 0xabd78387913b3e1U, 
+0x8ea208addb2c9d79U, 0xb26201ee348f5e01U, 0xa9ad552885b7e25U, 0x26417358723ed35U, 
+0x633360c2b5091e96U, 0xce48004c50377c3fU, 0xc4fa20e34c0294feU, 0x81890401a67f76eU, 
+0x920caed495e17cddU, 0xf73d2d656b15c2b2U, 0x7c446550f78adfeU, 0x7237f69e6452f5bU, 
+0x303a1e09fd3c452cU, 0x6d011f50227af8fdU, 0x8f7e57cbcdf04486U, 0xa9c6d2c11c64194U, 
+0xe8152680e2129036U, 0xa789821498d3bf8aU, 0xc58b58df007c8871U, 0xbd00d93a73e3b21U, 
+0x8478848d84d7f385U, 0x5f9c34d12f447c5fU, 0x2f8f7fce61e4e65dU, 0xdecff08a6f79422U, 
+0x8a83fe42059d01cfU, 0x396038dd5b8a16eaU, 0xc0788b2476547f1dU, 0x67b939c7d3ad377U, 
+0xa7f84bcd6b88df4fU, 0x9ee29df2b26a8f61U, 0x4578fe8c597f7ac2U, 0x7b21053542a98e4U, 
+0xb79b9892aef5ed81U, 0x2d61e85aef1c6432U, 0x65e516e6be2f23b7U, 0x1595656f1ad142dU, 
+0x6322822dd6f81343U, 0x1e56779556c4d887U, 0x603c34fd23345471U, 0x119dae12c3044b48U, 
+0x6b5680339a09b1d9U, 0xd517268e1f3c3135U, 0x310631bb52bd6778U, 0xed9686450c20578U, 
+0x8da8521ac66f69b2U, 0xfb7ee0d59a5cfc7fU, 0x99535e3d155c4d25U, 0xf100bef06a07130U, 
+0x9ae89be33eb80b60U, 0x80f5f9dd95dc68f9U, 0x77c559d9e2de4939U, 0x121b5a595ad67850U, 
+0x4d6c4f22825de92aU, 0x5315cc08219b0c13U, 0xe87924f8a666ea1aU, 0x3bd1b474ebdf7fdU, 
+0xbbea556db420be71U, 0xd5432932775f8e01U, 0x3f75d907153aefd9U, 0x20a90e31cd62b99U, 
+0x226f11a991f89bccU, 0x463f41b1e24005f4U, 0xbc3d202586568c73U, 0xc8b9ac291659056U, 
+0xb66963c2a913af0cU, 0x8b4ffc3ca3af7e1bU, 0xe75d8c644622183eU, 0x6cb34976b90a142U, 
+0x621fc45b76844d20U, 0xfa2e2954d386f4dfU, 0xc6f69d349a83d1d6U, 0x1278b1d9640c5e8aU, 
+0x3a7ec72b597a12c0U, 0x1a2591dd58fb1661U, 0xd4ae9d1360f4edc1U, 0x810101e6f84d1f5U, 
+0x3b14619910585381U, 0x187edcb691492513U, 0x85ed4daad733cb21U, 0xd22896bca969a94U, 
+0xc7554b721b917a01U, 0x3579717f2e4fc085U, 0xc624e3a04c796876U, 0x74591f11e0ee8acU, 
+0x3c50d21b0a56218fU, 0x22b27428e11c67e0U, 0x4fec9e8d47b2da74U, 0x65446f70534ab03U, 
+0x5bcd19d6fef05812U, 0x4ed5b9370f03300fU, 0xac0c2de3350bbcfbU, 0x2660120bc788ad9U, 
+0xac1766cd30689c2eU, 0x763c4626c7ad0b50U, 0xd0b954917be79f48U, 0xfa8dd01a86e121aU, 
+0x4b0507d8ee3ee4d8U, 0x526255bcc71fcc7fU, 0x745459f9e2bbe4d9U, 0x1136a81db7e631c0U, 
+0x570302c8c0bac364U, 0xc015df8e1e740120U, 0xed9705ba13f02ddaU, 0x3c4a2223e898810U, 
+0x7f5a2d22c69eb0eeU, 0xf85c7864d34df1f6U, 0x397b47c495578a6fU, 0x9a22cc846f68503U, 
+0xc05f563abd3ee9a7U, 0xc72bb41caf9685c6U, 0x7f0b3ff3614bb600U, 0x3348cc21ce22cf8U, 
+0xb3545bd78a8ae06bU, 0xbe4dabb31a2e42bbU, 0x761eae3060ae0410U, 0xacfe8d062ef86cdU, 
+0x6577622f2c060ff0U, 0x4a208a442ea33922U, 0xdb0b71b2a1e49665U, 0x56a67607ed9d276U, 
+0x3e50cd86e137a59dU, 0xfacba13358c1d22dU, 0x92b0c9fcc98a0debU, 0x1108159811019336U, 
+0xa5f58b2e59d1a352U, 0xd55948178e0163d2U, 0x8c2bb83c00a26c5fU, 0x4105fac77e3a2ccU, 
+0xbad3772529af61adU, 0x92c2e799a7d20fa0U, 0x9760c1e24ae2c082U, 0xa4266b12bf3c1b6U, 
+0x64dbad71b8711a00U, 0xad52c0b8dcb41754U, 0x80b3c14cb49aa3d6U, 0x2e77885b653b39cU, 
+0x46907d903d428348U, 0x860694edc62a1ca4U, 0xca0b36f8ee23d0faU, 0x407108ac44464baU, 
+0x2bbf1b0b27a5aa22U, 0x6112eb0b5069f0b1U, 0x813b0ddd7c10d4e7U, 0x5fde7baf39a37acU, 
+0x8825f1c3219cce68U, 0xf0100c5e6dcab40bU, 0x81f63a6ea5b3385fU, 0xa266bf5484b7a13U, 
+0xf09e3fe36529b524U, 0x6e50faae41a4ece3U, 0x9dfe722a408dff42U, 0x129fb7b163bd6ed1U, 
+0xa17afea5beb38878U, 0x901e6f0adbb48d5fU, 0x3e2dba0cdce9dae8U, 0x3277fcba2008f3U, 
+0xa9d7fc3a81970fdfU, 0xcfa4f2bc6a111181U, 0x2ef6fb0c2858be2cU, 0xf90ab78e952cb42U, 
+0xfe5e088c68608301U, 0x927e0d9747422f74U, 0x7dbfbd5bc5733708U, 0x2faefef94ba4d2fU, 
+0x23b747a1b9a3018bU, 0xa4bb332b52b7fa27U, 0xa9d578d20ba1b88bU, 0x84002a65f10fee4U, 
+0xd3b9d4f8cf9e6d61U, 0x9e29ae00f6564822U, 0xf91d7d19f999d9efU, 0x11c8053dbc49c356U, 
+0x3709b6d5ed9f7eU, 0x7183d72c3ba02f2cU, 0x68a632cb5afb03dfU, 0xd8f3f88c557da37U, 
+0x9b48a0933d695500U, 0xced1d21524603d87U, 0x18667a281c66de52U, 0x2f2b5f7257b7b39U, 
+0x5a16e08c70535ed8U, 0xba6e0e7256f6c2bU, 0x7364c0ca889e5603U, 0xe4deaf80ad79adeU, 
+0x1366d001083c2c47U, 0x11d0979c57c66b0aU, 0x40134b089bac3e4eU, 0x108803991cc5ac84U, 
+0x99e855332e4d2175U, 0x1413d9f1be0fb708U, 0x1b71ab0b8b07f3d8U, 0x262a0c17553915dU, 
+0xf8924f2f179cf0aU, 0x6faf6c8be57e513U, 0x13b528c240333837U, 0x9ce0d338b5b278cU, 
+0x60bb51cd09d36d33U, 0xb21cf4ab88a3612fU, 0x33746e07d79fcea0U, 0xde84019c787b840U, 
+0xe81d822f656a45c3U, 0xbc794256e775fd21U, 0xafa2e5ab5aaeba31U, 0xececc022b784a27U, 
+0x334a47ab6bcbd9fU, 0xd4ef0c60f93c5c31U, 0x5a432303ffb975ffU, 0x81209b11593d301U, 
+0x95a68c67b62be708U, 0x73b1a62f73749762U, 0xa26d68b42968c2b3U, 0x11e177e35f6081a7U, 
+0xb72761ad7978500bU, 0x3986e79478fd1751U, 0xc48470c8a196811eU, 0x3229cafd0853a00U, 
+0x3298ab976c9e7f92U, 0x5f0c83e6bd4e7872U, 0x11f98a1e5a5a4e7bU, 0x1235d16b8b809152U, 
+0xc9d6e70eb238c085U, 0xcea653b986184b1eU, 0x67ebaa3e0bd1c32U, 0xf1153161cc38e25U, 
+0xe0dcae950d78948aU, 0xbfdd1d4928d6ed33U, 0x4d092a9425d83e56U, 0x12d9e7fe7744dfe1U, 
+0x311a62137876c538U, 0x53a02df8726f02eeU, 0x9f4919c7e1b301aU, 0x2ce14d21b78ddb4U, 
+0x8d010cda9a789ee8U, 0xb3ece2268172fd95U, 0x3436f0d231d52c70U, 0x11e6b64645efd74eU, 
+0x92b09d09ce07c8a1U, 0x257d6eddd8736e2cU, 0x8ab5131f15fba5eU, 0x28c8f2251865335U, 
+0x9bf4a484dd989dbaU, 0x5502104e38a00879U, 0xce4971ce510a8405U, 0xf407445bd7977ceU, 
+0x2dd42c1cbf2b229U, 0x4861e4d59e7c38a1U, 0x75dd1fdee8581a2aU, 0xf0b517cc77e694aU, 
+0x12ec143bd61b1171U, 0x63b76d2ee5fd4a90U, 0xfff8fc667c35a414U, 0x44d860a598f4378U, 
+0xd5a0550db055cafeU, 0x3142e74b31a8b1f0U, 0x7a090b70af47508fU, 0xf15b305a8a7d027U, 
+0xa62dc15bba71215cU, 0xae0b3252903d35edU, 0x191c9b8a6ea5a61aU, 0x9dd3dcf1672bae1U, 
+0xb9fccd18c93955fU, 0xf5b523aedc5ea8b7U, 0xf2085af3185f6e0dU, 0x9a92a77591f981dU, 
+0x8b65ee35cfc55e63U, 0x44676f5355e528e5U, 0x69c0cad1e491f05fU, 0x11cf64ffd8caba83U, 
+0xf69834ffec1548a7U, 0x8df711feac48afe4U, 0x890114fa3691669eU, 0xaf62ea7fa3df57cU, 
+0x1dc99e65e5fe6d6fU, 0x6d5be62371eef4b7U, 0x1013aad7a8f98904U, 0xee36faf4b102b6bU, 
+0xf27fd3bf71e5a56dU, 0xd96088873331a122U, 0xc3d3225507b537c9U, 0x958114f75f0f91cU, 
+0x67c93a6737c8e7c3U, 0x32d2c217bb997efcU, 0xc9755a8d90bb4647U, 0xc7782331e5d19bU, 
+0xe40c76463d36c888U, 0x7757f7675ec54e6eU, 0x8abf9e08aa4c21cbU, 0x818fe0336a9e6b1U, 
+0x1a4920dc3c4a293eU, 0xafa7ea829c3af226U, 0xcdc70f13f3617a36U, 0x1325fa0b9bf2d0b3U, 
+0xaba53d8072ea165U, 0x99dadab90fe0e402U, 0x178eb21bf1727bc1U, 0x13428e3232a8908eU, 
+0xca0a2f5c19b04435U, 0xbeecfd4d00837175U, 0x976b846673f96d6fU, 0x139d09c3a9074ea3U, 
+0xf26e07a21bf349eeU, 0xc6ccea10672c8d3U, 0x7ec14aa6fd0ef467U, 0x12c4f35950f8af59U, 
+0xffe82e55ce3353adU, 0x11bc79858b84e3caU, 0x4c648d2b69946698U, 0x9a671bea3ca8897U, 
+0xb3d289c9968d247eU, 0xeaea34ffb707f0fU, 0x6308dd22e15789fU, 0xfb325d7b5e92e31U, 
+0x858627fb5aefd094U, 0x9b4125461d9437c3U, 0x66705872bfab3fd0U, 0x109b17b37fe79e08U, 
+0x47b1360aa001b688U, 0x76b0077cc2347a41U, 0xf000891481b59841U, 0x64eaeb8af4a7e4bU, 
+0x77efebe7c0642150U, 0xb3f5c45e70d8a0aU, 0x62a2b14aeab090a5U, 0xfde3fdd40519f13U, 
+0x35d914b2f4a1bf95U, 0xa2e0910fe6913536U, 0x1cc68c2b4d533e4aU, 0x12c8f19937f06fabU, 
+0x450bde50a2459b6cU, 0x3e642f2ef2679b5cU, 0x8c743cd03c9c5f0U, 0x12ca94280c89f82dU, 
+0x7dca16ec243a9184U, 0x11fc6a88c3b3831U, 0xea26fface036bfe2U, 0xff1409124abac5aU, 
+0x15c434dcd36e4775U, 0xb7735d3771c471d4U, 0x220793c85a020e5eU, 0x83cf6ddbdf446f3U, 
+0xf6cbec3b06b1cbf1U, 0x832f7de0f7d28094U, 0x843a69eb6e69a4cbU, 0xcd946657d182d3eU, 
+0x480bbd2182f2a24bU, 0x4df2c7633b301e86U, 0x5f7a1c59dedb17d6U, 0x352e30d4d17bd42U, 
+0xa6fdbe35152c78d8U, 0xa35d06bfee457c0fU, 0x8b6f1153694295faU, 0x4a86ead9740ac73U, 
+0xc57cc781e13fb0b4U, 0x956620a7696931e1U, 0xb18bab10056bb013U, 0x863a58884ac9fb7U, 
+0xdfb61d7217e9653bU, 0xf5b76e202ca89d83U, 0xef9324fe0a8b8142U, 0xae16b63b8d05c31U, 
+0x6f1fa598b752bd59U, 0x80dc6f57684d3f64U, 0xc810ef98ef248674U, 0xd7cdbb165911705U, 
+0x613d067c3836dc58U, 0xf03f37d9f024cf8aU, 0x57100efa35a9aa01U, 0xb77abae80a40c54U, 
+0x2af91fbe2b90b331U, 0x62ba0d43ce60ada4U, 0x5689d2c60329f31dU, 0x113aea3dc9d18819U, 
+0x72cfe5d7e18acbeaU, 0xe833fb9473761ad2U, 0x600498660cd9e729U, 0xd362e394aebb48cU, 
+0x6f81897621295881U, 0x412c5fc5f32c6f76U, 0x68b314c3085e62deU, 0x114a9651e3c6d028U, 
+0x6bbd897ff633c5bU, 0x8785420427616c82U, 0x213fd8a8707ba356U, 0xb864ddc80cf7010U, 
+0x24dd07bc772fa789U, 0xf7462c236fa0ffceU, 0x4048b93c0d3114f4U, 0x10f5d9ebaa50f3c7U, 
+0x220fa551d48f9b32U, 0xf78311f91bf12ef1U, 0x1571350289020bffU, 0xcf285ea26fc08faU, 
+0xbb12b26af5a08022U, 0x584a0099269f5be8U, 0x4a19e0d11a6a0d8cU, 0x120d4d6949c35e1eU, 
+0x7063e004b43d30deU, 0x2c8ad9bc1551a1ecU, 0xaada1676e4f522b4U, 0x9cebf99eafebfe0U, 
+0x63b04780a702f5daU, 0x69414ff8e9463f4dU, 0x27761284f77e30a2U, 0x26472c0cadac7eaU, 
+0x7a4f5d2d581e5d20U, 0x8621bbad5acb1ee7U, 0x5b662d6974f267cfU, 0x352cfc23b2d396eU, 
+0xe4ecf8183dfafb64U, 0x2e4781ce720a8f99U, 0xbd08adbcbced6beU, 0x114b86dec22cae96U, 
+0xcb82343a0525b91fU, 0xdd04b3a24b4c9d86U, 0xb039d10a54632a07U, 0x11e983875d35706U, 
+0xe06a408f2c52b8a2U, 0x2db6ce1d03ae745bU, 0x12aea5677a54f374U, 0xbe9c1987d438bbU, 
+0x2d1f44cb3dc492deU, 0x5b4fa9c602c4917aU, 0xf3bc94af706e41e4U, 0x6535a4830bcda0fU, 
+0x357647a54b741713U, 0xe1b1eb96f1b45326U, 0xffa57d24c7ce5494U, 0x1c3b1e0828b80f8U, 
+0x4642798f38bca403U, 0xd06f081a6da3fda3U, 0x7c92ee72111e0f09U, 0x9735474e4453085U, 
+0xe8c453831b59e96aU, 0xb547527f82eca06bU, 0xe5102500af8708cbU, 0xb4d5432836bb71fU, 
+0xcb9fe98a81630b5fU, 0x31d658c0818406aeU, 0xfdc9256e7ee5ad75U, 0x1dd0758b99663bbU, 
+0x389aedc23d36ab8bU, 0xa4488e5fbb10c982U, 0x41e03f68591acf92U, 0x637eae5aa6d5de8U, 
+0xe96fc0f910dd7ea7U, 0xea3867d8284b62b6U, 0x11c6a99b6b4a85beU, 0x7eb92c251adea71U, 
+0x5cc6c8be8e4bdc68U, 0x4f407a19a17cac08U, 0xdce8c4fdd1aa402cU, 0x1327f52a07b723a4U, 
+0x82995373621beb83U, 0x845189957902760dU, 0x9cd6c6ac07eb186bU, 0x9bd16a1b42e94a3U, 
+0x94d20a422bc367e0U, 0xc3eab863dfbdaffU, 0xc23b90ee55684dadU, 0xaec51442fc63f7cU, 
+0x17e54f6ba064aea4U, 0xb8a8d54c24e67c30U, 0xcbea431ce99f84ddU, 0xe1df8139b117588U, 
+0x1696dc461e4554fdU, 0xef3597c39ebf762U, 0xc14849cb583c5e98U, 0xfeff340ee3fbbaU, 
+0xae044a2d6b7287b3U, 0xcca1a679b7531b7fU, 0xb815fa3f13bd4f2cU, 0x3a6241642c9aa82U, 
+0x41560e0648df3b5U, 0xa54d6f1216867589U, 0x233828224cd6206dU, 0xdb132725dcb2259U, 
+0x4474e73d6fac36f7U, 0xe3b61610a6830c6U, 0xe06c1a2501b8ef02U, 0x137cd203000ef8e3U, 
+0xbad815d854f7e865U, 0x134d53ee37633d85U, 0x6dd59eba41f9810bU, 0x103152bca0f7adc7U, 
+0x776adb1506d77b31U, 0xa8c0d1b109137df4U, 0x1acec7ba71272854U, 0x10430c30e6870d49U, 
+0x9c6fd915ded16502U, 0x41ebebe0af87e892U, 0xce29dde3d9d9086cU, 0xcb5c7cf30932acfU, 
+0x94b412f2a1640e28U, 0xdaedfcfbcafd7f7dU, 0xe2d387dfe184c3e5U, 0x4fce926d6ac606eU, 
+0x940820627d62104cU, 0x5e4eb6555adc2e3fU, 0x6764fce9195308d1U, 0xa1e86d495129658U, 
+0xd5ffb08945ca43c2U, 0xc778116efbc9e3f0U, 0xcabfee92f12d9176U, 0xc8f697b72ac7f35U, 
+0x7fc36491aed51c0U, 0x368d575337ac2faU, 0xb601c15249e842U, 0x1350cb586b8cf235U, 
+0xb359bc9bc9c26ba4U, 0xa9b268720a6c7f51U, 0x26ccce899603d591U, 0xc44abb0034d758cU, 
+0x4652db3046bf46b4U, 0xf3838fd07dfddd49U, 0xc3b200f4e06b8b51U, 0x123df2b294c11609U, 
+0xa7cc97a5a7e292a5U, 0x63164f6c95abf210U, 0xc19a5068afdc88dbU, 0x10663c8229c0855dU, 
+0x8bfb51b339ae5bfU, 0x3372e19f081e2803U, 0x244c4d4aceaa3b3fU, 0x11d0de7cc26d588eU, 
+0x9dfcdbfb1dcb1c52U, 0x9bcd66eba34ead44U, 0xfb793cef6b30f117U, 0x1103d5252b96d411U, 
+0x85e7745df521dccfU, 0x54813868acafb983U, 0xd5486862eeebd926U, 0xaf94b5a5423fa76U, 
+0x923a463e4b050f51U, 0x1a0b09cc2db3d361U, 0x412e12560fdcd71dU, 0xc373262bb7a49f2U, 
+0x2d0435787cac75d9U, 0x51c2bff91f16912fU, 0xc90565eabca2390cU, 0xa2bf62f46024be6U, 
+0x2b53d4e07c9fc343U, 0x71c46dd95ae106U, 0x7827cc26facefb79U, 0x11e6016c5b530323U, 
+0xc650025aa18540bfU, 0x45dac4884535fd10U, 0x25ff78d9f82acdc1U, 0x131f44fce4031292U, 
+0x6840dc9ee34848caU, 0xb3683dc5626af141U, 0xe37a54083aab4e32U, 0x739cb5c3984e784U, 
+0x3130b4e189cc03aeU, 0xa3c24152ab0c9ed4U, 0xf2a36b18acd217e2U, 0x139760482feeedc9U, 
+0x8f18ae175c7fda91U, 0xb439186f67f2818eU, 0x76435be72ad6cfe2U, 0x2c09bcf7dd908bdU, 
+0x643e01fe0df59796U, 0x906ed86fe40a05f4U, 0xe234cee1fcc23fd6U, 0x12a4079e5160cf5cU, 
+0x6fd11150aa9e4120U, 0x9f3e5a94fde09eaeU, 0xef91e133fe8015caU, 0x130388cc3ae317U, 
+0xe742dab47061f4fbU, 0xabd3fdadc5e94ec3U, 0xa6e3b449ead5f427U, 0x18b33c03d10e0e6U, 
+0xd79df7cb2c601fa4U, 0xfab746ec9918689cU, 0x2bdd5da86e400ce7U, 0xfe930d1f51379e5U, 
+0x38ea251af2e93c9U, 0x9c648a8109d8a42U, 0x4539901ee62b9c9eU, 0x14a28270187f3eeU, 
+0x666f257d744d3d4U, 0x8fdb21baf8e33e68U, 0xad852bb78239bd44U, 0x37c5cae3f12c48aU, 
+0x4cb5e35cf32ed446U, 0x8309695ae7092efaU, 0x47905a2994017c1fU, 0x17b8bb5cbc63f75U, 
+0xf83130281472caf6U, 0x44d0ace7b6ef1ed5U, 0xcd64ff0869d03d1U, 0x9693abc5499d866U, 
+0x9f541951659777aeU, 0x76482221274f1fb8U, 0x8a97392a5f24a7b7U, 0x69e9e6afc1d4491U, 
+0xf3e176a70fed5b37U, 0x3988bf02724f9c82U, 0x32fdeffa5821e72aU, 0xac85bb8847b6db8U, 
+0xc051fd9087689f30U, 0x628dfa813e6bb03bU, 0xa88abd2e79b655b7U, 0x104196c746bfb6e3U, 
+0xd507853739de9f8fU, 0x71c4bf3d4892f535U, 0x9f2c97639a10a66eU, 0x7181d3dc227e4fcU, 
+0xf86b4088be9f132fU, 0xf6370eddd04b41caU, 0x863418aaf2d4f986U, 0x99385c153c0770U, 
+0x2a481574463de316U, 0xa73d8d9020b4208aU, 0xee213caf74c816fcU, 0x6be21257c5f6447U, 
+0xa517a1c3d596802bU, 0xe5800a1ded4aa3d9U, 0x8478f734a86dac2eU, 0xa8399e4370af2adU, 
+0x957bf4dc3e2928dbU, 0x3c7e73877a14608aU, 0x4e9afc4f5e9c1e0eU, 0x118b1981c5cec4ccU, 
+0xdba49a04a5ade183U, 0xfd237a342a8c843U, 0x67ce8797366fd952U, 0x11bd5383b1f3bd7aU, 
+0xbe0545b21ef93f33U, 0x8a4c57bc3fff0804U, 0xec4fc9377c12d9fcU, 0x469b8f4681de364U, 
+0x47d818171c0b7a3eU, 0x57dcca0b285d3324U, 0x9857c52ed9917608U, 0xa159072a4fdd7abU, 
+0xf1200e9696e54ebbU, 0x3a74ecc9edae1210U, 0x327c8ae2731b70b9U, 0xe4c08099d18c2b0U, 
+0xc141e772ea468235U, 0xa5cfe4d7244df45cU, 0x257c1142f1032b8cU, 0x3bc1b55655cef56U, 
+0x3d5049a27c2fc185U, 0x6a71c0e77ab07bf4U, 0x826eb87840d6db9bU, 0xb657bcfe6f03cd1U, 
+0xa447ff5e730b2783U, 0xf5c191f6a210ad57U, 0x7987f788c01ef4efU, 0x1259950161c2cd4eU, 
+0xfb5c6da8c19ffd9eU, 0x4ca6d5c1ac1dd379U, 0x19d94fb0f95197bcU, 0x1382376ab8a7e024U, 
+0x46fd2580a1398777U, 0xed0e38269aab8ceU, 0x4b1c2410309acab9U, 0x94f1fe27eb91833U, 
+0xbe89a522dae7d0f4U, 0x772541fe8c9bf4f3U, 0x7d7cc700ecdd693fU, 0xd3f7936494589d9U, 
+0xeaa98eec95f361baU, 0x602906c724df0417U, 0x9015ef467929c08aU, 0xac6213aee5d8d2eU, 
+0x94a193158b2da6efU, 0xcda7180b1bb29283U, 0x79e94c01cb39eaf9U, 0xa43689f72054fccU, 
+0x8ae89090e28d2f1cU, 0xce3e88937cb52da7U, 0x7045cf5b43621a1cU, 0xb2f91c429c5009eU, 
+0xec9fbccd816a20aaU, 0xb2e4b11093e52f79U, 0x986d70e2711c9e4U, 0x906ac0d0fd80814U, 
+0x3f0fb528e557b8e5U, 0x52807adf38df4d76U, 0xbdc7d38bd93c70e6U, 0xfbc0e813d4dc274U, 
+0xb26b887e43653503U, 0xb51ed5fd8dceff60U, 0xfa6af601b4c234a9U, 0xf817c2045a13f07U, 
+0xafcd0cc4feebdcc0U, 0x1b0eb444332a5e4aU, 0x656ab3bc1dcb2abaU, 0x127713e642482431U, 
+0xb2883ba1e8cc4ad4U, 0xe9f7ac55aa4573acU, 0x8795684662e33c82U, 0x2460697d7300067U, 
+0x6a9a8e4f1ed91042U, 0xac3af203ad7e8993U, 0x9d43696e08d2f188U, 0x62884848f7b5933U, 
+0xa6cb0478974094adU, 0xa1c8ee5aeb8a82f1U, 0x4974cc4e4fc723e7U, 0x12343ab261677e14U, 
+0xa0b2ecdf562a8a7dU, 0x47513c4715762b51U, 0x743ccddcd846975cU, 0x46755b9fcecba6fU, 
+0xd139730170d4e4cfU, 0x97228dcbebb22b87U, 0xd4f7a516b2bc75ebU, 0xc8bd581c04b4e20U, 
+0x7df08ba824496426U, 0xe381f3410070c2ddU, 0x321776670af46b06U, 0xdd1953504340cc3U, 
+0xc4c1e40ce78ec1f5U, 0x95d9319c296849c2U, 0x392b741feb4b493bU, 0x70470a3a0f06597U, 
+0x36c5ad3e62ccbb35U, 0x85a51dc9e3a4b683U, 0x533ab829134386e3U, 0x11d6f43b0802714cU, 
+0x6d9a3e8da29aeabU, 0x947bc62f4f4bb42eU, 0xbecab25a2111072dU, 0x126457276fc06d1fU, 
+0x4e1575cc07f4f999U, 0x58d815f1776c3d46U, 0x8633ed37a67c6201U, 0x123ed5677e2c1e77U, 
+0x78f3b8c8a910d69U, 0xcfad34628f28ecc3U, 0x76a74fe67ebe3aa8U, 0x12df0dde96ca2bdbU, 
+0x451be5dd32c74cdfU, 0x8956497be25c1b34U, 0x8b87248896ca7009U, 0x102268aa052d1cc0U, 
+0x9a5d062a2a38fad1U, 0x118c08053caf4072U, 0xe3c0ce630110de3U, 0xf5f83897ef0c04bU, 
+0xb7beae28b9d2b127U, 0xd2f4ffc7ff498eeaU, 0x7f011151772ee4e2U, 0xc303d4cdda6d9e5U, 
+0xc8a960bbb7c9e42bU, 0xfba84e0df02964a5U, 0xe98c75dbe1eadbc7U, 0xab1bf860044c31bU, 
+0x3b563bb0f4c59d0bU, 0xe0e2b47dbfd211e0U, 0x2ea0f231a1c00cbeU, 0x308ac99d96739d7U, 
+0x3498fe57dbde02bfU, 0x41c98869b8e9e9daU, 0x5ef93d38a79e53e5U, 0x12ad230233787e9U, 
+0xbae86922e16106c3U, 0x62506cfac0071dbdU, 0x5baea48627435706U, 0x453b19cf999af1U, 
+0x9881b5ae8604db63U, 0xc81c6be2df1c92dcU, 0x9b25373caf184786U, 0x7c990935c9fcafcU, 
+0xc8a20c0d87cd156fU, 0xc8edaca4aa304f8cU, 0x4560e638fb3ca0cdU, 0x65487aa4bc35372U, 
+0x9bbe288177ae2997U, 0x98b4179696a2cd0aU, 0xd56aa18e8c3fae87U, 0x124be099f7cf8ef6U, 
+0x35390eb5a4fb798cU, 0x83227a147cd86e69U, 0xd28c49378fa156f6U, 0x11391a4f1d3f4c99U, 
+0x12880b5ef629e188U, 0x71ce6d6c8ad0d905U, 0xfe49aa9804f4ce22U, 0x766c5ace3610660U, 
+0xe3d6feeaf2758e2bU, 0x458e1c1d10b35b01U, 0x3e9cb4fbdc96d3faU, 0x128ecb3383697a3cU, 
+0x140af888cd8a56e9U, 0x8bcbd01406a9b37fU, 0x54154fceb67addafU, 0xa91a5eea5ff6996U, 
+0xb4c04a38c9490407U, 0x3645af1617923e8cU, 0x1cd8ab707ecb696dU, 0x11c58d9e9a04cfefU, 
+0xe99cc153db09e0baU, 0x8817ba3c06082e9bU, 0xd984d29f39c5b3f4U, 0x7638f033d9812d6U, 
+0x3c78596bc8959d10U, 0xd77cc04261b51041U, 0x59a868a0a2cc5becU, 0x3e8b7c72e02ad0fU, 
+0x1e9d862b647fa2f5U, 0xcbdccba7642848a3U, 0xff5b73b17d79026fU, 0xbd3ddf2bf0ce05bU, 
+0x325bb7ac8cee6c7aU, 0x9dfc5ced39cf8fb1U, 0xc7f2afefee95b783U, 0xd100aac527df5e5U, 
+0xc8e175218dde9f67U, 0xbd3b6d000ffa1c2bU, 0xe0872640242ed0fcU, 0x538e693aff2c3a4U, 
+0x7b30360561ab70d8U, 0xbcfdcecd90087290U, 0xe790d85eb5d74c76U, 0x8c7e379bcf32f37U, 
+0xe9fb6813e1454fa5U, 0xe7b669a6008bcb63U, 0x9dc5b14716e0529fU, 0x11af06bab8f6f0d8U, 
+0x678c9eaf97531272U, 0x190a85409270cc02U, 0xd8b6c075ba92ce05U, 0x5844f400e4f8171U, 
+0x185effc0051347d2U, 0x507a93cbc7908ad7U, 0xae15057a025cad7cU, 0x134532e482700364U, 
+0x904416df3d225b7bU, 0xd89f621ad526fc28U, 0xca7d3a2e08f510caU, 0x6f2e58a79279e24U, 
+0x4771073643d6d71fU, 0x5af0d42e109d6701U, 0xb1ba0b9b6a8e548dU, 0xdba73c84fbaaac6U, 
+0x310026a3eeb0461dU, 0x755bcf0d051dc383U, 0xe3ba908b64b67611U, 0x899f8d6a79bf1f4U, 
+0x20f96578897ff867U, 0xe74672ff602f925dU, 0xd3166da233739fc3U, 0x514703bf22d0ef1U, 
+0xdbed1796336564b5U, 0xf37069eef06390c0U, 0x32a048bf8ed1248fU, 0x680b3ddac9eb0c6U, 
+0x4048f1c2b1fabd07U, 0x1c5841feeafcc015U, 0x5bf5e58d7791ee72U, 0xdb9fb231db97532U, 
+0x25cbb3dc33dc94b2U, 0x38bdf86404efdfb4U, 0x655082b6fb387aa5U, 0x13506fa856c8f244U, 
+0xded26db2bb13896bU, 0xed9f287091d6d95bU, 0xf3e66e8dd97e49f9U, 0xc27af113ce6ae42U, 
+0xdd7e61db042ba3b1U, 0xd62e79a7879fc212U, 0xea297f931b0b3dfaU, 0xfb71bee8e8b64acU, 
+0x39c626442e738288U, 0xc1182842c5d16634U, 0x1d022f69752ea64dU, 0x12c71b64177ed5aaU, 
+0x615ecff1cf090d9dU, 0xa0da7d5ba8f1ba34U, 0x8e3e5601ee917759U, 0x35b21491c2a70b2U, 
+0x2019e55741c8e90bU, 0x108112f842043770U, 0x1f40651f7f107338U, 0x3808e9dc9d4e2abU, 
+0x896d2dcb0fcfb27aU, 0x6f1dabd763c8b732U, 0x37dbf32063753379U, 0x9505044a74d6e36U, 
+0x50c99b025b73fb5aU, 0x6dfb94eaeaa74fc3U, 0x276e730afacf2e6cU, 0xa458877f121274dU, 
+0xab89e40713fa003aU, 0x888271e061746aceU, 0x940379eca2a42846U, 0x5045c2996715e41U, 
+0x790e2cf50f762a01U, 0xe0a16658c33c171aU, 0x8016b65db633533cU, 0xdce84fb787878d3U, 
+0x425611f1cac45722U, 0xe15281a09ce7d40dU, 0xf42c7f4c689c99f6U, 0x10b739f239409c1U, 
+0x978273fdccdbed33U, 0x5f14966b52d5856fU, 0xee276a99c1f69754U, 0x109fd4e82fe2520bU, 
+0xf9d9e12418a14e8dU, 0x514031fe81314229U, 0x6bfc4383a058473cU, 0x59a96f185ee1e96U, 
+0x35687b5bcf830f8aU, 0x5e16aebd6f7475bU, 0x1a6ed2c1eb464bfbU, 0xf70c5e1786c0d92U, 
+0x887c9bae5a0f02d0U, 0x1d1a73418f8ec1d1U, 0x46c2ae19d376b747U, 0xf71f5f8c9f0311aU, 
+0xde50aaeb83bdc459U, 0x4d865f690b6edbb2U, 0x8bfac91f56eb9afU, 0x14f46bed7c799ebU, 
+0xe5460a7aa46891caU, 0xcc1bb586c9510921U, 0x2ccd4207caa662a9U, 0x16f301f76b16d65U, 
+0x85d800bc97b4ce5dU, 0x1e2b06968448073U, 0xce6f36b35447bbf1U, 0xb1501e725047275U, 
+0x2c2193b6f448d987U, 0x7b9556a4371dee59U, 0xc38f7be1b29f974eU, 0x9af2bc1930af6e5U, 
+0xf1e76cc51f25ba42U, 0xd9ac35170cb626cdU, 0x4abb07c617e06c1U, 0x134ed6f43efbc141U, 
+0x31476c54af913759U, 0x824b96abb1478496U, 0xce01efe90bc094c7U, 0xa5c767ef01af2d8U, 
+0x8eeaec380c4038b8U, 0x150d2621b2713915U, 0xdf87e2e35c713830U, 0xbbfb7a13e0ea6adU, 
+0x9364e508ab6f90afU, 0xa308d410f0f7e81aU, 0x83d17511f0ced0e0U, 0x7fb6901f11caf9U, 
+0xdfb32f70f36ee261U, 0xe3a1ae732615907cU, 0xf42706d8e903a87aU, 0x1305a6a7fa6792deU, 
+0x4a7d7b21d75a19beU, 0xb0de0e28509492e0U, 0x59af5601be21c723U, 0xf8ac77c67e37a81U, 
+0x609006cb279d8b87U, 0xe8a9a01e1ff5b2c2U, 0x2aab408e28be1a5cU, 0x121fcd234cc232deU, 
+0x4f0200c54078a48bU, 0x69619e5c6a112cccU, 0x4ab7b6cce22b8aa0U, 0x932bc2fc4680bdaU, 
+0x8900a8bf722b6afeU, 0x929262e36412dab3U, 0x9bd6b1ec3072d03dU, 0x91a1eb3552974feU, 
+0xe6a2583f652c6b15U, 0x74c41f822d23a75U, 0x8ce20c95b8fa882cU, 0x77025fd57f15c72U, 
+0x3e71d7b35edc8e4eU, 0xb494df720b7df418U, 0xb8c16ee69bfc72adU, 0xbe4b03bc6a7e885U, 
+0xe18d17b4384ec69fU, 0x92a65c7a2e6dfc54U, 0xf5eba7750d87866bU, 0x6e4cb2ec045a361U, 
+0xe5a8f95a9b3195e5U, 0x8056abf1f295d74aU, 0x6e7711bc1c6e1345U, 0x9c02b80e386175cU, 
+0x74eef0e0a4af25e8U, 0x974693bd01faff9fU, 0x97625023b49cbe04U, 0x66883fde3e8b67cU, 
+0xcabc3833e8ad8885U, 0x2d1975c793fe4137U, 0x65770ceced774dedU, 0x8d2e1118f5f5d1eU, 
+0xd4fd36dc7d6b6e3bU, 0x1062408c7a8afe89U, 0xd900afafa21bebfbU, 0x165f4c0f39f17b2U, 
+0xd506653b884375d8U, 0xf4ed90582c45354cU, 0x4d201edb752d33f7U, 0x88fa203dca7396U, 
+0x83d30a480ac3c251U, 0xbb84b888952e3fa5U, 0xf5626ee550cfd9b6U, 0xba711730db90d9aU, 
+0xbc02ebb258e17ab7U, 0x95fa23e250894538U, 0x12015cd6220248fdU, 0x979d1d10ae8caeeU, 
+0xbd1a05d92c83935bU, 0x6bc2a1f08283ef8dU, 0x714473fcb429a481U, 0x7c72b1f449a5184U, 
+0xbeabfbdd4d17ce0eU, 0xf30060f4fb3f800cU, 0x7a51a1451ba5430dU, 0xf42ebc68d59c29U, 
+0x632111a0f9909f9cU, 0x5b401e310f4afc4bU, 0x2cc94615e048103cU, 0x240ee51a4868322U, 
+0x2a807488a42bde03U, 0x6d64a5ebceaf24ccU, 0xb87e7bad89421ad5U, 0xe18df32abe484f1U, 
+0x86ab9b2cab8e6b6aU, 0x27b09426881bd029U, 0xa5f12c9c4a8d4dedU, 0x10e8f71a690ffd12U, 
+0xf915cc34341b88b1U, 0x716ccd0ae8ece6eeU, 0xf25b472d56c2707cU, 0x8ba9c9172f52ea6U, 
+0x768d2b7ce1a7bcebU, 0x8647230b24b5380fU, 0x494c8072aa171e7cU, 0x57e64d8d0dacd47U, 
+0xfe4c4fa75a874249U, 0xef34bee73ab2046U, 0xd18ff1370c2a98acU, 0x741aeed2d271d67U, 
+0x815671def4f50f83U, 0x4db3c3f974ebd83U, 0xd71b90b846014f07U, 0x70ee398ca586e27U, 
+0x8871ee861823d5acU, 0xa6b4dcd75d2d0786U, 0xfadb5e3f6aeda19cU, 0xf35efd4872752e1U, 
+0xbd61d2b50c469290U, 0xd8ef2ab5afae129aU, 0x600d805bfaf1ad83U, 0x122ac5dd685eb6e4U, 
+0xf83ac19f407813ebU, 0x96828a3b45e8fea9U, 0x7be6b0b37b6f4e23U, 0x1378162d0516d1ccU, 
+0x2b14671c77270437U, 0x7b4148ba23b195f8U, 0xd0392e57c71af481U, 0x3a523d89f70b9ecU, 
+0x3a851834ace2d198U, 0xc63e79eb3ee7b872U, 0x5811ea51774a997dU, 0x5e697be9ce83c87U, 
+0xb53c500bf38f144dU, 0xaa4e71e9a92b2d66U, 0x882aeab690e0a568U, 0x470901d1c89cd9dU, 
+0x9b85ee5bb98b3e62U, 0xc726ca5c97518e9dU, 0x2f05ad85b98989c4U, 0x371a43fb86facfdU, 
+0xb502be4c9f6af28bU, 0xcd5f9b004bdfcdcbU, 0x8ffc3297347dd5a1U, 0x8a82a5b7e6e4d33U, 
+0x54bef0e741a5f9daU, 0x293e7d78c94bbac1U, 0xd45104fc2ae11ab6U, 0x1f3942e78c60e7fU, 
+0x45befd0cba5fa52U, 0xec00870f8b1f9816U, 0x1b6f2975ed751e19U, 0x3feef33bbf46f24U, 
+0xd05c16aec88be6b0U, 0x47dd1d8afa118a9aU, 0x29fac0ad02bbccf5U, 0x41653fd973bc8caU, 
+0xd03f0a069fe1322dU, 0x4734ef207abadaf0U, 0x509183c38565fc6U, 0xe13e4b45b17e8a2U, 
+0xb8dfcd966f274977U, 0x1d0b4417b9bcfd54U, 0xfc34948fa201744eU, 0x135158f11e8a80f6U, 
+0xe123d51c634e4d4eU, 0x4ed4ed26f6ef21d8U, 0x609b611f93ff54c2U, 0x21752e98f6a89c8U, 
+0x331a5433461a4946U, 0xac3db372d210a1c1U, 0xc963bdc5735ce8a2U, 0x11d5dc501fb532bU, 
+0x3855dc7d9355f1caU, 0x7100c854482469f6U, 0x710fd250ce9de778U, 0x35c6dace1b2cbf2U, 
+0xc58c4e242968b817U, 0x401bc2a72c342aeeU, 0x4b77d943f56f1598U, 0x10fc06f0d828a308U, 
+0x811e75048e57d237U, 0x328f08344397a4c7U, 0x3b6d26a2585ad849U, 0x65a3d31b3efb440U, 
+0x2483b23174de2654U, 0x4e81f9bb9dc76d47U, 0x3a4dfaf1adc2b7bU, 0xeaa8a406b2cb875U, 
+0xbc1a2682415f11ceU, 0xa90f2d14b91e2193U, 0xf3651c6011dd6f5cU, 0xee8f91065ceb3c2U, 
+0x3bbf06108607c781U, 0x803bb0d07e3616c1U, 0x2a3be58f5bcf3a23U, 0x2ba057c8059d014U, 
+0x9de194e7e10790dbU, 0xaaaa8afc9bdb9142U, 0x3f58d9bd1e090323U, 0x2e91c7ca9618fb8U, 
+0x5586a1b17784c3c3U, 0x753a3964c7f9551bU, 0xe333cf4813812ed0U, 0x11fa4af1112aee1dU, 
+0x488385a60d15d873U, 0x2d824160dbaab9e8U, 0x1cd365edc776b5b9U, 0x455c27202ae98a4U, 
+0xb8e6be7689e5a4d7U, 0x456e20f34c253fa1U, 0xdec55c06c0d0526cU, 0x112033b0eab282ccU, 
+0x5f4e4dee34906b41U, 0x62a3ef14ab312692U, 0x46accbf452337aeeU, 0x485e58ff15ad2b0U, 
+0xe519099c4f1ba42fU, 0x8323939c68218bbdU, 0x7925cd20ccd2d8adU, 0xef14f1b21820e1eU, 
+0xcc4831829e75d6d3U, 0xe2bce1de9e16d6d8U, 0x7258af5d75563157U, 0x882a8e75213288bU, 
+0x6e6e0b6c2eae9aU, 0xa2bd11d32f1c4955U, 0x555ab8b6992efb63U, 0xc90e24feccb89bcU, 
+0x60d455490e0d172aU, 0x266758398c38a2e4U, 0x87c26c26be4d03b3U, 0x4db55481827b6bfU, 
+0xb23751cf510c6099U, 0x923b2c643587795cU, 0x24f133bf409e32faU, 0x12e78c5c08574730U, 
+0xa9b1a4fee181862U, 0x6d98be970deec9e2U, 0xdcb3032efb1d0785U, 0x13709a1a80501497U, 
+0xd7149d29d272b356U, 0x772989e563072f3bU, 0x824268d453727762U, 0x37f892ff1905936U, 
+0x68a7a3b5f1ac7898U, 0xae78b3f3fae338c2U, 0x5ee3d8a8f63af4a1U, 0xdf7fa2c16f0a7ccU, 
+0xd4c16a32b6ab46c1U, 0x71e3e309516f97e2U, 0x76573e7d8798b14aU, 0xf9a56f28fef1a2eU, 
+0x540bef41b44c745aU, 0x5b2fbccebb0453bfU, 0x7ba13ff3b32dfc33U, 0xeab6368840835deU, 
+0x3a0664e7a733aa12U, 0xd75d11432969e23eU, 0x4a3773f1689b8a3dU, 0x4b867d81df2b2c3U, 
+0x35185d2b13acc567U, 0x6fa3b685c3ab770aU, 0x4bd1719d65ce5927U, 0x7f2780889150b06U, 
+0x45727c37aaad02e1U, 0x1cbb967bb9e35c29U, 0x85a3bae779db1b3cU, 0xf15d54e67b2e058U, 
+0xfd460b858e9c74ddU, 0xad0c990084986126U, 0x73253ab85c0199cbU, 0xbd616a5c62e94beU, 
+0x58d7951b49794ee9U, 0xacd4d85de692321bU, 0x375bfa3008bc2fbaU, 0xadc6f171970c343U, 
+0x7fb6de3dd0bfd77U, 0x7aaf6f4bad778370U, 0x4f3b7c997eb12143U, 0x111134c3d4065a3fU, 
+0xdd15f5ff541bfce4U, 0x57bf5cb2188da1abU, 0x50e04b32c1837537U, 0x2d3bbe23b448e2dU, 
+0x6483abe37f44c30eU, 0xad8daf56904a8944U, 0xd38c59eeefead879U, 0x76b95c7af10ad29U, 
+0x99d44e2d706b5d54U, 0x95aa273a84c2eb6aU, 0x1ba79e484809cc50U, 0x5a2b87aa50f02fU, 
+0x135cf0e6c23d40e1U, 0x1c804b75c048102aU, 0x4fafb60ee32d87c3U, 0x11962e753c2ec98cU, 
+0x5d180ebc08760141U, 0xe1d171928358a1f7U, 0xaa371ad7a2d62150U, 0x8422929335b9852U, 
+0x8708bafe195323ebU, 0xdb721dbec7fab555U, 0xcdcfe74e0da3c79cU, 0x13a2d3549813b2f0U, 
+0xc67e0a4a69f1b61eU, 0x4391e4a9b47012d4U, 0x99a20d357bf9e22fU, 0x983f96232ac76f0U, 
+0x941b58bf93948622U, 0xaae105b9309897daU, 0x76d7989fd0c0492fU, 0x139d53fc1c9968e0U, 
+0xccf028a0c428a330U, 0xa33bd0e6fb87bb6eU, 0xdb43e9424c3cca6bU, 0xf4633e36cabfb19U, 
+0xfec278b2f4bdfd2U, 0x919375145ee1fc83U, 0x2fe3239c07ef713bU, 0xd51a84b45f743U, 
+0x68ef2db2d6f4ae5U, 0x39aa666f5c70b79cU, 0xaf5c1427830efb11U, 0xbbc7a89e7168d38U, 
+0x1b937e08b7c713c5U, 0x9f02d0d487fa6f7dU, 0x20282cf3be4a4fb0U, 0x830fe5d8712e7ceU, 
+0x732871456a31c1d1U, 0x70122232967f7544U, 0x2f0412f2bc66cac1U, 0x5dac2aa461d923aU, 
+0x5324cf088b83285U, 0x132652953406557eU, 0x708391a999bab535U, 0x121f4e545a5fdae8U, 
+0xc73d68b16ff0b4c7U, 0x6c09a3f9645fe9c3U, 0x2870b93f7f4c7389U, 0x12c5b50b12783eddU, 
+0xa83bc47f36ab4b79U, 0xdd374694c5fb7e86U, 0x8998fde591a6367fU, 0x93a747fe29ead1cU, 
+0x5a354392d195288U, 0x48dafaffe2cdcd0eU, 0xba06578f534bd733U, 0xcdb8c7bd93cc113U, 
+0x788983fb0d1258dfU, 0xc707074608d96a5fU, 0x8c9d2e73ebd4dcc4U, 0x12579fe23f676506U, 
+0x8a8616c8f0d24fd4U, 0xc5576482b4184f48U, 0x6e69b906540779b3U, 0xd65f8ee589fa59eU, 
+0x81c56f2ca6677ef3U, 0xb79501d54762d015U, 0xda1e2fe225af83a4U, 0x136d8e00bbecf61U, 
+0xed9016da642539e2U, 0x26e90891b24db1aaU, 0x1ce73e8133cdbdeeU, 0x3df79bfe35017a6U, 
+0x8d119a8f6c5fa25dU, 0xf3ce3a5884081eacU, 0xb776ffa416cb7596U, 0xdec746058d9d95aU, 
+0x6e2150d87d067513U, 0x5b11a8517c5ad4b2U, 0x18cd0c91eabb8722U, 0x115db52e172b37cfU, 
+0xb957831660090fb2U, 0x20ceb17bdb5f5bdeU, 0x164f52e5d2668ef1U, 0xa34a81f84c68e3aU, 
+0x3aa39029702b45a6U, 0xc546e780c74607e7U, 0x5cbbead998548cc6U, 0x102877a9ca78372dU, 
+0xb1b7ee18c995f3eU, 0x2c5f5c73ee7ae41bU, 0xa204c6249f88278dU, 0xf7ffc2ac0313a3cU, 
+0x73dab5e0c3aa03fcU, 0xed2ac5316afd9bdaU, 0xaffd1e83ab0e151fU, 0x4e2be63e053c41bU, 
+0x30ced50ddfa0bf77U, 0x7e20af30c8355c35U, 0xf9b703cdeec36d66U, 0x8c1e68d01351db9U, 
+0xd6606381fb1e4d4eU, 0xeaf9ce2f64fa7eabU, 0x5001d16c0b6a8a69U, 0x104867551cfe2154U, 
+0x53b1615dfc74b543U, 0x859f8ec8e272f7e0U, 0x6c1bd3c1170ee712U, 0x113a3190072827cU, 
+0x1668170ac23e9319U, 0xb1adeb8a50205273U, 0xecff527390048ad2U, 0x11af832bd93dcbaaU, 
+0xdd9b0b18aefac8d2U, 0x4fca2d496b553b29U, 0xc7d48a0a2b0b6873U, 0x101fbfb3c4ebdecbU, 
+0xc699365accc1f636U, 0xa6071095fab3dac3U, 0xf415e077a5a40c59U, 0x94fc95e99a7cb2dU, 
+0x673ffaeb8919fd88U, 0x4e52f292426c92feU, 0xa231aaa34854d310U, 0xd8cb9f00e028421U, 
+0xc74a66e9d0210bb4U, 0xe8a0c6aef6514eddU, 0xfd863de969ec059dU, 0x12e5a12a9e666920U, 
+0xab7d38fa0fb414ddU, 0xb5df7e9d03ace9f4U, 0x8b5e56bceb82860aU, 0x38553e8dbc55274U, 
+0x30fb11003051b385U, 0xe9bac143a3a1e33cU, 0xe27ed0e94662431U, 0x11c8a5641ced5269U, 
+0x5d75e4667783ae83U, 0xf9fdf5713576b207U, 0xc8d431a88e73d9c5U, 0x13240a5791dd7b76U, 
+0xafa8f8356d8cd820U, 0x6955f835961027e5U, 0xb0f048bae22d6a37U, 0x21e26faa6ef23ceU, 
+0x381fb8888b8464b7U, 0x8bc337cc15544e17U, 0xaa61833bdf4b73afU, 0xd8c6803f576d49cU, 
+0x10c7b93a0cd23919U, 0x94c5ec752f1019edU, 0xe3adcc4115eced70U, 0x61928acfbb94ef0U, 
+0xfe3f55a6f2bf2dacU, 0x62c5ef64e1f7a20U, 0xe3b22ef585ba4af0U, 0x1385b24119e0532dU, 
+0x975698fb94e9ce5aU, 0x13905f82c1a0d27eU, 0xf189c4414e57aff1U, 0x5f33e029e3ad205U, 
+0x315abaa3e0f9f887U, 0xe5a3b9d4a7344584U, 0x64ddf9f48c23e624U, 0xbe1c36a1f6cdc1eU, 
+0xf243e90234cceb52U, 0x962550da5857da95U, 0x9a95c8cf0f5fcfe4U, 0xddafdde625bce96U, 
+0xaf02dbd370621153U, 0xc8c939496230db4cU, 0xe051375e6e7682d3U, 0x38970e2499983c3U, 
+0x75e6a4df03e6e1aeU, 0x8d87d6bfee116f03U, 0x90a42f2e9017929aU, 0xb46d62cb219f583U, 
+0xa84ec0c9fe82b056U, 0x7da6327aa650430fU, 0x5ea22e2c4533ff84U, 0x5238d165c814a86U, 
+0x853c33ce40e2a551U, 0xc20f2abcf7d9223eU, 0x8b02387ac07fd704U, 0xd41c12339dae060U, 
+0xb43cafc67f894a7fU, 0x630cb8d342a2d141U, 0x3267e416db417ec2U, 0x16b5c0f5a8377cfU, 
+0x3f8cde8b315752a7U, 0xfeeaa424568384b4U, 0xdf52f51dbb72d359U, 0xbbef90ea9ed9362U, 
+0x272340de79cea3c9U, 0xdc39bec60d510a31U, 0x1cb4ff0bd322dccfU, 0x4d36e05af4f30b3U, 
+0xc55c801f2df0f63eU, 0xc4abd895bb8d2ec1U, 0x944de38e9f427834U, 0xdd5c354b547c960U, 
+0x377e52a9953cfd91U, 0x2218fc5b43587e1cU, 0xcc549a07dd4a52b6U, 0x5a74a98e05217b0U, 
+0x4884f9fcf4d9a192U, 0x4490aab341eba1ebU, 0x1bbfd935cb255280U, 0xbf1c7f0650feacU, 
+0xfebf09d6301a158U, 0x980139ebcb1c4c15U, 0xf22c22d0eb195077U, 0xbbbfaf92aa98a9aU, 
+0xd8f6ed323801d5deU, 0xb5a1378b86acc417U, 0xf35c19804c37170aU, 0xfbcc1098fd1d22aU, 
+0xa633a7e8ba43692U, 0x57e1b5c1b5fbf967U, 0xedec06611f16fdcdU, 0x114e2faaa65dcd96U, 
+0x52b399a338c7323U, 0xb389d5399792a4d9U, 0xe343fffc23e3d058U, 0x1398e8d82671d5acU, 
+0xdbb58c8ebbe53d6aU, 0xd184445eabb5a4b9U, 0x4bf1bb3cb69423eU, 0x3a4585ad230a959U, 
+0xb0e41f8e37637b49U, 0x52207dfb8752e5b1U, 0xbd4b8731be2abf89U, 0xcba8a5022ca78f1U, 
+0x3e913202861ce9a4U, 0x2bf8c6b6cd80921bU, 0xa1d378a8a1d6abc3U, 0x3abd0d90608e703U, 
+0x3d76e94697b92498U, 0xd5e3092f67d29284U, 0x5315c580735f09daU, 0x11fa6605824f20beU, 
+0x43c9b02f04f26314U, 0xd38a0647fa14ff9bU, 0x5779a4454ad0f483U, 0x71dd71bfd32dd36U, 
+0x76c96bb8d4277f2dU, 0xf742945ea761e961U, 0xd9dd0e8abe36513aU, 0xd13bad3d069394aU, 
+0xe59529f0bbcf8759U, 0x67ac623f9a91b072U, 0x9dd6ac4fea8ff727U, 0x9688d4712239bc1U, 
+0xf20d468ab1199e99U, 0xeae6fb5d06b0cea5U, 0x9491a1079e90267dU, 0x13e60caa04a8726U, 
+0xf723a12dfb39b327U, 0x7194f78750e32267U, 0x530e64b19cbb2a14U, 0xae69206dea95b0dU, 
+0x3e49696097e61059U, 0xc55fb91192a8bdeaU, 0xe1c95fd44b3269a6U, 0x193b3842395de0eU, 
+0xffc6f8cb28d9afb2U, 0x816fe3028e4256c6U, 0x8d5755d548713536U, 0xed4d70e3c251e1fU, 
+0x8127e1f7cac31c7aU, 0x831ab78cc11032d1U, 0xdb735fc0db427da3U, 0xe47f8e8a053de66U, 
+0x230bfe442a001c80U, 0x3d74e919cc4f5cd5U, 0xf29c64cde33f64e2U, 0x2a273a865facbe6U, 
+0x47c200e3a58ba1b3U, 0xe082de5a2f026a7fU, 0x5cf639c9bff68b5eU, 0x8313ee8b82fa362U, 
+0x4397d417187c3aa7U, 0x9cb11dada9b6b47cU, 0x469f53f7d90890acU, 0x1b7dd98a2d4fa12U, 
+0x8311b6761ec227e9U, 0xba372a7172ccf005U, 0x8584ace5a42a8610U, 0x3f336e4746bb2f1U, 
+0xe1400fbab8f4612eU, 0xf720ca84e01278e9U, 0xbbe3dbd4b0d55e3cU, 0xad8e2b731a3c199U, 
+0xa66c7811de5e6a77U, 0xcf4baae4ff0baf1cU, 0xfa0c90cacbdd3f47U, 0xb3a736f4ee5e4ccU, 
+0x77b3318e7749313U, 0x4a835a4572f98857U, 0x9fc5f4292de911eU, 0xed7e8ae294575aaU, 
+0xedb4c0ac6554a24fU, 0x17d36b5a6c40ab0bU, 0x7aed88a8fe21e11aU, 0xcc58b700c248395U, 
+0x560445f53be70df0U, 0xe3ce71624f54b66fU, 0xc4808a3ede05409fU, 0xab438176259f84dU, 
+0xc08ac8d002807992U, 0x185de70169304321U, 0x14f17bf7db6b6fe2U, 0x2897322ad079285U, 
+0xbb506b7846d3b645U, 0x6544c88f05cb9874U, 0xd885fa314d138fdU, 0x5989b932ba39aadU, 
+0x233e2da3706700cbU, 0xe41df30b5ea12a94U, 0x185f3b069eab9bc9U, 0xe8a3344dcced73bU, 
+0x34603d295de85534U, 0xea9d534d88f58385U, 0x7220132b6ebed96U, 0xf4a5c53a76c325cU, 
+0xa1a8dfe21e41984U, 0x1149cae03861688eU, 0x92eeae8293ea6529U, 0x115b560b2b498cdU, 
+0x66f8874ad907fbacU, 0x712876d489cbe532U, 0xdbdf73e1c8a73f31U, 0xe139a90e4acdd34U, 
+0xb46a3f747343bf53U, 0xa5818362bdbdae0U, 0x7bd71aed75485eb7U, 0xd95f806cf2df48aU, 
+0xf5d51cb8789b3616U, 0xd2fe030bd817d105U, 0x81bf2801b3d9fed5U, 0x11fb2fc9b8c282ecU, 
+0x187c88333c00c3c4U, 0x58b312791933e35fU, 0xe54600b2a8686b21U, 0x95cca95d63c58cbU, 
+0x3f49a20ea469563eU, 0x898f367d7b2ab0d8U, 0x89b682e92f229dccU, 0x721218188723b64U, 
+0x14ecade71aaf48aeU, 0xbc842afc5c6f61b1U, 0xffc7a99adb421badU, 0xb3636da3079697aU, 
+0xd78947276152a7dcU, 0xb5593ec76c75cf54U, 0x42526776bf625d0fU, 0x121b9aefa6cd2b7eU, 
+0x15987656e1af4478U, 0x3a3a7403e34b3065U, 0xfc1cd0ce57d4c9aaU, 0x31c908ce5450697U, 
+0x5cc550f066a98d89U, 0xab1a57092a0254bcU, 0xdf0ce4f67869b5d2U, 0x121b084b88423804U, 
+0x6ee750993e808bf2U, 0x464dfcc995a01584U, 0xa9cb46724e479916U, 0xe6c1a6998c49ab4U, 
+0x33ce7179ea7a4175U, 0x39922ab6693cfd3dU, 0x4863f4c623138878U, 0x1a905fdd2a6d9cfU, 
+0xcf804f4c0477bc11U, 0x8df58eb35478895dU, 0x5416030a8506525bU, 0x50dbeeba8456d3dU, 
+0x75e06698e17872e1U, 0xb53aa90755b966baU, 0x2d4b7c91f65e65b7U, 0x19c7a9fa2552ff6U, 
+0x1005d12f59f44146U, 0x950952750134b835U, 0x54602b1306370232U, 0xf0bfec038a16e00U, 
+0x306fdbe366123U, 0xe76f8449a6c56400U, 0xc61539d0ef8eb8bU, 0x114ae2e0df711c45U, 
+0xfaea2a5791349d5eU, 0x3baa6bc9c27b88f7U, 0xbffa3614b470acd9U, 0xef0ac08abcf0905U, 
+0xd593f38e65b6df9eU, 0x3ddbf1b7816783c9U, 0xa2d243d9427d7617U, 0xe399002a835a96bU, 
+0x540e4c70b1798e94U, 0x2eec862d1b75138bU, 0xabf39e765a7c09ddU, 0x4a071d93fb90545U, 
+0x5066dfa58b348648U, 0xedbb0c1a309210f0U, 0xcd2108f4ae0ed112U, 0xb8251715d8603c0U, 
+0xf4945fd67c7f703cU, 0x9879ece33fa286c5U, 0x6129cc448fbab98U, 0x11b26fc5ebf7ba6U, 
+0xae7bcdb46cf5f8d5U, 0x40422982891421beU, 0x514860294812ba4bU, 0x66d4777e96e5219U, 
+0xa2b1e936edbab888U, 0x4887f771ad618247U, 0x65b5e01dbede0dd1U, 0x104a11da3a27c117U, 
+0xca0c2e214ba32b61U, 0xcba22eaab94fe0beU, 0x4f03933b6ba7c94fU, 0x843aae19415667cU, 
+0xf470f52d4ee08e7eU, 0xa779d39eda043bddU, 0x894d84c2ffd87e0dU, 0xcfa85f4bfbdfbf0U, 
+0x1213ebbe39379050U, 0x1d47ce2bad439ccaU, 0x7a82a55199d8af3cU, 0x15220570de5050eU, 
+0xd8258b493c95eb1bU, 0xb0561cab6c4cbb3cU, 0xedcbf0e4d1789b1eU, 0xb63763115a04343U, 
+0x6f1f73c88c116738U, 0x7a604a9393583f63U, 0x758ff6a7eab9fe70U, 0xf309c1230a026e2U, 
+0xa36f666b05212806U, 0x88c4e04027df3963U, 0x5119c5812e6e07dU, 0x462abfb5d74b019U, 
+0xf7a3dcefaa3e1f1bU, 0xdfeed924f644e32U, 0xf6fb6f1f9281144cU, 0x34931071b1b9e6bU, 
+0x3ee5d6cd9a731246U, 0x73c3be5497f0f431U, 0xa5bc2bf94f838b79U, 0xbab74d16b81444U, 
+0x33439f996d3b002aU, 0xc0ab6e376b96ecc6U, 0x8c38b1bb789ceb12U, 0xf30d36325652b4U, 
+0xbe3c5f8b177c5f2cU, 0xbaaeecbf6a21a35bU, 0x863d20770efbdb00U, 0x2d5da33ad684b25U, 
+0x2d365ba54471633aU, 0x891dc432f9fa9a13U, 0x5a38d2a855e67167U, 0x845ea089fee4a75U, 
+0xcd4b3ea47a8c0bceU, 0xd2eb232c292d6d59U, 0x1cd4ecd2fd6ab444U, 0x135c599efc7ed3ecU, 
+0x5ac60e37101d01b7U, 0xa652926270351118U, 0xa03c4b0d71780d01U, 0x1005c5a76a6ea6a0U, 
+0xff308d0957759891U, 0x80f53f264365ad83U, 0xec2bc6d22d7ad237U, 0x6938225e242789fU, 
+0xa919c7ecf70416daU, 0xd9fa7babd4252864U, 0x8640475f7852bf00U, 0x31f129c573b89e8U, 
+0x5c7a67af4d1ee7a9U, 0x6cab4813e750d7e7U, 0x542d7c5e523b48d2U, 0x4d3a930776fbc74U, 
+0x1e33ec852135ef0cU, 0xe6b169105d619ce3U, 0x8a62d7f60b40e4caU, 0x3c80c490b925275U, 
+0x105f31574a6653afU, 0xddb8230d7aaf296dU, 0x61e83cceb821fe87U, 0x63fe660b93eee5eU, 
+0x269b4446ac4c049aU, 0xea65278220f512e1U, 0x8232aabf8e1b8b5U, 0x356a46b9832b8dU, 
+0xf742dc74fbb01a0cU, 0x50d1bfdbfc37fb54U, 0x98f943a21497407dU, 0xc0250f5a753b309U, 
+0xe7fd0ce5b6e874d8U, 0xb95e874e50f6319eU, 0x42a031dc3a7780d6U, 0xb4c69f924f20575U, 
+0x13d4cbf0a767dfb1U, 0xbf5a34ee43c704d5U, 0x205a2501ba273b13U, 0x9a096fc44440c9eU, 
+0x6a495c6b9c668ff1U, 0xe2d7d3ebcb6a5fa2U, 0xb636b4a4f3517d5dU, 0xf295aa99d08c8b5U, 
+0x3e040aee336f7a36U, 0x6b6b0c2c395a18b9U, 0xa1c12dc98c5e56dfU, 0xea1dfca4922dfdcU, 
+0xc104bc8229dfbf0eU, 0xba8b9f490a1cd8d7U, 0xf3468a5b30d335d8U, 0x12ca78d0ceec3cabU, 
+0xd32f68ca1dc7e230U, 0x45fd4ba47bece63fU, 0x516a57d62ce22a8U, 0x71452e6633a44b5U, 
+0xe6f32e4575496c26U, 0x7adbc30bfb5a3955U, 0xbdf3d71845e94176U, 0x55dc77a26d020e8U, 
+0x87f7d1aaa07c10bbU, 0x188f7474e422866cU, 0x1b299957a187f4aU, 0x33ee4849ecebcccU, 
+0xbcda1626e4d8b98dU, 0x4a3e3306b3f8b91dU, 0x2c162defa1565a77U, 0xf40bce7d6d4b3f0U, 
+0xd92f0ee0edfb0e42U, 0x6c08085d2fcfd737U, 0xb7e0c9de5e46634cU, 0xc24f78295a6cdcaU, 
+0x62f129447ee53adeU, 0xfc64eb744d2625aU, 0x1ced77a7dd441d44U, 0x10deb0a0497bb1beU, 
+0xa3107505b210b338U, 0x2d88ebffcffcbd52U, 0x9c246531bba84860U, 0x63876afeb6d4ed3U, 
+0xa6cc53e5b2f468fdU, 0x752a80c5965b437aU, 0xa91f39693becaa12U, 0xcc3752d30b934f4U, 
+0xf2eafd3628cc22f9U, 0x8d1c450fbdcb49d9U, 0xab296a729644b297U, 0x3950b9035493b5bU, 
+0x916db7aad597e8a9U, 0x11c6e00939aa17bdU, 0x8d023f2f1caaf89eU, 0xa06f7f9f57e7c0bU, 
+0x48be7610b5553000U, 0x60f4e88f8d29e03eU, 0x8c751e7e2474f734U, 0x62f71748851615fU, 
+0x489d2c517bbe386dU, 0x4310f2e7fe7f44e8U, 0x17a8d4c2cf63c513U, 0x169af41204886ccU, 
+0xd4bf22c798e35806U, 0xa172b3a94e7b405U, 0x41b927524ece40beU, 0xfe6c8c05cfc7768U, 
+0x622393de1d95e697U, 0xbd2037fdde2f8b62U, 0xb4ddc668a9716c2aU, 0x219630f103797f3U, 
+0x5c07b29f0527452U, 0xb99fe3af1808f3aeU, 0x6e42c7d334dd25e5U, 0x108f015104bb1b87U, 
+0x99bad92dae7285dbU, 0xa3c3c8499e388a4U, 0x6748bd46da962a5cU, 0x5cc2f93c40d2ce0U, 
+0xd8bb11f84019c7c4U, 0x88da3665dfa898beU, 0x4ee09f2c0bbca136U, 0x87e03edccdde7c3U, 
+0xde9ac61d19b6c437U, 0x991b5eea0c679b67U, 0xf08c3dad2efe1024U, 0x4071fe6a6f0b035U, 
+0xe46b715b775273e0U, 0x9675c82bb0b99f8cU, 0xbf2f1704f048076fU, 0x678f99ca48eeb7bU, 
+0xbb88b0004ff8d8b7U, 0x922d08149541beb4U, 0x94bd6b19b8641bf9U, 0x48925ec436a0c1bU, 
+0xb64d7740d14a836bU, 0x5f103e042fd3302bU, 0xa0825b70aabf6e51U, 0x6a3e84ea90ac9daU, 
+0xea518407bbd3d328U, 0x9d3c040b62e3ec0aU, 0xb96d63db7d7f4685U, 0x1045b3c09dbd8116U, 
+0x8e375cf8e63d6f3aU, 0x82af1be087ccc8f9U, 0x50de791d96ddafU, 0x83b05f0cb2377a5U, 
+0xecba139ca7103123U, 0x3688f76ea5808539U, 0x6cc67f1a299ab058U, 0x2271a7c8921c3a7U, 
+0xa3aa171bd6b04b63U, 0x47805713f1213adfU, 0x44d97ebb57aa62c8U, 0x923c3c6cfc70dcdU, 
+0x4aea43062a1adbaaU, 0x1e995c8bf40d662dU, 0x3f5172277e49dd97U, 0x10b50dc5a836aa1dU, 
+0x4fff6973a2ebbae0U, 0x47549b5d6745114cU, 0x89d4c1be9f59fffU, 0xef39a93a1e0757cU, 
+0x61491c17f662be3eU, 0x295057964ffb39cdU, 0xa87caeb1980ffb53U, 0xf0a76d1d4e2a52aU, 
+0x3d8752389ee849acU, 0xb87ae16a00ecad51U, 0x32ec2c2166de07bfU, 0x657e872bb8e0c53U, 
+0x12ed8346c0fe6b0eU, 0xc5b57b89af4816c6U, 0xd164b7a3334b8476U, 0xcdc4c2b0725331fU, 
+0xcbc35f6642476acU, 0x6c25dc688bf12a44U, 0xc3cce39b9c41091cU, 0x123834afe2c0c11bU, 
+0x8a7fc48c99edad1cU, 0xe11838b49278beb9U, 0x3770983987b94401U, 0x8f3648686bb4d1U, 
+0x75e299dd389f76eeU, 0xc7553b3a5e0a01a5U, 0xc4c5916a09fa1bf7U, 0xac751b16c18fa7eU, 
+0x1e2ab4ab8da49e54U, 0xd7daa3f095f4fa72U, 0xe0ff7fae93b427eU, 0xb15ae43549a2cbeU, 
+0x170fef5e2e4e2d85U, 0x89292312f5ada22fU, 0x688403d27f7477e6U, 0x212f28495db9577U, 
+0x2f5abbcb503f9ae0U, 0x9302e2ed11ae8130U, 0xd217747794e12dd7U, 0xc1d799b603bb790U, 
+0x8fe8e673e65497f9U, 0xcf06b58bdb32667aU, 0x85ebd5faa59e10e4U, 0x70724ffbdc56270U, 
+0x2571435dfa905ee8U, 0x65be639c7901230cU, 0x3371b27fcf6d04ecU, 0xe49a98513154c69U, 
+0xa0dd6f72b5c2b861U, 0xed2ac0e1769ab667U, 0xd3c5901ec6bb6e1U, 0x999968227259d52U, 
+0x83d007fdfa6883f8U, 0xae94fba1f1bc630fU, 0x715506ac0adfb2beU, 0x10e59b46143b9b86U, 
+0x86089000a09699b8U, 0x3e98aee3d2c46eceU, 0xf19461eb38a0e45bU, 0x103ce13d3189dae7U, 
+0x9bbde3fa11e25ce6U, 0x61577acfc66d292U, 0x7b181b09d526aaf8U, 0x497190c3d639a27U, 
+0xc7a566ec346e3935U, 0xa5dc97d659288ecfU, 0xa558864e8670b120U, 0x7c147655e957451U, 
+0xa6df03e2f4f50204U, 0x77257bb063f64e72U, 0x6fa57990c09d9778U, 0x5d48e780b7cafdaU, 
+0x3a04c67b9485913eU, 0x7f74f4d6c24e0922U, 0xa37f62bb60081275U, 0xaebcf1ed1f9eb22U, 
+0x4d85708f99e6a83eU, 0x60df629197707b15U, 0xc201eee220bed0adU, 0x2ac95e37c578fe6U, 
+0x37ab8b23bfbfdfebU, 0x1344cbcd7e210153U, 0xa496f0b4c0367ac1U, 0xef36fc7e242deeaU, 
+0x1cb7b7b8f2c96c32U, 0xb41cb83526fdb1daU, 0xb64aad5ceec9949cU, 0xb058143166f612cU, 
+0x43dc34b3648072bcU, 0xcba87b9b45797078U, 0xd643b730a6e553b7U, 0x969c0fa03cfc468U, 
+0x8576ad4a0c994192U, 0x1ab23e9f90f5b7c5U, 0x9f935cbdf73e227fU, 0x4dec3ae50e457feU, 
+0x38d2caddbf80533aU, 0xd407fe31eecec99dU, 0x2e1252fda9a12a40U, 0x5b7cbf19eca8cccU, 
+0xff9867e19b7f339dU, 0xa6d95bd1bbe09ed9U, 0x852e98db9d84f420U, 0x58c8d35f6bfcc07U, 
+0x4ebad254f4196578U, 0xb8ac7946e82876c3U, 0x9d2bac9cdb0435f4U, 0xa6d312b2fd8317aU, 
+0x1c9975c61147ea28U, 0x4c19b9bba97b3f05U, 0x62c548d36bc5f21dU, 0x101a2b2a1053c2ecU, 
+0xaae8652c1344ead5U, 0x8871262e5953059eU, 0x70d5ade121130f04U, 0x4a7ffcb7f549a5aU, 
+0x38919e83e0b423aeU, 0xe75b92d69887722fU, 0x96deb10104e909b6U, 0x10642bf286bf95bbU, 
+0x344e22d134dbb3dU, 0x9b27c0da27054dcdU, 0x9da18f0590b0b233U, 0x4cd9b3dda0595bbU, 
+0x6c1f63c22bd03067U, 0xd883de801fe717e6U, 0xef8c0719e49f0321U, 0x28529552d6e29b1U, 
+0x303373e3b0268c7eU, 0xff7c627882485342U, 0x1b34d74ccc00b96fU, 0x13302653d82ca8feU, 
+0xca72e6b11a32236aU, 0xdc95eefe2b885dbcU, 0x4681dc9bad47def1U, 0xdbdcc03c1e24891U, 
+0xf4456b2ba246a544U, 0x118436f9aec6e489U, 0xdd3ba85f2b59c7aaU, 0x46d8536fb5d0f95U, 
+0xbdfdae8dd159fd0dU, 0x71f000acf61557bU, 0x8f4ba58b3832662U, 0x6d87f376f60e76U, 
+0x7eec726392ff38edU, 0x70b160306a93e105U, 0x18c7d222b38bbb15U, 0x7997d31c8430b4cU, 
+0x4604cb7f0bfbbdd5U, 0x23e505c300742a90U, 0xd9c49003c7fb2529U, 0x862238ad82ac464U, 
+0x70952ce092f4a494U, 0x3f51200de7d3b98dU, 0xb3278fbae2725cf6U, 0x121184fb1f64c20aU, 
+0x9fb78230cac29df3U, 0x24acfc265d80227bU, 0xb088ff083f292a01U, 0x97259da2bd4f9a1U, 
+0x530a9ca931951cf4U, 0xd16a0b06d1c50483U, 0x645fcba124b52dc9U, 0x28c6103ac432bb2U, 
+0xdc47bcc71341ef1bU, 0x23e1ad7ade62d26cU, 0xf2f65540909585a9U, 0xd056a76908b7ff9U, 
+0x9c6bd0f47b454595U, 0xbd07fd6519fe900U, 0x6c690ac131f7fbf8U, 0x7356fdf49eba0beU, 
+0x60116647dbedd733U, 0x9981f70e464f4c18U, 0x68b3b09335d784a9U, 0xe3c7f9a56382ec6U, 
+0x17af1008d9a7b540U, 0x3c5da81bc39e90d0U, 0x5ed2cb6651d095e4U, 0x4e64efd9dc32dU, 
+0xa98043d467201faaU, 0x57152b20f30cdaa5U, 0xff630cdc866de48cU, 0xfd8e8ab5217930fU, 
+0xdc0e290cc5507e73U, 0x698043433445de5bU, 0x8619068e5998ec30U, 0xfe8abe7f0dc25abU, 
+0x58642637fbaf796U, 0xde70a18d367f1c1bU, 0xf63bddca249bedf5U, 0x35daac846429dfU, 
+0x23a2aa6a6d049b07U, 0x5c80fe05d957e0efU, 0x86cdc6d211231dbU, 0x41f95b7557c7374U, 
+0x48ed569194f2d4a1U, 0x2f2a6f531b115a89U, 0x87b26751009ccd67U, 0xce47e9e77ba2bd6U, 
+0xf34757db1c14e2e3U, 0x3e51b1744ba318c4U, 0x6d66c61c3037c92bU, 0x40c43a4e444023dU, 
+0x2e822d6279968b10U, 0xa2aa92f8e5ede033U, 0xf010c14118c5b09dU, 0x1327796a3ff77863U, 
+0x65e87762a1aaf634U, 0x41bb332d56733256U, 0x7c79b5df5f609234U, 0x11dc4878d91e38e7U, 
+0x3520fbf3e5d003c2U, 0x2e40cd9b2f835654U, 0x61560103bdb0472eU, 0x11f3306dd52413d4U, 
+0xcbfecd062d6e14b0U, 0x54e914a58f8ae324U, 0x95b310ed04e8ada1U, 0xb9335da26eb5b9eU, 
+0x94cd7bf1d7a699c7U, 0x9e129e2703f6d97cU, 0x68e8ab129aca8ed2U, 0x10593b657cfff1bdU, 
+0xc55ff78dc731b554U, 0xb607275eb9f7f749U, 0xcddacf13788e393dU, 0x569f79d9ab0e85eU, 
+0xb24df5556c390f1bU, 0x452d9fac8209a56cU, 0x200590cc8fd256a9U, 0x95b4e29ff8930e6U, 
+0x57c446f9e708633U, 0x1b294b1f5b8be5b2U, 0x88e3eeb68aca0d43U, 0x6e9683148133960U, 
+0xad86a029538e4962U, 0x7b879528c6cea6beU, 0x5ccae4c1ec1bfbf2U, 0x1624866708fc332U, 
+0x62f67c948832ffe9U, 0xc016c6f6793a6bb1U, 0xe112c27953dfe86cU, 0x10c924c2b9dd2ed7U, 
+0x1086f59c44c54ef8U, 0xf464b4a81c804048U, 0xc9268f1afedb9a05U, 0x3c76c694e62c645U, 
+0x7109508f1a71f7b7U, 0xafaeb46de70f8b99U, 0x23fb9b222f1dd3b8U, 0x139d9f3e85a1877cU, 
+0xff56d14b91f88f1cU, 0xcf849e1692c9dc05U, 0xedc07d5e958e5a70U, 0x2e5f37debb69d32U, 
+0x120d8b15f0ba7ef4U, 0xfe725ce5fd76217cU, 0xb97a78c3960cca96U, 0x40d565dd6f283a6U, 
+0x740f869fe3055805U, 0xd66e951fe3240a1bU, 0xed1e7433d8be5961U, 0x7390f77001f34ceU, 
+0x29c9ce1b017097f7U, 0x48e5ee789ecd99d1U, 0x4574ee06fffb3e3dU, 0x2aeee804fd8caaaU, 
+0xf5b4e048a19498c1U, 0x8cbfd8c1d9881493U, 0x13641984c8ccafacU, 0x29d52ad94ffd60U, 
+0x585143e002be22bbU, 0xc2f873a0950d51f2U, 0x83dc1e3be71a3dedU, 0xac4e32678a872f7U, 
+0xf1e8ef64897ef77U, 0xfa3fc18427f44c81U, 0x2984169a45bc58eaU, 0xc8328589afe8af7U, 
+0x701e9a3ec0736bdcU, 0x70f81c2e401a6f76U, 0x226260f8e9ea8e94U, 0x24537cb3a47f760U, 
+0xd221b94982e31a97U, 0x13ec4c9b46f64f9cU, 0x13030923ccc0e69bU, 0xb8e804e9d172475U, 
+0x9ee6eb45b1ef60c1U, 0x419509c597bead1cU, 0x1179d3dbfb140de1U, 0x82e6ff11ea209f2U, 
+0xf150d75261dcb689U, 0x33b3b40e01a11c45U, 0x5e059eca6daac90aU, 0x62c2966a77873f6U, 
+0x926cdeedf35563fU, 0x320d306d3b961864U, 0xf4be743aab17005U, 0x48ab9d764c4dad2U, 
+0x8b0a7a00c1804519U, 0xdd8718faf129d29U, 0x137eac59c9eb72c2U, 0x119abcfd0c4d8af9U, 
+0x2768debae6c3ea98U, 0x307f250bc84aa87fU, 0x3606cc9035e68b26U, 0x11163f609446d4b0U, 
+0x9af7d749d27a90fbU, 0xf66614c108c302caU, 0x4a74d1401efed2ffU, 0xe6717280cea4dccU, 
+0x739c180f58ea9dccU, 0x49953b113596586dU, 0x2f61c19c7f74043aU, 0x12e9d6db4215f0c7U, 
+0xb62ba081f2518ba0U, 0xdce7e97cdbc6af86U, 0x9ee99f92495ed85bU, 0x1184b4086de235c9U, 
+0x224e879f4ff2cb78U, 0x17adcaf289263f4fU, 0x5f572e365518980eU, 0x4a1ac57db339946U, 
+0x1e48ee65f594df2aU, 0xf40d2153e8ba4698U, 0x795df6254e2f933dU, 0x282ad475d1b1365U, 
+0xaaa37e54facf89b2U, 0x62122404e7639aebU, 0xb8831edc5acddd1cU, 0x1e4f04b2e7a35f7U, 
+0x60783ce31023dbf8U, 0x136404579df816b9U, 0x6fb977dea8a85c05U, 0x7b5d316e9a6b4fdU, 
+0x55a5614dc0e00b9aU, 0xdba895106577e918U, 0x6b43d861ac26ba9U, 0x10bd645f15b33c14U, 
+0x3a6f238394c1b44aU, 0xebf2d407177c6ea4U, 0x65e9a2844235375aU, 0xb68843d219571b0U, 
+0x7b2c7877b6738383U, 0xe909abf6b8becba8U, 0xb1ff4a95263d61a4U, 0xd9aaf7a28833ee1U, 
+0x84fd25fba243f0eU, 0x12166bdaecf35178U, 0x66142bb995fd8e5bU, 0x12aaff544ea81031U, 
+0xe58c634088dffef4U, 0xee7a9c7028b6e606U, 0xc91882ccc3c0ce53U, 0xb6fed605456e152U, 
+0xa0ea2201f3f94410U, 0x5095ee05f3c5ab1cU, 0xcb3d3150c944984bU, 0x776ff17f0d79b5aU, 
+0x7f6a051007501457U, 0xebc6d7ea53bee8deU, 0x1c6da33f90281d95U, 0x127258a9c1314eU, 
+0xf36653d13edeb018U, 0xd6ffb50d933ba10cU, 0x82d48979e6faff53U, 0x6d0f9415573927bU, 
+0xc4be44da0aa3ab7U, 0x33ec200921a3f618U, 0x67fc455e0b5391b6U, 0xad10dd60c53361eU, 
+0xd88b7e8888295787U, 0x6aebe36b48fe4c04U, 0xf1d6d7443eef2992U, 0x16827f463f91401U, 
+0x5cfde91044d53213U, 0xe3f47d7765a16f8fU, 0x3271fc76c5fa9224U, 0x7f25cef5041e386U, 
+0xc86cd2be3f66d411U, 0xb966e04d88870fb5U, 0xbc56887a58765ac3U, 0x37d98c6c1d0c444U, 
+0x1a60f8c72673a9f0U, 0x2d4e249c8af8f62eU, 0x8a3e2f9bcb6ae19fU, 0x64d0478bdb93434U, 
+0xc8b074b55db8ee6U, 0x7a4e574afb30f897U, 0xedf0a9808045501bU, 0x123aaa983834345dU, 
+0xdfbea376cf89fc56U, 0x1dfc30c4c6963dfcU, 0x3bb9af22070f6008U, 0xd58a4e66906a5ccU, 
+0x7682e1e4d48e5898U, 0x321aa91860390263U, 0x5439ae7349935a50U, 0x1185cf99af05072U, 
+0xeadb6e294d251527U, 0xb838627ae24a0be9U, 0x983dad5e4c810185U, 0x109b9e3ba24820e9U, 
+0x35b1ad4c9f0f6eceU, 0x336e4b91ba2cd255U, 0x7e700d89685e5f2U, 0xcdc21a2bd977b7fU, 
+0x22b48553ffd7e173U, 0x31c8b082db0e77faU, 0xc1c20a03508bd9beU, 0xd03ad03578eaf9cU, 
+0xe2f91f029d82bee4U, 0x8bba0cd4acd5c6bfU, 0xf7aa5fe2dd7cbb6aU, 0x118a5ad24fa9c3daU, 
+0xfba71897b2ebc392U, 0x416843ab408753bfU, 0x1cd27398c0301967U, 0x12f8e30fdd14d749U, 
+0xd8f26b1042e245a2U, 0xdfc87a42befec2e1U, 0xbf476aa83503447aU, 0xe2948a0f71597cU, 
+0x960124e40cb7a960U, 0x8439c253285606bdU, 0x7aef6ea7652ba545U, 0x12469ced9d65816cU, 
+0x20dae43e92f5408cU, 0x2c49139b1311bbf4U, 0xc738b9ec788e4bd2U, 0x2719fc4c9c486a1U, 
+0x53a00c14008f87a2U, 0xf9f2e164e646108U, 0x4a4f1271ec4a1f81U, 0x66c200ee1581ee2U, 
+0x7118d3d367792e9fU, 0x42b3732b0b823286U, 0x91d77fc695c0e4f9U, 0xac8e12c0a0edb0eU, 
+0xe5c6b56cd88a980cU, 0x8163ba5741d7f11U, 0xcbb58716c2230733U, 0x6e3aefec87d157aU, 
+0x4bb28e92cb5513e4U, 0x96e4dfc554cb70ebU, 0xd4b20d6a3d4f55feU, 0x9fe7c0926a3f5d1U, 
+0x631385623b8ae4a8U, 0x33ad3f3a8aa80108U, 0xce6ece1390b58dccU, 0xdfa257c90677d67U, 
+0x6958eab13acc73f5U, 0x350225316587c85aU, 0x7898128ba8c4a37fU, 0x9b2bb1fae16bd78U, 
+0xf5902485badcd5d5U, 0x9fe56e21ee7ffd10U, 0x57ca0564dc0c1b16U, 0x12ae92db4e0cf23cU, 
+0x6ead61ba2c9fe46aU, 0x7aa785be19eb61ebU, 0x1b98b211cf64cadcU, 0xb454835fe03d55bU, 
+0x4ed530ecb54270d1U, 0xac7c7cab448164f5U, 0xf2012ce3854c48e2U, 0x215f04cf4370014U, 
+0x83fe575b8caa2c57U, 0xc197e91f802f96a3U, 0x4fb2d69c60cf87e7U, 0x123d20b02f87e35fU, 
+0xedf6dca562e26528U, 0x9ab6363b83d1d978U, 0x18e644fd94bfe38fU, 0x5861cfa9eacada7U, 
+0x3a48c7748ccbcd4fU, 0xf0b172208cb613aeU, 0x933f4f84cee3d3dfU, 0xbfe42c5a4202093U, 
+0x199a0ea95bd2d74dU, 0x299698548d60e331U, 0x3cbc3f112507c527U, 0x881c914fd104f54U, 
+0x12a5e1bceadc526bU, 0xfcb5f701e0ef4144U, 0x11283a44c14f54c9U, 0x10cda049761679e4U, 
+0xd5a4dbe451d620e5U, 0x6986ec86c8e3f925U, 0x4557b2519b1fa1efU, 0xad4f1348930418eU, 
+0x2a9c26c8d47c41c6U, 0x18442ee02fc6f748U, 0x82e692758d02e54dU, 0x8f94271a20a3c4fU, 
+0x909cb5cd74c10feeU, 0xa68dc496120c4b17U, 0xb4b691c59954c887U, 0x7312c47f260778eU, 
+0xa6ccd4962c8edad4U, 0xd5f4a2389976298U, 0xc10f945f33f81140U, 0x8855588d9bcf1f3U, 
+0xa94d3a2a6acad933U, 0xe0f057a22d4f2959U, 0x62cc1c8ea2ba0f6cU, 0x944e86a0a38d737U, 
+0x138b02a8a42c73bbU, 0x6e519f17597463e9U, 0xc4f54c7b850d8510U, 0x12a3356202f6a8deU, 
+0x15aa8191a5698281U, 0x3aaa3fe3013ecfdeU, 0x8a396822282faf85U, 0xa845464053b5a03U, 
+0xc3efcc8df90e06c8U, 0x41271e1be04413a4U, 0xe4c8a53a6fd29423U, 0x3edc29ae4c99b1U, 
+0x3510a4b7989e2e83U, 0xa81c2b1c393dc884U, 0xab630c3ead720b45U, 0x12b54b6e546103b9U, 
+0xe8ed408e39579c82U, 0x12a3f362f2cc0798U, 0xf27a9d1dcc68b615U, 0xcb06c9e24093cd9U, 
+0x415dd55189c93adaU, 0x1cb0ddba85e108d8U, 0xa1b70a8d25e9ab16U, 0x3db4ecb139b5ca2U, 
+0xdd2571877a5e49bbU, 0xe0a50f4366c6f291U, 0x4cdcc935b87a0a5fU, 0x1395621140be3e49U, 
+0xb01b7329ad7ad2e0U, 0x69fb5859b89fa167U, 0x7e22f83dfcc86490U, 0x83b9f8d35961443U, 
+0x264a213ea0242bd0U, 0xc742cd7444497007U, 0x9da6eee364622ec0U, 0xd53df2238c395f2U, 
+0xd0dc9efbed8876dfU, 0x2441a269f837a4afU, 0x7852df3c2697019eU, 0x9b4022220c8586eU, 
+0x17d1cabb24719842U, 0x1745da89f577e32U, 0x46cb1c801f16a31U, 0xbfbe2b88813fc82U, 
+0x608040c41df518d3U, 0x8c0cf9c43fbae4b0U, 0xfc8fbe2500742286U, 0x6c4d755b98b9cfeU, 
+0x47e1adcc517eb99U, 0xc3a31727a5deabf7U, 0x17cc38cafb957e36U, 0x7de346eef5b2f3eU, 
+0x2277ba1e47030432U, 0x376134ff1750002dU, 0x4af01bfe008008dfU, 0x560c15c2486e3f2U, 
+0xe6a14cefc616b9bU, 0x7e1c000b5152cf8cU, 0xa421381eaa5f3dffU, 0xd2eb711ba9382f2U, 
+0x59b502c0fbb782a3U, 0xe9bcb4aba2bdcbf9U, 0x9cc3ecd9b3a6d382U, 0x10b6d875d3d545aU, 
+0xf0c189d3d8617360U, 0xc91ff90cd5d7c99cU, 0x9900331d75d17366U, 0x7b41370c0b7c6f6U, 
+0x7a6be6ab9b94b996U, 0xae90b2fd195d2e53U, 0x4daad280bc3c19fU, 0xfe6ffc3775d28b6U, 
+0xd6cf592b3c28784cU, 0xa66a77b469cecba3U, 0x3fa120d63e9b0c83U, 0xb4a93d8072b298eU, 
+0xa0fdbeac0433357cU, 0x4893efc664dc4108U, 0x7f7e46d6a2578ca9U, 0x10f75476cbd7f34bU, 
+0x6e450631650aea7U, 0x911e072ae42ea8efU, 0xcb5e9b6fef9e1875U, 0x55f7f063870feb7U, 
+0x92d55e8efd845685U, 0xcccc6cdb9ad5f144U, 0xebfcf4049b71697dU, 0xafdae4989f83a5aU, 
+0x4f8b75ce9bf031dfU, 0xc626104a7c50685dU, 0xc7af3da451fbde26U, 0xe5f28094df921afU, 
+0x1d349d7fecf0874cU, 0xe796a2ec46f7c0d0U, 0xedeb54bbb89404e7U, 0x384a99959692bbeU, 
+0xc36446c5e484fbbaU, 0xbcd6bc69e800cea3U, 0x9b465684025aa7a4U, 0xae72dba85ec0477U, 
+0x6658a282033e3b38U, 0x5226bc7f3840f507U, 0x6bd5b06b30b7e950U, 0xddce1e602934696U, 
+0x7ae13b57c7be5096U, 0xbf55ae8b0fa0e54fU, 0x75a427800078fab3U, 0xad5955685af292U, 
+0xb87a7bf91688b196U, 0x98751d64f208ce40U, 0x5a26cf0682f32b7dU, 0x57ff9fba296d268U, 
+0x88ddba06c715bf33U, 0x6b9f943344fb592bU, 0xf1a89b1ef730dac9U, 0x120f3ae516c324ffU, 
+0x60103d42ecf7e015U, 0x7e62d20521dcb4feU, 0x18d81d96d89717b9U, 0x10c72e76e55b1f2cU, 
+0xba9f65d01130f48fU, 0xaf8f90dba31437dfU, 0xa75ef83aada3cf1fU, 0x8f31b6748210acaU, 
+0x8956d85a60131bfU, 0x7ad06ceb803d6c01U, 0xe65387f018b0ea61U, 0x67ee300ca6e77b0U, 
+0x7ef6891bd61b3d60U, 0x310933d187676e83U, 0x25cbebe733438b26U, 0x12a024f150a9957fU, 
+0x1abf5ea872285e86U, 0x3f77dd542fd41362U, 0x83b04212f95c9dcaU, 0xc9dc594da1c3bd6U, 
+0x5037cd33d5b00f9fU, 0xac18836c38e4f34U, 0x5e4b0d0997ee70feU, 0x129e8552d33a5e24U, 
+0x3f85ecf7b74454b6U, 0xa482cb8c1cc032f9U, 0xffa82537ae6b2ffU, 0x21ab089debd22cbU, 
+0x753870eadcbf7cbaU, 0x7e67095823a33396U, 0x93258387978bc2a7U, 0xa9f3d0d60129612U, 
+0x55e2f3762525da30U, 0x438007cea49dd2e9U, 0x70157ba3eb2bee37U, 0xb1d2ee8c85f10c3U, 
+0xe78cbfbf8169703U, 0xba4698881bd0020aU, 0x3a3ad57866820213U, 0x9ff07314808bb3bU, 
+0x315120a281c1b758U, 0xb832c719d266df05U, 0x63143a39b89076bcU, 0x571afa7ce239062U, 
+0x9e3b65363c38509cU, 0xc0cb9ab050e67cbbU, 0xaacd5a73b698265bU, 0x116170b6248cc0e6U, 
+0xa7f5a00c429b6ee0U, 0x5e2287f14f8dcc8fU, 0x8885f439cd128466U, 0xa2719696d3b160fU, 
+0x6d8e1dd46e25cd5bU, 0xce2056a1197b1c1eU, 0x2506124b12833163U, 0x8513c6ae98a1555U, 
+0x475645c4d145dedfU, 0xee057942dbeb872bU, 0x7aac9dec0d3c6b9dU, 0x808710ec245ca89U, 
+0x3b09b667e2a7845cU, 0x79351521d07defe3U, 0x29e14e5132ced674U, 0x11ba55ab68fc4bbfU, 
+0xffb83ee5b9e7b0ecU, 0x13f6949278da0806U, 0xe7131e880105f374U, 0xc470d73ce48fe24U, 
+0x1e7b4d5a4841c46eU, 0xf6401bb536e504feU, 0x71c973821e9f2b41U, 0xe64829e2c0e7479U, 
+0x61bd165abc48d656U, 0xd0cc415865c37238U, 0x5dd221c6ad45dfe8U, 0x89f66461dd76951U, 
+0xb1ff8d6dea6aa10bU, 0xbbc7e3cbd7f3986cU, 0xbb9f185c2f381e81U, 0xbfda9ca0438fd38U, 
+0x1d4bd81a4e7593dU, 0x7feaf63a928dd085U, 0x475c47e022739f80U, 0xac9b3f2da768ab8U, 
+0x5652c5a8ffbf646cU, 0x9f22619f9097c2efU, 0x32bf093e344d4ca5U, 0x4d44b40b7a3a624U, 
+0xaa2f97fb8c50f1f8U, 0xbaaba34f4b3040faU, 0xb1112b1128d05b88U, 0xed1817d86e9a40fU, 
+0x3b644663799cdc5U, 0x32a8b796b20fe9b6U, 0x55efdb3ca545857dU, 0x8c135e967ef71dU, 
+0xba31368f5ecc2cb1U, 0xd949b8ef581497e8U, 0xe8039f8f6d719472U, 0x4066ac214b566b9U, 
+0xf8ec2b10ef71606dU, 0x1b2405893a94a192U, 0x4a506683996437ebU, 0xfa7acab5a0712d6U, 
+0x91d29d367bf9b443U, 0x2cb77b856fbf9350U, 0xfd396c59d1f37f44U, 0x754b17db39f3936U, 
+0x671a4d84f6cb0702U, 0xe63bdebdf62bdac2U, 0xd04d9ead782f7e75U, 0x10df753f5ed2c54aU, 
+0x2906ce0e6d82d1d5U, 0x6a4b44dbc848cbcbU, 0x20eadbec0cad1c6U, 0x7c6ee401c8f4a18U, 
+0xe4fcac5652c40e18U, 0xa1c39d181628e817U, 0x71374c3e9f96d443U, 0x61b2726280b864dU, 
+0xd6dfd16414e0237U, 0x3aaf1861da3f6737U, 0xa61ff191ae69c84bU, 0xacbc66491cb9665U, 
+0x695302c371947e86U, 0x2c61eea6d87464a7U, 0x1fd6dd4321fc168eU, 0xb4d0470b240a5bdU, 
+0x3baedaddd4e4f0b8U, 0x92d72a0c46652127U, 0xe143ecc0eabca1e7U, 0x20d9f1d453e90f3U, 
+0xd85bd2d7636ae45bU, 0xa85af5d64093f198U, 0xfb0d4c3c691c1ee5U, 0x129b00bd4f70ae8U, 
+0x69d38411619982dbU, 0x46f87aa25e134ec6U, 0x82e9be584482dc8eU, 0xde9924bf1f8b5edU, 
+0x2216e3d5464efc5fU, 0x9aef2acf4642eb61U, 0x89ca59f573595e54U, 0xf8e9f053ec1199fU, 
+0xb780e9ca914045dbU, 0x46e67707e818aa96U, 0x269693b28a8f8dfeU, 0x4efb8c6c5854e35U, 
+0xd531c27d1a567bc9U, 0xf06ec1bd92f5bc9dU, 0x9b8ad6e8802ce81U, 0x25b35cd860688bbU, 
+0xc74032dc275d7bf3U, 0xe970f2fc88508715U, 0xefbc86ddbcfedb33U, 0xfc14fcde900836dU, 
+0xf1bf3854161b4fa1U, 0x13971077f340be2U, 0x430301e01a5f5591U, 0x2b30e7aef2b4397U, 
+0x7afee37d31f0fc2bU, 0xbcbcab603350b3eU, 0x670e197ad4dceeabU, 0x138b3a358e197bf2U, 
+0x5e9386ade1f1376aU, 0x7ed5c6ee2d547077U, 0xdea18ca8dd2c8dc1U, 0x130cc22c65832a88U, 
+0x1df55221d761239U, 0x766604cdf4fed5cU, 0x372f707f243275a0U, 0xccdc8fcc0ffa519U, 
+0x9ab7e0545b0c9b94U, 0x5bd4530485cb3aecU, 0xb81189ccbdd199b1U, 0x452b584a1633f58U, 
+0x79d63ce967f1f308U, 0xc43f5d606c0277f1U, 0x20fed698c1a1f924U, 0x12b30bf3de5d08e2U, 
+0x7bf857235d616c3U, 0x98e8c0435489db85U, 0xc532712b67427fc3U, 0xb9232c4e554671eU, 
+0x874d4dcaec8e592fU, 0xf793b4f0c0a23ee2U, 0xe469639cda19b790U, 0x46666069fca0afaU, 
+0x9350699582af69ebU, 0xe7e67c13d20affbU, 0x21c08af31a2a229fU, 0xe56fe60070a75afU, 
+0xa0951dce5128f73aU, 0xcf9b06762b8d5025U, 0xcc053c721543679aU, 0x51033b828a27bc7U, 
+0xa7bc5f1a2f509b21U, 0x339d860efc541cfeU, 0xccff945e3881db39U, 0xb89fa29b950cbdcU, 
+0xc8e4ddc14371a2d5U, 0x6d8e1a865bf16fa2U, 0x5443a388f31045c1U, 0xd33f3468060720cU, 
+0xc242dc25b9807d6dU, 0x3268680e6a7e97c0U, 0xcbcca6deb6e2f1d9U, 0x60711b4f67e061fU, 
+0x1d870061b94a4602U, 0x928da2a8bb975fa3U, 0xa0114b3bd43cf38aU, 0x12936f4ed13f2958U, 
+0x65985425bc539a0fU, 0x150046fdae914fa2U, 0x1e08515bfdb8ead5U, 0xf3dd2ca0dde4ce6U, 
+0x3acb4c3cc0fa082aU, 0xfb8ca5ce7ea078ebU, 0xb407625bd080093bU, 0x5b20986d44fe10cU, 
+0x412ff166af045b70U, 0x5749dcab7f315d34U, 0xe789b2a43ae0a825U, 0x946d9811fe3fc1U, 
+0x8b478247f774d0ecU, 0x259bf8eca34a0ae5U, 0x5109ade1cdd8d190U, 0xeb4e9da39b65c05U, 
+0xb315cc5a89e58915U, 0x4c755be19171bfb5U, 0x3892f8c634ed3ba0U, 0x27e35b64b0dc54aU, 
+0x2022a3eb66806977U, 0x482fe057d2ddb7b1U, 0x6bc13637a8dd368aU, 0x83a130474fe803eU, 
+0xaa0c68fc070e5af7U, 0xcf615605d991d898U, 0xb62d29027ef93e0aU, 0xbbb941ab5e6462U, 
+0xa097cc0271ff5204U, 0x10c76bf475d41c55U, 0xabc0f21af02b0357U, 0x12f43219aa424641U, 
+0xb651437ccbf785edU, 0xa42c3b27a2361b75U, 0xcf06aaf1187cbf6aU, 0xb2e50da8e77f765U, 
+0xf51b07fe5184349eU, 0xb86df108c961dc71U, 0x5eaa8d35f398b988U, 0x79ee9827ab1633eU, 
+0x2d4ea7529f1bd6ffU, 0x6f43553385feaad5U, 0xae1be56517a082d8U, 0xae300db2b75be77U, 
+0x808ced0323c2d547U, 0x5e4e0b8f57efbc66U, 0xb9c353881c8afdd6U, 0x3de3454d7f27e34U, 
+0xffbf4177edf39b8cU, 0x4c010d81c3a4ed4bU, 0x8a14912367fc4ed4U, 0x68b7a637910b353U, 
+0x19b600374e1ccd77U, 0x74706e7c3bda19e1U, 0x2971a5ca960370a4U, 0xdfc369ea62d0ca5U, 
+0xf00026c9f1472a62U, 0x65662d95eea89d5aU, 0x715d640f16adca21U, 0x10a5ada1c3fdf264U, 
+0xc7976564b3c6534aU, 0x2cd85c9f2483d706U, 0x9861df52652a6c56U, 0x129e8a71de0fa5efU, 
+0xa402a00409e753f2U, 0xf07949fd48abec95U, 0xc077f8220c7fc92U, 0x67c67a254f19e15U, 
+0x7a7d7ef509282360U, 0xda60a737402c6ad8U, 0x1b5f4125f2787a78U, 0xf11473429ff897U, 
+0xeb9224c3f7988e9aU, 0x74a929c0934bdcabU, 0x64012c7abe59bdbdU, 0xdbdd2762dab2255U, 
+0x84c4b287b8cfbae0U, 0x27606fef071cfe17U, 0x64333a7d82c1aff4U, 0xcf61c055397c088U, 
+0xbfc308811d463283U, 0x9dd5b54811513750U, 0x1c3bd87d8d03de13U, 0xbcddd2961009666U, 
+0x26e473eb4a1ddc64U, 0x1789f832cfa2ee0fU, 0x21543a561c70a7d7U, 0x3b9511ed5892f66U, 
+0xc31a98dcca953cbcU, 0xaac036943e6cf730U, 0xe48a008d0862ad35U, 0x139c2784834e796U, 
+0x5611fa6b14d98e9U, 0x7701bb962d5fe883U, 0x6cc22d2b01360736U, 0x7b8078c410e2f62U, 
+0xb6a6c43be2d7ed7fU, 0xc56a73bdf187ec2cU, 0x9ea5a71a3cb882aU, 0x42f5fedafbef1c0U, 
+0x4438abb3383884acU, 0xb53ac73e8d84cd39U, 0xb175f388613511f6U, 0xd9c781cb3bb43a7U, 
+0x3c6dbebab73ff2bU, 0x8a61371453ddab8eU, 0xadd80adf2cd1583aU, 0xbcb4803a4c1bf93U, 
+0xcaf54925522b2b0eU, 0x98670ccc1f8edcbaU, 0x459516b815abc32cU, 0xa6f37ae6210f6f3U, 
+0x3560d0a07cb2c949U, 0x1aabd8fd7b37665cU, 0x18348369c5524291U, 0x294f441c44ad71eU, 
+0x34a85ee64968e05U, 0x804e718e1ff9ae44U, 0xa6344d02ffbb6baU, 0x55e4210a6fc616cU, 
+0x5da8713cf83c03fU, 0x7f0879bd6f64527eU, 0xe0b363b8ac78e76bU, 0x39551eb3bd87860U, 
+0x3248b60d5f4ded60U, 0xcd73088ce92a16fU, 0xeec32eb0bb8cb861U, 0x610260bc07952ddU, 
+0x487ad1b2b6d41deeU, 0xc80f7ba5590429e7U, 0x7bc6b9c02551bfa6U, 0x83bb0fa0a08755eU, 
+0xca8edbfa43819c51U, 0x37aa107bd5227ba7U, 0xcedb33a8cdf91675U, 0xea6219f42fb2228U, 
+0x261ad0f7fbb7cddU, 0x5c3510c96ea53e0cU, 0x291ac676be20da2bU, 0xea4891ac5175457U, 
+0x561032516d25f20bU, 0x3df73cdac6cea34dU, 0x6819f55ebcf19a53U, 0x8b2584dc91e0371U, 
+0x1dfd4c954bb2e274U, 0x412eb723607bdc8bU, 0x381ee17995f13614U, 0x94dc01cff1930cdU, 
+0xcf4f38d1c995da67U, 0x365c37973a6abfebU, 0x90d6ab866e45eae4U, 0xc030450a7fc3b3aU, 
+0x41f156bd7aeeecc4U, 0x2ab15f4d78674085U, 0x437025b54ed6192fU, 0xbf074a7e84fca84U, 
+0xba613a7860d1c65fU, 0xcfd50dd61206a843U, 0x987f412a77d48579U, 0x54c38324312e439U, 
+0x5fb63f9fff6815dU, 0x861db6bc35d3e262U, 0x4a1d7ffd6b867ad3U, 0xf186632bd7c113dU, 
+0x6fb1379803d0207eU, 0x6e150afba39f0251U, 0x537a0057872c720cU, 0xb86d69f6eaebe57U, 
+0x718e121be9ba669bU, 0x95429940fbb4005U, 0x9a47b54cea259e91U, 0x268e5b18a48b847U, 
+0xd49d420a5f85314cU, 0x70d8439c2c3a1d97U, 0x5cf34dd7424836acU, 0x107259be08f08e4bU, 
+0x877819bdb7cf2d6dU, 0xa78658c8acc9a2ecU, 0x29c47b56f51879bdU, 0x1078ae69d8dfea8U, 
+0x2b24e2e3bb79ae7dU, 0xd1164a2fbee346f2U, 0x28b27195a3b705ffU, 0x11a2c89462d3b165U, 
+0xe218c81bfe9ab1e5U, 0xe81b10d0652fca19U, 0x74e498d3fc679cc4U, 0x3dd5d90ffbf57d8U, 
+0xc0247270447871fbU, 0x12090595a6141839U, 0xd0cefd42b6cf3dfeU, 0x113d7032c3366aa8U, 
+0x7f3a6a704ee322abU, 0x13e1626026ebd66fU, 0xcd44ad75d26c8d3bU, 0x1107569153c6af53U, 
+0xd93de8613f485aa0U, 0xeccc854f654ebb23U, 0x3a116ab2adbd40ebU, 0x3f371fe9c96f73eU, 
+0xaf84402557bdf3dU, 0xbf7cbe9c998a59a5U, 0xb0179e511b9a6fc3U, 0x8922a92cc268a8aU, 
+0xd367f78e4066ee4dU, 0x7a96045a7d246c04U, 0x27eff7af412bdb97U, 0xb652ef9ffd7432U, 
+0x317f663ebeded30fU, 0xb2203e57fa31121bU, 0x32d8b207eb8560f4U, 0xf5de4164dfd71d8U, 
+0xd9d2dca07b6c9c3aU, 0x390251cf0a862fe7U, 0x19be4e505afe782bU, 0xc717cbf2e28fceeU, 
+0x20b4d3563d50e110U, 0x9879ddb208ed49b2U, 0x6d29ea138163d04fU, 0x423be948c10689aU, 
+0x177acc5e3f13a351U, 0xe529d00735e6e8ccU, 0x17624d271eefe1d3U, 0x396b33a59b0223fU, 
+0xdc449ab4980a8b99U, 0xd9c42cc484ee93d3U, 0xc6548f0b89af6b4bU, 0x122ed101235d9b0eU, 
+0xe7bc2496906b1acbU, 0xb8bb090f62d12675U, 0xd6462762db52025cU, 0x3f2efed07603b4dU, 
+0xd07d00e849f74c8aU, 0x5ca971a323ad59eeU, 0x3988943ba46285b4U, 0xe4497dadac85f65U, 
+0x2718c46204188d6aU, 0x4a90a40ae41282b5U, 0x83f9874e6e55d40cU, 0x7180dbc92b206aeU, 
+0xedf3a9fba21d200bU, 0xb9bba0c95c85d4d0U, 0x1bb38d5758fb13d1U, 0x12f7021211573b21U, 
+0xaaa1a75e8f6f8e28U, 0x9697ef0f1d2cd72bU, 0x154fa0ed62a0c750U, 0x1fe1c6e896f1fcfU, 
+0x820b2dc69ce2f580U, 0xc7e0f3036c97f7acU, 0xab3900ff000b4d90U, 0xc21680bfb2d5e4U, 
+0x250a1ea2f247be20U, 0x421d8054d240c0d1U, 0xda593777efc5a452U, 0x48a05b30eb50590U, 
+0xd9cfafdc8c11b270U, 0x570e6f0dc0df673dU, 0xaaa0e06adde28db7U, 0x4d3f4d12493c2abU, 
+0x168e14e0f125df42U, 0xb64a1a71c0dff32cU, 0x305f4b81dad8607U, 0x247df8fa5a1b4eU, 
+0x657180afdda16cebU, 0xc08b13f0871695b1U, 0xccdf757c16255afaU, 0x10067009cb9b9011U, 
+0x42842a27dd27a635U, 0x79b797fb116c6332U, 0xefd9cc63fffc2288U, 0x104f2ca56b6931fU, 
+0x124d33f7da16fe18U, 0x50dfe83e9d606f92U, 0x54929201f1c4b8edU, 0x1200db03aced03f1U, 
+0x9aa91ad4ef28370U, 0xdf61e5c0ee0dac05U, 0xacea5ac1f764936aU, 0x129902c5fd53e877U, 
+0x64f962c32123ad75U, 0x9d0b62bcd1db2ddU, 0x95a2349332f694d9U, 0x40d599ba4cca849U, 
+0xe6273753df36a956U, 0x65d6c6939b3204c4U, 0xec7e971f39b4299cU, 0xd09c1bcf4d2a810U, 
+0xfd25bba1d20a50b4U, 0xa5d60b20c123f5f4U, 0x511551e1504fca6aU, 0xad2664a46be7628U, 
+0x281e8d2c9af2f821U, 0x9227d5fbf7f9a65cU, 0xbc054c44f417f595U, 0x3f9ed65a62290c6U, 
+0x115762f6af217b49U, 0x6562d05ddf97f52dU, 0x6c317bc8d8228f68U, 0x1cf88c12bd7c0U, 
+0x1038220b6a647e33U, 0xf1f0a006ee48c7f1U, 0x2b8436c8d1f46275U, 0x42529656d095ac4U, 
+0xe1cdaacdc8f702e4U, 0x628333d5ed0074c1U, 0x79844409c1569c23U, 0x4705f5a740a60bbU, 
+0xfb95274c7d9d7cbaU, 0xe5f920f31c00f9d0U, 0x338306f65e6aaa04U, 0xfb1ff3bcefc4c7aU, 
+0xd40e3121d7a63d6dU, 0xd57050b8cb9e7f99U, 0x5cfb4ab9bc00e586U, 0x58d63dab5b4dd4dU, 
+0x185c9e360d0a4843U, 0x2b862f754955a899U, 0xee4823cdb93cae65U, 0x1314fa6c394337fdU, 
+0x4281846ab8902692U, 0xe3a005bd99c6edbfU, 0xf1bfa6cfc6a9ddc3U, 0xefe8fada95984ecU, 
+0x75dd75def3bcc35cU, 0x440153368bfcdc24U, 0x7e55fabc944684cdU, 0x11e06435351abcf5U, 
+0xb550e4ebfd5af95aU, 0x3e3a19fafa6c1763U, 0x1f35b4d996a959f7U, 0x257f35f5fbf95e2U, 
+0x9a7bbc945f6b48c9U, 0x50d26166e93aeba7U, 0xa34bb4895ff59f4bU, 0x985cba089afefe4U, 
+0x8f11e7856a4ec78bU, 0x40adb0c03aec8221U, 0xffac437cdb89f1U, 0x59d901b12f54aa0U, 
+0x17bc8b6b108f871cU, 0xf1486667f513876U, 0xbdaafd8435aad7d4U, 0x3e729517926f0dcU, 
+0x5a653f566225c7faU, 0xa78a3a6032b89d72U, 0x5c08c509d81e5491U, 0x12892a869c2724d6U, 
+0xe39904ddc83c971fU, 0xeec15ea784130cc2U, 0x71ba1c87e744c2aaU, 0xdd2ba8b97ac6a99U, 
+0x78d47de1e4d735a9U, 0x29f1d3e46659f036U, 0x4a875b46cf3b1314U, 0x1292cdd293937995U, 
+0x6d20064062379979U, 0x2f8499a87728610dU, 0x51217990c12fabb9U, 0x28d9cd12de5fd86U, 
+0xb5cf8f418b0a2d10U, 0xb1914452785a0c06U, 0x34f2e787ae5f8a22U, 0x62657cd24ab0edU, 
+0x4d5973df49c3a441U, 0x544ccdb24d0768a0U, 0x15d7b3b7e8c7bdfdU, 0x20a941121f2796cU, 
+0x8e259c1171e5521aU, 0xa32e10135d0798e1U, 0xbe581225813c7091U, 0x60f50d3f18a9d8eU, 
+0xfb7bd3eab8f396ccU, 0x9bd19a2aa65e45acU, 0x9f4bc939fc13c205U, 0xab3b0614fe5f4dbU, 
+0xc92487d64795eee0U, 0x4cf45c8f7889eca8U, 0x205dbf1477e99f80U, 0x5b888798c3ed94cU, 
+0x86f537722e6e2252U, 0x19863757907c5686U, 0x310c3b0a2483ad0aU, 0x1289b2692a0d3d97U, 
+0xbbcf5e51d75f6d0aU, 0x94dbe94cb1c85866U, 0x24b4ee71514a4e7fU, 0xdfe6e2d8f9a4c25U, 
+0xe9d5c34219886be7U, 0x56836d3aeed50d57U, 0x1b6f75778bfbeebeU, 0x12bc2d8b44da77f6U, 
+0x15a6c1ec2e83f3dcU, 0x3d9e345c9385c626U, 0x95d7d7bbeaa74f17U, 0x273174f3022cffbU, 
+0x58e271944092dc8bU, 0x7835f57936218444U, 0x51eedd95307dc3dfU, 0x954798d3fdb3866U, 
+0xb3254af8ac3d262eU, 0x4628609669f5274bU, 0x9acfac4f0a66864dU, 0xb5d2a31a73b971fU, 
+0x86b05b9f2e0649ceU, 0x72ea3f54d432790fU, 0x7dbd9e6d01576f1eU, 0x10225b2eb676d174U, 
+0xcbcae23346f3ec58U, 0x2622f8929a810528U, 0x5e0b02bc18736e03U, 0x5f6e8e7fa52aa04U, 
+0xf0226472c94cacafU, 0xef421d65f008acbbU, 0xed6db24cc28a65f0U, 0xa3adcdc6d76698aU, 
+0xa86f065d22465ebfU, 0x553faaeb5386ed6U, 0x12e6b0b3dfe0015fU, 0x1c149529d3732e8U, 
+0xc79f2cb31751873U, 0xc0687af4133c404U, 0x2d0f9af3a4a7600bU, 0x128f3969c98c69a2U, 
+0x7431c53232723bb4U, 0xe2e47366908dd02fU, 0x3f4994fb2afbd8d6U, 0x22ff8150a1e20eeU, 
+0x514f5c36b547463aU, 0x5d309813f1e43b9dU, 0x6bc0097b51df22baU, 0x64441e4570d15ccU, 
+0xc1fff8822883c3c2U, 0xb8e598d3e0c1baedU, 0xa6a56b649e98ce5eU, 0x120992d60220b7U, 
+0xc8c76d8498be2a26U, 0x8e0784f579dd31cfU, 0x94e7812a380b4c30U, 0x9fe6229daf48f77U, 
+0x6e0f03f3fb0ef943U, 0x945996e525eaf30dU, 0x4fe2ab445e574d2cU, 0x41c605f3eb455feU, 
+0xeaddbdc7c99535e1U, 0x205edba26551c91U, 0x80dc72ddc9b4cd7cU, 0xc80b52c2ae63110U, 
+0xa878dc6de2175d1bU, 0xa45b04d5ed0666e5U, 0xf7e92c27f3dcf02cU, 0x1c3ddc7790f1092U, 
+0x1682458033ddb059U, 0x8362860cfbff6e38U, 0xa1ea43ba9b78c963U, 0x137bd7d74f2c8b2U, 
+0x6346601d7930766U, 0xd542ef8e3db16103U, 0xed76050603ad6cf0U, 0x2713006cb980ec0U, 
+0xb9a8905ed79709cbU, 0xa0c1072d7dc93a1U, 0x18784195d5792379U, 0x76b9ee4e14a2690U, 
+0x9c6af2d4c58ca066U, 0x4866d687abab5499U, 0xdbd3d0a9a983d5fdU, 0x4658d86168c6283U, 
+0x7e28ebf258863887U, 0xf9cfda53d05e6a0eU, 0x617122df70c58a9eU, 0xa554fb9824e19f4U, 
+0xf817ce773fdb85c4U, 0xb82a4c9c41163a3aU, 0xb8a0986d06fe9979U, 0xec30e667f71a02aU, 
+0x1534169b9e7652edU, 0x5560f12e182d146eU, 0xfaeecb192d89a9a3U, 0x5138170e9653774U, 
+0x811d003de8fc76b3U, 0x3790d9aff1cc67aaU, 0x211882837e4c36a7U, 0xe4ff3a1afe5a9f0U, 
+0x3fcfe54148d66c93U, 0xb47ec20d76248cc5U, 0x7b281e7d2bcbdab9U, 0x65b0160cd390f36U, 
+0x7ab422cbca657c59U, 0x9de0c0db3f42bd22U, 0xfe0d7ba098442d2U, 0x2196f82c76aafU, 
+0xdd06f4b76f775542U, 0x4be4bad9cd551f46U, 0x37d8356018c49cdcU, 0x7cf982fc89141fdU, 
+0x34dc3f8917992179U, 0x1fd65e0d67c3ae27U, 0x9686dd20ff5bc0a1U, 0xb0f6190186a61a2U, 
+0x80c4e261f3932162U, 0x81ff9533c3d4a56aU, 0x19e8b4e4104272cdU, 0x8635208095e1bb3U, 
+0x2b9f3c0039f7f069U, 0x76a10410e1356075U, 0xe6cd1225801248f3U, 0x47e3ab800ccc49fU, 
+0xaa321544b4aba684U, 0x75706df4c5714f04U, 0x1d4d7c199d56a3caU, 0xde2a631d9d2a9dU, 
+0x73595d8bc4893541U, 0x39ceca0369988c0U, 0x5ada22f515c0fc46U, 0x2b2ee9b53bb34d3U, 
+0x87443663e2fd9352U, 0xcaae251e15ed549dU, 0x6d4bcc5e72435d2U, 0x3bac147a0238d6dU, 
+0x7dd47f8187a5097U, 0x19a2b5463607df8eU, 0xc2113b46cb22d799U, 0x447f3706d6bc31dU, 
+0x217dbe9b166d2a05U, 0x9708a5c2228159b0U, 0xb9cf7a10b8fc3f56U, 0xcafe23b9ae10f0dU, 
+0xc0fc14883f3363f3U, 0x6cdbd6d8ecf02361U, 0xbe58e0eebbd24a05U, 0x11ee69d38b43f5c6U, 
+0x61d6e4a0bf96dff2U, 0xf34b1446b39de6bU, 0xb2b588ebd2dc6d6U, 0xbf894fa98b0bea8U, 
+0xf759d20ca255ea66U, 0xfce44d11907bf157U, 0x750a8ca52382a53cU, 0x121049d374945dafU, 
+0x2a44d751d3778591U, 0xa269ed5f7a2a7566U, 0x629efa1de47526e8U, 0x65506269353d710U, 
+0xa0d5b54ad275c3ffU, 0xbd8410d4287420cfU, 0xbbe9865327f8098dU, 0x1c4644e33f67261U, 
+0xe0328b6fb35da23fU, 0x57674b5ee5815c0bU, 0xc394dab8e3057c77U, 0x74fc614fb1fcadeU, 
+0x98b7bdfa5f378c7fU, 0x2d4bb05996e97f8bU, 0x9beb1d0fd5a860U, 0x11e31e660b7235b3U, 
+0xbd37ecd48422df2cU, 0xa4eb3be77d194f6dU, 0xd60dda21c26bf217U, 0xc7dc1c9e7748d13U, 
+0x29bc06a53ceb9111U, 0x4533b18759816e4fU, 0x446e591a5c16aca0U, 0x5e9b7fc510ec64cU, 
+0x48134b8fd1e0a5eU, 0xb5ff73340d70470bU, 0xbd2ef36b8eae1480U, 0x7bdffcc5691faf8U, 
+0x1934ed84c9328d15U, 0x41a206afefb425b8U, 0xba2943e119acabdaU, 0x9d0b14574342fc0U, 
+0x5fe32a23424d7167U, 0x7ca64371072cf494U, 0xd0777e5fd53a35ffU, 0xe79dc9e01e6da7cU, 
+0x13515e82715124fbU, 0xcdc407b53b1573f9U, 0x2e294bcce8044665U, 0x739c4ab4cdbe413U, 
+0xdb03a522db258545U, 0xbfce72e9c05f8868U, 0x74aa1c15e2834113U, 0x662c812fe68b9b1U, 
+0xfd03b5471bc41785U, 0x2362d11b10f389f7U, 0x33c4b4f6a45669dcU, 0x137b348fa58b8d07U, 
+0x7389236c36b10afU, 0x2e9ad804a9adf318U, 0x1d962a180c73857fU, 0xe53a0078c6c354dU, 
+0x6e976aedab9eadcdU, 0xc32dd9c363b21e31U, 0xffa50c64868071acU, 0x138b7964684dd2b3U, 
+0x69a865a27491f114U, 0xb25b76abf18b1456U, 0xe4db4bdbaccdbb46U, 0xc952ac9c2b5a4fdU, 
+0xc377317087683ff4U, 0x3b1496137b37b602U, 0xac006863ab65909bU, 0x1355645bacb44899U, 
+0x64b4037438352d2eU, 0x11c4f8c122888cU, 0x6d4850c7414c8bfbU, 0x352e493b26c5397U, 
+0x1f735066b36856eaU, 0x3c2cfea899ea0b07U, 0xe81483f23fa88fc2U, 0x1accc1af0ada5aeU, 
+0xa6be169f22c3e826U, 0x4f4702f511ca188U, 0x6c2e0c39212dd194U, 0xe07f419bf504ec2U, 
+0xa6c6628fbec15d2aU, 0x49d67f5cecc087f3U, 0x9e27edf555279f1aU, 0x65922c24aa01c02U, 
+0x822e271bac47be10U, 0x49e392574db00100U, 0x252923560ac86f3aU, 0x1b145ece85b0686U, 
+0x4eca1c86ac8654c8U, 0x48ac8c120fd8913bU, 0x59e57035ecb27934U, 0x2b38cedb20cd51bU, 
+0xbe441e7ef4432268U, 0x3109c8741501d479U, 0x7742b6aa8b368d0aU, 0x9375d3ccd0db63fU, 
+0x76841d3b0d28278fU, 0xd5385eddd657b1b2U, 0x7e577c373a9e975dU, 0x1266094eee058e77U, 
+0xb3f257d40bd735efU, 0xacdd8a9bec4048b4U, 0xcc8e6424577c475cU, 0xb68a299776686b9U, 
+0x21fd7df9ceae5033U, 0x3c8ab95c6ef10db5U, 0xe1b5fafa9362e11bU, 0x90dcf651970f7cdU, 
+0x376325ad9feea8fcU, 0xd429ccc0fc75966eU, 0x8d40d8f3209273ceU, 0xe8ab545eba0228dU, 
+0x20884197944de38bU, 0xd66be8c341b6a8e1U, 0xccdc4be5334f8234U, 0x410aeeb697c57a7U, 
+0x64847dbbfa8597f6U, 0x76670a11c2d5dad2U, 0xf9b21be85c908305U, 0x7d0c7b8ebd5d5d0U, 
+0xa19c3b9141d2caeaU, 0x3c061c6c8796e88aU, 0x15b78ee98a9bfad5U, 0x7881c2d91754169U, 
+0x8ec367a8af4c7150U, 0x8ed8286efd78d923U, 0x4fb6b2cf209cbde1U, 0x7d36f84021fd9a0U, 
+0x13e9946b1a202eafU, 0x75f8da454d56f8ddU, 0xa913e3e814183b13U, 0xaf14f81a0a56df5U, 
+0x7425d12f8a21a0c0U, 0xfa23a001ed10f7cbU, 0x4408b1c5e6e35bd4U, 0xb347e8b528686ddU, 
+0x5fa9fbd51dce7d39U, 0x4704c924facead83U, 0x5507011cae41a1b7U, 0xf3fc2fcaab26ffbU, 
+0xbcf55c2d2b38a2fdU, 0xc7f1829eb7770b5aU, 0x88ad3ad88183ebb8U, 0xc485cd22964f1eeU, 
+0x5858fe88d53f7da2U, 0xc75048a55da821dfU, 0xc9b7d4c48b0163dfU, 0x3a016741ef19dc3U, 
+0x977d2ea1f48405eeU, 0x7ebf39bf33027d25U, 0x3509e2aef58907c5U, 0x7d9a8542e81cbe7U, 
+0xfbdd1546fde39c7cU, 0x6bd3ae3afc360f63U, 0x2c64ecdda912e693U, 0xe6ace19c667f840U, 
+0xfaa49aa6a182b77cU, 0xfb5c19f9cb112cf9U, 0x26128089c1ef4823U, 0x6a70c90f5002a11U, 
+0xf95580b8d1fec78aU, 0x83e4cf56846351d0U, 0x3e4034a8c775f25fU, 0xd1834c4bf1c3667U, 
+0x7780e45a2461e0eaU, 0x6a5c933dd45ca45eU, 0xedbd8d4afc4167aaU, 0x6a8c4827fda58a3U, 
+0xb38847fae97eb617U, 0xc451bfa75202afdaU, 0xaefb94e93a28b9afU, 0xee4e6e28e817085U, 
+0x7953fb52b7d0fc57U, 0xc435e4ef0438e674U, 0x62258a7ad0cd7066U, 0x3db98f37574b601U, 
+0x79770cf0ad51e56bU, 0x8ac44e97a8f82a66U, 0xc6633512369602e9U, 0x121d46748223f5caU, 
+0x2d9e98d46ac3c9a9U, 0xf844771a8652759aU, 0x322c9f289c9d72a6U, 0x928ab83da6e570U, 
+0x52d7a68812a9a153U, 0x1d48aeb674358833U, 0x752fd3dd7f890859U, 0x7dfdf7096b2515eU, 
+0x4101b5b6010f29c4U, 0xeb148e3966436113U, 0xe93312cd4f7985c2U, 0x1181e265f36c81f8U, 
+0xb121b341e318768dU, 0x2348790f39d4efbU, 0x1eef02b691e66e56U, 0x129911f19bc52c76U, 
+0x4e8d0e5d28c6b992U, 0x751ec4330051ce1U, 0x6308b28090295e3bU, 0xb6261c9077e2f54U, 
+0xd5b154f97dcee384U, 0x26ea86a416b4fb7fU, 0x823aa833380a092eU, 0x107d5bca521eebb0U, 
+0xb2066937a8263544U, 0x423d6f9de0880187U, 0xa31db97c512fdccdU, 0xdbc12afcf01a095U, 
+0x905cb7f6126716aaU, 0x826816463951e97U, 0x73445ebb270bc462U, 0x94f8a5aa01a14aeU, 
+0x20544e56e5abee12U, 0x605fca4eabe845b8U, 0x4264f6671bb7f4c5U, 0xe80443514fc3bf8U, 
+0x45b33aeff2ea2106U, 0xc48011db5b4a29deU, 0x6485fb7a8c73bdc7U, 0x2510b871c5f0dd6U, 
+0xd1da620956ffe185U, 0xfdaa7a7e86b8d56fU, 0x284150635dceff1cU, 0xfc956f4a6223617U, 
+0x65342ec8011d379dU, 0x8128ee9936cee7f8U, 0x1eb13d959f7c9707U, 0x67436425c1938baU, 
+0x3acc7d4ec8eb830eU, 0xfe6418bcdd7e9eb3U, 0xd55bb96c27d0137dU, 0xb03b30019e5451cU, 
+0x474b4d1f02ce0292U, 0x7219b026384f2b7fU, 0x2950852139a291deU, 0x11588580ddc26c64U, 
+0xee8c7dd2169e7d34U, 0xa4ba219dfa449bffU, 0x30d6b5179985ade8U, 0x7d9a2de72afd24fU, 
+0x33cc74e6e8316f51U, 0xa09394d9a26da019U, 0x648c3a706d1f5744U, 0x102f54ec21444ce9U, 
+0xc3e75e670002457cU, 0xaab47f1a16b65787U, 0x2d96ae77bd5cddf8U, 0x7a0d3900e83cec8U, 
+0xf184d4d960a4ea0cU, 0xf97e9e73724bc4c1U, 0xf0e1db45cdafcba0U, 0xf9687ef6f7a5c31U, 
+0x694ccc1da71bec15U, 0xac972110d8558792U, 0x2c856cd05c81a367U, 0x4709382c3781436U, 
+0x4b20ec5212a4c32dU, 0xaf29a11e06f3ceefU, 0x1b423211157a817dU, 0x5051f77dc8724dfU, 
+0xd627d0d29cb416d2U, 0x2ea09e600b187f1eU, 0xcafefaeafec748cdU, 0x55c27861a91f856U, 
+0x1db366d8b75df315U, 0xefe77281cea55ae7U, 0x611f1a307082c8c7U, 0x11a5832cbbffc3eaU, 
+0xa0e71e558a47f2eeU, 0xd0901dcd359bb5e2U, 0x8c35ce9490166ca5U, 0xa11f794acace7cU, 
+0xaba67bb00059572bU, 0x2c352a5a75abfa36U, 0x85a08b76b5fcce99U, 0x8142b324966137U, 
+0x1f585ceb76ec8e02U, 0x3638557448b8b584U, 0x94fa2e2011a4a90U, 0x5a16cccdb7c5e0aU, 
+0x11d631a4fe84a2U, 0xe24288d5cfd8c4f6U, 0x5a17495e9cbfb2e3U, 0x37dd6bac0cff9ccU, 
+0xf325e035abf3390dU, 0x98e29af8030e5cbfU, 0x51ca3de0175f8c3eU, 0x4d113bce488c5c8U, 
+0xc9925e248f94cf91U, 0xc81c86f45357b85bU, 0x9f13b40a7ec7c412U, 0xe1ce3e009cc9b32U, 
+0xb8c9fc9d3eaea41aU, 0xb5ac0a6c035a3168U, 0x12eb9c09efac6c07U, 0x7330d9ed33c2627U, 
+0xa98058dfd847ecd8U, 0xb2032afd4581b7b6U, 0x508521211da321e8U, 0x1f10ed4123cf1ddU, 
+0x277595fc62292cd0U, 0xafaf2568922334e2U, 0xc09d7e3db2cf7a53U, 0x80e33aa1791e305U, 
+0x91bf663f6b37efc5U, 0xc2310053471dba79U, 0xaecdf46dcc117692U, 0x8bc552cdebb8f51U, 
+0x4feb274ae38514efU, 0xaad99d589cd5d239U, 0x5ac388979da1aa23U, 0x8c30ce7bf8e6d58U, 
+0x38a80e2c936b2618U, 0x51bb1dd076772645U, 0x4c9694d0ca29fdd6U, 0x1054d283956e58abU, 
+0xa789f56cd9395040U, 0x890f8e42e0670963U, 0xa514acc5ad3f87fdU, 0x3a7bddefc8aa01cU, 
+0xdd034cc7b20feefaU, 0xdc17098d45fcec7fU, 0x53de6220d8afceccU, 0xf6bed105193f8a3U, 
+0xf5d9fb86e0b74cb8U, 0x5a5676f7a5096956U, 0x5b257973d8b1ac63U, 0xfae00cc45e8838eU, 
+0x85ecc6abd295f079U, 0xb77fe324f21290e5U, 0x52bcb77a541f3b8fU, 0x1a5d957fe655ebdU, 
+0xf784e810221a4afaU, 0x31aa7e83bf8680e5U, 0xb91481f12006c90dU, 0x17bc5b04f203e20U, 
+0xbca4c79f537b00c7U, 0x8341bb7a4f42c822U, 0x472d3661dc6559b0U, 0xcc8295581248c05U, 
+0x3bb4e166a983b386U, 0x18e51d04f201651fU, 0x534cb111975951caU, 0x5d94145a2f9c66U, 
+0x7390046bddf28546U, 0x90a5ad4cfe77c7e5U, 0xddc00f01b2cc804aU, 0xd31b01a6b0e08efU, 
+0x7c0506ca1d49f925U, 0x7c41999cb614d13dU, 0xeb0c148db4f25846U, 0x538b2abb5369c26U, 
+0xdd1ca03665de06d8U, 0x196c49695061cc03U, 0x562efa9c0b4e2d55U, 0x125421c352bbf7cfU, 
+0xb7cb2e59c11ce8a0U, 0xc70e4b21d6033181U, 0xbd6d1289ec8c6ed3U, 0x138ff5c419ce5ad1U, 
+0xae51998219684cf1U, 0x963338b0bc20d1b6U, 0x979ca2c4d504ee80U, 0x115f118531ec110cU, 
+0xe34543d45b107143U, 0xa2a3c1f19ef083dcU, 0x4cf04b20667600c5U, 0x10e20d10f1408b4cU, 
+0x260c72d4b9c719a9U, 0x42e68b4c3ab27bccU, 0x59d3df1262a2b661U, 0xe6a9fb469025585U, 
+0x7e0795cf5941360aU, 0x3a7120e5f5202674U, 0x6fac1a8da2ee7c5bU, 0x10b6a2159b6ef59cU, 
+0xa8eaa6fab54139bbU, 0xce6ebb86258a92ceU, 0xad6f493fc4023d6eU, 0xcaa23daf2cf2947U, 
+0xa2cbc09ecedc4941U, 0x35cf8a60d85ac0acU, 0x96d25df07bcc76f7U, 0x9f2dcef66625e7fU, 
+0x636e88a4b387a31U, 0xbe2f8e272f393ebdU, 0xebf9ec77120b13c3U, 0xa00ef8c502ab365U, 
+0xc450adf55b584adcU, 0xf78a19e2e7e681a6U, 0x1aba1eee9b0064f8U, 0x2fc4af79bc2045eU, 
+0x70e8eeb9d5bdedd1U, 0x7184a0ba6964a180U, 0x2afe096ad4b54034U, 0xb2f4954fb166708U, 
+0x7aa14f0a6618e308U, 0x5569f5f70e9eca0fU, 0xe3b33ebaf6fb8a4U, 0x838c2cf57a1b017U, 
+0x8ba71cc5207f3c5eU, 0xcf8e9e1f24c4fc08U, 0x3face3d7fd23a9c5U, 0x14fb13e8e1f5b4fU, 
+0x8f5e415fee3df2dbU, 0x8f6350a94cf7b195U, 0xb3fbf9302de1538eU, 0x178cde9efb4f6faU, 
+0x1dec78c9509949b7U, 0x1dec3c4b9cba6d22U, 0x9d5b87857f308c46U, 0x1375cce1618972c5U, 
+0xa2e6dfd9ed314cb6U, 0x89b08033f1e56c07U, 0x26b98f231adc0c09U, 0x12493811f017ec2dU, 
+0x4e1bc324214528a2U, 0xb3f5bab9a380e00aU, 0x96eee8ed3d4b0919U, 0x115320d90ee98e3eU, 
+0xce9a7f90b8e96cbbU, 0x7f3eed5072596c56U, 0xec1fad49e1e01aaU, 0xb2dd7de13dbc37aU, 
+0x71d678dea85ba5f0U, 0x5a9b6bc759c83b87U, 0xf6e5b2d4d08db8a8U, 0x105d487667eb98f6U, 
+0x1bd66885795fafbU, 0x596666811b4dde49U, 0x48fb27179f2f9b52U, 0x4bc983ee2af0ac3U, 
+0xb081bfced7bfef4bU, 0x95a18ff7c424bb7dU, 0x8ba377b615180562U, 0xe615ae57b1b8beU, 
+0xfa9defaad4b05e78U, 0x6b3c932b46183cb3U, 0x4f52d4a8c491fd56U, 0x8a835b71a4957dfU, 
+0x121bd2cd04034617U, 0xfb838d3283a253ddU, 0x17b06c675048ed2U, 0xa0df211cd0256fdU, 
+0x9b227183075ff109U, 0x99d40780bd643a5fU, 0x268b88e24717544U, 0x120652d6cfe97d45U, 
+0x26cc67beca27a95eU, 0x6760ba82b6e673b6U, 0x4f78bd9b26b94bceU, 0x19e98058f3e2a3dU, 
+0xa071e96499119bf9U, 0xcec1894ffdf20a0cU, 0x8f0d419e42065723U, 0x54ae4a732f7ae35U, 
+0x8153f2c65d50ce29U, 0xb19db3c928f94748U, 0x1c4989e8358973baU, 0x18c3493354ae13U, 
+0x3e7ee7ffc820a133U, 0xb05e5a451801d1eeU, 0x7ddcbd192f0b44a3U, 0x8852f2537af1347U, 
+0xe4195d12fec99f0cU, 0x3432adc0c9803689U, 0xe76553c05734c07fU, 0xebc3ce12f224232U, 
+0x1802bdfe35fb89ccU, 0xe106168cd766c2e7U, 0xdf3c5475e0653ab1U, 0x5c0a1fdbe8456b2U, 
+0xe5d24de4fb58629aU, 0x74f05039f02592abU, 0xc4118e6e6b548f41U, 0x11f4cbf32ffcacf8U, 
+0x247f8d32b3845c0aU, 0xac968ea09abf4309U, 0x17d7dac249a24a58U, 0x18fb875619f19afU, 
+0xb1c4bd3f7f57a946U, 0x8cd27490f5ac73d6U, 0xf0f4b01f52d55ea8U, 0x2258f042041a6U, 
+0x694e8ae97fb73e3cU, 0xc73ea3bff507d209U, 0xcfec31d4ccff5aa6U, 0x591a97993bb61b2U, 
+0x7e5c54bcab20b3b2U, 0xc7777beb463d3c64U, 0x3a24ace4ca9eb552U, 0xaf7405fa162d999U, 
+0x65aed5368a0d18beU, 0x753b2693f2bde787U, 0x15e07517a49835c0U, 0x1023536c01fdab10U, 
+0x275414b7775359a9U, 0x369c75cc87488696U, 0x2894b16602c5290aU, 0x6d64729985b469fU, 
+0x50f6af873bc2f9aeU, 0xc0e46f65c31a0d35U, 0x79417d3a13d5bab6U, 0x90ba25dca6de266U, 
+0x94e3c5c843d08358U, 0xc587a456a2f7fda4U, 0xed7b386f288cab4cU, 0x131e8328ade4140eU, 
+0xca525eeb1bbf0dc8U, 0xd4e357840e048ab2U, 0xa441c6d0a1a991fbU, 0xcc88269339f2a11U, 
+0x41e0b843cb4f11e8U, 0x437cf812e65707f5U, 0xb5c28bd5363eb746U, 0x4c32457def2af58U, 
+0xeb172a9ac6df0082U, 0x1bc202dc376a1f46U, 0xee719a363cb1af5bU, 0x340b52f23d807adU, 
+0x494e966f468c4834U, 0xcf300b91099d4e14U, 0x158d8a2f3a4348c7U, 0x133ddaf0c1cd22b2U, 
+0xf6ea7a4a5160373dU, 0x13c21999ad8ae39U, 0xe868fe80a65e81e5U, 0x7c601a28a1e9685U, 
+0x741cb25bfe7ce055U, 0x2c93b6341bdeeb9dU, 0x14f971281876d1fbU, 0x12facb0b9200061U, 
+0xcd95d5df1779b8b9U, 0x85929997d0261a73U, 0x909b82848e78dbceU, 0xda1a679f429d55dU, 
+0xf5696f7e1c9f0fa5U, 0xee1a07d9fa381a07U, 0x3022a34e0078cc49U, 0xd597726a16e0877U, 
+0x9b585c7d673efd8U, 0xbf040a0f5d8ce205U, 0x531a6fb180fdeb98U, 0xb1c01654c581f76U, 
+0xfd2ef3f5b5c5a3d8U, 0xb9b44787d02da39cU, 0x33cf4b8cd9a61505U, 0x8097b44fa48d5caU, 
+0x34fc26a1eb33ee43U, 0x2afe42d43a6f687dU, 0x1a3b5d9c95b1331bU, 0xd05abeb02562771U, 
+0x83d64523670114bbU, 0x87e9392eea50137cU, 0xb3fe298d82f025dfU, 0xa3292a576932aa6U, 
+0x3c77357a5b52bf42U, 0x9070453fff7f339bU, 0x29943c2e37b65d18U, 0x4a268c798dac21dU, 
+0x6b63259af1a2d0bU, 0x3a053d7e4f1a7416U, 0x375b4805d0729a08U, 0xe3e5c7de9eecd85U, 
+0xc4e4de33c075a2deU, 0x83611c274e9305dcU, 0x30302da6b52f6fe6U, 0xebc7cd78a0851c9U, 
+0xf65789257b32acd4U, 0x2e48324138de4d76U, 0x6a320c6b4045b4f1U, 0x12900d03d70eee97U, 
+0x8a6f7304ab3c8a0cU, 0x91c5666dd379c403U, 0x491afb77216c563eU, 0x12d2246c9ffdb5f3U, 
+0xe2af655e8367bfc8U, 0xc000a3a23fc108dbU, 0x7126a3b479a3e557U, 0x11ef493dbb6235d2U, 
+0xd25ef2734adea046U, 0xe699ad0cb9086702U, 0x4fa148974ee369e2U, 0x127685f40f8cf587U, 
+0xf6f99a91f1d408f3U, 0xe6f185423d077bU, 0x7bc414a67dc8fa29U, 0x103945c4b862b7bU, 
+0x8224a851d7d8c5fdU, 0xa0e8dbb356f788ebU, 0xd3e4a8206eda97fcU, 0x110a9695a46bae66U, 
+0xae26d320c72327d4U, 0x4c332fa71bc74dc5U, 0x6f80586f07249cf8U, 0x604805f7f22abddU, 
+0xc846709ec827be96U, 0xe5b38e2cac452b08U, 0x8cc0777f91d6b4c9U, 0xa6688dd0263376fU, 
+0xd6c4f5bed2eeafd0U, 0x4cd5679b1bba7d7cU, 0x4c262825abef86e1U, 0x84bbb00961f9ccdU, 
+0xc0621e360f9d9e01U, 0x73ffaa70f5cf6f0bU, 0xbc0f7713c514e722U, 0x2b5ffab4e5f7300U, 
+0x8af1f4247e61ab1fU, 0xc1b4eb99f6d0b958U, 0x6b084a31add68c75U, 0x1f5eb3fe50d67d4U, 
+0x7903dba0ad6922a4U, 0x733fa3a9aeaf84a4U, 0x4af04a59d98b65dU, 0xb36804d00baf8fcU, 
+0xa34b07498f111ffU, 0xd3f02acc7bf5e7b0U, 0xf9cff6fe01e96a15U, 0x6a588ea2cae2c7aU, 
+0x5aa692dad1f24c1dU, 0x83e7eb658bc3935fU, 0x2b97e31e286726b3U, 0x1c591b0af5d16aU, 
+0xe82e241fe36adcabU, 0x7c05f485939e69ddU, 0x967d4b69aadfd2eU, 0x8d1fad28a3d3367U, 
+0x837951f7da1f2d84U, 0x5ad0f0066e4ba9baU, 0x78178363bf8399a6U, 0x1f3b79a1a241a3cU, 
+0x19e54848ded0ae20U, 0xb5242463a1e97facU, 0x9ef07bb35a5a7810U, 0xdf5001029b704c7U, 
+0x911f3faf964d3f78U, 0x66eb99fddabad825U, 0xf7b150f1591a76c8U, 0x13401358b855b1eeU, 
+0x5d383dbffdd8023eU, 0x80f1198ea8442ebdU, 0x2cdb2b9fd71bf04bU, 0xfa3c47eb9e94c00U, 
+0xa18768227c67030dU, 0x89f95aa748373751U, 0x519527c64c611e02U, 0xba95a2b41c6e5e0U, 
+0x4af3cf2d8b570305U, 0xb0aef23b15370233U, 0xe43f7621887a226dU, 0xaa93cc0d7a9f8edU, 
+0xc5b79476330b9dc7U, 0x1128bc44d2a7ddfeU, 0xd179e392feab9a2eU, 0x9dba35ba6ff3301U, 
+0x949637ef9245c19U, 0x2d97d9af7c8dbe6U, 0x5c178aff3da59db2U, 0x9b08b7211328694U, 
+0x71fbc42e045c28acU, 0x3d0929699ffffe40U, 0x77c91904c73d7d35U, 0x8db99185e1b855cU, 
+0xa48099f3ef3b2ca4U, 0x24d00c41f2c3e46cU, 0x6f8bdb12d00cb293U, 0xce95fd5b1a34b2eU, 
+0xd8779849ce38a6ddU, 0xbef67b50340f1e67U, 0x5683049a6d17d12bU, 0x124ff7e649e138c3U, 
+0x51197dc9c8372822U, 0xf385fc4f316fe907U, 0x930dc2bc66264383U, 0x11ad0f5711d0aa04U, 
+0x704c13bdbfa6c8e0U, 0x9bd19e88bf534f7cU, 0x37dafe6e4dbce674U, 0x445f1028bcac470U, 
+0xa73499705bcf13c0U, 0xeb0733f9dd498d64U, 0x927ffd84d24ead97U, 0x89be89dc96c9ea3U, 
+0x3b9abb2fe41fab8fU, 0xa4c5ac34d471bc4dU, 0x764746680ee48e77U, 0xd24660084a2174eU, 
+0x31bb9811fc44bfcU, 0x9bf1c69c1e9c7903U, 0x77b4ceb31da62ee7U, 0xeced1b696a5acdcU, 
+0xc518e2e21ea62ef4U, 0x7d17ceb5838fe344U, 0x50429cd20a994dc7U, 0x755feb395efa6b8U, 
+0x2f43ac6bd9e5f13U, 0x41d122b7c2c5ddecU, 0xc8d45e42eff1f2c2U, 0x139c457098dc6356U, 
+0xc7f04ba0961ec892U, 0x17020ee1e2b60c7fU, 0x49baf87f91bf74ebU, 0xddc69b628cd31fbU, 
+0xbfa2b239087abb69U, 0x698a1c1268ca394U, 0x5fab67a33b032b78U, 0xb211b1f942fd105U, 
+0xc5c4e3b3505a523cU, 0xcb5915f52f38bfe5U, 0x3f3a2f2e8857c762U, 0xce25cd9c22ab86cU, 
+0x9e01921578b8b1dU, 0xa3f474a0c0445f79U, 0xcc1e64531ebb6901U, 0x3e8dc5091ef3033U, 
+0x3938793d027ebf6aU, 0xc26800eff317541aU, 0xca7f6d42410eedd6U, 0x8237c0e4c72fb4cU, 
+0x1f66dc1bab274cc1U, 0xfe53c28adf603d76U, 0x7c88a45c5e1429daU, 0x864d626695e40a6U, 
+0x26e88e1ad478fcbfU, 0x6a49b42237645394U, 0x50adbd588256e3abU, 0xd96c3d8d617373bU, 
+0xbfca2e397382b42U, 0x6b1e02ba8287bcefU, 0xa58807660bb6d98aU, 0x1251ca7d75ffe8ebU, 
+0xf9c5433248d3e144U, 0x92c7bad5bebc225dU, 0x80c49549fe3a9679U, 0x84ec06428dbd796U, 
+0x91ec8b7bf9cfc4deU, 0xb294f48b6f49e33bU, 0xd08dd71ebd1c03bfU, 0x6c0741e19f9c4d4U, 
+0x7d9718993e811476U, 0xedb8528dfc26773fU, 0x37c80636a426d0faU, 0x102926b17bd2b614U, 
+0xe9b13f321bd3102dU, 0xe6f70e930c078f7dU, 0x8a8fbcdc2606b9a1U, 0x940280470100ea3U, 
+0x6b4d4e25ec5296f3U, 0xe0d8550cde5a30f1U, 0xb6582bd96fd54c02U, 0x1033eb7bf891d19fU, 
+0xf46ab0014a7210adU, 0xaba57262dcfd7f53U, 0xed491b811854bd42U, 0xbba281f78f16710U, 
+0x3e75db549d402155U, 0xe3dc4d0ee797a3d9U, 0xb252eaa2e548a73bU, 0x4cb4246995ced58U, 
+0x5a15fd9d9d10631U, 0x4d85b434e74f58cU, 0xc20dc5c35f25a928U, 0x36f3f9824fe48b9U, 
+0xc5d5f21a24cee0c7U, 0x7ca6d0b8374a430bU, 0xc4a583221d26ff39U, 0x130745a2ccff5070U, 
+0x7664bf58c2124c70U, 0x73af97a1c0323642U, 0x3fdfd79e863dfdccU, 0xe061aee3f2de2cbU, 
+0xad4b4f6d7d4b234bU, 0xef5e74db9ebed686U, 0xc5067beee179cfafU, 0x1022b1f65da80c3U, 
+0x74e6391283457b4aU, 0x99fe817d82967ef1U, 0x478f6934fb05c386U, 0x10cab72694c5bd69U, 
+0x462844203feccd24U, 0x3f6fa1d9ff4051deU, 0x1576d597cf07ae7aU, 0x21d5cdfb716ca12U, 
+0x3183ec179893874eU, 0x651f3522beaa83a8U, 0xb3b2544bc67a477fU, 0x10d4ade4102ae02aU, 
+0xcf536968dcae1eeU, 0x236e4118bf17fb00U, 0xd9a031eb609bb68eU, 0x1509652140c545aU, 
+0xb848d16a56e7e40fU, 0x7275931054f3cb2dU, 0x423c2faf9ce33518U, 0xb292ffd6a9e9570U, 
+0xb3d527873b70d332U, 0xeeb1029d2841425dU, 0x7530eb941ab4027fU, 0xf7707eb1743297eU, 
+0x9715f027c63722cU, 0x60ff0e39a7230d3U, 0xb52cd0e96cdc66d7U, 0xb0c7211b409f739U, 
+0x98adea294aea2a19U, 0xdf412b12f350a481U, 0xc55c4d78bda25c85U, 0x832d9c3fe9f0c08U, 
+0x5ece2ed3d50ce9e6U, 0x1411a2231b9c9d1dU, 0x54be6e8caf7a7da8U, 0xc8ed83f749bbab3U, 
+0x6a6284e42f2d8866U, 0xbea7158b009d3f3fU, 0xa978dbdcff15d3a8U, 0xc4ab4008c3ec10U, 
+0xce096f639acef26U, 0xdb05f66df9efd7d6U, 0xc1546d90be8e1e13U, 0x10ccd86cb6d0eb2aU, 
+0x2853eebeb2670d02U, 0x5c28957497aa42a9U, 0x7db503abd7bd948bU, 0xc52efb2f9e2a41eU, 
+0xcab9f34efc14f57dU, 0xad7110a48d75034bU, 0xa4b4179e61e7315aU, 0xd016ccf4c2c3decU, 
+0x91689440c02f4782U, 0x8d2676180c0ab68eU, 0x81dfad4cf183f78aU, 0x7668842fa8caaf9U, 
+0xd782e16fa8080e14U, 0x31d4208ca6daf9b4U, 0xce948939c992414fU, 0x6faa996695f8d62U, 
+0x2cf58ba0fca17654U, 0x20f2c054c078fbb0U, 0x227bee2b41d0efa4U, 0x3491ac88323d2d3U, 
+0xab4279b12d0800b0U, 0x79435d2c0d5c61b7U, 0xcb7da29713641c34U, 0x54ec9fa2dc2a212U, 
+0x863c6ed2e9b99216U, 0x915706632b19200fU, 0x912e5cb1b85fd28eU, 0xc1ff3f054d39cfbU, 
+0xe644eeb25942fb1eU, 0x6e170ce476030320U, 0xd06d819a2ee30f0bU, 0xdfd333bfa86b03eU, 
+0x46dafc55c5e39f5U, 0x5ea672f97013dd87U, 0x6cfa52aa50905a3U, 0x13d93f464403ec8U, 
+0x5871c51c5c953b72U, 0x7bcbfaae734de878U, 0x91ae8747ba26ed4U, 0x69f4b7f6a2aff8eU, 
+0x4d209fb9705c99f1U, 0xb178aa28e70e51c8U, 0x9204b489ef1731b6U, 0x4e92bb7dad73ab5U, 
+0x3dd4d7ccecbfea33U, 0x12ff7d0779540ca1U, 0x89e7893f8e0aa3d5U, 0x103c10488732d3abU, 
+0xe2fd6ac75a39ca64U, 0x3baf97610cf8dc5fU, 0x6f8e7663aa1bd12bU, 0x11180f083c943f07U, 
+0xed2899ab637db2fcU, 0x75292c3ee105f15aU, 0xcb55fb2067818727U, 0x63c0b4a09a487cfU, 
+0x57f4b1d9ee348732U, 0x44c9e6fc24ffc38fU, 0x5ea1bf5047748ec3U, 0x69e9d68cced8386U, 
+0xc74e5719ae160ea3U, 0xbd495030c813633eU, 0x2232d4934fe0de3dU, 0x3f61b550872bb98U, 
+0x3302a78bd67f4aaU, 0x9d7a413c1e28dbb0U, 0xc3621c2133305752U, 0x2d5e734456690faU, 
+0x4cf59e628efd052fU, 0xe90b05625d8af23eU, 0xd76cf667f2b15e22U, 0x6d710285741bc73U, 
+0xec545358ab608ebfU, 0x8e089c563f1981dbU, 0xab2748bbaa4bc5c5U, 0x47a6bb63a190443U, 
+0xd9b06893a395a14U, 0x1604eaf50a8ce6fdU, 0x9f2d95ee1388c39bU, 0x124c0096c38b8608U, 
+0x667b4a1680e2df07U, 0xf38082d61e501792U, 0x80fe763707fa60c0U, 0xfe38ccba03086c8U, 
+0xf2c780d19992bd98U, 0x9abc60437da315e2U, 0x2dbd1aa49bd5e71fU, 0x5d2723e50fd1946U, 
+0xbcd83c117079bb07U, 0x4e0909cb96b74bb6U, 0x1867096576e46c11U, 0xac2ccd993a3cdb8U, 
+0x886cc156b503fab9U, 0xfff56eec1a552addU, 0x107c9f099a56bb9fU, 0x7b05fdbdbd330e8U, 
+0x9919dcad60858e70U, 0x17a5605f510426c2U, 0x2f39f1ee647a7803U, 0x1244f4b676238ee2U, 
+0xba906a25de949b51U, 0xc59ed34d30e481e2U, 0xa6aacff75ed73a73U, 0xfd8c24b27de6efcU, 
+0x5ce83cf608559694U, 0xe9138c81a3a7bbc8U, 0x32809a6e804ce7d9U, 0xa60b7f34b7843b5U, 
+0x574ec2c8ece73847U, 0x3b1d06e4b9e36U, 0x4ebde9611ea18ecfU, 0x5a1ffa1f2f38900U, 
+0xf704f434f8523f8cU, 0x5468ef5b535c6c3bU, 0xbfdb0bb34fdd06e2U, 0xb443a660ee7ae1fU, 
+0xffefdcfaf86c0545U, 0x1d393778534dd355U, 0xb187b56121ac86f2U, 0x5354527d2d48d3bU, 
+0xe1383e2d49b3fdb4U, 0xd9a047f908c2e3e4U, 0xa4edbef223a1d56cU, 0x7af271d3fdd3e59U, 
+0x2844b45f295900d4U, 0x769989f5c83768a7U, 0x93e42d458cc79fe7U, 0x72dc0a6ca1d86afU, 
+0xf4785698db34d5caU, 0xb2fc61bb2e92c5f5U, 0x581d34aaadd8a3acU, 0x6a16dc0956defb6U, 
+0xca567a05a6fa42a3U, 0xe5aedbdf966482b9U, 0x2a9bdc23f3cf1809U, 0x10a209f18adb3160U, 
+0x760ecfa394838fc3U, 0x4e5a51a6c435d8f9U, 0x9920d1965dd21f14U, 0xa9ea247745f117aU, 
+0x671dac33a72efa43U, 0xff7e061cda97a9d5U, 0x88ec99df74e200baU, 0x36c61d1d30dd1a8U, 
+0x3ba34a16977d90dfU, 0xdc4f33829e42bd12U, 0xbad54eb97e90a309U, 0xc83070b42847c7eU, 
+0xd369c21fe0a91dabU, 0x59f885c710deede7U, 0x8c52a64a5267e922U, 0xf265c38bb1fd51cU, 
+0x1cc20d3b13e2d930U, 0xc4df2f97f4e94160U, 0xfde06b5def81b412U, 0x3db6e43dfd5b28dU, 
+0xdc8734f98a523821U, 0xfd47226ef39991f0U, 0x31c3a4195f8bd829U, 0x8db4c73a1b503c1U, 
+0x5e2c9c7ca0e077f3U, 0x3c7e5a05201c8cf8U, 0x3406e5670c55d7deU, 0xad0c3c4be8797efU, 
+0xd08382360e445656U, 0x4c871d75a9a17bb3U, 0xb69c0fca3b003a99U, 0x9b43df280be688aU, 
+0x5df1a7b459391dc7U, 0x886e142d55098109U, 0x9bc768560b261b3eU, 0x7999e26ce90b607U, 
+0x6d9d5e4f0a614cbfU, 0xa33ead4f51f9f154U, 0x1bdd217118d52841U, 0x12fd20d979e118beU, 
+0xcdb810cf2f6ce70U, 0x84057fe05bbe2b4eU, 0x95c0f78245e7722dU, 0x1ceba4ca73d2a1fU, 
+0x4208eb90b205c765U, 0xc621f051156dbb56U, 0x9c9e2f1cec8832b5U, 0xfb8bd7b4cd2c62aU, 
+0x16bee8985b3ddeb5U, 0xcae6e62b52ed351aU, 0x1be4768ae3ceffe1U, 0x12f6ba94649f0cf0U, 
+0xae34822cca5e3adfU, 0x7b7b60d74c0c63c9U, 0x7f13d69d4ee581ffU, 0x126a2c3dd8d12fc2U, 
+0xf192838051d83b0bU, 0xe1879a4331843c8eU, 0x222e2a2fd0ec8dadU, 0x5b2e45afa962c75U, 
+0x8828296e0d76dc4aU, 0x1feed412fb4c0d78U, 0x80dcaa32ebd0ed61U, 0x4b98c73c8f093afU, 
+0xe5846b083166c85fU, 0xbbac6cb4b32fd7b9U, 0xbea075322839320aU, 0x64a052ea672de7fU, 
+0x5fe7581aa935b1U, 0x2e2e4c35cab09ccdU, 0xfa4d2d09c8413e0eU, 0x1e2a322069cdff3U, 
+0x3ff8311bb389276eU, 0x3a52695fe723b79cU, 0x36e4b80fd923506U, 0x6a8ec17338a3037U, 
+0x3496e55bd95be8dfU, 0x2aa63e240ef56966U, 0xacf7581ae068af93U, 0xa02182573c77219U, 
+0x92c2745d7a9c35b1U, 0xe207df78300ed4caU, 0x6c70ec3def730d39U, 0xddce7699014f519U, 
+0xf253d0778ce85b6bU, 0xa2d3a37da30e7cbaU, 0x4381b9e398e74084U, 0xdf401cb39c79f0fU, 
+0xca94c3416810743cU, 0xfb0afbabfd510c8aU, 0x2022fe07d76c38c9U, 0x81ba941a7691790U, 
+0xbc04346f1f926ac6U, 0x5efc9adbff9b2840U, 0x8c1e3c240f2f718dU, 0xf1f84f5f0d29ca6U, 
+0x5051ec9b025e03aU, 0x5d5b633f390f328bU, 0x5e8ec3453be51e9dU, 0x3e71e6efe652b23U, 
+0x219900392aa93de4U, 0xdf499c546e2285b9U, 0x13070626d7a797a1U, 0xb6788266144598aU, 
+0xc3c7a9088dc82a56U, 0x493ee040faa78a94U, 0x35fab45f7c8f5579U, 0xe4ac5e99a6e36feU, 
+0xe8f210c2d43624e2U, 0x202a0d5e591433a7U, 0x72704f85d739af04U, 0xa916ab76a4cfab8U, 
+0x97b0c7c28169c6e9U, 0x2ee4e7d903160a7bU, 0x509f77f6f6fac3ffU, 0x5865198c025a4a3U, 
+0x1043b333bc18c58fU, 0xab826ba547ce43ebU, 0x2aefdfc815cd9a7dU, 0x97aa3f54c33653dU, 
+0x7c90e56eee2f451bU, 0x535a2b5deb118e44U, 0x4bcbd0f8fffc0eb7U, 0xf2898f65dcd6661U, 
+0xa80cc2c1a01d69b0U, 0xbf042a6321fc7604U, 0x1c862d7ac8e04bcfU, 0x3acefc1f08698b9U, 
+0x1e076464d6a1df85U, 0x8b8600c55cff6bfeU, 0xba2cad5b53e52206U, 0x126d643330d9a8d7U, 
+0xae2b215f85f217f5U, 0x3a6363579104f975U, 0x70aebd93dca326d5U, 0xd4e81cc59649eceU, 
+0x64989c3559892908U, 0xfd8270189b3fcfbcU, 0x47ec471f6da5e09U, 0xb4459c74ce52854U, 
+0x8800449b5541d93bU, 0x623bd92efcaa0101U, 0x11c63889ffb508b4U, 0x66c62841cc84d96U, 
+0x4b9497f9794b776aU, 0xde01505e93288b8U, 0x49e6df1f2fad44efU, 0x60e37bf533df20fU, 
+0x88ca03c1e8657068U, 0x560f05fe0576301U, 0xe812093202163a85U, 0x137289ad3d096a16U, 
+0xb69ec98ee5b4b1a7U, 0xd1418d843f12cf14U, 0x14c1321c567bdc59U, 0x9ee91b34b435607U, 
+0x4bb7e81ed4f2fa39U, 0xa077109eebc84ad2U, 0x63a83569939d1f9eU, 0x22c561877b25eb9U, 
+0x6490425857d49a36U, 0x43909be11db7fb75U, 0x741bfc89c9ea6d99U, 0xe286331a9e2d2abU, 
+0x18133f827fb543f9U, 0x85c77b0879e0d8ddU, 0x2d18935c29da0126U, 0xeb559efc266b8ecU, 
+0xe1302d28e419b1afU, 0x8b65239360870c1fU, 0x97eb7102000f1e5bU, 0x1261981610bf1c60U, 
+0xa7fe144ac7394715U, 0x71fb49a937e87eU, 0xc03b0996c8c5b8caU, 0x73d5626fae0ac62U, 
+0x289b72c8f54f8874U, 0xb0f7abe8d92fdcdcU, 0xd1934d4113a6a1caU, 0x8bea0e8417d1a33U, 
+0xa57f3b47cdb9f4c1U, 0x1b3de41edfbd85fcU, 0xdd2999374bb4f76cU, 0xc1e6cdd6a00e4f9U, 
+0x51695d19383d6092U, 0x29885b45f74e86a1U, 0xe8e138bf21668021U, 0x48a757a963f9e02U, 
+0xdd3045014695e8b7U, 0x2fe798b9001cb1d2U, 0xc62a4dc0b082dd81U, 0x12b932310b7a4d3cU, 
+0x19bd42d14eb18e37U, 0xe514eaca59189d82U, 0xfa47196fdd20b4d7U, 0x6c24ee2907d0f6aU, 
+0xbdd6ace0d07257feU, 0x1d417118b9d2ac2cU, 0x601475e590fd156bU, 0x12d13f4a7f85a9f7U, 
+0xb794440623f2b3e0U, 0xdf40c3e16613cba4U, 0x6ea84d63eabb10feU, 0x747cdb7f08f438cU, 
+0x4b70577977a8b47dU, 0x368351e84f2a9d2eU, 0x48db8b9408930980U, 0x4bce3770d892693U, 
+0x7af95077333c5801U, 0x201893cfef1e2d06U, 0xf60e13600e0243c8U, 0x115af5927b916ab3U, 
+0xfc886017625645dbU, 0xed08d071270ed37dU, 0xa05ad6bb4facf72bU, 0x38bed86275b278U, 
+0x2c161a9a9b9aa8c3U, 0xc5c3427ab64854e7U, 0x748a8083492bc054U, 0xa95ef20f854f27eU, 
+0x614a565e4493f3dU, 0xb658d2bb260262afU, 0xaaf1395934f88ecfU, 0x114973652c29ebddU, 
+0xb8511a5ff42db284U, 0xe7e1589a525b8ff3U, 0x741b426736a5d003U, 0xf77d1ef550843e6U, 
+0xd0f6b91a8bf2afcfU, 0x6b571714fae1f1ceU, 0xe5e16e4893ece561U, 0x1ba45672e0792c8U, 
+0x411e950390f8aa58U, 0x5ed801cbdc25d155U, 0xc733448073f96a3dU, 0xe13cd46769e4136U, 
+0x566616b411d56054U, 0x87b77e8ef5512fcbU, 0x9290b640c0ea56a1U, 0xa5da25e1a1ad92dU, 
+0x35ab1d7fb2f9bacdU, 0x9f24705bcdc41c38U, 0x3389493f31db1592U, 0x76580eccf08c78fU, 
+0xf524cbedf7ac16c8U, 0x4d3ceb2c54f29086U, 0xd5e9636a298627e2U, 0xf2777e19ce66880U, 
+0x2b78163e72752ffbU, 0x840e2128af2f3b39U, 0x7b398278ca009449U, 0x97868f06f966f88U, 
+0xed95c9f2cef56c7bU, 0x766176e4e35f7ee9U, 0x95817967d8aa991U, 0xfa8e4b3bbeaa5a0U, 
+0x267b9cdcff6b586bU, 0xc45b376896d852a2U, 0x378a7515b61df62fU, 0xebf1d1d2483806aU, 
+0xa7083501ef366843U, 0x8c6725dfd178f162U, 0x4ba1967bf52c11e1U, 0x60f6cfc7975d2e2U, 
+0xdc3c7738d75b2bf9U, 0x545c4febd28d6003U, 0x7eae6eeb8ccab3adU, 0xfa822dcb2284c55U, 
+0x139dc0afa904daecU, 0xc7fe3e853c0885a6U, 0xc6f00b51feade504U, 0x6a57c4587077d55U, 
+0xcf7e3d696f8d603dU, 0xccfa8d95f8973d87U, 0x2207b0c514079b95U, 0x696ac454f6ac7b9U, 
+0x8eaf94d3bf0c17d4U, 0x634e177f9b432ec8U, 0x428aaf27babdf50aU, 0x2ecf0c472062a4eU, 
+0xb6133ada54565c55U, 0xc96a5c1af34b32c7U, 0x1a6524f954411756U, 0x6c5da2539962093U, 
+0x76f8215cb9fc3ad3U, 0x2936bfaf3e5b795fU, 0xf8a9ed317b38d5cU, 0x12178117005fc069U, 
+0x80af56e924a8c12eU, 0x4d8b74b86ec7c8daU, 0x87ca2f1c825b549aU, 0x666e24b0bf76cb9U, 
+0x1bc55cb125a0c7a3U, 0x82a8d07d70c1898cU, 0xabe5c739aabfb5d1U, 0x1030061a7e1a024U, 
+0xdbb77176defa4165U, 0xdf6e7c91735a9e98U, 0xa90558b97cbac55aU, 0x4c0cb2386ab26f7U, 
+0x7ff86678a2d31f7bU, 0x43245d0408d56676U, 0xfb13f1cf6495a0c0U, 0xdc78e868abddd2bU, 
+0x5577b0360944c900U, 0x797ff083f38e5d89U, 0x63d996c4a7a38c4bU, 0x880b9dcf1ae2d0eU, 
+0xcce6687c3195d1beU, 0x322b893c1fce625aU, 0x3bbc981ff03adc69U, 0x33db8ae68131c3bU, 
+0xb5144507acf34c9dU, 0xb0d300a3b8280c95U, 0x46fac4d7aa25854dU, 0x136a1d1225e5009cU, 
+0xfa92569175ad1c7bU, 0x165083d002aabffU, 0x7d012d0e0b545bfaU, 0xaea13b0a4084ef2U, 
+0x3b098fc556160820U, 0xc58bc2988e7eac81U, 0xcc7cd4ec7ef65be8U, 0xf8ad1f9bcda8934U, 
+0xdebf5e78e8bf2fa4U, 0x220139de5200fb53U, 0x4cc1478a8c9d5727U, 0xf5771c6e8aa8bdfU, 
+0x54c5780708ff437aU, 0x8b4f4414339d0c1dU, 0x7f2f30a858339330U, 0xfdce6fada9a000U, 
+0x3629d7971525f560U, 0x3bd9a50840ca5026U, 0x2b8d9522174d15e7U, 0x5155be7d6c49370U, 
+0x7ab2da6f5fd16b7eU, 0xfb7fee2bcf5f6aaeU, 0xa0130e5079af59a9U, 0xfb33b37cbf31695U, 
+0xc04df31c8eb6d77bU, 0xa044938bafbbc131U, 0x4e0276c5478b160U, 0x317572a5fd69c5bU, 
+0x87f70cc2b2b3985fU, 0x6ed3ba118c8e5219U, 0x1547a6326a25dc8dU, 0xbe696d756dbe798U, 
+0x5ce88cf6cbb91327U, 0xa5dc953211892613U, 0xf67c45b4c3ffa89U, 0x12dc762eb6ebe427U, 
+0x34d7433553ca99c2U, 0x62a6c49ef0b300feU, 0x9d075b0332f64487U, 0x21b7a68523004b2U, 
+0xd2c8b0cc054d3d00U, 0xd25fc437bf43e770U, 0x1e0f403853964947U, 0xdc47de284cdb0b0U, 
+0x89206ee33f8ac0b6U, 0x28441d1cc677d0f0U, 0xbcca485d900b5ee9U, 0x19f34912145aa7bU, 
+0xb05d4085d8c6282eU, 0x38d70f18722bae1fU, 0x908b1a42e1c5d1b0U, 0x12d36337f6995231U, 
+0x2cf78b0e59f6985dU, 0xb5213ed03a0059ccU, 0x443b389a99000eccU, 0x134ff48522791034U, 
+0x9260b65dcc6867eaU, 0x2147b106a26e8305U, 0x54d5e65899f5e19aU, 0x81b2af093472237U, 
+0x5c1f266127712a17U, 0x13880c6edfb5664fU, 0xafb608a89c68ecb7U, 0x87f027e2e41079cU, 
+0xce7414835b22d83U, 0x534d12d60b281473U, 0x49c3baa84a012ff0U, 0x27d8bd7596d577eU, 
+0xfa077085bcb5f57cU, 0x442335280f7c5a99U, 0x144f096223472e7fU, 0x7631be7141e910fU, 
+0xa700bf8abf735dd9U, 0xbbb9ed8e857d3c5cU, 0x3b443c7be5a85780U, 0x129ef422dbe762daU, 
+0x16070f47a55c706dU, 0x901e26cc4a85c041U, 0x31506ebcccd22100U, 0x526fd1800e2b02eU, 
+0x5c9a9dc6e88cb075U, 0x25896c9faf2db69bU, 0x2397f40898a8c2b7U, 0x127d828c4757ac4cU, 
+0x5cd5761923b39cb0U, 0xab4af1da485044c8U, 0xffb45a9ab2f8f667U, 0xc6b130d3d49fecfU, 
+0x544075c8632d438aU, 0x77f90fbdcd746d03U, 0xfbb4f69e17d97a81U, 0x5886bcbbd55bdf4U, 
+0x6073afcfcad4f1e5U, 0xbaeebc25e4233ff6U, 0xf9798be34db65fd5U, 0xce6f4090be13cd9U, 
+0x63183b39d6242e5eU, 0xc648c52bacb6e15fU, 0x3d487406df67c1d1U, 0x67e1b909560de27U, 
+0x936e77ceccca372eU, 0xfc1009e132c1b13U, 0x5fbc33fed94969eeU, 0x8ebae5c0fd8ddb8U, 
+0xb30e340f1a3265a0U, 0x653f6780bb96f9a0U, 0xdcdc9f0b579d20f1U, 0x5e8f0635d083a53U, 
+0xfd5d9b4578abcb06U, 0x94ae62db5b910d19U, 0x42e9dcdfc54204b9U, 0x139e363b9778e7d0U, 
+0x184ec99583e564d7U, 0x9949bccbe93140eU, 0x3c90712816ad2fdfU, 0x124373fa8f72888dU, 
+0x2b19e4ff640f4a32U, 0x26db688dfc9b9562U, 0x3fadc5cb9cc5da38U, 0x1008fa28c5c5583fU, 
+0x245a2a5bae571075U, 0xb38619d9d62b4ca0U, 0xa3c4b7b5b6b6c5acU, 0xcc608fe2055e06dU, 
+0x1194dbfe0ff1b4feU, 0x7fe5eaabc2bb74a2U, 0x1a6e2c24f0bc9850U, 0x10809ac4f03328d9U, 
+0xb1c4d7e54fd63485U, 0x9daa46742b9ebc02U, 0xede424552ac19a63U, 0xa74f594574bcc9dU, 
+0xae5058a267e1fa76U, 0x2358d7d50c89cec2U, 0x120ff528cb997da5U, 0xcc1786637ac3f5bU, 
+0x636e0d9105d0dcb1U, 0x2ccb70c8c37e4506U, 0x4e1e2efca9307086U, 0x7e05ccb0ddde610U, 
+0x77c6df59e74ed79fU, 0x28d78fb8fc598ad9U, 0xa9e2fdb74fb6b046U, 0x2b47ab186da829fU, 
+0xa304075ade8aa321U, 0x8469f04e5b6193e6U, 0x68f0f914f904e634U, 0x961b5985a537598U, 
+0x43b2d7eddea8f8c1U, 0xf5edc01ffea4bae2U, 0x6e0b93b36e01d587U, 0x10fb8a376900aa92U, 
+0xa4b04dd031dcb6f6U, 0xeda0516d9c46af17U, 0x2b520000c18a7296U, 0xef631375d30aca2U, 
+0xe8964bdf1836371dU, 0x55bb3b08ab679c0eU, 0x23bafd25cab9939aU, 0x54f7361ca0472fU, 
+0xf2ac933cc9ab9d94U, 0xdecd792f7d829e2eU, 0x8a4e206a14002a5dU, 0xa1411f5b3a66006U, 
+0xce17151817226d69U, 0xd859b03f0d8fe15eU, 0x6454c243cfbd8e91U, 0x7c6fa45458233d2U, 
+0x8792bbeefbb0f60U, 0x6782c3df9182ae34U, 0x13f7471fae95b76bU, 0x47d5bf92cacecb7U, 
+0xc00e419f4cf41a87U, 0x71ae812e70663d17U, 0x11abeaea6c85d9a4U, 0x66e3364e4cea148U, 
+0xf8ab5acc1611e483U, 0x73423c8a0464967fU, 0x409a84588875b7dbU, 0x1c9b1a10d17ff61U, 
+0xba8df6ccda447573U, 0xb6c798b9ebd369acU, 0x760ad101149461b7U, 0x485e2a0fb804732U, 
+0x7bd4d62a3236d863U, 0x2b66de9fc5a563d9U, 0xca2f2a1d35fe789dU, 0x11c57db575be0464U, 
+0x53c3efe10966292fU, 0x3d25605e5c47cd29U, 0x906d2b1b7143914U, 0x4375dade26e4e3bU, 
+0xad48e599c5f3062aU, 0xc5a8aa870bc84324U, 0x6de67aecf078923cU, 0xcc3bf06f84ba567U, 
+0xaa4407e6a08c03cfU, 0xd186c6b008ecab1cU, 0x227cb745173660deU, 0xf00ea52a90a3353U, 
+0x9e1e7611f4a4b24aU, 0x3947ddd8801dbe73U, 0xfb555b576bb84829U, 0xcc583403e7341f2U, 
+0xb79b6b1688f1052U, 0x5844cd0b717ae496U, 0xf1e6d08c36c4d0c0U, 0x11552e5acb6b461cU, 
+0xc65d9d9b79423b8cU, 0xf37786b8395943b6U, 0xe60b36c1c97616adU, 0x956df27a1d501c3U, 
+0x33043ddb06f7086fU, 0xb3ec4dca59dafdd3U, 0xed6664398627502dU, 0x44efc4d89934081U, 
+0xf712ca6a125bd842U, 0xb599d2ac2d369b9aU, 0x6757f9e2038820f0U, 0x11cb62c1247ca4cU, 
+0xc2b7fe8bef682972U, 0xedf3e3a3f7393c0fU, 0x9fb0fa616d60a312U, 0x64a37efe05fbc9eU, 
+0x596b285ce7ae9c4aU, 0x23431647ee8807f4U, 0x1b2581f4e2660e39U, 0xdc6e494f5bf14f0U, 
+0x67f39226942908abU, 0x88a9cdc81b0c0a15U, 0x22a3bcd7004f1d1cU, 0xd5a9f4fb20c9ef4U, 
+0x1868fbdaa316f8c0U, 0xa4c6e11f0afd6e4bU, 0xdd0bdfb7696b2d13U, 0x8d0870d3c44902cU, 
+0xb93cf68c3dc48f8bU, 0xaf2995775a9d8d30U, 0xc955c182632b9f60U, 0x8934c0dd68fbca4U, 
+0xa685d61585326416U, 0x8d1d58a2e77742eaU, 0xfd37d3b0ada01c93U, 0x111182e85cb3e4e6U, 
+0x8d14cc1aa62a7566U, 0x70382a91604612e3U, 0xdbc8fe598ba8b558U, 0x332d9804fc7d6ccU, 
+0x550f940d65056f03U, 0x8da93ff13e279306U, 0x1c86638446f5a100U, 0xdb895934603408eU, 
+0xeccdb657ee0b9296U, 0x3894e3dfd24425a3U, 0xfb3dc95835f1a02cU, 0x9c8113f817b47dU, 
+0x38e01f9636558513U, 0x16a731b9ffb67001U, 0xa3884fcee352f8c8U, 0x8a3e5cf1586c901U, 
+0xa846eda8f296e38U, 0xaed057f95b57a349U, 0x29b96b70d9402288U, 0x93610f515ca74bfU, 
+0x55f457138f98471aU, 0x2de7cec4c1bbc9f3U, 0xe347fd82a585f4bbU, 0x6396d528c7afd0aU, 
+0x236e48c6d2b3e974U, 0x330d18c143851e8aU, 0x8436b1ecfa199634U, 0xd21b4be46c69153U, 
+0xfcec515a0ab75a2aU, 0x1cdb58b3250715bbU, 0x4776c85e07095894U, 0xb89e9cc25e3ede7U, 
+0x395e4b801f555f6U, 0x4acc912ae2469bc5U, 0xafd1d0046f8aa175U, 0x24c61fc8ad4ab97U, 
+0xecadfaf61c4f7872U, 0x200a85dbcc9fc51eU, 0x131e89f967f8d4adU, 0xb26864b91619c6U, 
+0x48828ac6d139d86aU, 0x357b6429d4ac1240U, 0xbaf94c52b4c4e58U, 0x133ff1b151148d64U, 
+0x6b1771c3cc25c4eU, 0x75f457213d009544U, 0xfbbdf93b43bd72a2U, 0x1175ff701ea866d7U, 
+0x3bbc793f51515a13U, 0x13e5f8ed77a4aad0U, 0x26842fd65f38a3e5U, 0x37b01660e84f474U, 
+0xc047d456eaa3ab51U, 0xdadfb5b403834809U, 0x8e3aafba84a71110U, 0x1390caadc3419d86U, 
+0x644a4aa094dee3e4U, 0xbcc4db818c9aafefU, 0xf77568b8e2feadacU, 0x68c38d00a92060dU, 
+0x804f24de9c07fffU, 0x29a3b8d5fbdfe7aeU, 0x43b84d69bb750d04U, 0xf3ab3fb8187721eU, 
+0x928170ed693ef18cU, 0x1a92fff46d98d5caU, 0x271b0212a2fe77b7U, 0x42b52e4ebaffc48U, 
+0xdec700af0f9a5042U, 0x562d51718b09b121U, 0xfc0b4608852ab99cU, 0x3a744cd2bc525a0U, 
+0x35dcb30dea99accdU, 0x2089cab4ffd28fd7U, 0xbc06ffc144968707U, 0xed080cb9c1c808fU, 
+0x6f390e03e0168b3U, 0xaf872e064a502c4eU, 0xbc001e9179c9b81eU, 0xd41bb0589c5b8c4U, 
+0x655996938fa82ab8U, 0xc06920d938fe41feU, 0x98c44d96eccb260eU, 0x4469d91c2036f75U, 
+0x85329b8c6eb39c47U, 0x227383dc86f122ccU, 0x1b38a63cc706cefeU, 0xe8c173e88e782f9U, 
+0x5a16df8a6fd31d5aU, 0x311fe8b0c145e308U, 0xf9a0cfb9520dc4e7U, 0xb5b462c4a45ed5eU, 
+0x89742f5750aa5b27U, 0x25d7e5147dcd0aa2U, 0xccc6a735070184f6U, 0xc4aa64130b39a40U, 
+0x9edc5892ecbe7ffdU, 0xe43e28b353b86af1U, 0xedbdff634b2304c4U, 0x120123dde1a047faU, 
+0x86a9408c20d7c51U, 0xa23c1108c6bbde64U, 0x75ae2f282f7f330U, 0xd6622448d76c29aU, 
+0x858f2455a13ebe9aU, 0xa5b8f39f4d2680e9U, 0xae7f19ef04af6c45U, 0xc16c8a2ba4ee6a9U, 
+0xe7cf154695763327U, 0xe18b99d854eaf329U, 0xb415dd4e6c0b3b8bU, 0xd51b188e4164b44U, 
+0x73d521d11a2c9069U, 0xc1f7674c6b13d41fU, 0xf2e1cce72ed0fe7bU, 0x7b9ac26a7d6fc23U, 
+0x154add6820fb3fb2U, 0xeabf18c81b983360U, 0x6f63a78c9f97a685U, 0xa99991635388b65U, 
+0x69bf215d40d27a28U, 0x223e2bf25bef7596U, 0x6ce581a5625ab7a4U, 0xbf6c63f59a59dcfU, 
+0x80b87fe319781ba3U, 0x45b52db2982e237dU, 0x66fab5dff6c2b3e3U, 0x6d38db3ecd9c081U, 
+0xf1c15010e38bd8feU, 0x48ba200e5e54e4e2U, 0xf7fc89fb5aa8c48aU, 0xea78c1efadb3c9U, 
+0x88c2929b1d3263d5U, 0xa51c267227fd7856U, 0x2cca85a69fc5c015U, 0xd8cc03e4328722U, 
+0x44bb17a97eef4f26U, 0xbab25ca4105a86U, 0xea8f2f0fc02ad2a6U, 0xfe44ebb86d7331aU, 
+0x6f71d8c12d5ce0aeU, 0x53f3cb216ce34062U, 0xffd8405f25cfd81eU, 0xa3c098575f16be2U, 
+0xae0da0fdf97c2e5fU, 0x349688f87d591394U, 0xc2193bc32e36894aU, 0xc1155197d301970U, 
+0x2d514966e25db0aeU, 0x9b3355bee6c3fd12U, 0x387801c37eaea589U, 0xd0a26e4203fde71U, 
+0x5f23953c71288f54U, 0x30b83a7ddc23c1f3U, 0x823045c3b81f0b75U, 0x1130de215e589bd1U, 
+0xce89b5edcba2cf1fU, 0xd0c571c0ad753fbaU, 0x6b971d2182431f12U, 0xbc48fc5642d953eU, 
+0xb4a75b7d9bcedd0bU, 0x6f712796afa8e17U, 0x573a7ac765e607e2U, 0x78eca22bb5f6e7U, 
+0x263ee5ac7d565f28U, 0x872192ebcdc0037dU, 0x8eed2a3b7b263c2U, 0xe518f3f04e26381U, 
+0xe216d39da648e6eU, 0xd1ff4d27ea32d3e9U, 0x74048b54214af131U, 0xdcb0d90c65f4532U, 
+0x1382e0c6ccafd44dU, 0x11f2daf79ee9d1d3U, 0xa1b896eca70661cdU, 0x3c5c90ae8be3884U, 
+0x738e3f2b49150752U, 0x398e8774b474255U, 0x82ea4b4c0259fc2cU, 0x6699909bdde6b89U, 
+0xcddeebd996d60304U, 0xa12337a87eac430aU, 0x1c12366b486742fcU, 0xe94b83422392ef6U, 
+0xea05753b69391d15U, 0xde59772dcbe9feabU, 0x3d01b9569be35fa9U, 0xa2c183565d4ab31U, 
+0x1e65a4543f454f91U, 0x1ed7f0d61eff807fU, 0x3a3c2a51bd2c17d2U, 0x10e34f2f8849e517U, 
+0xda12eb27a96ae15bU, 0xa9cb796ae79a3061U, 0x7e8509217f2c2770U, 0x16ba05493c36fffU, 
+0x28ef11352a9f480aU, 0xa81cf3b456c41db4U, 0xb0ece5295739dd54U, 0x275a28a24a32f8U, 
+0xb3297333066120fbU, 0x5902d16f64120fd0U, 0xcd34cf8ed4737b9bU, 0x84a6f97de276b78U, 
+0xf5e3197d9bff2432U, 0xbda50ac0d7ea9bc8U, 0x3ab5b3e6f4b4cd44U, 0xf5b71aa9fe939aU, 
+0x6c7923954002847dU, 0x8253b70d842d2c20U, 0x41fb91fb369b5142U, 0x10f1c0736af3708cU, 
+0xa6846444f4321d4dU, 0xa3228bc8927b54eU, 0x5b0b252d858f3deeU, 0x63cdd75dbf0345eU, 
+0xe6bc743fbf7f68afU, 0x7579ffc9d7ffb8a6U, 0xbd3c6d3c616e0659U, 0xd4f997516802b53U, 
+};
+
+static const unsigned char Generator_Table_Infinity_Flags_w256_001[] =
+{
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+
+};
+
+static const mp_limb_t Parameters_Test[] =
+{
+0x5U, 
+0x75bcd15U, 
+0x1U, 
+0x1U, 
+0x0U, 
+0x3U, 
+0x1U, 
+};
+
+static const mp_limb_t Generator_Table_Points_Test[] =
+{
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+0x0U, 
+0x4U, 
+0x3U, 
+0x4U, 
+0x0U, 
+0x0U, 
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+0x0U, 
+0x4U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x1U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x1U, 
+0x4U, 
+0x2U, 
+0x0U, 
+0x1U, 
+0x0U, 
+0x0U, 
+0x0U, 
+0x4U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x1U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x1U, 
+0x4U, 
+0x2U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x0U, 
+0x4U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x1U, 
+0x3U, 
+0x1U, 
+0x4U, 
+0x3U, 
+0x0U, 
+0x0U, 
+0x4U, 
+0x2U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x0U, 
+0x4U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x1U, 
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+0x0U, 
+0x4U, 
+0x3U, 
+0x4U, 
+0x0U, 
+0x0U, 
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+0x0U, 
+0x4U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x1U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x1U, 
+0x4U, 
+0x2U, 
+0x0U, 
+0x1U, 
+0x0U, 
+0x0U, 
+0x0U, 
+0x4U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x1U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x1U, 
+0x4U, 
+0x2U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x0U, 
+0x4U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x1U, 
+0x3U, 
+0x1U, 
+0x4U, 
+0x3U, 
+0x0U, 
+0x0U, 
+0x4U, 
+0x2U, 
+0x3U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x0U, 
+0x4U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x1U, 
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+0x0U, 
+0x4U, 
+0x3U, 
+0x4U, 
+0x0U, 
+0x0U, 
+0x3U, 
+0x1U, 
+0x0U, 
+0x1U, 
+0x2U, 
+0x4U, 
+0x4U, 
+0x2U, 
+0x4U, 
+0x3U, 
+0x2U, 
+0x1U, 
+};
+
+static const unsigned char Generator_Table_Infinity_Flags_Test[] =
+{
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1, 0, 0, 0, 0, 0, 0, 
+};
+
+static const mp_limb_t Parameters_P_256[] =
+{
+0xffffffffffffffffU, 0xffffffffU, 0x0U, 0xffffffff00000001U, 
+0xf3b9cac2fc632551U, 0xbce6faada7179e84U, 0xffffffffffffffffU, 0xffffffff00000000U, 
+0xfffffffffffffffcU, 0xffffffffU, 0x0U, 0xffffffff00000001U, 
+0x3bce3c3e27d2604bU, 0x651d06b0cc53b0f6U, 0xb3ebbd55769886bcU, 0x5ac635d8aa3a93e7U, 
+0x1U, 0x0U, 0x0U, 0x0U, 
+0xf4a13945d898c296U, 0x77037d812deb33a0U, 0xf8bce6e563a440f2U, 0x6b17d1f2e12c4247U, 
+0xcbb6406837bf51f5U, 0x2bce33576b315eceU, 0x8ee7eb4a7c0f9e16U, 0x4fe342e2fe1a7f9bU, 
+};
+
+static const mp_limb_t Generator_Table_Points_P_256[] =
+{
+0xf4a13945d898c296U, 0x77037d812deb33a0U, 0xf8bce6e563a440f2U, 0x6b17d1f2e12c4247U, 
+0xcbb6406837bf51f5U, 0x2bce33576b315eceU, 0x8ee7eb4a7c0f9e16U, 0x4fe342e2fe1a7f9bU, 
+0xa60b48fc47669978U, 0xc08969e277f21b35U, 0x8a52380304b51ac3U, 0x7cf27b188d034f7eU, 
+0x9e04b79d227873d1U, 0xba7dade63ce98229U, 0x293d9ac69f7430dbU, 0x7775510db8ed040U, 
+0xfb41661bc6e7fd6cU, 0xe6c6b721efada985U, 0xc8f7ef951d4bf165U, 0x5ecbe4d1a6330a44U, 
+0x9a79b127a27d5032U, 0xd82ab036384fb83dU, 0x374b06ce1a64a2ecU, 0x8734640c4998ff7eU, 
+0x509302446b030852U, 0x31fe2db785596efU, 0xa02dde659ee62bd0U, 0xe2534a3532d08fbbU, 
+0x5c42c23f184ed8c6U, 0x4efc96c3f30ee005U, 0x19dfee5fda862d76U, 0xe0f1575a4c633cc7U, 
+0x21554a0dc3d033edU, 0xef8c82fd1f5be524U, 0xd784c85608668fdfU, 0x51590b7a515140d2U, 
+0xd1d0bb44fda16da4U, 0xd012f00d4d80888U, 0x8ae1bf36bf8a7926U, 0xe0c17da8904a727dU, 
+0xc6b0aae93c2291a9U, 0x24c740debb215b4U, 0x92d3242cb897dde3U, 0xb01a172a76a4602cU, 
+0xfd7c48538fc77fe2U, 0x1c00f7701c7e16bdU, 0x6fec0e2dfba70379U, 0xe85c10743237dad5U, 
+0x300628703187b2a3U, 0x7ef9f8b8a80fef5bU, 0x25bb30667c01fb60U, 0x8e533b6fa0bf7b46U, 
+0xc55e1a86c1f400b4U, 0x53c73633cb041b21U, 0x6d069f83a6f59000U, 0x73eb1dbde0331836U, 
+0xb4dd9dc1db6fb393U, 0xc1d238980fce97dbU, 0x4042742d3ab54cadU, 0x62d9779dbee9b053U, 
+0xda540a6a0f09957eU, 0xa2ed51f6bbe76a78U, 0x4ff15d771167cee0U, 0xad5accbd91e9d824U, 
+0xd79e8a4b90949ee0U, 0x9e0acb8c2c6df8b3U, 0x878938d51d71f872U, 0xea68d7b6fedf0b71U, 
+0xe85a224a4dd048faU, 0x4d714feaa4de823fU, 0x87014a964a8ea0c8U, 0x2a2744c972c9fce7U, 
+0x4c36069404c5723fU, 0x45ca6c471c48306eU, 0x591214d1ea223fb5U, 0xcef66d6b2a3a993eU, 
+0xca34bbaa44af0773U, 0x590ded29fe751eeeU, 0x6e123cdd9d3b4c10U, 0x878662a229aaae90U, 
+0x433391d374bc21d1U, 0x16742ed0255048bfU, 0x638379db0c21cdaU, 0x3ed113b7883b4c59U, 
+0xe2f8eefce82a3740U, 0x90d04da5e9889daU, 0x24c843afa4f4c68aU, 0x9099209accc4c8a2U, 
+0xd500c5ee8624e3c4U, 0x79983028b2f82c99U, 0x4626537320e5d551U, 0x741dd5bda817d95eU, 
+0x1995ff22cd4481d3U, 0x8eeb912c35ba5ca7U, 0x567383554887b154U, 0x770b46a9c385fdcU, 
+0x98e15d9d46072c01U, 0x792e284b65ead58aU, 0x61805df2d85ee2fcU, 0x177c837ae0ac495aU, 
+0x9c43bbe2efc7bfd8U, 0x26ee14c3a1fb4df3U, 0xa24091adb40f4e72U, 0x63bb58cd4ebea558U, 
+0x5709277324d2920bU, 0xf126acbe7a069c5eU, 0x7a76647f4336df3cU, 0x54e77a001c3862b9U, 
+0x1ba7c82f60d0b375U, 0x7171ea7773509008U, 0x42121f8c05a2e7c3U, 0xf599f1bb29f43175U, 
+0x63668c63e59b9d5fU, 0xae03af92de3a0ef1U, 0xadfb378999888265U, 0xf0454dc6971abae7U, 
+0x47e59cde0d034f36U, 0x2a3b21ce75b5fa3fU, 0x4e6594e51f9643e6U, 0xb5b93ee3592e2d1fU, 
+0xa5eb4787e1277c6eU, 0xcd28392eff6ca038U, 0x8b821c629836315fU, 0x76a94d138a6b4185U, 
+0xe9ddd724b8c5110U, 0x8599a0040fc78baaU, 0x6cb0a1b5e11e8720U, 0xa985fe61341f260eU, 
+0xd1475bd52a7ed0e1U, 0xaa557fd5b68371d9U, 0x6c45074e8ea5beefU, 0x2377c7d690a242caU, 
+0xe7c067b1ddb8d2b2U, 0x6658a6cdecf46716U, 0x3f8d90e9bf901b7eU, 0x47a13fb98413a439U, 
+0xabfb9dc69e4536caU, 0x1c2e92960a201a61U, 0x8cce745be070cda1U, 0x9482fb0e492539ecU, 
+0x1fad863bf58cc1c8U, 0xf63d5e295707bfbbU, 0x1a5d638ca7534e63U, 0x351d9ca745f157f9U, 
+0xaa4110a6b90ee785U, 0x25b35edc7338d816U, 0xf67a6a5eb1bf8e91U, 0xa0643fb8fcc14deU, 
+0xbac0d100861f9cc2U, 0xda10d00e7012ed7U, 0xc520dacda2920e70U, 0x553438324a9e7955U, 
+0x49b1dae295ecff13U, 0x63764a1cdbd0633cU, 0x5b835a5153081eebU, 0xb2e1b7c17ae93119U, 
+0xa3ba4989b2187d44U, 0x87da1a9817dea2e6U, 0xf233a1a2aad758c3U, 0xe6c0441313a3ebccU, 
+0xad24cb7afc635a50U, 0xe512fcb2acbac2f4U, 0xd24451d361c37440U, 0x492003a35c8c3794U, 
+0xc9166b28b8188b9aU, 0x3c1bc670e0b2e049U, 0x4d832ff96bdc79a2U, 0x1f1569cfb333b4deU, 
+0x38bbb334eef87286U, 0x703e87dfc2309e4U, 0xcb34177dcbc6ee34U, 0xb433462e7f1b6bc2U, 
+0x7ac047f6841496d9U, 0x9dce20806a2cea4bU, 0x383f4e72c1692e6fU, 0xa0da54526ed2b5feU, 
+0x6a9e6235a674c4f6U, 0xc556dea678f85962U, 0xd7ce2f8eede4b762U, 0xae3f7dba0bde8b6aU, 
+0x1ee0553e711f4b53U, 0x7940500d085f8a5cU, 0x24b8c213249db9a9U, 0x1c0549fc0a69995aU, 
+0x1b986b5b19794381U, 0x189158875eb0c760U, 0xc186e905b5567b19U, 0xa47420ce4d3da24cU, 
+0x696ce3a7e2769c52U, 0xf3a5c08db9f6ac78U, 0xe73df93619967affU, 0x2ebbffdf7be1bfe0U, 
+0x551a403f2288ebe0U, 0x916eb1d24497c893U, 0x291ff705bf720876U, 0xd677ae721a5d60c9U, 
+0x31dac28500c4395U, 0x21882ae6ca10aa9dU, 0x72a8ceb0ded3dddfU, 0x509497a204ad2506U, 
+0xec74466489a5185aU, 0x5b870ac89f5e6f2bU, 0x5fecd4012b0da319U, 0x5ba7a19b9d09148U, 
+0x1543c88e01de3a4eU, 0x7606220bc905ae00U, 0xe467823e24e3d48eU, 0x30e0d2b5e82c1896U, 
+0xa3b73fb2efdba936U, 0xb9c7de5adefd7c62U, 0x71f2a56eaa14f436U, 0x366018516f5a5a22U, 
+0x8f3ae9d3626adcb1U, 0x4cf24008d15af99dU, 0x195d35b2e9a028caU, 0x91ec1aacf53ceb78U, 
+0x5aa398b5f99b85feU, 0x9c0efe9aae3a5dfdU, 0x69798d918083e0b7U, 0xb29f74c9d0dfe2fdU, 
+0xdba642976da604dcU, 0x2def63d30bf59e80U, 0xd5d0712e96d7c6d9U, 0xa3ce5bc3a6c29785U, 
+0xadfa3814eb04054dU, 0xa7dca6c6280cfa08U, 0xeb36dd90b05f92e7U, 0x78c6be72b982cc60U, 
+0xa729e7a30b0dfa2dU, 0xb6764277e0f8951U, 0x4b4d0c3c5cec2330U, 0x491ce81cbbaef847U, 
+0x2767456e87e030efU, 0x576b2b057cd50e96U, 0x76cbf03f2482b08U, 0x99299baa8b91bcf5U, 
+0x4d8e6b7dd8d9aa9aU, 0x57c12c499f400844U, 0xbf338101a6ceaa79U, 0x5cc2e3d3333f8e18U, 
+0x2db2e35f12d0441bU, 0x190d0b710d6a564cU, 0x87ffd1528603ed61U, 0x34a2d4a3b0091659U, 
+0xb424e7845e93b146U, 0xe7d766b9deddd81dU, 0x2bca71046e777fc0U, 0xbeaaed6a53a1e3c2U, 
+0x3469cea39f3f98deU, 0xa416b9ae0b3c5dfcU, 0xe8897bbd818d459aU, 0x4c490528be759e4U, 
+0xebd949434e8d6e96U, 0x471d9d7b4a4605eeU, 0xade84c66242a8107U, 0x30e50b46405cc74fU, 
+0xdce4ae33bda08424U, 0x3abfb7ab74f644a9U, 0x1b58c5ffa95d23edU, 0xa98b0a07adc359aaU, 
+0x361287a0e831800cU, 0x752be80ba0df582dU, 0xe5319e8c8e1d1320U, 0x4754c64722499b66U, 
+0x80e76bb98e61ca07U, 0xcdc5849ae1d527e2U, 0x897299b9eb6fe80cU, 0x16949b7287d4f481U, 
+0xa09c2be7a0420427U, 0x4d2d6ac6fedf983aU, 0xbdf997b75b601209U, 0xe7a4146d770ededeU, 
+0xb52d7e5e883c2d6aU, 0xd22f918d81bd29b3U, 0xd21b6b78c85a696dU, 0xa034f009c88daac5U, 
+0xf4336ef2c2c30e72U, 0xbe06035f16267e7cU, 0xb0cdb8545ceceb06U, 0xfe1b0036ca899c1fU, 
+0x6d61fdb48f6752cdU, 0xb71bdd3c3f3f923bU, 0xa8420fe520b265cbU, 0x3fb660a7f0e14da3U, 
+0x2f12e8c064c6017eU, 0x8bc013bd1100a0c1U, 0x4c2869c4d9577d59U, 0x6545851d4224637cU, 
+0x716a51dd28be8c78U, 0x4a096cf82b793e4dU, 0xa076e2b40962e9a1U, 0xb52226ff319d4401U, 
+0x203367ca51686903U, 0x819f7fc8e5b58ff3U, 0xca1b36697e92851aU, 0x701ee0c9f539f540U, 
+0xe1404a861abe45c0U, 0x281b195ff46f925aU, 0x886a8f4749b86176U, 0xb01a67f716475f72U, 
+0xc72f0dbe0090106cU, 0x72fc676341b62c7fU, 0xacd56b13164ef994U, 0x7c521bbf5a3956e2U, 
+0x7040fe40a058b5a4U, 0xde4464f87931979bU, 0xd968ceccfccc4713U, 0xa3e38861868e05b3U, 
+0x8f306d90e7113aefU, 0x3cee845bb771a294U, 0x3848e6b3ae97e68fU, 0xcfd457887df0d12cU, 
+0x17c2d788ebbe0146U, 0x637136eedbdbd882U, 0xb872c1d0e0ec1188U, 0x3acf89aa3770e03U, 
+0x243d71c1d38a0d8aU, 0xcaba4be850a0ae08U, 0xf06762038c11cc48U, 0x1ccedf94c3c6bd27U, 
+0xa05f5ec904a08314U, 0x82fe36db2dc7dff7U, 0x333ccab9a221197aU, 0x2099544a131fa539U, 
+0xe7f8c9c5e7573cccU, 0xd406e5a736fcfe96U, 0x90fba8e5cb9048dfU, 0xa5cf3dfd2aa33b18U, 
+0x8136da613fa8dc8fU, 0xfc7405cc6e1372f8U, 0xb7438645c660cb24U, 0x8ac1f41fb4e187e6U, 
+0x1d95f312d9509804U, 0x1db6fb884fbadd73U, 0xc1506fac6daf3cdfU, 0x2122b32472d8fce1U, 
+0x502ff94ae9078c18U, 0x99e0c3caeeede929U, 0x308f6e72aadfd39bU, 0x751d6513acc0ec70U, 
+0x998d6e95cece0d67U, 0xf00948c1cbe05ac7U, 0x85354baf6a2a2a4eU, 0xba9c3ffdca4a4158U, 
+0x1fe1767ff462ea0eU, 0x2e6b44d10140294U, 0x46d90525e450a1a7U, 0x7854e90d1144129eU, 
+0x3bf725275902544cU, 0xb7742ea17ef95b20U, 0x4a3004bbf427c03eU, 0xd6728e8d1f9513ffU, 
+0x92cfcd5c9e86d900U, 0x405ee09d17a3db44U, 0x17b48308a03a3b36U, 0x5be0f5225c478011U, 
+0xc4cdd69bf58a5755U, 0xf921725241b34f5aU, 0xd347e3a4e7b5423dU, 0x83d1d9e6dff2c422U, 
+0xf077e8daa245573fU, 0x508676f2f4fd0a64U, 0x997789672e6d6bd2U, 0xe716aed2cf069e4dU, 
+0x505fc26b469218d1U, 0xd13d0df2fa07c9b3U, 0x5912b06687b9a851U, 0x353663e694fc72abU, 
+0xb5113c2b357174b3U, 0x6b2e5d2fcec451f4U, 0x2f4541cf25b5e81bU, 0x5a57c3e3548207efU, 
+0x88cf5959383437e3U, 0x28886700134bb928U, 0x1b1165729f34433U, 0x77c7b303e692246U, 
+0x7f987930657008acU, 0x19ce1ecee329edfbU, 0x64e5558a4c1da22dU, 0xd2bf898d6f507ce8U, 
+0x8111534a727beb55U, 0x679ce10ab5ff0798U, 0x3f8195db3fa90c56U, 0x69c0b1cb5a6b77aaU, 
+0x8937f00facb006ffU, 0x1a87a974797e4fc5U, 0xd10920adecfb86adU, 0x5ce96505eef7208cU, 
+0x818dcda107152613U, 0x669d20bebd955c2bU, 0xec56d1f22fde7bc3U, 0xd16b6ebd381f5ad5U, 
+0xfd0d7ca9782f1580U, 0xb0e4ddee24203eb7U, 0x87fa57391f3064f8U, 0x4d88304ee583ce60U, 
+0xc0fb16d5616edd7U, 0xaafca3bd68eb1e11U, 0xe8d6800898fd6518U, 0x28a94e709ab0636cU, 
+0xa0c1c454c543d986U, 0x76754b6ebb642a20U, 0xb28aaa0aa37d9e16U, 0x541c97a5c80be642U, 
+0x7b0b8f98424b2ea7U, 0x7fb3ddc8c61678bdU, 0x54d48455eb64b144U, 0x54d35662cd2b632U, 
+0x5f84c3dae0c38e11U, 0x7156421bea6e26baU, 0x3267399202e5af9eU, 0x17c72727c8fc0eebU, 
+0xcd8366bbae90decdU, 0x7e539945a60cdae3U, 0x40602fcce901802eU, 0x95c5a4f4fe664b3cU, 
+0x15261b05d0b79fbcU, 0x63a5b8311d31a919U, 0x4b2a3a4635b10433U, 0x71a5bd27c625ca1bU, 
+0xc2e37ccc8f277f6bU, 0xc76b6051ebaa32d0U, 0xb39452ca1a02f2efU, 0xc5bf524d066741ffU, 
+0xd955fd8ae32f36eaU, 0xcd4f46a7293541c3U, 0x8463b1cfc84cb8b3U, 0x7e03fdaac47450a8U, 
+0x8acc23fc8a68b8afU, 0x419e979a4c5009d6U, 0x668e6b170184af99U, 0xdcf6d5f1201228daU, 
+0xc5e14bfa3d9aeeaU, 0x6c04351af9985153U, 0xf2017de615706416U, 0xed42091a6c5ea880U, 
+0x1a456364c16e9ae7U, 0x954ebdd1e2105392U, 0xe0d3092b508982c4U, 0x340932a238f9d141U, 
+0xd43e52a6d953baa9U, 0x2615ae8649e18de8U, 0x61637ac1dca0b214U, 0x8ce6da684b1bcf07U, 
+0x78e75c28f52689e5U, 0x7f3986bb6a9341dU, 0xe69b3bc90061b568U, 0x3d9f4fb8fa93120bU, 
+0x2bf3909a3f490661U, 0x7835611ce53cad64U, 0x87e87c9ceb75878U, 0x1f4179b924a320c8U, 
+0x2e477122b437b2e2U, 0xb971141104890217U, 0xd9485f70af853ca0U, 0x82ac86b413a8baa0U, 
+0x4ab8d853af22a96aU, 0x8b1ba9d9c6ab8f9U, 0x20a5354975bae2b0U, 0xb570e73040dc054aU, 
+0xcb33f661c85d1b00U, 0xa7c9bb7a5855cc9cU, 0x28c3769b5c0cfbdU, 0xdcd8a2638f71e77fU, 
+0x495ba2d5e264bd27U, 0xa5a1b3ba7ef715a6U, 0x94567b56a196e517U, 0xf8a34ad3387c6344U, 
+0xa7f3956ff71ac586U, 0xe528e13dbcf1fb0U, 0x7f6375adfe7d67a5U, 0x69ec806150467434U, 
+0x9e40eb94589a7509U, 0xe1270b9641fa8054U, 0x4a11a3e75c7f20dU, 0x44d94323cbab943bU, 
+0xe20a2b9b60437234U, 0x6f93e1fdf14dd126U, 0x3423bcd277b9358U, 0xb2c5b38008401f0aU, 
+0x3e8465c6eade3c4U, 0x714ab749c9052a05U, 0x8e5c643340e586b4U, 0xa018366f4e91e90dU, 
+0xf45c42026b26e8d0U, 0xd5f7284e44614f37U, 0x7c6ce578349d8369U, 0xe2bbec1714110b16U, 
+0xfebccee647a9112dU, 0xeb7d5adffe1ce3eeU, 0x9ea25487ea254c45U, 0xcd7ce65d707da2a6U, 
+0xffbabe0d3a92b3afU, 0xa190aa498bee60a5U, 0x89b9016aa5ee6708U, 0x85e04a4b4c966f97U, 
+0x6e1cdeac59e0af06U, 0x92f398a562ed958dU, 0x50bd3b5a6d45055cU, 0x9cdf1f00b88d8964U, 
+0x8d7a32db6216ade7U, 0x828522dc197ca546U, 0x4d958bbcdc8d94b0U, 0x916d25fed3f2ad66U, 
+0x6c88ad96c3212f1aU, 0xe8af0bc36c998befU, 0x8e67d4c73705ae59U, 0xf5f0aea09963471U, 
+0x755d7b1e7712b09aU, 0x4f5ed40dde29af7cU, 0x5886aadd4ba16b78U, 0xf8a8b2b7c8593c95U, 
+0x81372b939305097eU, 0x38d6170e843ba519U, 0xab6b1b2d05404483U, 0x45bfd9d5d1a663edU, 
+0x54ba058e908ddc04U, 0x683b9d33bfd2c159U, 0xbad88305470ce908U, 0x9d1dc12855afd2bU, 
+0x349acd95bcc47U, 0xb0e2d44b1a7f80efU, 0x3407fae48fa79a96U, 0x7784f06cf9bfb400U, 
+0x2fbde0180fbb3b4U, 0xf464b5cdd4f6ffb6U, 0x3f8de493b2fee6ceU, 0xcca2733ec3edc43aU, 
+0xcd31f1a0b63bd6dfU, 0xd1fc23c2dd66aec3U, 0x671e9f9c02895e6fU, 0xb599ad156476693bU, 
+0x8ea1cea38efa09acU, 0x6a40c4f691134b45U, 0x4637360b8b23c416U, 0x6979d1dec4fab332U, 
+0x2435158cfc4471bbU, 0x91428bf4e1e6e917U, 0xf15f0d870ae25c90U, 0x471ad0a8d57f5939U, 
+0x454318fa49693a0cU, 0xb0d7e9ff7f23982cU, 0x2a367ab48094d138U, 0x2234ca62778e8e39U, 
+0xaf8613f327142d62U, 0x1d9a6a35f83bc26dU, 0x92662b1227e854c1U, 0xf4dca1f16732ac0eU, 
+0xac9eccc07a618fc9U, 0xbb979acefdcd3d7fU, 0xd49f381b91abc659U, 0x551167e5b4b4cd46U, 
+0xa92c68146c180378U, 0xb3040ebdf3523741U, 0x49d201427daf6500U, 0x45dc683e625bae73U, 
+0x42a66ea68e817a27U, 0xd04ced33a08df786U, 0xc89beaac3e588137U, 0xbd0197242631880fU, 
+0x1ecb1ff4615fae61U, 0x7f15c7dc4f395f82U, 0xd9c4e240e716bb5aU, 0xf07278a0e6e09b66U, 
+0xf7d0cb74896376f9U, 0x2c270715b837eabcU, 0xf7d7a0821898f7d4U, 0x1a681b2b14a71ea5U, 
+0x2e06dae905566022U, 0xa2d3e61463d4dfffU, 0x7405e146be83337fU, 0x93e498f09e88d0d6U, 
+0xb1cb31eec7c53f91U, 0x3b27a24bc689e611U, 0x9096e0f3540088f4U, 0x7d974929d221120dU, 
+0xc4e04152466591fU, 0xbe172ea8ffc68d6aU, 0xf143ab533ba858ccU, 0x1fc52457af0a0db0U, 
+0x44efef57396f8cdbU, 0x29f8cac232ec7822U, 0xe9ec76fe5b434e16U, 0x489c1838089ebc11U, 
+0x5ea48f58173b4df8U, 0x1df4170c442d4d0aU, 0xcc34630510b36f5dU, 0xed9ea11f2d7b0206U, 
+0xcf5afd9ce069ce7bU, 0x52acbb37e2ce6a55U, 0x3d0e3d4c3f02b537U, 0x175d2f8031d02978U, 
+0x125d0b8c322a8ebcU, 0xa291cdb718f96715U, 0xfd7f0b5b30ca56d5U, 0xfa2501b31a48c5f4U, 
+0x80d927b5aa8a775bU, 0xea58e08e6cbc8331U, 0x33851e661a6fa8cbU, 0x71c932b14f858962U, 
+0x8f7dcecb7d96dff1U, 0x30e431c1aad5fcfeU, 0xfef6a0b570cd98d5U, 0xec73885141fe54fU, 
+0x9ec841ac7c7b552cU, 0x1d5264ce87ed78aaU, 0x91acc4ef58065251U, 0xd6224f4e87ae875dU, 
+0xb183b5399660b7c9U, 0x9ba12b3112fb6dcfU, 0x59a0e2532c8f0c6U, 0x477778364e6e1cdeU, 
+0x5c205fa39918c3dfU, 0x5e0604c1f142ebcfU, 0x7373efb6a7c89e8aU, 0x2dd89d00b8389e31U, 
+0x51c324ab088d58e9U, 0xe94a5c1c64e31838U, 0xe992a46a7c42a7b6U, 0x96dac3fdc7064a86U, 
+0x80349312aebebc5eU, 0x685be89b9487e6e3U, 0x856cc4949382c439U, 0xcb1faff3ad46c1adU, 
+0xfd8013b26d69d8eU, 0x2ec38faf35f45d26U, 0xc73d989017e14dd2U, 0x353d458d3491b5a8U, 
+0x842b9d0020f32b82U, 0x825dfc12fb71a9a8U, 0x3130fde40c040a8aU, 0x9c7d37bf4f5bde24U, 
+0x8952ad132db29f92U, 0x1d21d271b947b2c5U, 0xa105dc378aeb8f81U, 0xe297b23ceb14f312U, 
+0x60f294c8a5e58ddbU, 0x1223cebb85ed4141U, 0xb480dbabb8cd9149U, 0xe1372520f8cb70b4U, 
+0x3f4dacc55b5e6a6cU, 0x86679fdea1d8de80U, 0x3171bdb6d33f07e5U, 0xa737bb3da35a3b5eU, 
+0xb730c7d69054745dU, 0xd4e7d487692ed0aU, 0x2b1e765d8e905f15U, 0xc68f53e01f98ffd2U, 
+0xfd943b7b8ad88c33U, 0xd91ae394d9746bcaU, 0x6b06bc920d24da97U, 0x1cd22338fb2b94b6U, 
+0x628ea784248fb1b2U, 0x13fe51315eca1e49U, 0x96c8640ab136bc27U, 0xfc3acdf838ab48b0U, 
+0xaf0d4e79e330c098U, 0x28e6bf035dc617ccU, 0xd57180ff0b1ba76eU, 0xddad6bf0172e2240U, 
+0x3e5a994d63b67b58U, 0xfa333bad2db9d140U, 0x7530a4736125addaU, 0xb1371e6935a2189U, 
+0xf53ac89c3b26aa73U, 0xcdf7e11b0c63a0e0U, 0xcb1cad30dffb1ee0U, 0xf462d7adb9e9fbbfU, 
+0x245eac1778479e73U, 0x49e8e0a300502ccaU, 0xd53ba4a68733c7aU, 0x406a0d1a78345314U, 
+0xf58bebae5b2e97ccU, 0x89ef670c852039cdU, 0x1d6f05da10f6cd68U, 0x22ad3fee717113b9U, 
+0xc2d34ede848b42a0U, 0xe03640043cb4cd37U, 0xd0a598db6a4dcc1dU, 0xbce4ec07b05351a2U, 
+0x3ee1e02abcd015e3U, 0xaf90e9597e650227U, 0x75bdbeb3ca895168U, 0xe0f68925d3f70cafU, 
+0xdaa24d42d2157cceU, 0x55b8b5391e2936bbU, 0x5362696c7274c77cU, 0x8531e310e483aa9U, 
+0x2082b63685ce7562U, 0x7c8ded40b882a851U, 0x5364f7c14bcc66e2U, 0xf6c5ef5db04ed3abU, 
+0x747f96b177eddb3U, 0x51ed33cad490a6f0U, 0xc5a533360dba5118U, 0x4149117a17145d88U, 
+0x1e6c43114bb76b12U, 0xea8e76773e192769U, 0xc1d82b312af75a00U, 0x28e4adc1552bf57fU, 
+0x57e453a7ec4747bdU, 0x3a0a60f171628ffU, 0xf4e4b65b6b9ea3f7U, 0x14d74c4efd9a01b3U, 
+0xafae5fba343040c6U, 0x20d07018ea77661eU, 0xc78446b476dd149eU, 0xdf30ef720fcfe8d0U, 
+0x2f3560036ca02b72U, 0x43cb0cf4429c03bcU, 0x9278a77d903449dU, 0x18e1aebf6d6dbb45U, 
+0x8bf5801fe76ff697U, 0x369b688652076462U, 0xd271edabb3a097c6U, 0x85a0ba2794ba805eU, 
+0x309ed4da52142721U, 0x1de97ffa790a58b9U, 0x554790d3dcedaa55U, 0xadf32e61eac3e24aU, 
+0x3725c5dce392d805U, 0xa87a8069875405d4U, 0xa4a54daafaa3449aU, 0xf8f5dccf4c6a93d7U, 
+0x26619516cda02faU, 0x51f3da64a52143baU, 0x389d3e3364613273U, 0xe58176cf66d63054U, 
+0xaca7f0b2ac51d8a6U, 0xfd42d88478182a90U, 0x9b317fe248af581fU, 0xa118b0f24bc45d9cU, 
+0x8621b55d5c87b030U, 0x81922408e376967dU, 0xdf7b25ae09464d6aU, 0x698b53fd0f7e1798U, 
+0x19d4b3167fa046f7U, 0x17110f390207309dU, 0x4e084ac8946e2d45U, 0xe12c8e4a865883a9U, 
+0x53a55a28a12646adU, 0xdd0c04e113311934U, 0x433b3ed5393126f6U, 0x7cec04610fd9a2f3U, 
+0xfa42e8729cf5250eU, 0x7bd24be788828675U, 0xde9ec29566d715eaU, 0xfcc8ca2e4e502d2eU, 
+0x602e0fbf730fd4a2U, 0x9046bc05c03b2120U, 0xf6b9880a8b34da5cU, 0x30b57bcceef8bd04U, 
+0xb9b127e8c2853c43U, 0x48166c57ae22e466U, 0x3d08e2efe3d13236U, 0x394bd47417969209U, 
+0xb17828cca064469dU, 0xd52f6712d90fcf0cU, 0x207e3fc2f1d60767U, 0x2b4d6d52151dc6b9U, 
+0x18da08ba74cb5cbfU, 0x1f177e3abc30f120U, 0x26a78cadbc7ed64eU, 0x81341ae328b19095U, 
+0x461726673e856d6fU, 0x80babdc773bc3358U, 0xdd25cfe06cf0349U, 0xf2a47728b2deb5f4U, 
+0xec2dd739fc722e94U, 0x4ed810396d058961U, 0x445c6656c5940433U, 0xca8538df38de82e9U, 
+0x3a0a62df1049a527U, 0xf20953a8a48b26a4U, 0x11e73126a1fb9f12U, 0x3b27fc42eb9e05c3U, 
+0x2318aa0489a95e03U, 0xf349f675d2af3c3dU, 0xee9a4b43cf2e4e3aU, 0x24bbe05bfa35ddc0U, 
+0x87df45ed8d793c4dU, 0xd40aa52e375aa149U, 0x17182d4dd2760faaU, 0xd49405ee090a22cfU, 
+0x87174629dcad6309U, 0xd31a1fc2f239ff48U, 0xa1bb74624ca67b3dU, 0x663e1a59f2357b75U, 
+0x53286ba389981f28U, 0xb907d44402eb52bdU, 0xc102c183cb1cf918U, 0x292fb73b8066a8c3U, 
+0x70d45a4ded4d335fU, 0xf2accb5f8a3edd13U, 0xaaf94227eac9c482U, 0x46e22fdc70432f68U, 
+0xab8aa54c61bdb9a8U, 0x9cb893a34c6225eaU, 0xd59f4b2940a2aeb3U, 0x1e1f378d8436fbb7U, 
+0x9275b24522c23d03U, 0x3ba1b04d8fc7ff24U, 0x96c36c23707beeabU, 0xa2d9efe730636670U, 
+0x102e4c04f085db74U, 0xea09a7e95839df45U, 0x15530436c7101b92U, 0x1cc85228cc841b8fU, 
+0xfa22eb9ba08eaf08U, 0x6df610b42ae2c020U, 0xeb76c8e73d40e0dfU, 0x86f0d61c0c8a0982U, 
+0xdd71fbaa13a0c1a2U, 0x14a0c650cc021492U, 0x3104df1399953635U, 0x3059e9c7572fb0fU, 
+0x1755f96707d4c6d1U, 0xf662cd519ad9fffbU, 0xe0b910b5273f35d0U, 0x5657e12b48b1a9efU, 
+0x88303f298106bdecU, 0xbff9a35a1452c141U, 0xacfb390f33ae6a0aU, 0x72b5bef4b8dd49f9U, 
+0xbfc50fbbf32d296eU, 0x59d03d9ae280de5cU, 0x1a257a892c9ec527U, 0x5e378784112a2a52U, 
+0x491eff584e42294dU, 0x4c9118ef208fde89U, 0x4fcdeb66d5b8ad3eU, 0xa559d906505d0e67U, 
+0xf8654dd55933564aU, 0x7a68b4faede3af44U, 0x864edc6676d8d2bU, 0x5b686215d40ae001U, 
+0x3b5f04588204ef63U, 0x392aee228878869fU, 0x52d30c54d19d95deU, 0x76b5ea69cf3a2645U, 
+0x984a23176f922dbdU, 0x1ca631161f99218fU, 0x3f85eaad8e4d71b9U, 0x6d28b6bffd4daf31U, 
+0x44abff02a0ef3cffU, 0x4c24e9f0b84da299U, 0x40fbe1a61ccb4a1cU, 0xaf39d905141dd2faU, 
+0x9789404fc4fb240aU, 0x50ea585cafb75250U, 0xe613947f2d302f2fU, 0xd131e661dd93d815U, 
+0x22f60e1402501a57U, 0x7423d4ebcdeacdf4U, 0xe79b4c37f48f4fd4U, 0x34342c8461a95da2U, 
+0xb590dff99b168b64U, 0xa153d02ac586c840U, 0xd3df0905fc14467eU, 0x7cd3157a7fbfe3ddU, 
+0x856c0d2b5abbb16bU, 0x13ac4d9b72e02e35U, 0x20568e78bcdbfafbU, 0x9ca08d2117292c62U, 
+0x67e5fdd7b8087ddeU, 0xd0434584477fe2e8U, 0x712e02810be246a2U, 0xafff5af92c807615U, 
+0x178346acd44eb3a2U, 0xaacf175292ddabe7U, 0x99a747ee10a2a22U, 0x659f6ea22cd060c2U, 
+0xb2b1c6fa06ef29e8U, 0x64dc554b09d9aee3U, 0x56b243199d453562U, 0xed860bdb5f2df8c4U, 
+0x501a1c49b9b90f8fU, 0xe7630f5c2d8daa33U, 0x7c6bf6b340417bb1U, 0xb837e74375d5a7fdU, 
+0x3d8ef9236dbf52e9U, 0xc01974d056f6f88fU, 0x6a65739b8b079177U, 0x3e65fb3b08594f3aU, 
+0x3a52541ec710d348U, 0x600d56d126aebb43U, 0x10bea6890cf95987U, 0xe79bb6600ef807c0U, 
+0x9df918b3f636e617U, 0x47dcd03bc1f1cf59U, 0x735e1c2e7e272c9dU, 0x6868cc8fd1d21243U, 
+0x1c8ddcf3fcbb3d27U, 0x60fe30c8a4384cd7U, 0xb3c5903879313f0aU, 0xeed008a5b91bf9e6U, 
+0x99fb69a100371f53U, 0xe89dfdb368bc6669U, 0x5b8000a73853a82U, 0x8437a7cab8f3e67cU, 
+0x248872d7879cbbabU, 0x10e124fedbfbe259U, 0x735483f43819bb8eU, 0x968fd75882812a40U, 
+0xc79da2a6113e2a34U, 0x291d2e65ce3a11e2U, 0x2c5cb49f10afd318U, 0xec03b360eac8fe20U, 
+0xa42243eeb84566d6U, 0x8aa8156e65a136b7U, 0x7befde2101212272U, 0x86020ffb60a05843U, 
+0x20409a178519526bU, 0x133a579d37d4dd4fU, 0x4c7b1de8989eb9e6U, 0x15f2cf68579ca9d4U, 
+0x355e35bb66d83fc1U, 0x2669bcf4f324b2adU, 0xe46819ddc47d4d7eU, 0x21a51e5bd1986a77U, 
+0x5eae0ce5c87c1b18U, 0x101e2cb5484991a2U, 0xe6a3035a591056faU, 0xa79464a39e78b90dU, 
+0xbeb585097b94809aU, 0xd98de9c71562821U, 0x249a57879e9a89f6U, 0x1361f4e3f72858ccU, 
+0xb510cae477159a25U, 0x1f456b063da3e65bU, 0xf5f7b88e7e1bda6eU, 0x701a78dd6546551U, 
+0xa843a51fbfcdba3U, 0x55fe9158099dce97U, 0x19eda0a206beaa8eU, 0x8bd65e64e6b94200U, 
+0x594e28c6ded10d26U, 0x5a9abef829e595f6U, 0x90e91fb694f30cccU, 0x544ef280aa8fbcc7U, 
+0x2fc24f7276dafcc2U, 0x683d6f976e2c06aeU, 0x9d6b1dfe8d8d70d3U, 0x95b91c9dc45ac2ceU, 
+0x812686c1afc59084U, 0xc4c4acca4b1f3c5aU, 0x778469ac0cdc7f64U, 0x8c259414e492ea1cU, 
+0xc8236db59f30f7c3U, 0xeb03a88b88f09232U, 0x916b4f0997ecad5cU, 0x6e162f4d40b152e6U, 
+0x249479f8b7ad18e6U, 0x57ad3e798d3cad5eU, 0x4de53c846b4aff9bU, 0xe2c26c885f34c621U, 
+0xadafe51aa554cfadU, 0x3bc515ca71981de4U, 0x51ce266ea117ba11U, 0xb2121b284f488188U, 
+0x3a5a9e22185a5943U, 0x1ab919365c65dfb6U, 0x21656b32262c71daU, 0x7fe36b40af22af89U, 
+0xd50d152c699ca101U, 0x74b3d5867b8af212U, 0x9f09f40407dca6f1U, 0xe697d45825b63624U, 
+0x336dd1e7c68278c2U, 0xa1dd10b8a60e47c0U, 0x6554caa343adfa5aU, 0x6177947147864343U, 
+0x9d03ecb2efabd2cfU, 0x327969992317a1a6U, 0x3bff005c8986473U, 0x4ecee7d5a568791fU, 
+0x76a78091df0922a8U, 0x8e90e9d2545cf8d9U, 0x80924e56022f8b80U, 0x4b656a405b4e2d73U, 
+0x4dadcac5999a80bbU, 0xd473b9e2b9850f69U, 0x20d04cc255d8c4d6U, 0xee1ea31d12e77839U, 
+0xaeab93965a7d9344U, 0xf7221aba0101b56bU, 0x193d8758abf96019U, 0x521cf0cd89729d1aU, 
+0x4529f28196b7064aU, 0x7a1341ca5a95fba1U, 0xc583fe0ed386371bU, 0xd60220dacbf9e9baU, 
+0xb504f88869d07e9eU, 0xa09e7ca1f6a60c36U, 0x93db2be0fb3d8e5eU, 0x9d78956ebd65e13dU, 
+0xf4dd615ac3d8c8eeU, 0x7460a2da3b94c7b2U, 0x6542a89c1d3210ceU, 0xd5149e6ef48ea8cdU, 
+0xbb430cf33b281418U, 0x7ce5019bb0000e35U, 0x4d56c2613639e706U, 0x7c86b3ad8863a8ddU, 
+0x79dd3eed3117e0ecU, 0x82ea7c317bc0861bU, 0x4c62b97768daa72fU, 0xd958bacceebefe95U, 
+0x667750867dc4950fU, 0x5741b2adbd394207U, 0x57236846e4db6316U, 0x4acb1272e1353fa9U, 
+0x66c6e44463d8b4dfU, 0xdf9e4280b5866ac5U, 0x8cf298f6cc71e29fU, 0x726cd20fb743cdadU, 
+0xb3184a32b3fce8cU, 0xbd4bbdec1543d1a7U, 0x562fc9efce42700bU, 0x176c11c1328ed07bU, 
+0x6ea68436a3c9f19fU, 0x5c5d842a5bb51ab1U, 0x89592180b7de3b7eU, 0xd17f8dae934b8a35U, 
+0xf40c7a7bed7e8cbdU, 0x2a667f8af007d816U, 0x234453550c81464aU, 0x640c5ebf1a6b17b4U, 
+0x6e2903cbec5a5dbU, 0xba069fb18cff9b02U, 0x2ae9c6eb701eab9eU, 0xd6ae88fd829cfd2fU, 
+0x63ae2b005e57d10dU, 0xaf42e93b573fe788U, 0x9d378b7cf26b9d2U, 0x493471abc939487bU, 
+0x83259603c6056dbeU, 0xbdadd5ec623364edU, 0xe96c54f99a845accU, 0x60d9691165077effU, 
+0xf70a04b07e86bddcU, 0xf1d26b97975ce3d5U, 0x451562c90ddb6b9bU, 0x8bba04b1b4284b32U, 
+0x5223c5a1e9e349c4U, 0xc6acfde4f4196e5fU, 0x659bf9216699437aU, 0xc34099c09c208ebfU, 
+0x5dd2c18196a081e1U, 0x482c9028d974a0efU, 0xfc1c48cf4a13975eU, 0x7085b59c1c09e312U, 
+0x914adea64659f1ecU, 0x4e9f136375066381U, 0x3cc6b741515810a6U, 0x55a062a24931eecbU, 
+0xd170e7804257f582U, 0x1f9909eadec3a258U, 0x10a6943f7c5a5fe4U, 0x8b0a5744fecd37e2U, 
+0x4817fedf37372d4bU, 0x56db46ba7b160766U, 0x662a15a137e37d46U, 0x9e57a44ec0d6c739U, 
+0xd1d41eca113fb3bbU, 0xc52fbe5033f758e6U, 0xd8ec684abbea778fU, 0x526fd9e3e7b79dd1U, 
+0x8b72d1cf470b5e0eU, 0x2622644c6800f600U, 0xa0fce55430c0a98fU, 0xcb3d9fdbe104383aU, 
+0x3f1449f9985e797eU, 0xf06e224f2e3c3168U, 0x1f856f493d9678a6U, 0xa13ff97c2647897U, 
+0x8327ab9f539d666fU, 0xf27f6f0a7580c392U, 0x917d818e8fa1dc3fU, 0xeb1a964b225c83d5U, 
+0x7aff4fe1fdde3445U, 0x76bba9dda2aea781U, 0x85371fe7ff26519eU, 0x6965b6384d7061e6U, 
+0x7cc4389e18855113U, 0xf47ce6051a5f99d9U, 0x325e496638732dbeU, 0xd1bcdae39c482511U, 
+0x375c0c6edee30eeU, 0x48526336679189f1U, 0x9ba834fcb1840971U, 0x9ba1e12f974ac9f3U, 
+0x8a96b83b67b43c5eU, 0x62067ebb8c7d4f38U, 0x277c3eea86a877beU, 0x3d2f132311bea6cU, 
+0xf5e40f96888acfc5U, 0xb1ef589b36689789U, 0x27e7ddbd4091a71U, 0xe1cbc51dde75c7daU, 
+0x3bc5fed5a249a225U, 0xe7d3292beebfba52U, 0xb312764ffdb9e23cU, 0xec678397cde7daedU, 
+0x8afbc67f51c57125U, 0x5a1658f6d17c5b10U, 0x485b544d9567e863U, 0xc90ea1fbe9020055U, 
+0xc669a504defb8d94U, 0xb6a3d07d6de19a69U, 0x19667af636e660b1U, 0x5aca66c710ede6bU, 
+0x758ea53fe107ccc6U, 0x1d3897e1543c8228U, 0x731e9d2845a90048U, 0x9c3f267971138aa1U, 
+0x840794cd3dea9152U, 0x51a8fd4e95f9b186U, 0x8be375f4bf3e6ecaU, 0xdaee0c1b64b51d9cU, 
+0x61067df977fc555dU, 0xd1df6426ed18d433U, 0xaa47106437dc1824U, 0x67a51d096d01cb39U, 
+0x5d9ac5946c12c1d7U, 0x4363755443132b3eU, 0xe175487a3fa794f2U, 0xc1095aea14bf7be0U, 
+0x21c5eb4395a449e7U, 0x2fa2a034e53c2be4U, 0x796fac17b140922bU, 0x5c30d9577c6b2d72U, 
+0x770ea481ae2677d0U, 0xb75e4053c3ce790eU, 0x164b65f799c592d0U, 0x8025e3b5b08e1b92U, 
+0xc1bf1f2dab3cd7feU, 0x9cf25089f822df8fU, 0x3d3a1bb4a48c105bU, 0xa88b8f77c896230U, 
+0x6a3bd234f1661fd1U, 0xc491c0994d7154cU, 0x1d4d29d246caa990U, 0x15b63b6905525ac2U, 
+0xfa558c028b8ceb07U, 0x5379252bffee271cU, 0xafe4e2b07ea8d995U, 0xaa3bbf230c8e9682U, 
+0x99a8462e9fd83984U, 0x3b71b2bc7ab3f9ebU, 0x44dcb0fe4c9162ecU, 0xe6320cb09c1ec268U, 
+0xc35c99281f9d5429U, 0x7d4a5cc6a003762fU, 0xbafaf9cb5d606ff2U, 0x34233278994634fdU, 
+0xdfda0ad8402e2826U, 0x68094c6b36d9d8f0U, 0xd34b5dc46e068d45U, 0xa3258285f3856a65U, 
+0xe40ea55583bfd1f1U, 0x3a36dc3515d65732U, 0x79e60fc991400194U, 0xab4a325113334181U, 
+0x21139610c8e1c233U, 0xa57d9324279e98cfU, 0xb4eb3bd0412fe057U, 0xea6c64bb036c8668U, 
+0x9277d1148a50a1e1U, 0x164b7ea9c4a0cd28U, 0x6cac5fae0ffae1b1U, 0xbd58add042642ec7U, 
+0xfdf7accb06773780U, 0xc5c046287663ec57U, 0xc6f41fba2b27ab6bU, 0x8ad1183e2ea2fbc1U, 
+0x8406d780b1d6d3fU, 0x5f37668a4eeebb89U, 0xf7337f5cd8a5a810U, 0xdba9b259dded5d77U, 
+0xc42e928289cd8133U, 0x48bd9bc4512bd93cU, 0x5aca994f4feb8714U, 0xb3862d3f57535b7bU, 
+0x2c12b388701f3de8U, 0xcd3c187faac904dU, 0xe53a635b6cbcd930U, 0xed3588338031f0a4U, 
+0x5f4e485f7266ebe3U, 0x98eee3ec1ac407d8U, 0x3fb6cbbf1554b67dU, 0x87fe94dc7deeab86U, 
+0x679a038031fa2a6aU, 0x34fc1d585b0e4b25U, 0x7add742b1a3cdfeU, 0x1998f4c42e982745U, 
+0x607edb4bc6415142U, 0x4c6c02387b7258b5U, 0x9700f8008b78a1e9U, 0x2ebb416d190afa10U, 
+0x258fca6c4d9aefbdU, 0x1efe47b273b95775U, 0x32ca9f0d41bc43dcU, 0xfbc341c8c669d76U, 
+0xed3b6ea9d3e71ca0U, 0x950b069e200a9ff1U, 0xe4014b1d4957d3d3U, 0xbd8022632f360e3fU, 
+0xf3a6db8a73e44b54U, 0x54dbeefa7c1e27f7U, 0x2dcb6c352620546cU, 0x829019319d8f776aU, 
+0x6803f5e4fe5fe6acU, 0x9f47a0a101135484U, 0x65888d6eac1dd9a0U, 0xe6a26e713ea8fa1dU, 
+0x8796dffee9434837U, 0xadb3140b8620c1bbU, 0xb1341c6ffb4fb06dU, 0xd76d18abc4a87aedU, 
+0x4faa04f9bb215b4cU, 0x90a458e775b7ccc2U, 0xde0e4214f7ab9332U, 0xf6bc4da32ed96644U, 
+0xa5e743ceea394a20U, 0xb41ca518e198a281U, 0x444cd57db517ac92U, 0xc48dbfa12299cf2aU, 
+0x4a0580dbea77a75bU, 0x9440b125991bb5e2U, 0x64ff2e411bdbd6cdU, 0xbc83cba00e1380baU, 
+0x2e89f219c07f222U, 0xc5e21c63ac60fe7dU, 0x4f481d1a1f1753d1U, 0xd5c0c6506167ff60U, 
+0xe2ef691e0c6ffd57U, 0xbaf3f51a78813a86U, 0xcde0c77f49f75b9U, 0x15a30b860817b885U, 
+0x5bb8cbe596a178d4U, 0x2233bc4ff408a8efU, 0x4439015b8bce969cU, 0x1b71b816fcb52791U, 
+0x4a2d7ebbb5507f51U, 0xe0e5b6c1f6cc1171U, 0xde6ef1c28d738fc0U, 0x7e659d1da48a8e2cU, 
+0x4a4716a24e93bfa6U, 0xd39d295a09a1362aU, 0xe549cba66b4c9fe0U, 0x734c364e4a46f62cU, 
+0xfc6fa79998d10774U, 0xeca13620890297c4U, 0x9de981e3520c5f48U, 0x9951503aaa79d04U, 
+0xcd013f88b049e7cdU, 0xe8f9257ae57fdc00U, 0x3be71969fc3a9301U, 0x987f256d58cff937U, 
+0xb7254bbc6efa35d6U, 0x47b4605207aaffdbU, 0xe860ebd60007e39eU, 0x8e92695694ec505cU, 
+0xf0eb517f5fa194aeU, 0x640291d9a054aecU, 0x1175d9d2a9eb149U, 0x79a3d9da07b66a89U, 
+0x4fc65e9c9fcf634bU, 0x6bd425f32f79bc4dU, 0x4b3671b858af03d8U, 0x84e1dbca7254b1b3U, 
+0xd66ec4e5390ccfa9U, 0xc41860a21b4b3b74U, 0x2f50838a4e371875U, 0xa72cb8e993ec35deU, 
+0x22fbe345af0fd4a3U, 0xf1a4c6edbdd2bb28U, 0x7b5b7066fc5d44b9U, 0x91a660e391681a4cU, 
+0x6ac9060021e8b7feU, 0x5dd0e2e17785b26aU, 0x8a3e4caadcfc98e0U, 0x3393fd094d5b0582U, 
+0xc142442023c6821U, 0x8e56b30a8a9b94b7U, 0x2eafeaed9c5a668dU, 0x130437bec867beb8U, 
+0xa5db33fc75f4ddfU, 0xe955273186ec58f7U, 0x8507a52f4805eb98U, 0x41db43d818f963fbU, 
+0x285c41fbb53425b3U, 0xd53db5d79f7f2e31U, 0xdd2ec30777538b8fU, 0x4210da1ad0865781U, 
+0xa09579d561528cf6U, 0xe6a0250af650694eU, 0x5e1b4586ee5b0a52U, 0xa16b2886134627e1U, 
+0x80b920f9fce93f3bU, 0x3493fbc813cc8013U, 0x913ced79d81150f4U, 0xf40598ae8537ad99U, 
+0xb81dbe564d20d1b2U, 0x2e47dd806702f9f8U, 0x7f9e7be17e483448U, 0xaf7e078e17f3e1d4U, 
+0x7230ae89764cc6b3U, 0xe6600a25c7a08da4U, 0xa62ddbae81b2497eU, 0xd8bd0f435b22b2bfU, 
+0x3510a66b8c8db2e0U, 0x473cbdc15f0d7358U, 0xbf6c89aba95a74f6U, 0xd317ce2018e3474cU, 
+0xa5b34a2b274bc9a9U, 0xcaa274d022b860f3U, 0x99c2c3e8e3979136U, 0xd61a210a9093844bU, 
+0xc6e3197aa3fe67b2U, 0x34a8bfe70a2e3338U, 0xbc666b9ba97323b2U, 0x6608c243773c85dcU, 
+0x1923fe5ce5b47a28U, 0xc22b159f40c54308U, 0x846f640da746e03fU, 0xa1a916bec521c168U, 
+0x5fc1209b0378bc7fU, 0x58bc6e018be06286U, 0x9979bc856e976e53U, 0x70c1fd6918000aa9U, 
+0x6d68171ca6aeb856U, 0xf5a9f32f61e1cb0dU, 0xaaedf6f122428543U, 0xf7daabc20d5bc522U, 
+0x13e6eaad2bc73e02U, 0x8496614eeb65312cU, 0x206a98117d578631U, 0xf0956ae2a6c5dc23U, 
+0x2d2cf6998611219dU, 0x672d048dbbae9457U, 0x76e2058af2839356U, 0x433fe6601144e03cU, 
+0xbc63b9f4e77e03c2U, 0xfe32c900bfb0192cU, 0xc0733fdeacec50aaU, 0x30ac8e52250d76b2U, 
+0xa11914fed1dc3f83U, 0x6704ba32cd8786dcU, 0x69aa6584002e77a0U, 0xd694b530c099785eU, 
+0x7de22de51c5fe45cU, 0x88b281a8387c0f59U, 0xa52f249d7cf72834U, 0xdb98ebea3ca2a60cU, 
+0x44a701c43ef45a22U, 0xe983204faa480e1cU, 0xde15129dd8912c8cU, 0xe0c0f30b75bd85a2U, 
+0xcba43acb80c6c0bcU, 0x4d9f8d7283df687fU, 0x785a855ff7c71008U, 0xb92902a077e8e4cU, 
+0xd088e9d8baf5dd22U, 0x4785ee3d92ed23cU, 0xd6e697a2d161e20U, 0xddbbd3cdad5f6a8cU, 
+0xaf59e60de2128eacU, 0xc4758d5ccaf1ccbU, 0x21ba6b3b7d6a5169U, 0xa73c0160adda5f4U, 
+0x3859291d64f1180dU, 0x793759f17755d9caU, 0xa55cb6dd94f50a7cU, 0x443fda56044e838cU, 
+0x2d86a63c3e689186U, 0x36bba6c05ecdb6afU, 0xef5a97ae73396212U, 0x5bb99589230a0df5U, 
+0xedfb310d1be3a018U, 0x92643ed05bc1dcc4U, 0x5724d461a33c413eU, 0x189e83e977ed3159U, 
+0xc65a933163ccbc30U, 0x9edfe5d21d349618U, 0x70ed37667a099724U, 0x378720c347cb4f23U, 
+0x6a20327f1315729eU, 0x16bcf955d1348f84U, 0x93118ac0aaa79b6dU, 0x8f1bddb9cf72538cU, 
+0x33d38005e9583501U, 0x9086801c76b5d18dU, 0xc9dba87327404c39U, 0xa65a3767559b10feU, 
+0xad2fa9df73f552dfU, 0xa8c24997dcf28874U, 0xe564913cd393e2e0U, 0xb71ca7025cbd7194U, 
+0xa64a8de543bb1b6bU, 0x575fef32f47c2bfaU, 0x9d98118c1055a621U, 0xfe8fd21db78b1a61U, 
+0x97b5d9ba30eaaf93U, 0xf14ddcff0abf889U, 0x69e28e95f5ad13c0U, 0x791e22aec3256e37U, 
+0x1ddaa1df0c177775U, 0xabdf0902d2c5b43eU, 0xc8c2557c4dd03e4dU, 0xafcf5a6575201206U, 
+0xcc45b4d397bd04daU, 0xfae009a7293517d5U, 0xd3d10b5cc45df251U, 0xc19f249e540e3f43U, 
+0xe805599cb44b7ceaU, 0x47446940916cf87dU, 0xe820402278b3dccaU, 0x2c331fd579fb7e2eU, 
+0x7fc2b46ad5d1c9c2U, 0x6192511ff1309407U, 0xfcf3f3d8c3bdd650U, 0x20567b1cce061e76U, 
+0xb00dd4e0d6789065U, 0xa8dafdb00b195f64U, 0x6d5c45d51f6ba24cU, 0xc22f67bd7cc643a2U, 
+0xda5beff2814712d3U, 0x9da87b73db5cec2fU, 0xefe4e67cbee5af85U, 0xc8fb0a3bd1d6e392U, 
+0x8f929b378112278cU, 0xdd01649d0a8d9a15U, 0xa348b4c87f844b66U, 0x509bc06c4651a320U, 
+0xec875c988e178f66U, 0xf65fe86e735f945U, 0x1760f4f17b8f6457U, 0xb4b168c2b72246ecU, 
+0xc2ebaf8017e55104U, 0xf73a835fbb8e9c71U, 0x63de93c34d8b561cU, 0xd8de765227b78737U, 
+0x2a02ef80e52e08cdU, 0xc2f73fce1940db1bU, 0x5c4c628ad1dcf924U, 0x2fd29465be13f2d1U, 
+0x6eb9409f722a81bU, 0xe9227bab9467b68fU, 0x6020f71756a0a320U, 0xd03eb26a9a38b79bU, 
+0x95e25f86d8a85767U, 0x9dff1a286df208f5U, 0x6ce057045262d412U, 0x50c5fcb02c21a3e7U, 
+0x6939c2c7e987bfd3U, 0x87c5472ff4c4284cU, 0x551dfbeafaddd191U, 0xe3a5786fbd518e33U, 
+0x7ed31b6c8cc23e7dU, 0xa3dcf2ecd928e081U, 0x8477b9ff4ad8210cU, 0xf74bad09535840e6U, 
+0xe834110d03f61c13U, 0xff6986d6f1790dd7U, 0x2d3ad94e07c7976fU, 0xfe4091010eb8cda7U, 
+0xc3d3cecdbda0b3aeU, 0xf986fbdb99e1d973U, 0x39486faf093b0b79U, 0x81759c1da404032U, 
+0xb67951d222d5056eU, 0xedcb5a7e247a07cU, 0x11525ffce96e5e48U, 0x42a97041eca520d4U, 
+0x48414dc8b0f7db11U, 0xb64e483d6e9fd1fdU, 0x6ec36dd26b563b26U, 0xf2fc7f66cf008706U, 
+0x7bca829e0a94a6b1U, 0xca300c28d0d9e4b6U, 0x28a7cebe93fc4323U, 0x5873b9f32aa7b78dU, 
+0x52bf9f98de524c9dU, 0x1f5054889ffb3df0U, 0xf4e0379cc39bb95aU, 0x17a7dbf4ed5e2eb5U, 
+0xc6745f91d3dafd3bU, 0x6fb899f02dcb3956U, 0xfe232c2ed65379d6U, 0xd6ca71b1c27964cU, 
+0xd6adf1421a6fe6e8U, 0xa02248abee88771aU, 0x9fe494a02707de58U, 0xa85130b38fde293dU, 
+0x13d00c248fa8ee41U, 0xcb4e6644c7743648U, 0x1e80957063154403U, 0xc90e300839dd5895U, 
+0x47a63667c3d7c1aeU, 0x5045534717accd6eU, 0x9c0710c653840362U, 0x62f504176d19e73cU, 
+0xf6bf9c7ff1131f8bU, 0x69646960cfa20d4dU, 0x7d4c22df9c431fb4U, 0x5edca7ad865a3d9U, 
+0xecf0b19ba6f779fU, 0x33525005f0e89d49U, 0x1c9d71b5f0271beU, 0x9e58881e48e886bcU, 
+0xb379f9608dc703ccU, 0xaea569b7160376b3U, 0xac9356eb5857c526U, 0x73cfdacbef8c6a4cU, 
+0xa65e18594e1e5c55U, 0x78ef3b9a43e85885U, 0x394dfcdf253517edU, 0x4f80f3584201e6d2U, 
+0x9c8f9f41eb597e4dU, 0x4974f325e77d1a31U, 0x121b45a33b771c11U, 0x5a13c0560bc7a0a4U, 
+0xaf7e4869e41856e0U, 0x7bde87ab59136664U, 0x51fd18a0f22d73ceU, 0xc9e73c13890f97ffU, 
+0xf790b4efa70216caU, 0x57e23b198e1539baU, 0xb21c60ae448fb2eaU, 0xb6ee9f71ab3f761cU, 
+0x24865ba1c5759234U, 0x76eed96a290f9f0bU, 0xc820b826a8e9f4bbU, 0x5594644173e90b46U, 
+0xdaa789614260faf0U, 0xa2bbd34597e95935U, 0x43144e1a680f272eU, 0x96b25656017b6e75U, 
+0xc0e42520e366d412U, 0x890bbf98707d4f5aU, 0xad8e5733bf99e1U, 0xdcf8a6a001b37cacU, 
+0x8d9140f3d7f07578U, 0x59b20724d6db1a81U, 0x455322bb63570df1U, 0x8f51c431527fd5deU, 
+0x500400f045e9298bU, 0x44cd7048083be29U, 0x912a4f8d105dade4U, 0xfb97b65f1e044468U, 
+0xa49a1be4aad13276U, 0xca6350eae9c043c7U, 0x26f12b2b387771a3U, 0xb971910c41cde24U, 
+0xb338f3420a84dadbU, 0x593d79298270fae3U, 0xd4e2e45b3bf6811fU, 0xac28486ef006eefbU, 
+0xeea6bc92071e5c83U, 0x8bd27f198542a0beU, 0x20a845b72a58e5b1U, 0x54ccc9415026d73fU, 
+0xcfd08ef7140916a1U, 0x929e0bcc5d8ee496U, 0x3a8f8715dad2bf22U, 0x1c433f45b4514532U, 
+0x831bb80c01287c25U, 0x83fd5b1e946f64b2U, 0x9d841014dcfbe833U, 0x29e34b1bed8aa814U, 
+0x1d23ad1d75a7e46eU, 0xcf3a198b6e15a439U, 0xc1417cdfccd96b25U, 0xea4397df95eeb3a3U, 
+0x4c5e3622af76167cU, 0x2f2f422cc4746739U, 0x39c22c692dccd9f2U, 0x87582edcb73eff95U, 
+0x6c6fbb616f4d7ff6U, 0x88028f0677197be8U, 0xfde102c3c37236a8U, 0x75b94350ad64a7bU, 
+0xf3d5be3a53a3a383U, 0x876f31533ab62409U, 0xea5b5f1d3c001919U, 0xd2a076367c5ba19eU, 
+0x65f2abb22e7e0640U, 0x5981aeff3f598bceU, 0x6643a0f5bb9dce30U, 0x79aa09b893b7fcc0U, 
+0x46723ee874de6611U, 0x33f657394b821fb0U, 0x1c25b7363566f11eU, 0x4a107aca1f2736dbU, 
+0x358ebee58a805feU, 0x75d547a5c2132acU, 0x34ce64e8f700052eU, 0x809b26510063ef39U, 
+0xe7381d983bd73a10U, 0xa25280129dec7b0cU, 0x13309d38e8962018U, 0x206084c4fe23394cU, 
+0x4912d18dd8d2f229U, 0xf5c315c424ecc003U, 0xc08a9672ceb8393U, 0x6133a0f86da01697U, 
+0xfcba4ed06dcfecb0U, 0xe983fd1d30a8d846U, 0x654a0e0d49bf49f6U, 0xfd402eb372aadfc9U, 
+0x10593f3deda08de8U, 0x1a4b4c24bde65e79U, 0xe9a626389baba86bU, 0xd6b34030dda63a22U, 
+0x7748532d4fa43529U, 0xd505671ae1abb34aU, 0x66dceb631977d5baU, 0xc56dd686b0fd846aU, 
+0x59ededacf9a521f6U, 0x619e467816fb7eeeU, 0x555d2c60a76b8c11U, 0xf2acaa85f3f1b263U, 
+0x5b4dd60f554659edU, 0x7fae3d22195d966eU, 0x5dfb8e07fec9d0a0U, 0x467bb34646187515U, 
+0x9b207d0b2800cf83U, 0x701bc10dcd013e00U, 0xa1f2cd586db82cd3U, 0xd01effd05aa978e8U, 
+0x21478fe34e0592fcU, 0xa251b7f48713fd20U, 0xd32e184d6f066d54U, 0xa217ac1f2a3f0f18U, 
+0xc080635e0efb307bU, 0xe860753a3e69abf3U, 0x9e644eb36c550d68U, 0x237ff4ee54584a0fU, 
+0xee64984adc97e515U, 0x6914d6c339885a5fU, 0x6c879b630e9ec7e5U, 0xcf66b98f8cddc0e4U, 
+0x958214ea806c8a51U, 0x33f07458d990033aU, 0x1c25b41034ec6a7bU, 0xa70717b90446121U, 
+0xa86af7404e21b27U, 0x57cf59e4820a93daU, 0x52aa94eeb7ea8e3dU, 0xb1c35b7e83dc78c2U, 
+0xf410a29f634ac059U, 0x924bb475b7c4b4f5U, 0xfcd952a9563ffdb4U, 0xa622031ff4e87d1bU, 
+0x3ba52a10186154e5U, 0x86402a669aafa0ddU, 0x751c8953ad486770U, 0x3d9252c60fbfaa34U, 
+0x77fc93f69603a8a2U, 0xaea1fb7d7c7dd707U, 0xc4493342896b4cf3U, 0x3d0d01dcd2fa9d7fU, 
+0xe8280185114a280dU, 0x629cc4d8054c9997U, 0x7d05dacf9afe3fa3U, 0xa07cc3af9dc3571cU, 
+0xdd0fad4b744a44a6U, 0x901015f9d7dbf4feU, 0x36dc228dc77dd726U, 0xc714b8a61a49c6U, 
+0xd3b63b62aa4a8daaU, 0xe510600ef28a5ca3U, 0x760eb5b48f4a968cU, 0x2bbe38b26889769cU, 
+0x7e08774e9236e49bU, 0x9902b3a4e3eb6e7dU, 0x5e2cfef91f960850U, 0xf85707f600d3b36fU, 
+0xc30fb77122d32936U, 0xe40cd02e32847f01U, 0x9f6cc7d1513d7f38U, 0xc5440c597814a47dU, 
+0x9a42fa3747cabfd4U, 0xd8a6d28631e41e5dU, 0x2edc1e1d23ecf4acU, 0xd27ee9ba383e1fa7U, 
+0xcbe1a18d2c2e32b9U, 0xf165803dfbd492c0U, 0xff3e42d52f5bab12U, 0xd07e95892daa15afU, 
+0x5e78ad6a2c1a4f5cU, 0x23ed98f15228e81eU, 0x731f0769f893ef4eU, 0x774e4d6506724528U, 
+0x7d8501ec7989a8e1U, 0x7c1d96f374ee4bddU, 0x7500e0479b9cfe0aU, 0x3e4d03c45cdfa79bU, 
+0x98791388441c240aU, 0xffaf18d5f3bd6740U, 0xaac117cad7caa719U, 0x12f744d0815a6475U, 
+0x7601aeeef79f7b91U, 0x4275a149e19d957cU, 0x3a06ae0295829d32U, 0x437f6e07b86fd8fcU, 
+0x64b6ace375270033U, 0x589a771191396833U, 0xbf38b8289b15d63cU, 0x5fe8d37ca889f13aU, 
+0x6939a8d0d9bb7902U, 0xd8c26c7286b7c73fU, 0x9a9a249e94485e9fU, 0x1b68449b3d61035U, 
+0xcd7f44b1e03ee653U, 0xfceb260471836682U, 0xbf198e5c36d1581U, 0xe59063a1e9379c3eU, 
+0x360cdeed45046203U, 0x5533528adc6cfcbdU, 0x534665997d06e463U, 0xd2ea9fb217fd7e77U, 
+0x8599f27a3e8ea623U, 0x15dff2d56a34c3f5U, 0x5b06420824500d44U, 0x16ad23b09f909a70U, 
+0xc29b56d4c371d9feU, 0xf04b356c1999d6bbU, 0x335955a7c3ab3a4cU, 0x952c3cb1accc9ca2U, 
+0xd76ce6d24189a13fU, 0x664464f11808c75eU, 0xa7df9136f6ece5d0U, 0x59b98546f7d62f06U, 
+0xa969ecfec51cd9c7U, 0xb80a7c8a3447db8fU, 0x79ca1e2a6483ee28U, 0xcecdff7a5cab844fU, 
+0xeb76eac729389632U, 0xd09d06b645e5a3fU, 0x92af68819c7d0f6bU, 0x9323e54d22868008U, 
+0x847ffc768bc2c885U, 0x1551ee775264e57cU, 0x858980450b97cde5U, 0xdfcb4ee15b166eacU, 
+0x75d4a6431345d92eU, 0x1c7738947babe975U, 0x53c4fc26c82c0f41U, 0x536a2395550613a1U, 
+0xb2a89eda94f574eU, 0x803e0089bac61d1eU, 0x5b409eb88958224eU, 0x5885cff254b12348U, 
+0xae6cf88e4efeafefU, 0x884a4c6bb7fa01c9U, 0xb5a3b70f2ee0cadeU, 0x83216e65a72bf298U, 
+0x738b852bf510208eU, 0xdb8cce2d84d79438U, 0x8a87af3a047c97bbU, 0x157966c09be6500cU, 
+0xd60eee250d207357U, 0x8fc64432da43dfU, 0xabdff7b7bb8cbe07U, 0x40446d5ab712264eU, 
+0x381b3c5d60776090U, 0x6d23b7438180af23U, 0x417d17453e33bc47U, 0x1a002f610f90a08U, 
+0xf82c98a82445e13aU, 0x93d90b768a2bef87U, 0x963f415207a9b3e8U, 0x30922da21fee7aa1U, 
+0x1c9fccbe8b96fe13U, 0xe4924ad3b4852ea8U, 0xd6e1a8ff813f6e23U, 0xc6b21e3c4b1e990aU, 
+0xa006b96af7bb1417U, 0xff65509179e6d2d6U, 0xe54b781e34eb28a2U, 0x335bcdd8c3334d48U, 
+0x35790805fa8c8fa4U, 0x46bd73bc9820a03eU, 0x95076388b655fbc2U, 0x8d01c86339dec705U, 
+0x10d61edcc6dbde83U, 0x789eb1a45eb7eed0U, 0xb0b494b461a8dbd6U, 0x9fd55dddfa2fdca0U, 
+0xc365819ac3936565U, 0x97a7b36d977fa4c7U, 0xb4bca9d539522d9U, 0xa231e4c478c7296fU, 
+0x8ae56a0635ec5f19U, 0x2ba56e0096f15426U, 0xc0d94ec68803cf94U, 0x80e0c98bec7fbe91U, 
+0xbf9f4172b066fd48U, 0x1c37101cb8971583U, 0x6c79b97a6badca6U, 0x241c567a4227f1c5U, 
+0x7f7d2c6792857b08U, 0x8ea87138aea36605U, 0x9363817c043203a4U, 0x40a62d93d4302d4bU, 
+0x42ae5b50783dfb7cU, 0xa518b52ea2004466U, 0x609077a9243b173cU, 0x4ea220c78bed1c8dU, 
+0xe5d9e6e88415e13eU, 0x28c2a2b452324480U, 0x27417d9d954c8298U, 0xc644dd2f1ec88d3aU, 
+0x861f7db90df9591dU, 0xdcec3ac242b4c82aU, 0xcba0d3c4ab327218U, 0xde2fd23b826978e9U, 
+0xb4e1973d0457ad84U, 0xda9a8a1f88c036a4U, 0x5ecb7ec84b92ebbU, 0x400d71133b6243f3U, 
+0xf02e89487d70d2eU, 0x558dd9397551ce0dU, 0xeb27e145f21c1935U, 0x9c8651ced75ae94eU, 
+0x9cd3da9320f35d28U, 0xf3ed01a82d75cf12U, 0x3bb36e293a2454c8U, 0x9532e363ad04e53eU, 
+0x2ea8254af562282cU, 0xf02f3af938fbc377U, 0x993948b024e11340U, 0x8df889b0304ccbddU, 
+0x7256abd961d195cdU, 0x247f7044cef9bb15U, 0x6c741e63188af35eU, 0x74525b673205ceedU, 
+0x9ae50a7e3da4a543U, 0xb2b21c2e5edd208cU, 0x439d86dca7a03fbbU, 0x211a671daacf935dU, 
+0x532117bb36b69c0bU, 0x37810c54418a6cf7U, 0x436d68dca868838aU, 0xf46d47a89bfef4a0U, 
+0xf9d528950dddb2ddU, 0x78864cdcc2c0da6U, 0x1fb80cf152f245U, 0xa0fd758cd98b80f8U, 
+0x7fd94ff873ede6b2U, 0x1c8ce96f89409a7cU, 0xf8691fd313b08f31U, 0x53e5d835c13368d5U, 
+0x17a4f678c5d62af3U, 0xe93e7ca26bc0ec36U, 0xa708fbc0a52e5a71U, 0x298a401a6ee92414U, 
+0x94763ef0af0a3d96U, 0x4866e6b9604ed6efU, 0xe40985ffc80c90dfU, 0x18f9a3aa04fe0466U, 
+0xe08cbaa04f542e36U, 0x4e22ffafa13415c2U, 0x7de59267946335d8U, 0x3170c58472d1a0f6U, 
+0xc6c475aef63288b5U, 0x6f75695999be1bU, 0x37515093feb9773dU, 0xb2083612fc3a7fe2U, 
+0xe94c733ab6025d6bU, 0xc002060fa12bad98U, 0x32b2db74238391dcU, 0x5b099db0c70b101cU, 
+0x22502ca7f82fc98dU, 0xb5d4ecd04852eeb4U, 0xade148d1f5f01656U, 0x9f529e2e79a81012U, 
+0x799b23a5dc7548e9U, 0xd8dda8070892d54cU, 0x9db481694f063fe5U, 0x92fab0a90a2d3e02U, 
+0x8c712cd04917758fU, 0xc8a0dc68ef2d0848U, 0xf431714e0c2679ffU, 0x55e7b4680cb246bcU, 
+0xdcb5d5b2e7795486U, 0x33d2e0ad04572cd6U, 0x643976f1021e0380U, 0x60ea8cdd9a9cd83dU, 
+0x7d5cc267caf96a1U, 0x475534ed19cd7093U, 0xead5790fd0685f4bU, 0x262967e6f092d4b0U, 
+0xe0d8050b9498f7f8U, 0xc4df67d326411622U, 0x9d0be11b192c8712U, 0x91b065be18035517U, 
+0x3c740d9e3f23195bU, 0xdf2c7b425789639eU, 0xff9ff3490017e264U, 0x35b6f77fb671620U, 
+0x24f9181974eed127U, 0xddd013e967492859U, 0xf408b832247dc145U, 0x1228c7e6bc4d4a41U, 
+0x6a01cc351a1da910U, 0x90f8cdcb12f0f703U, 0x492b6cb25f9a6b04U, 0x61044d3dde684ebeU, 
+0x51dcbee24060e322U, 0x3ecdc737a9c4d14bU, 0x9c390697489ab992U, 0x8e4a1f4ccac9cb3aU, 
+0x4e2183cd904619d7U, 0xfb00a98d954fbfe0U, 0x2fb05ed2406e7bc4U, 0x4936b75eb328d775U, 
+0x90e75cb48e14db63U, 0x29493baaad651f7eU, 0x8492592e326e25deU, 0xfa822bc2811aaa5U, 
+0xe41124545f462ee7U, 0x34b1a65050fe82f5U, 0x6f4ad4bcb3df188bU, 0xbff44ae8f5dba80dU, 
+0x794a16baa05f57b5U, 0x53fe448a57324591U, 0xe4c13d0306960801U, 0x31a8747df8dc746U, 
+0x1827ee579c0343fdU, 0x1431c18c42b8def2U, 0x60e8aa6c1e387a32U, 0x883a2c64fda8d586U, 
+0x752c453f7db3cdecU, 0xdbef3a12b228ebf5U, 0xe596645e7bea4bc8U, 0x85b2c064ff912f5cU, 
+0x8f4d08204a03f81fU, 0xdc980b34e64cf8e0U, 0x63c7fa2d2fcc6d00U, 0xf64b278f39d11536U, 
+0x15e2e65580b2322U, 0x4eccac6096513ccaU, 0xf9571975c0d5934aU, 0xa7163c2b9b973c17U, 
+0x3933b2232197ffe9U, 0xb841a4f4e09952d7U, 0x63389991545a6b7aU, 0x308a9a797af31fa5U, 
+0x288a5ae48607b030U, 0x24daff63e584d673U, 0x7851fbacec16f29cU, 0x110b0376c4021467U, 
+0xf43aa112b3617c3aU, 0x87be1556fb298749U, 0x4c6eb89f8461c70cU, 0x84432b85318ee673U, 
+0x9afbd3916a334020U, 0xa18159998ef9afb9U, 0xe22a0772517690acU, 0x3c714524875d4eedU, 
+0x6102a85cba701655U, 0x152fcaafe7938c2cU, 0x4889e729ff7f3d8cU, 0x7f090565771aaf5cU, 
+0x54edd81c75a76f08U, 0x3295f2538bbbed4eU, 0x14f6e1242b1caaf8U, 0x18784e449f6471d7U, 
+0xb39605d6b824993U, 0xfc9d74a7a60a2532U, 0x1777a8fdac71e671U, 0x8d76ed7f4a1e1ae7U, 
+0x6cb04a6a5c42a280U, 0x2a50c382db2670cU, 0x811b3923ef4b991fU, 0x1bffab8c03ab8279U, 
+0xc9c742364ddb9261U, 0x982a369aa9d24fb6U, 0x332ac758529f1aaaU, 0x2982b620ceb1d098U, 
+0xce8e33c9fa6fad81U, 0x9c3365748c0cb03eU, 0xaef56dd7703a037dU, 0x58a2f9e07d05e6b9U, 
+0x5400615e3b109594U, 0x798bb2d32d300b82U, 0xc1b682f8717fa6bdU, 0x6ab64c5ac5560e0U, 
+0xf0ebcb0ed3444c74U, 0x9e5cb1d7b595f7ffU, 0xfb88219241f2d6c5U, 0xd9a822ba07b6bc2aU, 
+0x5f9ed1afc2338891U, 0x2d6abbd72aef8a78U, 0xe7b8740ff7b504fU, 0x48e4749ecb370ecbU, 
+0xfb22f11f9eb52583U, 0xea8a99cec10cc13aU, 0x40ee6dbb278f676fU, 0x1ef020dcce7ebba2U, 
+0x55b278197a3f17aeU, 0x6ac300f97012d4cbU, 0x97f6c0f4b969530U, 0x594476b25a7a14b0U, 
+0xe788e04ab021a9beU, 0x18b0c59b8ac074b7U, 0x9d76b8258b28b28cU, 0x66aa4fd12add747aU, 
+0x88b5a3ac03a15a99U, 0x9d64422d106aa108U, 0xca94f6c567e1dc3fU, 0x10c65e609047474cU, 
+0xb5c23ec1f0a1958fU, 0x4f39b5246fb56643U, 0x95dd144cfabfa32cU, 0x4e4a8163c1d6a213U, 
+0xa43b3f5148636f8aU, 0x4004085fb2c43d66U, 0x33f4a3ee29c6fa8U, 0x2574a45b79e8c8d1U, 
+0xef0f43b30a7338bfU, 0xd10a694ea5ff8400U, 0x7c2b1a4ebb312cc8U, 0xe31d414bc13ea842U, 
+0xd23c40b0f878f170U, 0x35cee4f5d7185bc0U, 0xa87559754bf051fcU, 0xf8ab200a672a9e53U, 
+0xe8275a8464935db5U, 0x281798261c6bdb0eU, 0xe3327e0ed594519eU, 0xf6966a16add61104U, 
+0x3a34836c1d166838U, 0x2d7453a34401bf01U, 0xc1a5ee572c3c755eU, 0xba0de307a9031db2U, 
+0x68f41305b76a6987U, 0x2b481ab443da43ffU, 0x7ddc6988d7ee1b3fU, 0x54bc18d7a9989954U, 
+0xfe457cd05b9aae49U, 0x52eb8ed4bb73b119U, 0x7391b851ba73e2fdU, 0x4b2c8c1211e6eaf3U, 
+0xb2a64c6196260250U, 0xba770f18355cca4cU, 0xf33d8173a6fb4d96U, 0x1f380071781dff16U, 
+0xb1519b2e6b011955U, 0x1b8567660590d693U, 0xa33705176ca2cf62U, 0xb1521ec4ba6c681dU, 
+0x38bf47f5fd1fd820U, 0x7887854648767500U, 0xa863502262b1271bU, 0xbafbbcf680c1c52aU, 
+0xeaedad521bf074f0U, 0xe81c34a1231fcad6U, 0x2ce7bf5ac89bc0fdU, 0x1487997c9db4dd81U, 
+0xea6d95d177ae84daU, 0x58e6ea55222034f3U, 0x41e0be2b789273a0U, 0x99eba192aadb019fU, 
+0x8da39dbe02155cacU, 0xb630d866d7108d10U, 0xf4f806644530184dU, 0xfc4dc4cde1efbfd9U, 
+0xe917081294299b7eU, 0x24e79f2d0986e0d0U, 0x2a3c3bfc75c220ecU, 0x9b1938f7103389feU, 
+0xc57b2857447b84deU, 0xacde851f86b8232U, 0x3140e98e1caa3ec9U, 0xfb12aa6ef1710283U, 
+0xca3a26ba0409ca06U, 0xb46c5f5f8fa42e6eU, 0xe81ef0ea907bf3d8U, 0x19b738fc965208dcU, 
+0x23530a35741156dU, 0x7cb418df147531e7U, 0xe02610b7e55a7acfU, 0x6faad12c8f69664bU, 
+0xfd410740d10cc4c4U, 0xb71d35a2c4a53da0U, 0x7c381fdc06761b2cU, 0xa6771985cc017590U, 
+0xc20f3b237c976570U, 0xbc745773a6ff3094U, 0xf29bd6601e5d9c3dU, 0x85506185f750dd98U, 
+0x896bf7c7f7f96003U, 0x9d4e993b7604a5faU, 0xfc5945ce21621e08U, 0x6d50856433968435U, 
+0x271ccaaac7e969cU, 0xd6c0d6dc8263a0d9U, 0xc6bc5d8aa2c7eef9U, 0xccf57357e968c6e7U, 
+0x5410802d54242a28U, 0x455bcb21253ca771U, 0x9e8af784b774ecaU, 0x88b7ed536b0eafc1U, 
+0xfb9681ec794ed8ceU, 0x4e366a1c8f83e347U, 0x47fbf9dd3587bd93U, 0x22b053206245345eU, 
+0x80c3376ae718be8dU, 0x81903d7ce982ea1aU, 0xe4432457540e80d9U, 0x3c7716e62ccc6873U, 
+0x49ba01cc4164d021U, 0xa59e60c87a45fecbU, 0xdb110b6c00dbcaebU, 0x5a32ea941fcad1bfU, 
+0x16144ec9bc1a94cU, 0x51671d2b3e71daf8U, 0x52d72b0225e8757U, 0x37114012a86b3d2U, 
+0x8c0c0b6cefc2073cU, 0xc8518c362ac42483U, 0xef8c21a54ad05335U, 0x4d1d693d51dd7390U, 
+0x37876c952cb163ffU, 0x13d2b7e10192292fU, 0x1c57c7ccdf9d70e0U, 0xdae897c18d42e1a1U, 
+0x1c8bea7d89379690U, 0x8f0d25be5f08faefU, 0x6322b3cf21d9789bU, 0x5f4c0f44a1b406a4U, 
+0xefbd1e09877f88baU, 0x50980779ee9bed36U, 0x34b5a32e84ea2cc3U, 0xcc98214c8984293eU, 
+0xa462efc87885278U, 0xeff60e7eef354c4eU, 0x114c4a64677d63abU, 0x4ebb4e8e525afa9U, 
+0x7048622fdf2da37cU, 0xf4c671631a8e1e03U, 0x63089fea4ff8ef3eU, 0xf8a801d390b66981U, 
+0x2a4c6789b77a8615U, 0x1898c6f78d44e052U, 0x7abc626c8f5a7bfaU, 0xad9434c776bc636U, 
+0x1573194dfd70187cU, 0x751ac8629b640c7fU, 0x9814e5e0290f5bf8U, 0xad3ae029a42a10fU, 
+0x7dffcf4b3fc775a7U, 0xd034fb081662a0f6U, 0x785c55f05fabb33dU, 0x2af040d4758846e3U, 
+0x60aafad170aae231U, 0x5194b85279f96b7cU, 0x85f248239267756fU, 0x1d35c9699761e3f2U, 
+0x5867063accd6ac71U, 0xedf58aa4729a66f1U, 0x1d660ab622ebf810U, 0xc7226cb62df60823U, 
+0x501a327426432d92U, 0xd9c9823c2b473903U, 0x9910e1c2a6397ab4U, 0x6f2b065a7800cdd8U, 
+0x6d2d1c4963e17c9fU, 0x93bf02de33dbecbU, 0xeb1472cf700826c5U, 0xacfeb77e5e7a2e4U, 
+0xce0d3fe18cfa3facU, 0x23ad869fc32b8193U, 0xe2cebb45d60d8030U, 0xdf3d4047a6d2234cU, 
+0xf4626d938fc7d419U, 0xafd63ce496882975U, 0x24aa21f29c0f9dbfU, 0x48fa6f5229fd40dbU, 
+0xe3065e088a6edbf5U, 0x2f3352569662876bU, 0x68991da7fdadd0afU, 0x870ac12ba3dd7774U, 
+0x1906d2dcf02f8ce3U, 0xd03c64022e5f297eU, 0x8de7efd769d05a67U, 0x7543728b999a7699U, 
+0xaed925ae1f1322d4U, 0xcb0a69404accdcbbU, 0xea1e6c4ca311f822U, 0xdbb2af6ab1f96144U, 
+0xaa492b4f4a8c5311U, 0x9a9fc9787b7e3a5fU, 0xa1b60d1ed6433f9dU, 0xebae75b92f13561aU, 
+0xe8a58ada373a6b7aU, 0xf3adf06c6252d45bU, 0x9b667aa14226d09U, 0x17b29fd1b5222134U, 
+0xc1482074844ebacU, 0x39d03897d388cbaeU, 0xe9924e663efefbd2U, 0x15fb4490352f3d4eU, 
+0xf069a33ca1138f7bU, 0xc4c1c93e2df2e8f2U, 0xcafa8a267f9b5f0bU, 0x1dba7b597f261fd4U, 
+0xdc82d8c7a39bf268U, 0x8136e6b7998232c0U, 0x3ae19006bb8007f5U, 0x6aaf7d3e5de7efc6U, 
+0x7aa6e46350c06af3U, 0x6a9e8c749fdbf0f0U, 0xa0bf5fef8034db34U, 0xdbec13e6da0d5592U, 
+0x7caf0f7cb6d243edU, 0x42243a3264edb664U, 0xc0e57348b745e4d4U, 0xf859978fd619e5f8U, 
+0x8da87770179a70afU, 0xec9d429a9b64df28U, 0x31bbe82d5f5305c6U, 0x348a2e442626919dU, 
+0xca84861487b66e82U, 0xb2a7c2c5b7e13e5aU, 0x8c747bce00230105U, 0xa1b9fa79f55a3e80U, 
+0x59476eb82cf4b3ebU, 0x8f8e3c46c59e4946U, 0x88d9640515697bfbU, 0x2820910fb5e0ff12U, 
+0xbda69d20c1d6df4cU, 0xc0f9bd31a62b982aU, 0xa8dec339ec825a12U, 0x94d9c37635a1a28dU, 
+0xc7476d76c4d3a201U, 0x36e926a4fd9b9eefU, 0xa86a4fbf931adf5fU, 0x3a4ec851999c9e1cU, 
+0xdd8596f768635f89U, 0x27d31e5af73cd55bU, 0x69e03c11a4774a8bU, 0xc99a2ef82f6262deU, 
+0xfbcbd75eec3bacf9U, 0x254295c49227f9fU, 0xba6d73897768fedaU, 0x148cf7fd16f0a1adU, 
+0xaddd8aed8d143036U, 0x2abf4481c576dd9bU, 0x78aa8117e505b36cU, 0xfff2799def47dcc3U, 
+0x1efae72fdc978567U, 0xe15da68840dc1f98U, 0x84e935d62ff1f60bU, 0xb1ba52d88334d457U, 
+0x77fa482a362dc291U, 0xd9a46cb0bafcd40aU, 0x7c5f7cf713dbb78fU, 0xa46baec7a86943a7U, 
+0xdf392c1f5c5d5653U, 0xda88b77c165c55b9U, 0xa7650860a2d365c5U, 0xf2c392ba6ec31de1U, 
+0x93152947af189f45U, 0x5cd94a9f671b8640U, 0xb3010946e5903d65U, 0x5b7396ae40589537U, 
+0xd228eea512350da1U, 0x19414c77c175f043U, 0x2718b7b969612c2fU, 0xae6eb3d8ef2aafdU, 
+0xc73e09f370a14bc3U, 0x66d468f0ed43da4bU, 0x2dd034f7fc4189b5U, 0x99cdee9fb6006caeU, 
+0x5572aea8750e4f5fU, 0xcbf5ca9aa567e0e6U, 0x388ff0f7aa02f29aU, 0x55d9a959844b5aefU, 
+0xc858eb76bca97db0U, 0x4c9810c633ad1b15U, 0x766d574fbcc8ec52U, 0x69cb7f9aa5dad203U, 
+0x758cb4d57c6f8fbU, 0xf517323e3f09b5d3U, 0x38f9434c2f72e662U, 0x8c76689ba78a1661U, 
+0x7dc5b39a9bcf2306U, 0xf0b11fc3136bc05fU, 0x288489b0c63d6dcdU, 0xcd3172990a409d3aU, 
+0xc06a9887feb142e9U, 0xc176eb064607fcfbU, 0x794d86838faed480U, 0x4b0043ebe46f3e11U, 
+0x4b2c52d62c68552U, 0xf23290f3a125888U, 0xdb17884636222d87U, 0x173ccf23a30dac1aU, 
+0x1ee45f92ed69f1d5U, 0x46543768ce5e1244U, 0xf0c6a4169281bf87U, 0x3fb5909a93dfe46aU, 
+0x13d4fefe99a56cc5U, 0x25d35688fd0562b0U, 0x704a4e3a3bdf7754U, 0x549991ac0be8809fU, 
+0xf6dd4ae717f1aa96U, 0x13d7a5f734ff6481U, 0x32728dcbb73463c5U, 0x79ead27992ad6fc2U, 
+0x80ba71ce4b0a3fb7U, 0xde84d71111b3955aU, 0x1a6e439356256542U, 0xa95de9cffbaadabfU, 
+0x66c3eb2f1637a274U, 0x45210457612d5806U, 0x4da377c3236dc074U, 0xf01dee116a3e4a41U, 
+0x743fd470839d3465U, 0xe6923f6ecf94c497U, 0x42615f231e1d01caU, 0x24cfadbc9af48bf3U, 
+0xc805ca72f93a9ae6U, 0x8ee0aa059c77f8adU, 0xb5279e3631ad743fU, 0x318e0050f24da1ceU, 
+0x184b5694dc447d79U, 0x94536fdbaed3a8eeU, 0xf4d17ca51e504bd0U, 0x2792ee1119ce9299U, 
+0x506f1270bde7bc7fU, 0x7feabb0cbeed3e03U, 0x8ae227e16feaf253U, 0xc34ace1ce5dd9040U, 
+0xaeb63980697806c4U, 0xd6554299bd55a442U, 0xe623b8be80166f12U, 0xe1ef3b3a009857e2U, 
+0x137945b4dd30585aU, 0x95ff8a1aa3501495U, 0xb88032f490c0a4b4U, 0x6bbc5471d2f1e43bU, 
+0x6af97eef348b05f3U, 0x9f0428102f9ead9U, 0x4a9ee2b15f2226beU, 0x467b189b0c1529f0U, 
+0x75e8371f56afd841U, 0x6bf9f5c2298a21baU, 0xf00fbbdb9e100b79U, 0x9b4645c389dbfe9U, 
+0xa99c9a5edca8547aU, 0xe158b7ec83fb5a87U, 0xd51d52781161d80U, 0xc0d370e6fb9944a3U, 
+0x2624f808c0136275U, 0xa647c00173877535U, 0x89b51a90f7760d78U, 0x940148c610c1fd11U, 
+0x5d63a1115997aa47U, 0x5d4b3ae5604e1a42U, 0x7aa24c4ab505d669U, 0x6967f95f1367a4f7U, 
+0x4d8a0e970f154768U, 0xd6446f4c54960456U, 0xc3b5ad54cd3b6d7fU, 0x11c6b94ff7180c69U, 
+0xa98238928f3c0e4U, 0x62085b9673d6cb8eU, 0xd71027bdff700360U, 0xa84afe0696a2d9ebU, 
+0xc3a13dd39f0fe850U, 0x864d230be511a7bdU, 0x91b56c928da5f98eU, 0xc41833926039b49cU, 
+0x1358f446bd38666dU, 0x65a7ec9e01a0af0U, 0xeb8095d426afd558U, 0x3537fec9c8d40f7aU, 
+0x4fea097ba99de8dfU, 0xcedbebc89ae27b3fU, 0xa9b0ef3b1b65592aU, 0x4bc2cd77649dd764U, 
+0x3d0c1f3cca78f3aU, 0xec450902d2e16337U, 0xbe112b9429eaaf87U, 0xbb1fc03a547a1fU, 
+0xcfe4413774937fbeU, 0xc0b04dddf051ba6eU, 0xe0c14001af96f546U, 0x2baba3f627c67d70U, 
+0x9390e557573a1df4U, 0xec2dc4b190ac8110U, 0xd783b0cd924eabc9U, 0x77e5c765b2208b88U, 
+0xd4d3d2de4351964cU, 0x346924376f5412c1U, 0xae5abca185755c08U, 0x6e29f959be28c47fU, 
+0x118824bd563fd88fU, 0xef640c527a0bfb63U, 0x5052ec6cc184246dU, 0x34565d9f500f32f6U, 
+0x61e0f0efe5e84da4U, 0x3b09f0776ed90cadU, 0x10cfa381496e6894U, 0x8efa0f79b5909a0bU, 
+0xfde19f42596969d3U, 0x79957c4897816035U, 0x9fa46f1c5daafd14U, 0x242418e7934cd613U, 
+0x3f9501038c0e49ccU, 0x41232da85bc5400dU, 0xdd8288decbb740edU, 0xd691d4a978970f6eU, 
+0xdd0bb4c1d00f4152U, 0xac5be1d02ad043f2U, 0xf7fbbdb5763e0c52U, 0x7a79e7874b78f397U, 
+0x4acaf2c0023ac4ceU, 0x1f8973e31eb3f397U, 0xb9d6d6d0f360db2fU, 0xd0d4af73cb8fdb30U, 
+0xe3df0360a47dd6b9U, 0x61850b1c863aae77U, 0xbbe9ccee3e529530U, 0xed90f8c8f15d7ddcU, 
+0x3d876b9f2b9b930aU, 0xdeb1352a4530f58fU, 0xdee5b7df7a7bbc49U, 0x2a5d6846a2e0d7c5U, 
+0x86ff345f3b2caecaU, 0xea5b73435e271685U, 0xe5ccf03903c4ab58U, 0xdc3d7c096876476dU, 
+0xbc6e130b886719aU, 0x165cb495470922f0U, 0xfd851c4d332b75e3U, 0x8b277f8ce445915bU, 
+0x78b30fe6ed37c38U, 0x55213780cea31a3dU, 0x6e4b52ee69ec9139U, 0xcf44d77b164543bcU, 
+0xfa7dcbd2816959efU, 0x7679d056741db59aU, 0x2f0431412e275df8U, 0x8764496a389bb526U, 
+0x660311cbe0cd5010U, 0x2856ad4172f9e3f1U, 0x9e0b412796ed961fU, 0x599b69d61d002ffdU, 
+0xe399da6192397d42U, 0x38d1d60251256eacU, 0xa6d6f71b65b85f90U, 0x829b8dd0ed5452e8U, 
+0x91b71631e3df5612U, 0x5c5adc4263ad1a5dU, 0x99e73c8a896241afU, 0xd300ec543fccf46dU, 
+0x639409ce3aef0f84U, 0xb0bb506a871c75b9U, 0x33de3fac17adb8caU, 0x94d393bc812471b1U, 
+0x85ae61b9378ba7c1U, 0xdd3f402650acf12aU, 0x1e1cbc386b239a07U, 0x5a826ab4eb4b63f2U, 
+0xeadecf09028cdcb4U, 0x72a1b40690a1cf86U, 0x2ea231dcce55180fU, 0xe925a006c6f2a348U, 
+0xbb9619760589af3aU, 0x8ead37dd62073759U, 0x4dd045436194510dU, 0xe402787fad456996U, 
+0xed455784effed1b7U, 0xe2dbd126564aa3b4U, 0xd17509702d34bd2eU, 0x4a72b5a0889e4e2dU, 
+0xb5f29fd89601dc5fU, 0x85e64b8ec74d9845U, 0xc8c33fc047c8ea96U, 0x3531e6ea4a1d20e2U, 
+0x368f5340ea0046bfU, 0xcfcf8a096442a045U, 0xec01db905a3615f7U, 0x88ef3688969b1509U, 
+0xebe6ad23bfa86f2eU, 0x8ae2d212f193196cU, 0xdf93deea7a4b46fcU, 0xe4204ddf22f356b9U, 
+0x2043f25d0467317U, 0x9141dc41d8d9186aU, 0xa78666f2fade7900U, 0xd7f01cfc5a371e15U, 
+0x5cb957d5cf7d014eU, 0x28a01743697fbd89U, 0xec7361406c15ef57U, 0x888dbbd987726c26U, 
+0x33be1811b6799f9aU, 0x85d6390acdf4c550U, 0x72db42a73b408f2U, 0xdbfe86d71283894fU, 
+0x50de611dc79dc6e9U, 0x7faef77d234e71f8U, 0xa558a73fbf3e51fcU, 0x445b3c7d17c68718U, 
+0x3bd7590a7dea02c1U, 0xe4fbb9b7c774087cU, 0xbe80bf9d91e31206U, 0x7e50a0b9f77c371bU, 
+0x33c946dfed45c201U, 0x7423934f158e1b28U, 0x616c6f1ddb8b9517U, 0xc3405d3c4e0fe29cU, 
+0x28a7d4110cb71280U, 0xc141c259a8456311U, 0xc00f2ef0796f458eU, 0xff046a9eb2bfeed9U, 
+0x7ec3271f5ec33919U, 0x12b6e6ebd28487aU, 0xa01eddbdd4cfcc9U, 0x432f55acc0953a17U, 
+0xb2bd41c7b0b3da07U, 0x11745f856de35acU, 0x8fabbccc41287df4U, 0x5890c0f334ddc2b0U, 
+0x623d0ae88d3813e0U, 0x55a279ce3e2a8166U, 0x5e4604fa4f792726U, 0xcc9eac788b1d9c04U, 
+0x5f2782aa33ca3ce3U, 0xef2b1865ab6a77e2U, 0x1a95bc1f5312231fU, 0xf717c45d14d3dcd3U, 
+0x6894ccdb50ed88e9U, 0xaf53e2bddc176df0U, 0xca9b54ed0aadee55U, 0x422c40768c99512dU, 
+0xfdc73e83bf780c2cU, 0xffdc67942d666817U, 0xc14b66dd02436893U, 0x6eec95670d54650cU, 
+0x89ec1a1edbfcd32U, 0x79ab66153a07ff89U, 0xfc281de065ea0105U, 0x14bb5350997732c2U, 
+0xc368430d5b28cd88U, 0x738e097502a9bd9aU, 0xc2feb5627f91b32cU, 0x60e269b4f3370b20U, 
+0xe29ba8a42be2066cU, 0x2456138c6c846b0U, 0x609211889728df76U, 0xfe00175a6579f0a9U, 
+0xde04e8ff43fae7aU, 0x6d74f465c3813b8U, 0x1e037acd13e8acaU, 0x2209938b8c24ad56U, 
+0x866f6aa1c7e52306U, 0x53b8e6af17afd946U, 0x28002f3a42008c8cU, 0x9bf8e087b32b55a5U, 
+0x153b1932861cc594U, 0x964bdd1704d0536bU, 0xaa5ba05fcb46855U, 0x799297a1e6739949U, 
+0x9e9110920f8d309eU, 0x27da86ae0bac6e90U, 0xe1069118789fe501U, 0x132ff18cd523c9b0U, 
+0x53d6d6e9019fc555U, 0x8f69591eeb51bd8U, 0xb79470f6ad3da829U, 0xa0e2410cd09c01a1U, 
+0xcf340818c1ac6d8dU, 0x8bbaf19f6b667930U, 0x2ac3b57ba5b2fe89U, 0x1e29648c71bfded4U, 
+0xdc8c47a2572d0abaU, 0xd8d190adc77e1b16U, 0x79ee0eeb5501241dU, 0x2d9be94efe428070U, 
+0xf8f731fb31fa0876U, 0xbad1c67988b710e6U, 0x295ef934b619d91bU, 0xa9708db5e9e898a2U, 
+0x54bd04ac01a9645cU, 0x1e8d05eeb9c3d74U, 0xccc8b4d00c53d2daU, 0xc7ff399f359f33adU, 
+0x119c0cdd46b6edf0U, 0x2a82a5219723665aU, 0x672efcbb7da1ea09U, 0x4dddeb8f46852216U, 
+0xe0c07b48355e8732U, 0xcfa62ede506d1e31U, 0x60cbc6531492c243U, 0x2127039ec8824216U, 
+0xd59235f460cacc07U, 0xd693f3f3bad7bd68U, 0x194b9dbbb7f0a5cU, 0x85219c6f23ae35aaU, 
+0x6f15b01492205e77U, 0xe6bcb55c30a0adbcU, 0x7e1b44c540379e31U, 0xd659b87f2a2ad401U, 
+0xe15820b5b448991dU, 0x76a0b2eb631cd452U, 0xfde13c935acb7287U, 0x845d83f4f6e49e35U, 
+0x6091340cf2083347U, 0x9e1ae3e6771a5322U, 0x97ad0f5aba02b42bU, 0xfab5b54b2bd8e0ebU, 
+0x9ccc9cd83d38fd2fU, 0xc05e37a616a69afaU, 0x3c87aaf2260a3eafU, 0x5758d116186d4150U, 
+0xb4e7eb431114cc35U, 0xa49cd1b2e4b1fb8fU, 0x1f067857de8521d0U, 0x91fa0534bf36fd47U, 
+0x5638b951bc92cb28U, 0x12688ceeccbfa684U, 0x20dd5a3ce0f981dcU, 0x358d02069a62fe26U, 
+0x3f672614ff572554U, 0xf3842e4718f4dab7U, 0x579096770b7ea56fU, 0x685d275727971fcaU, 
+0xb71af6d0a0979e03U, 0xc58aaa2ac0f4cca4U, 0x6e39c8041e0377cU, 0xa82f89c220ab45fcU, 
+0xc7d0b24cc5852e50U, 0x8b2c7e63cf570cc5U, 0xc1f9aa2349ee7effU, 0xe486c7dffeabb058U, 
+0x66ba3cadaecf107dU, 0x694463d63392ebd8U, 0x9ee88a5c9f51e05aU, 0x51fd75ed5606a12eU, 
+0x74502ca378692e20U, 0x63ad9e86c339d0eaU, 0x21ff1441906276e9U, 0x69a16e245a5fcb88U, 
+0x996e69a9b3116c8fU, 0x113d28620f7da894U, 0x6f01e9a4cddba10U, 0xa7c968cd891afc01U, 
+0xc66aa6455c881907U, 0x142c86735b00b1daU, 0x964105cc66ae0415U, 0x4acf44bb8e2ffb7cU, 
+0x2926b456f63cdafcU, 0x99352b2f7cd84b25U, 0x3544285ad10a5457U, 0xad99a8fe0ffd587bU, 
+0x47bde79706bc8d71U, 0x7a39f95bc79b0d17U, 0x21190e12fa0e745aU, 0xdcad8b2a7eefb2c7U, 
+0x470cfe2ea297fcf2U, 0x2726c4077b717b56U, 0x2211993ce07c0fa3U, 0x8bf1287ab91faf9bU, 
+0x82bae0697439383fU, 0x34ffa562b601a2aaU, 0xdd7aa292c8234eecU, 0x4ddf22834188a649U, 
+0x632fa81823d52337U, 0x3dd5d045131f8269U, 0x74abae97d38c0c6bU, 0xe71c627b0d91883dU, 
+0x1f6b16a30ef15db0U, 0xef4c1ad601c829f8U, 0xf3f78331882eba59U, 0x89be840a1731eb21U, 
+0x791d68c71d0b8200U, 0x53b9df77ca29a81fU, 0xf4c5644675e9016cU, 0x70ec8c193cb32816U, 
+0x26dc88155822b4f4U, 0xa5353afcf865df8fU, 0x1334e9e0797bf39bU, 0x58b065791379879eU, 
+0x6607a8210c60fbcaU, 0x1ca4a076fc4e5259U, 0x27ca55f0262836cU, 0x55a98aa4145a2c37U, 
+0xd7273629aa99ad56U, 0x13fea55aad0e2f87U, 0x4dca9848228c57c4U, 0xd9f8b3771d318bc5U, 
+0xd4e919385f5c61b9U, 0x995de59a31f63cb4U, 0xc6551557fb70a4a3U, 0x7aad641f0d22377U, 
+0x4b2bd10c34fe39b0U, 0x8a3173cd74b4ded1U, 0x763a441c23381f35U, 0xa345e058a64b3529U, 
+0x3709480babaf79dcU, 0xce8c6a75ab369df5U, 0x91f0855b28f9d949U, 0x7c6dd5a6d5caa70fU, 
+0x9dde20720523a7e8U, 0x5199c8df557e0d70U, 0x513a7190e5207a86U, 0x4e218f3b641dec95U, 
+0xedaa0ed47090db7bU, 0xab9fa70fcc821c50U, 0x445a159d2bc658f9U, 0x65120ac1efdafa5dU, 
+0x3fbe07b9926695fbU, 0xafd0bb9fe43adee1U, 0x201acb8746d6ccb6U, 0x3a10bf830190a2c8U, 
+0x755c72b2a4eb7e47U, 0xf28fea6c43d45288U, 0x76203848688a65c5U, 0xb5d585b3ec1a2715U, 
+0xd3df8e1b4354f993U, 0x5cd8982354afe75bU, 0xfed9b396fbba71cfU, 0xadbba24f50e000a2U, 
+0x25b83ac1a2af4773U, 0x5c756a550b61eb26U, 0xd3628f1206ac8f2dU, 0x7c112ba338a4d9afU, 
+0x241a8e967d2c8614U, 0xa7b0960a60584596U, 0xca5cf5ac30912876U, 0x12fbddfac9010433U, 
+0xf077bc1d58b0b174U, 0x4d4258239c19f495U, 0x33fd91428cd2cfb5U, 0xa5ff20d290278068U, 
+0xd48a96f55c19970dU, 0xd77460ea61c45079U, 0x1f455e000cdb9fe0U, 0x7c8039bee6f3994cU, 
+0xc25775979ac55427U, 0x3afbe1730e033715U, 0x99fa1ce5569edebbU, 0xbea167d2487ed355U, 
+0x53f764302d9aeeafU, 0x5d0794ca05afc86U, 0x7b8ae3a1faf99a30U, 0x8bece859a2b97877U, 
+0x55a0da3c85f9eb5eU, 0xbb22038f6f8980f7U, 0xfbb8910b0effc368U, 0x35f933c4c50651fcU, 
+0x84b6b8ec2b519178U, 0xb63b9998a43d1fc5U, 0xcfe08cf8b5e2ee0aU, 0xf41d7f4bb5e50430U, 
+0xa7a1665dca6a3551U, 0xab49acc36919e1f9U, 0xf1046de3faa82347U, 0xe6a669bebd9af8d6U, 
+0x2a937e108f089b4bU, 0xd80e91bd6616f3dU, 0xf85bc3da3881ec45U, 0x3b2369ff19ddd591U, 
+0xf065556f67f00f4fU, 0x3970e7b02723e7c1U, 0x2d22213dd27d7876U, 0x5df102ecb29a762cU, 
+0x1a71313e1e3501d9U, 0x1be82ce1bb61fc8bU, 0x3332d691d62d3e61U, 0xd65f827ed62d4e7fU, 
+0xab9446c6eb55759eU, 0x61c13aad5d730be1U, 0x537b7ca5166b87fcU, 0xf24b60fcf09a90feU, 
+0xbb180bc7b8352aa1U, 0x997cd06e999c1020U, 0xc7661093249bff8fU, 0xeca3eef00455b406U, 
+0x85f3ad39ecc12ea3U, 0xa8359b399b78ed23U, 0xf6b863f37ca79007U, 0x9e6bc281e78c25b8U, 
+0xcb62fe240f2ed84eU, 0xe7994df35fe2ea12U, 0x5ee6c8b5782cc0adU, 0x55a9b5b6deb05c38U, 
+0x579dc550546495a3U, 0xe8ffb4d712a0d8f0U, 0x29174d190ed7f43aU, 0xc4f22196ac9f19abU, 
+0xd6d4d26b5e4c47d4U, 0xc20e8839a7615c7eU, 0x41bb5a14a5e51ca1U, 0xf91386ebe69ef8cfU, 
+0x37d18a490e9cdd72U, 0x5b8e120559b73b3fU, 0x606f08dd4849f9c4U, 0xf43574316fed3b26U, 
+0x9bd2cf87075495a2U, 0x9fde1eb648bc00b2U, 0x1f7ed60a62548bc4U, 0x79de576dc7db71daU, 
+0x802c8c6aaaec6fb8U, 0x8314f5096493a746U, 0x785e6dae47dc79c6U, 0x3b2d3d0e6b186a02U, 
+0xfd94a8b61a93d03fU, 0x468f41ce1b0dad7bU, 0xcba214b7fb45ea98U, 0x5c97699d44b7daffU, 
+0x67499ca90e6f2ba7U, 0x20680f3274536159U, 0x238ff9a6ca28f2ecU, 0x4737a353a4cb0fb1U, 
+0xeee92acc82d1e7bbU, 0x24c3ff903511964cU, 0xe264b3695957e555U, 0x8fe04e32162404b6U, 
+0xda759ad0da62e84fU, 0x5b9164646f046a8cU, 0xe5d6cea57a8db34eU, 0x3987db5022f6358fU, 
+0x53009ee20ca9e67aU, 0x7a08f60a51a9ad2cU, 0xcd6783471bd61bfcU, 0xd5b806ea4c696e07U, 
+0x784a6f319b05f005U, 0xaac0b16b6e428e6fU, 0x32f37c90d9e4c348U, 0xd4d0be409375e771U, 
+0x101a4aec69f7c360U, 0x4efcd577e48085c2U, 0x50a94a6368d224e2U, 0x3af4990957edf8f1U, 
+0xd39dc2aa687d7a7bU, 0x48554dd62760895cU, 0x531f86482e733c33U, 0xd1706030d3b1d91dU, 
+0x1c72aa59df7f547fU, 0x1515a21178ff09f3U, 0xccb1033c5c15b297U, 0x12d805c8ae7f1af3U, 
+0x1a31bd8ed1e68394U, 0x8657a4c14ff1c6d0U, 0x38036615a3b8898bU, 0xa431415979654ed1U, 
+0x39a523ae770373beU, 0x213d06221263d3b5U, 0xc1a582f3fe227c4eU, 0x31a7e05c623c8076U, 
+0x8ed78790e90950a8U, 0x8ce82b9951a25430U, 0x21b0aae3423db1eU, 0xc23d2ef3f8d1de67U, 
+0x9ea22681c57e51d5U, 0xc82bc56a88cbc44bU, 0x2f8f451d94774ee2U, 0xd0c2ab52f8cf7ae0U, 
+0x188896aec0b1efa0U, 0x3891da1c8fd0909U, 0x806cff053c532724U, 0x9ea4f0cd1f306929U, 
+0xb42610edcb923b45U, 0xa33a9fbff13e24bdU, 0xd15513462dd98458U, 0x740a66481356d23eU, 
+0xa8c13e3851ecaa5fU, 0xa897993907c8480bU, 0x2f4e4788a75606cfU, 0x7f6d048c25cd523fU, 
+0xa84aa9397512218eU, 0xe9a521b074ca0141U, 0x57880b3a18a2e902U, 0x4a5b506612a677a6U, 
+0xbeada7a4c4f3840U, 0x626db15419e26d9dU, 0xc42604fbe1627d40U, 0xeb13461ceac089f1U, 
+0x1b68edccbf8d5842U, 0xda74be4d8455b67cU, 0x521473143eb337c5U, 0xcc8fe9ecccdaf543U, 
+0x567e1ac9487100c7U, 0x5df1592d458677c8U, 0x75cec6140b91fb77U, 0xc2a5d01cd9f2fc3fU, 
+0x52ef40e2518473fdU, 0xbbb9026bc6973391U, 0x85292ab99728a9e3U, 0x1064063233318ba0U, 
+0xafa6162e785cf805U, 0xcfbe190d0c21d039U, 0xc8e7829e6585883cU, 0x9c6832823b8ba2d8U, 
+0x23f389be0c37da54U, 0x71b0b96cbc1184deU, 0x8006b50f37e86261U, 0x11c881390823d8ceU, 
+0x567c651408ee3df5U, 0xb3e32b21384d2adfU, 0xa42aaf13caf61ae4U, 0x82f5ca516726bda3U, 
+0x3567eec8653f30f3U, 0x2b423ed2eda238ddU, 0x5eda410d54083f21U, 0x38c8ad8ff05f27bfU, 
+0xa060e749ebe9217bU, 0x6583fa982959df37U, 0xf3909654ddbd641fU, 0x83c2617876dcb116U, 
+0x62b66e34fd7046ccU, 0x280398b6e32d8d77U, 0x23a5d12e930f5e51U, 0x3f789c12505a876cU, 
+0x1487856590683e4dU, 0x6320de848e0b3fd6U, 0x64c974dd964e47a2U, 0xd0d9f1b3a291a6e5U, 
+0x543e6911b6ef1584U, 0x77a9a2a38f920cbfU, 0x5858fbe3fd351842U, 0x6fcb8cbce860bb09U, 
+0xc3c9f7c21d3110f2U, 0x5992f6d6928a4325U, 0xd54c0823ac30459dU, 0xa8f1a83d8b721d76U, 
+0x355c95a1fd698f73U, 0xcb4cb3a72a5c98eaU, 0x676e37e7fc8b8d71U, 0x9c7a4efa52a32680U, 
+0x122443bd120cf142U, 0x94b07cd5ea879e7cU, 0x16c424c1d0ade69bU, 0xa2c4a71ab2150c7bU, 
+0xe8f51340462255efU, 0x50d71d346764078cU, 0x73515c90de45b0eeU, 0x7811d0b93f76e2bdU, 
+0xa58bef9b1be3252eU, 0xf51ed0513ad43768U, 0x54c02e9401b85132U, 0x99bb76370bb5ac7aU, 
+0x1bf6578b3517b889U, 0xb998a3f0afb9323aU, 0x3798d6c6e4cb1ecfU, 0xbaf532bfbec94d7dU, 
+0xfa19fe6749fdca6cU, 0xfef1d3823e27338fU, 0xf1b51983b721939dU, 0xe7bcc2a44e4a22d0U, 
+0x93e110f1353d2ea7U, 0x9eed0823a3fa8650U, 0xc7b729d5f816f2aU, 0xc3583d944a8b50ceU, 
+0x2b183e9e0b667bbdU, 0xd6c925a6515f1c43U, 0x5964627ef89fcccdU, 0x53967ac09391e90fU, 
+0xfdf0b36a7a032c75U, 0xa4f6c1826b9d71d5U, 0x346e877e467a90e1U, 0x280a27d97ef8d60U, 
+0x6c3043cb76c0f2b1U, 0xdc7171891f30fd67U, 0x41351993ed79a6adU, 0x8ca3591d1507693cU, 
+0x8eddf0e0502e3099U, 0x53f213a662840165U, 0xf3a0f018bb7ad00dU, 0xd591cf283cdee501U, 
+0x33bc2765455ac5afU, 0x5cf2eff88b116fd6U, 0x4e51330d350bc582U, 0x87ebe5cfc478e6e4U, 
+0xc03562bd884a85e9U, 0xdc75980f62e2fba9U, 0x829800f8315da4d5U, 0x86192922e83c5bc0U, 
+0x34b026a6cf94138bU, 0x72eb2277193e431fU, 0x9f84e2c1fa2cbd68U, 0x9a468a0e4b1b52dfU, 
+0x2b26564632a940a5U, 0x4a435eb5a414e6b1U, 0xc01241e1a4f9e871U, 0xa0aa0d612f3235c4U, 
+0x93f882a68b950422U, 0x6c691cdda7d1bf93U, 0x19b34cf9a0181f3eU, 0x22340eba76f76428U, 
+0x6628d837008e2df0U, 0x32c3b2574328e5f7U, 0x12c29df8bbe0f50U, 0x2eb3910bde2ab995U, 
+0x910cc4ed274eaaeU, 0x9540d120ecf65f49U, 0x77d37d348da4999fU, 0x3f29c02337474b3aU, 
+0xfe39d9aca1dc428eU, 0x10ec719690525db1U, 0xfba2f5bdf8f04826U, 0xd32e851a25c965c2U, 
+0xb551d5b501cfe158U, 0x31f58d904694f768U, 0x45cc6d22a98a8340U, 0x6bec05a1fcc5d64eU, 
+0xbf02b84b682867f0U, 0xa21426e21b190a39U, 0x2aabd16a780900f0U, 0xf6e9db88e64c7ce2U, 
+0x475b3af10f1861eaU, 0x27041ba5f970b623U, 0x81d93b76e8c0d5b1U, 0x53ca790b7ad2ab74U, 
+0x71fc28e6e42f662dU, 0xc681312779800dbfU, 0xf54d0746449c0331U, 0xe644041c2ed2cff4U, 
+0x6711c11d66e6d591U, 0x52e1678f917fd7c0U, 0x4ba0050d00c7b4d0U, 0xbc79ffb9de665acfU, 
+0x9add0438f20d6102U, 0xf06d5378a3453940U, 0x785c15b9b6199a5eU, 0xfd1ddb38760e449dU, 
+0xda0a6491ae003b7cU, 0x163e191211513983U, 0xedaa1f1f7883b700U, 0xcb54b8739050638aU, 
+0x60621d9f7e801ae2U, 0x77b825cffa6774c6U, 0x974719da5058f18dU, 0xbb14b0b942c15ac6U, 
+0x8b0de51e5c1dc5f1U, 0x795e4fbb66856143U, 0x87483ce636bac7deU, 0x96ae967f4513a674U, 
+0xf3f7341dc2c77cb7U, 0xef6d940902dc15b6U, 0x9fe4a73e65ee698fU, 0x61a273c22599901dU, 
+0x854611f81ddb25edU, 0xc5c5ad9a70ae1f74U, 0xf4ea219f5eeb0cc9U, 0x5bbacd334d3ad3d3U, 
+0xdd030872b7314c65U, 0x4c287dfb6f6e6aadU, 0xb59f52272ca6064bU, 0xa626c3f311cb5315U, 
+0xb6607db5a63f1919U, 0xee365bd68035523aU, 0xd949b781e9efc624U, 0xbb882a6b990ec04cU, 
+0xb998d56e377d8976U, 0x5e173a38e30f292dU, 0x4cb02c98229d04b5U, 0xcd2e8e65ef7601b6U, 
+0x11696f41c867bc22U, 0xf60ede0f35428c05U, 0xfc31ce8f2d46ff68U, 0xf58ead362342a31fU, 
+0xece636d0b24e5799U, 0xaf13ce53415b8d3eU, 0x16d066739a778615U, 0x45af3cdde409657dU, 
+0x924a679bf98c446fU, 0x1e0867d2e800dd10U, 0x3b941c0c7496f37cU, 0xa4988caf8a60d7a7U, 
+0x609b306c2c67c998U, 0x9a9b07eaa3cf1b86U, 0x40225ea8a4304c25U, 0x9bd61f9c38223efbU, 
+0xc340af9c28199514U, 0x927d9c1e90424b18U, 0x5c8f2096969450faU, 0x77b20409916c6f5cU, 
+0x1e56f33244c73526U, 0x886df7cdd3beb534U, 0x2673a399356dfaabU, 0x50c2845be4dc506fU, 
+0xa744f4de53d49ab9U, 0xd87e018a680d49e2U, 0xa6a8d73b5fd47d25U, 0xad81723489b95f70U, 
+0x6a45e17beaafa568U, 0xb4cd7a97701e2276U, 0x12ae27a41117a016U, 0x7afaeb4f79707775U, 
+0x3ed53a2f81c1f2dfU, 0x972e694329d39023U, 0x895d14135041365aU, 0xc6efe61933fbd27dU, 
+0x5cd9a87b3cc16c2fU, 0x3d0c0108d3434b8dU, 0x59606dc354dfb1feU, 0xc402240c35341feU, 
+0xc4694cfc55d78e18U, 0x4e33958f7033b3c9U, 0x5df2a69a71d1d760U, 0x61684deb17df1610U, 
+0xb7e703e50e59ddebU, 0x483e629cad1e98a8U, 0x61d94c1496b0c3bU, 0xd9a002227e2412f9U, 
+0x5f393ff80f0af5a4U, 0x8562a8bcab5f18ceU, 0x43c60f8a43670581U, 0x975eb2f93b7a022cU, 
+0xc739a5ea3ecca7e0U, 0xa7d2c98f6743333eU, 0xfef6335224d9428U, 0x7ef2ee3c5c792a0cU, 
+0x302b22dd552ac094U, 0x81b21450dfbd3d20U, 0xa4f67f51d5e609dbU, 0xafb6862730acc011U, 
+0x6db02c92ab896d0fU, 0x5e880be50c09223cU, 0x93539def6986c76bU, 0x646472486e68db1U, 
+0x90d74508a4f528eaU, 0xdb1b895dc63b4f90U, 0xf2b3f5cef9047cfeU, 0xf1f4ee22fe7063bbU, 
+0x72f3583da33f0ffaU, 0xcae4cac611807a41U, 0x7624a576c9d9c641U, 0x3704572716887acdU, 
+0x5fed3fc660fa35acU, 0x57ba3eb7aa8bf2fcU, 0x841bb4bb8895ff4cU, 0x5c6408c61a71e74fU, 
+0x699c584da8d5825eU, 0x7beb467e384d570bU, 0x2ea713544ff03fd1U, 0xd42e1f15292fc71U, 
+0xed1808977a8946b3U, 0xc4cb2ec4b4340cbU, 0x2c1f17a55a85ca7eU, 0xadda2b0a21f69acbU, 
+0x3c6f986532603513U, 0xf6c64dc6814a0095U, 0x2d1eaa42c08bb697U, 0xc2a979e54298db72U, 
+0x95755b2c3c3505b9U, 0x8cc666df48151449U, 0x54278081935bce7eU, 0xef9dd74a1e6eb5c8U, 
+0xdfb7dbf315fc7295U, 0x4307ad9549cf786fU, 0x3fb48be1f115d687U, 0xae67ecd7d603693aU, 
+0x4ff9c5efa4f5b62U, 0xfc3019722c2aee34U, 0x72b94b84a82d9c1U, 0xd23cd2aea5faa6d2U, 
+0xe646ffb1d9fdee3eU, 0x681f97716c302e01U, 0x172bb15cdb17afb9U, 0xc9f4186ab1fc59e1U, 
+0x51e66cc5cced22e7U, 0x44e1531c7b58df4fU, 0xdf73142b8832143U, 0x9420a7f3cb3a341U, 
+0xf9c18a469ad780b2U, 0x8c3b0da6f68440e7U, 0xe19d0c28f9ae751U, 0x44dc4d9e945c7db2U, 
+0x91437413ab93b11eU, 0xb47775e1c2cec39dU, 0xf8fd19dc683f5f95U, 0xdbeb918745c2f9c9U, 
+0xf0cb3e674814f217U, 0xa9da3f7b8756cffaU, 0xb08a0024f83bb6a4U, 0x27dcf55b80480256U, 
+0x14c94b588cf2ed4cU, 0xa4e8fab191fc3bfU, 0xbc8bab094a02a38U, 0xbe18f54f548d5deeU, 
+0x362527575748e77fU, 0x64e639f9657dd5e0U, 0xac8c9bd589d5cf2eU, 0x88a467996ff7321bU, 
+0xb7cbb84fbe6da255U, 0x5f7287ff80c02ec5U, 0xb2703ce8ea583a7U, 0x13bb751380982f1dU, 
+0x75a2a4fd5b9e310cU, 0x313ce5b9b84cfd4aU, 0x9c8d24ac33959187U, 0x3b8b0203b256ea4bU, 
+0x99416605ad19fc9bU, 0xa8ff804b82b30583U, 0xd6176e377c4117a6U, 0x91117c4eb033615bU, 
+0xbc65da82a6bc3ae1U, 0x14bf635521c7ad1cU, 0xc6e95c0a52d798d1U, 0x89cb789f517f1ff2U, 
+0x97c3234e607ff499U, 0xb6fd080bbfb07dd0U, 0xdf6d7ebf5b94658cU, 0xa3a9f5d8efc0f55fU, 
+0x8f1e1e2ba7615b36U, 0x2a4ff1e8c7f3c15fU, 0x105c2406f914c337U, 0xa5e7398c5bcc103aU, 
+0x4d982e3949136d80U, 0x47ffc19370b613c0U, 0x46438def2a15f8c5U, 0x1f3ff58dc974e4ceU, 
+0x40423ade3c0ff1c1U, 0x7b4f1b46873cc23dU, 0xfe08d7bcb9e9cff5U, 0x869cc5794942b544U, 
+0xba20e3931d28539bU, 0xe8ae4078a44f6597U, 0xab2317c57747f0c6U, 0xc4c2ef2e96bdb88fU, 
+0xbb7b0432ed3e10dbU, 0x47732e1ac8b87159U, 0xdee0443ff4eb61faU, 0xaad218355ac9532bU, 
+0x63535abd6fa05fb3U, 0x72032772b31cba27U, 0x3a7dde28fd5f8b4aU, 0x793b1eeebaf82e3bU, 
+0x6701f090ec49e853U, 0xa9cb53529975e04aU, 0x57802554eb5fa77aU, 0xe51416421640aebU, 
+0x336e3d1376405cb2U, 0xf568394190c9ee36U, 0x278eb4a53a91030dU, 0xcf331cea65905469U, 
+0xbf7fbadb5ab7aa65U, 0x43e17e0a2710f1a2U, 0x83d8640f8db563d5U, 0x8525d0b3ef763142U, 
+0xf9be830fdde8648cU, 0xd0dfccc1923f092aU, 0x6cc431c1e676976U, 0xe63a7e111f91fd6U, 
+0xc4a23f1c1dc6afadU, 0x1bd3d92295f80f46U, 0xde8ed25f64c0c677U, 0x977ba06765cacf25U, 
+0x4d62cdc51d7faa09U, 0x2f75a1241dda1a15U, 0x8833faa0d081d999U, 0x1bc3bc43aedb8fa2U, 
+0x29dd16ed044c1b21U, 0xd8432893c3d8180fU, 0xb39e7d7665bc22d4U, 0x1b3e00b320971112U, 
+0x8de24014b7f594c7U, 0x4fff41a9f0b6a9e9U, 0xf11325d9c0df7684U, 0x9b442543faf3e2d2U, 
+0x65f745d7dd81983bU, 0x10220fd02f8eab78U, 0x4c3cb60771fffaccU, 0x3bc328612a123abeU, 
+0xbd99f28511a637b6U, 0x4334885a8fbb848dU, 0x250b305caaf00a7fU, 0xa6b5826ded0c8a20U, 
+0x4f30b43ae18cbd32U, 0xe5e453919505c729U, 0x8171864fbfa379a1U, 0x2a3759b87c0c622U, 
+0xc327f4e1a6cf9ec4U, 0x6419a83a7c8df6d0U, 0x1ea5d75b001e1e1eU, 0xa88356cc1f9f211fU, 
+0x75f76c1ff7c8537bU, 0xca8cacb7441f8061U, 0x51baefe1caf96c21U, 0x67cba4e8e9ec04acU, 
+0x1ceb5057385726daU, 0x7bdf043ed0403f6eU, 0xa1e1c61f2fb1cc04U, 0x5b65ededea1c8984U, 
+0xc828bbee5ab90065U, 0x26ddc475bbfa75b7U, 0x899db93959f2e876U, 0x778468f5252b48e4U, 
+0xc8f76aa2f2d79ff1U, 0x27bbcaef00acdaafU, 0x6f65136a7f01e2e9U, 0x43341ab10eb39ca0U, 
+0x368228ce4b6a1226U, 0x2af9e9c8ab546539U, 0x1a073d686468f392U, 0xc5958ea6d5749993U, 
+0x1c100688c66961d4U, 0x96876dbeba2108b9U, 0xecbe19719d45bd82U, 0xa031a882f70f7dd7U, 
+0x6a9c32597e189f07U, 0x848c9c516ed80d2U, 0xdf310940fa30d604U, 0xdec3480f5d68a92eU, 
+0x1be2ef80b18ca938U, 0xed5f41f8cf2193e8U, 0x436ed448431a7960U, 0x7332d2e4f241e886U, 
+0xe4de3f85b3713a52U, 0x25c75b8c683c5417U, 0xc1fcc0c3c74a5fa0U, 0x83f07bf82e425ca7U, 
+0xa111273f9fb0ffb6U, 0xcab5b760e1fb45d2U, 0x49794c912c7d3cfU, 0xf2ec4f10a25b8bb9U, 
+0x627cf469e42f35fdU, 0x27a76bcfb6baee4cU, 0x99fa24688e7aeb37U, 0x439f864eb2f08528U, 
+0x3865a5b530c62d57U, 0xefa584fc6ea72915U, 0x7f3af4671cb58401U, 0xf56850929086dcccU, 
+0x9ad9a09121ba21b0U, 0xd855d8d200c26553U, 0xe6f680686eae0076U, 0x938dba4f9b5a42d4U, 
+0x374d995e4d5b4325U, 0xcbf1bbee3f2b697cU, 0x6e9aadbdd136b90bU, 0x48afc0a89af75656U, 
+0xe792984f403482feU, 0xa7bf278fafd65aa7U, 0xe70b585390c06d34U, 0x613483aed9ed08b7U, 
+0x55dc8a6d37d1055dU, 0x2bc644b0cabb61a5U, 0x3e6f5f2b4585ad86U, 0xedd7bb3007929c3bU, 
+0xb53e49a63f2b24f1U, 0xcfaec64f5fe76bcfU, 0x3a81daacf3b49779U, 0x7efa89b76ca031e7U, 
+0xd65dc5d4af8e4b83U, 0x1dbadf3ac554a455U, 0x78ced222fc16ab21U, 0xa99ff3ec61f4aeffU, 
+0xf0699bf9e2f2b734U, 0x79c3bb5b5501d267U, 0x634a786f1164457U, 0x224a02299eecc99aU, 
+0x840f585491ec7fdfU, 0x7b704b673c7afd0U, 0x149a08ad871d7fffU, 0xfa41a8d29b6d22b4U, 
+0xa8df3dae1991e607U, 0xe310d10e196e11deU, 0x760f78b8af6b2261U, 0xafd35b35bea5bda1U, 
+0x5e0b73bc4308126fU, 0xbab7d9872155af41U, 0x96d8ee266b81ec93U, 0x3555f48e204e994U, 
+0xc9e92f475d254033U, 0x78368280c2a4707aU, 0xfcdadfa688b6f240U, 0xe63502ee153cec59U, 
+0x7e8aa88968f05e3fU, 0x2c915a0c4bfcf360U, 0xad74e80f0709ce48U, 0xa7c5837b1f621e11U, 
+0x7e16cc51f0b9a00aU, 0x5174da42f93e68fU, 0xa0c7cc97b56175d5U, 0xe5ceac4035eb4955U, 
+0x157ff80e67984a57U, 0x8ceddb7586fe794fU, 0x854a459c3396d1e4U, 0x660cb9301fcd56b9U, 
+0x2b9609afe1e08f33U, 0xb1fd631dcb982ccaU, 0x12ab45c533f000e2U, 0x5648dec272eb9687U, 
+0x26eed9ac4269f1c9U, 0x3e72bbf2e0117951U, 0xf478f5c64d77a269U, 0x95fddc70708f7043U, 
+0x8daa3455e8a5c546U, 0x1f0ea68ba3187b91U, 0x3e774b6d5268d693U, 0xa643c538afc5667bU, 
+0xeb1e337cd3fff857U, 0x4893db480dc64a7bU, 0x460033011cfd3519U, 0xa8d602ea4377db0eU, 
+0xe3b8200bfab98c43U, 0xc5ba57757e3e8aa4U, 0x95152f8ecbec8f03U, 0x1941c19f3380ed26U, 
+0x8fa210da22abe217U, 0xd8f62d3db8df5639U, 0xe2b6db2a48fb8c53U, 0x8e66b834595db2b6U, 
+0x4f556db22343750bU, 0x944995a27d329c76U, 0x8ec64fd2a2b75f9cU, 0xe415c462be67902U, 
+0xa6097c15becd56ccU, 0x6ef691a45ff7ec06U, 0x27bca21077f8cddcU, 0xc3056e7177f984e2U, 
+0xe6670d1042d8c2f4U, 0xd73321b9f79c0189U, 0x7fa73bde364d8a0bU, 0xfc586431d10b4bd6U, 
+0x118c88ffcfd274aU, 0x29e2cb05ebc338b4U, 0x4a33c279e6bdb4abU, 0x99fade52ce8ad956U, 
+0x830ce044e750b852U, 0xa172f111c50c5f41U, 0x3a3b61f117d48acdU, 0x956d85ac3fca3e4fU, 
+0x5f09724600eb56d7U, 0x2dcb5b21adc5c746U, 0x8911e9cd3b8293a7U, 0x371a37ccf6deedf9U, 
+0x12b077f1d1ff0f18U, 0x7e0bce70549a42dU, 0xa9bfbacf9af2d6c2U, 0xee993ba6b0c4f1deU, 
+0x8013876ca50782adU, 0xb435c80df70f2cb1U, 0x1f6c5d58ce85bcfeU, 0xd87fd4d94578db2cU, 
+0xd77107b51f2ca098U, 0xe4066263414b9d7aU, 0x6148a999fe559bf5U, 0xd9bdb44b1b3520a3U, 
+0x7406bbd75abca6b7U, 0xde0c9740ee3ab32U, 0xe5e5518457563f01U, 0x552624fda1dd30cdU, 
+0xe47a7f754fdde3fcU, 0xe5a8889e05628cc9U, 0x8da0dc41a52f31fbU, 0xba49517aae9fe242U, 
+0xa3efd232efcb7d01U, 0xdfde1c81e3292caaU, 0xb4ee4376013359aU, 0xa88fb6e1ca945595U, 
+0xdc9d02357a6fe7ccU, 0xc365429884f435b7U, 0x78a0d632207686b5U, 0x6d354193d97a95b8U, 
+0xc41afb5feebdbcdeU, 0x5249918f8b53468cU, 0x3f44255459cdb568U, 0x6f5d4e0da0883528U, 
+0x78892a2f7d14da68U, 0x4a64c1f84dd20173U, 0x4de2cf82737612b5U, 0xd3398f17422af1baU, 
+0x3f07631b55a90e3dU, 0xafc7a7922d41453aU, 0xeb7252d1e8a2b020U, 0xa34ad4d4d1fd3d60U, 
+0xea6065ad7789b84dU, 0x167d5ee4d1041ce2U, 0xcdb5d111b56493feU, 0x4a89a61457374b4cU, 
+0xef9b7d7f018e3ea8U, 0xa72e280634711999U, 0x8c2ea979fe677e6U, 0x45b04e87ed480d5cU, 
+0x20049d0364e11f7eU, 0x3bdbbc488e7cdb08U, 0x8aa4bba0ae54ddc7U, 0x55b66e6dc586296fU, 
+0x4bddc671c77d076U, 0xccfe610621b594f9U, 0xc386cc04cca223ebU, 0x9043a91f1dd1419bU, 
+0x6e76b23742e14c34U, 0x834c5ebe07327593U, 0xa2a9b30e781377c9U, 0xcc9f9648a870ef92U, 
+0x8892157a94be556bU, 0x299917f1828c7e05U, 0x43116633dbe689dbU, 0x829bff2cb5f8c96fU, 
+0x2046400ecc4bb506U, 0x6614d6a97448f01U, 0xab1d0013a1821a0bU, 0xdb3ebc91cdcb79a8U, 
+0xcbdd181f49b3e60aU, 0xb21826f5e8f7d202U, 0xaf1a685e85539258U, 0xa95a64538a676683U, 
+0x87de6c8595de4837U, 0x8d4286c82de5e74eU, 0xf4f58c1d0ad98a75U, 0x5c618da1faad041aU, 
+0xc0b8583b634a7deeU, 0xecd36649642278caU, 0x88b80e3849fd9671U, 0x4c719117bcf3a19dU, 
+0xb6ca448b40dc67c0U, 0xf08dd2bb64e18d8cU, 0x67de7cee87eec09aU, 0x22bdcb12aae2c57fU, 
+0x8a9a5c843b0e7ddbU, 0x75fcbf3b3b89c774U, 0xb9987a8f0d909c47U, 0x53ef0c95ab3e7dd1U, 
+0x2589342656635396U, 0xf2cae15a368a6c0cU, 0xe585e2dde671c11eU, 0xab8a886a915a06a2U, 
+0x7e38fa6a3fc92c23U, 0xb9360583f7d2d6adU, 0x5668ff8248bcd5abU, 0xe773cf7c7da84319U, 
+0x4f5c2279ade5d1b1U, 0xddfa9e91c66ab702U, 0xb92174e3aa64a3bfU, 0xded37dd152738517U, 
+0x81cc777712c778bbU, 0xf43b076d59128448U, 0x2b3caab3824544b8U, 0xb14e3c5a84e78c40U, 
+0xac243e5881df49c3U, 0xa9e890866d069a35U, 0xdec664b8b695604aU, 0x62b7c8514241838cU, 
+0x9be3680ff6341c21U, 0x8fb53b61387cb550U, 0x594896ae8d4922dbU, 0xa71ed62152ae0335U, 
+0x14aed835cb801e98U, 0x4107e653812f738aU, 0x93db846167f0e960U, 0x66cba1d92cd4a26dU, 
+0x5250d590dedaa27dU, 0xd6ade86959a30e4aU, 0x66d9066ac3917211U, 0xfd5ef5e6e6fbf966U, 
+0x3af146e2e44f47d0U, 0x1b59f5de949f002fU, 0xf9751f0869dfc979U, 0x4897bdbfa45c89c5U, 
+0x81e501aace1320bfU, 0x526da001a8f01195U, 0x34e8eca9417b093fU, 0xe77dc20f7afc138cU, 
+0xfa41e92588e11179U, 0xcebb8dff96c18e27U, 0xb9e33fe845fa5f29U, 0x520dcd49abd6d7a3U, 
+0x38f2b5ed1f6a40dbU, 0x4175a50fda6be47aU, 0xa20562961f6a5779U, 0x360604d1b132f797U, 
+0xe61bce9b71581bd3U, 0xcbfa318df6190786U, 0xc451e07bda722f2eU, 0xeb1cfcb556486576U, 
+0x5bce8d985cd98a09U, 0xb39cf319c5bd1a64U, 0x5044005ebe4d6e3cU, 0xfd47ce7571f94d20U, 
+0x2781cec811281711U, 0x322c52732fa98ed7U, 0xd5d0927a529d94a4U, 0x6b087369f3feef1cU, 
+0x4bcd9b5108ec5d1U, 0x1327be68971fa79dU, 0xfcc732c222b78cdfU, 0xca9dd09cc5bf86d6U, 
+0x90122bdb673a3111U, 0x18b82e417b4c818fU, 0xc0d54ac2e72576a0U, 0xa1fd8bbbe48e1e09U, 
+0xb887e650b8c704efU, 0xc7ec4945bfd51169U, 0x9bd77e07bc0916c0U, 0xad215d8a34a30856U, 
+0x3438c84a72bd05a0U, 0xba82337d0b1fc80dU, 0xedc2f995f36d1f90U, 0xe5e892363a31885cU, 
+0xc936de2be1a69f5dU, 0xca73995b9cd099aeU, 0x1301eb01e79b5c3eU, 0x77439de4da1b87d2U, 
+0xc665cf973b4df41U, 0xfe6784fa0f696a51U, 0x44d95fecd3177c78U, 0xc827ed763ffec8d1U, 
+0x2e5b6a2380f91f4aU, 0xbfe9a6106c0047b3U, 0x60e17d7b66ef3cd3U, 0x1e4c4475f2da5ed5U, 
+0x4f09528101467d6bU, 0x357d712952a24b51U, 0xd1018611642cf1d8U, 0x5d2393df9435ccf5U, 
+0x7c673c6b1bc5458U, 0x72a707a7510473a8U, 0x7acbd85b2d5af46dU, 0xe66e63f263fd0f7dU, 
+0x405904b346340d60U, 0x8998961b956e7dc2U, 0x25ed93eeb3c1587dU, 0xb511001491b74657U, 
+0x68cd6178653ecaa6U, 0x8fb582b118594791U, 0x72ab899ef769f978U, 0x9c3981f431fe4c46U, 
+0xf0b1e93c9d159f7aU, 0xecf93a9cf242e590U, 0x3adcfb2bd2ff873fU, 0x453657a53aab893fU, 
+0x99c22b708a02fb78U, 0x6f949bd4e81dda5dU, 0xda2ef0913a01c728U, 0xbfb5aeff88023dc5U, 
+0x973276c64cfb1a94U, 0xa32f06e363cdcde9U, 0xffc3dda2e480e645U, 0x27a0c221b72432f0U, 
+0xab98f8c2d4098584U, 0x91e3b03d78674297U, 0xf2f2ef8dc1821e9dU, 0xc3f6ab3eb3a0a792U, 
+0x31ededf3d46cb42aU, 0xbc052853a7239093U, 0x4d14adeaa13d73e7U, 0x435b54cb07b04c46U, 
+0xb7e24deddaf72dd0U, 0x5edc4c79433949a6U, 0x49f4a54cc1e0585dU, 0xd726c031e4718a1aU, 
+0xc193d479678e27d3U, 0xc12883ed0e4c688fU, 0x1cb2f03148e4774eU, 0x60aacaeec40e8409U, 
+0xff7c610228c4d2deU, 0x46d400783a680f4bU, 0xda54f7c803de04eeU, 0x9677dffcc5def66dU, 
+0xa97d941b1d2fc263U, 0x89cf813e5b65d57bU, 0x19fbc47c4e13da0eU, 0x1805b819e14edd7eU, 
+0x266470b4f0870ec7U, 0x9c8c1af8e551ecafU, 0x5858daa86bcb3148U, 0x101f642809438171U, 
+0xcc326b493d9eb773U, 0x6319c47b85cae6cfU, 0x612c78017b1c51e3U, 0x79481a2aab0f1180U, 
+0x37d96c11c1162620U, 0x8cbd8693297f950bU, 0xc6d9625e70f28a4bU, 0xdc61463f8555e09dU, 
+0x9a2b1b70c076d1dfU, 0xf41e2081427fa1b3U, 0x40617a8a2a775f45U, 0xc73aaf4366d3194fU, 
+0xd279d516e5ad6605U, 0xf75b57a51d893720U, 0xf9ce01be3bbcdcfeU, 0x9201ec69eccf916eU, 
+0xaf71acdeb0028fe6U, 0x3fb37fc78e50f376U, 0x5a861535e82bcc35U, 0xe6ac0ad271bae59bU, 
+0x6a51064068570fb1U, 0xc5ef07bc43191afeU, 0x8b6999aeefed3475U, 0x53fbe5579ea7cf60U, 
+0xd3683f7985a745c7U, 0xbc8a2738c17eac07U, 0x77189b6af61d52c1U, 0xe3ddee8f7d5c36d2U, 
+0xa39f0940778efcc2U, 0x7c28c2f17bd027b1U, 0x1be51b86aa7bd8f4U, 0x487199d391932b87U, 
+0x526f51dbd2943e92U, 0x69bab975255a517bU, 0xc0aeda8052ac58b0U, 0x2fa496cc907cae20U, 
+0xd5264339738a13b6U, 0xb1507f3e1d1bf694U, 0x3f6c08acb28b6433U, 0xe7be908162a44887U, 
+0xf4c733e84d4170b3U, 0x40144156fc3a3587U, 0xaf68aa1186c0a1d5U, 0x45c78ddc2035f1e5U, 
+0x16efa3ed511faa1dU, 0x2cb046606420cc73U, 0xb0e1a9d144fb3a51U, 0x11af9946238d5c0cU, 
+0x21579992fab5c2cfU, 0x5312f0c21fb084deU, 0x71e7474104fa90a4U, 0xe4107e431e221f50U, 
+0xd028403f2b955c2bU, 0x3c7892dcff7b2410U, 0x3948c668741c2b32U, 0x1e5f11e6cf701c9aU, 
+0x510f99b4549e7a36U, 0xa0654d2666872435U, 0xa757f11164d63319U, 0x2d5295db41e6f839U, 
+0xddb68195ce32eb67U, 0xea7b44f99730ba3bU, 0x3af16cac763b38c6U, 0xf98acf2806807232U, 
+0x5bb5b63c09b67b7eU, 0x766b7b2b911c3d48U, 0xaacf9701debc1142U, 0x85df9a65ee179f7dU, 
+0x88b3869e830a36e3U, 0x86fa949d1fbc6ea5U, 0xbb6b7d5eff0e2973U, 0xa6b4b7aa39af6308U, 
+0xcfed817743a29747U, 0x32242bc07eb98697U, 0xff26ec4601bffcdaU, 0x3877152e0bbff37eU, 
+0xba573e25f24d4637U, 0x9fbd1f6ecffee641U, 0xbe16116cb99d3730U, 0xcc70a7f9014bc61aU, 
+0x127cfde60b3510d3U, 0x85d3166704a1d6e4U, 0xa8d8a1865c2d2928U, 0x23c493fe7f9fcd08U, 
+0x13462ec43ae89a47U, 0xf799e35e26b9dbd7U, 0xc275d9e4effe6d8U, 0xadf456a9e4341423U, 
+0x6a447c3b80ab86U, 0xc86b3488933e6f3cU, 0x8d114540d125257U, 0xb8dc9073c673523cU, 
+0x2f61194f048b4d6aU, 0xca4d4599db3ce9e0U, 0x4b5dc67e84141863U, 0xec7787216fd41e68U, 
+0xacc691808b49a71fU, 0xac36eb6c64227c39U, 0xde5993ebaaf235ddU, 0x94406d0b314dd0edU, 
+0x471c1944d0b249a9U, 0xd0e27261ca63cf94U, 0xcd207c90906fe897U, 0x61aae77e864df179U, 
+0x59469a0606bba654U, 0x5e3bffbd135ea79fU, 0xa67834270a8e1649U, 0x437a6a6e40d04569U, 
+0x3755406037a7c0f3U, 0x14a7c3761938d410U, 0xab24825ff34dc5a0U, 0xc2911e15587f2492U, 
+0xe5cde33c60e50c32U, 0x77f10972e8c6873fU, 0x337136df5bee8d38U, 0x3c2ebf43de886c14U, 
+0x9e2f8917ca93c124U, 0xbe2d08c39ae8c998U, 0x6525b93d202e28e7U, 0xa703d9a6c5e8399cU, 
+0x5bc04662647394eU, 0x9ce5a7a96e9e45c8U, 0x5ac96720bce3bc61U, 0xa6cd740bab120fa0U, 
+0xc66b62b3f119695aU, 0xb59355675ccf55f0U, 0x4ff66a2d4a663c77U, 0xb9fc0fe7c1b0fb9fU, 
+0x7083d9dec3a2355aU, 0x99651bf35c604990U, 0xf391e5b89ec55f12U, 0x987536d727940eb9U, 
+0xf0c75c4c1bd05276U, 0xb85f6c7c683adccdU, 0x43e0b1c149e57b48U, 0x12f19ad674f11172U, 
+0x91f23fe06eb8394cU, 0xddd80153cdc93b32U, 0xcb94cd05cfed4c53U, 0xc2e65b9dc8bbc43cU, 
+0x6cad3e4383f6c688U, 0x3fedf8318dbd4924U, 0x23948c9d2f469724U, 0x36cb9b541bdf3dc2U, 
+0xb0f0547c52f3ec22U, 0xd1f86dcf71a8f8a6U, 0xf19d38b17ef2ddddU, 0xd515ac409a4c4468U, 
+0xca1462eb25a2863bU, 0x4cd57df0031b806eU, 0x1ea5e4840052bd46U, 0x51c0481422449b2eU, 
+0x3fd1e77f6e5942d2U, 0xaea9ff28380169ffU, 0x5e63491acca09e20U, 0xcc99e1f3854d3214U, 
+0xb3e040022a099464U, 0x357b613529cf9112U, 0xd976c9d49e0031b5U, 0x31e28f89d9a5a4f4U, 
+0xa59a1e9a5971c857U, 0xdec99e6dabe6093fU, 0xe2453cc38b61cf3dU, 0x70b9d4985e5b0baU, 
+0xff9cb63dcac8dfc1U, 0x33a83da1ec5461aaU, 0x86b810ae46373cfbU, 0xed80461bff4b6250U, 
+0x57c84fc9d789bd85U, 0xfc35ff7dc297eac3U, 0xfb982fd588c6766eU, 0x447d739beedb5e67U, 
+0xc7e33c972e25b32U, 0x3d349b95a7fae500U, 0xe12e9d953a4aaff7U, 0x2d4825ab834131eeU, 
+0xeb0421211a6b665eU, 0x802f779ea7f6803aU, 0x47501f2a3c0804c3U, 0xa263919b4945a1d4U, 
+0x9ee4040030bcdcfbU, 0xac3f83df4c00efe2U, 0x2e9d3c9de60d60c5U, 0x873200bd2aed20fcU, 
+0x73e1998edea6db68U, 0xddfad856082632c2U, 0x58b14df965def4f6U, 0xf8b6533e03ca017fU, 
+0x69bd25b0ae760da9U, 0x6bbd70dd9c5ca0edU, 0x2f046dda50aa3ec6U, 0xc30f4ef5ec445486U, 
+0xf6f1d3ac4d771f0cU, 0xacad16e63be0aea8U, 0x18e63add579547f0U, 0x2890d721e57e1961U, 
+0xa5728ecb5890d78U, 0x7dc0e7f77ef54069U, 0xaf77e1d1416752ecU, 0x69b5b8159ddc032aU, 
+0x66d5d4ebf924e753U, 0x5f0173072cf8727cU, 0x548ef18729edfb75U, 0xf35289d35582847cU, 
+0xaa45b5c2eb13a20cU, 0xc562fc57292d0f04U, 0x93df08a1b50e1bd8U, 0x75c1781ec5ec13fbU, 
+0xf8b6930d2670213aU, 0x946d1bf2af7a9da4U, 0x5430c3c0595033cbU, 0x929f5cfaec5be480U, 
+0xa53059c5cd486f14U, 0x1b383964f7f20170U, 0xc5ac64bb51e39045U, 0x29cd3692293320c6U, 
+0x2395cb673018017eU, 0xaf141fffd6df23d7U, 0x4834185fb6734e01U, 0xcfd06b74da441716U, 
+0xa0ae7be4ce0dff50U, 0x3030786b779777U, 0x8103b39587da7950U, 0xb647b7a9b72ba913U, 
+0x4f5822efac7e9e44U, 0xd4e3ff5e71da1781U, 0x81690628033de305U, 0x7b8b8867dd4d9c6fU, 
+0x767022aa8cd12c3U, 0x64057e6dbbd72365U, 0x2246073c7dd5adb5U, 0x8bc6273e511680b4U, 
+0x4c81905792db860U, 0x81089288329a247bU, 0x1512d6d08f15dbe9U, 0x755e74c4ad5dcd1U, 
+0x7d6600dba0d09849U, 0xb2937464cfc2777aU, 0xd249b2d823815bc2U, 0xfe16afa753ad9e4dU, 
+0xc6327e20cc2f3082U, 0x585e6c58dd17aeb9U, 0x7bbf9038d79bff6bU, 0x823c8de5a5e97dbeU, 
+0xac1b42a9958bd76cU, 0xcdf006775a45964cU, 0x17edce97abbfe885U, 0x61fba612a1e936cdU, 
+0xa9ef6955ea26ba6bU, 0xdd2ca2a496da12c3U, 0x68a10c0d7eb0bbdeU, 0x88fba84cc372c969U, 
+0x80414781e44972f8U, 0x484a9e28e00cfdceU, 0xd266da45b514788dU, 0x512aef649d39be0fU, 
+0xeee143c1f0f870d2U, 0xcf8a00249e4d1558U, 0x2faea8e759acd21U, 0x5f0c3cabe40ede9U, 
+0x5f537c956e60e8ccU, 0xc2f725737aeb5f8aU, 0xbce7a5998ab1ac23U, 0x34b55d934f6d2c56U, 
+0x39c48a4294720cabU, 0x1a1ea5d41739b17eU, 0x8e50f6e7555c6f2cU, 0xe1a0accbec055bebU, 
+0xa6d453f574b185c9U, 0x84a2a71d080254eU, 0x1836f83077eebcbfU, 0xe07968fb7e98c854U, 
+0x3a5357fbc1f6b0baU, 0x8101deba1f12354dU, 0x1fd65b91abef8070U, 0x9211ea4a827801d8U, 
+0xd91415f9a2b8e349U, 0x4ee478b7af28bbb2U, 0xc74ba7e95899cd44U, 0xe7e91892e2152ab3U, 
+0x2a828fdfec26c42aU, 0x249bfb7e46b11bb6U, 0x50db358931e7e6a0U, 0xae93b86e6a73c7eU, 
+0x91063343b9f808caU, 0x278a39eef5aadb64U, 0xa942e3edc1e20b37U, 0x7028f6dd14787e13U, 
+0x1ebd8bac137de736U, 0xa2f8d5618688ce24U, 0x8937542b8cdec18eU, 0x9022e314949ccf3eU, 
+0xf4ef5c0844c42eccU, 0x7f49366c44ea7657U, 0x66d0bb045226ce08U, 0x2fae5e4f2904a394U, 
+0x872e52cf757a603cU, 0xe130a96964396297U, 0xc2731f7801b1133eU, 0xa77663f5fcdf189cU, 
+0xd91745804ca8e468U, 0x8ab86c568cbace48U, 0xdae982fa5476a35aU, 0x4e139cbdaddafc58U, 
+0x91706cb8d09b01f5U, 0xf73f35183273c051U, 0xfb0f2d3f1af7857aU, 0x6e5872e3076fe945U, 
+0xc30758d9abcd5fdeU, 0xc13179d4e09a85a7U, 0x80cc1d4af3bef0ebU, 0x4213c02ec8d77171U, 
+0xe83e2130461dffe4U, 0xa93d696bf79b5582U, 0x12911d2965f2870eU, 0x1a7098d2db889a11U, 
+0xf3ba5eed161315daU, 0x68682783de26b553U, 0xe5a42c936f76f327U, 0x39d474f5ee8b69faU, 
+0xb539b747efe45b1fU, 0x7bd155fb2e6168c2U, 0x4afd1e344c17df82U, 0x292220b1a5da3f50U, 
+0x5fe40b8b534bb026U, 0xf7c344304cdd4104U, 0xe37c795ffae98d7fU, 0xe316a0532bf175aeU, 
+0x493d0686db76ed9U, 0x63b807e9a1021509U, 0xcd6cb74ab4e765c5U, 0x7da5f99d3d6c3e86U, 
+0x80f1cf939752c9f4U, 0x191cbb6b8c720131U, 0xe529dd1342c75643U, 0xda269ac028102f19U, 
+0x3e850662a3abd540U, 0xe8040654b166de4U, 0xc3224f8721093a34U, 0x3644e14807a44f0aU, 
+0xe1c6fe1cd55da631U, 0x177ceda66fa14dU, 0x11c285309fa1e293U, 0xec5a9150dbc27976U, 
+0x84100f6f2472c9aeU, 0x1a078f4b263234f2U, 0xac43ff1f15417fe9U, 0xffd92260ea330bb7U, 
+0xa0cec1d866d03ae4U, 0x263d2e9c868b8a34U, 0x5999633225711e5fU, 0xcf4b93b0ba211147U, 
+0x1a2fd21e89142ccbU, 0x4c920a5ac687ede3U, 0xe55b38f4993bb482U, 0xedfe7dae17fcd838U, 
+0xbb951d31ac593d75U, 0x1da442b69d51142eU, 0x61855d2b4f55beb8U, 0xc88692122e0daf21U, 
+0xcd2c725d04dfb784U, 0xa8239331db50a97fU, 0x237d162a581b7c63U, 0x34a8fa8c48884176U, 
+0x213b4be5247d5003U, 0x2e73fc51a1eebd57U, 0xcf3ec31a3fe1e53cU, 0x51d8381001dfdf52U, 
+0xf3da71c64a41b208U, 0xe7f7475cdee27000U, 0x98714026bcea0de8U, 0x5311968b4059a695U, 
+0x691e1f9e048e4b69U, 0x3b3c1dc02436877fU, 0xa6c6581e33b3da11U, 0xb78d732b3dc22978U, 
+0xb544b022450cc54eU, 0xdf180f578c520280U, 0x968dbd4d1d0d26faU, 0xa826e880bc8555baU, 
+0xa463b4d6ccf176daU, 0x5cb680fac4c8ded7U, 0xd8c52f2ee5ec51a2U, 0xaaf394288cbfa120U, 
+0xb3d01b5c495daae7U, 0xaf46e6ec7c7033bcU, 0xf7a22bf6f560e1d5U, 0xf65dd1f22ffba594U, 
+0x8d4e5a99c2556738U, 0xeb06180f9eacd9b2U, 0x20e6fe637cfc4cd0U, 0x9d71b820ce1b66e8U, 
+0x70862c0c4bf4b3eaU, 0x7126e7f99f8781c2U, 0x31a9a309315a28fdU, 0x8dc1f3f37aa789dU, 
+0xc2c42a8650c5e9b8U, 0x920564232cae4286U, 0x164c269569d32f93U, 0xb1e8b4ae7aff7442U, 
+0xabefc15e3afcf1eeU, 0xafaa80472069a11U, 0xb41bf480aaa807c6U, 0xa6670e7edccae248U, 
+0x378870abe0c67fc8U, 0x1ef39891c93cf38aU, 0xa395f72f4957ac13U, 0xa7fd14c93a51c2f3U, 
+0x741145c144cd3397U, 0xdc34c10619515eb5U, 0x89386cf2b5156dedU, 0x73baff0419eda723U, 
+0x41ef2a139adcb8e4U, 0x779ef92cf8261349U, 0x6a00d1e8c18f825eU, 0x1e97de634977ac5fU, 
+0xacc1fd7cdfd83618U, 0x140b55dc318d93bcU, 0x36ca35ada0f4871eU, 0x6fb5456391ba4305U, 
+0x3f39f5cb02430626U, 0x2f1e6499aae5d33eU, 0xed3b68c52109dabaU, 0xf663d87766c6b8a3U, 
+0x7eb0f952161fb913U, 0x3e10246156d31297U, 0x344388de44bed04eU, 0x45f8330c33e60a18U, 
+0x70d4817c0c15c3bcU, 0xf06d0879f6fc3373U, 0xf80e8076d8ba7760U, 0xc212cf6dbfd6906eU, 
+0x357bdb041cbd9a71U, 0x42d91e70b46ef479U, 0xa145c7ebdf98e4b9U, 0xd554ded0b2862113U, 
+0xa43a4a8b3c8cc32eU, 0x5f29fea9a7a61c99U, 0xff0f7ad45ac39314U, 0x74b8f94b6c36708eU, 
+0x5aef9691ee393654U, 0x965d4be1f3edd7c7U, 0x65f5a01c8bcd5991U, 0x5544dc49acd7bdabU, 
+0x23610bbf8f53206fU, 0x241efe9703d58e73U, 0xc04c05b5b8935192U, 0xed3e85895087fd4aU, 
+0xe8b93f55bab5593aU, 0x44ce7343e662a7a0U, 0x54e17c99d42eb14fU, 0x44130b2ce9e10135U, 
+0xe3a5763dbf5b8e89U, 0x776d1bdecdce2e3fU, 0x31ca51215b0580a1U, 0x49197fc77907224fU, 
+0x13f3599428a15dfdU, 0x741dbac025fa9e55U, 0x4b3d2ed55ae2f695U, 0x2757b790619ee773U, 
+0xfc8e840cf042c341U, 0x1768978a3ca7156dU, 0x5cc975213cd5500dU, 0xdf46d2d554c2b12eU, 
+0xde82817f3be28c8aU, 0x9f61776622130485U, 0x63c4e45429625171U, 0xb889d78bcf05f1c7U, 
+0x3037fe51eafdf89eU, 0xdff631e5782fb8c3U, 0x182be4a975c700eaU, 0xbabb0b07fa511b9bU, 
+0xefedf426bf840a5bU, 0x148cada5d3ad4984U, 0xd98421ccc1143ccdU, 0xe872437de50e2bc8U, 
+0xb84e58551377e86aU, 0xac3a346cf9396464U, 0x593bc91f66248bf5U, 0xf984bc8912729616U, 
+0xc95cdd857968488bU, 0x9bf259ae601fad6dU, 0xe090d2df5125fd3dU, 0xd8117a991a354ec2U, 
+0x45b6eed915801a3bU, 0x1401533aae5c02d2U, 0xb0d19e6a01b6eff5U, 0xe4ebb986182aeaU, 
+0x4956a9b8b36afd6aU, 0x9261fc50a1781e3dU, 0x392ef6d5e6f3334aU, 0xc56cdcaba4d775c0U, 
+0xe6086beef3f87c26U, 0x66f483b2568cc723U, 0xcd2edeb17f594ef5U, 0xd16056e2f386b070U, 
+0x44b05f8625e92803U, 0xb14f6191e97c17afU, 0x6ca2519f3a756b62U, 0x94054f36a1b6bc14U, 
+0xe1e9a9b3786f08dU, 0x9e6e5d1fe37f86aaU, 0x4b0d80d7ddae8fc9U, 0xb848d8f95e4c4c07U, 
+0x1dad980d2cfd2cd0U, 0x23941334419c0c13U, 0x9cfd28583e48abb1U, 0xd3d6e6738f3ff286U, 
+0x4c579c77794ae2dcU, 0x1fa568c2f6f8f1U, 0x536da8ff737de59bU, 0xff448f5fcd159b68U, 
+0xcd7aeec0bacba6e6U, 0x77dd55ea7721089dU, 0xb84db41839070193U, 0xf99a41f785fee4d8U, 
+0xde6e6d673d26512aU, 0xec328c8928e4b570U, 0xa37757c917f8be49U, 0xfb3296aef4c8145bU, 
+0x9588855dab7a64cU, 0x56508d6a3a09ab7aU, 0xb03132d72237d406U, 0x88f9778856e45c07U, 
+0xa05e98e11575f103U, 0x36c30092216d2673U, 0x34531af257969e58U, 0x4a745cdd46b55c74U, 
+0xe2e5fb31fa4e33cU, 0x2683bec78b098cb3U, 0xc974446c2976fb98U, 0x9cf646b91a4c25bbU, 
+0x19c45e060e0d4563U, 0x9e205827ebc16032U, 0x1e408e258b821f31U, 0x37b0624dc1f65a89U, 
+0x8c496939c224ef48U, 0x6cae5469245e15f5U, 0x35917f8d5547844fU, 0xfe251903a4523298U, 
+0xae6960a05136dfa7U, 0x455aaaa1c321e408U, 0xd836b9405a1b36a0U, 0x4fac9cac97ca9be0U, 
+0xe98b618cc6bf1e67U, 0x4c566749fe5caf63U, 0x9d7a653827764e0fU, 0x83cb43de151b6499U, 
+0xa27ee8b3099acc97U, 0x2874422cbdd1169eU, 0xefb1806e624418f8U, 0xbce28ca24b98f6f8U, 
+0xbccf5cb64d405a74U, 0xcec29f6bbdd3e7a5U, 0xe2c3b6c3f6131016U, 0xcc411e541368f9f2U, 
+0x645be6b618d1bddbU, 0xbe4fc2009f16fb0dU, 0x571527fc350186d0U, 0xfecb812fac774584U, 
+0x230ad748dc0f057eU, 0x84e8628701d53dd8U, 0x3340fc15e250224U, 0x3ff3b3e560ceb08cU, 
+0x2d41f7daa817965eU, 0xa010236ec4701762U, 0x6f7fd17057867843U, 0x7f17ad6f3bb6578fU, 
+0x74d4780e769ebf5dU, 0xd64fed987e38c62bU, 0x80dc73f390d4654fU, 0x84d6e7f91e9d174fU, 
+0xbb0586f1662cc379U, 0xb14a9f3aa8a268f2U, 0xe4f7033de50ad159U, 0x555f4e86e407c4dU, 
+0x15114b40325e69f1U, 0x6367a8f2d422bcb5U, 0xdda19de173d6af99U, 0x6e9edb2dd8ffd83fU, 
+0x720e17e3402b7e9bU, 0x1c727454799f281bU, 0xab3556ab65f3bff6U, 0xc0822216ceff954eU, 
+0x96282910aee1337bU, 0x898022a45c4a1b1U, 0xca356ef3efc35de1U, 0x8c6c923cf1a4351cU, 
+0xcb451d5cd9c84abeU, 0x845362c1c6ddfa2aU, 0x5efbb2319eaa8e84U, 0xa1256fc84d40ff6aU, 
+0xbf252f66a288f038U, 0xf0876894eb5ff820U, 0xefabc19de6ec2d32U, 0x5ee280e804c41c4bU, 
+0x1c5aab86b6f1ee6eU, 0x11d7833a98e6c6f4U, 0x84c0586fecc9eec0U, 0xbcd969f94677e392U, 
+0x39d6c50353e90f60U, 0x99a2d8e1e5c4a7a1U, 0x4521668b55dde953U, 0x6a2ae3e9c7cd7eb0U, 
+0x4e349b189a948322U, 0xf3d4d34082a6f7e6U, 0x6faf20a6219efe23U, 0x4bf6b287c0264e85U, 
+0xa0bf3256c0c708c8U, 0x2c34304f2f70a86aU, 0x6dfe365d91fe288cU, 0xe1f0166e05c20573U, 
+0xe718d73b3896ed38U, 0xfb655f22efb5a00aU, 0x444632be8a33016U, 0xe647653e916c3b52U, 
+0x18c8936f8c320512U, 0x8c3e4465e863c513U, 0xb0e4f5640b722588U, 0x4ab0c75e4cc5f45bU, 
+0x33743af64f0a792aU, 0x51c3714292fda61aU, 0xe8948891d80d8c09U, 0xb04daa0234ae0af7U, 
+0x7e0f09ca476edefbU, 0xdd58bd80100e7d5dU, 0x7f121ab42979c7baU, 0x28089687abf6345cU, 
+0x2ef457229d1b0ae0U, 0x4dd31b07be039212U, 0xa67e19ebd90541c4U, 0x5d071cf33d3b3191U, 
+0xb923dc396304c13fU, 0xed79ea8130092a10U, 0x22824b73d2e6d3e9U, 0x1f637ef68fa60728U, 
+0xa69ec6ed13b60200U, 0x7d98288cbbbb3438U, 0xdfdbdf045d762e0aU, 0x8fe2c91f76bdae23U, 
+0xd12d99bcf344897aU, 0x7b9ed3075a4c269dU, 0x70585e852425edabU, 0xeb15b0de281904cbU, 
+0xad9de83ce5bfe7eeU, 0x814698b2f97d0b82U, 0x898aaf8cd732f85U, 0x96cdd169c266071U, 
+0x826fadc0523b716dU, 0xd238966f74e1a6bU, 0xe8a5c7938d18df9eU, 0xf81f5be38b8ca534U, 
+0x464002f512632401U, 0x660758503a878330U, 0x1d56d29d380e0328U, 0xdc7f49329c1f06dfU, 
+0x46e0c52790789539U, 0xe4e1a713bd05725U, 0x158ea76280d63182U, 0x7459e772c29c4c3fU, 
+0x3cdf5a471439d97fU, 0x383af5e04f7db391U, 0xec7e8e858a2ec1a9U, 0x892bc7f5183444eaU, 
+0x84c5685039d19d8aU, 0x3b41278951a55215U, 0x5af6ec35c16d490aU, 0xa6008450fb128638U, 
+0xfd95dbb3590d2c4fU, 0xf0fe008fa726573dU, 0xc8f6d45e7be9ca84U, 0x7b4b79c067a37c72U, 
+0xf4727e8c8ef2dfe7U, 0x345e4fd95b8881c4U, 0xc604c9f87d2efd3fU, 0x2e1c7c383d7f8492U, 
+0x3f85cca2c55e5f2aU, 0xc2d747d667b0c5bdU, 0x6d9f4529ff7ea8f1U, 0xc629dc2b09f0be26U, 
+0x26987b39496cac9fU, 0x59e38cea5c44de72U, 0xc64c09798feb0e1cU, 0xde5382b1967df354U, 
+0x7ce082fdafa473d3U, 0xc2e3e29473d84115U, 0x62c3b00991cf9f2bU, 0x9c47b678b69c9185U, 
+0x3b4c7c0831bf35a9U, 0xe2ed30366d621c90U, 0x40cb0798638b5965U, 0x74dfabecc5345e53U, 
+0x3615b07b36a268e1U, 0x3f5fa126c564848dU, 0x69281e79c517ce99U, 0x48341b4c8956a770U, 
+0x7cb2963786807a23U, 0x400020516a25ff3eU, 0x5344b99d51194ec8U, 0xa7227b0807f2a908U, 
+0x1c471983d4115894U, 0xe7bf8157b728cdc9U, 0x45da847920a075abU, 0xf5507525d45d39e8U, 
+0xacebe833f2f21873U, 0x22fc19d8429b019U, 0xe63138a90228dc28U, 0x8c86799b36e7d519U, 
+0x8905b7d7e5159140U, 0x5dbf4306e861f0ecU, 0x61ce9fe475a272d1U, 0x5c0c2c12a5a3e85dU, 
+0x5a797fc2044d14c0U, 0x5cab5fa1a8f35eU, 0x465abe73a3661d39U, 0xcd2b2e8d42344596U, 
+0xa560acf222496315U, 0xfddb6f0cb9acceceU, 0x4d505eeddac0f671U, 0xf13012df9b0870a2U, 
+0xa94a60e30f18a7abU, 0xeaafc3e392c6cdc9U, 0x12de04490cd9ba82U, 0x183950fddd7be0a1U, 
+0x6ae5ddf8560b4b74U, 0xcc6e77e9d46108bdU, 0x81cda4cb3f77a930U, 0xaa8cbec079204cc3U, 
+0x66f4eb12399a1566U, 0xf25c655aff228f69U, 0x4cefbc9b83df9dd8U, 0x11b2e84c8f0df7ebU, 
+0x59a4b3c05c56bb73U, 0x824b55840cd80968U, 0xd042d698797405ccU, 0x6103769dbca23175U, 
+0x5fd577fab0f2928cU, 0xf6bc238850e7187fU, 0xa088cf12640a72f1U, 0x675107e17bc4604dU, 
+0x8740be4015174f14U, 0xb26711d18b114573U, 0x5d664043d781f304U, 0x6034e0018ea3f8d3U, 
+0x7d09eb28dba6f34aU, 0x31286a0fe245c6f8U, 0x759da0a3ef991485U, 0xfb6d19295f2ba070U, 
+0x9b5f3c822bcf0452U, 0xecfcfa2dc9685b1fU, 0x9e388fd4c4a791b9U, 0xf29b2d29d7bf46ddU, 
+0x48fcc264147c34d0U, 0x26dc449c991c9eb3U, 0xddb77e96f0b512acU, 0xe42b60f34a9e51b9U, 
+0x6de84bd897a87eb0U, 0xbdf8bf104fc3c2f0U, 0xbe07cb0c7eb81c57U, 0xff0cc44f2cd6f0ddU, 
+0x74ca2d2a0a435427U, 0xa690109827e4db50U, 0xaaf67650d906651U, 0xff429fcc103c13c1U, 
+0x8e50450d39853824U, 0x205bee534a3a0da2U, 0x94d409c856186876U, 0x2addf9668a4ecdb0U, 
+0x8ed9c7e787354b7aU, 0x22eca56c3915c97U, 0x2397f463e53cde1dU, 0x85685474d77e0848U, 
+0x8954402bd16e04c6U, 0x6a891dc1fd6fdbdU, 0xeebc913b2a6f7287U, 0x20b50eb50bf587b6U, 
+0x186c5ae0464345e7U, 0x45faf0843c5344c1U, 0x691ec77b5af1694cU, 0x80ecab9f02b4cc6cU, 
+0x97a3de52e042e3efU, 0x32e500ca5bccdbb4U, 0xfb5fc8f83e19fc84U, 0xf424148aca6d55c6U, 
+0xaf6cc7fa7b26165dU, 0xa713a215f677137eU, 0x49e9d2092fcc92deU, 0x617344c752b23e65U, 
+0xc49bfdcb86b2a286U, 0x9899ac16e37171a4U, 0x49b7d10bd18220b2U, 0xe9901617a437835aU, 
+0x2540306574362bd4U, 0x5d139a212f6bc03dU, 0x33f1c0b1843eff4fU, 0xe15d0f2321cecf44U, 
+0xbe6accdaafb46fb8U, 0x23ed4bf8a4468269U, 0xc1bfe039308be326U, 0x9a84cbe2707ec22eU, 
+0x21bf76650442770U, 0x9018f7a6e101bad1U, 0xda04c1da9e40fc2eU, 0xf8ac03ee55fb6a22U, 
+0x3a2864f11b00c82dU, 0xa97602bf95041d02U, 0xa436c751b34e6d17U, 0x5a358e65599d1e8eU, 
+0xc363877731efffe4U, 0xaa43dbffe2aaf9dcU, 0x5baa9060c6a031abU, 0xc1e3e83f22961a1U, 
+0x5ccb48da896a7824U, 0x92f7db6b5625b653U, 0xe869f22aaf60d216U, 0x59190df64dd74b5dU, 
+0xfbe06d86f65460deU, 0xc73f8d0aabf77b8U, 0x6c6cbcbe30cc8ea6U, 0x8a731fb525bc95c6U, 
+0xe9859a1dff8dc207U, 0x35867e3c52508ee3U, 0x8f52954bffb04dc4U, 0x585855c5e2ab6319U, 
+0xd376b93b369f9c65U, 0x5b4273b92840cc66U, 0x58f94187dc6d34dcU, 0xe7a38889ddb5553dU, 
+0x3b1be4e0aca7ee5cU, 0x58a22b94187d1ab7U, 0x8e37b26192145bdU, 0x5437b5bab1219172U, 
+0x642abadfb51634a5U, 0x3cf90a7835ed524eU, 0xbf0a6ba02cd7967fU, 0xa20b606132a8f224U, 
+0x26c13795f226afadU, 0xc674757e3cd45edfU, 0xad3d5fe8373b315bU, 0x9c43ce9f697db99dU, 
+0x2b5994fa8d201492U, 0x44a87d89f414dc7eU, 0x768e49cb4db97033U, 0x551b5b794a2170c6U, 
+0x18b42675f7985f33U, 0x35435f704d353e0U, 0x9ddf271ea3b6eef5U, 0x20f3f82a01775b75U, 
+0x70432244b3ba54a8U, 0xb58b2635603aa970U, 0x91438ec34fc5cc0aU, 0x16f1f93f1256709U, 
+0xed7c61fa664f2889U, 0xd93af27546a3b4e6U, 0x6f29b11be49ce658U, 0x8bcd34115895157U, 
+0x7ae08ae3f41f840aU, 0x2f63f5b9a8e3abb3U, 0x41d3e1d802596f51U, 0x987f1f01103eb892U, 
+0xc5c8e8768861028U, 0x537d27be14f7e057U, 0x8f39b5e4f13ab094U, 0xec349554991f2bcU, 
+0xdeee493ce7c16d94U, 0xe2581d0aa02845fdU, 0x8c08fd67cccec31fU, 0xe61586670bd03478U, 
+0xfb4ed19ab14810abU, 0x4e65cd1e47a443bbU, 0x8c5b2b93f4b6f0eeU, 0x65ca03ae9e7124beU, 
+0xda2481e77083cb30U, 0x899ecd810d6783e9U, 0x71c56935cd7f05c2U, 0x4343dbbf1a2c2be4U, 
+0xcc757ffddeeb4adaU, 0xfd47df55831c8ecU, 0x54e1aac1696809beU, 0xc0152534a2591445U, 
+0xcd6dca6653ce728dU, 0xf4cd907e2871cd0bU, 0x555a08a216c85347U, 0xdcd37f0b38d56a26U, 
+0x8d7d136997cacbcbU, 0xcaacd346d29dabebU, 0x72c37b62b3c6d6f3U, 0x6574dbd77cda4c18U, 
+0xddc6dc1b12378c16U, 0x9e3607554615622aU, 0xb319e52d6bf9597dU, 0x1136b759c12b3b11U, 
+0x79f59bd0b3488127U, 0x9614aa28e751cce3U, 0x9f0abc60fe9ecb2U, 0x7dec0fcf45168fddU, 
+0xd0e6dafff34d3977U, 0xd95c410a18d0145fU, 0x86f8c11b6445072U, 0x11f1f5738159984dU, 
+0x14bc90ea00154b71U, 0x937e953f3dc68206U, 0xcb829f87d3a748c7U, 0xab98c1b579c0b985U, 
+0x970e6d827b299740U, 0xf40f467d713db134U, 0xcc4ad13793faad48U, 0x53893eb71cdd4336U, 
+0x51ea6f1b3fff7509U, 0xd8a132ef21fde8cdU, 0x3841ce28ea75dc8dU, 0x27728a7e9485fbd8U, 
+0xbe840ca84d6a6a96U, 0x953b9a779a2e613fU, 0x9b8018b75e7d2586U, 0x934c89b9aa1cdc48U, 
+0xebef148533d838edU, 0x107d2df0e2e4ca9fU, 0x4516d6d6b31b2e9dU, 0x856af4ffbccaf40aU, 
+0x30b3c956738000fcU, 0x4e1e27707bf03bc1U, 0x57e376baf1fae560U, 0xdd64e9dd754cda27U, 
+0xbfaa1c50ddf4ac12U, 0xbe45d022b91e48f8U, 0x6df89e3e19ca79ffU, 0x432193eb0c2932c9U, 
+0xfce56020573aa9b8U, 0xdf7150b8829ed224U, 0x5aa3227fb295f467U, 0xd1bd257b592c6943U, 
+0xc16568492b51d81bU, 0x75ce33d784cf7342U, 0xd0b4922e396a0e41U, 0x177cc0cc4bc60526U, 
+0xef82151733878c4aU, 0xd883d03c8551c055U, 0xf2c69c60e4a91b21U, 0xff9845a87effd516U, 
+0x6ba6847d7488df68U, 0xf1f33746b65cfebcU, 0x8fd8a48edff5e8ddU, 0x835b9af4a4e2428fU, 
+0xfebf5ea4acc506c8U, 0xa8030f018d3a3511U, 0x8f5832665cda09c3U, 0x4d00885c9a9df215U, 
+0xd4fa660e1835aa2cU, 0x45d17acaa56ce133U, 0x14c0474409fe88a1U, 0x3f853c3a9671c7f2U, 
+0x8ca9b88140f51524U, 0x5faeb6a15baf86fcU, 0xe8767a30845293deU, 0x954e13e8bb91609cU, 
+0xe9fdb3d945e30a69U, 0xa9eea431141e7cbdU, 0xd93c6243479ecbcfU, 0xecc8363ff92a4041U, 
+0x340229009cbdf013U, 0x3e0c430de7ed9b79U, 0x5bbfcb81caf29994U, 0x2d428c6f64278eafU, 
+0x76c7ce8de6ac77ffU, 0x193ba01db2d89244U, 0x573a0646beec01e3U, 0x9c1ade723716641bU, 
+0x1f798d53c4f77287U, 0x412953c36930d9e3U, 0xdfcd50c5c1d80497U, 0xb2217ef6fa41fb93U, 
+0x97a04a7724e7b5daU, 0xd709dc739c5e93cbU, 0xb5dfbcf88d38c843U, 0xfb5153e0ce7cf3a2U, 
+0x4f7b2324cfa9ab07U, 0xb3f11bdef5fdc633U, 0xd12c12e9f5efb870U, 0x7af6ddec6d18ab02U, 
+0x55ed240b4999f264U, 0x32f5b43e1c99acc9U, 0xddc63eecddd915ebU, 0x304e6e352e694813U, 
+0x8af5396c85c723e9U, 0x1f973baa9aa78171U, 0x122c6eae915d5c35U, 0x3c3950b17b79bdadU, 
+0x5e38775f76834763U, 0xb01dacb57c4906aeU, 0xb494bb7ea186a8b0U, 0xb99b7362209110dbU, 
+0xacaee11dba958f2bU, 0x252c3490039dd8baU, 0x96868e27350eb3dU, 0x1ef57b1ffb961331U, 
+0x43b9e0339d9c13f0U, 0x8598f8bdfaede849U, 0xeee47f99ecabd30U, 0xd45b7980d1a9e441U, 
+0x3717d6e23c18abebU, 0xd59dcd190725d62aU, 0xd1ded2f844baa944U, 0x803c7a2ccf961cdaU, 
+0x6a439bf0e29bfa78U, 0xed7c443c2a6721cdU, 0x6b1acf169c4b4409U, 0x83fb5040a796e928U, 
+0x9c762ef1943e832aU, 0x7e50ab01786df70U, 0x90f573a82589f18eU, 0xd2bf28ba7c2a51aU, 
+0x48263af15b20d37cU, 0x27ec9db960551446U, 0x7087a10a94b4e7edU, 0xcac3f4313bd00acU, 
+0xfe43bd70a38305bdU, 0xb63f06c8f9b6856U, 0xfbe9218bf89db761U, 0x84feedc3620ebad8U, 
+0xfff41ff86073bba9U, 0x2568e12ddb32c53bU, 0x4a3f5b5c17da3948U, 0xf199bbd5a9c7c165U, 
+0x61eac4bc112c9666U, 0x1cf8c6c365ffcdf3U, 0xfd9bcc35b7d9531bU, 0x34e5e85eb967f82cU, 
+0xb5a1853c992a3666U, 0xf47ed63c1e3a526U, 0x82846575ccbc4633U, 0xc0ce68313221a36bU, 
+0x582554a2a1faaf83U, 0x3c399f34f03e03f0U, 0x21501871dfd7fdebU, 0x5d890886cb475bd4U, 
+0x498413ff2ce31fbaU, 0x755b7179214633d2U, 0x46b14def6cb0616dU, 0x970938bd84a2f69aU, 
+0xc1652be351209502U, 0x5941720025d92665U, 0xa6c493ef0919e154U, 0x727362cc59f4d863U, 
+0xc677d1d3d7042b0dU, 0xa18d37f9bb2760bbU, 0x9f100b8c2ce91d20U, 0x17b0f4229babab58U, 
+0xc5fa15ba3f891521U, 0x2065a28c35a2d166U, 0x2ef73d190a70593bU, 0xb5afd1574fd7a904U, 
+0xaace31c0f0d1acf2U, 0xbdd4f9934e541d61U, 0x71c573a608e6388fU, 0x7955a0ac880179cbU, 
+0x455e7928a447f959U, 0xf947daba8271d368U, 0x973a14c4bb49eee9U, 0xa0c3f260054a6cecU, 
+0xb039d248968b671fU, 0xb1b5540258d272c9U, 0x382f8c10cb628208U, 0x508c73090e4b2c4fU, 
+0x604c5b8bdff8874U, 0x1bc3cafc1640d35eU, 0xf5d74845410e1629U, 0xa6e1c5814699e69cU, 
+0x1885d8ef93076dafU, 0xb789999f3812b214U, 0x24b1e0a9ef5a2efdU, 0xc25ae34dfa827e6U, 
+0x21f9f025b37e1d3U, 0x10761be13ce4de23U, 0x40cb433be415fd04U, 0x7e81b231f795ca7aU, 
+0x3f5fca264155681aU, 0x4ec84bf2b1c2e0e0U, 0x125e896cee6c7c4eU, 0xf3855a1b0e9bed13U, 
+0x44ed88dfeaf0a062U, 0x6002de365f76d2a9U, 0x923729be3dac09e2U, 0x67e3d9a5c6f539c6U, 
+0x392cb84a785188cfU, 0xd54a03d5ca72746eU, 0xc604bcefb6abe481U, 0xad17fe9d1670dd21U, 
+0xc497715f56c051a0U, 0xdcdf29246f5b3e6dU, 0x4a36d8e6db0f2abdU, 0x8035e21c7d8026d8U, 
+0x601ebb2fb2d0dd12U, 0xb3e7dc63098b6235U, 0x375dbe6837bdd318U, 0xb8810a44b7a2befU, 
+0xb60914e6301ef90bU, 0xf11fee4341da301bU, 0x3935ab93e753a748U, 0x9fbf99b277da3d93U, 
+0x3f839472c9df49fU, 0x4973193c0a90c384U, 0xb259a27cc432519eU, 0x806a00260128ca94U, 
+0xce00c309ff12c69eU, 0xafe5aef589651963U, 0x6baf0010204fcecU, 0x196908dfd618a533U, 
+0x8d3319041d114831U, 0xb6b2e3371ffb886bU, 0xbee1deadd21054eU, 0x3f65bf6b2f916e04U, 
+0xd6d940287ca2eb91U, 0xd0260c1d29be35e3U, 0xf19d2afe08b90c48U, 0x18845229180712b0U, 
+0x6a917d4a0f091533U, 0xfdf00a69598d38cU, 0xb122be6c54ed1a9fU, 0xd535a17d0f51d9caU, 
+0xe498e01fcb89c5edU, 0x77b530cf797a78c7U, 0x46e6e1d210ad0f35U, 0xdb77fceb8961a2afU, 
+0x59ff1c7eed25b46eU, 0x1f16c7ab68899afaU, 0xecf339be4c99ad41U, 0x7fd1dc3871cee5ceU, 
+0xaee9c75df7f82f2aU, 0x9e4c35874afdf43aU, 0xf5622df437371326U, 0x8a535f566ec73617U, 
+0xc5f9a0ac223094b7U, 0xcde533864c8c7669U, 0x37e02819085a92bfU, 0x455c08468b08bd7U, 
+0xe8b043c401cd7f36U, 0x5799c8f19419149bU, 0xd36e2c6048bdfa17U, 0x4eafa17a88814d84U, 
+0xc778c64a0b2d1c43U, 0x5036a58cad4543d2U, 0xee45531527efc47bU, 0xa47974d851ec201fU, 
+0xfb14f217ab348fa0U, 0xe0fe2459051541ddU, 0xc2a223236c24b4bcU, 0x86eac93dddeb882dU, 
+0x4ee380954da51ceeU, 0x6c26d96351cfee8aU, 0x5a436f9e8d6f4671U, 0x948f3853cbbc4d8dU, 
+0xcc319d54b96214fbU, 0x71dc987a8febc765U, 0xcda9e496cdf1c589U, 0xc6122fc44fbfdb25U, 
+0x3702bd8fb7adfff7U, 0x8a6e48c1e271f8aU, 0x9031c9868877f91fU, 0xea205bec8343ac41U, 
+0x7af41ffc99222c03U, 0x948ce77e87e5e103U, 0x3f5e7d784859f407U, 0x8bf09ebaf9fb3aaeU, 
+0xa145f742ea72bb54U, 0x9c9ec0e1de20e1d4U, 0x3b48b1dbe7e5ba30U, 0x509cbaafe2e27a73U, 
+0x1686977a8d215bfdU, 0x8be074267f1462b7U, 0x85b6220ea2d65d24U, 0x8b4fcebe1f52629eU, 
+0x6eaf00a475ec26bU, 0xf9d502d09d21add6U, 0xf96fb1cada9254ffU, 0x1f3307a9a822157eU, 
+0xb453a2c1d1ae9300U, 0x5e1c470475c48280U, 0x19130bada2f3735bU, 0xe85e2dcbb7e70fc6U, 
+0x72a0dfdd1546e25eU, 0xdeb7e185df8c31bbU, 0xc7ba7b5b823c2707U, 0x451aafa6d51ce0bfU, 
+0xe97be9ed0e9d6b84U, 0x6f4fffddee86b987U, 0x24b4042c13019fdaU, 0xb6d94022c1812137U, 
+0xe1bcaa0fbca7cb21U, 0xc23273eaec4f382aU, 0x8634478884d77ad3U, 0x93ff3f4162928723U, 
+0x2525d55605260cb8U, 0x836f4a80ceb2152fU, 0xa3f027da1ba7dbf6U, 0x3f5fb0f228c92f82U, 
+0x72fb4b441852c964U, 0xfa3e8751fc5ec332U, 0xe38de15366783f2U, 0xc55834dada499987U, 
+0xec11fc70323ba10eU, 0xe0d54ada7c4c386aU, 0xd92ffc6aad7e567eU, 0xc453bfc7281cf5c4U, 
+0xf2c263a396ee110aU, 0x67adb73ebb9e9ba2U, 0x2df5245c3fe776caU, 0xe6fa24418b36635dU, 
+0x4aa44442da1cd60fU, 0x9f9698a9cc3092eaU, 0x57aed074b4da002bU, 0x33685622b18d9996U, 
+0x4bf737650fd57d67U, 0x5fef5a4cbc50b8b2U, 0xba858c00dea7af17U, 0xd42f509ef1247cd9U, 
+0x6b96e60ec43e4011U, 0x657fe995ddbb2e9dU, 0x8622f79df3c7d730U, 0x4c302e77f4602e9dU, 
+0x991210b65c5d5b0bU, 0x8349cd4299a3fe76U, 0xc335017a576b9579U, 0x776bc24768d62940U, 
+0xf053b6ebb7576342U, 0x5b2c88833999222aU, 0xf7d0f9d8960979d9U, 0x4813eb5c08f00080U, 
+0x64c155eb97376316U, 0xca2dc67d506a904fU, 0xf66016848e33524aU, 0x43fd4233a4240U, 
+0x7b65e413a304e88cU, 0x3173b811bb7f88c6U, 0x3754cc46fe2bb908U, 0x871257a6d8fcb31cU, 
+0x31b8b859f97623c5U, 0xcee324d7b43c076cU, 0x2856cdf59cb86527U, 0x10c8e34819baff2aU, 
+0x9f67171dff69b2beU, 0xba41f74edc1111c0U, 0xf1322dbbae386e56U, 0x80c3f1f9a5ae997aU, 
+0x8904b97c4102d2f5U, 0xf14b74b35cb7a8bfU, 0x2980e2765b1d5a9bU, 0xa932140a009de85U, 
+0x9c837f4fe476c81dU, 0xb7a3030e99e53d5eU, 0x9af7cd273da8a366U, 0xad6090dfdcb41a01U, 
+0x818abc84ee6705ddU, 0x393fdc364f3048dfU, 0xaccd75c2cc5bd8a8U, 0x77b5d1dd48f4c91eU, 
+0xad180dc0caed764bU, 0x227f1d7586bd4cb5U, 0x2626f6ca66f6a11fU, 0x7e4573da81bc84dcU, 
+0x9c83115f17c2f2f7U, 0x2fedf3c7d11e7fb4U, 0xf1bb9fc93651b20bU, 0x8cbbeffd96069f25U, 
+0xa24737ce2725490U, 0x4ac3240623cb5990U, 0xa2adaa533b09863cU, 0xd90b45bb71ad697cU, 
+0xb0f84f84afeb1299U, 0xcdc07bff3c466ccU, 0x9d8b5687378cbd8U, 0x3326928ec1bb350fU, 
+0xb5252b56c3f0e03eU, 0x1a9c655f50187a3dU, 0x7977aac8fc30c25fU, 0xaf13583cbf65021fU, 
+0xbb2f5bfc575ccb22U, 0xca20edffa3e1dc84U, 0xdbf60be46d83d6f8U, 0xf8fe31f81a9b57b3U, 
+0xa76b3a657e933668U, 0xfb02d84cf86babf0U, 0xac05393afa1f06beU, 0xac25921731213fc7U, 
+0x16e77f6732776fb5U, 0x6f864189c69e1e7aU, 0x850ec13eebd8ed7cU, 0x6c79a03870dba8baU, 
+0x560b276cb62ca483U, 0xc3677bfd6dc6cee6U, 0x9cd9c99c12311dafU, 0xd32a0d2c402577afU, 
+0x4959a5ddfa435b18U, 0x6d4c582b760d3d17U, 0x73a262470597d0d9U, 0xd17d4ad78a74b30U, 
+0x9a617c12128de7e3U, 0x86842ac3abea996dU, 0x87320fbda7b431bfU, 0x7bc3374ae979f3a8U, 
+0x67a0b32eae6e5e29U, 0x55f2db39b4c0ccf0U, 0xe00c77ae6e4bacbdU, 0xb431f02460854e5dU, 
+0x142fbc118fc3fcb9U, 0xb2a3a6939881b969U, 0x28e91651abe7add0U, 0xda2535f6cda744d6U, 
+0x78086193902a869fU, 0xed8df5246a0960d9U, 0x24454c68510dcdd3U, 0xe756083c27486df2U, 
+0x4acb2323835e057dU, 0x29cf10daf6d89a5bU, 0x68bc872fc3411193U, 0xbf9c149453ae02b2U, 
+0x6f564b282da20feaU, 0x440b9e181c5c479bU, 0xf385313f05c7a542U, 0x92acb89f25f23be0U, 
+0xf427a5acd29d4728U, 0x64f93343e10c9845U, 0x231f27aa78a00b5aU, 0xaf9b693139850548U, 
+0x8f765c8f40f23d2cU, 0x31c02fa3f0ffc37dU, 0x62da43171b28c662U, 0x6ba7497f4ef28276U, 
+0xd2acd7c2021d6584U, 0xf2705d6443b3d9e5U, 0x96e97da35adf014eU, 0x55bf0839b5784f8aU, 
+0xd564f428ed744eaU, 0x89e14202ae5a5a8U, 0x27acbf6ba8bc7dcfU, 0x3d980733e4b61ccfU, 
+0x389f54f13282e42eU, 0x2adf34fb31fa1ab6U, 0x6691f0403b650381U, 0x4e99a32a4e4acee8U, 
+0x229b297ff15da3fcU, 0xdd899a3675916797U, 0x8d3f09f2eb7485d1U, 0x430039527356c74eU, 
+0xdd69df6e41068c5eU, 0x2a45ee6e4be573d0U, 0x9f2ae14e7815d487U, 0xfcf24e1653378d51U, 
+0x761f453f27c19d75U, 0xe9176a4b2814855bU, 0x5c675e21b592e7aeU, 0x186bb0e5336fffe3U, 
+0xff3082d81974671fU, 0xb54988a09e08b511U, 0x9ded0d075b4488f3U, 0xdca86cf66d2c78eU, 
+0x73c17c649aec3a03U, 0xa4980aabf46b6d4bU, 0xbe305243be34a80U, 0x56750dc1225020e0U, 
+0x8b7d95f0620da860U, 0x843451aa4849d100U, 0xa1fdb65343d91f2fU, 0x7bc280d02f5167ecU, 
+0xbe29104107aac76dU, 0xf2e19a2fdcc1632eU, 0xe2626bfa705ee6e0U, 0xb33f6d77bbbd31e5U, 
+0xa52f2c3693c4a205U, 0xde1adf89f510a848U, 0xe466557075b929fcU, 0xb6e06c516305bbc4U, 
+0x537f4d865db36d05U, 0x63f99419a82a9f87U, 0xc5e1f126e79ed73bU, 0xbdb4277c21b323f5U, 
+0x29f315f9fcdcfc44U, 0xaf3674c6d797eb13U, 0xe55703a07bee1e8dU, 0xa61727a4f5f8ddbfU, 
+0x93b82a7f0ef3d60eU, 0xc1b9010462f080f3U, 0xde692d5a2bbae158U, 0x3fd9e4f9b02696aU, 
+0x92f821f6f9e27907U, 0x771ad4b388d9e4d6U, 0x6b395d5d6fdfbd68U, 0xed9e43f84241c4eU, 
+0xf13f4f506e78c4fbU, 0xe9151cfeb8ba1905U, 0xf5bc0fd8eb120e0cU, 0xb5af874aff6b2347U, 
+0x93fa154a553faea4U, 0x324a7181c96b10c8U, 0x8c89f34b7cbf6a9eU, 0x27708f23e8bdb74fU, 
+0xb21ade75d0802d2fU, 0xfc6d68b3d1965bd1U, 0x300225d66cc2c973U, 0x575f186149caa4a4U, 
+0x36d0572535b38f54U, 0x2e2a860e5caf07ceU, 0xc55268db48fee1f9U, 0x57a7e410076d8f7dU, 
+0x5fa781e6245f2809U, 0xdfd76e39a907eba7U, 0x194c8a23bc82dd21U, 0xfd7f0f03c8ecad24U, 
+0xa8c081b7a0f69001U, 0xcfc99d57b30c8656U, 0x57dd0cd934b55a4fU, 0x2ed8369aae243bf7U, 
+0x616ca32a2dba519eU, 0x9e3959c55a9244f9U, 0xf38a5dbab4fdd7deU, 0x8d916d516a90f28aU, 
+0x46febbf9a7a79593U, 0x347a7249d25c4979U, 0xf52d9b258cca5cf3U, 0x24799ae2f3ef5dbeU, 
+0xd6388d75d0920d55U, 0x9994361f9beb1398U, 0x32c3d1a9d363e300U, 0x9436b5262ec87b7bU, 
+0x7fb5bf4597445fb2U, 0xb0844aecb2da6510U, 0x9bfe97cab77ae6cU, 0x7cee417faa66dc61U, 
+0x4fffcd61a8223a26U, 0xa667e8569ed0e31fU, 0x96d871e7f9cf0bb3U, 0x3040efebe1e5b9f5U, 
+0x60216eb50bf5abdcU, 0x456cd3afbd0b6506U, 0xed3111cb080d5d60U, 0xf15017c6884c7026U, 
+0xb75de2b8adef85b7U, 0xcbdc675c27b85584U, 0xecd8341e3fc5e232U, 0xdea7ef1c2c5f02a8U, 
+0x37e96dc1176701f6U, 0x5f9ab4e94444bcb1U, 0x1da49d4efdc21668U, 0x9c85a7df8eb3edd8U, 
+0x4d817802f1bb52d2U, 0xaf7a7b000bc3f2ecU, 0xb00356dfecdfc66aU, 0xe2625f6813bb92b4U, 
+0x69f252b1fe78e9b1U, 0x8978e6dc4ec141e8U, 0x6e0f831f7512dfccU, 0xe196e20f89b4beaaU, 
+0x4417561fca77eed7U, 0x908d0112beed35f4U, 0x2a6408be76b2ed9aU, 0xa5d66d85f81a85a6U, 
+0x2f2ff3673c5e24dbU, 0x1c66e06d8f71f05cU, 0x5dfd1ed91c998faU, 0x9be2a2f68fad9f22U, 
+0xa9fc9c9155e4795eU, 0x55960afcd16762b6U, 0x5a6cff1c32895908U, 0x1362fa0b6e4f8c1U, 
+0x76ee33e57b1cb64bU, 0xd609e525618ac3d5U, 0xf397fcd71539ed14U, 0x7779f5de6c1b0302U, 
+0xd8e18d1cbaba3aabU, 0xe2a829423caa9533U, 0xadfab134a7a2e3faU, 0x9a8423f474c3ebeU, 
+0x63cac4af02e34dd9U, 0x7f78e95026917ba0U, 0x3e1397278149a0c5U, 0x338fdda9d0f38cc8U, 
+0x51f7c7ea954d31acU, 0x1054cde1654a9d27U, 0x3385e79e65ecd33U, 0x8f8fa4f59f5972c2U, 
+0x3ed8587691d1b492U, 0xdfa0618c2019a6f5U, 0x1e5f6d9aaeb28ce8U, 0x8605b94be423a2f1U, 
+0x571d77bf78ac6598U, 0xee23526d481e925cU, 0xf3ef6e0c2143d1a8U, 0xa8e561287de75758U, 
+0x3cd5f4e4a9aa52dfU, 0x18c452b1b42a627fU, 0x6dbc4189d991ece6U, 0x45a511c97f608bf7U, 
+0x7b52bd12125ec16cU, 0x5a919b27d22955ceU, 0x3fe3337fcb625ad2U, 0x73be0ec773ea9b6dU, 
+0x13cc521bf003e44aU, 0x20688b6b3a0e5f2U, 0x2bf7ca0444ab1b75U, 0x4cd2a0bab6ace28aU, 
+0x4993eca97b19c38dU, 0xbde2e7d1c97ea5d6U, 0x6d1310756218d126U, 0x6adf08c371d22405U, 
+0x656753efae75bc7fU, 0x95c7170db6f7fb1fU, 0x8ef40f1217cd4c7bU, 0xb57ac4fe72b9343U, 
+0x4f172dd0972e9a9U, 0xb1f96c0e4049fc62U, 0xf28c34cfa57e94faU, 0xceedbf8277a9f3b5U, 
+0x7ad039a2f521ba40U, 0xedc4e459a0829db2U, 0x323357a021c84544U, 0x7451fe377b24776bU, 
+0xd0a61cd3e518dcf9U, 0x36b09eb9985d5439U, 0xd69002198464eadeU, 0x16396435fcc70940U, 
+0x137433cf833125ffU, 0x354557b05a5a8142U, 0xcf4682d9ca1cae99U, 0x1178b3fb6e4bd148U, 
+0xe80f9709d8486abdU, 0xdc8adcd08e54d1bU, 0x382de637ea310ed1U, 0xdfd697ea9babd95bU, 
+0x82155e1da2152bdfU, 0x8cb862fae80192U, 0x1589068f2acf1870U, 0xc31f323d127261f9U, 
+0xedc121b6ccd2022dU, 0xbfc9c1be1030637dU, 0x9ec96dfd936414f1U, 0x2689dd48abbe7580U, 
+0x3b3695ccf662d955U, 0x8444d685b48ce44fU, 0xf8a83b7e8d275693U, 0x8ac7a0826f94e907U, 
+0xbc6a2dbe646b3daeU, 0xe3f481c5bd6c138dU, 0xc9d7e5234cb59ad9U, 0xc80f40920f33231cU, 
+0x6c47a8cbab3f4576U, 0xe9d08bab256a1904U, 0x24a33a3bb84ef35eU, 0x58fdc0dfe5dcaa3U, 
+0x3a45e3e1a0110e9eU, 0x1e80139260757759U, 0xc3df9b4606b8871eU, 0x90ee3b9e9ea9e0e7U, 
+0x7cd879ade88803e5U, 0xcc1ab7ce0d3465cbU, 0x1ab7fa8700569e02U, 0xc0f48b2859ddf211U, 
+0xa6932202876619eeU, 0x932e4e070b828edbU, 0x9c9a64727e60d7d3U, 0x3d4326b6f883ca36U, 
+0xa2e1d75449e23fe9U, 0x6101a11756076ed3U, 0x881e580ce503ba50U, 0x8d03e705c0bc475aU, 
+0x9d3c68a567b4d038U, 0x6601f1086eb5b633U, 0xdb7c876cfb9453c5U, 0x6fa65113c3ff4a09U, 
+0xa96d67099e1f515cU, 0xe2b48a32216539afU, 0xa019c8e10ff7b8c0U, 0x2ce8700f0351766dU, 
+0x95193649852eed6eU, 0xa7a9dcd3e2c3d52cU, 0xbacb2f42f7ef5d2cU, 0x73879f4f3b5ec4a7U, 
+0x43d95a53eaa99aaU, 0xf5ef01ba2fc2e5f0U, 0xa152c3a612fecd63U, 0xa9c1e53ec28889bU, 
+0xaa396b087e003bdeU, 0x7ea6d315a2b8c8f7U, 0xf161d8990a6b8fd1U, 0xd731b36622fd601aU, 
+0x45aa3775e4dcf274U, 0x807200682cacea24U, 0x145e1bb0fd7cca1dU, 0xfac44261dcb7c109U, 
+0x63698600f12f0472U, 0x732027c6274594b1U, 0x7cc723d5d4ee97bdU, 0x9713fdc61566a8a8U, 
+0x2410978c33dbfec6U, 0x4435de4e901f72ddU, 0x187025ddf8e690a8U, 0x9fb68ebe1b8a3c0bU, 
+0x3a92902ec95d4948U, 0xc715ac677de20383U, 0x1feca8ef55d4709aU, 0xcdc87fcbb7891dc9U, 
+0x2b5e4b6abdc39d21U, 0x68373ebd409adc68U, 0x46591e43a1992813U, 0xf891e6165b403e00U, 
+0xd5908e17c5ca579fU, 0x73a97ec4f5460254U, 0x18aeb8a8e2dbc43bU, 0x129f53b12bbdfcedU, 
+0x28cf1ab99076f57bU, 0x30b86e3cecac607U, 0xb927e3501cf2a53fU, 0x20e118564880c79cU, 
+0x8583bedbada7afe6U, 0x9fe0dc9b40e1b71eU, 0x31bdc3e3fb6de997U, 0xff67b352ac437ef7U, 
+0x9e849544d4c20855U, 0x62df6c0f0ba0405bU, 0x3fefe10d9289d72bU, 0x4eed0b4dfbb5c307U, 
+0x4c087a3f8bdffd1fU, 0x1136ccd32d34fe3fU, 0x1941d3287fc115c8U, 0xace0fb288a56693aU, 
+0x849e3aed4b661da4U, 0x940a51ac64a84a5cU, 0x8f7c7fd903061a21U, 0xffca2a5bb86606ceU, 
+0x8984835eaf9b8a5aU, 0x478f87ade5687f6fU, 0xa53cc9a148f46c8cU, 0xce1cb0e32b71cdc8U, 
+0x83d637e60524722bU, 0xfeb99f12e6a12de7U, 0xa45b1168ed12d20U, 0x42e0437c7aca84f7U, 
+0x766939c81fea76c6U, 0xdbea2a6daf54265aU, 0xbafd84ccc9b4ea3eU, 0x2de1da0901d920eeU, 
+0x3cac1e139c8cfd22U, 0x4e2b0671b636be58U, 0x636535150dad354aU, 0xff209cedffc116abU, 
+0x2389b14e93bc5535U, 0xd4f4b92c9684b94U, 0x207d41d24ccff1c8U, 0xad79f397469d0f7eU, 
+0xc4ad7478ecdc9426U, 0xe411d07935382a4U, 0x9025f8240670dfdeU, 0xb30ddefbc268d865U, 
+0xf33e104b29c7275eU, 0x5b93309caec0238fU, 0x4ab3871bc983d48bU, 0x7dbf4fd5c014c153U, 
+0xe807e5858f4e983eU, 0x6d9e6ec87017f77cU, 0x58604080d33b4b15U, 0x33d5f02d0b079ba9U, 
+0x6d70db8791ea37a9U, 0x7a71aa9259630c95U, 0x73c3d61655bba1ebU, 0x1eb5a76d39c4784U, 
+0xc6f24fc37bcec904U, 0x49a7cbf2445cc228U, 0xc499ea8fc2ef48c9U, 0x70d96ccc51afb00U, 
+0xf62f4db2a3ab316fU, 0x53bdec7b34681bacU, 0xfc61582d55f0e977U, 0x9b915ef5ff0abc21U, 
+0xb695a79f61e52a73U, 0xd0e3116c9705a1bcU, 0xa9e974d9adbb5e65U, 0x8f1bd23da6261690U, 
+0x57da1451ebea8f2eU, 0x590502e64b1850a8U, 0xb8769e430743eadeU, 0x4c7a8f6393ada8b8U, 
+0xb99a48999b3ac988U, 0x422a103d58fb12caU, 0x90f30cff81cf63f0U, 0x7a8222ef9e8bb711U, 
+0x3030280dc665b755U, 0x881ff21f1a211557U, 0xe7bff3acdbd84f2U, 0xd24a183e19ea8e1aU, 
+0x5842fec2fd2bc078U, 0xc4a0760529f3ef5aU, 0xee6298b7dad880aeU, 0x963bc9fef7b637f3U, 
+0x7ddb231f5afb8657U, 0xc5ec0428f443a3c2U, 0x80a3e5092980a4f1U, 0x7ed3383fcd1e7622U, 
+0xfa281f3fa8a4d326U, 0xd1ae0c830c4719f5U, 0x8b8bcd87e4a8d86cU, 0xe9a4d09a8dc935ecU, 
+0xe6a8c7887d9ddab1U, 0x618eff0672aac13fU, 0x5edd81c41e336f77U, 0x89b4e59ec839f9c0U, 
+0x6871e76eafb608adU, 0x74805654d88fd93aU, 0xe631addcb7c8bc49U, 0x89fe6dad861da844U, 
+0x601406e7864d4dadU, 0xaea9d513e0f0a87bU, 0x87b57dffb725df39U, 0x2898278231f4e8fcU, 
+0xe4f5f21825b6e7faU, 0x3c72e26a6e9500fcU, 0x5ecdab57b08bdb17U, 0xeb150e2e8d4e7c3eU, 
+0xf7135ca79c00dd1fU, 0xd2013cd9c6155901U, 0xf2006d1494c959d6U, 0xef367c87de05b875U, 
+0x718981b19ae4a29U, 0xdf2fda6ea2232a0bU, 0x510d7ac4e1166984U, 0xc348047f3bd79759U, 
+0x34959ac4ceb09235U, 0x8422e99f0549aebfU, 0x13da8dd20e0dae9aU, 0x584781f2056a1c56U, 
+0xdd1452e899273a8fU, 0x3fdd478e694fd54aU, 0x318ec7fdfd7dac9U, 0x5c9cc4f8723a027bU, 
+0xaddaca695ce80d6eU, 0x4f003675a11acab5U, 0xa827589d3708af96U, 0x84efe07a1dfed259U, 
+0xf2e4327bcfc91deU, 0x8bd467275c0f80d4U, 0xa824a072e4c20a4bU, 0xe3ea757deb82767U, 
+0x145e8c5df582f54cU, 0xbfaf0850149c5383U, 0x23f2abf6056aaab3U, 0x13f2bf92ffae2156U, 
+0x8c8c98544883e382U, 0xd0604fcef55536f3U, 0x5be2403952007431U, 0x5ac8e192bbdfd85cU, 
+0x51373d9bddfeaadcU, 0xde76eca13d4d9d2eU, 0x39c8fff2f0963976U, 0xfcb7e5004c7a8c80U, 
+0xc5f483aaa556ed7aU, 0xf6bada2932f50e57U, 0x154a04034f63c34aU, 0x9a6cabe1f8c78b4fU, 
+0x2521483ea054a72eU, 0xfeb87eafd1220716U, 0x1de544fb7d555740U, 0xed9f5029fad50045U, 
+0xbca43077ef01a3e8U, 0xc6eb65432e48094eU, 0x2d515d44e0d67362U, 0x99dc0698b7912118U, 
+0x528645fe40f61114U, 0xb7a67034d7f8f294U, 0x697ac71171d80044U, 0x67c69cdd23b982bcU, 
+0xe73b8ec1fc74d145U, 0xb9c96bd28139b2bcU, 0xa5ddb4e150cb2609U, 0x9cd44dc242811d04U, 
+0x5c6c406240d456f7U, 0x3339b8fbfe816e5dU, 0x45ad0badd8443a3U, 0x86adcadafc464e33U, 
+0x383f7b004cd535abU, 0x7724d883e8764dc3U, 0x44024357cfcfb9f3U, 0xabe2f3618e040616U, 
+0x90711b34517b9c1aU, 0x7fde7a18c3ac8dd9U, 0xde0dbf2b202df795U, 0x4f02d64cb755b293U, 
+0xbcc2887a735a8087U, 0xf318de811d6a8871U, 0xd880f08099a2e4dcU, 0xed19a56a1b59cf5cU, 
+0xe56ca0873a9fe557U, 0xa98cfd5aae96da46U, 0x30254512ab54afe1U, 0xcfbe683e6c3b56b6U, 
+0xdb4b66b36909970cU, 0x4518dba599e6e4e0U, 0x37c6fb1f77e6099eU, 0x227cd0d78c39e721U, 
+0x285a4ae31f809727U, 0xa210ec3f7eb99ec4U, 0x87d6c8741cff5defU, 0x2225e771c819391dU, 
+0xbc64dbab7e6325f2U, 0xa68a7f0cdf05d32aU, 0xaa73845640c50eafU, 0x7318f2cc7ac20e1aU, 
+0x726271efb0013899U, 0x2ff956ece9fd3f10U, 0xd2b1bd53182a770U, 0x65746b8246e7281cU, 
+0xcd9adfc989e65b59U, 0x7a41022f7d44ff77U, 0x827ee930a8cd053bU, 0x363146820aedc5b6U, 
+0xc80a164269b4c2cfU, 0xc143c903b5c5b6e9U, 0x8e8278f920227fc1U, 0x1d87db6217897292U, 
+0xbbcd5a4df85fa6ccU, 0x83befeeffa594c92U, 0xa8b9841059328be6U, 0x4a247bce25c45963U, 
+0x53337b0f8e2bc2d7U, 0x2cd38dc8ef4d6467U, 0xc92b3080f221cddU, 0x8b4487f1d473b4f3U, 
+0x17b158bcd4c2506U, 0x5b6c5dc7f19e9fafU, 0xe74a68ce189d1fecU, 0xf65ed6b6686b18a3U, 
+0xcc52dc253913dfacU, 0x4128efc34cd6542bU, 0x5255dc2fd376e7bdU, 0xd6d0bc68328baae8U, 
+0x59544a87aece4a11U, 0xeada9af5476a97e1U, 0x7de4bd6144abc201U, 0x87d600fd202009c1U, 
+0xd019658f9a4d4876U, 0x5cabb39652a3bc0dU, 0x8dd72d4431473f9eU, 0xf2d9fac94931e5e5U, 
+0x81e4f9753b47a80bU, 0xff97c5a664249757U, 0x29dd9c276fabdba8U, 0x66a0defa11f61357U, 
+0xf7195f8ff795e8bU, 0xc230a428526edd20U, 0xcad8df2561aef474U, 0x3e24aa6de37aca41U, 
+0xe7dd9ab328523eb3U, 0x351a3a75556c6c4aU, 0x46ac18444f3dcde3U, 0xbaffd4ebf8a8b5abU, 
+0x1978300cd5acf387U, 0x24511ccfbf48b6eeU, 0x3a8eb3795ac09cU, 0xfa93dc5dbc95e83U, 
+0xae03ad0f9d2157ffU, 0xe9817b137d07f1eeU, 0x751a418ae4eb8eeeU, 0xcafb6c8657874a09U, 
+0x16cec08173ce8988U, 0x9c6ab445913b9e0eU, 0x1a1cbb99ab4e2e0U, 0x2adafb1ed5c5c67aU, 
+0xd0099b4ef4737641U, 0x1afac0c166c2e13aU, 0x7778b51236563fb7U, 0x91b44522441c89edU, 
+0xf2512b29e101bbe0U, 0xc9d7dc666e077d03U, 0x2c13235ab02fb428U, 0x3f4463bd37fda976U, 
+0x4700eb8ce51b2cf9U, 0x37d28a48a4bf795cU, 0x9a879a27cf8ea9a3U, 0x894890b2fad37ccbU, 
+0xd187ac835979d3bU, 0x498e7116a3bc2ecbU, 0x88a0abfdfd48e438U, 0xd46800ff7c5b3011U, 
+0xc6a2bab826dd01dfU, 0x743eff76538fefb9U, 0xa37ea6c7c8689165U, 0x296d135de82db07aU, 
+0x4950d320aa3a0dc8U, 0xdffaf618e5e66f60U, 0x2b87129776c777caU, 0x14054edd92e145e4U, 
+0x427abb1ccfe63974U, 0xd15f33ed2466a2dfU, 0xb7c5e38255f2bdc5U, 0x9b46d393ab8e7935U, 
+0xabedd0a2fcfb2502U, 0xbf7eed5ff5415950U, 0x554f01e26b9c5d6U, 0xf3ccefe1918b71a2U, 
+0xc67e6f06d650f5ddU, 0x54ffe1242191b2c8U, 0x8f13c2f1f19e4a96U, 0x4b0942f391367a31U, 
+0xc2ea5bcc7aeddc6dU, 0x23c6782e4e73a62U, 0xe055c1015613c25fU, 0x7432aaa6366cabc0U, 
+0xbcff60267e460d62U, 0xa26e2a1e94139936U, 0xa1697678f8b8c55bU, 0x463d8e29e481aacdU, 
+0x226650888c11217fU, 0x8f9eac14da469b0aU, 0xf1fd6c6724f85296U, 0x400f734b7ae2a66eU, 
+0x7a375e8f04e4a96fU, 0x188862b435655b14U, 0x833edb8fc4d2e4afU, 0x36377a62fecc11aU, 
+0x8bafb7e051e08cdbU, 0x84098c2143091326U, 0x8d930c5578546263U, 0xa1de191d354fdf83U, 
+0x289d10a1d758ddcaU, 0x7b75ff75817d1ee6U, 0x1dc6ac386974adfbU, 0x65ed3e3318fca1ffU, 
+0x55c81f702574bbabU, 0xad540a47e7503800U, 0x53e5b3e2c50170dbU, 0xa0af48f26663b83eU, 
+0x141fd3e1679b5a59U, 0xc621e89eb269e62aU, 0xbcbbed5709d83251U, 0xa1041af730f5e162U, 
+0xd8d2b4022c5514a3U, 0xfb30690e1eac66d9U, 0x422650d873bc2afbU, 0xad42176aa8f58b19U, 
+0x85f694280f703588U, 0xab6187b010f996c8U, 0x8366893255833b9eU, 0xdbbd8f0c432db2acU, 
+0x66dc602dae9e6efcU, 0x9fb66f2b251d8a28U, 0xb5faf53dcfe82b72U, 0x1dfa800172bdf452U, 
+0xeae8db06cddd597bU, 0xd8893170cc85758dU, 0x3371ad0f9e92007U, 0xda2167ad0b1e5647U, 
+0x2681727e3de7fa04U, 0xcdde2a52144f9f46U, 0x1ff6700ea798ebf6U, 0xa21992b62546ed36U, 
+0x67a40ad1d98b4cd9U, 0x90cfce38b355f320U, 0xcefd61b7ed7b5c63U, 0xbbc1dfe363857973U, 
+0x30f0ab4a081c5f2aU, 0x4d091e6872f5b002U, 0x97e6ebc2a186bc8dU, 0x2fbe210034c2e5c8U, 
+0x9934a222b3f7dbb0U, 0xf4ee23dc26bf29c0U, 0xbc863b872164f29dU, 0x1c3fdbc237f6c678U, 
+0xd64cbdc972e16d32U, 0x1f0646380020f8adU, 0xf0aea5394a4b18d4U, 0x39260f1037929813U, 
+0x835208d8ba111101U, 0x479f0b1a76db3c5fU, 0xed22a34d257e4c96U, 0x6ad2a098fced766U, 
+0xc1a7ba9d5fb37ef4U, 0xde429d82b70e89aeU, 0x59a4c01bb9eb62a0U, 0x2d5b8b1c58f85e35U, 
+0x2b1f0bd0f65bb830U, 0x8fe3cda3b36a5dcU, 0xeb9acb6ebfe5941aU, 0xf657e9015f9855a5U, 
+0xc3b9a74d87b193fbU, 0xc2abba9cf2c8e35aU, 0x6dc83cd25da0e7ffU, 0x8077a8bb3bcaac49U, 
+0x76fc3847702bef6fU, 0xbbae4f184531ee43U, 0x4f78bd66bd8d475U, 0xf1a2ca556c3bcd72U, 
+0x11b2d1fd8f6c1ca3U, 0xb0b47ea81fd52b40U, 0xdf455417dc020168U, 0xb39b59af0488313eU, 
+0xdb47ffceeb3fa150U, 0x855719520ec5a6e7U, 0xf0ef002c94979625U, 0xe46eabc9f8e2f20cU, 
+0xb934894c4a0b139fU, 0x50f68cc24c227e4bU, 0xadb002810c09fc3aU, 0x2532cfc894c18963U, 
+0x806028fca0455367U, 0xe6c4f2c824d613e0U, 0xee1901658ebf1851U, 0xe924ad49fe3b8030U, 
+0x5fd18cf828257e92U, 0x52da31aa4fa6752bU, 0x752085393d6fbb6fU, 0xfcc97d979a143ed5U, 
+0xe0f0bcea876ab854U, 0xa0acb88e2294af94U, 0xdfcb04e096395097U, 0x38136959c7525f69U, 
+0xf615b5aadfef276bU, 0x5aa59636de810fe6U, 0x39e0257cfac06a9eU, 0x20136ac6a0b18411U, 
+0xe91f093942f8f1e7U, 0x8dd4aa5d4dd1f9e2U, 0xa00b935105fb22f6U, 0xf49d9c7dc5f7026fU, 
+0x92228ab1914d9972U, 0x1b0013c4e4d7a83U, 0x6ae5d3b3b994f679U, 0xf5585d4203e3acaeU, 
+0x7724967e5833c4beU, 0xe06a970759acdc14U, 0x14bb5af4516750f0U, 0x107a4485aa07fe2eU, 
+0x6566ec48c87c80dcU, 0x4d3a4fc91d760c4aU, 0x813794ec48e68007U, 0x6ea22142b8e4d7cdU, 
+0x7b3a9677fb219a79U, 0x5c4cd4417e9827a7U, 0xb0e3c355755189e6U, 0x28b04d03e46a9d48U, 
+0xf8bf7cd9102dbe24U, 0x86166ccf86004be5U, 0x59cfe572183e206bU, 0xf658da9e5a14cf14U, 
+0x59e7401ea3b1c126U, 0x85fe50c9767fd95cU, 0xfb9a11d7d914d222U, 0x8618e592d6036fe6U, 
+0x789204cb07684433U, 0x1b3c5b73377e9aecU, 0xc3318ec138256e9bU, 0x3211a2188797809eU, 
+0xb2822d9c57774af9U, 0x4c16ba6511460ad8U, 0xd6850392886aefb5U, 0x3f4766be7cc1fe93U, 
+0xf7cd7f64dd4de990U, 0x1ca94cfdf9b7326fU, 0x3ab178906e6e5f51U, 0xcc810dd6a7331cbaU, 
+0xe9d749fa0c2c179fU, 0xa178aeddef98026eU, 0x935ee6a977b1486eU, 0x9b9692b014d724fcU, 
+0x60a1c2357614fcb3U, 0xb246c044118849d2U, 0xbf262ae1e166e909U, 0x4c935caf2fa8d161U, 
+0x78419f1e48e57705U, 0x21ceb7fac84d598eU, 0x1f2adab41d6f3617U, 0xe3249e02c0f8ee79U, 
+0x94b19e838caec0cU, 0x501945d716738422U, 0xdcb778c1f2486b5aU, 0xa666658701369507U, 
+0xd4dc6cd7adbd5d6aU, 0xa6067cf27df32bddU, 0xc7c45723d596a802U, 0xc9dcdeb8f6b27a1aU, 
+0xe53282ab633f2165U, 0x3e54815436800fb5U, 0xc1335f1607345b22U, 0xc6a1767dd5f26757U, 
+0xc78bceafb25b93acU, 0x17e202510587f8d2U, 0xbdf9e7693dfbb4e9U, 0xa689580bdfb7961cU, 
+0xea3d1c4d6f589aabU, 0xfcf1f817d9c4fd3aU, 0xaa7f2f015f059ff2U, 0x4657ca94b4f0783eU, 
+0x6cf20ffb313728beU, 0x96439591a3c6b94aU, 0x2736ff8344315fc5U, 0xa6d39677a7849276U, 
+0xf2bab833c357f5f4U, 0x824a920c2284059bU, 0x66b8babd2d27ecdfU, 0x674f84749b0b8816U, 
+0x1583948c5974bb08U, 0x75f3b0caaeeadd25U, 0x4a661caa2d2a1086U, 0x3f06dcd2ce62e80dU, 
+0x89655da995083c99U, 0x831606905e88f53eU, 0x985807be931d9b2eU, 0x8bc2550ce1922dbU, 
+0xc054b569cf15d864U, 0x2406fdc6a1cc8d3cU, 0xafc8ece7be26cf35U, 0x7ef66d7c5dedb0dU, 
+0x54625427740907feU, 0x9f470e3b1cce4a8bU, 0x6d40c5221fd505eU, 0x2db3325db89de6a5U, 
+0x1c101b8fd5c7c27cU, 0xeb3228b94bdc794cU, 0xe0c05b31527e97b7U, 0xec61ff29918a1d05U, 
+0xadf01167d9ddfe51U, 0xfe3c46c47690233dU, 0xd0960f82c7759298U, 0x2fa1d3dc1b257a1U, 
+0xc695143c17c7c05eU, 0xb283cb952ce5416aU, 0x14f3a72f75f28c0bU, 0x82df4e5fc06dc460U, 
+0xb9613d02d8fff26bU, 0xcf15d946842db300U, 0x275216211217cbd1U, 0xe4e188c98c96420aU, 
+0xc23e42e21d7dd05cU, 0xc54f84d4c1b00e1aU, 0x69a3fb20e7d116d1U, 0x5bb18bcdff791761U, 
+0x56c549f2cb96a309U, 0x95187587a4d2a416U, 0xf81b6dd5d7f58215U, 0x42ad92172dea4874U, 
+0x80ae1d41540368b0U, 0x1324c22f8fee949dU, 0x7d9e5b8d38e47a62U, 0x261efc9bc12b0c6aU, 
+0x13ad2559bdeb011fU, 0x7e340be1e39b5d30U, 0xfdc8852cd64fff79U, 0x8a9d2adbe386fce9U, 
+0xc409332de46e2050U, 0xf5ac2a3900f5abf0U, 0x4d6c6698316797e2U, 0x9a79bfbfe71e347fU, 
+0x7a3f4781926250d2U, 0xca94faccb6dfde31U, 0xb6f671f3b224efa9U, 0xe98b4de6d316e200U, 
+0xf1033e9515eb8034U, 0xf30b335f56e8ca4aU, 0x49aa7e59d9e7692dU, 0x6d48dfd77a2c2791U, 
+0xe873087a5ab0ce30U, 0x80210ea2a3e8961U, 0x3d5e79649e054763U, 0x3cb47245165dd12fU, 
+0x856ef847d4598089U, 0xe867737aa8d3616U, 0x552f2572bdf5a5baU, 0x1f3fa7c10b9878cfU, 
+0xed4b37c59825d989U, 0x1de1b2e886e5a500U, 0xc7cae5b3f6cd1d1eU, 0x7c27c1d9db7b9e55U, 
+0xb5143dfc540535c8U, 0x65f0a5630c8db13eU, 0xa49123fb4fc54e6fU, 0x93a5c01e7bb98923U, 
+0xc49574083d59b844U, 0x66a16204935bedffU, 0xc16a84358e15a5c1U, 0x2d440e904980c2f4U, 
+0x50ae677014bfc0d8U, 0x71e2c88697a4800eU, 0xd2a4b4298373d400U, 0xfb9198671b7ebb21U, 
+0x775250f36a805701U, 0x7e90760d5c244b5U, 0x41e4e90fe1e9d28U, 0x17fc6939a5ff362bU, 
+0xa261a5669e2047baU, 0xe54704996bb0f652U, 0xb35da0e017d67031U, 0x3fb0b929161272bbU, 
+0x57fecd4eddb24158U, 0x6c420ae7717009d3U, 0xca72621c99666dc8U, 0x9d467ae68217df94U, 
+0xa9b77255b15d3ac8U, 0x871e4ed9d99444eeU, 0x5686db122ec8ad7fU, 0xc8817e631bfdb29cU, 
+0xbf2c496232b9a312U, 0xf5107bfe96dd8358U, 0xc293c342158697c4U, 0xd157cc02d749cfd4U, 
+0xbdbdbae2df71c1U, 0x1c3186beafbb723aU, 0xd0763ba9de33e438U, 0xdab09439e08e83d5U, 
+0xb873484124c3a1e3U, 0x6e96330ca4b44e3bU, 0x385ae86f20d20b3dU, 0x763cbc1e544e1cefU, 
+0x6eef62ff4514c6fdU, 0xfd683b4d0dab013eU, 0x33d4db5710ff5936U, 0xac25da80089cf4e0U, 
+0x60b5397705830541U, 0x810983e8243bf37aU, 0x883da9312a1b338cU, 0xebc69d985cb44c7bU, 
+0xb456511069962f3cU, 0xc1e6b5ea71a0d289U, 0x4aec42b5296bc037U, 0xb467cd65660c13b8U, 
+0xf75584cb22877596U, 0x3cb212df6cbda472U, 0xbb3f5d2a011664acU, 0xdc91b9bc4d36ffeaU, 
+0x81941c7e32fd0e3dU, 0xe631e4dc5427ad60U, 0xb4d748671e165547U, 0xeea7e66c49ba3c8bU, 
+0x10411f68d91d5868U, 0x5acbada23019e3ccU, 0x28843f27be9b7d98U, 0x83fed45b9f889261U, 
+0x919b1597b43c7e8dU, 0x8533abeef2160f4U, 0x979280de26da6cdeU, 0x92f9a6f93fa37761U, 
+0x7746055552bf1285U, 0x7309284ecea31289U, 0xed41d3a6f5e542dfU, 0xbf618d715147afe8U, 
+0x119f14f26ccb63b3U, 0x7ddffe6c44408e5dU, 0xbad194b35403c67bU, 0x9a3de2d3e93e21bdU, 
+0x1c532977df93fcfU, 0x49c01d9fef582260U, 0x809f2736ee813c4cU, 0x2f809b90611112c8U, 
+0xb5cd34f827d3c9ffU, 0x7db4ba1f065935fbU, 0x65fbb469f6e48d44U, 0x3cc4767a06772486U, 
+0x3016c53cc5aa7383U, 0x772241168378473aU, 0x94f22765e37b7edfU, 0x557c538d8cd381adU, 
+0xe4eca34dd63f1117U, 0x34896f70ba7f6d8bU, 0x5100d30123fadafU, 0xa7c382f4b53b92dbU, 
+0xc1220c5e1934cb9aU, 0xae4eb76ed3c4a68cU, 0x459f777705dcfb5U, 0x1b91e5116761bf88U, 
+0xd79a7081afaefc6aU, 0xfd7516a5b209d887U, 0xa1623065bce83b11U, 0x5ce4fd836044baf3U, 
+0x38606dfbbf9db9a6U, 0x4abfbd4ab9e4acceU, 0x1e31bc1ea832c714U, 0x61042108aa50f368U, 
+0x50bc81c5a6774a96U, 0xe8231fd91838e3e8U, 0x87143bfc83a6f497U, 0x555aa998cd861213U, 
+0x9d40972d86db0e34U, 0x9a0d5d4bc8e26fa6U, 0x99d441e71350bbb8U, 0xb0532868d207bc69U, 
+0x9bbd7fa90e22477dU, 0xbbc69e0d4ff63d75U, 0x3057718fb12db4eeU, 0xd3e5fc623ebde538U, 
+0x8191f5c6da5f613dU, 0xe62d7eccd5fd57d7U, 0xeee497a64cd139a3U, 0x7b9cf2b9ddf57fceU, 
+0x32f7eef3af7dac7dU, 0x16572b9211241212U, 0xb58cd78f8d77c369U, 0x1a42f5b348a7ad7U, 
+0x27894a318195e46eU, 0x172af29328cea96bU, 0x3497f954b8bf9216U, 0x957a9c3855207781U, 
+0xb3868678b914b225U, 0x71cd9ede1d889c4eU, 0xdbacec2a8cf6eca6U, 0x84b8cbaf6945c266U, 
+0xa0a42d0d04b5ea85U, 0xce62a2bebc8f14acU, 0x34d5ac01c492104dU, 0x40a6eee647c236ffU, 
+0xe02ba1d4202afc36U, 0x134deed5143071d3U, 0x3a5b09ef1b45d3a3U, 0x4b47f537eb05ce3dU, 
+0x4e89f76a6f8133ffU, 0x345acbe9b25fbda3U, 0x2dcb06fa0e8df573U, 0xf2fc450399c85f0cU, 
+0x4bb15c4a67551756U, 0x4f37060f7513ef50U, 0xc1a61ba35d6178b6U, 0x53cafae5df3d6bb0U, 
+0x52377138a941e0feU, 0x1446972c93ffad4bU, 0xd3718a7b00221a28U, 0x1b39e92ffe9f693aU, 
+0xaabf2e3c77d17f68U, 0x7915a1dfcb8bad86U, 0xd56516f536ae418fU, 0x6b3dec9cc524e8ceU, 
+0xcfae7a20c9232402U, 0x47f2a96aa6dccb68U, 0x50981b416cd5d47U, 0xb8653937fdefd9efU, 
+0x55d4e37a2fd20baeU, 0x26035672d5b4a811U, 0x27bba12176d343aU, 0x285250edc3bcfcd9U, 
+0xf9de455a54e0ab97U, 0x6e9b1a2cf1eff323U, 0x3f7284ad1046c171U, 0x7866c086f4ad7ea8U, 
+0xf0f2efdb220ca9a7U, 0x3840e563817c6662U, 0xb651d0cc325161c0U, 0xdbc091d89944b44eU, 
+0x4d20588316c8e76bU, 0x6367309fe96192c8U, 0x2d57926d1e4aa5fcU, 0x92d80eaae856795U, 
+0xcc8876aba636a50bU, 0x5d2ef616abb75196U, 0x5836fa12fc78baf6U, 0xf1e3c56545d5a75cU, 
+0xdf77914eab3128b6U, 0x6b7fa576d22d7a6eU, 0x6c736a67f6a5f313U, 0x12b8847a6e1efce7U, 
+0xd6be4fd07ef7d72dU, 0xad3a6dd5f518e8d7U, 0xb322489c6ee06d88U, 0x9018baa11e938f23U, 
+0x1267044fc036ce68U, 0x4eb56d8002736aebU, 0xe8c147f743bf00b7U, 0xc9c382d871f9c6c9U, 
+0x517f13214e583340U, 0xf45c1b6b5d34f3b2U, 0x6d87cdabfa9b228cU, 0x584d729c81e134a7U, 
+0x72f6e5e974fb24b9U, 0x8f1770a66494c070U, 0xcd307c593030affaU, 0x2fdd80a4560d80abU, 
+0x8e24680b5182e0fU, 0x86c0e6eeb2ad008bU, 0x28a8842dde8ad36cU, 0xa77f7298d5478ddeU, 
+0xa2b37f28c4b82d57U, 0x3368ac6e2475b42cU, 0xf1e64bbca515f6aU, 0xfa48a69c911b4fcbU, 
+0x92c83ede0235809bU, 0x3c572df0b5eb8173U, 0x1e2e028dc2383c45U, 0xbaaeae00c837df7dU, 
+0xcd61d8a5c154fd62U, 0x835c3c42a1d2e7e5U, 0xb4a2307bcb49f299U, 0x325788833f324b80U, 
+0x7596c1f536ba602U, 0xdd2f1e9bff60a8a6U, 0x63336038135004a3U, 0xedd513bbfef3fb24U, 
+0x3b8086f945dbf993U, 0x61854d442da5dcacU, 0x7c592ca290f0188bU, 0x257b598c3bb3f7a9U, 
+0xf60042c40d612268U, 0x6cf59df0a5ed016U, 0x65139efa4394b8b9U, 0x6c7e46360c2131aU, 
+0xbcb4b601260166a0U, 0x238d8a5a782e7098U, 0x747fc75ce2f453caU, 0xcb6ad55df72dd8cdU, 
+0x8c38d2fa8a4b89b6U, 0xec2227152243bda3U, 0x8a5950d20f3e933aU, 0x7efd4f7497f886cbU, 
+0x6f90f9762499522cU, 0x2004f637c692e8dfU, 0x4e0990488b16813bU, 0x1874de017416a66fU, 
+0xbd43a35b812fbdc8U, 0xb89e20caa2c0e2a3U, 0x5bc2ecc7b711a36dU, 0x64131deabd6643eU, 
+0x5d3ff309a9f99380U, 0x603ae268b1fb020aU, 0xf2b380d934957598U, 0x882c7fac32d67028U, 
+0xf4b795195e411ddfU, 0x32480a1ad7b6db4bU, 0xd7b0d40606b76f34U, 0xc0043b2547ab787dU, 
+0xafd7cd7e02d2d212U, 0x4eb9fdace24c28f2U, 0xa435ffcdd3f79d61U, 0xbb75a0a9297157dU, 
+0x75eb00064bac9f32U, 0x443821cc59689b06U, 0x8a16416fe19b6400U, 0x366bb7acc275c237U, 
+0x42f0e5cfbc85d47dU, 0x1fdce50c07f0268aU, 0x4f0783ab8d61cfc0U, 0x7d107b708785af06U, 
+0x1426640292892c6dU, 0xb2a424b9ff5f946fU, 0x169d47d406c94c46U, 0xbfee7cb9ea3b7bedU, 
+0xbd8ff6b896f7daadU, 0x805488897f61a685U, 0x26de1d1626ee1537U, 0x403eaa5228613cacU, 
+0x3cb525286dd27ebU, 0xb98c55c37b3b5623U, 0x6b27d0e39bbe32ecU, 0xb767db257cc73c00U, 
+0x15521a47cf65dac4U, 0x64b700b448600ed4U, 0x5ceacb816b99d85bU, 0xdc1308c3261229cbU, 
+0x171f3a2a3e07e4f1U, 0x1fc5147dd0dc267cU, 0x818debc07ef8890eU, 0xc472c1062ed0366fU, 
+0x571c683d86b0daa9U, 0x85f3b7b1e22b5d8aU, 0x6432ab5a84d667d8U, 0x41820e01945f70e9U, 
+0xc0512999fa863437U, 0xf8c49096987f88efU, 0x42cddf6fba29971eU, 0x454e27cbfa01cbe5U, 
+0x179b00e551a6bbe6U, 0x6b8d88d5c651b986U, 0x9e7e5f8f2f81017cU, 0x134a4b214cf01e9eU, 
+0x4369534aa2f8acb1U, 0xb39d6554613f053fU, 0x85e1b7a4b8ecc31eU, 0x86f88f399545e3d6U, 
+0x14b042d105098a19U, 0x4eea62bee9165271U, 0xb37c978fb591b121U, 0x2ccfdd69a68238d6U, 
+0x3828179c8084a599U, 0xb94130623c2c0317U, 0x6226d5629c51fffU, 0xecfef25fbc3698cU, 
+0x3dcb4c13d520e922U, 0xee9d57df992f62b2U, 0xb2471c839f9a7982U, 0x8132b98bf295f2c0U, 
+0xd88377b6fcadab66U, 0xe1c6a33c3dd35602U, 0x7df7669660d9f9a0U, 0xa2a3be1fc9948e74U, 
+0xef4a12484c1aeb12U, 0xfb2de8a53480ad25U, 0x6507ed74d235ee1U, 0xa93bd8e6b524be67U, 
+0x5cb709dee63e9e1dU, 0x896dec1320eb0a98U, 0xcc8936952b904bbfU, 0x4366cd148fd0c312U, 
+0x6a57ed87db364bf4U, 0xfbe7cc19e0df4045U, 0xe86995697bb39803U, 0x2ba2ad81e31075c1U, 
+0xb89d2213207c25bfU, 0x82fbc777be2d8097U, 0x367e124677c080beU, 0x354e7ced56e78db9U, 
+0x5123a3995a864211U, 0x5fd756cb05a0aa21U, 0xe6ebd824a5cfe558U, 0x629d62e9bb994070U, 
+0x644630ba41330c21U, 0x75969944b3b7edbU, 0x9ec2c0fecc2f9b18U, 0xf11f5d1ddcbbe346U, 
+0x54e06c7749ee7ae0U, 0xcaf2cbd57927715U, 0xb3e3750f78871661U, 0xd20045d6570278c2U, 
+0x4a7d82e075e1dad8U, 0x8b80a78586c4bd2eU, 0x79b5cf720c099f49U, 0xc751c9aaf5de805bU, 
+0xd136b3612e4afc8bU, 0xe6f8970a3a0a8c02U, 0xbeb4c1fd6dc9a4ffU, 0xcb986437fc799de2U, 
+0x96f264d366f70126U, 0xfad4302c3e7bc9e1U, 0x4b887223fe0b3fd9U, 0x22fb2ecf815e2681U, 
+0x803f991f610b811cU, 0xe2a4413c312b6e56U, 0x1d3e2d7fda5dc66U, 0x5c41f0179851334U, 
+0xd3121b21099d9ba2U, 0xcf657d697aaa757U, 0x78ab5286b50f9ca8U, 0xaee9cc41b9d1d021U, 
+0x78d60483bed2ad58U, 0x312e68e26a17490eU, 0x7be97bfb00c6b1f5U, 0xb72cf302db52a36fU, 
+0xe38d54e8feda2a97U, 0xadc53adf247962ebU, 0xe13ee8c1c102a021U, 0xe6c92b5a52d770dfU, 
+0x403f3e7fc8f8a8dfU, 0xe74911c82171670U, 0x2752676cc984e02aU, 0xe280e93cd7241796U, 
+0x63ff0824894d208dU, 0xfb0da8ff0ff391a4U, 0x6bff60af2b1ff0ceU, 0xd0d3f46a7912ec5U, 
+0xd62f53f79d45d1b1U, 0xb213c0d1a71ddabfU, 0xb0474da65f909ff0U, 0xdc371b80ae1f7169U, 
+0xcd3240ac19c24451U, 0x2ad9381ab187cdd2U, 0x3d483896be3ffbe5U, 0x6c21a0c6d8702797U, 
+0xfa43dfe9236f3116U, 0xa04be5eaaaecceecU, 0x343a31d7ef641eecU, 0x15e1e64e69b11a88U, 
+0xc6e822c819cfd890U, 0xcb36c3737c071145U, 0xf47cd8387e5441e1U, 0x778d146b44137535U, 
+0xc9a87fa7d6f057f2U, 0x96ca45488ed20acaU, 0x2a52718d9786cd37U, 0x3c85ba133b011af7U, 
+0x320f09c3839bb85fU, 0x101fb06a050e62cU, 0x557582c99ad53458U, 0x55d5398d1666432bU, 
+0xf7f631184fed936fU, 0xd90d6a7f1833d9e1U, 0x59c6a9e8ebaa72aU, 0x576e229049ff8e2dU, 
+0xf642e95b4f491155U, 0x28b1eb93fff3c118U, 0xfd23639585d56f8dU, 0x419a4f03ae7617ccU, 
+0x4b91ba6ad489bbc7U, 0xc7ab4a22074c6889U, 0x2e334b1484804545U, 0x237c2d343a6e835bU, 
+0xc07e2b9212ea285aU, 0x9f01c1e6f7b910d1U, 0x7858058dddc0a7a3U, 0x1bb46408814f888bU, 
+0xdc0c8a79907dc702U, 0x1e52a34b992fa94eU, 0xa40fd9b892b4a4fcU, 0x8a3016bfafae1125U, 
+0xc0841ba9e49e8f34U, 0xc3e61dae0b35d0fcU, 0x372304ad31abf75eU, 0xa2157eb3dadf2828U, 
+0x1a8e983289eebef3U, 0x64bbba35b187f4eU, 0xfb42577ccfbe5a2U, 0x817697da70df31dU, 
+0x45012900d539785aU, 0x8c88d076b8297f01U, 0xe0973e2678627a54U, 0x4bc4e70e02fa14eU, 
+0x53990475ca62e3bbU, 0x877017727a3275c3U, 0xa5f5a1cf3f3dfb4fU, 0x5729f224b8cb4cc3U, 
+0x4e9c6714b80f772aU, 0x4c3758a2b96ee4b2U, 0x7e54f059669a910eU, 0xb76f40233e918ce5U, 
+0x2b481d7c72eeff74U, 0x56ba24196b16ae25U, 0x9618f274ceb09998U, 0x5197211a7aed93cU, 
+0x112d4bb1e114cfb5U, 0xd136189aa3d5a6a3U, 0x587739e1b7df0876U, 0xd3e492fdc1f88173U, 
+0xbceb9aa5697f7045U, 0x9c88f06e46754eefU, 0x1fee2676bf15fea3U, 0x3604a70a73f8c48bU, 
+0xd4eb281c2d5c502eU, 0x27fce62d1df14515U, 0xfb28652a88c376d2U, 0xdc386db7f409d9e0U, 
+0x23b47a257bfc1e4fU, 0x372c3db3cc760b7bU, 0xe7e69c459d7ad72bU, 0x526c6376cf20188aU, 
+0x1a2674bbac55ddffU, 0x1dad1b3f64d4b787U, 0x8a4e52310fcdc179U, 0xbebfc25586284253U, 
+0x6d4db0ca3ea2f303U, 0x3cca822d650baa70U, 0x8a3a11c4b776576cU, 0x850de265c09604ceU, 
+0xe49e72f50e08ef14U, 0x81ec6eedb69003fdU, 0xa8da901c55d8f91U, 0xef938fba5e02418aU, 
+0x84d5ffb0cac193c7U, 0x6f667f2a4fcd01b8U, 0xdab07948e47b80eU, 0x824400400839f5daU, 
+0x91af41e4c99ead51U, 0x5da3543a21d9224eU, 0x2fb2931d16078471U, 0x36e984dc73d20d60U, 
+0xc6fb9d426e0e5e3eU, 0x3babbec1704280afU, 0x4bfbdfc9ace32b20U, 0x1437714721bf485fU, 
+0x68119a550bdeb2cbU, 0x2c0cb5078f86a05bU, 0x4c9af29039895a09U, 0x2ee47b1e63b15d11U, 
+0x53ed9c7e453ad96dU, 0x23b9d3b2811f1749U, 0x4efd69719dd7c79bU, 0x6ed220b6c3014a34U, 
+0x7a8b77bb23093df0U, 0x785e24816776464dU, 0xf315147954d793afU, 0x91b6750043f604aeU, 
+0x5cde8c37d2cc9f14U, 0x933685f8f9caf67fU, 0x477c7ada96e21c5dU, 0x7fedb1e5824a00dU, 
+0x1688a672861140a8U, 0xa071eb5c5296ea6U, 0x8f231ca3c63afeb7U, 0x2530f0d5fd4f42a5U, 
+0x71ea3723a918d4bcU, 0x40cb6d19bef1b4d5U, 0xbb07d89392cff663U, 0xadcbe6a85cb4c684U, 
+0xa2367b86fb7b8dc4U, 0x5b3493028a9b3848U, 0x7c497e1a03602facU, 0xc5d9c3c7a1c4883eU, 
+0xed64978d1b2df0eaU, 0xd0d8f72fd1fd4936U, 0x5808c38605c50af3U, 0x3e59b9e25cfdb79eU, 
+0xc62dbc9c32513926U, 0xcc268940efec85ecU, 0x94febab24bfc3383U, 0x884286463ca08726U, 
+0xee4282aafb8a54dU, 0xce0eb122ebdbc15aU, 0x69660db365d81207U, 0xf778429c01c2dd5aU, 
+0x5791ea7c2ae635U, 0xf3d27b94cd4417fU, 0xb48c9ad4808a2e9fU, 0x789bbeb0199b2c38U, 
+0xb781dfecbfe96db6U, 0x7fef5a9c2ca1550fU, 0x8680b79f62f1217aU, 0x14357e6199189bc6U, 
+0xed2bac196520f1f1U, 0xd7f1b49e647f7da4U, 0xd5a5fd168ccf6f4aU, 0x3bad9d36f76f0819U, 
+0x6a1970725698df4dU, 0x499981a24eb67258U, 0xbcd9fa7d9dec0e80U, 0x49f99de33e24e659U, 
+0xb1f11f16f529b1ccU, 0x5156b3fd89b84639U, 0x2cbc4a513a0a9bbdU, 0x87c1d99c5ead72deU, 
+0xcf26978dd5a94d6cU, 0xbb0d0eb2c5b275e3U, 0xb8617a6ca55ef683U, 0x7e1654c6985d0bcdU, 
+0xb1e44a8b185ae66U, 0xa6ec16dbefa783dfU, 0x67a7df53d124118bU, 0xa6b3a4b1adb0c46dU, 
+0x7beb553f8bfbf21bU, 0xbcbf0a5df5b248ddU, 0x1361a91cd969e8d8U, 0xcb6e8d763889623U, 
+0x201391bc2fa4e24fU, 0x5dc7fc279d6f25a3U, 0x550651821d38468fU, 0x1ec07b834f2a5ee0U, 
+0x318910fd4d270725U, 0xeccd3c9377755dfcU, 0xf73485cf787edc58U, 0x83fc544920187511U, 
+0xa9684ce4ec630e3aU, 0xf61060c17ff3f1c2U, 0xe227e3a7d87f10c1U, 0x1f848f5a6c9114a4U, 
+0xaeed9ff686ca610aU, 0x4ba3926bfe359724U, 0x8629c83d1a9da426U, 0xa028552ccd06f963U, 
+0xf0f679f10b79847dU, 0x3719a8b66bb19be6U, 0x2ddb6c3ddc7f43d5U, 0x2800043ada0982e2U, 
+0xfe5b0083908d9edaU, 0xa87058dbb8513ae9U, 0xb6c0796584a4dc3bU, 0xf99174667e82909U, 
+0x4dfef3cdc41bcd10U, 0x11b9557645b44e15U, 0x8b1a2677c6ca2eb2U, 0xcfd1e54be949c358U, 
+0xac015eb9aa62e732U, 0xacd9915d08553965U, 0x9c5751bd5b052fafU, 0xf4e31f5f600958bbU, 
+0x16c8dcddf4af9b61U, 0x8e079636bf00e320U, 0xcf9be92a49ec4b56U, 0xe3ab7e11a14ff415U, 
+0xdbc29b8d92e40c9fU, 0xd03db05cf3efc38fU, 0x91fd72e6c5750431U, 0x5d946bfa1e316eddU, 
+0x4fa61d92228da5fbU, 0x90e4bf5e2a870e72U, 0x12c795e3e771291bU, 0x4b3e730c046c9e55U, 
+0xbff0a638bc169e48U, 0x65a3a11c9c23472bU, 0xe80cba07b8e0b48cU, 0x8c40964da23660e9U, 
+0x3bbeb943d64c5c17U, 0x736ed099f5f128c9U, 0x754324eab9dfd896U, 0x496ca72c0a9f844cU, 
+0xd9672e3ccb0e98a6U, 0x2578f2a97237ff73U, 0x11129ac79f4e5e56U, 0xb619b92668fece3dU, 
+0xb8e91a589f894780U, 0x37e9cca3589aec5dU, 0x1d54b8a54b42d8f7U, 0xafe915df74438fe7U, 
+0x2f969553d511d444U, 0x909e8be73ac0af45U, 0xa94b4342333f2e36U, 0x3caec3408d204686U, 
+0x9298988ac2cae99dU, 0x410beaacf463fca1U, 0xe160bcf6d078be95U, 0xf064d13b5447a158U, 
+0xc66e8f8ed4682815U, 0x2228c721f2335bf7U, 0x7b090c25bd2ddc8dU, 0x91295b62fafb0e0cU, 
+0xf5a31fcbd182fa6eU, 0xc0a632dd6981c8afU, 0x5866a3a36d35c9e7U, 0xc05482810ffac85U, 
+0x6ebcfeab661cd145U, 0xf5e664584b76d01fU, 0xd1aa8b89465d602bU, 0x2f9cd2cad0f1f533U, 
+0x3e0b5d5ad4441fbbU, 0x9eaa8520a5ed115eU, 0x7fb60c55edb92555U, 0xb4958c4e21de21d4U, 
+0x4c7e3c9f4add7118U, 0x2db9f6132d463841U, 0xe5c041fbc38cb7e1U, 0xfcd6e7bf996640efU, 
+0xfc4da1176bd00b59U, 0x2cdd704dbc1a71c7U, 0xe77ceb19f84df258U, 0xa41e9e9ed5876481U, 
+0xe8dd28cdcf2e6f15U, 0x5cd253563dd4359fU, 0xda4e1ed1efc739b8U, 0x50dc31723b30f2b6U, 
+0x5aed684c371f07f1U, 0x878cedb730d70c4aU, 0x232ea0b64606684bU, 0xb3a43f5e7b20444dU, 
+0x53cd22f4e01dfda5U, 0xec7877a0cdcb0eccU, 0x4183227369975ee7U, 0x34c64f5b248fd6b8U, 
+0xab0c96ef401403f9U, 0x32a6d94ebf58e793U, 0x2c5f09a87d6886dfU, 0xc02a0f2e94cc35acU, 
+0x21f59639a7ed80b0U, 0xabb913066000adb5U, 0xf716d457c5cd473U, 0x8ebaa8a18e491aaeU, 
+0xff7c97a46b559d49U, 0x48e1b4690ddc9b44U, 0xc2662ffd84c008b1U, 0x452e9869a46be14aU, 
+0x747c6046da0d6ba7U, 0x5982856c3b1ee425U, 0xf5c0057b6761ee52U, 0x8c5e8a8f195f80d0U, 
+0xfee1fa912975566aU, 0x6af2b72d39c2b06fU, 0x276c8d6312b7d65fU, 0x9f170a79d27219b8U, 
+0x5a576c88ecf3e6d8U, 0xa0a6a793f5db695fU, 0xc799b0077d4e8578U, 0x54a6aa2de8864a0cU, 
+0x537a67eb53ce94daU, 0x8bb24f4256829e60U, 0x51cde0dc3ac474eeU, 0x19a7f5d48c6d62bbU, 
+0x730447163025e7bbU, 0xfb625306ae25eb03U, 0x2f6a51d44200a2e8U, 0xa2504ba7a93075c3U, 
+0xa69173875f7a8d33U, 0x9a6c22e3eca47658U, 0x1a765de14913e26bU, 0xb8d550a10d926557U, 
+0x1777b77bfec3abeeU, 0x541c3aaf586f670dU, 0x7d1790c97073e188U, 0xded908e0ed161c30U, 
+0xb9696cc6d47dc697U, 0x17ee18afb5e15b9bU, 0x11eb0b2b5fc6fa4U, 0xbdaf5b020a4f34dcU, 
+0xb911cbe786a479e2U, 0x55122e7885b7a477U, 0x8cf575e47b57aa08U, 0x3cec0c6cbdfa836cU, 
+0xf0f0ded60106d8dU, 0x9ac1b330802aa4d8U, 0x70090e18f245626bU, 0x39fee9fd2d627675U, 
+0xba2715cc8fac1771U, 0xc5f7e608422bbc8fU, 0x414f1238a7434b81U, 0xa4ed4a25730ad5b3U, 
+0x2a00b91b6ce05e10U, 0x8aef7c9f43e10620U, 0xab84b7fe84ce70dbU, 0x265dbae95f39d15dU, 
+0xff7f018b171324f4U, 0x663f3933d64c67fU, 0xf3b3ce8b56cb5dcbU, 0x58df63d09a3037adU, 
+0xe7efd2361161bab2U, 0x3a45062dae0e6f28U, 0x38809b87c78cf13aU, 0x14be9987b11d1480U, 
+0x6bae9a3e4700a3f1U, 0x60c9ff44e4bb74bU, 0x4af646e95e96cd34U, 0xb1009f268e95f845U, 
+0xed15bc55b3fe5938U, 0x9ec8303db636d7cdU, 0x89f749d53a566866U, 0xc43e083f17e66396U, 
+0x7679756ed83732f3U, 0xab62307162440747U, 0x35090303abc4402eU, 0x54c6029239fbcc58U, 
+0xb05a78ab6a03780bU, 0x91a6a55184a5c130U, 0x59cad484d81501d9U, 0xdb85215d2e0e93cdU, 
+0xeaf21f928e7c4786U, 0xdf8f56684dd531bfU, 0xf9bdb3a11d663c6dU, 0x2511cd6b26fd9a07U, 
+0xc31c70f79dd52975U, 0x2bcf0fd306b44180U, 0x65ac50da77b266baU, 0x7868f1700a3f8486U, 
+0x3016ed503c626facU, 0x68f6f9eca6969044U, 0x113fa1c6db11276cU, 0xe89097cf31217ee1U, 
+0xac24e6436e12e1dfU, 0xd8a7fd0b7d761d04U, 0x4134bf13b346027cU, 0xd0e0919688e932b6U, 
+0x6a6544db9fd28fbeU, 0x544cc4bd9846b8dfU, 0xb4eb60b691dbf867U, 0x69c9a59fe7d1452U, 
+0xe27b29cc18dac2d8U, 0x8f7137ddf287be11U, 0x66d8c6be3c064abeU, 0x49c696ad84a3a2ccU, 
+0xba5cf21de3a6aee8U, 0x4d0fec2acfc3e019U, 0x578962c7088dde4bU, 0xfb7cbedae854b6dfU, 
+0xbb0d8510084aa098U, 0x9c10140a96e3e02U, 0x398a7dacbfc1fa85U, 0xb517a454a13308ebU, 
+0x6004b59f4540efbfU, 0xa4d48b54692447fdU, 0x60ea3e2fb0f26fa3U, 0xa3d877d0c1f879aU, 
+0x8eb8b6730050f080U, 0x95f5bbf94bf15388U, 0x1c42027371d3ac47U, 0xe7fe1a77506aebc7U, 
+0x48c989da99e9e32bU, 0xf8edfb37676496a8U, 0x1de51e7893cb5838U, 0x6a87c46d10e65dafU, 
+0x6d95acaa4744bfa1U, 0xcc26d27ce093643dU, 0x7bc22712d8f3e387U, 0xf8ec14384b5166f6U, 
+0xc6924e6332b65f6dU, 0xa637ac5c3900060U, 0x32368fb269d60f61U, 0x761134b2113fb9a6U, 
+0xc11746e5260aaff5U, 0xb71b993348271ef1U, 0x9b684beed1b4bc5eU, 0xa019b49ab61c6802U, 
+0x95c6dd62d5027088U, 0xc2226b31f87a0193U, 0xad17385454f78688U, 0x5cf47cc5d82a6289U, 
+0xf62c3be93227a4bbU, 0x4be6b1f00f8d99f2U, 0x94e74ead21d4f2e6U, 0x320cff78db7bfae7U, 
+0x581cc906b0f3d2d4U, 0x6047237409e2f970U, 0xab7796a254ff6299U, 0xaf9fe8d4072a8692U, 
+0x5ec3921fa72672fU, 0x5a47fd7bfa47b095U, 0x69f16f419b12308U, 0x9e02fb86b5061741U, 
+0xb24f5d49f4b7502dU, 0x11741a026ed5c3deU, 0x265ab8ce550b0c1eU, 0xd622305feea9f183U, 
+0x3b5b5a5e5c2ca683U, 0x206cf35e0a95a737U, 0x17edddccb543426aU, 0xc08de7c6a7aed85U, 
+0x92406db57db5f259U, 0xc3c8d7b7e0ea68c6U, 0xb7c8299cdfce0e79U, 0xddb76d855ea16e19U, 
+0xb8cdb44097bbedd0U, 0xf9a1355d00bc321fU, 0xa2cd693b4230f6cbU, 0x2a32684a8423a6dbU, 
+0x73aec28625cddf15U, 0xbe4a953740265c9dU, 0x80007dc929d2b089U, 0x28bf4a6ae88b1279U, 
+0x1c67acf8252ae5cdU, 0x95b652faf4fdd786U, 0x18e6f7a44ce43909U, 0xd1f8c76ad0c47c3dU, 
+0x7eb97bc3fe6d2ddaU, 0x39bae8156989f4fcU, 0xac7997b01f612032U, 0x74d45dc66120e802U, 
+0xb8b20b43b7950fcU, 0xf1e91751624d3c8eU, 0xec85ea796fdb9b69U, 0x4e2e5a2a0e8219ddU, 
+0x2608fd2a727056d2U, 0x3da949dbd9403f58U, 0xc621ed2d3e97d04bU, 0xf8575fca385c8a95U, 
+0xb790066aabdc603fU, 0xc96d65cd67dffe5aU, 0x93e33ec6267620d8U, 0xa6cb83693f3890c0U, 
+0xcace03e0c96befccU, 0xfb1ec16a4c661735U, 0x8f2d9bda4c510b72U, 0xd823c8e461f3cafcU, 
+0x9e7e0b414a892d0U, 0x4a57d6b825de9f42U, 0x16cb34dced59c1beU, 0xf6e4088bf8cda642U, 
+0x5f6a08ec6a60300aU, 0xf4cdc6f676026777U, 0x1b4d764d9952dd7eU, 0x8a6df7d6de27770U, 
+0x29e3a612e2c374b0U, 0xbf5b3598b570db4aU, 0x36bec97152424ef0U, 0x8a6c9c91ea6c3321U, 
+0x3bf7cf8db78c08bdU, 0x461534f4340f4d58U, 0x79a7885dc90132a0U, 0xe4bc7f4f65cdffafU, 
+0x6a703f10e895df07U, 0xfd75f3fa01876bd8U, 0xeb5b06e70ce08ffeU, 0x68f6b8542783dfeeU, 
+0x90c76f8a78712655U, 0xcf5293d2f310bf7fU, 0xfbc8044dfda45028U, 0xcbe1feba92e40ce6U, 
+0x9d10531d80c15fc7U, 0x666623f172e99258U, 0xf3cf09cd0e55e541U, 0xe1b40c548c1c0d5fU, 
+0x17ca84682a318024U, 0x924520de9bb624U, 0xf47d811207f4708fU, 0x1ea8aaac3f384ff9U, 
+0xe418fa233aa89692U, 0x713b08d6f94c2308U, 0xe996e6412418a776U, 0x3bdfca7181668f4dU, 
+0x93dbdb431a510308U, 0xc7dc0c6345e2ef13U, 0x49426151aeda5333U, 0xa721f68565167b8U, 
+0xa25b597e831eba7eU, 0xf1e49c2570989e56U, 0x4201bba7bc72a37eU, 0x963e315dba2a02dfU, 
+0x3dfa4b328e7c79c0U, 0x869d0ae5c0d5f13cU, 0xa2a3cb7c52167e11U, 0x5c02ba13c84a3935U, 
+0x79b2342c37ea1d7U, 0xb2393658f89aae4dU, 0x35328552518d9e4fU, 0xaca8ac95b7521056U, 
+0xddefb1049ba973a2U, 0xe1edbfdc413935e9U, 0x94304c4b92872189U, 0x7f12c567dd75cc20U, 
+0x2d58a93ed8d3763U, 0x163c1b41b3d25d44U, 0x8c0821207c82521eU, 0x79cc32165d5941a2U, 
+0x36aab0f0bc5f6bfcU, 0xadabc17581d3626bU, 0x27cc1d59942ffc3eU, 0x9cf893e8073053d0U, 
+0x5db2781cd3245b7fU, 0xa37d669690597fbfU, 0x206c21af98d85311U, 0xfa904704db667c0eU, 
+0xef833df14ddf6befU, 0xcb9eecd2624f1d47U, 0x2d6fa3ed40f1c189U, 0x1a1c8c3674a836a4U, 
+0x6c38ba21348560a9U, 0xb3e960fd626f217cU, 0x7be369478640da20U, 0x6fa2d99005994393U, 
+0xb9609377bae52757U, 0xfe39cdabc551c5eeU, 0x3754a352a6985c3aU, 0x9eba0cc3915ac7e8U, 
+0xb61f78fd77f0953aU, 0x18491483ff15439aU, 0xd672b8e1d2fa92a8U, 0x1d431aab91f57d8cU, 
+0x17c59d769d68f260U, 0xf48e29a908707e7cU, 0xbc530c83ce15fae0U, 0x8d667c3bf19121eU, 
+0x590da9836039279aU, 0xe6e4c087b13db4a8U, 0x8275247200d57597U, 0xb7bdfaa7fc579c88U, 
+0xdbbd0aab42152ae1U, 0xa7e6e36988bafc31U, 0x4bd23c461e4585f6U, 0x1d2fa9f7c76fd5d1U, 
+0x5a31171365227c70U, 0xf32beab333a3ea70U, 0xdda4b35b2e31c60fU, 0x6deeea0d5a3e1137U, 
+0xad6da3810369b9b7U, 0x287aec1e569083dbU, 0x14cbafef6acc84U, 0xcbb93f0fc7443e40U, 
+0x69b6093ae31413a4U, 0x7e015ce6891e8cdU, 0x8bd75f71b68ba4b7U, 0x9504e87a52e6a510U, 
+0x5a297af9df51c38aU, 0x261f8470d70dd9c3U, 0x66bc455d63c7f186U, 0xb6071d8fe3047cbfU, 
+0xfb5fd5e88421b54dU, 0x579b2b83a5564a4fU, 0xd4ac9d2bb1fa9dcaU, 0x28135c10635578d8U, 
+0xadccf09b8ee5d868U, 0xef0494cc91e310d8U, 0x6fa9d74107f8c15U, 0x9ed84abe3851be15U, 
+0x5f4b8c276064184eU, 0x73a39f9f9b819758U, 0x4a29a5793ec07948U, 0xcb7b973aa8bf19f0U, 
+0xa21a6aa9735bf117U, 0x1599ec23c2586640U, 0xd5fa500fda87860aU, 0x349aef9136dd9245U, 
+0x917e5591e8e4ac10U, 0x7996a812ace24a9aU, 0xd6c3cc5a09ffb568U, 0x339a057620b1077bU, 
+0xf76da8644d1312a0U, 0x5039e788f41cc66eU, 0x43854df78acf553eU, 0xca985fbedd6a947fU, 
+0xd34dab1767ea1f34U, 0x646bd35404739e0dU, 0xc3b41d1793b353d6U, 0x7f9460a23d474b66U, 
+0x58bec2cacd9063ecU, 0xc6ff815124e34ffcU, 0x69f1f2bf8f076661U, 0xd0d516778fb06187U, 
+0x2e45a0052b8c5bdbU, 0x800d59722771bc76U, 0x9f796a57e0321efcU, 0x2292b0887db3c97U, 
+0x4bcfe7b5207256f2U, 0x34c8f01116662d89U, 0x70cf0501cf4185f6U, 0x10b668847507e382U, 
+0xdc5b74c9bdfc0a9dU, 0xde44235b14f77aa0U, 0x2a60e3646ae0a2a2U, 0xdb43e7f84c329e02U, 
+0xf0b1093a9e9ad713U, 0x8839047356d2f054U, 0xb8a56c814cef9fa4U, 0xb0168da2be36b591U, 
+0x7bcffb0d1840a484U, 0xeaf7deb95dae05a0U, 0xe01efce48208425eU, 0xf6a16b6054bf7ac1U, 
+0x87dc4e6e638f9111U, 0xacdc817c6fe7ae35U, 0x59cf3e324c399409U, 0x716c92116b36d291U, 
+0x30bcb1774283808dU, 0xf8f07ce35643a89U, 0xb8515e9121fa7898U, 0xe9af3081ee0d21aeU, 
+0x966c2f8e39b39d33U, 0x976b925115136d19U, 0x85af26550fef4971U, 0xa976c8489c471260U, 
+0x1495c285ffcd7198U, 0xa45d77fd9b76f496U, 0x995b8a7f7abce4bbU, 0x3affa9b5cb5e8730U, 
+0x29f302430eb6635U, 0x10a58f03876b2f02U, 0x75c98089bf7859cdU, 0x2d4d554f8eac633dU, 
+0x2692f42cad8426dfU, 0xf41395a4e6f8a0aU, 0x703ac9383bf88359U, 0x6eb733632c806980U, 
+0x3ff759ee200b4267U, 0x9252e97c83fe1b83U, 0x30e4b2cecc08e8dU, 0x96c56ec117307a9aU, 
+0x1617acdcdbc10ba4U, 0xbc7c0ed17ff78b36U, 0x6a3efdd5ad2652c1U, 0x948f395d3e845445U, 
+0x1a6b40ca6da2be0fU, 0x5a63d297ffd0987cU, 0x72a41300a1b5a9efU, 0x98ba0006d11ae9b5U, 
+0xf7d16d7c1a16453dU, 0x8b7e87be761033dbU, 0xe1741b91f8b4d0e6U, 0xd3979d5e079d5f45U, 
+0xf3cbb83167b6d737U, 0x17ddf6628a6961a4U, 0xa4d0925753724569U, 0xc55f9335d799adb9U, 
+0x7c533b16225a4e3dU, 0x3c9b5fd6837e27b1U, 0x406d776727e41697U, 0x5c11fba94fb7606aU, 
+0xc52df5ef6569163dU, 0x14b271f8c9958360U, 0x19eb94d54cab3ccbU, 0x26a6c35de3216a9cU, 
+0xcea199a5ed326504U, 0xf65a9b4627b5202cU, 0x2c383b88c1aefc12U, 0x54c3929ce5b8c234U, 
+0x8bf011fa7ec9e107U, 0x47a53d9e608a6726U, 0xc489aa284914ab44U, 0x4696302560ea16d0U, 
+0x293be10f4bebf743U, 0x99b84da4ff66ebc4U, 0xfdb8f62b67116cbfU, 0xeb9c78a6cf98b900U, 
+0xf768a159f142e6e7U, 0x85a7af8e430fde3bU, 0x75fb6e9d80f3bbd3U, 0x42e03d6cc97964a0U, 
+0x3044f576bb5ecce7U, 0x7328158b0c0d2135U, 0xb84e8e83c19659c8U, 0x3744e9b28666d6c5U, 
+0x201321416a247721U, 0x28e8b5f052a6f839U, 0xe0e6956eb29ec3cU, 0x9546e0f8d99047aaU, 
+0x209343292da66409U, 0xce5984677788ef9U, 0xd29f157b4c41597U, 0x371da99fc1142416U, 
+0x43fc5230d298657fU, 0x3bf17374e766df81U, 0x65dbb44552523bf8U, 0xe697cc8d4bbc1435U, 
+0x50c928de45fef996U, 0x14068f6394425351U, 0x324cd0a41ef3f2deU, 0x11343e17e3656d53U, 
+0x40150ae75792adedU, 0xd0ce4d65a086f18eU, 0xb04ddf9306273765U, 0x4a9e8480deba8eeeU, 
+0xcec9b4d78e6d8483U, 0x82f2d7a846967f0dU, 0x2958f49f1b6ee945U, 0x9c39cb60a33d563dU, 
+0x94b3356f6b2c50fbU, 0xbbade52f3dbe4368U, 0x3d196b7bca16546U, 0xf097bf1ee493e510U, 
+0x1363784b6c7f27bfU, 0x41067a6336fe96a7U, 0x33e8a4eb3b323ed1U, 0xcbc809ae94d7802fU, 
+0xecc69d63caa30fa6U, 0x7ad4dd8903daa9aU, 0xd7aaceb5dfdcdb05U, 0xbd9cbb0e18115c85U, 
+0xf55c31f847a14ddaU, 0x606d0429674b4df3U, 0x443768f724013083U, 0x18f37acc90eadad7U, 
+0xe22fcdc325ac8364U, 0x77d8f7c78a8536cbU, 0xd7bbffecee1bcd0bU, 0x2f944bbaaa092c26U, 
+0xbe5cc18760a81cadU, 0x822c3c1cb43b223bU, 0x37151ef349506cf4U, 0x8bfbee24c6e52618U, 
+0x6986b9515ff0013eU, 0x8d9fc8ecacfd2376U, 0xcfd289fe71be151U, 0xd75127caa3409b59U, 
+0x5674e8e8cc7d59beU, 0x98ea18588e0932fbU, 0x4ec5ffee4772736bU, 0x5413358c281e79daU, 
+0x2d7ea1f6e4f80590U, 0x53e25b15c900b367U, 0xe7c48fd20164515aU, 0x680fd4de969cb024U, 
+0xc22849804f58b08eU, 0xdc769ced171b57ddU, 0xfeb5c7e72fd64cacU, 0xb1c1b0327ffec73U, 
+0xf1c83acf5023ab2U, 0xd8beb6cf7b955aaU, 0x95a16812870a6a7cU, 0x6e8fb87a8d354127U, 
+0x8eb80c9f876051a8U, 0xbed773963a457ea5U, 0x5dcfc1a3c1b85280U, 0x4e2fd12691b194f0U, 
+0x6afec74fe9cc9005U, 0xebb8baa592c4fe2eU, 0x371b35a1508a31bcU, 0x122abbdbf5f4fbb2U, 
+0xc21115782fb33b93U, 0x76b07b2bd63afc5cU, 0xc07879421041e8f1U, 0xb8181bc6badbe124U, 
+0x911a5e167a54ead6U, 0xf9acc5b14bf627dcU, 0xdeef104be967dd75U, 0xbb012f5118cce7caU, 
+0x367ca8fa56a80e09U, 0xa275f0f76625f5feU, 0x2004f56813c08fa0U, 0x2de758d4beff1b59U, 
+0x9d62edf5436a1cd3U, 0x7a1adc6695dad6c9U, 0xd7c032b0265e64a0U, 0xdd9acf3177d8ee67U, 
+0xf24498daa2720307U, 0xef1e169eb30aa255U, 0xed9922d448a6990U, 0x7838321620db08b9U, 
+0x82a85bd18db7cfd7U, 0xf3f68f9e7f9acdadU, 0xb51f0760f456ede9U, 0xa2821b13a3192358U, 
+0xc25035b2fa3628acU, 0x568bba2cdf5b564eU, 0x28c5a173c6ee12a4U, 0xf597a0acdc1d4a57U, 
+0x7ea0310d6cd3550fU, 0x772ecf91d412106eU, 0x7bb1bb7289622cc0U, 0xdb9168e332bd455U, 
+0x8efdb312b83b6500U, 0x4f1e86b7e98fac90U, 0x41901dda1c9671cbU, 0x69c0a197952bd5d9U, 
+0xefdfc2c9d3846b42U, 0xe0afea3ab84c8cc8U, 0x66c43d425cc76f2fU, 0x24f0d0df9fe8c11U, 
+0x78d683d4ab75d6c3U, 0xc42a5457d53a2856U, 0x8a1071821be40f3U, 0xaa222a86d6f44fb9U, 
+0x13265a4e644cb028U, 0x6071fc94b5a8c8f6U, 0xce448a25aee2df42U, 0x56378793001a8e76U, 
+0xf130159794ce1a37U, 0x9dda5bc91ea695d5U, 0x5c7073426c00051aU, 0x6f27aa1bfebab967U, 
+0x72f75ea0d1f12afbU, 0x97321e5b3092268cU, 0xef2fafb59f0a0fc8U, 0x90dbb8e8337893c0U, 
+0x7fa85739235790c9U, 0x9e01b91773f3c503U, 0x56f0c64392f35e2eU, 0x8568b26bcd9715b7U, 
+0xdd3f553826b1f5acU, 0x145e5f8fb85479fU, 0xe9078e0ae4363ce8U, 0xd3f2261a584dd2adU, 
+0x7dda97c55c38d4e4U, 0xe2fd65f1b1b17374U, 0x97566e7430181e25U, 0x3d92852611229938U, 
+0x6faaef00c0ccf0d3U, 0xcc0ab138197abc7fU, 0x3ff057035c2869eaU, 0xd32ca0a5d468eab5U, 
+0xd9de4a8bd4904297U, 0xd23b7fe32845dc2U, 0xe3fedcfbd314c30fU, 0x5551c1b53b0878eaU, 
+0xddbdec1a85153809U, 0xf2be7383db6967a6U, 0x2dc6f85e00e65a5cU, 0x2faaf850def03ffaU, 
+0xd07232580dd7718aU, 0x91c81b6519be4e4eU, 0xf7c159a25e76dff8U, 0x3b180e372b902fc3U, 
+0x726626299afd82dbU, 0x58491156702d14d0U, 0xfaa4bc9d2905211eU, 0xf2b6b117f36b58aaU, 
+0xb1488fe58e2058c2U, 0x274b136a6beb56c9U, 0x6bf7491e6ef96a09U, 0x6a9cb41f4e7d95cdU, 
+0xea95ab2bc86b1495U, 0x50886aa9aa7f367U, 0x2b907a608a21208U, 0xedd93d45ec97a966U, 
+0xfa81a51193d3653dU, 0x134ec4b274e467d5U, 0x45ef4f4098a83eb2U, 0xf352ff0391d69c9fU, 
+0x79e6678c8a44f28eU, 0x5c1995f972c582d0U, 0x20bd73dfda6d505U, 0x4472626ccb6c5ebdU, 
+0x78d15204d94b75a2U, 0x911cde8a1d8392dfU, 0x8eabd472366f4340U, 0xe46ae49aac77cfbbU, 
+0x4799fd908a81c0d6U, 0x816766c987d4a6f4U, 0x845017effe90f85bU, 0x9aa6ebebe5f5335eU, 
+0xd661df1aed4478daU, 0xf15cf6c2240e0154U, 0xafb45cdbf793ca1U, 0x670ee471034d8c23U, 
+0x628ffe4ff4f563f0U, 0x1cc3b8160ff24770U, 0x2546605b138750e8U, 0x5ca0c7425ba022caU, 
+0x245cdfd17a53cbf5U, 0x378c76b944d45159U, 0xb6ac29ed3f203addU, 0xdab5fc7fe5706d90U, 
+0xbf8c1d4b3052fb1aU, 0x87b15173c166c997U, 0x5039598fd8b49197U, 0x97f6cc216d0557b4U, 
+0xac4e290443dbd581U, 0x3cfeb38828d6b35bU, 0xefbbfa30acec6fa9U, 0x96f2e354349d9bdbU, 
+0x4d9a4ffee8f59952U, 0x35a18f1d504f5d45U, 0x4fe5d8e3960dbaf4U, 0x9fcd80885d526cfU, 
+0x41275b1ac38b82c2U, 0x3860883eee9cd107U, 0x176180985e55afb7U, 0xd981830a1604c171U, 
+0xaffd9ddbef8cc058U, 0xe0271f012581e9faU, 0x1978d1d254bf33c0U, 0x2422711875e196b1U, 
+0x1eb34324a4e9c2fcU, 0xe72cf0cf2fbd706aU, 0x8041820b14609a35U, 0xc4946e517e8399acU, 
+0x3434763766398ce8U, 0xe48bf38ed1462312U, 0xe99a0f68f47b8237U, 0x74890120b1858a4cU, 
+0x28cd6584ce8a0471U, 0xa33c738b2daf49ceU, 0x47f7cad9cbc69708U, 0x2b1c7861cb06bbU, 
+0xbd2d39266390366fU, 0x39be7c26e7c2a835U, 0xc0e8304c48234416U, 0xed035874ebf5b517U, 
+0x5cb9173e84960b03U, 0xb6ac3ab0c8808e8fU, 0xfa48c8c578094d8fU, 0x1653b64da9be33dbU, 
+0xf806a54eb0f73c69U, 0x8b38e0e4a1b564e7U, 0x9f4b2bd83e95a894U, 0xa583708169e5d560U, 
+0xb9713128037aed26U, 0x5d1e99d5eb79ec9aU, 0x90a76efd37a5d13aU, 0xa069c9743a7cf65cU, 
+0x49757a5afd297cdcU, 0x502ffe99db84fb9eU, 0xd8190f9e0e972debU, 0xbfa8bd1f061877d8U, 
+0xc5577e31bb63640eU, 0x979bb7f290c72df2U, 0x500c679ca685cbf4U, 0x51076dd7ed2f153fU, 
+0x1f69728782e4476cU, 0xc8bea4e9e720ef02U, 0xaebe650172e0fda6U, 0xb397274a2d6ddf76U, 
+0x606304b1a44e8de3U, 0x5c08966a2ecc1e07U, 0x3a5a7dcf08bd1791U, 0xf50b99b7468810b7U, 
+0x4a3f3ba6db7f3588U, 0xe975f18d21721e85U, 0x8789973a2dedcebbU, 0xe2b5061e55f18f0cU, 
+0xa9103a2d60dc749cU, 0xd83321fba27ad800U, 0xb09c743020a46e97U, 0x2a148954227198c9U, 
+0xf2e1f28ff0fa3cf2U, 0xbef92dcdc39b6f01U, 0xea3c2440a37608c4U, 0xaa215a188974e422U, 
+0xdddc6b6b82accf8bU, 0x81d2999182816fa7U, 0x645f30e251394304U, 0x598d7f61a5505770U, 
+0x1b84673c0f6cb808U, 0xd2289a8f353540b9U, 0x546c5162b273ebcaU, 0x9f3121f74f8f2609U, 
+0x1e0cc372dd962abcU, 0x1ebb7d208e87bdccU, 0xcc7a3ec58a642c87U, 0xa5a4878f4cc4453U, 
+0xe85daabc9e2cc3faU, 0x5832a64c8e50a9faU, 0x4d72b14df2903017U, 0xf7148b2288b0dc57U, 
+0x9fb39a5464aa7b3eU, 0x13c4ef1b056c9ceaU, 0x64fd2091541c5810U, 0x715a2012f49f4c4dU, 
+0xd9a33944bc7d081dU, 0x421bc588a88b47d0U, 0x1f79288f8a913b62U, 0x5922b3b1aa606c0aU, 
+0x85c3fa7018ae2298U, 0xcb07adef81b3e0d6U, 0xaa74356789578652U, 0xf8093ca11ac87d03U, 
+0x6c36192d35c93b0U, 0xe4509a0f6db6006fU, 0xb16129ec307e9cf3U, 0x32074f216ef49c10U, 
+0xd1bdb697620db220U, 0xc71ccb101687ace4U, 0xc409ce897fb87876U, 0x49ec8c5e6aa9b125U, 
+0x99b8aca0677338c2U, 0x842c3073e53b9cceU, 0x3da9cc34865f5429U, 0x99a97d4fe5ea629bU, 
+0x93925b40128aa5cdU, 0xceceaf38ed9768e7U, 0x20feb9fbdd6c93fcU, 0xf5e3efcb5a92f1b3U, 
+0xab2799c7ceaa0fb4U, 0x84e0a6f4b110cec9U, 0x4e51e2dfeb07bd2bU, 0x76cfa2899bf3de05U, 
+0x51ebca315e771268U, 0x2f4f14a7d90a6568U, 0x3e6f190e05e07b7aU, 0x1f8fb70d4850b448U, 
+0x1afd3010c909c8ddU, 0x4e1d3c311c92b3abU, 0x12c2ed74726192a1U, 0xf53e7adb461ba2bfU, 
+0xa2c15b625a3ba4eeU, 0x800f385ade168ff2U, 0xb1c320078c03d084U, 0xdf8b2be9c62045acU, 
+0x40ead285431a9955U, 0xd0a8a06c08d307e7U, 0xd1955020049f17ebU, 0xd8835d9003cfd523U, 
+0x55ec0f2b28d9819eU, 0xd606792f742dab1aU, 0xdd5d142ba678732cU, 0xb8d5c71a6497f61fU, 
+0xdc78be8ea9138ac4U, 0xe2f49f1361d45c3cU, 0x3b6ee4359b63dc79U, 0x1cd14ef132137f82U, 
+0x1ae9a5558c3b3d61U, 0x53b60aa6bd66c3e9U, 0x6595ffc144469d82U, 0x30128814f6ac0487U, 
+0x772b5e6c8f2dbb38U, 0xac30f673875adc53U, 0x12c4c890b81f7e14U, 0x5d57c66104d3c4ecU, 
+0x6a93dbe660bca3f3U, 0xecb3435145600490U, 0xdd63eb61c880d8c4U, 0x2265b5ac65baae3dU, 
+0x25829c6c517409ffU, 0x3c80a612d2393d5aU, 0x61a313a3b1096498U, 0x97a198bf5cacfe0fU, 
+0xe79c12b6916e8a30U, 0xfc7af0c38c1cb896U, 0x24af7e03f4371ba5U, 0x64d0c4f5a46437faU, 
+0xd81d912650bfeb69U, 0x7cfcf2050f1fdce5U, 0x6d03198de496a8c5U, 0x86654d5973b6abe3U, 
+0x372d23ff45bac36eU, 0x599899459975dcd0U, 0x21fd8a9f5fc9abcbU, 0xaf381cd103584925U, 
+0xff3d887ab1b119a9U, 0x589b82f1ef4d4a90U, 0xc9457f22951a2648U, 0x681a087fb7df0fbdU, 
+0x9e1994056037cfb4U, 0x7400f246c3cdaa85U, 0xd77f4880da0b0e0U, 0x42531823ff5ed0bU, 
+0xb7325ed8775d23U, 0xeea3e4f534ec5dd4U, 0x628ca4d0c8661facU, 0xc90e8bccfae00f7eU, 
+0xfd6e1483e66b5a8bU, 0x37385a1378241662U, 0xdbaa6c128d47df66U, 0xb0d7a6dbed426d40U, 
+0xf6c4fb12cc550ae3U, 0x239b77371572068bU, 0xfd1c0d687ef4a316U, 0xf652634815abf316U, 
+0x784f673546c34577U, 0xe6409ec8e6a52af7U, 0xb1f5e308e8c0e4bdU, 0x27557aa0e30bca48U, 
+0xadfeb9b80416193cU, 0x18a2ca7374c4380bU, 0x77c8d75a49fd34f3U, 0x8399c75846105b3bU, 
+0x9c1a74b282375988U, 0x68723275964aa5ebU, 0x4542cb5c539a534cU, 0x40bf36bdea2de0aU, 
+0x80d2a3d4793301cbU, 0x977abe33ae04f7f0U, 0x37d16867767ee3c5U, 0xe8b5b2b681dad753U, 
+0xee58fdb6a401f4d3U, 0xcf6c2e50ea95b301U, 0x8e50783bf561d7deU, 0x8e687817d2587364U, 
+0x90281e944294d86bU, 0x900b96f12ea19128U, 0x62f809a0506d3caeU, 0x989cab886e2c9bfaU, 
+0xed413aa6d4d4ee9cU, 0x496df469a485672bU, 0xa2f5127ccee442f3U, 0xae3648928593bc5dU, 
+0xcd0acccef9a54fffU, 0xed5bcc4a2d7f35e7U, 0xb736b39d4b8d57b7U, 0xba85f10c8713f5adU, 
+0xc5963de26d2aa8e6U, 0x205359fc40effe2dU, 0xd1036803ca67dbeeU, 0x98a41746253e5cf6U, 
+0x69740bed606cf75bU, 0xe30217faab7ed219U, 0xb11542f5a2f5cec9U, 0x579ac6947e3463d6U, 
+0xe789e3ff0cdb59dU, 0x8be44e3392eb68e1U, 0x3d70139bfcd5ce69U, 0x3754e99f0786e2e1U, 
+0x4239c0ffeb6a8499U, 0x61019b6f632734f0U, 0x12f3c27206480dbU, 0x24c2f87496addcbeU, 
+0x7ca2cc8f752c2d31U, 0x1800abb08c61eecdU, 0x92216e443e21a946U, 0xe1685442230540fdU, 
+0x1cb8836824a50fecU, 0x3e76192bf8998394U, 0x2fb2e642d02bc934U, 0x700855c928e7214U, 
+0x49e9c05cf9e01d27U, 0x672e0841205789fbU, 0x3e6f9f583214cef0U, 0x675b60bcb5e1e7c4U, 
+0xa02ed91c5c80bca3U, 0xb563ddde73f08822U, 0xe011b62a9cb6c72cU, 0x77108626b5227b4dU, 
+0x4a33bae373a7cdadU, 0x3cad83d2e50bcfafU, 0x1ca2a2e5338951a5U, 0xbfa6314b09d513eaU, 
+0xc5f88930295cb953U, 0x261190f8c84047a1U, 0x2a5f85bbb1eed1a7U, 0xb452e8194c802c78U, 
+0xc1d5c120b853417bU, 0xcc82e7626d76ad40U, 0x314124ebc2bc75e2U, 0xc93c33ccf68ce434U, 
+0x29e94d9b0f7f0362U, 0xcfe2f63a9d1e1c7dU, 0x20f2c2e2f575ddf3U, 0x6f042c8b50622bd7U, 
+0xedbcc8500ade0fb7U, 0xc6dc74dea6518d8U, 0xecf0975e6dd98e20U, 0xe687082d0a961cd3U, 
+0x9179e0f31d4d6eceU, 0x17c1e85ef88c2259U, 0x5e5f0e5321d1a721U, 0x2135a448684c9555U, 
+0x95526ee5adeb22dcU, 0xf7bdf0d378b5c674U, 0x4261e46af00a271U, 0x13025fad6c16b0bbU, 
+0xb54046ce8388aa81U, 0xa60aa874a2ae76d2U, 0x5ca9df2d3ec4a2beU, 0x6eeb1b119c216b63U, 
+0xc83cb5f0ce432dafU, 0xf3beda08aa827ac9U, 0x4bfc28d795074975U, 0x7ab16ef862a9a9e9U, 
+0x3117588aa71bdc48U, 0xc7e9ce3ae74fdb01U, 0xa359183e28dba7c5U, 0x584e0e0a97c328b1U, 
+0xc0747129885fbd44U, 0x89c2caa39f26267aU, 0xe05471ce16d5222cU, 0x9bbf06dad9ab5905U, 
+0xa3447dfa7a1d3e88U, 0xc0d4bddc15036ed2U, 0x6755daf30a6f47e8U, 0x1bcc7fa84de120a3U, 
+0x3ce59840d8490005U, 0x90599d29a4c5181fU, 0x4adaab192fbfb78cU, 0xf8ef49b4bbedf416U, 
+0x1a462e83bd62afdeU, 0x58f2128837deee67U, 0x2bbd77665a4b73aU, 0x979e67a7ee972164U, 
+0x8b7ae792b4a7b506U, 0x22758bbae7860be0U, 0x429cfb2ae7500ee9U, 0x646ff7f65b3b5bd3U, 
+0xc979c1252b36f946U, 0x492dfc4fc08e6995U, 0x5a61e331804a8fe8U, 0xbc112a9d064a18a5U, 
+0xeddeea19f87b338bU, 0xfe44d4fc2e04eba7U, 0x1b3a9b22d66d9101U, 0xbe63ab41d2c743f0U, 
+0x9d212f2591b00a85U, 0x7053cb7e45930dafU, 0x8d3021bbb90b353bU, 0x1f125f145e22f475U, 
+0x154b71c9c103b553U, 0xbe60ea2783385a80U, 0x9d0c1000b27e507eU, 0x7cc0547aa617d39aU, 
+0x5799cba3cd45a526U, 0x185a0aac228b7dU, 0xbdd728cb39fc94c4U, 0x7b329ebd2328045aU, 
+0x9890459558583600U, 0x6beb2ffe723b5310U, 0xe62280c7ebc5fd4aU, 0x1516534b9efe26deU, 
+0x8428e0cc3a0131bU, 0x2bab43c9e74e0c09U, 0xb0e74299ecaa5c59U, 0x60e343b6a7ce88eaU, 
+0xac2ef45419e717a4U, 0x68da2bdaacf01b81U, 0x563ed536daee154U, 0x946851990bc1db4eU, 
+0xa75f0fd1b526dea3U, 0x57999590f70acd9cU, 0xb3b8d0e6b2667dc0U, 0xca5c78420dc591a8U, 
+0x44342466113bd81eU, 0x578042f6caebe721U, 0xaeda82df286eb6e2U, 0xfc1d6f42b05d00e6U, 
+0x41e3d4415d7ee1eaU, 0x3976b531546dc8dcU, 0x93d74bd97fd76ce6U, 0x6d2cdf43ac02382aU, 
+0xdf82c36f08362735U, 0xdff8b37ef12b327bU, 0xb1258f8ea452d1f5U, 0xe1b98f1be7e0e8faU, 
+0xf96138c9cecb11b7U, 0x7e19ee33df74090aU, 0x7e05b49a83bb2ba2U, 0xca83e9ad9a976a0bU, 
+0xd620a694fd0c3b70U, 0xb711c812896e4022U, 0xbecab66324c6e71cU, 0xc65b97ea03f9316U, 
+0x89c1245dde69e081U, 0xc78b02d429450be0U, 0x753842a68d37b860U, 0x10d89e893681fc2U, 
+0x3b40bbd839046346U, 0x56a58de730144008U, 0x6d08a06bd967962dU, 0x3536f25c8fd607efU, 
+0x9401062bcc14fea6U, 0x9e6c3d1ea2d9b3e2U, 0x73ba16a1a529e1c3U, 0x1e271fe17de3509eU, 
+0x343779a00efea3f0U, 0x1b200bdfe2961065U, 0xe27388b02d1ed1a4U, 0xcd518f0c66805279U, 
+0xd1f27741670e9cc9U, 0x6c63a31962831ebcU, 0x4d1103e38c05df53U, 0x764705d02013d1eU, 
+0xfff83ed6847f6f8U, 0x1029b51fbd40ef53U, 0x690151f34b7f8c3cU, 0xdf50246be23d4deU, 
+0xb4cca8a6bb1633a6U, 0x4c6e166689df3449U, 0x2b232c4fbc2174abU, 0x2107047f29daf1caU, 
+0xe4c445c10d3be344U, 0x6d45b8604229f9efU, 0xcdc6e0c09f4fbd12U, 0x609907f31ab90dbaU, 
+0xf28b06ac098459f0U, 0xd8f618e7c36cc0e5U, 0x3c3ce2c80a98a2dcU, 0x273a561a693cdf6bU, 
+0x185ceaedfd4f1b81U, 0xad69a7a48cf4bb15U, 0xf69de3b336529330U, 0xca9dd5d44cf53398U, 
+0x8cc62cae42b7c8bdU, 0x66c9760bfaada10fU, 0x402471fb44467b3eU, 0x6e4b988651be2c56U, 
+0x1ead3233444c0448U, 0x96357686c10319e3U, 0x4943fccb3b7893e7U, 0xb12fadf52943dfa5U, 
+0x96575e76b369de57U, 0x1d05e70332fc4df2U, 0xe96f8f6677b2a6a7U, 0x2e2459599b0f4acU, 
+0x58627e5e8b47e27bU, 0x3bf2d82d8d98b368U, 0xbe2df29f6cea3b79U, 0x6054b2225e75b6a4U, 
+0x1829e764ae4b62U, 0x1d789cf5afad1987U, 0xb0760cd1f574e0f8U, 0x6e7106f3b190d8edU, 
+0xf536c45464e9151fU, 0x67ea3399c80d8418U, 0x43255dda91d8fb3eU, 0x48388e34f1c50568U, 
+0x1bee49edcd7a9434U, 0x99b1411153de8310U, 0x6a25339315482bccU, 0xb0ec63abf4e44e9eU, 
+0x8d93ca698eb99805U, 0xad086d4ce99a11e3U, 0xb0c2bf930bf33a68U, 0x1ee7fc202708cfeU, 
+0x9fd5f4e10eeccafU, 0x811836ea35be799bU, 0x124be02ef3455711U, 0x9655cef01b024882U, 
+0xd7dfb4a58e5b833dU, 0x593a0073ca0b2419U, 0x5e65df81050109c9U, 0xde8e6447ae1453daU, 
+0xf0fcc19aa14c5cc7U, 0x987e03132901c6c9U, 0xe332288cbd6de265U, 0x5e1463c150913d8U, 
+0x754205712bf6f44eU, 0x4a403a59c9330e24U, 0xced279a2fdd4b0e9U, 0x16cf2eee40a0ee4U, 
+0x53225c3f611603a8U, 0xafcf53e490868b9bU, 0xb52e38390dce53bdU, 0xb8e9cf624ea7d5a8U, 
+0x3e2593eac1f7df48U, 0xb267473eb871317bU, 0x8e555b4e4e58f385U, 0xb18b12d0a4ec7e9eU, 
+0x91b3d590e846b546U, 0x3c83f7e483d1e559U, 0x5cec426bc5acc33bU, 0xff531922a359fb44U, 
+0xb52dec8f375f2b54U, 0x4efe3560e3e92350U, 0x5066e911891524bcU, 0x77b20a912e6b2313U, 
+0xcaa801fcd6cc67ffU, 0xdf623da1e850e0f1U, 0xf7b10bfcdd038a72U, 0xa3dc291825cea3f7U, 
+0xf253adc699c9fd24U, 0x2cdd89845211e0dU, 0xc7c1caa4c7286944U, 0x5f51ad71c8dc9433U, 
+0x9c3bae886d2ffd3aU, 0x8721f6244624a996U, 0xcd305fbcc2e4d03U, 0x2bbbef11df7e714aU, 
+0xea6a3d9c467b9766U, 0x9f02f864cb7c7cd3U, 0x9f79cfa01eb3a0f6U, 0xc1e164748d9c4ecbU, 
+0xffd437efd6e8f30U, 0x6254dcb278d2fb65U, 0x46a9a2e228ca25c4U, 0x104e006a2e19ba8bU, 
+0xe3c4063fd7cec42eU, 0x6f3dc933eee3bdb7U, 0xfa5822ee4346d855U, 0xfdf340d937301ebbU, 
+0x38f634b7cdb6908bU, 0x456e6abf50de30c8U, 0xd70c1fe738cad2c4U, 0xa3e59a63968cc6e1U, 
+0xe51cdf4fed6741cbU, 0xd1d983ea87c3ea8fU, 0xcd84489c68f7b4bU, 0x510869f66298a7cfU, 
+0x57252b046fc4ac9dU, 0x30380a05e0a5c278U, 0xba412433bba63ce9U, 0xcee1ab93a5b40cc2U, 
+0xfc189454e1dc4fe8U, 0xf9e8a13a96072415U, 0xec6452917b7dc983U, 0xe3caebc8b9ea5d79U, 
+0x16b60b721307b403U, 0x51300365a14f86a1U, 0xd22035cb8b01f976U, 0x97f093d27bf05928U, 
+0x5c0c0e3df00d264cU, 0x1455ea638f8ff5daU, 0xe419e6f78dcae1U, 0x6e83c3a6b43fdcd3U, 
+0x8e70f5a400603714U, 0x5bc0dbf6915fe849U, 0xb257110a49af6412U, 0xcd3da4cf0228e56cU, 
+0x6414d65d3c119effU, 0x39902e0c0a9f9b84U, 0x9af41a5ce58fa003U, 0x3312db942a865b8U, 
+0xfe95a3a9f8b1b950U, 0xaec59db5f515585U, 0x104eea317809e86fU, 0x6e3eda646b3724dfU, 
+};
+
+static const unsigned char Generator_Table_Infinity_Flags_P_256[] =
+{
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+
+};
+
+static const mp_limb_t Parameters_secp256k1[] =
+{
+0xfffffffefffffc2fU, 0xffffffffffffffffU, 0xffffffffffffffffU, 0xffffffffffffffffU, 
+0xbfd25e8cd0364141U, 0xbaaedce6af48a03bU, 0xfffffffffffffffeU, 0xffffffffffffffffU, 
+0x0U, 0x0U, 0x0U, 0x0U, 
+0x7U, 0x0U, 0x0U, 0x0U, 
+0x1U, 0x0U, 0x0U, 0x0U, 
+0x59f2815b16f81798U, 0x29bfcdb2dce28d9U, 0x55a06295ce870b07U, 0x79be667ef9dcbbacU, 
+0x9c47d08ffb10d4b8U, 0xfd17b448a6855419U, 0x5da4fbfc0e1108a8U, 0x483ada7726a3c465U, 
+};
+
+static const mp_limb_t Generator_Table_Points_secp256k1[] =
+{
+0x59f2815b16f81798U, 0x29bfcdb2dce28d9U, 0x55a06295ce870b07U, 0x79be667ef9dcbbacU, 
+0x9c47d08ffb10d4b8U, 0xfd17b448a6855419U, 0x5da4fbfc0e1108a8U, 0x483ada7726a3c465U, 
+0xabac09b95c709ee5U, 0x5c778e4b8cef3ca7U, 0x3045406e95c07cd8U, 0xc6047f9441ed7d6dU, 
+0x236431a950cfe52aU, 0xf7f632653266d0e1U, 0xa3c58419466ceaeeU, 0x1ae168fea63dc339U, 
+0x8601f113bce036f9U, 0xb531c845836f99b0U, 0x49344f85f89d5229U, 0xf9308a019258c310U, 
+0x6cb9fd7584b8e672U, 0x6500a99934c2231bU, 0xfe337e62a37f356U, 0x388f7b0f632de814U, 
+0x74fa94abe8c4cd13U, 0xcc6c13900ee07584U, 0x581e4904930b1404U, 0xe493dbf1c10d80f3U, 
+0xcfe97bdc47739922U, 0xd967ae33bfbdfe40U, 0x5642e2098ea51448U, 0x51ed993ea0d455b7U, 
+0xcba8d569b240efe4U, 0xe88b84bddc619ab7U, 0x55b4a7250a5c5128U, 0x2f8bde4d1a072093U, 
+0xdca87d3aa6ac62d6U, 0xf788271bab0d6840U, 0xd4dba9dda6c9c426U, 0xd8ac222636e5e3d6U, 
+0x2f057a1460297556U, 0x82f6472f8568a18bU, 0x20453a14355235d3U, 0xfff97bd5755eeea4U, 
+0x3c870c36b075f297U, 0xde80f0f6518fe4a0U, 0xf3be96017f45c560U, 0xae12777aacfbb620U, 
+0xe92bddedcac4f9bcU, 0x3d419b7e0330e39cU, 0xa398f365f2ea7a0eU, 0x5cbdf0646e5db4eaU, 
+0xa5082628087264daU, 0xa813d0b813fde7b5U, 0xa3178d6d861a54dbU, 0x6aebca40ba255960U, 
+0x67784ef3e10a2a01U, 0xa1bdd05e5af888aU, 0xaff3843fb70f3c2fU, 0x2f01e5e15cca351dU, 
+0xb5da2cb76cbde904U, 0xc2e213d6ba5b7617U, 0x293d082a132d13b4U, 0x5c4da8a741539949U, 
+0xc35f110dfc27ccbeU, 0xe09796974c57e714U, 0x9ad178a9f559abdU, 0xacd484e2f0c7f653U, 
+0x5cc262ac64f9c37U, 0xadd888a4375f8e0fU, 0x64380971763b61e9U, 0xcc338921b0a7d9fdU, 
+0x52a68e2a47e247c7U, 0x3442d49b1943c2b7U, 0x35477c7b1ae6ae5dU, 0xa0434d9e47f3c862U, 
+0x3cbee53b037368d7U, 0x6f794c2ed877a159U, 0xa3b6c7e693a24c69U, 0x893aba425419bc27U, 
+0xbbec17895da008cbU, 0x5649980be5c17891U, 0x5ef4246b70c65aacU, 0x774ae7f858a9411eU, 
+0x301d74c9c953c61bU, 0x372db1e2dff9d6a8U, 0x243dd56d7b7b365U, 0xd984a032eb6b5e19U, 
+0xc5b0f47070afe85aU, 0x687cf4419620095bU, 0x15c38f004d734633U, 0xd01115d548e7561bU, 
+0x6b051b13f4062327U, 0x79238c5dd9a86d52U, 0xa8b64537e17bd815U, 0xa9f34ffdc815e0d7U, 
+0xdeeddf8f19405aa8U, 0xb075fbc6610e58cdU, 0xc7d1d205c3748651U, 0xf28773c2d975288bU, 
+0x29b5cb52db03ed81U, 0x3a1a06da521fa91fU, 0x758212eb65cdaf47U, 0xab0902e8d880a89U, 
+0xe49b241a60e823e4U, 0x26aa7b63678949e6U, 0xfd64e67f07d38e32U, 0x499fdf9e895e719cU, 
+0xc65f40d403a13f5bU, 0x464279c27a3f95bcU, 0x90f044e4a7b3d464U, 0xcac2f6c4b54e8551U, 
+0x44adbcf8e27e080eU, 0x31e5946f3c85f79eU, 0x5a465ae3095ff411U, 0xd7924d4f7d43ea96U, 
+0xc504dc9ff6a26b58U, 0xea40af2bd896d3a5U, 0x83842ec228cc6defU, 0x581e2872a86c72a6U, 
+0xc44ee89e2a6dec0aU, 0xb2a31369b87a5ae9U, 0x3011aabc21c23e97U, 0xe60fce93b59e9ec5U, 
+0xe1f32cce69616821U, 0x1296891e44d23f0bU, 0x9db99f34f5793710U, 0xf7e3507399e59592U, 
+0x75d0dbd407143e65U, 0xdacffcb89904a61dU, 0x47b6e054e2f378ceU, 0xd30199d74fb5a22dU, 
+0x5b3ff1f24106ab9U, 0x1f760cc364ed8196U, 0xb3d6dec9e9838065U, 0x95038d9d0ae3d5c3U, 
+0x9bd870aa1118e5c3U, 0xfc579b27452bebc1U, 0xb441656ef4e65b4bU, 0x6eca335d9645307dU, 
+0x498a2f7805a08668U, 0x3a496a3a3bf8ec34U, 0x592f579074b875a0U, 0xd50123b57a7a0710U, 
+0xe37918e6f874ef8bU, 0xfc4c6f1dcdbafd81U, 0xb1051eaf832823cU, 0xbf23c1542d16eab7U, 
+0x4dc37efe66831d9fU, 0xc522fc54811e2f78U, 0x7ad928a0ba5392e4U, 0x5cb3866fc3300373U, 
+0xecd31e14f87f62eU, 0x10e6e63863716127U, 0xd7c744ed34659f0U, 0xe9623bbef1bf90ecU, 
+0x53013eafa44ee737U, 0xfe6043c9dd68844eU, 0xe0fe953a8edaa929U, 0x38a9743b4bc299e9U, 
+0x43933aca7f8cb0e3U, 0xa22eb53fe1efe3a4U, 0x8fa64e044b2eb72eU, 0x3f0e80e574456d8fU, 
+0xcb0289e2ea5f404fU, 0x9501253aa65b53a4U, 0xe90b9c08485d01b3U, 0xcb66d7d7296cbc91U, 
+0xeb0aadf82a8d733cU, 0xffc274bf62fca8f9U, 0x884a36f2080d682U, 0xbc82dd73e5161dbaU, 
+0x1e786104f47797f0U, 0xae93a0bae7389730U, 0x54a9b4bf719f02dfU, 0xe5f28c3a044b1cacU, 
+0x647077456769a24eU, 0xbcf55cd700535655U, 0x696c3d09f7d1671cU, 0x34ff3be4033f7a06U, 
+0x8491067a73cc2f1aU, 0x55df16c3e8f8b681U, 0x3f6619d89832098cU, 0x5d9d11623a236c55U, 
+0xd7efe2315fbc7671U, 0x743f1bc852858e32U, 0xd20291ce1798f490U, 0x8e3d1248c7657211U, 
+0x7ef1dc6418717decU, 0xb9352baaa63e144aU, 0xf64480e19393e90eU, 0x99a48e10ecfcb81U, 
+0x5ec32ad51b03f6cU, 0xa4d047122a9b184bU, 0x2bc776838f73f576U, 0x308913a27a52d922U, 
+0x60ab5efce8fe4c67U, 0xa8333fea82bd1f12U, 0x91e3531f66c0375dU, 0xf4a5b09543febe5fU, 
+0xf3287432beb31db2U, 0x8fcae82788f506a0U, 0x896a193ed088a2b6U, 0x78a891aa2234a498U, 
+0x3069d623b9fa4343U, 0x54379bcdd800b82dU, 0xfcf5f25527302df6U, 0x6912a35beb5035cbU, 
+0xc7b750f733ce1752U, 0xe783c797d7cd204eU, 0x812ddf64d99c9aeaU, 0xd7a0da58d01dc635U, 
+0xbbc027380762cef4U, 0xbe040a8c062b742U, 0xf6f2928340e28465U, 0x912770e068008032U, 
+0x65348f778db0e595U, 0xa7163cb9fba082bbU, 0xd7ce3765816076ebU, 0x7d86781855db1b17U, 
+0x99951e3abc733de8U, 0x2937844e0e25d532U, 0x2e562e2bed4f8838U, 0xe2b99adfec86f877U, 
+0x609c45706ce6b514U, 0x890905c79b357322U, 0x8885c35600844d49U, 0x8bc89c2f919ed15U, 
+0x6f63f4cea8c95157U, 0x172d3056112776f0U, 0xde776fec3b5892c1U, 0xd313f3cdd7cdcc16U, 
+0x8fef8516060dfcU, 0x76545f84205e6a2aU, 0x48494b9dc41ab086U, 0xddc5310f00582ac8U, 
+0xfb5f8ab6e7820ca8U, 0x41dbafc6abd04730U, 0x191ab6dcc8f0e90U, 0xba0d2f3af20d9692U, 
+0x646e23fd5f51508U, 0xd8c39cabd5ac1ca1U, 0xea2a6e3e172de238U, 0x8282263212c609d9U, 
+0xd31b6eaff6e26cafU, 0x62d613ac2f7b17beU, 0x5e8256e830b60aceU, 0x11f8a8098557dfe4U, 
+0x926e2c00ef34a24dU, 0xadbc968d9e159d0U, 0x905a857a9cf918d5U, 0x465370b287a79ff3U, 
+0xa2f8fb20b33887f4U, 0x588e09b215d37a10U, 0xa4af8bdafdeec2c1U, 0x35e531b38368c082U, 
+0xfcfc0cb9e57e8dfaU, 0x9809191a3c7e184U, 0xd9a30f8aca98ca0U, 0x8262cf2ff0799c4cU, 
+0x35cff8d8fbac376aU, 0x57b6ed332b14c478U, 0x66fee22ec5b34f34U, 0x83fd95e209109e4eU, 
+0xd5b901b2e285131fU, 0xaaec6ecdc813b088U, 0xd664a18f66ad6240U, 0x241febb8e23cbd77U, 
+0xabb3e66f2750026dU, 0xcd50fd0fbd0cb5afU, 0xd6c420bd13981df8U, 0x513378d9ff94f8d3U, 
+0x9052e48b026bdb6fU, 0x7ca41bd47b734b94U, 0x168105b24ce99c87U, 0x19825c8b1da0ddd5U, 
+0xb5df7084c49cfc9bU, 0xebe9eecc8cf6d3a6U, 0x320261cc94f59f6cU, 0x6294310f0d4c878fU, 
+0xd17cc1f27c70620cU, 0x4998c4beabc288d9U, 0xc60dd31a2b671780U, 0x1653a8a48d2c236dU, 
+0x6ca2e81d315b32cdU, 0x12af748dfd3dc52U, 0xeafa99474efa701cU, 0x338290935af7f7aU, 
+0x50ed09523d82824cU, 0xdfa58e345e1534e6U, 0x43c5f56ec6c2999eU, 0x6f12d86c11601914U, 
+0x8579c34806eb34d0U, 0x391c92410854bc5bU, 0x875994f3fd623769U, 0x5c4ff7f44ab3bfa0U, 
+0xedcb63069b920471U, 0xfc318b85f423de0dU, 0xfce4cc2983d8f8d9U, 0x5d1bdb4ea172fa79U, 
+0x70330666f7b83103U, 0x79eb1e9996c56e7bU, 0x794bb99438a22656U, 0x2843826779379e2eU, 
+0x76ddc02db453629U, 0x45cfdcdc0f59e603U, 0x14262716a23abef6U, 0x203a8c6f9a0aaa5dU, 
+0x5971c7853ff89f84U, 0x686deb25c5285ed4U, 0x36cc76d15f410612U, 0x3b0f0b53de5dd9b9U, 
+0xb9446557b147f3d6U, 0x553199217ab8cb45U, 0x19e6a36324655103U, 0x474a4732c294b1e1U, 
+0xdcee852828628ba4U, 0x11fa7f17010e1300U, 0xed2cc30cc3a48aa3U, 0x94625e231206f04eU, 
+0x783130dde46c7ecbU, 0x9d3aed3fe5bb4ce9U, 0xc81ef7334866e1ecU, 0x6e2acaeb3d034181U, 
+0x8449201eeebc8720U, 0xfac706b91b67512cU, 0x9d80c4daf0fb643aU, 0x9e61a46797efee14U, 
+0x47d42ba6e71dabcdU, 0x54d3fe4989e5cb4fU, 0x6098ae3260b5373fU, 0xd49ee4fb6b63f43cU, 
+0xe66a90cf016603c2U, 0x129c509312ff7031U, 0xd7c87ea7a61bf356U, 0x531e39209a5490dU, 
+0xeb7018f3f0a4147eU, 0x2747dd8bf775f201U, 0xaf61717e8a490a58U, 0xd5a70492e9e9156bU, 
+0x8e4b3cb833fb65ffU, 0xf4c4d9847967f57fU, 0xfc490990765e0532U, 0x9db526f5dbab89c6U, 
+0x63da8f68b43841c6U, 0x12aa3cc0d343efbdU, 0x49bb6b52dcebf4c2U, 0x6cc1109e03df0899U, 
+0xb9733a46b954e94dU, 0xd79b433e2d906cf5U, 0xffd3d6b0a29ffecU, 0xaf561afe9c094b76U, 
+0x4eddb46bd8edcec6U, 0xa1061cc2d3634f45U, 0x523efc6302cdac6U, 0x38c5119aabe18ba8U, 
+0x456e0bfb1933db08U, 0x28a16c822b5530a6U, 0x668cb2da275f282fU, 0xe649dd2285d9732aU, 
+0x73fce5b551e5b739U, 0xe0b93833fd2222edU, 0x72f99cc6c6fc846dU, 0x175e159f728b865aU, 
+0x6efa6ffee9fed695U, 0xacb5955add24345cU, 0xa4ef97a51ff71f5eU, 0xd3506e0d9e3c79ebU, 
+0xce78049e46bc47d6U, 0x30fdfeb5c6da121bU, 0xa5ffbcc8e139c621U, 0x423a013f03ff32d7U, 
+0xd1236e6d8b548a34U, 0x720d8ec3524f009eU, 0xa1179f7bbaf6b3c7U, 0xb91ae00fe1e1d970U, 
+0x65b7f8f1c5041216U, 0x3f7335f6842b836aU, 0x128b59efdc2fed52U, 0xda75317b21f7acf4U, 
+0xdaed32986e708572U, 0xe9aac07ae77acedaU, 0xdf19e21b342d7fc6U, 0x73f8a046bf72d5f0U, 
+0x302df6f78416824aU, 0x49df662f3b3e2741U, 0x8907a7abcd68776U, 0x111d6a45ac1fb905U, 
+0xa9a111d42108e9d0U, 0xf070008996daca4cU, 0xb90d48dbff065952U, 0x696911c478eaffbU, 
+0xb0143e71e465a930U, 0x2587f1c16b1352fdU, 0x573c58c4a82eb1eU, 0x1c71c5b48e9749d7U, 
+0x1d873f6cc34638b5U, 0x79345e3fb7174d47U, 0x2713f1f2824bb68cU, 0x4a91c334e8f5fa0cU, 
+0x9505324f3c62bac0U, 0x19150ddf51f0ab06U, 0x1364b7d2c3e8b70eU, 0x9530f0f9023f469cU, 
+0x478abda97618e309U, 0xe25b32852f1fdc68U, 0x34dd2f7f59b333e0U, 0x8f3c305a8f9f21e2U, 
+0xe318dae5badb6ee7U, 0x7850dd432744a077U, 0x936e837a909b4c9cU, 0xd84e4afc1f31a566U, 
+0x82d556e6d42ebed2U, 0xfdd8ac974aa3e649U, 0x12a38d58f565de4dU, 0xe525809a7c7b79ceU, 
+0xab5edde01bced775U, 0x7290b68a5ef74e56U, 0xad795dbebcb9dcffU, 0x4a4a6dc97ac7c8b8U, 
+0xb2bf8f68a78dd66dU, 0x1de90cdb424742acU, 0x943ef9f739c0f457U, 0x529911b016631e72U, 
+0x394e9ecfa49e6d10U, 0xf60adff3aeac99d2U, 0x41b22b9285ff6ed3U, 0xf3d4444bde66814dU, 
+0xa038cc05347da3fU, 0xfc1ada50ce9d6c63U, 0x4bab95ac198a4b5bU, 0xa4324dfa6f0163dU, 
+0xf5e91b77a547b4b3U, 0x356929d1fd665411U, 0x1df82efee099522cU, 0xf006c42f1d8e4f75U, 
+0xb5ef449fa86aa74bU, 0x75c933eed6be7ae1U, 0x5c47848a4e4f7d16U, 0xf68154d4a666520aU, 
+0x48cb3406e9d33a07U, 0x4e72ee08aa39bcabU, 0xf9085520cdbdf404U, 0xae30652c9d9c1d89U, 
+0x74870c0f60a0b2a6U, 0x1c9c37f5dfd7e95cU, 0xefcce7d33db8d5cfU, 0x6cb9d9c38d63fe57U, 
+0x6704385dc3c9c8fU, 0xf2816fee3e4367b2U, 0x6f09ff43aaa332b0U, 0x67be02dcbe4298fdU, 
+0x55384998593652d9U, 0xcd993bf60b88c2beU, 0xa2c945b608291693U, 0x7a9b55a73e4def84U, 
+0x759654b90c28cacaU, 0x1869c7bbcc8281daU, 0x15e17e7583388c9aU, 0xd8dc1b2a5bd5e1c8U, 
+0xcdb676ea23b3ec7aU, 0x7d315d2cec8128f6U, 0x8c6d8da420247d94U, 0x8cec0ad927cec7d5U, 
+0xc5c2f974518b01b5U, 0xddccc88b8710badaU, 0xc1a50c45352405b1U, 0xe69b346403de885U, 
+0x418ee36878d965c5U, 0xcedf595f3d00683eU, 0x61ded70ab7d7dd37U, 0xb4efac5fcd7e452U, 
+0x8921fb663bc4416fU, 0xa7aefd23f30b0402U, 0xd59425a8d032f31dU, 0x2749e292c5f84eccU, 
+0x7e98bde2fc6bbd8eU, 0xf59e9fb65ee96105U, 0x403d94990fcadb3eU, 0x50cc2d4e37672bc4U, 
+0x526bad8f83ff4640U, 0x53441c7e55552ffeU, 0x99ceac05b6262ee0U, 0x363d90d447b00c9cU, 
+0x62003c7f3bee9de9U, 0x45b9a89008199ecbU, 0x953b445397f33631U, 0x4e273adfc732221U, 
+0xd2712a5caf92c541U, 0xb62fb012edfb59dU, 0x553973c6c93b02bfU, 0x4c1b9866ed9a7e9bU, 
+0x72c4f3fdc68fe020U, 0xc652ead7e43eb1adU, 0x7fbcb753ce56e69cU, 0xc1f792d320be8a0fU, 
+0x4b891216f6e55dc8U, 0x6ff95ab6eaca0439U, 0xba84a440c0509442U, 0x4431404790c5ffb2U, 
+0x31d944aedbe323b3U, 0xa66a29b79eaa2e50U, 0xfe99837f5642fed7U, 0x96b0c142e65366f8U, 
+0xe0c8f28cbeaaf3d1U, 0x3233edbc1a28f135U, 0x529a2f3c0780b54eU, 0xa4083877ba83b12bU, 
+0xb12b534df0b254b9U, 0x2001e7576ed1ef90U, 0xb8bf83d69361b3e2U, 0x40e9f612feefbc79U, 
+0xdfe9485d701b23a8U, 0xab7b7d470a87ee0aU, 0x126243d5b921089dU, 0x9e22fe8d866ca87cU, 
+0xf7a413c50884edaeU, 0xc0f7c949fb511cecU, 0x177f3f02099c1533U, 0xfd2ff0e9ca122d10U, 
+0x3eb5e19633f0e9aaU, 0x68112776b11bd34bU, 0xb7924ae0d58138d2U, 0xe5380fe8575f26adU, 
+0xc4ba41364082720fU, 0x6fb94e5df468318eU, 0x5b691363924c8e01U, 0xb97fd8739087b41dU, 
+0xdd7408bf071a70e4U, 0xcd5ee51f5f5cf475U, 0x2edd69e64705306dU, 0x508df6d503ce2a8dU, 
+0xdf2e5bf729950984U, 0x4ec03228ee8aadfeU, 0x777304aa733e49c5U, 0x154c439b933bc42dU, 
+0x8cd3db5a7940d33aU, 0x6e0d880a454203b9U, 0x3a4e3e1a2f56c86fU, 0xa804c641d28cc0b5U, 
+0x43ce95fa6d46967aU, 0x1af18ca89cf736a9U, 0x3dec2842c16047e8U, 0x95be83252b2fa6d0U, 
+0x6eafda76ce1abe11U, 0xdab921c259cb220fU, 0x338df581930125b2U, 0xe3dbff8455109763U, 
+0x4b49ad549fa8de63U, 0xd3c97d903c6b5c41U, 0x6438fa75db8a8ef3U, 0x6f2f9099a341421U, 
+0xe6929378b63968b6U, 0xf4026165ed9e3ab2U, 0x43c5a9600890893aU, 0xf7a4be3dfc6579fbU, 
+0x494dda32d0c34882U, 0x99702fb8d110105eU, 0x21d2903038ca52d2U, 0xd6ddef6ce823c615U, 
+0xdcf1b23603593449U, 0xf61b7c12e42a46ffU, 0x878d9c13a07d014aU, 0x19ace064c7de940dU, 
+0x3a414b93adf83631U, 0xac710b9f4084068aU, 0xbfebd739d9402c46U, 0xe37992035268a333U, 
+0x1aed361beebc61d6U, 0x8a8fd3a7d9ff42deU, 0xc395f0d15d6b1f51U, 0x939ff3e4a3ed9af0U, 
+0xe75ea466a3f5cb70U, 0x980bf26eb78c7f82U, 0x9d46fc4eef016c04U, 0xdeab3bcf08b7a90eU, 
+0xee3e9892ccba6b63U, 0xa0fe674fd0b3bb5U, 0x108c33228ea88e31U, 0xd8740cec20f87daaU, 
+0xbeea36c06934c5f3U, 0x40104f5cc381694aU, 0x378a6ee9903ac37dU, 0x6472c133c6b932bfU, 
+0xa34ed6e88a8ff2cfU, 0x38ea755c7b062094U, 0x797a98dba24051a4U, 0x19a9e5f1c4cae30U, 
+0x3a77e766db0e4352U, 0xce7ebee88486d35U, 0xfa9062925012b730U, 0x1e661c67ea85af5eU, 
+0x6194ff2c1b3ec038U, 0xd9fd516ae60c6b27U, 0x64883e762f290a50U, 0x58ac33391b506083U, 
+0x16eaa3f110246279U, 0x219043c0b4fbbcaU, 0x78779249e991fe97U, 0x9163d706d55c92d9U, 
+0x69f79a55dffdf80cU, 0x43e4a781a15bcd1bU, 0x8c6244b5b7456388U, 0x8b4b5f165df3c2beU, 
+0xb3eff0c65fd4fd36U, 0xf9e336546162ee56U, 0xb3fbd7813ab0da04U, 0x4aad0a6f68d308b4U, 
+0xbb3f26714755e4beU, 0x71af64ee417c997aU, 0x8ce17c7ec83c6110U, 0xed0c5ce4e1329171U, 
+0x63f9fa6ea07bf42fU, 0x49d93925763ddab1U, 0xbf3dad7f5a7ea680U, 0x221a9fc7bc2345bdU, 
+0xa0a2a582f55812ddU, 0x3d446723552d30e2U, 0xb6abed6c058f78eU, 0x7029bd7a92ff352fU, 
+0x721cc66b1a2d2927U, 0x47dae84243b2c73cU, 0x7dd6544ae30683acU, 0xb0eefadafde8b3d2U, 
+0xd4b6e6c807cec8abU, 0xe53254566e0552ceU, 0xb3b15c3f83f1fae8U, 0xfaecb013c44ce694U, 
+0x8981dfd9ab155070U, 0x9c32b286b85e2e2eU, 0xfc2e02c6ec2fb13dU, 0xcc09b5e90e9ecb57U, 
+0x49ce5683bd486ed1U, 0x5745beba49565b6aU, 0x9d4109d8cf7560U, 0x9ccfedcaeae65c99U, 
+0x4f6d59ed75e95d8dU, 0x2421675969592aa2U, 0xb6122481200b3411U, 0x7c2f4d713d6a32cfU, 
+0xdcdabff9b181fdc2U, 0xdd2f62bb5cc62364U, 0x4aa264b818a34e7eU, 0xf42c102af47e6e47U, 
+0x81f00093a485d7fdU, 0x4c15502d9a2acf26U, 0x78fad05cb86fe22aU, 0x57503ab46cfe806cU, 
+0xa206b1a75bd0eacaU, 0xd0c74576ba2d4ab7U, 0x35a8fde33ca4df19U, 0xcd9a4b8763414143U, 
+0x6e6fafb5abff4accU, 0x127b38eed6f634fU, 0x815488ae933ea08bU, 0xf0455879a1e8f23eU, 
+0x7f64eae9ad1b1f7U, 0xb3b2dd824f23cd3eU, 0xc8731a0b37cbcafdU, 0x9bb8a132dcad2f2U, 
+0x64130627c3811c80U, 0xf54a840f4752d53U, 0xb6f9dd284f863e85U, 0x945bb2b2afeee3b9U, 
+0xf20953a3c7bc57c6U, 0x4903d7a23eb276cbU, 0x884f2d2e93d63094U, 0xad09882f88ed9beaU, 
+0xca32c0edae4a0ab8U, 0x7b311d373590e2d3U, 0xa28186c729dabe5fU, 0x7243c08c42fba52bU, 
+0x9e2dab644f927dc7U, 0x37a7a40d63d418a4U, 0xe669ed95366a1423U, 0xe260a0cc082ba6bbU, 
+0xa45f36f446aef35dU, 0xedbcc0b4462cb82dU, 0xf073cb3d725bf440U, 0x37ee6744b0da9d67U, 
+0xea830c72aba56302U, 0xf506a937af0f1862U, 0x1eada2d2a9fad2e0U, 0xd9d1290aeb3ca41fU, 
+0xeaaddafa88291c29U, 0x1739aecd9fa74f2aU, 0x29715c6726386e4U, 0x7eb53113ec2d3eedU, 
+0x3866d47deedd7dd6U, 0x49376fe265e1968cU, 0xca5a7840ee7cfdecU, 0x32cfcf6a24c7524bU, 
+0x25fd44aefe08e330U, 0x7a0d8cd20349a08bU, 0x6208096a409f561eU, 0x21846a34976a7748U, 
+0xbacd3704f4d1243aU, 0x2b126023f54a5fdU, 0x91cd21ac063f5584U, 0xbc5079de539d6cefU, 
+0xf5c95168855db68aU, 0x5f7ee4f5b1f47169U, 0x8eec72b94dffc8d7U, 0x65062a3b3a705cbbU, 
+0x696d03fdf6abf83dU, 0xb8f94058fb2d0596U, 0x3ecbe68f10d22c02U, 0x235caadde85ac49fU, 
+0x7f4ec9e90d33e191U, 0x3f0518d6323610aeU, 0xee4232a5bc93ad89U, 0xdc12f9c745fd47ebU, 
+0x8d244e6b74a3f9fU, 0xc287a665dc098169U, 0x913deaae7db2625aU, 0x4d31a77e505fc7e8U, 
+0x4fcb0241301e0ba7U, 0xcbf6fb51b6e00a75U, 0x6b18f38c7802753U, 0x22241ec96098575bU, 
+0xcb6115925232fcdaU, 0xb700dbffa6c0e77bU, 0x6bf771c00bd548c7U, 0x723cbaa6e5db996dU, 
+0x1dc069d9eb39f5fU, 0x2660a06537794948U, 0xa921137488824d6eU, 0x96e867b5595cc498U, 
+0x1fd383d60ca030d5U, 0x2d240a4307984907U, 0x343d7dc45773a3c6U, 0x57efa786437b744dU, 
+0xb07ab44274b02f9eU, 0x689b6d2ae5e9974aU, 0x893627c928de03ecU, 0xd712db0bd1b48518U, 
+0x2567e09e80633cb1U, 0x575a224b69d02113U, 0xc6273212181fcbU, 0x6dde9cf317aacad4U, 
+0x57dd49aa67ce6b34U, 0x80b27fdacf859ef3U, 0x5c99ef86a1ba66a8U, 0x9188fbe7a707e41dU, 
+0x7fafc7770c584dd5U, 0x1080577e327b012aU, 0xa2df7e9cd5226cb9U, 0x264bbd436a28bc42U, 
+0xe61227937704ab11U, 0x6a118243717b8d8dU, 0xd4f75ce24c33be22U, 0xd87c6fa94ee093b4U, 
+0x419a518d2933f3c5U, 0x85a0f7115f12522U, 0x13c4bb7f8e47b850U, 0x486fa72cd5b5cde8U, 
+0x9ad4a71acafb0f53U, 0x62d9b783cf0f23b7U, 0xe48c48baecc8f19fU, 0x62e12319f56bdd43U, 
+0x4d0bd76a44e5467dU, 0x40908ab819bbfaceU, 0x2c21f62e0ec970e9U, 0x97d064f0fc69a122U, 
+0x797300fd1e9cb3faU, 0xda5fb3b854f17ccdU, 0x3f7c66fa850861fU, 0x89974f2ed33402ccU, 
+0xebd594225e99f728U, 0x677375fbe6f12204U, 0xb664ff27b76a5303U, 0x24796974a894af4fU, 
+0x37a00516ebaaebffU, 0x5adbf3c09575a2d8U, 0xec52e87e7d8d664aU, 0xe3d78d44688f3001U, 
+0x2bf26bd84b2438e8U, 0xa78bc61fd5bdec9dU, 0xdac85c056236a79dU, 0xa94c6524bd40d2bbU, 
+0xc2e2c8dbf18661f4U, 0x7e5d3c60a0e39b2bU, 0xfd79219505019e3aU, 0xb5201fd992f96280U, 
+0xc9e0c6d42fb0079aU, 0x916f9ef723926049U, 0x631a59ee76b38324U, 0x2f39cbdaa3d55ff0U, 
+0xfe2297302c5690baU, 0x9bfb3fbc882a0230U, 0x4da936d0278da58bU, 0xabeadbde13863983U, 
+0x5f46f289b98086c8U, 0x40c10e34b62663ffU, 0x289263b70aa8e6fcU, 0x3e842e5baa802bddU, 
+0xf994b5138ee939a9U, 0x37b8e576b75e7d4eU, 0x1b93704631b077c0U, 0x89f24ff5fc92e72eU, 
+0x793300b2e4f7ab73U, 0x62e3d4ea9d4443a7U, 0x56a39e86c534aed2U, 0xe5a31d6c327d61baU, 
+0x3913a3fc70561f42U, 0xbf8c4449a80cba21U, 0xc118a977a4ece5dU, 0x37788c3d8d1e9d7aU, 
+0xcca81cb913613becU, 0x8bb5fc9d101cfe67U, 0xedf1b33dc74f972aU, 0x2dcfcab8c93937bdU, 
+0x3e7309249a039215U, 0x3732cfbad33f5f38U, 0x65f088b7d6f6c6f4U, 0x46dbc4dd9474a412U, 
+0x88f929a3c14dcd86U, 0x1fc5d42096bf71b5U, 0xdf50dd982051dcf1U, 0xcc389d4a0d153447U, 
+0x68eb6dd9c8f0a873U, 0x5c57e18fe7e7874U, 0x9b568bdbbea910caU, 0x93ae4fd660f6bbedU, 
+0x8443d764dfb4f6beU, 0xb567d5ff4fa3eb64U, 0x8ec4bb0428f0e8b6U, 0xa2ae53d1ae758228U, 
+0xc04225674aeeb9a2U, 0x4c0efa67c3d40436U, 0x7c95679c7c1b547cU, 0x6933594d44b3a098U, 
+0x24f9c6eb78819311U, 0xb3e1ee210877147U, 0x3750a17e0cf5ed1fU, 0x7f9291c89d71e902U, 
+0xaa9f9b57ac2eb125U, 0x120aaa409c86a174U, 0xf5d0de8c452415b6U, 0x9da00d1063ec3ef0U, 
+0x9a533eca0e7dd7faU, 0x947961237a91983U, 0xba5feec812c2d3b5U, 0xeebfa4d493bebf98U, 
+0xddfd4fdae1de8999U, 0x9ae4cdc3a711f712U, 0x69ee7edaf178089dU, 0x5d9a8ca3970ef0f2U, 
+0x76bee90847d297fdU, 0xc4ea4bc08f6766d6U, 0xa61c6031c118495fU, 0x381c4ad7a7a97bfdU, 
+0x93ace3187d493fc5U, 0xf0451032db939c00U, 0x8f3e5fa709915eccU, 0x936af53b238eeee4U, 
+0xf3f678ffbb7cecebU, 0x73a59f938897faf0U, 0x36ffb8126f6e6814U, 0x437a86204276d450U, 
+0x7363bcc356c181e1U, 0x87220fcfdc8f9782U, 0x69b8feb699d297ffU, 0xb916ba13eeac32fU, 
+0x448d70422ede454cU, 0x9cf1d05fefdd08b2U, 0xcce10831d9538c47U, 0xe1efb9cd05adc63bU, 
+0xad9fd233a8913797U, 0x464e3244a7a2d4c6U, 0xb0154c1ffe477123U, 0xecb4530d8af9be7U, 
+0xd58d729e097f96f2U, 0x35823529d2c8735cU, 0x83cb7e3b9a3cc273U, 0xa9ef9f13e2a489bcU, 
+0xc03d55b056c04be4U, 0xb74f89af5a9b4702U, 0xd956ee160ebb613dU, 0xe814cce594559d7cU, 
+0x4c9d9d87dcbf00ebU, 0x41b4e98bc18d0227U, 0x49be16f6a1a30bc2U, 0xb89070ae96ead4dcU, 
+0x1b7f1bcd1b0e664eU, 0xcb0d8b06b6b96a67U, 0x472294e4c1c4a766U, 0x6f24c8c2c8a2d88fU, 
+0xbc0ab5a1350cf77eU, 0x7dbf57454a8ab0dU, 0x553827d69faa0642U, 0x66d80541ee1d35beU, 
+0x2a5f97afa0eaa3a6U, 0x9444b43ab7b1b76dU, 0xc3f1d420535613f6U, 0x51cfdfe732fffb42U, 
+0xd33feeb329eb99a4U, 0xc7e5419f33d47b18U, 0xc5ac235e9af475a8U, 0x5318f9b1a2697010U, 
+0x2c726eeefe91f92dU, 0xa41f2b40d1e3ec65U, 0x5772d93aebb405e8U, 0xf44ccfeb4beda419U, 
+0x9354862887213a5aU, 0xb73204a785fa62bU, 0xbf3508a1c64cc3c8U, 0x62ac05e136503fa2U, 
+0xc10d21c0f46a9e45U, 0xe5590901817994efU, 0xd395e79e07a92579U, 0x236fbdf3a0d1a6e4U, 
+0xd6b21b3cefc76ac1U, 0x6124c395ca422c05U, 0x37e1859a7d53e899U, 0x188ef3bfab103784U, 
+0x3516032a528f00bcU, 0xe4d66de83c763875U, 0xd005fb18cf398e38U, 0xe6fc997a052fba99U, 
+0xc30fd49867bad12bU, 0x85d5ea00eaf66e1eU, 0x5bf613af5c6f2db3U, 0xca13c44972448f5bU, 
+0x89699f469723b0f2U, 0x6370ab7111a57566U, 0xac15fa64eaada3d6U, 0x83aa098361c287c8U, 
+0xb9d6ff9ab6fbe7b2U, 0x5eadedc1458d65a3U, 0xf336bbb1b2a88460U, 0x264887669cb441f8U, 
+0x932a78bc21bc2a34U, 0x5638d9816a0eb603U, 0x8f2f2dcad02ddf18U, 0x9e15dab4b2014498U, 
+0xddaee5f95c80414eU, 0x14ef8a862d66cf7fU, 0x5ac11c4f44609e49U, 0x1cecb101a7052ae8U, 
+0xdcae9492d2169a3bU, 0x907557e5447231d0U, 0x4e5aa32835edad16U, 0xf343606696097cfbU, 
+0x50d1e4d18b20907dU, 0x3b15b2d61607851cU, 0xb002f45894850ff4U, 0xf98b5dbc3e54c227U, 
+0x8351319b5cc926afU, 0x41fcd9e025a90e35U, 0x42939b706ba9cc9eU, 0xe2d508bd4f4a13faU, 
+0xc4f5bc8c4ed810a9U, 0x4f889d3f3c700155U, 0xc950daf5f1df2392U, 0x2a69907504d78f9cU, 
+0xcf86b388fa9b4728U, 0x667d47e97ec145c7U, 0xc3ec586954fb04fcU, 0x54f9039b6c3dffdaU, 
+0xefd7835b39a48db0U, 0x9f1215a29b3c03bfU, 0x2791d0a09b7bde45U, 0x100f44da696e7167U, 
+0xfbd5cd62bc65a09U, 0xb7ff4a18ff5195acU, 0x2ec8f3300c090666U, 0xcdd9e13192a00b77U, 
+0x4b05284f1e4df706U, 0xd8d9c8f9237d0808U, 0xa8415dff2b4c4199U, 0x8c0989f2ceb5c771U, 
+0x736ac5a35d72fa98U, 0x60de6bf5156511aaU, 0xffd2172cb9dc966cU, 0xfb4dbd044f432034U, 
+0x9cb9a13495bc15b4U, 0x9275028e465a2ee6U, 0xed858ee9ced7ca8dU, 0x10e90e2e51eeadc9U, 
+0x34ebe60958aa258dU, 0x4ca5896302bb6a88U, 0x4d57a8c616ad1f75U, 0xc68a370380d5e042U, 
+0xb1e63c33dc47bffdU, 0x9c528539bc95bc1bU, 0xc4a481743262c025U, 0xfb8f153c5e266704U, 
+0x90a45ddd949b095U, 0x1dde1389ac542613U, 0x16fa11d9b4bccd53U, 0x6ca27a9dc5e06218U, 
+0x2dd3fc303fe75269U, 0xa377a3cc053d3318U, 0x4575b90b714b7dcdU, 0xf7422f42da541638U, 
+0x18980e8717e49bd5U, 0x7fb3a237f4a398e0U, 0xd18ce7dcb9f63597U, 0x406c2f1a3313093fU, 
+0xf62abc87a1c0a80U, 0x4d625158c65a9c74U, 0xb17c9be7002ff9c3U, 0xb6b15a68a614cca5U, 
+0xb6cd011041ce0a03U, 0x9c9a12b3082e16eeU, 0xa54e223eef6536d4U, 0xfae62e14d6cdb61eU, 
+0x653b6696f5a7175fU, 0xedb8e771d31cf42aU, 0x72879a5582d5debbU, 0x2d8cad0417d43cffU, 
+0xcf37bb91bb9d592aU, 0x7a846bfd9cb5e5e0U, 0x7bb232fa612c9d37U, 0xc73f3b83318ca94aU, 
+0xb8fa1b8b4bb2629aU, 0x65a02c587737a7b8U, 0x5a0cc9f0a7287084U, 0xe747333fd75d5175U, 
+0x9f8d961a6946f6d6U, 0xc88376aa6e1a969aU, 0x4cc43603804c2581U, 0xf2affe0145070c11U, 
+0xe34c9bc394b51045U, 0xbbc6c896f31c25b3U, 0x8ae73d4eb1e8cf73U, 0x1ecbfd1db98a6ea5U, 
+0x53a6710102c70026U, 0xb1900646b436422dU, 0x447d0bb1849a9b38U, 0x1cf6e2308b99c3a6U, 
+0x4a35b56c6413e439U, 0xf92f69efddd5ef67U, 0xaf8b1bfeb7edb64aU, 0x99741bb8b477e296U, 
+0x3e657d826832cd5bU, 0xb17c15c9697466e4U, 0xe735aa56258e3e7aU, 0xde47e9b07bd9c9a5U, 
+0xf7acd766e9358533U, 0x10a933f9d4fb4b9dU, 0x83e955a291d32a8cU, 0x9a0894c5fe577528U, 
+0xfb3e1c5dc360ba08U, 0x65a6e5bdbb80ddadU, 0x1f917d5f954fc321U, 0xa79883c4201b8fc3U, 
+0xa7caa50a92b062d4U, 0x7a5ce7e59bb6a141U, 0x6fb171283ea227aU, 0x35963ea43256eacaU, 
+0xa10aa4d1bbb25302U, 0xd04082b964de59b1U, 0xbfcce196f9c08a96U, 0xf65be1454951e5c9U, 
+0x694405d6198ef7f6U, 0x5923f3f77a078f9fU, 0x5bd9c85273b8aea6U, 0x664dd849db4fd2e3U, 
+0xe7496ff35d1eac94U, 0xfc3d3ab31b8e6eceU, 0xa1448ce5dd0458cfU, 0xad51201717f27932U, 
+0xd0b66f3119334f0U, 0x74728efb3a0ad1b6U, 0xc6a0e82485c29e41U, 0xcebb7b7b02cfc321U, 
+0x16750bd251e45191U, 0x4765a29db9e036cbU, 0xba1ec0f74dd2e370U, 0xfe3df243633b4a32U, 
+0xe0c0a6b7c3c934b3U, 0x2b31f5805b0ae2c4U, 0x8231d9669811a702U, 0x82113a9377d0b863U, 
+0x77e5e62ac42c6a0fU, 0xaa1f7c269a446803U, 0x8466cf2b5a0c628U, 0x8da1b8dac9ae3666U, 
+0x2c8acde6e534fd2dU, 0xa77f8d4464f3b385U, 0x1dc9227a4a04c017U, 0xe1031be262c7ed1bU, 
+0xa44f18f29456a00dU, 0xf292dd419e1ced79U, 0x6bb6a4176597535aU, 0x9d7061928940405eU, 
+0x84e27e36a95c8356U, 0x28a6ac5de94d857U, 0xb9f95dcd0f29b2c9U, 0xf4b93f224c8089eaU, 
+0xbd5861b9be001fd3U, 0xc37ef1344915609aU, 0xb0e5f6a7a40eee90U, 0xa67a92ec062962dfU, 
+0x579623aeef028d83U, 0x6195926dba743961U, 0x6a5abe5a15de69dbU, 0xa7ebf7c4e3c785ecU, 
+0x9640392b99d0bed1U, 0x47a389274b053919U, 0xcfd9c7377044804bU, 0x6205152fbfe362d5U, 
+0x20d62fe17b160e8aU, 0xd51e8512f97e696cU, 0xb19622ea025b08b0U, 0x9d1aca1fce55236U, 
+0x34e050c57ca04c44U, 0x6fe9e0ee9212b5e5U, 0x3e56692ce0d8c27eU, 0x1153188f5101f0c6U, 
+0xbae0e40227dd5cfaU, 0x6a89c5137f09d4b5U, 0x1cdc6a5342634633U, 0x5b5ca08dcb024f4cU, 
+0xe664a6f99e48e98cU, 0xbfd067ccaf3269d3U, 0xe991f0cea8869094U, 0x3eccb6f70aa15825U, 
+0xf28844137bb61ee5U, 0xda4f04e2fb1f0c13U, 0x662638cd8974ae6eU, 0xd4933230cc8721b8U, 
+0x662da4d0e5d694a8U, 0x1ad12c8c5a438ddcU, 0xedcc5e9d1ecafb5eU, 0x21c09abf51a9d23U, 
+0x2b9528e323531f82U, 0xff51326bb10c2c9fU, 0xccef3e7489c22c29U, 0x46f26acc1114bb5U, 
+0xa505fc8b0bceda07U, 0xd025945cdab55c7fU, 0xce2370ac2fc32579U, 0x6b804b31635b82eaU, 
+0xe97d7d0475ba7fc2U, 0x518b3a93bfc39562U, 0x18a2ad793821cde7U, 0xc66c59cc454c2b9eU, 
+0x7ec3c69cf75f5956U, 0xf00a60ddb1595597U, 0xbea4f3ceaac10cb2U, 0xd9592fe2bfb30fcfU, 
+0x60b1543710432711U, 0xcf140b2fdd916b90U, 0x35f96f0f0899645aU, 0xc11926d931e0efb5U, 
+0xe49261e2efe2610cU, 0x83ab922ca0f34055U, 0x18494bf186ccc6cfU, 0x8be1f8cc7d25b689U, 
+0xf836c6cd22be316cU, 0x6bf4043f278e7ad0U, 0x2b17cef5b25ef5f1U, 0x559cd5aa4a0b37b3U, 
+0x1a6ab9c99fe04013U, 0x8a389a1d360780e7U, 0xf2dba929874c692fU, 0xaad5449c08d44076U, 
+0xc179874fa1257963U, 0x5b018d52c34aa861U, 0x6cdbb54b538979c4U, 0x690846e9eb688f2eU, 
+0x3a576599466f9835U, 0x6cbc3ca821c92b25U, 0xb4017024f92fbb7fU, 0xe2485fcb7f3febc5U, 
+0x530ddcbcec04554aU, 0xaadcffbb4688cffeU, 0x474652c27a10a2ecU, 0x896f37c89873d1a0U, 
+0xd68f9fe1929138dfU, 0xe6085b61acc417dcU, 0xda622bb04e811bf1U, 0x380423e7224ac4acU, 
+0x2d11394bdee23aceU, 0xdec87c65b54dd2fdU, 0xbba7552df4a32915U, 0xfb3df7fb8c9220baU, 
+0xe09def4c9722e8deU, 0x9e727142fed27f5eU, 0x52a251540dbab58aU, 0x510e29bc11c73c56U, 
+0x5f90f1305cd36f89U, 0x1e4754c6e700cb92U, 0x651d68b872900ee3U, 0x482b6f1769155239U, 
+0x467ca37270a4f423U, 0x19ee073442d49a68U, 0xcb18c23e6d7fe92eU, 0xe8c3c11df9a5cc5aU, 
+0x8607cfef50272351U, 0x70734b3df99ff109U, 0x3eb8a3eb3ab1cd41U, 0x6dd85ec24f5c518bU, 
+0x9b07fa2b7fc7664bU, 0x877c6ff7c3e0817cU, 0x9d407f9af5c41b7U, 0x16ea67f4121f427eU, 
+0x2d5e688d9094696dU, 0x5cf8b266a41d6af5U, 0xac2839f143bd7ecU, 0xfeea6cae46d55b53U, 
+0x3155debf18090088U, 0x981c8957cc41442dU, 0xb06e4e12bf3ecd5cU, 0xe57c6b6c97dce1baU, 
+0xaa4040aee752b08U, 0x141ecae0b331a187U, 0xc53261af9db2e179U, 0x4d000b621adb87e1U, 
+0x3e72851f48302ceaU, 0xcb7df5f119c7293aU, 0xcb6d825582d972ccU, 0x6a0d5b8f18e0d255U, 
+0x79361bb48dfd587U, 0x5ec4ba38c9b02656U, 0x34867aaa2cf5a12dU, 0x5084b41bacf4508bU, 
+0x6e79e97f91470e89U, 0x5db6f5606891f560U, 0x619aa6c855292747U, 0x34a9631a1d980d31U, 
+0xf89962fd475c58efU, 0xd657a0403e1f1b77U, 0xd6aa262114717128U, 0x71f570ca203da05dU, 
+0xf8649a72d35d420eU, 0xf2445d00c3363e7dU, 0xd25557345bc95b8dU, 0xeb42415b95dc880dU, 
+0xd08232617ab34cc6U, 0xc80c29767cf30a12U, 0x53fb3f1fd18d7128U, 0x4f14c03e0642d5eaU, 
+0x25ec252f987e681fU, 0xb9de3cce8e81dd02U, 0xc653a70f43a62540U, 0x7b53d0a8caa4e894U, 
+0x4d05956d6c953fa9U, 0x28ab2629f0b8c3dbU, 0x3a5f485d4bd18c06U, 0xa49ed10eaaab9323U, 
+0x67b2bd2246fb4c72U, 0x5ae87534968e181bU, 0xe03476c0a0dfddfbU, 0xcc72b894660f5398U, 
+0x342771011241d90dU, 0xe81cf141db2444f8U, 0xd41436095eddd363U, 0xa74db87e49c79ed1U, 
+0xf32518b83f7adad4U, 0xa9ee509344a0a313U, 0x27fdd08a588171c8U, 0xf78691cdaf23eef3U, 
+0x6048b06043ff8359U, 0x46b4821dc65e7651U, 0xb7d282b5c21da014U, 0xa2b7b3629f7bd253U, 
+0xa2397fecfe86fec2U, 0x10d10835046f3835U, 0x57a937a3f71e29c9U, 0x693038941695122dU, 
+0xa5ecca2231c1ae1fU, 0x456e58c68acd40b2U, 0x9acdcd44eba35658U, 0x6901fa5744baa2cfU, 
+0xf833065d22838b0U, 0xd79f3ba5e5c77a93U, 0x461b5380c29c900dU, 0x35de5c882273c212U, 
+0x34f0901399f1f366U, 0x4a79057a3d0076beU, 0xa495f216b4994d90U, 0x5d134e5c5da47f7bU, 
+0xe2b0d3e9c4990f2cU, 0xcf02d61620a88b39U, 0x2dbe2a4ae3a82b73U, 0x3b1ef4d3e084504U, 
+0x4b031081b27a4bdbU, 0x46a6d0435494cacU, 0xa244b643f1bba35dU, 0x8d3cd82d1d438127U, 
+0xc3d34c7ce69a8a2cU, 0xd4e3807d370ad296U, 0x70cfbf9d0076236eU, 0x9bd4256180ee41f4U, 
+0x3c096d3fe7a1d916U, 0x315b0a395d1f1f3aU, 0xbac6158a65dbb070U, 0x650ef9acb6d59d0cU, 
+0x85849ca67068387bU, 0x58bb4608a76c26baU, 0x70e9c0b9279b82c5U, 0x85d11f21162b118U, 
+0x440cd3c6b4ec1d2dU, 0xd9099f5c6e7d8f45U, 0xafe9d672967b691fU, 0xeaf98363d6064739U, 
+0xfcfe75604c838452U, 0xa9f52d5457e84b53U, 0x775228a0e6b199aaU, 0xe518183a7fe78d22U, 
+0xd42c8e808bd98ee1U, 0x579df37a908992beU, 0xfea7c924a8fba197U, 0x1d770ace0ceb2183U, 
+0xf9fb81791d38ffcaU, 0x37f61ca40e3d57ecU, 0x78963038b6552a86U, 0x278f8805f46ef5deU, 
+0xbcb35bf7045ae767U, 0xc273a9cb9e89771cU, 0x66f40e052c06e5d8U, 0xfb95bd163aedb634U, 
+0x1853ea0afbbf0e11U, 0xb816f4718a59f134U, 0x52004d9d3682275bU, 0x664c14d811a8ddbcU, 
+0x33fa978bc1ec6cb1U, 0xfeed657d808583deU, 0xb367be4be6ffca3cU, 0xda67a91d91049cdcU, 
+0x7e9ea8e27a68be1dU, 0xdec7adc508f740a1U, 0x41f463f7ec9780e5U, 0x9bacaa35481642bcU, 
+0x5ee3cc821fe741c9U, 0x8bbd9f35ccea5a83U, 0x7c0c0cfaaf00d871U, 0x4dbacd365fa1ef58U, 
+0x60be10f8338eb623U, 0xcc384a09fc0535fU, 0x7fdcfd59e838299dU, 0x16c3540e8a51892eU, 
+0x9efdd06515bc8a44U, 0x68410177cbe151a1U, 0xd38565a4ba5a5fc7U, 0x4d0180583cfceda3U, 
+0x2f1f94c91adbc09eU, 0x969420468582da36U, 0x67e9ba8007d63813U, 0x3a33c6c18cb4f5d3U, 
+0x87eda8bab4e218daU, 0xf4c85f152686050U, 0xe68f17d8ff41c259U, 0x13d1ffc481509beeU, 
+0xe0db419ddb191c19U, 0xa4ad01206d5bd127U, 0xcecb9337b1b758bdU, 0x6008391fa991961dU, 
+0xbc1ab52865daeb00U, 0x5923eb24ce645f76U, 0x82cb6a273b6e9d1U, 0x2f661507df5cf957U, 
+0x12276789833992c0U, 0x6ecdee27195d308cU, 0x6ef9537a8200add0U, 0xfd5c12136f52b33fU, 
+0xf52213e4935b4eb8U, 0x7f557f1ab8b5a3cU, 0xf0ff54a3ccaf2dceU, 0xc11968e43adf2256U, 
+0x7044996d6f911addU, 0x42f8b49412a7149bU, 0x8379d81fe6766f82U, 0xbff5e6937786458fU, 
+0x182a90a0916aa6d9U, 0x3662c8b647702dcfU, 0x254f174da1835a38U, 0xf594117d05fe47d2U, 
+0xc7d0696ebf2e50cfU, 0x7a9277883e6b5b86U, 0xcf65dbdab094bcebU, 0xcaa761a56e971b12U, 
+0x133b40caa2e96db8U, 0x3cc9d916ce29dbffU, 0x7659c79c45b0533bU, 0x219b4f9cef6c6000U, 
+0x27df01a78d3b6bc7U, 0x394f8ac53e905765U, 0xf5a44180c0372a6eU, 0x24d9c605d959efeaU, 
+0xcaae03957ac6f4c0U, 0xda4e8de8cc4bdc4cU, 0xc4e1c38be696711dU, 0xf2d4d7f1f4d9cdeU, 
+0xe7e7bbad72339b58U, 0x8f6a10a790242656U, 0x17fb27fdf381e71eU, 0x3ec89f857e93de4dU, 
+0xc56d1f9af4284327U, 0xac4020b0383a6facU, 0xdd43ebdd806a3417U, 0xf6840bdcd64b45cU, 
+0x400d275a45e2ab72U, 0xb68daba7712b9eb7U, 0x495e8bff4b6114afU, 0xf304d37f100f1a77U, 
+0xd855053fdf428cb2U, 0x233822fd66a22b55U, 0x1eb7a1815958d0f1U, 0x1d5dcec2e2a14bbdU, 
+0x1e5ed100895b189bU, 0xbd3e912f876044a5U, 0xd078782486f0b88U, 0x6e5c4083b142c8c5U, 
+0x295ba10959dffc96U, 0x9228cda5afac5857U, 0xf6f9b395c817eb01U, 0x161c6cbee1483deaU, 
+0xc93bcf611b492de4U, 0x9b9634c92eaf8621U, 0x5bd259391cb18305U, 0x8a26ca92a6b9ff98U, 
+0xfb0ea88fa8381273U, 0xd84376960693dae5U, 0x9fdea9b2cc4126ceU, 0x89d9a2fd30096743U, 
+0xa03eb3eed309773dU, 0x8f61d680ad127324U, 0x377aaf2076cf62f5U, 0xdfca25b451d66f50U, 
+0x4cf6155f810a683fU, 0x5248bd31bf6eb1beU, 0xfe6c7285f189aa8cU, 0x783d0ecc3f64d4a0U, 
+0xdfd66ce2e0f54c4cU, 0xb5de928872395ee9U, 0x16b745727f2d51eU, 0x200a6d029073f4a3U, 
+0x1cc32b2cb5c71d91U, 0x23945e2e2a894fd2U, 0xc52a1c13115afeceU, 0x83191b8783a50ae1U, 
+0x70b9ec08e2148a61U, 0x17a11f51750445eeU, 0x9e06de13d17cae8aU, 0xe0ac7f1573801b70U, 
+0x57545ccc1a37b7c0U, 0xec08d0f7bb11069fU, 0xa6e000935ef22151U, 0x53904faa0b334cddU, 
+0x9dcb096b022771c8U, 0x13999981e1443469U, 0x88c9eccac20d3c1cU, 0x5bc087d0bc80106dU, 
+0x57cd0f1f38a47ca9U, 0x2a6ee7aaad0f85adU, 0x3cf991196316995dU, 0x1a575af9d414675U, 
+0x67c5df2e77ebcdb7U, 0xbdb93c5d9f4d7ea6U, 0xcc55fc52e1bb8698U, 0x3038f1cb8ab20dc3U, 
+0x71ac42fe48a2050eU, 0x742ef557615f8a67U, 0x96b769cc6e479b89U, 0x673724fd24bc7318U, 
+0xb90c9a49061d3d70U, 0xbe6bacfd43349cc2U, 0x203482c09a886b6dU, 0xe4cf8257896a4a20U, 
+0xe309d755e315565bU, 0xd3a61a83d3c20c6eU, 0xca71f5c1b76155d6U, 0xf5f0e0437621d439U, 
+0x678430afdd2ecc82U, 0xa5bf61bf3ed7e40aU, 0xf62189160df7101aU, 0x6b9f4e62be5a052bU, 
+0xcbf6e48382de63bfU, 0xe03af53287261c66U, 0x9e598a631f6166a8U, 0x4366efa472df4c30U, 
+0x2c6a408e17924cdU, 0xf33b0c525aaa6d6bU, 0x2ee2537e130268eaU, 0x2e7dd909bee2d7ceU, 
+0x34cf601fa9a78179U, 0x6b50e905260d6afeU, 0x905a47336209ed9fU, 0x995ca7f37081b8dcU, 
+0x931fbb4cafec1f47U, 0xbbcc85569ab64e52U, 0xb5e34d880492863aU, 0xd9a059e95553573aU, 
+0xf10527ff06f96190U, 0xd1f02de907c9525eU, 0x97be5569667aa75fU, 0x7bd753627991ab1fU, 
+0xa3d17204abda00f6U, 0xce0fcc5c1e0ea695U, 0xd5ed6474943827d6U, 0x8336f2b3dbba6309U, 
+0xcbe781d9f5362d33U, 0x47cbc92146227642U, 0x57a7f36d970ca4e3U, 0x8f506f0b6c0b6e9aU, 
+0x30487d0c87fa243fU, 0x48cf925d43bb8eafU, 0x9530c5424f1c3368U, 0x469f955d2afa6171U, 
+0x33b1531556ad41edU, 0x308ac35f4f03524U, 0xafa3419e8918dc92U, 0x4f7e927bddaad5c1U, 
+0xdf4357867e642d57U, 0x2e7314714eaf775bU, 0x552980df53a8f6a6U, 0xdfe7745156a88b10U, 
+0xc1843a1a3e5e6618U, 0x166d65f59d8ffcb4U, 0x87e017141e412463U, 0xfbc2107338b97dbfU, 
+0xed54da02230c860U, 0x7f3c4f3f1dcbccf2U, 0xb4960c1a6f39b11dU, 0x9f9b0859185c9414U, 
+0xcfa6051267748690U, 0x7d57904dd8630b01U, 0x94b452b1edd33d00U, 0x2355cb867d291cccU, 
+0x47c475314c89582bU, 0x58286858cd1c9391U, 0xf55b85ec15aa7c58U, 0x21c2f18a5a71e1f8U, 
+0x13d8d85d849135d3U, 0x74203cd012e431fcU, 0x65c134294130b16aU, 0x5940bc7ef82a85aU, 
+0xd02d7451962255d2U, 0xf1286328c9902391U, 0x2f75b0c7aab6687aU, 0x90537985eb4fab61U, 
+0x6daea2160ade7f16U, 0xae9cbae93cbe028cU, 0x13592ab6c275d24U, 0xb66825b9b3da56cU, 
+0xd944426848c56217U, 0xb7243c0df3e7cd2bU, 0xef3a76ba8b57a97fU, 0xa1fba0b818e09b3fU, 
+0xc633070164d2374dU, 0xdcf38a9684cfeb2bU, 0x5da5a9f71b3ff6a4U, 0x16ee8ed8b5e5c9d2U, 
+0x80e5bcb4fc865998U, 0x755130ee6d4ddd9U, 0x8a26b843e5b6ff62U, 0xf500e7f0546ff110U, 
+0x2906b02299060d5bU, 0x904613b11c3a3a7cU, 0xb6109b2fd9f951cbU, 0xf602043cf0bd022cU, 
+0x76f6f50b1af88f13U, 0x37aa56d2b7dd1a3fU, 0x881a8f64ac4f7beaU, 0xf036b706c1f0cf19U, 
+0xeff959f43ad86047U, 0x79b53a043a9b8bcaU, 0x719cca7764ca9067U, 0x8e7bcd0bd35983a7U, 
+0xea10047e8460372aU, 0x79e88e2e47fd68b3U, 0x940310420ca95145U, 0x10b7770b2a3da4b3U, 
+0x77d2808bf13f0351U, 0x3bc15b8d3d0389e7U, 0xc350f319996950dfU, 0x33b35baa195e729dU, 
+0x2bc503cccb8d7418U, 0xaa6560efbc889b70U, 0xf9464036248d52bcU, 0xa58a0185640abf87U, 
+0xffe8879a041ead4bU, 0x3a75edfb691b03c1U, 0xc714734efafe76beU, 0xbfc90c0c8c8f337eU, 
+0x7452c6f086fedaedU, 0xfb468eff32e0ae3eU, 0x4dba718dd5042d36U, 0x7a9481b1e09cded2U, 
+0xd71dc7b24414bb36U, 0x56f6e109cad7bca6U, 0x5cb83ad2071f7e22U, 0x374deeae22c93f95U, 
+0x7875bea98daf734aU, 0x3828d66300e54321U, 0x16032c06f806f729U, 0x171165b64fcd4f99U, 
+0x26e7bd0775bb3b3eU, 0x50753617ef9f73cbU, 0xdca5993e8c2d3f5bU, 0x732df11cbe3faaa4U, 
+0xcc577e1ed7366693U, 0xe69dad6d64c58436U, 0xcb7e255840253916U, 0x7f41903ede8f9977U, 
+0x694c856ee5b7ad0dU, 0x76ee767ca9d0d1d3U, 0xc2d0d8a496d16c44U, 0x3a55690dabb5e00dU, 
+0xd6c98790b2e8c407U, 0x1cacb8acac31218U, 0xfb21fbac97ef99f3U, 0xc3e28e1975a0657bU, 
+0xc5f5b3c1888dc3b9U, 0x19a66924e9774c99U, 0x28da8840cc97ef60U, 0x4ce094b9603947b4U, 
+0x2c14f7b6e5c0de52U, 0x16205b20c9ea0650U, 0xd57b4d80ca76aca2U, 0x5390fbabf1a9b3eU, 
+0x5e8a64ad6ae7d616U, 0x944dbaf2b62a9f0cU, 0x7c46e07395aeb0dcU, 0x2380c09c7f3aeae5U, 
+0x99be48161bbc1aU, 0x93af92148f846756U, 0xf1598aefd509b09aU, 0x6f8e86193464956aU, 
+0x4c375e0b0aaafe5aU, 0xe25470b3a509aeddU, 0x96d8a6a95b023fd0U, 0x9a968eb76fc667deU, 
+0xce6bfd424ed975c0U, 0xe7b5880a65e70cc0U, 0x54fc66d03d861d0eU, 0xabf6fb07a6d3ba29U, 
+0x8d962d14efa32402U, 0x5e659c613c66a534U, 0xe0f7db3bb038034eU, 0x180a4eced74ceaabU, 
+0x3203780dc4894b4eU, 0xa602c5937fdcd18bU, 0xadbbfc2f24febe85U, 0x498a4d5747bad7e2U, 
+0x3751cbf9f34c6397U, 0x7dd3db50074cd09U, 0x4f0aef802536b221U, 0xd3c6fbed01716195U, 
+0xb1fc8d0568cb3f9cU, 0x8a0c7708905e0e00U, 0x9458394d92eab646U, 0x4a0dd2c55e5e2af1U, 
+0x927a47b099b2df82U, 0xec5e7a1647104fb1U, 0xcc92d18ecce32c04U, 0x405a645c62bfb92cU, 
+0x5da2834a09307dbfU, 0x2ffa9db2cedc462bU, 0xf5caca61e237e712U, 0xbc3cb414f44d96e0U, 
+0x19b825930ac3137eU, 0xfe925b62a5af6446U, 0xe02f06a76aab3953U, 0x4cbde398129243b8U, 
+0xc008f15ceec02fe6U, 0xd193a7ae588ead60U, 0x50092a134b94c370U, 0x6ce554608f136159U, 
+0xc7119e23e50ce56eU, 0xc8293af0d77914a3U, 0xe68590fcacbe7816U, 0xaa6dc4d3ce531af3U, 
+0xb9df3a347dedd739U, 0xc11984daf8f710a8U, 0x6e1f6edc5e65e663U, 0xebc7998fa241e529U, 
+0x47a2306ce0fbf84bU, 0x3c48fcbbc3f0b8aU, 0xb8bd9c730c14cebbU, 0x4b9d333c82b16247U, 
+0x239ee4b4a36c3c48U, 0x6766d543e2f5b5e6U, 0x55313d982679b7ebU, 0xfd7fc7fbe24cc152U, 
+0xa841e1599c43862U, 0x71a7f4f18397e669U, 0xe6d0818689b81bdeU, 0x385eed34c1cdff21U, 
+0xc0458fe5542e5453U, 0x6b304eec2086dc8cU, 0x6701de19e9ebf457U, 0x283bebc3e8ea23f5U, 
+0xdc83a27078f2827cU, 0x47c82642befc1ce2U, 0x456be134d5f67d1U, 0xf6f622083daf5480U, 
+0xd15b20b520aaa102U, 0xe657ca7448321bf6U, 0xaf2c5715b367cee7U, 0x1bcd4e817de73a0fU, 
+0x14bd306ab6e2d9b3U, 0x41db92831b38d635U, 0x5e12ea6139cf8456U, 0x19a314f397c705e7U, 
+0xd552ee25cbaaaf33U, 0xa5021d1d2404be56U, 0x234965f887f528b3U, 0x6cacd8f5dac728ddU, 
+0x9d893209715adcb6U, 0xcd91c3ce7d8c6f36U, 0xbd70cb3c3d1fc255U, 0xfb26e5188f953de2U, 
+0x49dbca3b58ba68f3U, 0x16d2cb31b8b7ab54U, 0x58e846a719d01769U, 0xf3e128811012a34dU, 
+0x7d8587eb12f00480U, 0x20358804a100dceeU, 0x55dc986364f67219U, 0x5840ed4b95a8daa3U, 
+0x1592d5e2be22cf9eU, 0xba75225452ae3872U, 0x7968deaa15dd8daU, 0x670cda6b220bf141U, 
+0x52e737d963a52264U, 0xd0adfc0315400b37U, 0xa806e2a9aae51cffU, 0x85ffdc0de8187fe9U, 
+0x98c7d29a82da2082U, 0x678182c92b179d04U, 0xbe568f50554706cU, 0x3fee30187ae2948dU, 
+0xe484dee823f54c42U, 0x45dc1a3c269a3dc8U, 0x1dc58c1f4ece5325U, 0x9f5701a5346918fbU, 
+0x860e1c492feb6a21U, 0x89ee784ab219e527U, 0xbfb95b6b5729bfddU, 0xce7b8fb8801d9e57U, 
+0xed44db7560788c1eU, 0xd18c37060e8bd1d7U, 0x28f5c6bc763ceab7U, 0x8991225911b9132dU, 
+0x635c42228e8f0ef1U, 0x36969c84fdef9e11U, 0x27b8763559b136faU, 0xda8b4d987cc9ac9bU, 
+0x7e9413329522461aU, 0xbcb30a265bc71832U, 0x1bb8701067ef9a0U, 0x27f61169235a8cfcU, 
+0x6aa4caf9c7301a2dU, 0xe4981b20da863944U, 0xea48c56127428ee8U, 0xe512f1a9900a6ad2U, 
+0x6dbd9895e6ddd3acU, 0x7bf8f633a2f00651U, 0x5852d90d6ce2d5a3U, 0x96ee53e6732a2e09U, 
+0xfbf25b36729b6fdeU, 0xef0d07976c66dc06U, 0xd8c4c9711ebf1e0eU, 0x39b9caeae4b629f2U, 
+0xcce2c9b2d14f36b9U, 0x2598cabb63b9f390U, 0x261bf2f435f4a981U, 0x640779856ceef941U, 
+0x894b1ee9e4b4b50aU, 0x8cda0870499ceeb2U, 0xef90d75fd85a7b6cU, 0xda61928f44e56efaU, 
+0x9c1ff5a4b6a88c9cU, 0xa37b68663149df06U, 0x8b21d9ac972caa2aU, 0x78659081e5479139U, 
+0x5e05934575a7d19bU, 0x12cf919b03ab6a15U, 0x69e8fa7225e81961U, 0x59a2307792a30d2bU, 
+0xcef63df994d6b76fU, 0x7fe5a9fbb4c815dbU, 0x452f708bc09dfeaeU, 0xa23750e31c85669fU, 
+0x41d92ccc8dcca8daU, 0xe7707c11fdb848d1U, 0xac32fa3e4d411113U, 0xf7339b14a6e7de6dU, 
+0xd4fcdb13d0c13079U, 0x6f3e5a0154dd1688U, 0x809fea76edaf3016U, 0x5e52b50b6e1f0ebbU, 
+0xc103c48e70e1296fU, 0x4a3829d13d63ce1cU, 0x9b69878534a03eacU, 0x199edee73a354b0cU, 
+0x12ee9c64fceee475U, 0xab6ac82840ed782bU, 0x5ed3c021f3caff41U, 0xbbf1ac07a3f2378dU, 
+0x84622a0087fe5067U, 0x24eb9d89438b41d6U, 0x10883cc836b15fe3U, 0xb4bfb8deead460e6U, 
+0xc606ed86c3fac3a7U, 0xfddf84a5947fbc9U, 0x637c73a4413dfa18U, 0x6f9d9b803ecf191U, 
+0xd86890603a842160U, 0x7ea4dd2f5c281002U, 0x69b8e2a30e45c4d4U, 0x7c80c68e603059baU, 
+0x5c9d22744b7fd72dU, 0xda1745e5a7e4da17U, 0x1cdc36c284482939U, 0xae86eeea252b411cU, 
+0x2334cb7a4eee38bcU, 0x8d9211551472f728U, 0x62ab0ace589ff0e9U, 0x19e993c9707302f9U, 
+0x24ed75e8d21ce204U, 0xb2a7258e426763d5U, 0xb8374d859ca6f72fU, 0x43ca41d162b3c64fU, 
+0xe525044e934a8f6bU, 0x9ab6c7b33ea4a468U, 0x1c650f9218dba31fU, 0xdcea5a82e37023faU, 
+0x7a1474267c169290U, 0x8718be75cf36f2eeU, 0xe61d2f8c56dc2c48U, 0x2248c9f90bbfff55U, 
+0x369d8a12883ea257U, 0xe163750235da2be2U, 0xa506bb55b435ba18U, 0xfa0594692d21eed7U, 
+0x64fce92cebe6efdaU, 0x922d4ff3f8728059U, 0xb666f723785a506dU, 0x9c3e06ef22892bf5U, 
+0xdf140f32a7aefc7dU, 0xd43bc8687b36fdf7U, 0x8af0b2d44ce26fd5U, 0xa7b709e5e762923dU, 
+0x5b3a432014978583U, 0xcdd6e9aef061613fU, 0x4978419990f92214U, 0x30abf89b9cf23137U, 
+0x446180351dc75777U, 0x63120ea23bb584acU, 0xcdf7b4f2d0e1ab80U, 0x4b035115477f7498U, 
+0x79127ab5c6c88be2U, 0xea2c7820d06ee5e2U, 0x3bb72759d830775bU, 0x5d6f8aa313e20f03U, 
+0x892e553f0d7ad75dU, 0xedab6f8ea6bf92c2U, 0xc71aaf33ab08bc20U, 0xadc4b18d8d56d4e8U, 
+0xfd0dac4bb50964e3U, 0xa99f0877dd1c6f76U, 0x4ac11b48d94085d0U, 0xe11a6e16e05c4407U, 
+0x767fbf8b0682bfc8U, 0x17adc6e138318c6fU, 0xe1ad5e2596f0af24U, 0x87d6065b87a2d430U, 
+0xf289351b92d1b844U, 0xc69c0382c173e484U, 0xc86b15c3c1388bc5U, 0xf57d35c304a60d5fU, 
+0x464babbd61266837U, 0x7006972030915c6aU, 0x7904d3f5a9e4634cU, 0x707f3d9ea98ef4d9U, 
+0x73971647b21f51d3U, 0x11f80d462c39fdf8U, 0xce8d419b9da10ba8U, 0x6a73fb216726a955U, 
+0x1824dd9a5224b17U, 0x2db482468b60b774U, 0x7fea7d2949721132U, 0x4f3ceefca1edf3c2U, 
+0x234d007f3cc7cb09U, 0x3bc7eb68a1d1b435U, 0xf596e1fee3d87146U, 0x13e7607a3a6594a5U, 
+0x1be75a8a08079160U, 0x65eae2bb66b57641U, 0xe325fdd85b34299dU, 0x284dc88de8fbb8b1U, 
+0x39a37e63ec288015U, 0x4673f853eedc99ccU, 0x681fac61a05b6aa6U, 0xaa014eaad936de6fU, 
+0xdf814e6646c1006fU, 0xef4b9b0743cecad9U, 0xc3f2a7e43f7b0f63U, 0x3de913c04636be9aU, 
+0x60ce1258cdee05U, 0xa8761fb2172ec3b9U, 0x2400250b1b06901dU, 0x29bea322568182e6U, 
+0x9e4a0359a62651c8U, 0xf9fc31b6c8c698e3U, 0xa9009b3fb8705ec7U, 0x7c40d9a2690e9a0eU, 
+0x4cf85578f11d45f9U, 0xba4c1cde6c796614U, 0x4ea2ef2c77db796eU, 0x36aee3d35337512bU, 
+0x9d3bab3f7cfebad4U, 0x4b35d0ac473606U, 0x79cb954707c98f54U, 0xcaadda35cd69609cU, 
+0x11b6c75612f18adaU, 0xd460bd93bbdbdbccU, 0xd9c36faff33d4a59U, 0xf521786d238288e7U, 
+0x1dd68afd23953516U, 0xaa5ef4a36c5bf098U, 0xecc26102bcd1d1d6U, 0xe0686fbf6038db57U, 
+0x13b7e0e742d0e6bdU, 0xf774d163db0f5e53U, 0x82a2147c104d6ecbU, 0x3322d401243c4e25U, 
+0x24f3a2e96c28b2a0U, 0x2805f63ea2873af6U, 0xbfb019bc4ddaf9b7U, 0x56e70797e9664ef5U, 
+0xfc696d32c0ade462U, 0xd4cddc8eadbcf29U, 0x120ef31b04c80cd5U, 0x8d26200250cebdaeU, 
+0xd8e0a8b90f26470cU, 0x1d4afb4e72678b3aU, 0xd31f6f2dc3ee36baU, 0xebed3bb4715bf437U, 
+0xabd9d3f2059ab499U, 0xb13299c6e73c330U, 0x5d2196b3c67f01bcU, 0x78baaff3015c05baU, 
+0x681d2318fee097fdU, 0x91632eee8d125199U, 0xafca84e0ed82082eU, 0xad4bdcdbdb06c0afU, 
+0x9164643e1516e633U, 0x8ed4930d072d9c8bU, 0xce4068a1f594d03bU, 0x1238c0766eaebea9U, 
+0x5cdb728c77b7805U, 0x946252dcc740228U, 0xd6c979e2d1c3dc17U, 0x8a9db02dbb271359U, 
+0x4493e16cfd06ace6U, 0x23709b36f83a20caU, 0xc20b84984929ab1aU, 0x6f70f211a14ae3d4U, 
+0x48bed34b602d5deU, 0x75329566be5ac5eeU, 0x6f95d8f347b99f50U, 0x791e8a3094027b73U, 
+0xc3063330a5cd5379U, 0x2db794385870bcadU, 0xa782481b8aa4d223U, 0x17c072d56bdd1382U, 
+0xf7cae051b108cd25U, 0x8959ac76265bad0dU, 0xe77c1247af1d034fU, 0xd901bdf4283da064U, 
+0xdc8ee3ee60ee1b40U, 0x8ced485b71e96247U, 0xf80949f19103ccd4U, 0xe1599db29d6aa415U, 
+0xe1d6265ed78f93a6U, 0xa6363a74bc32999dU, 0xefaf894aaa2fc7cfU, 0x793362232a81d4a0U, 
+0x19b01552788e7a66U, 0xcddcd7282b0ec216U, 0xe7b2ea758a6a11b9U, 0x271d5b0770cb9c15U, 
+0x7a8d7258e03c9727U, 0xe2a065e3508a824eU, 0xe457d09949ac877fU, 0x5d3aa45834e7f491U, 
+0xf81dfa2849c00c3eU, 0xf00e8f03c91208e2U, 0x436562d33d451859U, 0xbb0b049704406956U, 
+0x799a982d11955a35U, 0xfe67044e905dc90aU, 0x655d2fa17ab1b052U, 0x4067e45853af9f63U, 
+0xda1e87d8a8a923b7U, 0xaef650eed81c5b30U, 0x540708ab68338266U, 0xac2acb9b21999a70U, 
+0xa2dc124ad7cd20a6U, 0x60b0d0bf12d27a4fU, 0x1c9afa0df13d9eb3U, 0x7684428511c1724dU, 
+0xe0e75b9c05dd32e6U, 0xc663b551b53e5ee7U, 0x9b649dbe075a5fbfU, 0xdc5a41554195789eU, 
+0x80e7db7a754a99b9U, 0x2ff2ee9076e49bcfU, 0x6dcea5e201bf5944U, 0x4af3a8a63f9f67a7U, 
+0x5793c018ca2d8daeU, 0xac32a5f91fd25ea9U, 0xba6b25ef9cb2256eU, 0x88271c02621192f9U, 
+0xfb426c0f3e1e77d9U, 0xc300876dc717d099U, 0x401c8b3ae5abf5acU, 0xd719dd53507176aaU, 
+0x9ed45bac4544e7cbU, 0xa1064225b5296035U, 0xbe3354a571014e99U, 0x156e197039873b9dU, 
+0x6d5392c0ad250a37U, 0x9496d58d5eb439cdU, 0xa939572a63834be8U, 0x6bc08d9f8f31907dU, 
+0x8f5badc99c89240fU, 0x74f8c4bafa2e7b85U, 0xe18ee09197e0e176U, 0x15b8390d652d7338U, 
+0x2e2f9ef8e326f04aU, 0xb30367ab5c1a3335U, 0x3abdd7ccc7a59f99U, 0x786cf20c8efe8d08U, 
+0xdbfbc29cc59853caU, 0x48e9626b9f19bf54U, 0x6bca76a228e71613U, 0x4269bccecb684382U, 
+0xda958ef535b8d367U, 0xfd3940a5f9e5a8a3U, 0x23c84ca9c431a409U, 0xed2b1c1a82c016b7U, 
+0x721d74d28134ab83U, 0x741b3f9af7643397U, 0x2bd1770d89665868U, 0x85672c7d2de0b7daU, 
+0xc8e3094f790313a6U, 0xe77f17fcc5298f44U, 0x6374049bfa62c2e5U, 0x7c481b9b5b43b2ebU, 
+0x998b90bc1f17fc25U, 0x3b89ea46df2e6d96U, 0x36c1861215c8a61fU, 0x534ccf6b740f9ec0U, 
+0xd71c7f6ecfe86e76U, 0xae3d277bfdd28ddU, 0x462ae3dd32d54355U, 0xd5715cb09c8b2ddbU, 
+0xfdf0723a83ba9000U, 0xc4872f9c6825e8b6U, 0x684876075840143dU, 0xac3874f9fff1d8c1U, 
+0x4da3c7d96f10cf0aU, 0x85e350d7f66e9faU, 0xb862dde894117f93U, 0xaa65e92308a1c069U, 
+0xc7170923e8bee8b6U, 0x79020d47ecfbc8d2U, 0x81e142018f8aaedU, 0xa91d1f5cee87b7f3U, 
+0x3d16aa410644c1U, 0xf800569f628cb225U, 0x5a7189c8dddad3b2U, 0x748a324ee2df8ee1U, 
+0x1a606f66ed06dbd4U, 0xec0e3f8578a20d08U, 0x9ad14075e9a3e729U, 0x570d5ce7aa687013U, 
+0x5a65becebd1ed495U, 0xb683a36dc6460bedU, 0x5b66e6711d01bbbU, 0xa6ae5349420e02f6U, 
+0xae5d630b17ba402eU, 0xc3b81a5c2d042989U, 0x58bead0c4848e3c3U, 0x8e891b5cd18fa02aU, 
+0x8e1b6279c4fad9e0U, 0xaf650c242157a7eeU, 0xb38d0e404f2a306U, 0xe5d30e0e6a9ec668U, 
+0x434c1f92092d230eU, 0xdaee32a0d2933928U, 0xf87c229ee0366ef5U, 0x75b5f87028268bb6U, 
+0x37cbdfbd51570b8U, 0x267a4b00511f8fbU, 0x63d7874554ddfa8eU, 0x527cce21e3a78523U, 
+0xaa1a1c255984cf74U, 0x735ae45bef61f10U, 0xc1a214dde2d4383cU, 0xc15c8c23d90c8e35U, 
+0xc4a48cd839ccb000U, 0x47bf772d50b015a2U, 0xc8dc6f45e25fd7baU, 0x2ba954d828522235U, 
+0x47b6bf6ac34fcc0eU, 0x927f10a42be3884cU, 0xb0a5b80e27d259c8U, 0x44fc8efae1eddec2U, 
+0x9cff031e719c420aU, 0x720e94a4bcd0489dU, 0xe49267e78833d3d7U, 0xd2c7de94ba9b1367U, 
+0x58413f0e8942dea9U, 0xab35a98cb8b7f130U, 0x7946ad8ba60a87feU, 0x1566861334285db6U, 
+0xf92546f0367be3dfU, 0xde4828688b23edcbU, 0x4e894effb20fd22U, 0x4f3597aa0e82f051U, 
+0xd5a481fc8bb69991U, 0xfffb3fa2c3307175U, 0x866a16620e02f535U, 0xdea2ba47bace7bc6U, 
+0x706742a9f16fe2dfU, 0x229dcdb3621ed9bcU, 0xac5cbfec84f7b9e7U, 0xae28bfd6d90c28e4U, 
+0xe61ed61e536bcfe8U, 0xe0c179ed69b7bb3U, 0x472ca8f2306b319aU, 0x1332f8bc1cc6999bU, 
+0x51b0dd2cdae78402U, 0xba93b424d5a8c214U, 0x13f67c4535dc0681U, 0xc39dc7ee29602ed7U, 
+0x8c240d02514fc9ccU, 0x26d00abc29a46165U, 0xefc1cf6cc4b8a836U, 0x3968fc98a6e168d6U, 
+0x19394895fad37ddU, 0x1a146576ff88f334U, 0x1237982d1aad32c9U, 0x789cbbd0db4b5928U, 
+0xc023af3e14cc84bfU, 0x80bf1d6deeba1f27U, 0x830e37159c2a4953U, 0xb5dd69364e540816U, 
+0xc785217ce374750cU, 0x353110dedd6b1a90U, 0x6bd18733c58d4145U, 0x4b36ec5853c7cb6bU, 
+0xaec2191ae0c85f1U, 0xa6a52e53603a3a25U, 0x26b25df0957945d5U, 0x6896910698e06a29U, 
+0x2c7482332dc1de21U, 0x1f40c19da0d50392U, 0x56f305c1d845d72dU, 0xaefd3fb4b38c9792U, 
+0xffd959af60c82a0aU, 0xf9226c60f668832U, 0x6b06c9f1919413b1U, 0x948bf809b1988a4U, 
+0xd4cb7f88d8c8e589U, 0x6d4dff08c97cd2beU, 0xdc6b74c5d1c3418cU, 0x53a562856dcb6646U, 
+0x396eb0457e8b000aU, 0xef16c1331e825e51U, 0xd5ce4c66291f0b6U, 0x26952c7f372e5936U, 
+0x8c3d401f05ef705aU, 0xdebe398f653d6731U, 0x62bc893d2d688422U, 0xf513ea4c5800a688U, 
+0x7282fe5fb8c8ac7fU, 0x641242ee65e2aa52U, 0xb5c3396d2056f849U, 0x9945b2fbe3822bbcU, 
+0x96d943a169aea3b0U, 0x282f7a23eedacdfaU, 0x607db44ffb28eff5U, 0x3eefed824b0f282dU, 
+0xf102588976134f96U, 0xf521196572d6b0e9U, 0xbef2be8b131ff243U, 0xc62e58e6fc23c5bdU, 
+0x82277ed4d14cf97eU, 0xbcfb853563731c3eU, 0x8c3d676753141fc5U, 0x4397827d45b1a167U, 
+0xed1d79e3969e353aU, 0x10a0440852bbe1f6U, 0x235f82227107d5feU, 0x2a314c6b205870e6U, 
+0xc25926e1e5746067U, 0x138a54aadb2658bfU, 0x1a463e476baa1ba0U, 0x15a4ac0bf35a27acU, 
+0x3baa499892fccf64U, 0x3bd278de2581318eU, 0xb068772c77c95dbfU, 0xc7d115c0eb4637dU, 
+0x53f6d3b32878fee0U, 0x48785d83959ae68dU, 0x7aa424b8478af145U, 0x4aa8747b1925b044U, 
+0x89e2f49ee9b84966U, 0x1b4f4106dd7f3ff9U, 0x498b6faf3a6b6c91U, 0x5959a500b703fc2dU, 
+0x40a6632187473a6aU, 0x9100dcc08cfe2426U, 0xf94312820dc82a70U, 0x370e6741f5ca897U, 
+0x3686f8800b188cbbU, 0xb81c03200807de97U, 0x1683329a716622b0U, 0x107460520eec5c74U, 
+0x1d7b6361f272124U, 0x242e0d748dce3da6U, 0x35326b9b9cf54a11U, 0xabe5d4c09a21598cU, 
+0x3b0c9b922bc6b173U, 0x7dd8623c7eed3febU, 0xe1160c46305b5f9dU, 0x9eeb313937222fe8U, 
+0x9539620d9723a71dU, 0xea71abed0e70c4bU, 0x952aabfdbbba1ae3U, 0xe121f1e0110ed58dU, 
+0x457e9bc92ad2cf25U, 0x7ba49b4dbc927a94U, 0x18d1e80ba27b3c2fU, 0x520d9a9bf3daa9cbU, 
+0x610b6c83a285181fU, 0x2bab0b6511bf70c7U, 0x48f0ae71b4ba9706U, 0xe526f49b10271eaeU, 
+0x5772443f7ec805f3U, 0x7de40f7509d99591U, 0x16ebb238806e9788U, 0x39cc4fe4c7f718f5U, 
+0xd191a0c13a3c48d3U, 0xbbb957373fc912e4U, 0x151e6693cf42de7dU, 0xecb1472c5a46f8f3U, 
+0x8b5aebac548d5622U, 0xe1db07ef7a51bd2eU, 0xa39586a81bf3381bU, 0x5fc6c11e61689535U, 
+0xd0d840101ac1683U, 0xe05ad08e6c7bf30U, 0x9c19ba2db0367acbU, 0x10e80e549aa1d9dbU, 
+0x93d62fb5ce22580eU, 0xc7132896d2d6f887U, 0x6892ffde64dbd4d2U, 0xf94c807466ecdc69U, 
+0x81e523f67127db82U, 0x9887ec4532371d4eU, 0x9194bff6ab5a81f6U, 0x5e9c7fdc6785225aU, 
+0x123ab607c0a3d8a5U, 0x26d77d684573ef99U, 0x3431274a33ed09adU, 0x5aa433e5d872d6e9U, 
+0xfb5f7ef76d3c2ba7U, 0x16475cf52d9d6ef4U, 0x19a394aec728a561U, 0xddcea1fc682ae79aU, 
+0x6be40bad10c4f21fU, 0x5024a9594d03da7aU, 0xfcc02068db1999d2U, 0x8cccb86c6ad5d162U, 
+0xf7f126ea729dfea0U, 0x4b92dcac8264be28U, 0x699bef549c8758a5U, 0x57f8965862751c43U, 
+0xccecd819f38fd8e8U, 0xf1b0e44dfc69752aU, 0x4f067ce0f02873a8U, 0x6260ce7f461801c3U, 
+0xc1a84e95b2b4ae17U, 0xecd292238051c198U, 0xa7f09049776a1ef7U, 0xbc2da82b6fa5b571U, 
+0x766746f3d477c2dU, 0x16e65c5196aad27eU, 0xdec8409be84f1a13U, 0x85d8da4748ad1a73U, 
+0x2079816fc7d1dd70U, 0x94b0a02033c4d5a6U, 0x586b536531efc7bcU, 0x58948b53665c6690U, 
+0xbb0ba46541136602U, 0x38c46f480d9e3a5bU, 0x3d058937f2333b3dU, 0x87d127280482dfc3U, 
+0x4f683c41d8af6aacU, 0x87a884746fd3bf7cU, 0x926a276cff677453U, 0x71ce24870a5a03deU, 
+0x4850312d6c0b80d9U, 0x4d1e7e100fdc47f0U, 0x8c0892e9cc3ee3eeU, 0x8e2a7166e7ec4b96U, 
+0x49c61f2ad6b29f50U, 0x5297b688d706349aU, 0x2cedd29b716a9d48U, 0xeadb0ba9ae2cbe59U, 
+0x5b205d7348c5a916U, 0x3f5c440d535610f2U, 0x6b0acc63dab54aa1U, 0xfd5d7d3fe261e974U, 
+0xb14b37b07adb8bdaU, 0xe5d73814bdcf6faaU, 0xd2b43ca679c7b52fU, 0xdd83ed0eeb55b07U, 
+0x674a35c8b0e74459U, 0xfef2376387ddb6ddU, 0x590f4658713c8a91U, 0x28df781d4ec05680U, 
+0x8de07cc0ef5e656fU, 0xa3795ba501ae6f0aU, 0xcb0db17890f22794U, 0xf1499ea66a130f17U, 
+0x45d9909635f7529cU, 0x38765b98b5bd51ddU, 0x2ba453c32d344381U, 0xde0dd410981c2612U, 
+0x63c20c02e4cd88feU, 0x178924c6889b7740U, 0x9b2109822d7a3570U, 0xd70a6e9d10a2145fU, 
+0x9921fa3d2c4561beU, 0xee4ab2e81359d90fU, 0xdc8366ecd78f8950U, 0x769bc75842bff58eU, 
+0xd5920bffb0d9685fU, 0x41a177767b7873adU, 0xc8dce4cef73f5d47U, 0x4bf817362fe783baU, 
+0x3c82f48d38f76d11U, 0x1511000fbf851557U, 0x69c5befc39c292a2U, 0xb26c208ada4cf44eU, 
+0xdc1c00b1e3b7356bU, 0x50030659d82624bU, 0xf0c4e87d90cd6433U, 0x1f1cf8820949d33cU, 
+0x31239da0948e129eU, 0x2bd1dfb2c0289b10U, 0xaf0f8de28e53c2dfU, 0x66e3fcefb7b24cf7U, 
+0x72bbc3602ee7bbeaU, 0x5fd7d99ed1a53b51U, 0x598b5bf34cdf80cbU, 0x20bf8b4fb770c0f6U, 
+0xf94e3b06669e22dbU, 0xac993ff59f9c8933U, 0xa7e3bd29018c294eU, 0xfceb14b8fc7ff523U, 
+0xbf572db25c2260a1U, 0xad550e793a4ebe4cU, 0xfcd8a5a7525f0924U, 0x64aa6b3a40d6b8d1U, 
+0x346d9dc529c71143U, 0x2e7eadac44f057eaU, 0x3ca7ccf90023fa35U, 0xeb45f9622bbea10U, 
+0xc8a8cda20b70b136U, 0xd65969ea6a2b1bf4U, 0x573601f5901e2857U, 0x52c42f585838bd0fU, 
+0x6f084179a38a2755U, 0x53721a716549c550U, 0x55c175774b507faaU, 0x4e909a623ccd5cacU, 
+0xaf7a49f623cca3deU, 0xb6cd5394d229800cU, 0xcef246dd507559dbU, 0xae56da878cce35aeU, 
+0xcd148d3c07d7c8U, 0xe0f19675f829e32fU, 0x68470411bf3d4899U, 0x3cf9208ab230b73dU, 
+0xc4a91dada4cee08U, 0x9d4684c8d5b8c59cU, 0x51ece6ca65c16720U, 0xde03c64c15af865dU, 
+0xa8258959983ba64dU, 0xbde60f7788c595a3U, 0xbfb0a145eb8e40e2U, 0xc367455c22e04c03U, 
+0x614cc8f96a2181fdU, 0x42626aaca1778f14U, 0x80e0e6e84d964c7U, 0x3a520ad069cb6033U, 
+0x2953cc8d2037fa2dU, 0x43ec8f575bfdc43U, 0x3d8348414bbf4103U, 0xe5037de0afc1d8d4U, 
+0xe0e5dc841d755bdaU, 0xbd5f5b03ec481f10U, 0xf9f98d09fb990bddU, 0x4571534baa94d3b5U, 
+0x8c63c8c79e3d34efU, 0xc3ab217c792a2ddbU, 0xf40b6cf7d2d61b3eU, 0xa5e00da467fd5494U, 
+0xb855c5ce2f7adb4cU, 0x5b60dcfe790900acU, 0x421726fe99bf43d2U, 0x98fe5f5e5608555U, 
+0x388a8a6e177e7775U, 0xb5e1559388ed95f6U, 0xe58543bacf5291aeU, 0x9d896a3aff9633ceU, 
+0xefcf6d3aba056691U, 0xe899cd7ee299253bU, 0x94e964ed7250927dU, 0xdd91a9e43f49bf0bU, 
+0xe6737160d7b91252U, 0x6d4afd2e4477572aU, 0x3519f4bb1c9bfbc4U, 0xa99415f5ef3a2b40U, 
+0x73a377ac4bedc264U, 0x899a16ad590f4dddU, 0xb9e2f10f24f6f6b6U, 0x82d0e64cae81f84bU, 
+0x5fde04de3c2a3293U, 0x5688b86ee903476cU, 0xd0eb0a573282f4cdU, 0x8327b8ee71163792U, 
+0x6bc854e18e0df9bdU, 0x96afdab4ee326a41U, 0x18bb3ea662797084U, 0x4997e266ee0a98eU, 
+0x15957f1e8c904ed3U, 0xdf2a745890585784U, 0xf97f8e6431272384U, 0xcf8c2d2db818dfU, 
+0xb009963b796f77c1U, 0x22991d79d32f6827U, 0x19dd5c1bd51bd811U, 0xaaad000ea781d441U, 
+0x2421b26c4562c042U, 0x92d23234b8dfb1aU, 0x97d6661d8f9a8ed6U, 0x5ae42aaa2a6db168U, 
+0xf905ccdf8f79269cU, 0x94e0db95107cd8dbU, 0xab5c1ddc60389d4aU, 0x99d93a7c05ff051eU, 
+0xd8c465b66a540f17U, 0x4c750d705f0c132bU, 0x7d8edde098f935f8U, 0xb56f4e9f9e4fd1fcU, 
+0x46a2fcae0200102dU, 0x21d42963cbcca854U, 0xd3dc11adf0582d1dU, 0x32e8e53429cca856U, 
+0xb34881285e85af61U, 0x4e8ed722dd4ae766U, 0x59aeb68ff6c21b0fU, 0x92c23ae426a1c8ebU, 
+0x4e723669c36a2b09U, 0x2d23ad82b6286fedU, 0x9f217d5c738d579U, 0x414cf88f01551bb4U, 
+0x280aa48259e5d1b3U, 0x48c9b789fd6caa3eU, 0xd1e7e4c6f0fcdb30U, 0x3aba5151caf6483bU, 
+0xa85b678d42f30087U, 0xe1846359d2de6ee6U, 0x9064ec8047d72cc9U, 0x8c1e7223bff251d0U, 
+0xce2af1b2c7b5eba8U, 0x2dabedc7f918ea36U, 0x88d0f4176af8df42U, 0xfee5608c76afdf10U, 
+0x3f515d368d0b9b5cU, 0xe380ff42bf905479U, 0xb11402f99287c14eU, 0x3807599134fe58afU, 
+0x1b2b59888cf8cffdU, 0x432e6b15b7a45ae6U, 0xd45afb88f79bdd89U, 0x809b7f1fe78c1bU, 
+0xd91d45a18db5f32fU, 0x12a340fad92b9f93U, 0x288c836de52fdc9U, 0xf817e022bf41a863U, 
+0x81e3ba4b3c63caf4U, 0xa28ff3ab28f53d52U, 0x20a113b4c62a6afcU, 0x42e544eb92e667e6U, 
+0x187aec09969c29c8U, 0x73a50e7b6befc5f1U, 0xf71f220c17415e78U, 0x9ff854e0f91cc671U, 
+0x6c61905ef7ed9ef9U, 0xad2ba5a00ef0c63dU, 0x41df784947fc192aU, 0x32dde6ddd352d4a7U, 
+0x1abb8468031fb871U, 0x59ec1b379c98f4b2U, 0xe236a4f94d58c1f4U, 0x41d17bdc342067bcU, 
+0x80a2bd985e0f09a1U, 0xf0a109f1b9403283U, 0x83996ed2a4700efeU, 0x7aed83b665532ce3U, 
+0x45d8cde85857d73U, 0xd88b2f300f3f4a54U, 0x7ddafd0ab1032d8eU, 0xf5b8545f9a31ef7cU, 
+0x25866a0ae4fce725U, 0xe7e8dbd1c6a6c5b7U, 0xf5ea905e8f1771b4U, 0xe06372b0f4a207adU, 
+0xb27034f94eee31ddU, 0xd7484a7787104870U, 0x12a27bb2ad5a488cU, 0x7a908974bce18cfeU, 
+0xfe09aee43ed2ff3eU, 0x45ebfdb4ec6ed3cU, 0x9c8dbd304fad3f3cU, 0xeac134ca2046b8fU, 
+0xe17206207d210988U, 0xac19f696b7f21376U, 0x45bf103bf2b11799U, 0x49630dbe79359b42U, 
+0xdbaa8188da328d6aU, 0xb24d773a95adc18bU, 0xa346899185b08fa7U, 0xc663c05ba6234e00U, 
+0x23b0bb6abec9b8c0U, 0xdd8551ea512bf9ccU, 0xd39afdcf27571317U, 0x3331e98d5f721c38U, 
+0x476706e4dfbfa4dcU, 0xf5948a7804c85b17U, 0x8392119d7adbb41fU, 0xd6788590731fea19U, 
+0xca7bcd6bbd3b5406U, 0x6206f1c4ddc9a07cU, 0x940ef5c6d21c13aaU, 0x28eaa8c89d5063c4U, 
+0xbc91c8483996de2fU, 0x77cedf2ee0b25114U, 0x9ceb30deea0fe4e9U, 0xd3fc2682dfb86a45U, 
+0x8c492241d4526f8cU, 0x4e59b498df7abf16U, 0xf68b4754d4f781daU, 0xc4f0df99a45f0a18U, 
+0x6dc35a6562143fb0U, 0xa9fb92830bc205ddU, 0xcfaff3394799597U, 0x292adc1c33af8379U, 
+0x8a9db63ce36ad01cU, 0xd83e662d735e9d4dU, 0xf3f1968a0cc4ecf6U, 0xa072661bcee0b647U, 
+0x5c6c48d103e697eaU, 0x9ce678fb985f83e8U, 0x7dca1fec9a3fabd1U, 0xc17a4b43feb2c023U, 
+0xee3b87ddedc6c87U, 0x96e1a1b57f9f02abU, 0xcae178f719601faeU, 0x39355c2d55ab5954U, 
+0x7275fb40e48ff9b3U, 0xc7b1a6205599b01aU, 0x4abf210f12b71d4bU, 0x6930fccbd9a04097U, 
+0xcfddab5f8ee96a4eU, 0x90f9b13e4acc51aU, 0xda30fcdb875f6d78U, 0x7f02ae94b94701eaU, 
+0x82d2c3023163da1bU, 0x9a0edee60f93a311U, 0x68c9349d7fc11fdeU, 0x8f618b7ca26790b4U, 
+0xc7f3121103bdd76eU, 0x6450c66a3249b6e7U, 0xb5fbda74d7ac5a42U, 0x78233f25f08beb6eU, 
+0x84fb09b54d0cec10U, 0xba25f0fcaaded6b0U, 0xaeab0e61b2d3ce72U, 0x4d952a9ca3321e69U, 
+0x8ee36b13bbd06932U, 0xba4aa2dfc84f54daU, 0x4542aec787b5cb4eU, 0xb178184a66dd279eU, 
+0xee8590fe0ec8ae90U, 0xcfb26b92e8bbc5deU, 0xb86d5b8dac83f1b8U, 0x9798c0f15b7a1e6eU, 
+0x7a9ac2eae52844d3U, 0xe2e4965bd03188e2U, 0xdd2ec9494f9c73beU, 0xba40e2aa75a42ed3U, 
+0x89ec1e6c30b90e0bU, 0xd6ff1d39fb094a45U, 0xfedc804a59c675b3U, 0xa43507f9ad5467d3U, 
+0x3f000b993a1fdc20U, 0xdc2a203653599b5aU, 0x142d07ccb40be8c0U, 0x7c8f2dc94c3fd71aU, 
+0x5a1978f11d66b7fU, 0x7aa692505187dc81U, 0x47cf1b90b8928475U, 0xfdfa6ee3fb5a2d67U, 
+0xdaa8f80678e5178bU, 0xd846f9dd13d78de9U, 0x93c0c1c9a3da18c4U, 0x4d9cf31e224998dbU, 
+0xb836b58659c0d7adU, 0x1ddb64db7a2b493aU, 0xefe11ca1a749e671U, 0x72b04ecd4b7bfbbaU, 
+0x2efe6ff46723cd97U, 0x96265d681dc6f4fbU, 0xcedd452d6d934d01U, 0x6865b3ea0e64a358U, 
+0xb80757849265bcf0U, 0x69ce2b78411c7d30U, 0xaddea9a461cf220eU, 0xfd58ce38de229e43U, 
+0xf33e7a9ceb996292U, 0x87261bfe28f1cd1dU, 0xd5382ab9a485e4fbU, 0xffe0a5e53763215bU, 
+0x40ad6908d0559754U, 0x4b10bdde2a3f585U, 0x58d0bbf9dc0ce022U, 0x213c7a715cd5d453U, 
+0xdff2c27534b458f2U, 0xbb4850f5f36a7eedU, 0x7013ad06245ba190U, 0x4b6dad0b5ae46250U, 
+0x8993895e0ec87facU, 0xd1ab974622e7cf0U, 0x66ae9fed8323480eU, 0x1c5e548132b49a7fU, 
+0x555d7b3d5fc2d4efU, 0xa3deaceb26fe324cU, 0x2bb959fa1d4c2ad3U, 0x4ffcf60f837f468fU, 
+0x532d80119e05dcccU, 0xae3fa3ed4c19a93eU, 0x9546e096b953d172U, 0xb8cef6e1753da030U, 
+0x3014a0cfcc6d5750U, 0xdf757fc36a6b6813U, 0x6a4d4a74e4d2bd99U, 0x302b8a60a6cc9bbfU, 
+0xe20fcba1d4531dbcU, 0x1f901c19fed5c970U, 0xdef6e94210bbc7ceU, 0x46276d0602c5668dU, 
+0xaf8730099686b8e2U, 0x498badfbffe1bc99U, 0x4a292287570ded99U, 0xe0f7f24d44c75b8U, 
+0x85bdfee1373bb31aU, 0x701f7b6b5fdb97b4U, 0xe02a0bde2ebb5f49U, 0x3fb33e779b47385U, 
+0xe34cbe697d215c9eU, 0xc65a7c76c47640d4U, 0x1e0c161aabbb572bU, 0xf36ad952548efe28U, 
+0xc4eed01686df50dU, 0xcd5e792a1c6f92bdU, 0xd6fd87442c082060U, 0x3a571630935c1f02U, 
+0xd2158b28e859679bU, 0xe0aaf81ebb781a11U, 0x516f3ff2e570a0ddU, 0x85e13873b599f32fU, 
+0xa5b515ebdd9a4ab4U, 0x717c36c1855bb7c0U, 0x61f16f7b4d0f7a36U, 0x4b177cd109ec3e11U, 
+0x8aaddfe4635ab6f7U, 0x6e37e255f1741f55U, 0xfda8f67293626b48U, 0x3ec966e9a5e2fa65U, 
+0x6114ef13522f001dU, 0x6850e0acdc78d899U, 0x4e65eb211c319163U, 0xefea68eca7a6c24fU, 
+0xc128419f73bc4415U, 0xe413959fb3848771U, 0xda150307a3719a17U, 0xaab847869d583c14U, 
+0x6f46fb29b01c23a4U, 0xc22a415847a49cf5U, 0xc2a03829b9b9cd75U, 0x5e87035206a27a06U, 
+0x1217996b10d986f9U, 0xa2171d874a4ccfdaU, 0xe71755d1ae2c6e2dU, 0x5b96644efb9c9221U, 
+0x8b41ef22c291dc6eU, 0x661fa8a94df29fbdU, 0x5c7136c23a3e38f2U, 0xcf0bdf47a3f15b24U, 
+0x9c73c144db7a8196U, 0xb4fc6cfd2bb5f2a9U, 0xa4c523b4e57918f6U, 0x38c2e01c6e61f511U, 
+0x1f3f35d2007b0c66U, 0x34a7fee4656c86fbU, 0x4472244f60aceb74U, 0xe545c301930d680aU, 
+0xd87f57d271f2d470U, 0x97e5828e1b5a239dU, 0x7e5c6fda3959bcbfU, 0xe06a340e8c62955eU, 
+0xe2aa2b67f88f7e09U, 0xb3a03779ba7d92cdU, 0xbd8e12e5a45dc0beU, 0x5e6a863d4f205fcbU, 
+0xbbd6286748dfca97U, 0xa68e503723b4cfe3U, 0xc444a8d1f6940234U, 0xc2571a078a388edfU, 
+0x4a58190b83648bbaU, 0x82a0f0b069c3c744U, 0xa133ee225f01b398U, 0xb2a442157a54f580U, 
+0x246fab4a00fb6452U, 0xc0d855151c9c17bbU, 0x9e9fbc978fbd7e31U, 0xfe4f5fc2b6936661U, 
+0x679e75e2b304ab91U, 0x25a40c1942451557U, 0x8a6383063b7811c3U, 0x7a1ffea8fe5114bU, 
+0x35af463b6797e554U, 0x287e5dea19009d9dU, 0x6910437c4344a595U, 0xe10c0421b0fd7c54U, 
+0xcf6dd22eebab27d0U, 0xf70b41fa2c45103fU, 0x1ba9701918d97007U, 0x1b908e0f3d453865U, 
+0x71e8675e40d3d110U, 0xb5bbca93587e51b5U, 0x6f357c91817c4b9aU, 0x9b6d625eec466b5eU, 
+0xf0cc3a3b08fbd53cU, 0xe2838c70adc62cddU, 0x8dbb9352a5419a87U, 0x4e7c272a7af4b34eU, 
+0xe0b3941817dcaae6U, 0x530b9614bff7dd33U, 0xe16fd09f6def681bU, 0x17749c766c9d0b18U, 
+0xe2821e6e7c6e1b4dU, 0x9b11f25a1bef8790U, 0x268a269f4e385d9cU, 0x899017b02696888fU, 
+0x9aebdad814ab2bU, 0xe4e51bc0f932b212U, 0xbb45798336358bfaU, 0x43ae2cdab5b334f0U, 
+0xee298464e521b3ffU, 0x233c0717e9aa750cU, 0x75e44d2be9ae24a5U, 0x2484e3010c9455cU, 
+0xcc1ae4b90269da7eU, 0xad7006de923ac8bbU, 0x7ec2b3c2b2d0eebU, 0x9619d0a0aa23e30dU, 
+0xaf2635a17e5f712fU, 0x2831f5bf91b583a8U, 0xa8f4728e63227f0eU, 0x67f644f76e905fd4U, 
+0xd68acb5e707160e5U, 0x5e0e1488f7d36198U, 0xf05adeb7b586cf78U, 0xb833d68f66445d04U, 
+0xf96b79fa804ba7b9U, 0x20d6a47030741751U, 0xef79b70d672c954eU, 0x16c1c526cfb6ce57U, 
+0x475be3a51c5bd741U, 0xec755c01bdc9a9ccU, 0x62627459c8a94deU, 0xdb157f7c34031439U, 
+0x2b26096140692fd1U, 0xdcf43c6ccbd90dfeU, 0xe0aadef4b1f190eU, 0x4e53c8b49901ff80U, 
+0x934930e7328625e0U, 0xa87a50da57fc9753U, 0x186cd709a7219da1U, 0xdd6e3e4f4d41a01eU, 
+0xe836487aa36683faU, 0x95821b5380ec0825U, 0x87a89ce774527b66U, 0x3973cd753f931afU, 
+0xdf5fb2b77f4a577fU, 0xd77884e18fe981deU, 0x643e12b632b5a26cU, 0x38cf5a2cc30ca3a3U, 
+0xc10263ed3b89a762U, 0x930dc93012ee6b8dU, 0xfa80a054968b4712U, 0x327f876c93652555U, 
+0x9c9fd959b9203301U, 0x75535070febd7dfeU, 0xb09969255e1997b9U, 0xb2d404eab3524026U, 
+0x180b3999c0bf6f06U, 0x713c133225043b57U, 0x1c2c04f4b0205765U, 0xba6a9bba72ecf151U, 
+0xe32bef70781db551U, 0x9e5d14f7ac697aafU, 0x32020bf2e558bd8eU, 0x13771e38b34a11b0U, 
+0x799f119955637b39U, 0x6c52b9985ec75fa2U, 0xc3d5b9286c03016aU, 0xcf3c5da6b99ac5cU, 
+0xd247a3d7a2852a40U, 0x37acd30523c25c3cU, 0x134671adc18024a5U, 0x2cfb52fd9f39b64U, 
+0xfd1ef9f071231a43U, 0x44d514d665ad43b9U, 0xd8aed95064de442fU, 0x35c5bccc27cc4dd2U, 
+0x7db72e451620c8f6U, 0x4cf7a4cc063cf0aeU, 0x734e5820b6fa589dU, 0xe3675723b9746ceU, 
+0x48ce357db549827bU, 0xfcc4f7f3e121bd61U, 0xa8212e06de2ce311U, 0xce47d0f5e0d375f3U, 
+0x43cc9a5fefaed097U, 0x29e6592ff05769dfU, 0xd589139fe5b9ad0fU, 0x15c698fb99630d49U, 
+0xbf40bc56fdd40609U, 0xc74190980d81cd76U, 0xa122f12fc588356aU, 0xfd479c245c5586bcU, 
+0x9de2f1366a64ca53U, 0x9113aed7261ca473U, 0xf2cad7a43c9841fdU, 0x3069cfb52694afefU, 
+0xb38fe7157d48be00U, 0xf60682ea1698fe13U, 0x4eb0e2207f9543c7U, 0x931bf8bd4a8e42f3U, 
+0x1586a9131f44f452U, 0x6a43ee6ab333ddf5U, 0xd1b388e61140ebeeU, 0xf1153bf0489c2083U, 
+0x4db702f52b799a7fU, 0x4f18b6cd53b8e842U, 0xbded8eb9af2c7d54U, 0x6c40002a3accd864U, 
+0x8b5cc82cd3c81e32U, 0xc07abd4c820483f6U, 0x690b836a0e1ddcbdU, 0x95c2dc1530b635beU, 
+0x32427e2840fb27b6U, 0xc76e3db2be430576U, 0x10f238ad61686aa5U, 0xfea74e3dbe778b1bU, 
+0x701d3db7f23cb96fU, 0x126b596b973f7b77U, 0x7cf674deccb6af93U, 0x6e0568db9b0b1329U, 
+0x8fd97c961f9756e4U, 0xbb570ee5de373048U, 0x180e03d850e8cd0eU, 0xed9441c8304280ffU, 
+0xff0e09f93f3abfaeU, 0x9f23774fe4de98bU, 0xafa176128b13911eU, 0x3dbe9e9efe8bfa19U, 
+0x5dd81ae9be889756U, 0xf27b64997b004bb2U, 0x226cd97b271899f3U, 0x762e8bc33211fea8U, 
+0x25e259e07ca6b774U, 0x1972db314884fa5eU, 0x3c7cc4f14982e347U, 0xc02894260af3e97cU, 
+0x15bad033d51cf119U, 0x5b10bdd84fab4d30U, 0xc9fed3f624b48751U, 0x29d9698ee67a7c3fU, 
+0x3c88740575056339U, 0xb89c940e93a7c296U, 0x277a125404f1c96fU, 0x7fd02c517dc82b45U, 
+0x26f75e970975d2eaU, 0x1e52acfa1014e8eaU, 0x8e19bdbb2308f4a9U, 0xdf077d47df609534U, 
+0xaa3c2d9e31936f95U, 0x8a1ec5b84fbdd277U, 0x24c8425c98a2527cU, 0xf8617a8800ef7f44U, 
+0x875580a5a6714560U, 0x247f21027e56c6c2U, 0x9d47ef64f1a5a85cU, 0x38b82a75579ad36bU, 
+0xada87334a774299eU, 0x7d94f23bef716284U, 0x28bf563461643459U, 0xf9d8a6976f261ef4U, 
+0x5b8491fbbc4c92d7U, 0x35db4d6ee54391b4U, 0x2e17dea8334b1429U, 0x9f3e7d758bd3da03U, 
+0x6cbbbfcfb14906ddU, 0x452a2303d694e118U, 0x58862b21cbab1502U, 0xecd2841ea77d466bU, 
+0x467c44537f422491U, 0xfd453e4a86060cffU, 0x6f3fb7bd33580a31U, 0x126b57d05013936dU, 
+0xafa31f199da3ef84U, 0xe148bac30bf39347U, 0xe3c4a3eba2bf3fb0U, 0xc1a7dc13061662c2U, 
+0x5ae0d732b2a8c483U, 0x174b0c88c5040ac3U, 0xdc38c3d22ef95281U, 0xa0cc795d7b5ccf9eU, 
+0x5096745592cc6ba9U, 0x6b348f1bdf693605U, 0xe2374fc97231df78U, 0xabc30122f8b3873eU, 
+0x515623a3afaf403U, 0x38a0aefb97ad7576U, 0x70cfaffac8a0b5bfU, 0x1a241179b9e81f56U, 
+0x590b6e40e4d79a16U, 0x2c8177f4178df60dU, 0xc4bf27493905b76cU, 0x8e1ca0c0a86740c2U, 
+0x170f1b6bc5dd3aeeU, 0x13153a8a8f96d2f2U, 0xe0e22a9ac6a976caU, 0x6d1c50a51553c7ccU, 
+0xfee354e4fdf597f7U, 0x851e310aa8ed53adU, 0x977272002287d474U, 0xafff148e06abdfdcU, 
+0x7622eb049b720b26U, 0x26f2835f98ccfcd0U, 0x1f46bbed41390620U, 0x3e10c5ae9ac968eeU, 
+0x346e98c7add92db5U, 0xe2ff79a4dbe09e43U, 0x5a8665b287215e28U, 0xc735c6cffe428891U, 
+0x678ca9b7e4a6d0bbU, 0x659d3122f5a1afdcU, 0xf311a6d8a8a6418fU, 0x5e5f1d618b97f9f3U, 
+0x168384791033eaf9U, 0x72555f2e506f653aU, 0x358f6bcd04e721daU, 0xd7b1502b06a7e6f7U, 
+0xe0083a7d65543cb4U, 0x3c4529b6c22d0299U, 0x8ab684d0580ea8a0U, 0x73f87bae9734854aU, 
+0x3d2dd872c4856cddU, 0x9d5c42f5357f2d7aU, 0xeebfbfc11a140289U, 0x37c66cf03a87f86fU, 
+0xdda9b5e44f005e3fU, 0x5af68e31bec39bd2U, 0xffd3cb9ace01a149U, 0xf8138a6b3c16427fU, 
+0x42d7e0202f357eb7U, 0xf4ec41bd554be213U, 0xf9d015e57aa5cb51U, 0xca758f3befb4ebd9U, 
+0x52c02a4417bdde39U, 0x1544e179b7604329U, 0x10a2570d599968d3U, 0x76e64113f677cf0eU, 
+0xb4b1752d1901ac01U, 0x5e2a33d2b56d2032U, 0x577066d70681f0d3U, 0xc90ddf8dee4e95cfU, 
+0x1cf999a83a1187a5U, 0x5d57622c29ae69U, 0xee87c9d88161c810U, 0x708a530e9e52c73bU, 
+0x58a4f19b473db9c0U, 0x3ecda73c6d353e8aU, 0xfa9656dcbb6d3828U, 0x9b884811e1f9a897U, 
+0x2f05091cc078ee8dU, 0x4ebf20ce50691944U, 0x25ff7263aa9b4ff6U, 0xd08e57ad859da9beU, 
+0xe997f4dc2da63e86U, 0x123ef7cf9422ed9dU, 0x2d6172ee757e6df4U, 0x852e97984ab488d7U, 
+0x2e1b16c6cde4f5beU, 0x9f374b6d86b2b59eU, 0x19bd648395e462cfU, 0x19cf034fc48b3be2U, 
+0xa91532b6f321af2U, 0xef91d1c93f0f1c0cU, 0xc3b4be68ab181947U, 0x28e32b06a15ab466U, 
+0x15914670429129ecU, 0xcae3acf1e482548U, 0x5f58be80ecd31d08U, 0x7da6c085e4d44d27U, 
+0xeb50aee2acd9ff0eU, 0x448c08654ca586aU, 0x511d0207491627bfU, 0xf498146bb9f41857U, 
+0xd43ae5430e9c22bcU, 0x1da67d691bcc42fU, 0x765b3444d9bc7be6U, 0x5335cea5e99eeb23U, 
+0x3c2c2672cbdacb60U, 0xc8c30c236ca1f19bU, 0xa067f080f0ceb86aU, 0x3bf8d020769c5224U, 
+0x4f83d49551654f22U, 0xb2f7f394231aaee9U, 0x21be9001be69d94fU, 0x90d090cff5c1be6eU, 
+0xf5de057601a43e1U, 0x6dd635653da3f874U, 0x953f021e06bf7033U, 0xcd569a1d2bacf61aU, 
+0xe3abc209d17cf3e8U, 0xee93bd034bea2219U, 0x7c719c2f8397f576U, 0xaf6c44a078cb5f0dU, 
+0xb8add0601751baeaU, 0xec362aea7ca0d435U, 0xaf9e73153cb246dfU, 0x784096fe85d4b30U, 
+0x1b6ef651c76b19faU, 0xd9d6e06d068819d7U, 0xc7322c310821292eU, 0xda4798587cf1d1ecU, 
+0x6aa26eeb326f5af7U, 0xa67bd13e9553fc20U, 0xd17369077e16569eU, 0xebb1d7789bccaf01U, 
+0x6d2f91edd6569044U, 0x33c0396cfa0ceef9U, 0x9d42bafe95c58f30U, 0xaa21c60d6f7d6253U, 
+0xc1924c41c2f37766U, 0xee5abac113928334U, 0x6d1d26add41adf4eU, 0xb2ae6886fc4e6aeaU, 
+0xcd92fb65b9135dbdU, 0xf0c087af39d8631eU, 0xd817aaf582e9897cU, 0xe3e47504a8ddee6aU, 
+0x6906af3e4748045dU, 0xa5a202ff5ec95da9U, 0xb98c81952b83ffeU, 0x930a5bf809cbc6c4U, 
+0x5bc1e6214ff4de54U, 0xa5cabd91e9d3c2beU, 0xc3b4031cf14a2858U, 0x5716dc355df202a2U, 
+0xd3ea4fd550100fa5U, 0xebf3feccd047e417U, 0x91eaa661a99324c5U, 0x985f6c400a5b83f3U, 
+0xcbf0b9e5cdee455fU, 0xff67ffe6e8ce4075U, 0xa4745338f80bdb4aU, 0x7e8c656fe870a9b0U, 
+0x173de998171b9cbaU, 0x4aa2d16746f46627U, 0x2a3f760f4803a53bU, 0xbdddc632ca30740fU, 
+0x1e61500d9769b57cU, 0xda5033bc39e2fc7bU, 0x5348f1925be3f04dU, 0x30651cb592d282bU, 
+0x7ff3a505f33236e3U, 0x192a4d18739f7805U, 0xac4e2423e85682c3U, 0x25208833bb7ac098U, 
+0x37796b9b6698b59eU, 0xa335925893447a4U, 0x5beb035ab3e3c726U, 0x3df841f891a95eb1U, 
+0xbcf8e6796b92baf5U, 0x7bfc867b214949f8U, 0xda02bae8f11cf386U, 0xb38fe6df98b090c1U, 
+0x3ab150242bcbb891U, 0x8f7cc643df26cbeeU, 0xe8281baa743f8f9aU, 0xc738c56b03b2abe1U, 
+0x17e735d9699a84c3U, 0x82314eef7880cfe9U, 0x7f718f2eacbfbbbbU, 0x893fb578951ad253U, 
+0xddaab0784662ab1bU, 0x647197ea49b8c9e4U, 0x35b32a6992e7aa94U, 0x5578845ecd7c0374U, 
+0x316d18f3056f3511U, 0xf653a7746a5d64deU, 0xcea6d0a51d2a4053U, 0xe61d07978b6de2c3U, 
+0x34baaf338761d58dU, 0xca4c9be408d60e2fU, 0x10a240a35720df7aU, 0xb8c46127823f6146U, 
+0x638ea0ba9d1051a4U, 0x3f7504785e107c5bU, 0x14a458f697f3c505U, 0x8f9ed96c5170e37dU, 
+0x94f869b8948b6c29U, 0x22f12354fce39960U, 0x4abfa3bc1d0ceccdU, 0x47f3383888a364ccU, 
+0x1edee1120e537ef9U, 0x18bb499588f994a8U, 0x190e48675b416c71U, 0x48ca9a8d0f032937U, 
+0x2db0b304050b0040U, 0xf3f47db9f0134adcU, 0xa350c993fe9a3671U, 0x8d56e9f710271f7U, 
+0xb58e267a5b3fd0a1U, 0xf6d7c4720e1782beU, 0x1ffd150a8d79b285U, 0xa12185aebd0a9aa2U, 
+0xa14dea1a1166ff40U, 0xcaeebf4a41fff36dU, 0x7c78125d8e480a2eU, 0x6b00403318818d2bU, 
+0xeb74130e9d71b847U, 0x76883f6e7f3ede9U, 0x968943a0590bf2f0U, 0x41cd1b3ae8aafac9U, 
+0xf56563df13573b7fU, 0x889a1c5ed30b6270U, 0x41e20f977be65a37U, 0xdc13f232d42fce63U, 
+0x42acd2284c1f2ba6U, 0x7045547017404b1cU, 0x3c7410da84a90a76U, 0xc909ba80429e340cU, 
+0xa81a6c8f05ff4adbU, 0x14f570d6fcbef768U, 0xe466b4c9c6a5d5f6U, 0xc0c01f34ae41b8cfU, 
+0xfc4eff73ac351065U, 0xcdbc43d170d15b85U, 0x7c937a0b4075b8ceU, 0xb84f5bee4357f5cU, 
+0xb02f590b87ae9cebU, 0x226c21ea70ef2d14U, 0x3af19565db2119a8U, 0x25c02de601df7f07U, 
+0x47090d134bc6e275U, 0x37c641df0a658726U, 0xc884e0dcfad11d5U, 0x8a9fead2c812383cU, 
+0x365019d7932c1a1cU, 0xa2f32b1a022bdd6eU, 0x3d229ea400b63b93U, 0x3a932fbc468ecbdbU, 
+0x84aa92697d343540U, 0xc0417e15749a28b6U, 0x1c9547d4dc81d0aU, 0xad3d80540f3457a8U, 
+0x1f8098f6ec5a3c34U, 0xaece82c0295949feU, 0xe8ab9f4ca7ae3e58U, 0xfedd9d1b2cf8e49cU, 
+0x62b54bf4e13d7714U, 0xadaeb54699bf8297U, 0xb0be85312c8f4b00U, 0xa52e24c31853b8e0U, 
+0x452106b80d6bf1fU, 0x46bd033e9824fcbbU, 0xa3521e9276b346b9U, 0xc3337343451cb83cU, 
+0xf95e58423cb01f48U, 0x98ba36420e266162U, 0x13dff31af72c3155U, 0x2eefe9391b812cdaU, 
+0x9b4e54d1aab6a396U, 0x73021b91a1136076U, 0x2dee2d7f5e8488b3U, 0x3e0e3286bc6ea48cU, 
+0x2eb31e48d980e27eU, 0x6ab01041f3468f6aU, 0x4f31fe1deb453fc6U, 0xca448172fa3b3796U, 
+0x27bf4c48daf027e9U, 0xd7ca75dbee54677eU, 0x3c3c7cd537ed6d17U, 0x5a62873d3ea83e25U, 
+0x3199d905844c68b4U, 0x988af4309ca675fbU, 0xa76409cfeec57a43U, 0xf6d94479a5bf6afdU, 
+0xaaf35862341023ecU, 0x5645d8f76fecf570U, 0x4982e0200982b9afU, 0x344ab93080c32d28U, 
+0x4f898291e1eeb87U, 0xfc4e976afc3995d7U, 0x73f8f2d1ea514c5fU, 0x6e1c2b042b24462aU, 
+0x372e9f6588f6c14bU, 0xd1d72e5f3a925014U, 0xe264c7637c972877U, 0xd895626548b65b81U, 
+0x79363ed75d7d991fU, 0x3428d632bb067e1U, 0x728ec60818c340ebU, 0xfebfaa38f2bc7eaeU, 
+0xba5b594b77078424U, 0x3ecaf7a0ec40c3fU, 0x8a3a43622003a267U, 0xfd136eef8971044eU, 
+0xcd61eeefc671ddf1U, 0x7cf2b1f78a2adfa8U, 0x67a1d191b5c5efa5U, 0x218da834f3c652ccU, 
+0x80ba87ff6127b756U, 0x3428be4aba09704U, 0x72d362da5060b416U, 0x6d8c782f716df126U, 
+0x6551f74abf172571U, 0x4e3aa6da2d7cdccaU, 0x1459a82d36d34dafU, 0x99aedf0896fdb911U, 
+0x5f1d84ec8db1cb3cU, 0x1b7003a0d43f024aU, 0xe9cca5367519f86U, 0xd99e8e9dd9638d14U, 
+0xd88a29e36b8637a7U, 0x6286fef8ffc8765cU, 0xa945bb321bceba6eU, 0x36dc19ad1cc0a3a7U, 
+0x4dee1a73758cf17aU, 0xf1f85dcba5882352U, 0x8d059aef1b4097f8U, 0xebcabedd95bf7acaU, 
+0x446cdc5f5caa0ccdU, 0x10fad212d0ace95cU, 0x2c00a1b67c32e6bU, 0x47d3ce0f8f22b9cbU, 
+0xe4c4b2c551a3c43cU, 0xdf701ca8ecee258U, 0x48cc1f2b4aae6714U, 0x56c9da9467cacd5bU, 
+0x824d8b7d20d7c9edU, 0x41d40ff932edcaa1U, 0xf33c7964ddcb6852U, 0x38d46acb42c79ec2U, 
+0xbceee515ac855c5bU, 0x1185621a017c8afbU, 0x45331a369e17fc28U, 0xe8df4d2e4bd4ce24U, 
+0x59d5e72c2e465650U, 0x9663b55f1e1e4d7dU, 0x4444db4f59ef32c5U, 0x6c57fd70c47f9b26U, 
+0xfd46f68d3c385172U, 0xd203351e0440e636U, 0xa1bd8a54e5b09191U, 0x3fdf1619a198317U, 
+0x79ac67f0fccb9794U, 0x5b9b929e90e7232bU, 0xfe470c7d3c857375U, 0x408d02c06e5c12c3U, 
+0xd08f5bda52e7e454U, 0xfe32efef0f0e6150U, 0x912486023a981662U, 0x4068d3d718eca832U, 
+0x779acde5d8ef191eU, 0x988d21ed13c37332U, 0xb9ec14597d9d38d1U, 0x8cd853b7254a47aaU, 
+0x400c1ff535d8247eU, 0xcd4780c2511691ebU, 0x56e101f9afa0b7a0U, 0x33eac9bba2c355ceU, 
+0x37216ab0af3da9bfU, 0x84f8cf37b7ea407fU, 0xd4461f2afd15ef2dU, 0x35973173e4e17c41U, 
+0x857adf846c5d939U, 0xa475a2877ba933deU, 0xb55bf32e60ca027eU, 0x12550ecdb1d825e0U, 
+0x92a74fc559e757c9U, 0x838b741fecd8d431U, 0x5448e43c17724a72U, 0x7b8f8334f872d7a7U, 
+0xb9e249d02df771c8U, 0x335a5211ee094c87U, 0x9d32c2b3c01f8750U, 0xb71e546d922dc902U, 
+0x2453a26f93f48c51U, 0x26bd522b55bba286U, 0x78912a4ccce288f4U, 0xe7ccefa8cec9f900U, 
+0x38d0aac656c8a56fU, 0x85093c5434f37421U, 0xc69bb7b53afad08fU, 0x944d671ac3b585d4U, 
+0xb9f4dc65da7be289U, 0x67d4c174dd06517eU, 0x4c143936133ac619U, 0xa71065977b501fffU, 
+0x68f73092d3194444U, 0x850fea94baa7fea2U, 0x612239666d87a19eU, 0xfacf5d96ba1526b8U, 
+0x552bf48844bad676U, 0xbe72b245b947d00bU, 0x935b7756392ddac6U, 0x7ceb907bb8ad44f6U, 
+0xaeeb8a18ae08f15aU, 0xfd69e56dc812900bU, 0xfe6b03655ad3c305U, 0x86a54e91cd099a0cU, 
+0x3524d1e7c1388308U, 0x77129d125b35254dU, 0x3a72a8d06d756867U, 0xcfee614837a78460U, 
+0x49150a564f676e03U, 0xceffc73693e84eddU, 0xeb0f6433571e8761U, 0xb8da94032a957518U, 
+0x1488e4e74efdf6e7U, 0x92cc584d95ff3b51U, 0xd7c99cc9762808b0U, 0x2804dfa44805a1e4U, 
+0xd413f414c5af726aU, 0x469a3e5cb25bf6e6U, 0x53f2cb698ab620f9U, 0x6d36d105ed8cc5ceU, 
+0xc570491a13f9fc7dU, 0xdcc59936b4108a35U, 0x72d8c66c95c50029U, 0xe4ba5c34e377669eU, 
+0xea19849dc6e1346bU, 0x5abe7b10385af1c5U, 0xe54c761f14d152c0U, 0x69068ff0982d10bU, 
+0x7bb58a54d7226c13U, 0xa4f6893994c6026eU, 0xda85db2bd086442aU, 0xb863e3e090bfde26U, 
+0x86e2a30ca540db99U, 0xeb1309c0534b8122U, 0xd06883fa66f0b0e3U, 0x3ab6bde10cd3ac0cU, 
+0xe6873fe31bda78a3U, 0x38d137b0e369c043U, 0xfc3117a96a13e99cU, 0xbaca62079be871d7U, 
+0x30e691fcdca1f6a1U, 0x68cbd14348cff1aU, 0x5286dc5cb1e86ce1U, 0x898c3493cb259761U, 
+0xa4adc20f164f647cU, 0xb2a7cf979f2bd79cU, 0x9d84542452ac6e93U, 0x75f75986ab56a554U, 
+0x584e2bbc7235c795U, 0xb0d8958ebd541d7U, 0x393b05b37d1c89d7U, 0x63c462435ef974bU, 
+0x3f32dc095b110258U, 0x9e4acbacfa49a9bdU, 0x431f660d931c85b6U, 0xe27f9bb913038404U, 
+0xaa69e03c3d1e3998U, 0x5e56c8b917a04328U, 0x1a5299d7022a274eU, 0xb213e2fed2918bf0U, 
+0xec2cbdc6325fb81eU, 0xd534165bebded175U, 0xc3d61ebf83a43bc3U, 0x229f8ec20f2d3c12U, 
+0x7777bf279f1048daU, 0xba2fd4f373ddd3baU, 0xfdba069d9d07bce2U, 0x796634e3f1ad56f0U, 
+0xe8f9be24a106cf01U, 0x532576d8cfd74862U, 0x56de74735a7927f2U, 0x4d8ee2b6cfb20b89U, 
+0xbe1feca25be234U, 0xe83e3e70ddf3507U, 0x5d1d0ba691606e06U, 0x4b3b3ad816c7f93eU, 
+0x63b7e03920e8362U, 0x41e7fd92cf211b84U, 0x7875e96dfd8cc04cU, 0x5eec023b85dabc9cU, 
+0xab209ac9c05201e1U, 0xd264cb5ae836b77dU, 0x852bd55cdea35f99U, 0xc299c6b06e6c78aeU, 
+0xadd3313a50f51ba3U, 0xbd74dcf583ac2ae9U, 0x38884f24fd774cd7U, 0x5aa739923611805bU, 
+0xb96634a7e289f55eU, 0x2976b0f0e2c76707U, 0x20251b0278965beU, 0x9f7b88b6ddb04f96U, 
+0xb3cd3b65fe1e4bdeU, 0xc0e536e0eb10a2b1U, 0xbe3146b4298fc71fU, 0x32f9f784c70410f7U, 
+0xfd37a7f16c1cbaabU, 0x1acab879033d564cU, 0x598ab6c18a70635cU, 0xd031ae98fb356071U, 
+0x4c39047f85116b26U, 0x6dfb4a4fdbd65fdcU, 0x8e6e4c06adcb4dcfU, 0x415196b4e954584eU, 
+0x16549c8c1dfe1d2bU, 0xc493f509e56878e5U, 0xe76ccadfd3fb73a4U, 0xd58a43e9cb7448e3U, 
+0xfcf2795b8cd50922U, 0x54d9ba215cbd6fbfU, 0x10a729132828276bU, 0xfc17866ba05883cfU, 
+0x626fbd58447996c0U, 0x6e2eed7276ba269aU, 0x39b979577bedd0e9U, 0x16e85ad86a953564U, 
+0x4888bc64b8151d48U, 0x21b642ad9c569d54U, 0xfb217e5ce00ed55aU, 0x7408b0aeb424493eU, 
+0x124151be249c795eU, 0xed4406aa99ce805eU, 0xcd6d969c3c27ea4eU, 0x21d2713971118310U, 
+0xb0012ec399208eceU, 0xd671944a4adfb761U, 0x17735b85522bb4c3U, 0x94c5f9b4b075aceaU, 
+0xf1a11778e3c0df5dU, 0x2019effb5156a792U, 0x7d8adab9475d7fabU, 0xe80fea14441fb33aU, 
+0xfcb4291b6ac9ec78U, 0x2d155e80af322ea9U, 0x1e89768ca3ca9447U, 0xeed1de7f638e0077U, 
+0x2db0e78b0f83cd58U, 0x122dcc3877d2f916U, 0x981ac4ed1efe7a37U, 0x440ca1f08ea41265U, 
+0xb07bc069b88a3f4bU, 0xa21e4d4269c0a260U, 0xaf8954dc9d4e2f02U, 0xa6c8b0d2cd5ee122U, 
+0x2c0359ecd7592d55U, 0x6d5b94740e35019U, 0x8afef69633ce3b1U, 0x5d2ec6dbc4a10526U, 
+0x266e5d0eaf5183a7U, 0xe2a7bcdad115174U, 0x58f710fa268cd695U, 0xa92cdf89c6e45ebU, 
+0xe81bda2712998b10U, 0x9bc70ebcc1b229d9U, 0xc5f7f829d3a90781U, 0xf694cbaf2b966c1cU, 
+0xf6788b1700f05e51U, 0xeb6c64c3183c2a47U, 0x633c5ffacc46d82aU, 0x40a63eba61bef03dU, 
+0x991f4b49fe8f9f5cU, 0x7361f1e159880a51U, 0xfe2cae34215f404dU, 0xac371dc3b11bf742U, 
+0x17a83ff3325a503cU, 0x22953458ee751e1dU, 0xff2101e73254e735U, 0xc51616c18709a477U, 
+0xa744b8f8e55bf84cU, 0xd964c6ed570d9027U, 0xe5dd3c25223cae4fU, 0x62782899ceb96cc8U, 
+0x6f51cfab5f15fa2aU, 0x9a020de7ddd176edU, 0x1c5497229726783U, 0xd670aca40911a289U, 
+0xf4a1c8d519e33446U, 0x40893bc452af385dU, 0x9348c0bd0222a17aU, 0x8942003a14f1840cU, 
+0x40d38a00e6387689U, 0x6bfd773679e74f98U, 0x4d8b2d6d0efde4e0U, 0xa9fd039595a5077aU, 
+0xf95a13358dd553fdU, 0x47abf695c08b6414U, 0x50b6d4f439a25950U, 0x8b6e862a35566848U, 
+0xd803dad33e9be5edU, 0x24ac3c5a183383d0U, 0xd10bc2df4eb9fa1U, 0xea5e08910ed11cb4U, 
+0x3d728c95b913cb26U, 0x99eb419c013bd6d0U, 0xa2cda44ff5505c98U, 0x2770266b30a342a8U, 
+0xbfe71733f348a7a2U, 0xe940c91bcc815bebU, 0x5552d24d07f2b324U, 0xf649bc5e79b0db1aU, 
+0x23f4244acf0c58bdU, 0x28d49f4df64464ceU, 0x32d9e10056aaecf6U, 0xd3adf06e24844c09U, 
+0xe52e4ab937c89387U, 0xaee3869fa4b98c9cU, 0xbdfb2febcff638baU, 0x57e99db4fc2a6077U, 
+0xf0aaa021595e8247U, 0x97bfdc455686cd1aU, 0x78e5e6e01cf8ba90U, 0x75e4d0d383cbed21U, 
+0xca23fd9d59982d22U, 0x7ddab5b6ea9ad893U, 0x741f970ec7b726d4U, 0x1fce42a175410990U, 
+0x399471d0f39715c2U, 0x69006521f98a529aU, 0xb411f78cea33feddU, 0x2f189e88f19a3d85U, 
+0x66a635844171dfeaU, 0xeb3333e2c36854f0U, 0xdf708475ed10f9f7U, 0xc91a39f8f3c5d7cfU, 
+0x7479f44da6333323U, 0x9cbbbc1c68f4abf4U, 0x3f020d605984da84U, 0x3ed1b6383361bbf0U, 
+0x4b13fc48b5d61ba3U, 0xa9b728a10b78f729U, 0x5d97c989688f929eU, 0xd84f2da48b5b4ee7U, 
+0x87562edcfa3eb3fcU, 0x77ee68944d90e398U, 0x77e46b40888a6f7eU, 0xd2cdc8bb0a1b6bb7U, 
+0x44287db3ded37564U, 0xc1f217b9310b4927U, 0x6dde95362cf926eeU, 0xc5538af9e5c56104U, 
+0xf25057d4b33980bfU, 0x68a3702e50dd00baU, 0xb846fd772348dd43U, 0x70fdd2f06a758181U, 
+0x12eea8cea0b75785U, 0xa10358385d74a56U, 0x957a410d11ee596bU, 0x5edfcac0d0d58696U, 
+0xddc07bbcc4e16070U, 0xf2a182031efd6915U, 0x13ba48e51d567543U, 0xa301697bdfcd7043U, 
+0xc0d1a041e177ea1U, 0x1735dbf7c0a11a13U, 0x81809fa25d40f9bU, 0x7370f91cfb67e4f5U, 
+0x11420316f24ba5aeU, 0xb43965004c34b5d8U, 0xf3e8d2419e0bff74U, 0x27e1e59cff79f049U, 
+0x84a5bfee883a45b3U, 0xdf48a1a69afa63f7U, 0xee1b5e3cfc79df05U, 0x310b26a6c804e209U, 
+0x67012700138011fcU, 0x83596a67ad728562U, 0x156b133082200a4dU, 0x6e8313a30815eb11U, 
+0x6acb69fa3f15ab7dU, 0x26af915ae9c51f9aU, 0xc1a12db201dac304U, 0xc147818bdc24f204U, 
+0x9969175c9caed7aeU, 0x5a39adde84fbfb4fU, 0x16588ec3892d7e4fU, 0xc712e7a5f6864aeeU, 
+0x84d148aa46156294U, 0x380d8e544b0ce637U, 0x65ed4b82311dd9e5U, 0x49644107516363b3U, 
+0x53a749b8d00e6ba7U, 0x3d36ec5b44916f7fU, 0x2bd1e038a4d9e1b4U, 0xf952a9099784851fU, 
+0x8dbaeee50175e4c1U, 0x5557167b4c62a2b9U, 0x861376a2e27fa0f6U, 0xd8a93a5b08abcebfU, 
+0xf9549f5c595b6f7eU, 0xbeb32b53d38b2021U, 0x83a053aad09876cdU, 0xa5ac7d1d04cda30cU, 
+0x48dbb7308ab19c84U, 0x99e39160f5818a48U, 0x36cc3c9247d9ee1bU, 0xdf0b8a0ab540f55bU, 
+0x690065a283aa0e93U, 0x8f2e3943aefb1f62U, 0x504031a19d9e893aU, 0x94016d5e31d3fee7U, 
+0x38eed26887addac2U, 0xf484373baa57b07aU, 0x40355d354eee6fd7U, 0x675032ee5c454d96U, 
+0x1b43e1fe44a6db03U, 0xb2c85d6f58275d79U, 0x65c0d426b8675fcU, 0xbfc0504a4b3235dU, 
+0x58ac8d1a464b8542U, 0x37427197345d4f05U, 0x3fb8ec7f94a6c992U, 0x1955467a6c34f345U, 
+0xb0f4862e0266b17bU, 0x23568a20262bb32U, 0x1bb978846a9f09c2U, 0xef22d174d59fb289U, 
+0x32a6e04379dac83eU, 0x3ee7276f71c341b7U, 0x68f9ccc3ae34a107U, 0xbc5784c97ab24c75U, 
+0x57f2c542eb4318b5U, 0x72ed5c812f5b8456U, 0x55788a38df2057eeU, 0x9885f5fbe1948d0fU, 
+0x2fe542541599175cU, 0x7c82aded676904afU, 0x96d2c467768ceb8eU, 0x135fd6f69ef198f9U, 
+0x2313015a92d382a0U, 0xf28dcbbce2ecd9aeU, 0x39cacc780b2df927U, 0xb5f7efce4ceb892dU, 
+0xba2f0abba5b4b532U, 0x71fb096d29acf8c5U, 0x3c0957c6e0cbddd3U, 0x6843545b51c3f235U, 
+0xb93a4ae4ce81c1bcU, 0xd25365e58abb5b33U, 0x5ad815b8d68ce767U, 0x3360f05465c0463U, 
+0x76dd2896566cbeddU, 0x231728eb5c811501U, 0x4ff69c4251306753U, 0x7e48b5f90c575001U, 
+0x7e692464412cffa5U, 0x89ed4208668cc5c4U, 0x408754d8fbd46243U, 0x1cddc3d2b2e71076U, 
+0xade6d89cd521954eU, 0xc41c98426b36b528U, 0x3fdb126bf942b08aU, 0x1e476a0cb2f1f8a6U, 
+0x1509f734048993f7U, 0x96255223f8273ce1U, 0x6334fbe1bc8bae42U, 0x875346a56a38511U, 
+0x601c2c8172b9dcc2U, 0xc9f4d4f1b126018eU, 0x10e994e6e75fa287U, 0x64e6ca8a2ef8b03U, 
+0xd35fe43934a9f22fU, 0xcc0819c5217a8e2aU, 0xf21f8b8b948835b0U, 0x2accb359f25ce939U, 
+0x7b75dcb3b75c4927U, 0x154bd7bec5ba550bU, 0x19213a37edf0edf1U, 0xd518a4e9588ad2e5U, 
+0xab7ac63e3fb04ed4U, 0x8cc330b11307fffU, 0x463f9d0512678de2U, 0x90ad85b389d6b936U, 
+0x991d4d48cb6ef150U, 0x39aefabe1582894dU, 0xaffdcbd9427222b8U, 0xe507a3620a38261U, 
+0x2818b0eda7dc0151U, 0x7e125be646707badU, 0xf44b1d1548425e3dU, 0x7e2cd40ef8c94077U, 
+0x9a3bc53920721ec7U, 0x889bee40aeee082cU, 0x82a61a8b321ef95dU, 0x905b75082adcfab3U, 
+0x6275db33b0b7b678U, 0xf13c4311bcf63816U, 0xa1986bca426b6c76U, 0x186e497334e4231bU, 
+0xa7a076f2f8d91fc1U, 0x11077225449535dcU, 0xaa7fc825c0b7e67eU, 0xc0d460e49807bd84U, 
+0xe103ae41345e597U, 0x9c636bf9db853cf9U, 0x21c975bbd1ef52a7U, 0xa146f52195bedaceU, 
+0x7675676af45a770aU, 0xea67a5b221f094b0U, 0x9ae95dd2dbb31b40U, 0xa5a99b0ab053feb0U, 
+0xcf06e5cbb3421fb8U, 0x984971f2ef5a55d0U, 0xe7e06b34c3b72412U, 0x61c8d834f6dbf62U, 
+0x995ef6684e3ccd80U, 0x8067134b3a6fcdd2U, 0xba9392590e05eb5cU, 0x6dfc6ad99003b4b7U, 
+0xd08c89b84bb9dc8fU, 0xaba9e93ef5edd333U, 0x248f7035352787d1U, 0xfd9941cee1c26864U, 
+0x743eae53e59780d5U, 0x7872b2fdeefe938dU, 0x6de97e05788859e6U, 0x7a41ec75bd40e6f4U, 
+0x7124be18af6b35a4U, 0x889f37a6ab27fb48U, 0xb7363240733a68adU, 0xf6a6b63a208ee513U, 
+0xcaeb6fec81f422a6U, 0x19d5756e75ee1862U, 0x1cad3704f560186fU, 0x3df7c8a8002d138bU, 
+0xcbb53fc4ce45444U, 0xdbde421efeccc4e2U, 0xbcfbf9dab25a8114U, 0xd24c75a1cf1993b9U, 
+0xcb93246987dd4a57U, 0xbf7593f499f1e524U, 0xcfcb7d1810e5a78aU, 0x58fe1d2de84dc1d1U, 
+0xb96823e8a6954c11U, 0x7fa8a43c1560d018U, 0x220d1b0f150778ffU, 0x87a2fc28c286c376U, 
+0x756e332e272a8b45U, 0xcc48933f2a78124bU, 0x97b1948da0d27532U, 0x33ad518b45aaecefU, 
+0xeeb1afe987a43ddcU, 0x24282ca1a9956e4aU, 0xa101eb85ee7bdf55U, 0xa8b08b864946ac6dU, 
+0x87001c82dfa2a6b8U, 0xa325b4452b1076c3U, 0xf31591ffdf0e8edcU, 0x7f00fe8bc8a36a01U, 
+0xae47472ae2706ab6U, 0x3c0b341dd2e53c0dU, 0x84556efcbc384cfeU, 0xe1472e046e7881a6U, 
+0x36e86a169d58de05U, 0xaa589d55453cd275U, 0x83f691978c8621f8U, 0x82cd92aa47c58fc6U, 
+0xe3e9432c3b963645U, 0x2dcdb2807e71f1f8U, 0x6e74781a2e3132fbU, 0xc5f0954fb1b8a63eU, 
+0xdbf8874f008be2ddU, 0xa330502b0047be4eU, 0x18a3cb440260d7e6U, 0xd552d31021b0b6fbU, 
+0xebfae54207a84fb6U, 0xc42368750fa15021U, 0xde8b4d601e48b9ebU, 0x1caf92c804f8aef5U, 
+0x16b1819027149109U, 0xec1cc1696a2ce676U, 0x481a64f8ff101622U, 0xbc24b85ac976e53aU, 
+0x53a93123e9c8381fU, 0xed3d6d6383c11a7U, 0x34ebeb4634fe1010U, 0xdf3acf55bc6d97ceU, 
+0x1affd6962347de3aU, 0xb101957e67e389e6U, 0xa6099c1dedacd1ebU, 0x6b3dd8ca51907a75U, 
+0xb768cfe14a955911U, 0x107e16a260ded52dU, 0x2589efe9b3d78397U, 0x705bfd69af09650dU, 
+0x8bb7c693ffd200e4U, 0x297f3b522a42e72dU, 0xa7e63d81f54051faU, 0xe14aa4130b73f990U, 
+0x1b7b444c9ec4c0daU, 0xe88c5678723ea335U, 0x9239c1ad981f162eU, 0x8f68b9d2f63b5f33U, 
+0xf23cbf79501fff82U, 0xbbea2cfe95510bfdU, 0xde1d90c2b6be215dU, 0x662a9f2dba063986U, 
+0xe6847df84cf27076U, 0xd89858ade7627eaeU, 0xfcafebe77fd9af59U, 0x4d49aefd784e8158U, 
+0x6b90b66203aa781eU, 0x6e0f2d1a7df4d846U, 0xe723f210359ca6f0U, 0xcd32fc59a10dd135U, 
+0x18e2b8edd23809faU, 0xfd845cb351d954beU, 0x8ba93363f2451f08U, 0x38381dbe2e509f22U, 
+0xbd707518331fed52U, 0x3681fccb32d8f24dU, 0xb09405a5520eb1ccU, 0xe4a32d0a0fb917dcU, 
+0xe8dbcb5729b62026U, 0x8d2a3de0889d1d4eU, 0x37d6619e1f5c5aa7U, 0x7564539e85d56f85U, 
+0x4172c8fadace0cf3U, 0x684aacd954b79f33U, 0x5231df524a722925U, 0xc1d685413749b3c6U, 
+0x3ea4264897c2a310U, 0xf186aea540122630U, 0xf6921b82aa4699a1U, 0x49262724e4372ae6U, 
+0xc41b6815e27ded0U, 0x6d163612a75ff8ceU, 0x5a2cfa569714303bU, 0x1337e773bca7abf9U, 
+0xf8166c1903663da4U, 0xa5a362919f5d0b81U, 0x6808a6ed7c44aa2bU, 0x6a664a356aa5705eU, 
+0xc28313fb33fc22c4U, 0x89916127e6c04c9U, 0x29f86ec196bf0cd5U, 0x449a125954fde98bU, 
+0x1384b079cebd2d31U, 0x4dcc1a56ff06db8dU, 0xd5e253b3e477e2f8U, 0xe306568c1a240c90U, 
+0x692b408392546e44U, 0xffbc8042be373826U, 0x888f2b107f7d0db6U, 0xeac6fe378934260U, 
+0x5364dacd57b4a278U, 0x78f61a5f1ff4082bU, 0x6746ff301ad9ccc8U, 0x210a917ad9df2779U, 
+0x7f2713fd0c7b2231U, 0x3789e61aaff20bfcU, 0x7a39be81f8d6737dU, 0x670e1b5450b5e57bU, 
+0xc530c39e363136b0U, 0x74ebf8d9aab41dd9U, 0x271b0e7623fbd633U, 0x3b9e100e2428cefcU, 
+0x953ec16f6cdbbc8aU, 0xa2ae28a33ad31f81U, 0xdf1533eb8f475b26U, 0xfafb98152d16bb71U, 
+0xea98eb53dd90124eU, 0xc1e802685281c85dU, 0x77e9a1946db38156U, 0x7aeaca93c06c5541U, 
+0x3f50781022021e31U, 0x59bc1bf9b90a904bU, 0x4facaff046c1d951U, 0xdfb29b190c1390f0U, 
+0x9608f0472f485d3fU, 0x17ca07688107beeeU, 0x2b76ca80f5dedef7U, 0xbb0aad49712ac9a9U, 
+0xe79392503ca2f975U, 0x895a5afa31670bffU, 0x8ecd201f7297da34U, 0xea699c53c5835479U, 
+0x70f702d505ed815eU, 0x66f440abc1c017b4U, 0xebb5fad219547ad1U, 0x5568dac679f74a32U, 
+0xd9bbf64c00602df0U, 0xeb05f7eee2582151U, 0x580d6fe01d073f2bU, 0x7a85f8742788ba64U, 
+0x4aeed33a36718dc9U, 0xe1e58b4db01123deU, 0xd4e8eb197afe0113U, 0x79090ac8e4eefcc0U, 
+0x963322b11cfae7c5U, 0xdd36afb70ba9008bU, 0x13d816cbcd9aaa56U, 0xeaab722b91905b8fU, 
+0xabec1bdc2e44a0c8U, 0x2c9be7402ee29932U, 0xbc9bae600c7436c3U, 0x601e9e884807943cU, 
+0x54793412ba00e557U, 0x424e0c5a6b46e659U, 0x714b8cfa9ffabbb1U, 0x5a7a22aa6fdc8eccU, 
+0xa269694c7f60c7d1U, 0x8dd71de7cd775ad2U, 0x1c03dbbce549ba66U, 0xe77c81ade9f97b55U, 
+0x4ec581f282d72449U, 0x631470f71c2986d3U, 0xc5fc3b323ea81543U, 0x3acf1478eef81321U, 
+0x6686fd5053231e11U, 0x1f48e86503681e3eU, 0x5ff99ff9198c3609U, 0xe4f3fb0176af85d6U, 
+0x822c38576feb73bcU, 0x6cc7e74ec951d1c9U, 0x1661a6d0ea02b728U, 0x1e63633ad0ef4f1cU, 
+0x3bfee2233bcdaf2fU, 0x88531a825ba17295U, 0x1ec64110abdb362fU, 0x4b30cbb7686773e0U, 
+0x68033d463d26b5b7U, 0x1fdf3c81e4348575U, 0x6f9e2c5777c3c4a9U, 0x74c6350265bb629bU, 
+0x5399f04e6bf05bd6U, 0xa2f56e03212a9946U, 0x832f51feb470decU, 0x900c3241bee44fe9U, 
+0xde52ad3bf00d358bU, 0xd69853583c4efb15U, 0xf95c7204570b2439U, 0x6c31f9e8e8b1f0f5U, 
+0x2ffe9c29a673059fU, 0xec11715050e0fa19U, 0xcd15b20b17464817U, 0xcbb434aa7ae1700dU, 
+0xb7da9642227c070cU, 0x41d45e4f0ad5f845U, 0x562d492338b5dfadU, 0x4a1a200ab4dabd17U, 
+0x7a7c28cc9f105c50U, 0x82e0deef7b138525U, 0xd628cc3403c233cdU, 0x5a8d0362ab0590aaU, 
+0x5c9b201838a4cde9U, 0xa605f68a66d013c3U, 0x936a6b724143ff74U, 0xc059eab113d4e536U, 
+0xbe6fb2f7a72e294dU, 0xf158eba3f00d0dd5U, 0x1a6289eaedf7edc6U, 0x29dfe4805cd534b9U, 
+0x44137260ec469b52U, 0xd1f1961c3929ee69U, 0x9b434e7588a05e4dU, 0xbf66d826d00672e1U, 
+0x647e18b9b2d64febU, 0x3772f8a59292292cU, 0x48ef3a5776cba4e8U, 0xd93f4d031232f60aU, 
+0x7b0fbd5934698359U, 0x93e0430beec90da3U, 0xa237311c54dc8c4dU, 0x7925555d45cb2733U, 
+0x4d4786e106de12c0U, 0x6d9cdac5874610e9U, 0xd06d7b1e7557244cU, 0xf478056d9c102c1cU, 
+0x69a76ce6ca5361feU, 0x26c17ef609ab92d7U, 0xe68095e01068694cU, 0x7f09e610f33e3946U, 
+0x722204cd439fbc84U, 0x7e7062916057a016U, 0x1b14e2bc662ac65bU, 0x2f0769c6e36f2844U, 
+0x3fb902de1c201becU, 0xcca79b6a4c4dd5d7U, 0xfa5df007990e2149U, 0xb434f3724d73bdddU, 
+0x928b2fd2d026dea2U, 0x87c84c452c59c5d8U, 0xd71a1e26d9a6dd61U, 0x1ddcfa48d561bbfbU, 
+0x6f4873d183de522U, 0x666fd68c51c06734U, 0x41fea34d6402c020U, 0xc6fa401fa9923a7dU, 
+0xd537eacc86a758eaU, 0x91188318927f19c4U, 0x9586895a15416e39U, 0xfe7e6780559e0309U, 
+0xe4f22d95db7ab649U, 0x3b801707443120d1U, 0x88c08e169849251fU, 0x38aa6967a281dcb9U, 
+0x3c7f0046c33773f7U, 0x50d44fd345b59995U, 0x3e1410c009e372a1U, 0x355b3226f5dd236dU, 
+0x53c3ff1887c182U, 0x1e25df78cce25109U, 0x49f10eeddd21fcb8U, 0x8eca480704703adU, 
+0xde7156268cfffefaU, 0x1018044f70651afaU, 0xd6df6f9150c3af85U, 0x91baf5ca75383127U, 
+0xc7d36f34df7f6fafU, 0xf4bef310e6fd303dU, 0xe5d969f127dd3d92U, 0x4e5cf119347bcebU, 
+0xdd3df40690785491U, 0x5291de5e4aeaa5d1U, 0x5619f43cb2f866b7U, 0x92b1e0f17f260baeU, 
+0x9c98d36058be555bU, 0x3985fb77e2288d7bU, 0xe167c1d1034e5ad0U, 0x81ec44028d8d9e63U, 
+0x2fc0917e8d33c546U, 0x82575fb3285edaf3U, 0xcb2c5373e0f5ddd7U, 0x44584121cb3f78a7U, 
+0x60a6d187000b4fd4U, 0x852f0a3cfb2ca736U, 0x77225eae391ada20U, 0x308d9377f3f8753aU, 
+0x16fb6eae20eae29eU, 0xc7034f2f0d4e1d07U, 0xeb961537a45a4266U, 0x8c00fa9b18ebf331U, 
+0xe7d2a4c66702414bU, 0xc2fadafa81e36c54U, 0xa9dc343a3736c974U, 0xefa47267fea521a1U, 
+0xe84c9ab0c18ada5fU, 0xfd7e297f29122fb3U, 0xa8bb5bf9636be1efU, 0x24cfc0176da2b46fU, 
+0x68fa6139978a586bU, 0xed959ca1a4f814f2U, 0x9868714d5deda927U, 0xebff8fbb079c61a6U, 
+0xc3f95603ebfd913dU, 0x50a680e6ee54c9eaU, 0x74d07a084c2a8d20U, 0x36362aa7e907ddf8U, 
+0xc44f9aeac52e243dU, 0xd830bb10d6b2faafU, 0x3416244370da2a82U, 0x48f278676cb8afd5U, 
+0xf103189594679da2U, 0x16ddd67fc7f057edU, 0xea2ded72a1292ec6U, 0x4a7d58d4b9bc82U, 
+0x4877f484779ffe26U, 0x71c3b494963fa28aU, 0xe6b1d8147ec71b3bU, 0xb98ac5b76702cb75U, 
+0x7cababf9ad132896U, 0xfcb1e3bab7bc6c96U, 0xf295ad962dd9200dU, 0x4487976df32a1e02U, 
+0x48c01b12af685248U, 0x6b40d5a6276aa7aU, 0xefc9a90774561a33U, 0x27bd5860d115afe1U, 
+0x859864d3775732c0U, 0x202fe5e7233777aaU, 0x624a5d1b7cb1096eU, 0x8f3ccf31f8b74b9bU, 
+0xe73bde5e65b9415bU, 0xa90e687754858825U, 0x89ef46d997ce53d8U, 0x67f1cd3e2d39e531U, 
+0xe08156f6bfa2670cU, 0x7400f82ba06273e6U, 0x8b6a9caa83350324U, 0x4a4d3ac28bcb8378U, 
+0x808b9ffdd6c1764dU, 0x4930594cbf29beedU, 0x17e7711ddef02b9dU, 0x70abb91c01845a4fU, 
+0xccf34eadc87c4b65U, 0x96f8808a1e07b2a9U, 0xfc76c5e2c066ce49U, 0xee7d69c4cbd001c7U, 
+0x23e8f44ed136a95aU, 0xc33e8999bae942e5U, 0x1a192abf030f2ee2U, 0xecc8626ec1a41382U, 
+0xd96afe24cb24aa7U, 0x903108c639345c53U, 0xc3ae6fd89ff8fe18U, 0x5f7b2d190ae91802U, 
+0x6d7807434a693d7dU, 0xce8deb7093c81d0cU, 0x30a3f80a3ce67c47U, 0x7703600c4fdf2b3U, 
+0x842632d7ff004130U, 0x49fd863381c36b09U, 0x266a14e5254cb5aaU, 0x50d775b5f72d186bU, 
+0x456b8c64df6e406dU, 0x2975d945eef6a4c3U, 0xc51724346010063fU, 0x3401ee3b0f4ea557U, 
+0x4191bc5f2f7fb8bdU, 0x7bc464a15fe4090aU, 0x2aec24e6d94886d8U, 0x51397451339d90d0U, 
+0x8094ac2d83908c0fU, 0xfafc32d3e3f98d5aU, 0x4b88fefdae815c47U, 0xfcd7143e47643bf3U, 
+0xf2a1f83934889f3fU, 0xc4feb28b45095da7U, 0x21ea3469b169b0ebU, 0x87991026f1b21196U, 
+0x49e2df9bc3bb792bU, 0xe932f61bf286037bU, 0x2132f2cb717f279dU, 0xddeab94ca5a91d96U, 
+0xe2b74915ee36ca73U, 0xeac864d36bbbf3edU, 0xaa429112bf014887U, 0xcf8316d62bfbdfb8U, 
+0x5b4921942ec25534U, 0x1c961598d88d710fU, 0xe384450890dcca68U, 0x9feb58deb5d9d73U, 
+0xafcd9846bd9c8f0aU, 0xaf3e9f2c8bd84e64U, 0xc3926603bc03a87cU, 0x6e2114ed297ba44fU, 
+0xbd79148dd16a2c9bU, 0x90bec75d0f9595eU, 0x7da6d50f80c5d91dU, 0x5591a0cc26f06e2U, 
+0x3c8937d6b752f97dU, 0x5a2efbc75f347661U, 0xe539d28668cfa616U, 0x8610de9a4c4bb49dU, 
+0x8057dcd41f1b1af2U, 0x57ab4d9f545543e0U, 0x937cd99b2533f99eU, 0xd31997a02b630bbcU, 
+0x997fddfc60cb3e41U, 0x143d084f308b92c0U, 0x3e10cec0a9e98ed3U, 0xe7a26ce69dd4829fU, 
+0xe8a9421cf2cfd51U, 0xd0a6b2c0420e83e2U, 0x471b006a1aafbb18U, 0x2a758e300fa7984bU, 
+0xd97e5b917b4ae861U, 0x203c35e4d6e32fa9U, 0xd38bfb6772089f5U, 0xf5cafaba036bf8d0U, 
+0xcc9c239c0d82239cU, 0x9b3b2a9c552f05f3U, 0x7bff990464083915U, 0x19e83b8a022a6d81U, 
+0x70f9fd2bfaee42dbU, 0xd9bbbc5b4730714aU, 0xfc7b6edb91ecbfc1U, 0xcc3427e7d9b59150U, 
+0xc6229c0115d87bdbU, 0x10e5cbad8e72422dU, 0x885e3fd3fb215200U, 0xea249841a521c6a1U, 
+0x84fd4cd7bd2a9651U, 0x8f9e509c494c9820U, 0x12df5156d7e80542U, 0xe9389024ceb63f1fU, 
+0xfefde2b75e786824U, 0x8d7110cec6770bfeU, 0xf9287abaf671aaf1U, 0x8648688723726595U, 
+0xff4366c67ed4a086U, 0xb1d75c158e9c410eU, 0xec83c585fbcb5cf4U, 0x948f05bacd98445dU, 
+0xa2a1800f9e2bca4bU, 0x1c2328a71c3fa2d1U, 0x82f450a660113941U, 0x864ca89ffb5a2a33U, 
+0xcb0a71652e96e4f1U, 0xff5f01600ae80030U, 0x20177708335efccaU, 0x56bb148f0198197eU, 
+0x5889f019eeb0582eU, 0x7313d1d2004af0ebU, 0xbeb03ed8be30ea9fU, 0xa09584a561300a33U, 
+0xc0cbea6cb7542c21U, 0xae19f4d28ea64c15U, 0x656fc45451d6d43U, 0x2584196292919ac9U, 
+0x3bebe319672bfabfU, 0xf3e3a186e4c2ad7bU, 0x1e5daa4cc7513d5U, 0xfcb35b1f1cdb2448U, 
+0xcf2d41ae7cddab8bU, 0x9f0e4d1253c68e6fU, 0xed116900d82d0c37U, 0x264559d87829256bU, 
+0xc9f64b45001de473U, 0x7a8631af39caf1e6U, 0xef7bc637034072d7U, 0x79e5bd1926d3512cU, 
+0x43c461f40c1ecbf8U, 0x6489f0de9aeed7caU, 0x22a9754cc1e8421fU, 0x7e12cdc41373c525U, 
+0x9d45b8cdb0bed615U, 0xc969f61d8fe1d9f5U, 0x143f94dabe4d1259U, 0x71284f88888dc837U, 
+0xe2da28fb898a26c1U, 0x9a954fa17393b04aU, 0x6ea351579c26e1c5U, 0xb6a0c8fd373b52bbU, 
+0xf5550eda8a78217cU, 0xfc94a5e858ab5a06U, 0x9a901e3febda7facU, 0x5ef193bfda037494U, 
+0x17e6651c14557d86U, 0x1cfeec478e667ff4U, 0x772b91ca7a05a6cfU, 0x4b8ec2ff2a3742a6U, 
+0xbdd9b191b5167eb9U, 0x28d5f2ef0fc3f692U, 0x14a4072de527ac5fU, 0xfde6c3ff04c157abU, 
+0xa4c57f5981f23d1fU, 0xb6b25fd720c036d8U, 0xbd3d489e1fd8a0a6U, 0xb398e8153d670bbbU, 
+0x1583ebff832ff3fcU, 0xea791d8ad26156cdU, 0x7f7feb2fb00ba52U, 0x69f59c22572df47fU, 
+0x52b82d3b4780763cU, 0x5f8a6d5e9265691dU, 0x532436dc697ac07eU, 0xfcd5c10733963a42U, 
+0xb54e742038e851cbU, 0xb119b22e716463a4U, 0x3b720db35f72e38cU, 0x18ddabe2e5522c46U, 
+0x2b1c47a633e9fc8dU, 0x48b84809824f28adU, 0xa6cd0b2054631a73U, 0x634a0dc1bb425dffU, 
+0x9587f30b273f87b6U, 0x519ad5a18ed5c616U, 0xafe05a657de4a9cfU, 0xd75be21fe75a4b6cU, 
+0xbce3be305d8ef686U, 0xf68e48f402272e66U, 0x2238a5daf8266e53U, 0x900f2cee5843cbe5U, 
+0x73a4967e121a8cfU, 0x596cdff43c9156d5U, 0xd61c551b1349d110U, 0x732ac155ec60425aU, 
+0x3cf29eb3de6b80efU, 0x71cbcb967d79424fU, 0xd23540c223bcbdc5U, 0xb6459e0ee3662ec8U, 
+0xf30bf0b61a71ba45U, 0xc4b3ae6d48e35b2fU, 0xe1dadf16e5661db3U, 0x67c876d06f3e06dU, 
+0x253ef375033eb51fU, 0xb6890576be79c211U, 0xe4d36f7301f41593U, 0xe5d8e8f0d9823c88U, 
+0x79d5bd965a62a2d9U, 0xe509dc46d9f0f549U, 0xabb16a57d8feeef0U, 0x4dc1e9b7861e3e04U, 
+0x439cf279319888e9U, 0x3d12ba6bf2448a8bU, 0xdde60d3029668167U, 0x1f90ea773ac3a6e2U, 
+0x56fdfc97ef113b79U, 0x213751fee59522e6U, 0x958153d271eb96a8U, 0x89be367c15daa10eU, 
+0x37a676480f155e64U, 0xab66be4fa8a30117U, 0xc56b0f7321bae0ddU, 0xa9ca27f77dbc8c3dU, 
+0x1f3f333c561b3297U, 0x875d41821bcaf0aeU, 0xd197d2246c02d004U, 0xf4bb335678fb14d4U, 
+0x85efb6f3562222cU, 0xde03447991e6f2c6U, 0x6e702bad334b52baU, 0x13a4e54dedffe0adU, 
+0x8cb1668ca8200145U, 0xd4f9c577adc904c0U, 0xb2cac2f81d609a52U, 0xc9d67d4e5816e813U, 
+0x93eab3ddc1bf6c42U, 0xf7793d9b11988753U, 0xee74654816cee74eU, 0xd02e1b3cd6c105c7U, 
+0x1336328f87bc54ccU, 0xbca5879b931b6aacU, 0x12732270d0d24526U, 0x9a0b74f3ca8e2258U, 
+0x437e4dc0f43b46bbU, 0x12ed3a63fac92525U, 0x1d407c05d8455dbdU, 0x61991ebf233caaddU, 
+0xf48f5901cc20a848U, 0x1ca8729ca52ecd8eU, 0x952f387166fbadf1U, 0x1c5e308f3fde492U, 
+0x6d4bc629d6ee247cU, 0x1f478e847f51cee0U, 0x5eba105611cfe759U, 0x68fb71800686d7f2U, 
+0xae1f822d1a01865dU, 0x9a8d580b04c73c9dU, 0x73735427501b0c07U, 0xcd12d23462dd9636U, 
+0x7e5be3ddd21add3bU, 0x8b9a944f45727d8fU, 0x49039cdb0d162611U, 0xea27aea4b787d387U, 
+0x1b5e291db68ce7ddU, 0x78b212d68e4e1be7U, 0x5723ceb2325c2f62U, 0xc70ff1e6e42a17deU, 
+0x9345abdbe2da1f54U, 0x1b2b52c2231425dfU, 0x987550ab19345116U, 0x7137f7b23df260ebU, 
+0x4af8d436cdc3edbcU, 0xebf081d546cfdbb8U, 0xe5cdacb17f2600a7U, 0x5fe78ad804358074U, 
+0x6e8af8bb611ff757U, 0x9b4ce9741c4c226eU, 0xba9010f8b6e2b6daU, 0x594651356b7ffd54U, 
+0x28a66eca894d031aU, 0x961bbc7b7fbffe3bU, 0x42038d015c406f9U, 0x3611360ce5df2750U, 
+0xa1ef47f18f6c15c2U, 0x3de76414c8f38f1cU, 0xea17398139d14348U, 0x8456a852bca1757fU, 
+0xff1efc328b174134U, 0x4cc90f09856fb671U, 0xfd349ec371079e7fU, 0xe1b9da46d4842cdeU, 
+0x676258a3636160b5U, 0xccc53f2470e7ebc0U, 0xe843af7970091ec0U, 0x16b26e3915f73290U, 
+0x14625fbf58a1dc0eU, 0xe1363aac70ba3ef8U, 0xb6364352463654d4U, 0x60f565a6302ef8bU, 
+0x3d61de938e1b793eU, 0xd36aeea2b0d2e518U, 0x5c02eccf2cfaae4dU, 0x4f15157c98351ce6U, 
+0xb4fcc1fdc3ba9889U, 0xc0daff4b354a47aaU, 0xfc9da9db9cd4a0ceU, 0xc094e366079db939U, 
+0x3964d28937b32db8U, 0xc91ed749f647791fU, 0x1bea143c842cea85U, 0x24b5295c4559f93U, 
+0x59454faaaa64f760U, 0x62ab6811205b81a9U, 0x7b6e2821cc5e5be8U, 0x609fef8f5bff309cU, 
+0xdeda0f5b496943e8U, 0x1d6f1fc67e73c5a5U, 0x793234aa118f0623U, 0xd68a80c8280bb840U, 
+0x294c84266b133120U, 0x5b0e7b8f7845295aU, 0xc4b1f9177b0e28bU, 0xdb8ba9fff4b586d0U, 
+0x8bda222ca412b6fdU, 0xaced053c6f702b82U, 0x402f8efb3752373cU, 0xf16a409c677a40beU, 
+0x268dae77eca052daU, 0x16540659249ebca4U, 0xd7a6a75a74e30e4eU, 0x2a41311714532799U, 
+0x35b42aa18ca1c4f9U, 0x4f4efe34cab7e282U, 0x4c40b83da61f16f4U, 0x7815f78f22bd728cU, 
+0x9ab1ea36b778bc15U, 0x5cb42de61577d1e1U, 0x7dd93cf31458c35dU, 0xc1c601e8cd39af6aU, 
+0x5c1a0b6e326dd4e4U, 0xb89f4f2f6bed9832U, 0xfbe37f699976f84dU, 0x4154b506ab766f42U, 
+0x6c859295075ded1cU, 0x414ea9d9d1e22dd4U, 0x94c6e44d61025ff6U, 0x23ad075043c59888U, 
+0x6d26e1c3ee8c8530U, 0x512df681ef8f4d8eU, 0x6e377c64016a6c6dU, 0xc39273cda0ec4017U, 
+0xc4030f0f798446c7U, 0x50edfcbda2eed715U, 0x9d01d39441c31998U, 0x8c41be4257433c8eU, 
+0xbde4ce8b43ed5996U, 0x6831fe599360af53U, 0x492fbc903281b924U, 0x1a46b7e9fe99a4eaU, 
+0x2ee4ed11e8c85caeU, 0x508794a9ef52745cU, 0xe3ee084a063ebf5U, 0x683ce81ea3f1dc57U, 
+0x31f240bb237a26c1U, 0x166c6e58c0dbf6a5U, 0x27522431c1d03b25U, 0xda317447f58411b0U, 
+0xf51836ececf74d6fU, 0xd36836c5d7a81525U, 0xd2384167c259d8b7U, 0x753b97b87f5d8c69U, 
+0x4c51a7a63f7f0246U, 0x93e86e49fc727ddfU, 0x80a8d4d0b5956eaU, 0xb73c652769cc95c1U, 
+0x597e5164ea2a407bU, 0x1a0d72e4c6e554e5U, 0x4b535893c5b6c1eaU, 0x9a67db107174ca9dU, 
+0xd2b628a93739dc49U, 0x239392da66f55603U, 0x1064ac508bff231aU, 0x6a4be6cb02af0e6cU, 
+0x3e6a2b9df2edd5cfU, 0xab7e2b4cb14a4a4dU, 0x7dc166e360fa8058U, 0xf15d8faa2a890759U, 
+0x8ad9bf9dd8f8fb8cU, 0x4cdc2b9baa5bde14U, 0x9512facb5c730111U, 0x3659ba7060d8200cU, 
+0x75e46b8c7cc8a3d1U, 0x1e142ed4e44bb135U, 0x139725f8ec74987fU, 0x4ee7a9e806e01a17U, 
+0x98be8a0c46987facU, 0x8bc90f8640a86f67U, 0x44e982603ec98a3cU, 0x1f7c69f13ae7f13U, 
+0x3f91e73819174c68U, 0xcb7f5de219f6bc26U, 0xe5b1036e329ab6f9U, 0x9d4ecc3f36fda22dU, 
+0x1f4d359cee2e607bU, 0x88aa1eec6c0f36aaU, 0x20d111f5657fdd2bU, 0x7733f67fd31772cU, 
+0x6a2f311dcc614763U, 0x89e3bde05be017d2U, 0xeae63a8c5bb156f4U, 0xfd9fe8fbac178285U, 
+0x1d33a1bd76daba4dU, 0x9c65fb0e20319626U, 0xcb7062edd8fa2bcbU, 0x557e9401761fd381U, 
+0x51374a1bb7a52316U, 0xc5e9b8f5fa43590aU, 0x46d35cfa15ccbc86U, 0x7a7e8f3a601fa7e0U, 
+0x6e22d9cd3c05fbddU, 0x79589d5274e48139U, 0x38920654b6afa032U, 0xe3e4750a00310c48U, 
+0xcba2231d1535b883U, 0xb46587bfc5cfaffbU, 0x5235049961a1204U, 0xfa79701abad2590U, 
+0x38f52ff29f5341aU, 0x9cc7a32c669636b8U, 0x3b29d40ea7b10141U, 0x3adada82199885a9U, 
+0xb51580936586c6ccU, 0xe9d6d2e5b45e8fbcU, 0x552e35bf36ab1017U, 0xbfea1e228999369fU, 
+0x4095980fc28d3d5dU, 0x9612aeb973449ceaU, 0x52dc0270907a30b0U, 0x324aed7df65c8042U, 
+0x967224af96ab7c84U, 0x19213b0c7e332843U, 0xf130c0c35aec1f4fU, 0x648a365774b61f2fU, 
+0xa8f38381b2919749U, 0xf72b3e4a8de0db1fU, 0x28d32681880d7203U, 0x32c9331ea26f4902U, 
+0x631e97b0f290b5e3U, 0x268a4abdae39ab09U, 0x695a2f02b6f3dbb8U, 0xd7cd272b34209cb5U, 
+0xf5c917582fd53ed3U, 0x163f74fb9da56cceU, 0x5b8f60b931df7c49U, 0x20840bd5996772adU, 
+0x87143fe51a7a7132U, 0x5487c47394e70899U, 0x487bd476a6bafac2U, 0xf2993497cec18243U, 
+0x1e1c22527b9795e4U, 0x69c161b6e1846b8eU, 0x4a02f6a70fec6b1cU, 0xeb292f3b3b983785U, 
+0x5b7e9d2fae53a0feU, 0x57131d7509111c6fU, 0x1696634af145835bU, 0x8c43c25a96eebe80U, 
+0xdbd2cbb588a35b35U, 0x1ab5d88a5c0a121eU, 0xbd13d029e588ebfdU, 0xe6b6bff60eb339bbU, 
+0xc57293db9c1007bdU, 0xfe3b6c9d3be999c7U, 0x266f43e3835961ddU, 0x1a5ff2bd3300d2f3U, 
+0xc48b8e292032f9a2U, 0xce566f50fa1fc6ccU, 0xed2374cb31ff8f63U, 0x25aac6bd9a6b2640U, 
+0xe76230a12b51d4f0U, 0x559883bbc419f3d9U, 0x16f32f54f4f190f6U, 0xf5a6c63ba644546cU, 
+0xd4ef8d2c0360dd3U, 0x47a8a836d850e209U, 0x88b0b8086e0ce3bbU, 0xe05317745be499b2U, 
+0xb2aecd913c24f87bU, 0x61b987de98103dc2U, 0xcd809582b5b6a014U, 0xdc1c3b71a5d92f39U, 
+0xaea39d5789303fddU, 0x4d71457f19d1ed35U, 0xe620d4310049fbe1U, 0xa65a3a01df3b5ef2U, 
+0xdad44a8d02e68703U, 0x86861d024faed3caU, 0xb8f43d8d90ed2c76U, 0x798ea0940cff5c6fU, 
+0x7c146662d098dfeaU, 0xfadcb3c92ea67879U, 0xe018e5d2a83a5e57U, 0xa8153b3a77886c59U, 
+0x8a49a9df6e6d892fU, 0xb1b5e0f742daf415U, 0x53d8db9c57853e03U, 0x2a47396461d060fcU, 
+0x61630d52d24c9489U, 0xc0aef4e6e14e4a98U, 0x9a27887ff6e9d528U, 0x6281bb15d9d567c2U, 
+0x9187f26b9df42bc6U, 0x45fd964dd321b3adU, 0x922738f456e9bbf5U, 0x2fd3c5a0908da865U, 
+0xa7e77a48bcecfa5U, 0x2a0d62da1b16bb02U, 0xdeb4695c638eda3bU, 0x4f05c3b30fecaddaU, 
+0x2ecd024a95d37b53U, 0x447ee431f01b48cdU, 0xadd63236159534b9U, 0x53a499ea603d426fU, 
+0x90131cba94445a7aU, 0xdf9535f081cf1ec5U, 0xb12f11b6c601c8d5U, 0xf82fefbc9f06c6bfU, 
+0x963ace18642a7a98U, 0xb51c83b64640d1e5U, 0x5503942c1940b4a4U, 0x94bb37bdc6fb6b67U, 
+0x461e7659084b96aaU, 0xd0298635522abcceU, 0xe26405e1aa3b980eU, 0xd9309ab99f67a91bU, 
+0xf26c4f37c2b28a86U, 0xd3b6c9fbafcfe978U, 0xd7e10f066274cb5fU, 0x6ef99b2a9b4ec557U, 
+0xf6fdd42b16b7d2d5U, 0x2637b84d1d56ea66U, 0xc830f3d322ef502eU, 0xa285abaa97834203U, 
+0xc405d52f9001f99cU, 0xd8657321b6b753e9U, 0x92b952dfe10b2e2aU, 0xe56e9692cd1b7ac6U, 
+0xcf7b8d059f8fcf0eU, 0xd65b6ffde7c4a6faU, 0xba9c3446deaa3411U, 0x7d587ca138562d35U, 
+0x501c1a09d8bc9459U, 0xc463900ad323780aU, 0x2723400b6cfd6ad0U, 0xa7295c0388304c61U, 
+0x8e8bd373fd054c96U, 0xeec4143ba8d1ca88U, 0x6d51dfdbe5fee5dcU, 0x4df9c14919cde61fU, 
+0x92ebac06cad10d5dU, 0xb5d506cdc2884901U, 0x50974c23a1d85d4U, 0x35ec51092d8728U, 
+0xc0c6b0fc1da49e04U, 0xe9de4554e57a8d70U, 0xd25317d4e4b87088U, 0xed32cad8d2cc998cU, 
+0xb63120d17c1db9e0U, 0x52da9facb49fab7dU, 0xa541ca375859d20bU, 0x129fef5f1d030204U, 
+0xf4f225da5def001dU, 0x21f9bbd6989ba27eU, 0x20e0bd1c09e3b64bU, 0xa549a32db27e2cafU, 
+0xdd5db1a7f0624783U, 0xeb141e2a62c9705aU, 0xdf4cc30ed8a59456U, 0x799b7a7906d966cbU, 
+0xcb7418d4e883f855U, 0x28c36dcb63c34016U, 0x8049e4111c70366eU, 0xe821ab724d6360f1U, 
+0xed4e0c6a59852ddfU, 0x8b3b19c614ec23efU, 0x67d0d4115416cf59U, 0xadefcbf863f53ce3U, 
+0x5aef1e5c52ed4cbU, 0xc954defb3c09ec5aU, 0x23f08bd983532e6eU, 0x7e798f30da07ecd1U, 
+0x2571660794bb9462U, 0xb173571bff9f37a1U, 0x41a9549def2f057U, 0xd23dccc4a24dac83U, 
+0xa24778ac4206e37aU, 0x4d8c18948c504731U, 0xcf4e83f46b5a274fU, 0xb526ab87f2868002U, 
+0xbf3678fff0c5ccabU, 0x28ce539b00fa392aU, 0xd5caaced60a6f18dU, 0x641f35d778100d8eU, 
+0xfdf3a0fbd3630834U, 0x8463f12863dac067U, 0xad5b9e96ba8c8108U, 0x224fa20031514783U, 
+0xcd3c4737c47a2272U, 0x3d62924ec0a50f75U, 0x3c4b70fa391d09f5U, 0xbbe54e32bb3eda5cU, 
+0xfbff59eeb441742eU, 0x2f14a547af3806e9U, 0xf455452fbc9693a7U, 0x3f0d8994e51ad212U, 
+0x8c65363bcfecadbeU, 0x1e205e2c3ad13d95U, 0x45e5cb0e847a6e0bU, 0xfbd76c23f28c3dc4U, 
+0xb67649d1583c19d7U, 0xbbbb5e45ac2cf57bU, 0x129a25cce4228ef2U, 0xc2d4a0cc600a39e4U, 
+0x72f28b82c507928dU, 0x26804a8317345c97U, 0xd4183b5f7f41260dU, 0x65ada0f9c0806294U, 
+0xa04541e55d848116U, 0x1cc9b100fc9e27bbU, 0x5072ce10e948454U, 0x1693799abb39d3beU, 
+0x83df66c2027198b3U, 0xc03193e5c4d992e4U, 0x4e6af60f16c60deeU, 0xc49c433b9cb2d8c5U, 
+0x84c80ad4bc940c9aU, 0x13cf3ce13af42330U, 0xe5585e2744ddc21U, 0x2ec22a7ec305f319U, 
+0xcd194fd9851e7a4dU, 0x12405183d9a35bdaU, 0x4c2e24f5029c7febU, 0x8b1da468de337968U, 
+0x7e93831eb9d9123fU, 0x29fc791b1f88ba7dU, 0x2f95f8ecafbd1e91U, 0x341b538f72aa6a6fU, 
+0x19ea0aaf18bb9a40U, 0x72dee6a7052a26edU, 0xba6f2f041124d9acU, 0x5858124719c1c59eU, 
+0xaa70ee5fdd683eebU, 0x3e36eb38a08d3133U, 0xab1af6525084b8f3U, 0xafc669738f9a8cecU, 
+0x91e29cab30cd4509U, 0x570bab5525eddfdcU, 0xbc359c7fca239c16U, 0x2c21976dd22752U, 
+0xa7d07b1cc7aad77fU, 0x6d4ebbdf0f5a7b7fU, 0x3284afc3a7699670U, 0x4f0eab3ec68eb8deU, 
+0xe6c3f11dcce6eea8U, 0xadaa078d025ac92cU, 0x5a08de3062ac2f28U, 0xb28ea27176ebb757U, 
+0xea201f87b76f4293U, 0x10e978b5653c5139U, 0x121bc8cf370b282eU, 0xd2557b5a9f343309U, 
+0x1db187a25282740aU, 0xe34b6838de405a5fU, 0x12682f06eb4ad21fU, 0xa787b34355e427f0U, 
+0xcbfc99c8ac1f98cdU, 0x523489054d7f0308U, 0xfaed8a9c1cc66021U, 0x9c3919a84a474870U, 
+0xbe7e5e03d4fc599dU, 0x905326f76c64c8e6U, 0x584f044bf260e641U, 0xddb84f0f4a4ddd57U, 
+0x435efb7b694a09ecU, 0xcd326a53e8535f0U, 0xa42fc69d5c92aa4U, 0x2e3c05326255d80fU, 
+0x2534868188c7327eU, 0xe048a53c707b6651U, 0xbddae240b82fc1abU, 0x1ff891656c6fb5U, 
+0x17b98d538fb64db3U, 0xa7ede4ca39dd5384U, 0x40bbb83fbe53b8d6U, 0xc114239229bdccb7U, 
+0xe230ce9ffc0259beU, 0xa87580904d4567d1U, 0xa5cecde4fe978bd1U, 0x1237f6dc5b486fc2U, 
+0x205f19a2ab9c7ce6U, 0x33710316a1908934U, 0xae15fb7e3e24dda4U, 0xe8e2a24ccfa41587U, 
+0xb2c01eb68836267cU, 0x6e09e603b5c27a73U, 0x4caf2b2b3bee2059U, 0x46c983ce0c6f5d1bU, 
+0x1eded83403081e46U, 0x3a52218c554559eaU, 0x82d9c2c19263471U, 0x6c5b4bf831a77224U, 
+0xed1f9cb80bfbcd70U, 0x41d0cf826ac22a62U, 0xb2347863ce2be478U, 0xcb0513714926d42fU, 
+0x80832addf11349e2U, 0x60e3ecf417524c05U, 0xe62147e9a41ad78dU, 0xf8058324c6b9c2e7U, 
+0x5fac469e5b2025fcU, 0x509498b5626de88dU, 0xcde81aa60ea11223U, 0x95c60e5a0a8856cdU, 
+0xdcae5aec464dcd4bU, 0xc30c7d59911c124U, 0xb5670665cab10a45U, 0xe1e9a856670cade4U, 
+0x2d0b625ebb041f2cU, 0x7f44d19aaca16b29U, 0xb7ac43599b257792U, 0x562b0a954455c531U, 
+0x5b0d39668ac7b3c2U, 0x12acaf92383d5b5fU, 0xb2f0a38b170032a2U, 0xa7549aac5d8573c2U, 
+0xfa0c91719287eaefU, 0x5d6b5115537116dfU, 0x335a1d70c1947d2bU, 0xbd17d1b90d1c2415U, 
+0x5876fe2badd73cU, 0x8fd9cdd902a64b7dU, 0x778a74e42edc1420U, 0x51b21a57ad11b099U, 
+0x6f7d4ae1eb36d8d1U, 0x6c20130f28c734baU, 0xd54a07f01d2c1cfaU, 0x793010001fd3e5U, 
+0xab7dc996bd7e2c95U, 0x6f3f2ba14b878d82U, 0xedd9a12a8ac54157U, 0xca07cbfbb24ad1a5U, 
+0x5e99bac8d50dfa2U, 0x3ac306f33b7e0cbfU, 0x4a8a2267bc1066c9U, 0xaedc311032df0edfU, 
+0x6d75d0b73b09f34bU, 0xe58873e608cc66ceU, 0x61ab6296f3f39d61U, 0x9701f3a63b1cb798U, 
+0xacdc850cc0df5793U, 0x7104bc397fdcc794U, 0x5d7031b531568337U, 0x3dd44bbb8caf0ed1U, 
+0x17371d11ae548418U, 0xdce4887d88983923U, 0x2fb072b0537a341aU, 0x2e6db0c9e4817e29U, 
+0xe69792c010a2b918U, 0x4b8e1d73e1c3f5f1U, 0xa213148978a91164U, 0x74eb6a411d776fbfU, 
+0x15ce6223bf1e2f46U, 0x5270f71e87277830U, 0x445592e040d63c57U, 0xa036b41d2c9e66ccU, 
+0xf731e2695effb349U, 0x680e282cff0b1f4U, 0x7df1f6aa479eb08dU, 0xc3bf91a003e96b3dU, 
+0x960551603db2a09U, 0xf6314287dc201bbfU, 0x2bd638800a766da1U, 0xb09dcc04d9c30c35U, 
+0xaed7db3a80b1a093U, 0x6a951bd4c16ad4e7U, 0xf708d1635aead00eU, 0x8a7f306481cf240dU, 
+0xbcd8b9038c4cea08U, 0x654b58ba0e0ea21dU, 0x6f4a611534004652U, 0x6a85fadbaa4e8c50U, 
+0xa19dece59862f4f3U, 0xb4271a4b43d721b6U, 0x531933c148fe6230U, 0xb64604bae4659dU, 
+0x5a21382120a959e5U, 0x91e1493a8b91d4ccU, 0x8de05f281d8e06bbU, 0x6057170b1dd12fdfU, 
+0xe899be932385a2a8U, 0x465152bc3ee24c65U, 0xadd9a2daf71df262U, 0x9a1af0b26a6a4807U, 
+0x1899ca5d82fd545cU, 0x7c133f8dd4a28e66U, 0x394110a46dc85dfU, 0x6773fd677c52e064U, 
+0xe8c7f034947eb1aeU, 0xead780f5a1c6cf98U, 0xf0f25c9dd2b246bU, 0x444eb6d8cd97652fU, 
+0xd4da162971c032bU, 0xff6b668a17afdc98U, 0x3dd11b5fdfc766c5U, 0x71eba8fcd6e00260U, 
+0xe7ab5a8e1668359fU, 0x71931ad1774b4755U, 0xef660516f54cbb7fU, 0xd2ff12624b61d39dU, 
+0x373c616b0b86f021U, 0x374e43810468050U, 0x237c79aace0c87c2U, 0xe0f86d94d17ce565U, 
+0x3b6b79ccb5bf325aU, 0x9a80bcc0115fc45bU, 0x7a91e832f1c89a2cU, 0xc571c73730abcf4U, 
+0xd06e47452a03a61cU, 0x507868f469070574U, 0x2ca17442baaa9dd0U, 0x855ec305b3249d23U, 
+0x5dfc6eaac65dfc07U, 0xd332f74ea17e4496U, 0xf543cbff9b42fb4eU, 0xdd85d2ec5f01c17U, 
+0x6df0d9f73aaa138bU, 0x63efba0bef786cd6U, 0x7943ebc18c4671ffU, 0x417fe249d3c3ae28U, 
+0xd1c91b334a1ae869U, 0xc19dafdec05566afU, 0xc20a5d29f0fa9e57U, 0x23589d7bcd23e38U, 
+0xb00c0a481f32d706U, 0x618cca4746a0678U, 0xf150d29a3095bfa2U, 0x3ce4486abab3fbf1U, 
+0x40b73637fc7fd9e4U, 0xedd15643cd61e89fU, 0x88efd046b1094906U, 0xe775408daae37852U, 
+0x8ad0772c02da6e03U, 0x4c277df908cad603U, 0xce991e193d696f4fU, 0x42ca15ab9f245041U, 
+0x836889fa8c347793U, 0xd66e85a68106bea7U, 0x647ce4d1fcb800eeU, 0x68d2ef26c81c57c9U, 
+0x6db40cbb791cd3fbU, 0x4a2a33fd9729be68U, 0xf02e03218f8844ebU, 0x11ccc5143f4e37faU, 
+0xa93716ba55160d86U, 0xfa0b1efd2cdd3472U, 0xb528e244938cc239U, 0x4aa56b2a902b11deU, 
+0x108baf0429583a3eU, 0xb15205998b156808U, 0x57275dbbed94871cU, 0x5889573f16d0f7e5U, 
+0x8f1598cb7e5b124fU, 0x96fe294cd4cc69cfU, 0x44f5df8a9a6b4e4U, 0x1afa2862c55856feU, 
+0x387b9119618f7552U, 0xbd41138b98054facU, 0x43b97774f82382ddU, 0x250bb17e5149c6fU, 
+0x3f0849623510b14dU, 0xda006f3c333d6f1eU, 0x342d7df75fe9d817U, 0x731930fc9bbe8082U, 
+0x7e158b410307e636U, 0xb4a77de7321611d9U, 0x3ddbc29bda2112c8U, 0x2219f16016387644U, 
+0xe07a1b2d71f15109U, 0x6dd7230d3f73af55U, 0x1b806d4f1b8230bdU, 0x4a984ac5cb6a2f6U, 
+0x5d13e939f725d12U, 0xd94642bbdcb5f475U, 0xab4a39ce0a022fbfU, 0x1a749c88b3467fd3U, 
+0x136514d23ac56e4U, 0x607208698990daa7U, 0xf458be75c2af3d8fU, 0x7e91d19573ec0e2cU, 
+0x5d22d670b6c704c0U, 0x56044660ecde394fU, 0xa167f8a6e3507824U, 0xa77aa907c92f2674U, 
+0xaf8bc7047edfea48U, 0x4c921fc474159462U, 0xf21e188e5c2bd5a9U, 0xb8881ae5bf35cfe4U, 
+0xd61048e529fae458U, 0x8b0a5c42766ec97fU, 0x109d156a5dfb7b32U, 0xc750685be0f8218cU, 
+0xb01684195757b598U, 0xa5dca50335951a2U, 0xfb52f414c672c7b4U, 0xead795f8cf921e05U, 
+0xb1a6973eecb94266U, 0x80cef0fba7d4df12U, 0x421439a4518da318U, 0xa576df8e23a08411U, 
+0xee8be11ae1b28ec8U, 0x432e10a7f514d9f3U, 0xc92b97afe58cd82cU, 0x40a6bf20e76640b2U, 
+0xcec5725bda704896U, 0x6f3ba063c9acfb8dU, 0x546520867be71baeU, 0x9e5dcc62ef3b5a3bU, 
+0x48f2769dca82c835U, 0x79605d186030f512U, 0xa5fd3a2154c76122U, 0x6fedd12ddb925f3eU, 
+0xb68aeb58cd9ed6c1U, 0xc24e745bc3d593d6U, 0x80bfc187705edd0eU, 0x328336dcb74f53eU, 
+0xdec6ebe6f8fafeeeU, 0x265bf4df25cb494aU, 0xc46d5943a20d7c8cU, 0x71a8983812fd9f28U, 
+0x953ed58744bf7ea0U, 0xe33625a05cef5833U, 0xf8d6e9f976f03b20U, 0xa7de08375b8745adU, 
+0xe04c05539bbcabaaU, 0x645a47c0febc5aa2U, 0x2104a0b334888e9aU, 0xa63d96b057ada5e5U, 
+0x919a9a8d3235983aU, 0xe38a1037013bceb2U, 0xdc63926d70fe1531U, 0xce4f4eae8b911c54U, 
+0xecfd6b190d3cdecfU, 0x526c65228ebf740aU, 0x3eade0249e707543U, 0xf3c9f973c390fbbbU, 
+0x6b75648a66da57e4U, 0x98c4996efdcdd9f8U, 0xdbdea2a74631bc1eU, 0x690cdae3983918b9U, 
+0x2b6195b4933f33bbU, 0xf863d8fbce95a3d4U, 0x7a9fd91bf595894dU, 0x840adc79677b79a4U, 
+0xa6daab6655b0e6c9U, 0xdb5ff9cf786e4c89U, 0x78e28fb36df8bcbdU, 0x4dbebfa54b986222U, 
+0xe94a78555eb2cc25U, 0x589311b2bc504efaU, 0xf45a626e6e2229f3U, 0x10fee7b03c913aedU, 
+0xa9f8fa104ad916fbU, 0xe68065fde949e4a3U, 0xc13c35ac01cff4cbU, 0xc266658e689080c9U, 
+0x56aef52ba0887814U, 0x6b8fecdfeb611388U, 0xf798170b24627abU, 0xe7e8593854e7daabU, 
+0x64e01a11a5857295U, 0x69c8e47f03433f01U, 0x8b2e118fca1ca120U, 0xa42a240bfef45c21U, 
+0x56b377feca7eb9c1U, 0x27a1c22cd1519395U, 0x67a6b22b24dda4c4U, 0x3aa0b3f261005d45U, 
+0x269bcfd6005c5b40U, 0x150b96879bb9fd1eU, 0xdaded382e8ccc3dfU, 0xa4b53cc8bf53cd14U, 
+0xd1f5ed16d1c61bfdU, 0x199cca9bf75259e3U, 0x4495ca003dfda587U, 0xceef08ce83005b80U, 
+0x2220ff556fcdc098U, 0x550ae00f6ae46803U, 0x7a7f1f86c0c499c1U, 0x34e12b2f96fb2226U, 
+0x64cb1ade6a7474e2U, 0x4df5130f19883f6U, 0xd974cbc8417972dbU, 0xa64ac2ddd7b5d322U, 
+0x5f9898aa5cfb8036U, 0x3ad09a92c0da3508U, 0x8ae117dd1fd67e83U, 0xcff62751fb1647b4U, 
+0x843f3b5a24f59de0U, 0x78a589d8f6032825U, 0xc5fe34b5886143c6U, 0xcdf4ed26bd542d1aU, 
+0x1cd6eb5e8f173b92U, 0x3b7e72f4169fb761U, 0x9be31a218f4d6568U, 0x10f4d240d9bb91f2U, 
+0xc902006d633146c2U, 0x90bb769d1486adb7U, 0x211b25a5a33908baU, 0x850e2d95091753adU, 
+0xee6660edd04393d7U, 0x869dff2567749de1U, 0x4317f893623573e3U, 0xdea1fc018a78f3b8U, 
+0xbf97d4ef95710ccdU, 0xaf6def9a2b79ccbdU, 0xd3bf134ff6d66e03U, 0x4f6549cc942e5c50U, 
+0xee6fd1d9a8d84958U, 0x6a11deb16cacc5caU, 0x49f19b976d40cc86U, 0xe846e80b69b677e7U, 
+0x40c4647b7882cf9fU, 0xad51a33671e0c1a6U, 0x41dbd9104798b76fU, 0xa29cb8fc894c7e25U, 
+0x8f763889be58ad71U, 0xbb30d1f5cf9a3a20U, 0xa05fe9629de8c38U, 0x7778a78c28dec3e3U, 
+0x3b513fc1fd9f43acU, 0x87b38411ff24ac56U, 0xf7098e12f2ff5800U, 0x34626d9ab5a5b22fU, 
+0xa7ea1c251073e879U, 0x2cf16a5ae104eea7U, 0x632f482d7f0fe393U, 0xe7b9796b5ca006d1U, 
+0x38e71089baa89d98U, 0x9cb5bf25eda98af3U, 0xdf42102a737cc1caU, 0x12b8988c19169e2fU, 
+0x2f7c6eae3319c869U, 0x18a9f95d761eb270U, 0xd01839022fccacdcU, 0x3018045d98173fc8U, 
+0xfc0c76c9d2b856f0U, 0xca2a84ca4a3d9a7bU, 0xf86624320d622e3bU, 0xac5fc5782503b7b6U, 
+0x865d722bf2628f0fU, 0x65423daaf2aee919U, 0xc2c915a24be09a73U, 0x71bf01850876203U, 
+0xb57c5cbd45a1c334U, 0x98f9c6a231c80bbU, 0xe33600bc1c084ce2U, 0x527aa15d504dcf4aU, 
+0x4c66986fa5ed29b5U, 0xf5830b60712add1bU, 0x43ab67db9a63c885U, 0x322881b61ee57ef3U, 
+0xef4f126e7cd15ad2U, 0xca83aeab94ee7604U, 0xb110b19df41531e1U, 0x1677028417a0344eU, 
+0x6477dc9b18953133U, 0x7fb3b42a748721aeU, 0x8812806c0fccdfa9U, 0xa0b2b4fed0ddd23U, 
+0x4bc24a3734af0fc9U, 0x6fa384e8b0ed4ba9U, 0x3c1c6ca86458c8dU, 0xcda1182cfb5abf2fU, 
+0x3bfa840786c96100U, 0xa163011aa6e9c8e6U, 0xfb43dd9b2df3dbccU, 0x3f38473ac0fb1b9fU, 
+0xf1e2ac1bf2624707U, 0x66571c7c0b75f1bcU, 0x2534c4462f079ce5U, 0x70c69c55f5d40395U, 
+0x6f6376dfa39620e1U, 0x5b1911c850121378U, 0x33a32e594c03c39eU, 0x218343acb9be568U, 
+0x5e0199f6506998b5U, 0x443299a42f43c9ecU, 0xaf3f24fd602fbfc0U, 0xbea81d48970a50beU, 
+0x234c6ec6fd22d2acU, 0x10ddfe126dcaace0U, 0xcb43c0e09785df2fU, 0x288113c5fd27a76dU, 
+0x81eb55f8f42a268U, 0xddc3d44a1548c8fdU, 0xf20777260c976137U, 0xa1a7eb0158fbc5c8U, 
+0x8c1a13aefee515ddU, 0x9d045323343aa422U, 0xef5866ab4bdfe2eU, 0xa2bf9afee6eec182U, 
+0x5c3a96b006c30212U, 0xf2e3aa9a8e9874U, 0x3a0a5e2abc05ea28U, 0x5a11bc71c55cab7bU, 
+0xd4ba80dd245f8ea8U, 0xd17248e3964d2900U, 0x553f4d95d7119fe5U, 0xf963a200c8463a2aU, 
+0x4bc55fb059bc99ebU, 0x8bb8f2359d8b6082U, 0xa3b722301ff42720U, 0x9c8594268c7f83c0U, 
+0x7eaf0ec0df0a2a53U, 0xd51dcab3f816611eU, 0x3a83945743a9b892U, 0x6f86518d07c3997cU, 
+0x1139a574733bfeb2U, 0xbf54f772eaa05f35U, 0x9b776ea95a709968U, 0xd50af616fd4582f2U, 
+0x9e1a88312606a315U, 0x40726072f26963adU, 0xf98d8b2a590e097eU, 0xa5d9224cff70d9a7U, 
+0xd35613359e3b68d1U, 0xed4d0d347d11a7c9U, 0x343306abd7980de9U, 0x87328b003b20da5bU, 
+0xaf19eaf4d8d52891U, 0x39a0f7d883eb9f52U, 0x46644de90b17ffa7U, 0x3bc24bc9cbc58de3U, 
+0x386d1e284d05b79cU, 0x4da845280a4872d1U, 0x7febed840bfb48f4U, 0xf08e30a48a783d8aU, 
+0x9cdb7b5406231493U, 0x96411a830ccc4d46U, 0x4eb4e41d00e5e6a4U, 0xf1fe982e1b73c360U, 
+0x196a99a6758848c1U, 0xf173fb346e5ff0d0U, 0x216d3c205f7d99d3U, 0x2e2019eaed9a4ddcU, 
+0xb09eda9c06d903acU, 0xd5f96274e5ad7e5cU, 0x63729fd30e7afd2eU, 0x928955ee637a844U, 
+0xc5180e935bcd091fU, 0xac3d26efa8a8d83fU, 0x27b78a13093a95eeU, 0xc25621003d3f42a8U, 
+0x231047a60f59dd9eU, 0x7ce5e9c55b58f0e7U, 0xdad163b04cb18ad6U, 0x4f89bdee3771d350U, 
+0x1016ae320156b049U, 0x1e4882506638df5cU, 0x5c4baf4c043bb247U, 0xca7952d5227a1f69U, 
+0x811128757874b839U, 0xbe4115b3953d2b41U, 0x53df0dfb230b6aeU, 0x3e03b81fc0e1e5a8U, 
+0xa0c1ce567c0594baU, 0x7de5c5f0fdab5b8dU, 0xc44f660757198f66U, 0xd13ae163dff07f42U, 
+0x529c314cfff01197U, 0x94b668f079a245bfU, 0xc396baca2c3c4c9U, 0xcb9e8304cae3c5a8U, 
+0xc334e0763b989c1dU, 0x41b2d18c015e0a24U, 0x127258cdff088917U, 0x62c7d2801eb80e6aU, 
+0x3a3f78e68357a513U, 0xf151bd1345b3023fU, 0xd62fa283aa2922c5U, 0xe662c0b7a2f4492cU, 
+0x192a201ca017d07eU, 0xd8035cd625538d89U, 0x5dae208a121a419U, 0xab0b193ce6124523U, 
+0x9bae90d3b9a7d197U, 0x5e83a8c188ea5945U, 0x4778ffe0a22c234bU, 0xc2c58a54280df639U, 
+0x4e41ccbf89eeb5e9U, 0xa47ec4545ad8248U, 0x573041ab62ed39a6U, 0x72ea3288366e0927U, 
+0x4995f7efdf37d242U, 0xc29feca6079c14b0U, 0x843862c7cbe3587dU, 0x40bf80b1c94cf6cbU, 
+0x3d1d8279a6405088U, 0x74321eba42bd3558U, 0x4f53fe9b1b26fe12U, 0xb579dd35d856aaf0U, 
+0x15f9ffc2508d2cc2U, 0x8e0beed47048c58cU, 0x3c8cf2a410730dc5U, 0xe2f349b0f89c69bdU, 
+0x7e347bd8e0d4c04fU, 0x42344be8e09cbdb3U, 0x81860aec760215baU, 0x1feb2f280f827237U, 
+0xbaf2b364595a3558U, 0xac071f85e234a7f2U, 0x806f978138db59f6U, 0x3d14fe97601dca70U, 
+0xc6adb3ac6443df4cU, 0x82e0a2e147c1d727U, 0x8f29a931dbf56e14U, 0x16c6bdd6e84681efU, 
+0x10fc702414ea4178U, 0x782e0354e4c77cd5U, 0x680453c6a77494cbU, 0x470a872d1756368U, 
+0x79449f1b8098bd6U, 0x19b568706984daeaU, 0x676145e9fd39c0cbU, 0x899a7a9c1109acdU, 
+0xede9f5ad82b1fc24U, 0x2528d81c7e3f7570U, 0x1cc1ac4d2c924865U, 0xdd6fa540e82e6525U, 
+0x4a431c460e9b74caU, 0xec10de6bed732230U, 0xe366f1ebf1657e77U, 0x67e62b7eb1d3186fU, 
+0xd74de6d963369217U, 0xca1c3969006611eaU, 0xa21a278f5404eacdU, 0x42dc50ffcba4d624U, 
+0x1c3097e23e2dbc57U, 0xa7a139eca8e01e84U, 0x7ed78f5f160ba853U, 0xa5ba9a1f66385b1dU, 
+0x81ea91593dd08e02U, 0x108547b7fdadf028U, 0xf869499aa3d1e80U, 0x13fa2da82de55d78U, 
+0xda5541dc3cb03410U, 0xe644afbb19a42b97U, 0x313356206bb432c7U, 0x136338b04555da72U, 
+0x23f1ace91646a9e9U, 0x5dcbb7a7d8ae7b04U, 0x7d1f82bb9cca75ddU, 0x9582b79c4b0aef75U, 
+0xbc4d7493aa56a698U, 0x1cbb5c5f13b82ffU, 0xd4ec6aceeaf8e6a4U, 0x22067d800ed426eeU, 
+0xac233ab9944ee41aU, 0x879b56dd3b7d69a6U, 0x3f7c10b672c68282U, 0xd06c4851d3c70a44U, 
+0x2f1f84e98b295e6fU, 0x9b7b84346162ee25U, 0xbbb0acd4f4f63091U, 0x5815fd4c0584d0adU, 
+0x27aae75163d82751U, 0x5645b4a907ad3545U, 0x399064f3a0e3b285U, 0x85d0fef3ec6db109U, 
+0x82c237a24eb1f962U, 0x3e8751e968773315U, 0xe29d496e582cf566U, 0x1f03648413a38c0bU, 
+0x56356d141d5fcadeU, 0x68b482e009711ff7U, 0xf607a6cfcd11df04U, 0x6b790f4b19a4c4f4U, 
+0xb6fff86fc338d3ffU, 0xa83fa5b47be26b0aU, 0xf296661f9cae09cbU, 0xd03a981b2ff9eb3eU, 
+0xb9955061ecde4cf3U, 0x9340e535478a066aU, 0xbe7c2d26d15d9ae7U, 0x384dab4ac11422c3U, 
+0xb7c796b2252d0566U, 0x1f430a339751ba73U, 0xbfb4ed6da2b4c6f0U, 0xd6e3c5bcd1b9ca43U, 
+0xbb0ccdabe3a3e0cbU, 0x3d2479de85978be0U, 0xc162c367acc4f8feU, 0x41149b2c2d7ebed3U, 
+0x70e92e98339033a8U, 0xb3ec7805ef490f24U, 0x2b415c9b9902cf28U, 0xc90d5b92db7c3054U, 
+0x98af3e921e5238c2U, 0x40355f5c380ecb8bU, 0x41b1610b4e82ed48U, 0x14f0ec0eb7d415aaU, 
+0x6e86a34792f07922U, 0xd25c00d80304939dU, 0x921fc73e3842747fU, 0xab12d53dd4835d80U, 
+0x8a4366a08a972627U, 0xe192160402521e1fU, 0x8198c1efcbc441a0U, 0x8a31870949bfe15cU, 
+0xe7b47b5646bb8af9U, 0x1744365ac3efcbccU, 0x9577ed28587baa4U, 0x64bb7c8768f7a64dU, 
+0x8f6352efd543e94dU, 0xdd1302a756f98e18U, 0xc41c34678a5a0ddaU, 0xeb42f3bb782c287eU, 
+0x40559de445924d89U, 0x4cd8468de60d6d42U, 0xc9a0dd572fcdfb77U, 0x234a6d074f25d92dU, 
+0xf8dddd28e3f3d3fcU, 0x664a9b8205c29cebU, 0xfaec3dfe2872a7baU, 0xd1fad4fa4e7c849dU, 
+0xed22343c50f3704dU, 0xbad37131eff37326U, 0x5473f70e858b7818U, 0x8fe19714a348fdfeU, 
+0x324e5b57e19aaedU, 0x459bacde8c667327U, 0xa9eec02f6e06a920U, 0x1cf138ca516820d9U, 
+0xc136ea5d692f400eU, 0x479eef8fefc77ffbU, 0x5f4372a66b6dde17U, 0xd6ffdaf3171c6386U, 
+0x37473ba2e0ba68ddU, 0xbca7c9438c7ead65U, 0x7f266838c1dad312U, 0x5cbeaabfe2b7412U, 
+0x94229f327dd03959U, 0x7f3d96705de533b5U, 0xae9386665506efa0U, 0x13ca23b6fa90156eU, 
+0x5f6c0e9fb6a8aa39U, 0x37a6637b4a78fac5U, 0xc875a096849990d9U, 0xb58686be5f40d412U, 
+0x8fc7935d2b493c1fU, 0xabbdaf98e6db347bU, 0x149478d454c0a91dU, 0x5632d54324c78c2cU, 
+0x9a544c67ca3a1550U, 0x801da99f8effdf27U, 0x2dd30976e1f8b751U, 0xebfc69ab34055741U, 
+0x51f42bf641362f6eU, 0x7983c818e68c0b19U, 0xa3df199db7f4fd07U, 0xe2ffe8cdb99cb540U, 
+0xee91ebe3b03b4cc5U, 0x572831ba5a1c77c2U, 0x67b5bc4fe7f3a802U, 0x5fc19db06b8bcc2bU, 
+0xa3b39fb865b57c28U, 0x9276f503cc087ec4U, 0x6ee2138f9a3a5ef4U, 0xec8e84c0ec98c7c6U, 
+0x48bbf38e5e8d319fU, 0xe66aa5616d4418e9U, 0x1050b65337aac980U, 0x6ce5c350ce93a866U, 
+0x8ac6bd795cf513fU, 0x2da8f2e00ec53783U, 0xbed3e3e8cbbe23f1U, 0x950d0026e2503c85U, 
+0xbb4b857d4cb38cb5U, 0xe10b7fdf4d388948U, 0xdeba8a40fd3eea1bU, 0xb88fb70d42ede289U, 
+0x97bfa7565965f3d7U, 0x4d4f3e1227af8c71U, 0x6034bb994b35a8e2U, 0xd6c736ad46ea3280U, 
+0x8f5404824526087eU, 0xfdfb6d8882da2030U, 0xc1c9b6041798b85dU, 0xff2b0dce97eece97U, 
+0x2c951e01f0c29907U, 0xc7b7ed6fb90e2cebU, 0x8af4c4dc54d07936U, 0x493d13fef524ba18U, 
+0x3bd3a9af3149f8efU, 0x3deb5c4ee638b458U, 0x78e29ebbecb1bb22U, 0x2982dbbc5f366c9fU, 
+0x56e726b016c7a248U, 0x95db99412e3ed84U, 0xb9fa5339c7b5bc9dU, 0xa61b5be9af66220aU, 
+0xc59054fe79d681f9U, 0x66ce0eefac8feb9fU, 0x88b7ff25e02c94b0U, 0xc745fdf2775f2308U, 
+0x603173437bbb1247U, 0x8cdbd335c67d45c7U, 0x8a71394c70e81867U, 0x590222f2f6b9e5e7U, 
+0x85289f612380441bU, 0x60011f4580e17658U, 0xb436eb590497db58U, 0x1a28e5042af0c0f6U, 
+0xb05f606a8452af25U, 0x4b3e75b46ee67aeU, 0x7c78329a8976f0edU, 0x55779a7996c59dabU, 
+0x5e04ceed35cd0ea3U, 0xb34478e820cac481U, 0x27a59e5eb672e7f2U, 0xabb279f3a975050bU, 
+0x470931337c307bceU, 0x7c9769059e02f3b6U, 0x9fb4be0c03078ed4U, 0x5dee103bbf17970dU, 
+0xe77fd534649a2115U, 0xec79600917a565ebU, 0xdd46aca9d640981aU, 0xfd73c052b194c6c6U, 
+0x49cab7ba6ba6cdaU, 0x4f601562e9d421fU, 0x20abab026f7d6d9U, 0x620768c1c8178844U, 
+0x5c2e2f3f1bc9ee3eU, 0xea9fa1a963e7382cU, 0x27faeaa74267ed11U, 0x3f81150b59fc6828U, 
+0x3ceadb0c599aae06U, 0x7623b2dcfcda8160U, 0x4671beb3c4795662U, 0x19c88a68fdbfa82dU, 
+0x2eef0e39621e30a7U, 0x2edd5eb7985d8324U, 0x1d250cc0bd3f2014U, 0xc8b83e9535f3060U, 
+0xbebf7beb9ff688deU, 0xaacad237b987134dU, 0xb850e3f17efdc854U, 0xdcc7077065fdac7U, 
+0x6171befaf8e4a007U, 0x15eceecf08bb358bU, 0x9594ba33aa56c7ecU, 0x5cf8132dd0082de6U, 
+0xce63f0909068b883U, 0xc8946f96c79c7fe8U, 0xf4ad4158848c3df6U, 0xb45aee5c0d61fa0dU, 
+0x3003efcc4c3c18e1U, 0xba4ae5fbbaad7230U, 0x9122671104bac7f4U, 0xb3fa054583510d6bU, 
+0xcb11fbee12aa2b4fU, 0xaa55a499f10ce542U, 0x7ba18298064fe6fdU, 0xa85c24759340f56bU, 
+0x956fe7b26c2d4a7U, 0x1bc36f933bcfffb1U, 0x653e33973c404ed2U, 0xb6d5fe4d0d4ba494U, 
+0x118dce7e3ae86371U, 0x745b7e4e6f5e3cc8U, 0x4dfcf9209dfffd8eU, 0x47f373a13abbd6c1U, 
+0xfdb86c351b816b2fU, 0xee0cb7841228ee11U, 0x6e8165fe126c5d5dU, 0x5a4d46dd65951a67U, 
+0xaf97aeb873e86c60U, 0xb50e6cc5fb3eccebU, 0x283e27f8f3dfcd6U, 0x77c92396ca0e60abU, 
+0x50933622fc66dd33U, 0xea8fbc8ff1dc76dcU, 0x6bb1b150029b022U, 0x61c8bbc066cf5887U, 
+0xa3bba9f3b6f10bfaU, 0x6a5106eac2820c8cU, 0x44669994b985d3fbU, 0x93599e239e54f703U, 
+0xfce648cf335cacbbU, 0x18ac3028bd635b26U, 0x7b977e5bdc622671U, 0x4fd699b12c720ccdU, 
+0x33b2efa88e1ad839U, 0xaa998eb2e8223e61U, 0xd9479dbfcdb61e2cU, 0xc6c90ef3f511a0aeU, 
+0x9805b7ccdd6b2ff8U, 0x876336c17286c8faU, 0x87c9f5373ec3bdf1U, 0x94e32ba574267851U, 
+0xadd485552ce1af3eU, 0xb33af042526bfe13U, 0x92f1e488662d9e8cU, 0xd1b448b43da04e1U, 
+0x780e5e2cf856e241U, 0x57f1ee148cd6dd28U, 0x9ed2b2e6301b212bU, 0x827fbbe4b1e880eaU, 
+0xd605b68baec293ecU, 0x7ff7a63186903166U, 0x71bef2c67d1d1268U, 0xc60f9c923c727b0bU, 
+0xef6e44b70cb1815dU, 0x60470a9218b87461U, 0x3e2d7c8d576e6b36U, 0xb77f12a7dce56b97U, 
+0x6ba3d2bc8e57dbc5U, 0x4c42f0f91a44816dU, 0x3f0cefb373cc2e65U, 0x4b6f85b14f86acc4U, 
+0x634485cb3bb80fa7U, 0x3aa7da6bb7041388U, 0xc0d1a06bd320819fU, 0x857e31f6308c2fbU, 
+0xbd98211f09366b2dU, 0x172e37043cd7016aU, 0x92d7cc9d1dcb7147U, 0xf64393423ae01720U, 
+0xfe5dad2c45565ecU, 0xd858d8df4977c597U, 0x47b308b2cb79f956U, 0x48973b943018bf12U, 
+0x3b879075faed07e9U, 0x511b3596580477b8U, 0x6437bb3a01445af1U, 0x761f75684f3cdc1bU, 
+0xf5d02c3a09c70e63U, 0x9cbb8b78e753d496U, 0x3545c655764a672eU, 0x28aaccea56bd6004U, 
+0xb9f03882f057da4eU, 0xf5fc59ce444da1e8U, 0x67a89667c768ebb7U, 0x2b69322ef81a0e15U, 
+0x33a00abe7b6d6cd3U, 0x3416611d03893788U, 0x81a69b8705652397U, 0xea1266167f2b8184U, 
+0xaae62925f4f450beU, 0xb1c9752debbe1a88U, 0xaace112bf1145e25U, 0x21a4e2e5078ee3fdU, 
+0x601dc52f73e674b5U, 0x92d8f69ce7060aacU, 0x45ddb2c9bceb8a4fU, 0xa2f3b625a055a661U, 
+0xb0938c8e0e937941U, 0x9222fa317c33fa53U, 0x80044a90f32a7c4bU, 0x620ea159614c68aeU, 
+0xa4d4d742bbfd71faU, 0xb775a265b4527d4U, 0x6d6972728a704c17U, 0xe931258e8eb5559cU, 
+0x3d9bd0d3174d3307U, 0xb3946ce1bb5e35f3U, 0xe85eb4169c954b40U, 0xfb1e33364c3fdee0U, 
+0xc7601631d91eb056U, 0xa002efdb8ecfd386U, 0x1d98b5c6a3f515f5U, 0x3c4f83c9eaae5923U, 
+0x7425893da05cecabU, 0x1982b54481cf6b87U, 0x33ad6573c3b27880U, 0x94479007514a8b6aU, 
+0xe643d8cb548fadf1U, 0x359b87a712df9dU, 0x9c365f8de891817bU, 0xedf384387f7f4244U, 
+0x79c436cf6c415fb6U, 0xf4e8813dea37d28U, 0xded80235120aa6b7U, 0x72d3b5b0a1898500U, 
+0x19061fdbbd86dfa9U, 0xdc38b4a409b993a7U, 0xe29c1e03e8103baaU, 0xaff8e1288a9967d4U, 
+0x7103c36c1d12681U, 0xf9116da94419f9c7U, 0xd3d3ebaa1fcf53f4U, 0x8d8b4bb321377c3fU, 
+0x77123d425cff55c5U, 0x5f4efd281a275ec9U, 0xa6c12c1e782b4b63U, 0xcf36adfdfb25442cU, 
+0xaca2788521a0228eU, 0xa7547ec25c0d2706U, 0x49c2f58b3bd9f207U, 0xd16a12166ae07686U, 
+0x28f2736b989ba9c1U, 0xe40f7ca5a09d338eU, 0xe8458262aecee579U, 0xd3fb784528dc00b3U, 
+0x61b88dfeb51b267U, 0x341cedd5c011ade0U, 0xca7ca05758b70fe6U, 0xf894d434efa6b4e7U, 
+0xfe8540cbc181f79bU, 0xe045d8650ce4adb4U, 0xe2df82e7c6a5ca26U, 0x31c80ca26c63dfaeU, 
+0xf0b9e526d5225400U, 0x622ff9eaf51125f1U, 0x3094e4d368f30d91U, 0x92b59ec1202926dfU, 
+0x9da96c1d0f2bb909U, 0x6391027c53598d99U, 0xff47298839187d7fU, 0x4ec9300e0ac9aa88U, 
+0xb88a383fa4cf4071U, 0xd52e16820dac3827U, 0x5c80dc45184c49baU, 0x782ba106be1b04dcU, 
+0x7f3b58fa2120e2b3U, 0x7a58fdce7f47f9aaU, 0xe7be4ae34ce6e521U, 0xeaa649f21f51bdbaU, 
+0xd47a5305ba5ad93dU, 0x1a6b965f13f7e59U, 0xc69a80f89879aa5aU, 0xbe3279ed5bbbb03aU, 
+0x53dbc1cc1fc9b0a8U, 0x9e337b5c705f3db4U, 0xc2623ea5002279eaU, 0x3adb9db3beb997eeU, 
+0x61ae7975f05bbddaU, 0xaad9c8f9870266ccU, 0x3c774de07c095ff6U, 0x374e2d6daee74e71U, 
+0xf583fd3a3f2e070dU, 0x29aab71cc52a6a98U, 0xf48731c3b85047e2U, 0x4b72a5e9042f4abfU, 
+0xe44ba82ee96dd780U, 0xb0b465ddd2948c3dU, 0x60277bb36d0f3c10U, 0x599e1d4e1d6ae1cfU, 
+0x54e9e0c90ae86f9U, 0xfefdff56963e7cafU, 0x7e10955e56c5fc69U, 0x129e53ac428e9cbbU, 
+0x822efdcd1e89c85dU, 0xb2a232fd16b3e01bU, 0xb2da2115b712183fU, 0x415ecb958aee9a29U, 
+0xe9ce7fd84a02591cU, 0x3ef54996585125a1U, 0x85a6bfbeb5e1fd61U, 0xa9fc93fc6539c8e2U, 
+0x790addef69bec2dcU, 0xca888c415fcf7253U, 0x3e84c17a1a9165e5U, 0x9c2ce739dc538717U, 
+0x428700a0f85912ecU, 0x27f9ca04e4609113U, 0x6ab499694aaf0543U, 0xaa7121d4e3fb5b78U, 
+0xb114cb264ae35978U, 0xfee134a8ce056cbdU, 0xc505266b96a2edebU, 0xc690f077dad09509U, 
+0x11006e0e2d968b59U, 0x9a28bae13cbbc2eU, 0x6a7d7ac1209b0277U, 0xc940017c1a6f9f0aU, 
+0xfefd76408de572fbU, 0xe2842cb64390c9c8U, 0x13b8a1bfa5b5742cU, 0x39d922500c9b8620U, 
+0x922243d5e855b8daU, 0xc756267d12894711U, 0x5b85ecb6aee10956U, 0x60144494c8f69448U, 
+0xad500590f34e4bbdU, 0x543955c27e3f2a4bU, 0x9e8be1fd9132e65bU, 0x8bb5d669f681e646U, 
+0xa2873335726b3332U, 0x310388d073ee5de6U, 0xec6793a5f70bf8e0U, 0x1f84bb9d7eed0024U, 
+0x554428a314e8d52eU, 0xc2bcce2d436dc3a2U, 0x2547c27f75b9edf0U, 0xee726d072bca9eccU, 
+0x9dd95979b1972bcbU, 0xc2f22e3e241eccebU, 0x8f68e0213eda1776U, 0x3df2d057c8bb9f02U, 
+0xb2822cd3d65d09dfU, 0x1b91449680194771U, 0xd6e6b23b046a684bU, 0xdc7eb1c640c86eeaU, 
+0x5cdaa54acdefa98eU, 0x7248446811ac2799U, 0x6ca8157b3991e9c7U, 0xf13e0890945fcd0U, 
+0xc08a7769be286767U, 0x287e705e16ceaccdU, 0x35e3f8b0a7b362dbU, 0xadd521f1764e7c50U, 
+0x1b806a24ffd292dcU, 0x775e2680b17714ceU, 0xba48070d37bd79d9U, 0x4b9915533720f934U, 
+0x433a5ffe57095ca6U, 0x938323c45b376afdU, 0x6dfc0a74b5f01f57U, 0xe327754961103a22U, 
+0xa5e1c03be9f59b6bU, 0xe9b38c63c1888e2fU, 0xb3728a1d2d5826d3U, 0xdde191a551ddec7dU, 
+0xf6ad962926cb1410U, 0x8b5738bbe7154fecU, 0xe0a757d61c52e14eU, 0x5b2bfb78028275cbU, 
+0xeeed1b3423b43eebU, 0x181c9401bf81184fU, 0x7ea4825fff359c5cU, 0x83c403979eb95e93U, 
+0xaff34086d484fb51U, 0x95b6bfcab553fb40U, 0xbfc1e46d00d61b2U, 0x29575ff2437cee3dU, 
+0xb68c55fdc9c6b699U, 0xa86f57356be46871U, 0x5a16d7bf97b41682U, 0x5fab012eed836f7aU, 
+0xb1732152c1c6c3aaU, 0x90ab117fea883519U, 0xe9ebb41130d62f7bU, 0x2d9bfa70a3c3d144U, 
+0x1e23632dda34d24fU, 0x41b6d8f0c9a13740U, 0x9391df6decf42ee5U, 0xe4a42d43c5cf169dU, 
+0x3a7f7131deba9414U, 0xe886eedfa8d8e4f1U, 0x26fc99ccfb8ad34cU, 0x4d9f92e716d1c735U, 
+0x303f2ea33e8f62bbU, 0x553c562f7ae4d2aU, 0x3ef0acf856c4ef4dU, 0xfd6451fb84cfb18dU, 
+0xd0ad9086132c0911U, 0xfa2ab492d200e83fU, 0xb6fe7a5c1bc344ccU, 0xe745ceb2b1871578U, 
+0x5c8410af3bea0c68U, 0x9430123677b392bU, 0x4949bc8e8d396fafU, 0x3e419634e156a3a2U, 
+0xbcbb6ff71a45edb6U, 0x2fa11946303cda1aU, 0xf373cbfe37069306U, 0x123c59d924b21f7U, 
+0xfa1d1fb9d5fe696bU, 0x42e2d5dcf3c7a1U, 0x716e81a06f9edbbbU, 0x1eee207cb24086bcU, 
+0xbb45670e7429337bU, 0x7a02062e0afd694eU, 0xd2b196d12461c95fU, 0x652cbd19aef6269cU, 
+0xaf75d23c939824d7U, 0x6eb7b64c351c9897U, 0xeed4a3e62f7f0b57U, 0x8d9438f5455d7508U, 
+0x8a004f489366489fU, 0x8fb9e2b8326b063dU, 0x2ca60bd31ab6ef6fU, 0x3261e0734fee6c2aU, 
+0x9a9814c417d4b84aU, 0x621ddf48f1f433e6U, 0xc62a492d2850704U, 0xf13a99e58dc72fcbU, 
+0x85990fc553fd1c81U, 0xb6e37d4710f2d962U, 0xaa6b91cd1e3fe06eU, 0x33c2c8cd0f0be995U, 
+0x8e48071a98d713deU, 0x9360c2fb7428e620U, 0xd4a912a2fe54543U, 0xb72524c558ee5442U, 
+0x76ffe5259b8350e9U, 0x482d26fe44a5fcbU, 0x1042d182e9d69415U, 0x4c51b39a8a283e45U, 
+0x8d40f19ef94c0d5U, 0xe1c0fc017c572579U, 0xd465ab2c346e2111U, 0xcc0ea33ea8a9eb14U, 
+0xdeabe597af452fe6U, 0xf6074f266113f543U, 0xb23dd203b5fbe663U, 0xf9907a3b711c8a2fU, 
+0x2cc6c293fe3b2cb4U, 0x3049f35bf3721040U, 0x9adc76e38121149eU, 0x3de45f5a216d1251U, 
+0xf61e33ac307eb02fU, 0x823e28e65a87044cU, 0x50e08aa4a97c9106U, 0xba2a8598405eaddcU, 
+0x9ccbd7512a0c0222U, 0x16937ef9c82e8b55U, 0x46ca18bfc1700f2cU, 0x9e4ac64d9ca58a04U, 
+0x16cf7673a4fdc9bbU, 0x1c62030f3dab904eU, 0x3080e8df63b300d0U, 0xcea45d1d9fe4e74dU, 
+0x7234766f6ce4e5bfU, 0x9b67ca86a09005b1U, 0xc1e3fce3748906aeU, 0x8511f1c68959be87U, 
+0x2fc92944c1789c08U, 0x2da87889bc536526U, 0x4c1ddf7ec6aa0023U, 0xecdff5cf91bcd487U, 
+0x5f0c3b144e735a1eU, 0x4003e0966be61fa0U, 0x46b8cddad61202fcU, 0x678ac7c0799b56cbU, 
+0xa363a5f712f7c055U, 0x597fffb33d371457U, 0x7a70ff3d57105e8eU, 0x8514e33d9a5285bU, 
+0x31b5668a3d3258abU, 0x57d242818abc14dcU, 0x2cfa1c72ee14ab59U, 0x8c5a052e81cf6022U, 
+0xe57e0853022d0f8fU, 0x46dae8f9c0d944adU, 0x79a80c7904c08c2U, 0x6811db4bb443bda1U, 
+0xd7be9770822aa9b8U, 0x6e2933506f8eU, 0xdd66895d9c5ad45fU, 0x64ba9514d8680f6cU, 
+0xe93d1fb9b6163565U, 0x5fef1b6f68307b35U, 0xb7e07728c19be49eU, 0x81273f22a6431bdbU, 
+0x158c2a0abf91bceeU, 0xf5cf1d8f1e0c0d84U, 0xbdc63cec556bf137U, 0xcef7f816debd3560U, 
+0x6bb4da9f81966b33U, 0xa63e4b02a172f6acU, 0x2463b339c01d245fU, 0x67e74c8363748701U, 
+0x47173b9d4300bf19U, 0x92b53576a88fea49U, 0x54160fadab352b6bU, 0x1ec80fef360cbdd9U, 
+0x671cdc1cc107cefdU, 0x146e77f6295a07bU, 0x2f3a4958a7abbf5eU, 0xaeefe93756b5340dU, 
+0xdae805d414ff9e4U, 0x8e8462f6ebd89056U, 0xcbeeaa0344fc90bbU, 0x5be7ea3519f04bc6U, 
+0x4030b07847e0bdbbU, 0xe99c6302119a309U, 0x477f890f655ab7feU, 0x32f32ec3f638e605U, 
+0x4b17cbbc52fea1f9U, 0xc4ff0b508c0452b9U, 0x3bcfddab67106531U, 0xa6dc880a55d1f2e8U, 
+0x3b1c14e47bc345e9U, 0x57b89db7e68f7e6U, 0x38683a116acbc50U, 0x7ef1a8547dc367c3U, 
+0xe3fb545f4ddb7bb8U, 0xd50028649f853991U, 0x813fc8698df7f5cU, 0x58f099116eae4e65U, 
+0xbdec73582e5b2d6eU, 0x507ee4062d174302U, 0xd62ff7614638066U, 0x7e07002aaffe111aU, 
+0xc8d40c3f06d6c9b3U, 0x8c6c4ce874865637U, 0x2bdc229c78a481baU, 0xfe6ba93fea424599U, 
+0xc2c788fa948bdfbU, 0xd980f1bf05c2e9b0U, 0xb6bb41b345413b56U, 0x7ee918d740539872U, 
+0x8b613e771c7985c4U, 0x134bfc495b9e2b10U, 0xe542842802f74c34U, 0x2320b5caf7b59b7cU, 
+0x4ff4f1df4c2c6d44U, 0xd96f10211cd9eb8dU, 0x18c721b81f9bca93U, 0xc79f943dc88be943U, 
+0x422f10730cf95151U, 0xb964806e442c4b64U, 0xb020c8c2dc08ded1U, 0x15d5e2f146fc98bfU, 
+0x482a07cc2ff8ecf2U, 0xbb204fb97dd8c0f9U, 0x7f90e109789023f9U, 0xa5b72e31915fd4ecU, 
+0x413c1606cc9a8e2cU, 0x823d8d1a4cc1a1c1U, 0x33bcc04fd860cb0fU, 0xb0f9e4b9b29790b6U, 
+0x6c2066c4df3d0db4U, 0x3350cc02c171cee7U, 0x41cbb0b906fde3f0U, 0x49e82bf1843ade6dU, 
+0x3d7810b9296a5658U, 0x3814b25241ef6564U, 0xd8c7e00927ae29beU, 0x84c0e8725688447aU, 
+0x2d96729bd81b80d1U, 0xd3a61a981f4f1fd2U, 0xa087e3190653725eU, 0x26598380c16022c4U, 
+0x5aa02f29d9d6fad4U, 0x94b357cf1c9a124cU, 0x8fad04ce213d59f4U, 0x56db6280670a91ecU, 
+0x67a9c0fd359e0836U, 0xf5b8b2a1a31e5cc8U, 0x50f591016d6830c7U, 0xda0d3b94db572724U, 
+0x375bb5c894dc6a0fU, 0x7443419142fe1575U, 0x565264e7a2c077c2U, 0xfed6b1c71a93731dU, 
+0xccb8d72d976fc7e0U, 0x1374d5930a3fc409U, 0x8479181ae4d3ae23U, 0x8de2abe6b0ffff0aU, 
+0x79fe0b0bca3a809cU, 0xdab662f5d798346dU, 0xbfbcf97e4254a89eU, 0x125e7ec83933df56U, 
+0xda8c900a949e70d9U, 0x1e4e3b2ef07fca3dU, 0x887747caf5721a37U, 0xe0d3f6ede254cb38U, 
+0xdb3885f118e29355U, 0x2f1c8e9339720d86U, 0xfcef8604023b9d8U, 0x2a6a4dd992d3cbc7U, 
+0x53e00fb5cc2872U, 0xfe905a3a64c4c76cU, 0x760fdc81e268f90dU, 0x8677dfba7c4a7e0cU, 
+0x7f529511e7681028U, 0x196e235eafcb9bb4U, 0xbf33ce97ddaf3d8fU, 0xa1acb3f1185d20e1U, 
+0x1f1a463e14a11c9dU, 0x66eecb271fa0d788U, 0x6a047588288f0c5aU, 0x55a883a61abbb29bU, 
+0x1f9fa88fe148dabfU, 0xc1add2b9349d78ebU, 0xd9764ec235fae735U, 0xe42d93026c927546U, 
+0xd772c756811e1361U, 0x3272757019e77eb9U, 0xd8b38cebfdf38530U, 0x6413862c6e2d84b0U, 
+0x9ddb5928366642beU, 0xce3490717d58ba88U, 0x91b00af4680dfa8bU, 0x146a778c04670c2fU, 
+0xd0b297483d83efd0U, 0xaaa971d2f7e5ed1U, 0xdd669827f9d4b287U, 0xb318e0ec3354028aU, 
+0x11b2365579de5cacU, 0xeefc983c7ecb2619U, 0xe5670b5c0bcd14cfU, 0x574ef0ce8a597e24U, 
+0xae59aea6c75a4805U, 0x1a260a7bef10008cU, 0x3bd6ada0569b7845U, 0x9b99930281f19c7U, 
+0x9d93873827315443U, 0x3d79bbd54ae86729U, 0xf42c899820a142a1U, 0xfc696c040660935fU, 
+0x7490d60b57d28960U, 0x487ff486109bd1b1U, 0xbbf0e1cdd69677b5U, 0xe0ce27ebf83b5892U, 
+0x808c2d74260966d3U, 0x10a770c1aeff8645U, 0x5d909397b98c835dU, 0xd3d97e799d8bf9f8U, 
+0xbddeb850833c2e52U, 0xb5e48711be8dc4eeU, 0x6aaa89275d403ad3U, 0x8ddbb46376bac95eU, 
+0xd1bb2f5c16fdb4ebU, 0x8fa3dd79c62e6a79U, 0x1ae56a3562beb092U, 0x974af221ff4ff2adU, 
+0x8409c3dfa9f6f484U, 0x111c572a3bffc234U, 0x64d1e43d02c090edU, 0x5552387d535003caU, 
+0x7f3615fd7c6b5b56U, 0x4185c8aaed888b60U, 0xcdf587ed3bf200e5U, 0xa0e8865700ef4338U, 
+0xa16bde513a1d7518U, 0x526b871d70858a51U, 0xb99a6b89b853deadU, 0xf5ba46839fa9ad50U, 
+0x73904adb5d5aeee3U, 0xe8284bc36658c813U, 0x9121b3a669270c5U, 0x5baab59b49de398bU, 
+0x82d29afb70f69717U, 0x215ddc9dabd31eedU, 0x6e5a008661ffdaf7U, 0x8a577f617c0f7e85U, 
+0x40fb93968c6d4bU, 0xb2be78cf8f494c12U, 0x7b974e782cbbee0aU, 0xb1aa653288b31898U, 
+0x83d9e62ae891ac51U, 0x100a1d909d623cc3U, 0x2684aa8e2d63a83bU, 0x7ed6071c60810d71U, 
+0x851b1e44f5726890U, 0xe59025feac837d15U, 0x1032fcebf910a0eU, 0xfb685fa7eb49c43dU, 
+0x606ea8f3b835783aU, 0x4fa6cb12e90e79b2U, 0x869ca16d9864ba09U, 0xd750df22c98e5e2eU, 
+0xb7eedaec62c6e5bbU, 0x24fdffee356cfe6aU, 0x358ab0b8392a597fU, 0x25116c4108c7105fU, 
+0x4dc4732a0f7e1321U, 0x77c508df51cc272dU, 0x1eb7406dc815dd8fU, 0x60d86913e77177e0U, 
+0x5464bf13a8bca48aU, 0x78b4d5f4e83df62fU, 0xab27b91c287f71dU, 0x5de58ff659e2995aU, 
+0x58794e80d2fd41cdU, 0x3fe5bd9c4e0f8aa9U, 0x309a623c252d3c84U, 0x685a3b3d80359b55U, 
+0x1d765df750cedd26U, 0x3cc8b99dea571554U, 0x611d8100f9639e2aU, 0xaf8848372961ebb2U, 
+0x8b6e7ad3b0e43f7fU, 0x54549e4867aa4170U, 0xd28cbb88ebed2f96U, 0xdc57fbf97b167030U, 
+0xbde38344e5ef63b6U, 0x5ab4d016731b182eU, 0xaf1b7fda3b4fc1c8U, 0x6f1825cdead618bfU, 
+0x12c846cf45c655f3U, 0x3c895a64027f9454U, 0x98f4204d78333455U, 0xff097e7dd591911bU, 
+0x39f9e5b1faa50e2dU, 0xb5a275ecf6ae4bdcU, 0x5b256e3ea081add0U, 0x5210d6605b888036U, 
+0xb029a8935afda8eeU, 0x5a273dcdc642686eU, 0x39c13c0e7ff6588bU, 0x35f6674a5decd301U, 
+0x7b5047edf4a63f3bU, 0x83203b019978f972U, 0xb587115f5e76c765U, 0xc5ecb895f762a376U, 
+0xb53f374685005024U, 0x8beb65ee5e30bee5U, 0x74ea4058ff9233ecU, 0x22252518197881f3U, 
+0x6d76a8793180eef9U, 0x8d0012209a28b977U, 0x7e3acebb1aa07b12U, 0xfa50c0f61d22e5f0U, 
+0x38cd8d7d3f4f2811U, 0x5e683293a57a213bU, 0xb72cd2872281a68aU, 0x6b84c6922397eba9U, 
+0x59c5be23187f5048U, 0xe72328d2448386d4U, 0x780140fe02e90836U, 0x63964eee619074e0U, 
+0x383a284d89309df8U, 0x3d580b934dde6c84U, 0xa39ff9b1c34bfbc9U, 0x3b6cfb3a6b89cf41U, 
+0x71ee0e3391da5e12U, 0xa9c60a4015cacb29U, 0xcda329f93a1ca2b6U, 0xf7502e3c4379e31bU, 
+0x7a4b9c5e8385f4ebU, 0x7b86d32ef725cebcU, 0x59970945c3d67204U, 0x3c57f5edd67cfafdU, 
+0xf814ba1ebadb2a65U, 0xafd7f12ad3cbda31U, 0x2d1469ddf0fc9f75U, 0x5a3ce25b4d15b7e2U, 
+0xd8b170cf1d327f1dU, 0x3ee28bc3d825fe8eU, 0x873a6dbfbf3f99afU, 0x8b34125b92e05f63U, 
+0x2074933110b7d105U, 0xf4ca5c4b94e57c9fU, 0xa3a4f6624e3455b3U, 0x12fe78f983ae5862U, 
+0x458ac6fb9f794a60U, 0x1dece265d6ee90b8U, 0x786b5aa199a7cb77U, 0x2062f1a338d6bcf7U, 
+0x237312073e32478eU, 0x24ab318f2a9ba7edU, 0xfec6b7f3f332b20U, 0xd42011d601061388U, 
+0x1ce05681d04e88d4U, 0x6fb24b2f35508cc3U, 0x1b2d5f5f44bf847bU, 0xbae5d4e9a37d4e0cU, 
+0xf621d8339e0c5d05U, 0x480e6c50aa572dafU, 0x58c4bb1028084b1aU, 0x76aac31347df473dU, 
+0x556619b751ece63eU, 0x4b1225cf015e6ee3U, 0xabef32c83202625fU, 0xef5576ef0d5c70efU, 
+0x16a733754a9f44d0U, 0x85dbcb6e69a8fa00U, 0x6910be34f0de41ffU, 0x5ce605af98f93edaU, 
+0xc0d05f3489d30105U, 0xab3cb1bfa32eccc6U, 0x7ba56bd031c76c58U, 0x4cddcf9bec226bfeU, 
+0x9e26f485fc53c086U, 0xc6b55c349c9a1aecU, 0x87e60c3145e88104U, 0xa663fe5bbe5c5cccU, 
+0xe69c5032a5016201U, 0x991ecca573994fc0U, 0x5d1b102c89823dc3U, 0xb541997f6b211fbfU, 
+0xaa20d691c9f40840U, 0xa71df4429e55359eU, 0xfe4eaa23938a4347U, 0xe0346d21121ff741U, 
+0xc39a1aaff3d7ce72U, 0x269cd39a6ebd33edU, 0xd756d4a97ee7ba2aU, 0x3ee683713c998956U, 
+0x9ad801ed4b758574U, 0xd8326689434f9c6eU, 0x5b7ca1027ae2bdf3U, 0xde95527a0206cd82U, 
+0x4b7df1fcfb67232aU, 0xbae6a105155a2debU, 0x4e21dc847f169ed7U, 0x4cd3e056ac93d14eU, 
+0x56a7237ba16ddcd3U, 0x44b110021ea0035U, 0xf7b5beb6cb8761afU, 0x1ae1ad36f64e99edU, 
+0x7cc4619d2e7eb2b7U, 0x59616addfcbb613cU, 0x59c74f7752104489U, 0x7016054987a09220U, 
+0xd779b8abfd85474fU, 0x894c4a2b89634668U, 0xbfedccbe44785aeaU, 0x8da6bce066d32addU, 
+0x5fdf9c7d3d7b4ef7U, 0xb1cc59305dbdd7aU, 0x84fddf5d071dfff1U, 0x13fc6c6af31ed4ffU, 
+0x80ffff890a9de533U, 0x2a9bb56702356e3cU, 0x20e979f6a6471274U, 0x1138ad12333790f9U, 
+0x6a8b7094fd332573U, 0xf679bd0b454a4000U, 0x86f0dc3e9f95a7dfU, 0xb35525b758751d94U, 
+0x6b5d42567dd042eaU, 0xebfa26a6458eafd0U, 0xb1bd6649e33c93beU, 0x7329acc7cfb3ba39U, 
+0xada8cfec2f5c94a1U, 0x184897731dfab4f0U, 0x89284e794fab68eeU, 0x9272493541b76f14U, 
+0xe53d32b5f067ec2U, 0x1a288ab5d5bba522U, 0xb1a5bf6b7d88e842U, 0xda1d61d0ca721a11U, 
+0x655fba0f1ad836f1U, 0x66a73899d279b48aU, 0x79c0766161c91e29U, 0x8157f55a7c99306cU, 
+0xb3c210d22cd3c369U, 0x23605483e1f8e934U, 0xdf85d5f61dc1283aU, 0x9c7be00b4ef4c444U, 
+0x29ee3feba2329515U, 0x3e31153a16769cbdU, 0x52a26d455ce40148U, 0x9220c0de74b20d20U, 
+0x15d87732fa95a8dbU, 0xb83ec0c4479d36f6U, 0x19e96646991b1723U, 0xe3e90da46303dd04U, 
+0x1016cf7f1b0d1cf9U, 0xfbb1ef97cc984d3dU, 0xb00faa90c702e76aU, 0xfbe53bc0056c178bU, 
+0x76bcd92d7bb8c9e3U, 0x74dd06a70541178eU, 0xb55664b238ccc491U, 0xfcd83f42825263bU, 
+0xe86d55fbdf4aa9adU, 0xadbeaecdf1627bf4U, 0xd1d8232de5fdb683U, 0x6c0bc1cfeac5fbceU, 
+0x17aafd64112ee214U, 0x782a4e9795931540U, 0xa8b650dfd5c0c01cU, 0x9f4ffec732e3d775U, 
+0x3ef442225085f37aU, 0x9719b6930bc88028U, 0x60e96682fd75c69dU, 0x639ce2e1318e2f2eU, 
+0xf4fc3dcb541d0ce6U, 0x748992a2cf598d41U, 0x2ee14cce33a05fb2U, 0x14295a2937f1a941U, 
+0x52a81a8ad738bb86U, 0x310895601b5d241aU, 0x1b031c44844083b1U, 0xfea75363df115071U, 
+0xf8b681451f61a0a5U, 0x4b1253e1b3c14e3eU, 0xb171a0a41f440b2cU, 0x431f622d41134ac1U, 
+0x46b7b7fe78cef899U, 0x41baaa0435565772U, 0x6d6de6519723aa72U, 0xa298327fe7aa438fU, 
+0x5cf39944b26b64f1U, 0xb7edcf28f5476d99U, 0xd4cda4c62511e59dU, 0x7175407f1b58f010U, 
+0x426e7efab24234d5U, 0xb01fe8b774471d2aU, 0xf36d3401134cc86eU, 0x43b4554344e3d550U, 
+0xcac267d567748503U, 0xe6e0e47731328e7U, 0x6cb62ef39f8a12acU, 0x993dbaddece78fb8U, 
+0x9ba736137eb0cee2U, 0x17f87bf69b8adaa4U, 0x785f784787a1f51aU, 0xa521a9ee8569eeebU, 
+0xe464dba997421e21U, 0x3aca86a23cefe2f4U, 0xba8289212418cfacU, 0xc20e86b84e51772U, 
+0xdfc83d64a1aa6a45U, 0x86ee76f65bd09349U, 0x1a1237a11e19a5b7U, 0xf561e9bf76d0adacU, 
+0x8dea2275a6d23d80U, 0xe10bd11f26474d47U, 0xa339431cb90962c0U, 0x75f17aba06ad5ea5U, 
+0x986a85b0280dd57eU, 0x372ffbedbb4ea590U, 0xc7fc7d0bf19b6292U, 0xa07a62fe15639a80U, 
+0xc718cf9c4b344f7fU, 0xee8b89fd48ce60c4U, 0xe97e32cbd26d410U, 0x354cc84bd972e0aeU, 
+0x7e4b11aea5db82d6U, 0x8e36c6018602e0ecU, 0x6750b493f9ba8855U, 0x9c04bf29291c6b5dU, 
+0xae2b9b6d61ad3413U, 0x8db9c0040327d684U, 0xa6e95f485cb87b7aU, 0x6678555e11d9f4a0U, 
+0x124810207ebca672U, 0xa6ce2d153adc6660U, 0x925266d927cbdf9eU, 0x510dda3de278f646U, 
+0x7487b5f83502b4b1U, 0xc4af2554d6c08a44U, 0x40486c0f262213a9U, 0xacef1418da0f9428U, 
+0x6f81fa7966e85bfcU, 0x2a3f6290adf1878cU, 0xe04017b53d8971cdU, 0xc4d3559fd7e87a4dU, 
+0xac00af5b06cc8563U, 0x9224df5bffe101eaU, 0xadac82bd81963688U, 0xebdc4a362cda7748U, 
+0x49b17bcea394ccfaU, 0xbec4079249204f92U, 0x9b1ee35e6cdd4f07U, 0x659a3144e856d35fU, 
+0x2a73b0610d064e13U, 0x15311de0446f1e06U, 0x7215ff98e8fd4166U, 0xa8e282ff0c970690U, 
+0xcef7c73111f4cc0cU, 0x8b679a3e50dd6bd6U, 0xabfb7f3c5b251588U, 0x7f97355b8db81c09U, 
+0xc15eb9ea7f7653a1U, 0xefbe9eaa753d67c1U, 0xcb876f805ea66e63U, 0xcac6f2e7e27faecbU, 
+0x68c10ad0fec5e556U, 0x81e83ae5688103a0U, 0x4cdb65d9a42a3450U, 0xf7d416e5e2aa6f19U, 
+0x22a199b0ba3979b5U, 0xba288f8de67e829eU, 0x27f37f0b1ee40e50U, 0xae2207c5cdade263U, 
+0x68f3cd668450fa6fU, 0xfca87b7d37d4f889U, 0xad4c924523ad7060U, 0xea91fe510c079f71U, 
+0xcc9f4ab08624003dU, 0x4ab767294238cb11U, 0xefbc5932e58e4325U, 0xe6dfde46ee37d206U, 
+0x7548650e2216b93bU, 0x3b1ce5ea527fd7ddU, 0x8f2f48f7b88f9220U, 0x8727b3b7be913949U, 
+0xe41019100efca824U, 0xe0be0c4fea2164faU, 0x9cec541006585461U, 0xcb8ded0cad72ace5U, 
+0xf140bd058f227361U, 0x96ad1fdfc7931742U, 0x5b316c487a2ccbc4U, 0x33a5008f740d88c8U, 
+0x559e11e1ece4dd6aU, 0xa00e49ca3221cefU, 0xbc9eca37e8d64c46U, 0x49dbe4f7b2792b64U, 
+0xb13b72a42a9e3eaeU, 0x1c38552fca05bb69U, 0x2c5fe33db692255aU, 0xb8b57298470481c7U, 
+0x9411b4da3bcbd327U, 0xb04e085221e4aaeeU, 0x8e94900d7e76ed6U, 0xb0c53b298af18367U, 
+0x1616bc4a2d7be436U, 0xd82a220c74636a0fU, 0x638f6a601b66b2afU, 0xee2a97401fbd7ea1U, 
+0xb0e1103548dce109U, 0xe250e3149cf211d3U, 0x66a40cfc7ac96082U, 0x3c4e089cd9a6823dU, 
+0xe2bf65923a19aeeaU, 0x9579e142d97fe697U, 0x80757bca15764d37U, 0x43fbbe669fe191b4U, 
+0xde6efb6397b836a1U, 0xc806405ff7679ef7U, 0xd4d8862ece77f526U, 0x6f6ba73f329db920U, 
+0x4dbdf2fb06832b84U, 0xd8990c5288e1ff93U, 0x3db0b8a405bee9c0U, 0xdc778a17ff5fc18eU, 
+0x68056b7f825d5241U, 0x563ed7ca920bd2f6U, 0x534277d340b3ea8aU, 0xf8cc1dada779674eU, 
+0x960af038f070e10aU, 0x52c2d76c61eb0bd4U, 0xb33e892fa5166f04U, 0x13de4e4410b170feU, 
+0x2aee34209eb39edeU, 0x31088032d70612d4U, 0xbbcff467e1024360U, 0x7d471a7dc7422af4U, 
+0xc9bcd94abf6607eU, 0x7795cf7d1c22a8fdU, 0x7b82231effc86faU, 0x4a7b19f3a68565U, 
+0x4fe8b5bdf4e5f03aU, 0x96565feb1e1606d5U, 0x737dcfb33d7dfe35U, 0x80c34fdd0289be33U, 
+0x117f4546fe3ca504U, 0xd30b2aef1f3245cbU, 0x55edb57007dc9a03U, 0x247e0856a78c1ecdU, 
+0xa56d49e2565eb1c1U, 0x7fcd7567cdae5c5aU, 0x7070fcc31982f096U, 0xf0025163f9b73facU, 
+0x7da7d7046dde2ae0U, 0x8576ff5cd6cd11e5U, 0x4c66b4a5da26afedU, 0x54ea9e8883d20dfU, 
+0xa610a061ca14f422U, 0xb383e4ed9e4c4decU, 0x4afe802214dbc7bcU, 0x6ced1ae897a9df3dU, 
+0xae73da43d84fc091U, 0x8ca102c879a9c932U, 0xbb495a728be6b9b8U, 0x25888aeb1b0f8e7aU, 
+0x4cf35093dac32c64U, 0xe36fe03ecae4bf8U, 0xf704e950f47715eU, 0xac12140001ed23aaU, 
+0x8812adbadeb1a867U, 0xed5a5d3a5a53f089U, 0x1870b695730499a3U, 0xce8ebccbac338bafU, 
+0x22f382de8319497cU, 0x5d59b1fa512508c0U, 0x2d39e56e6913cab1U, 0x174a53b9c9a28587U, 
+0x83da13ac079afa73U, 0x646b3a1d8cb98543U, 0x57b4155f2c47f9e6U, 0xccc9dc37abfc9c16U, 
+0x5f5da36f840dd273U, 0xd53d280e0e450111U, 0x30c7071ef1b92ea3U, 0x20e6e2e796946bb6U, 
+0xc07cfd15bb46b593U, 0x811ec9793da8693cU, 0x4a0ba1ad97874655U, 0xd3ad7afe4f1559e4U, 
+0xe948073d754b8367U, 0xb775b77d67d506bfU, 0x40caa5d458436a5dU, 0x5e5a094ae446526eU, 
+0x45329a9d91ce85caU, 0x796aa9ef3de5ffa4U, 0xc2c901f1572a4b7aU, 0xae8af8c9a4795e05U, 
+0xe7b54f301a077674U, 0x35ae68136cc24ca3U, 0xa80280a07e71db70U, 0x8e0ca824d7a351dbU, 
+0xb84cbec12b7ed98U, 0xcff60419d2f91029U, 0xdc569d24da62cf57U, 0x4ec560759192d41U, 
+0xf198579397b10d9dU, 0xe6a52f189d1f8fcaU, 0x9deccb83310cb82dU, 0xd4e0adb9702e85U, 
+0xe82100487140dcedU, 0xb5898c978e2d923U, 0x47d2f846432287f7U, 0x87b8019818376409U, 
+0x7b05e8360cbcad59U, 0x7c845a05a4e0aaa0U, 0x7aa17c85a5f902f1U, 0x2ed76c1152ac3600U, 
+0x14ac7a89c4ea66feU, 0x5f72c60130a7f941U, 0x2cda6eaec81767edU, 0x639f4d4043b85f22U, 
+0x20811a609c9caee8U, 0x632e2045b1a270bbU, 0xf6f7a19aeec4a667U, 0x366521368ef74c0U, 
+0xa9ec6a3b772b711U, 0x1cba9893295ba7fU, 0x9949fc681ba69445U, 0x1f18c32b2a93ded9U, 
+0xe96afc5ea8192441U, 0xafdb5821a321b4afU, 0xc5fa63553e3d66c1U, 0xf7bb50da51c982d1U, 
+0xbc640ea1d45165aeU, 0xb1cfdc1fbbc4c74bU, 0x311bc63bdde6485dU, 0x93cc3be30334a526U, 
+0x53ff97519446c85cU, 0xde37de08e601c063U, 0xaa0676c453f6c6eaU, 0xe5891056fdb8f1fU, 
+0x5f6c77e72148972eU, 0xf490234e80cddaddU, 0xec7418baf481898U, 0xe39a485f11fa7bdaU, 
+0xe0349010055ae087U, 0xc671b96fa3494a57U, 0x2d3945fb743a1510U, 0xa34667155b6ea598U, 
+0xcb3f366322887627U, 0xc53eab6f2394f0bcU, 0x8defe9a1aa2a3051U, 0x21ca5fa5e56bc5bdU, 
+0xff18adf3c22e1259U, 0x931739a40681362aU, 0x2b6cf5faa0077771U, 0xa740126d26f1463fU, 
+0x5f771724334a5f43U, 0x17865e753b1d6dadU, 0x1b05f174a67c7ee5U, 0x5a9ffbaf194f1ffU, 
+0x830f4571e4b84b48U, 0x91adf4c799e817eaU, 0x41910f577d417f70U, 0x5fb1df0e7d45a4f5U, 
+0x77edea6a37be8eb8U, 0x629c390873f21adU, 0xfbcf4646fe6d2582U, 0x2152fbbcbc3c4d49U, 
+0xd88a17a3cb08f1feU, 0xd7ce7ee70ba087bfU, 0xa65405765d82d177U, 0x87e4b8216d9474e4U, 
+0x75f74ac9aed5e2ecU, 0x6e2f23dbd6786d9dU, 0xcd7d7f8ea2f8c2ccU, 0xf74e3ac0766348ceU, 
+0x1146d987f9b8f255U, 0xe77d43e7492a0d21U, 0x1622e4608aa82fe9U, 0x95bbd97478e1b8a4U, 
+0x10e3fe828361439U, 0xf2ba72aefc777fc1U, 0xdef2c208f0f2d0d8U, 0xbed43ad129e3c77fU, 
+0x9a8700e6a1c4d15cU, 0x105ea7bf07c0e74bU, 0xa92c22c0c1254a44U, 0x35ea1b463fea79a5U, 
+0xdc939baf7f3fe1eaU, 0x5d633aa03065095eU, 0x7888fa5fd74d3b18U, 0xad2191651b9ed2cdU, 
+0x884fdff09475b7baU, 0xe039e730e4918b3dU, 0x3d3e57edf5018cdbU, 0x959396981943785cU, 
+0xe9b8abf87524f2fdU, 0x9c653f64c8709385U, 0x8ba0386a4b9cd684U, 0x2e7e552888c331ddU, 
+0x7275a940bc8f53bU, 0xd702226b391747c7U, 0xafe32ca7dd73d95eU, 0xcbee1405ff0da7deU, 
+0x2922e6b278c87f45U, 0xd9ff4f68126f728U, 0xb51f3e689b8294cfU, 0xf6211f4f4e75f902U, 
+0xa09c5dd90fd69985U, 0x9f309ccb6ddf72aeU, 0x788f690dfbcccf14U, 0xae97675ceb72f7eU, 
+0x89c8eb411409a003U, 0xd0b99d417aee1affU, 0xe9b8dfee051a54c5U, 0x91219973f6e48d14U, 
+0xf377c88b14b311ddU, 0x3de3beaefbd71b9cU, 0xdd580bfa0ba252e0U, 0xadd5bad28faaf5acU, 
+0x2f982f349d6c38dU, 0x52d4e1e7669b9b89U, 0x974e434f8359814fU, 0xe9c43cf4da3dc3a5U, 
+0x9dc193dfd9262b90U, 0xb723c4c1fe3cc29aU, 0xc9b65f1778025d1fU, 0x2b15862a5ac1612eU, 
+0x991996e6483d7557U, 0x6f534970f99489a4U, 0xa7a30d52da874906U, 0x2eb0053daa0a33faU, 
+0x4e75ae796078afb0U, 0x14ff12c6c4126197U, 0x248d4468c66d1707U, 0x209d6bcd766163b5U, 
+0x85d1b775a740b310U, 0x1edb79339f4e3e3U, 0xa0965baba9898a5bU, 0x1a2f13429e7b3280U, 
+0x93f9714ca8e7be40U, 0xf2d2c89491040ee5U, 0x7ee95c1616e4769aU, 0x6af9eaed1a96ee67U, 
+0xfa416e026e387e1cU, 0x45e3f666a0f59569U, 0x6709ea428347dc81U, 0xb3812a1169006649U, 
+0xf5f6400a0d7c0979U, 0x4a29b314bc5a8c96U, 0x3fa9df3dff41ced2U, 0x53f2432ba8171714U, 
+0xf9f7e90c537b36a2U, 0x4bd5a4f5c9e8b845U, 0xccd4e3e0911b07deU, 0xbd52effbc1f079b7U, 
+0xd26b6fa0f482801eU, 0x40794f8bc5bd4155U, 0xeb3aab424cb8d6f9U, 0x596668ee0444144eU, 
+0xd477148f04870c37U, 0x8db6c1cb63d3535aU, 0x1ec8f9608771304eU, 0x949aa0a85bbaef5fU, 
+0xef4040a588977063U, 0x65bf6f8bfb130c4fU, 0x61d50f83867e0fdbU, 0xa762e69e047f9a6fU, 
+0xa06369f8294f6ef1U, 0x958b48a396dfce62U, 0x81a1732d93372a89U, 0x6b98dd57cbed1157U, 
+0xe4c9b2e7c32c19fdU, 0x4acab8e9058028c3U, 0x2fdf4d17ab570b5bU, 0xbe84d1881b505076U, 
+0x67694a5372f1281fU, 0x7955a7f55e50dc37U, 0x4d1e65f483083994U, 0xeff960cb32dc5094U, 
+0xebcb0298df55a9bfU, 0xf6b015ef29ea5bf8U, 0x810307f601d7c578U, 0x726298eb9c6e3181U, 
+0xe116f8b0bc3accaeU, 0xbe797bcbc00673b4U, 0xa9835a2ef3d099e0U, 0x38d48801a9de9bfdU, 
+0xbd1b75fd56c69482U, 0xcbeab540132fa167U, 0x41f57274caf2bc88U, 0x9867a0314c0d7ee5U, 
+0x16f061146f792cd7U, 0x9e6245cf515628a9U, 0x9c792d55b1ba9963U, 0xd02e615a3b10834fU, 
+0x9957f2d841a7e7d2U, 0xa4c90e8c3efabd85U, 0x693af7555946de47U, 0xb934130f1339e48aU, 
+0xa4a991a898653d39U, 0xffd381dbe70dcc41U, 0xaa0929a5fbf78d1fU, 0x95233f6b9b2d0576U, 
+0x78a239d91d557aa1U, 0xdf1d92fecd01fc29U, 0x5927f2ea0099d6abU, 0xa866f24540d8815aU, 
+0x7981bbb4c1430634U, 0x61eb69c67c611a4bU, 0xd793d8fa5db0e139U, 0xb58739f6a8022b44U, 
+0xbb51340c9d82b151U, 0xcca0a43d561fba2dU, 0xd645a1153b109a8fU, 0xd2a63a50ae401e56U, 
+0xd4142174dcf89405U, 0xa70f750af484ca52U, 0x565aee58b2948220U, 0xe82d86fb6443fcb7U, 
+0x7c6c4bacca72da5fU, 0x22b9cd6b36c41349U, 0x23bc7202033725f9U, 0xbaf183a76100525eU, 
+0x377ce628a8f2a0cfU, 0x8e2336c5ca739361U, 0x5688bd58dd69b1d1U, 0xdeac9fbe9ccb4d33U, 
+0x7859f635ee4b3ba0U, 0x5c2abef5f18bf1f1U, 0xbefe170f31bf245fU, 0x41081105221ffb73U, 
+0x486961dc17525595U, 0x1336498565a06455U, 0xf2ca65ae1d6b8498U, 0xdc37f36976ff5668U, 
+0xfa5aca58c56c3943U, 0x5adbd02d56b76a5fU, 0x8f9332906e48f6fdU, 0xf7aef8a7e3844023U, 
+0x431f627facf442f1U, 0xeec30184a8dcd003U, 0x7c442bbdc3ab3fcfU, 0x4e3b0b44d5ffda79U, 
+0x4629c9b893d98dedU, 0xdbdf22833b8a0218U, 0xc8cf22990531d65eU, 0x63a2a210a16cc0c8U, 
+0x519197d4e0d1cfc2U, 0x1fabf6a009c7873aU, 0xd065033254ed9446U, 0x882b42e2e7fec76fU, 
+0x2089e66a000e5485U, 0x4513068bf5da5df0U, 0x8e2c708627320f12U, 0x1cd276d793a2bdffU, 
+0xca5cf051885fbd7fU, 0x99d0e270b209a4ecU, 0x8d4b34d4552e977fU, 0x6615bdd18b2eaf73U, 
+0xea861a50b8045445U, 0x80ff7371901e8d7eU, 0x3df12e2e5d57bef0U, 0xc15815d449d67caU, 
+0x214f87d54054a206U, 0xba3054e43658cea3U, 0xd0a93c3b6663cd28U, 0x2f30d60a3ae94115U, 
+0x1fac945711924459U, 0x7af2fa25a3c7a78cU, 0xc5a2e29f0dddbb1fU, 0xdfb547cb10019036U, 
+0xfa205e0dcc65fd9eU, 0x22af0930e5c031dcU, 0x8b8389ce9dc864ccU, 0x9accd2a9ba0f4708U, 
+0x1e91239cc3857fafU, 0x882fcade1e961970U, 0xd57ba8f4828ef7fU, 0xc757eb6b89ae8a9cU, 
+0x1d9db0ca0584ca4U, 0x627d310d101894c1U, 0x257369f208bec61bU, 0xf03a59cfcd23ff36U, 
+0x9a8bb3518ef8b517U, 0x77c2771a47171bacU, 0x95dbc8064a115e25U, 0x712022f7ccc4db24U, 
+0x48b7df28249da1acU, 0xa3603edf3bd79d77U, 0xae7101f9b0947541U, 0xbd578338de4de928U, 
+0xe4d184f5459225dU, 0x44faf77e2d8858d1U, 0xf815d409919c02a2U, 0xfa8063aeadafa0d0U, 
+0x3a2b7e3b7ece1507U, 0xa2b6c36d007c59cU, 0x160de220824c425cU, 0xba71f9057c0c069U, 
+0x3c753d59a90bc03eU, 0x84b0f39351e015e3U, 0x9e5a925f74450f80U, 0x2ceed8ed2c82072eU, 
+0x1cb72b8b7ab82adcU, 0x4a1df9cf20d53cd0U, 0xcd850eb7afc7daebU, 0xa4276b80e9b9de3eU, 
+0x9679fe9416f0d044U, 0xaaba9fd4909e61a7U, 0x9e2f69cf862ee0a5U, 0x658ca3c59d0257a8U, 
+0xadd1f32ef7cb872dU, 0x55a16763c418ce89U, 0xf165d62713bd376U, 0xae5cc1377aea2546U, 
+0x50cd4e3142aa2494U, 0x7bdcddfe7dd10c9aU, 0xdd1136e7c4ebbc82U, 0x379c749a4539e8ecU, 
+0x5befa9e8cec86c63U, 0x1364f6a7b7e85643U, 0x3c9c0ef1d6783f11U, 0xa25463848bf9c031U, 
+0xab5ac9573696756dU, 0x676af16056561417U, 0xce4c19835d3f305cU, 0x31c94b4aaf91f2baU, 
+0xabc45e8dde08ae78U, 0x83aedfcae6ad1070U, 0xbf4b8b59aaf41606U, 0xf80f884b556e83a9U, 
+0x3436f9b45617e073U, 0x6bacbdbd3839317bU, 0x90ee7896d7cfdc86U, 0x64587e2335471eb8U, 
+0x58299e5e9faf6589U, 0x85b90a39133aeab3U, 0xae96dd6447c299a1U, 0xd99fcdd5bf6902e2U, 
+0x44bcd88c4384480dU, 0x94e0b6a22a91f2efU, 0x2cf28b54c92f0c12U, 0xb866d6b142df940fU, 
+0xe659b470c4cafa8U, 0x24e522804b1d86d6U, 0x89a278d7ea9ad7acU, 0x1914b0b3426aeb70U, 
+0xadf714720e103dd6U, 0xc34604c07c004859U, 0x36a213cfc592a17aU, 0xbc477bd55a4203f8U, 
+0x639082d8d6f7c343U, 0x5d293572c63b44acU, 0x6cbac552c6dea639U, 0xe31e1e2429a8dd52U, 
+0xd229cda81db20d6cU, 0xe2d52ae4ed4fe455U, 0xc4d9d1646102ba87U, 0xec2bb89085de819eU, 
+0xa0e99c4d629cf4a0U, 0x33a2364be87efa98U, 0x332f66f0650940c6U, 0xccecc17661e013a1U, 
+0x7d0dc3b0d44eab31U, 0xac5af1404e63490U, 0x303b423267bf8e8U, 0x589db4fe5a6bb838U, 
+0x941aebe751361f6aU, 0x1f610e552148f8dbU, 0xf607062024bd90f3U, 0x6255445c108aa2a4U, 
+0x92d80b1836695f94U, 0x62a169c691627fa5U, 0xd0ccb8683af9a9cfU, 0xb1d25d51b4558f5fU, 
+0xa5b7eb9a5ee32736U, 0x60f6f18dab863edcU, 0xf7bea0ac19aba817U, 0x706dda72030e90b1U, 
+0x7bf961729a0c2c41U, 0x42831c1c560336c6U, 0xea8a1860ad6edb7cU, 0x1339b337d16e2fa2U, 
+0x185f054ba9f1bc2bU, 0x6b1227f87de923a4U, 0xa7a3240fd113a340U, 0x9f9b296362c7ae5bU, 
+0x38a60ecb23b09d0fU, 0xe50050640f50becfU, 0xd39d75ef5e545905U, 0x71c4a7e389e296ceU, 
+0x637b1f01720ddb62U, 0x786f2b084a62ffc7U, 0xaf3e0a292f810aaU, 0x1313fadb737af3baU, 
+0x3704b1f858fc47afU, 0xa8ddfec832c0cdecU, 0xcc50329b5001b568U, 0x7ff3bba11363cf17U, 
+0x7f86164cf9ba43a7U, 0x17a53b1ad18bac29U, 0xa0bc891b7473446bU, 0x1f6ba7ae8018a629U, 
+0xd1dc4cba9e41e20eU, 0x38a87a3d78d33864U, 0xbcb0f7f003a4d3e9U, 0xfc395dc4a5114dc8U, 
+0x77ad8cc2e7cf42eeU, 0x221475a685e4e2bU, 0x4ceb81a98bddb6d6U, 0x3866e09108d07d09U, 
+0x184d60095213775U, 0xb4293b23d42a99U, 0x6141e9395fec7f61U, 0x8ec670463ceb60bbU, 
+0xe010f3e7841ffffU, 0x71da98a0bccf51e9U, 0x6e643415cedee0eU, 0x8f58a66fa0da5be3U, 
+0x49971018b6f83231U, 0xb7c30d8e760425e3U, 0xa8d1582765b3fdd0U, 0x850f8cc53502ba26U, 
+0x4a031a9d5f2e8373U, 0xa85bfa17722d77fU, 0xd0bf7086b82cc789U, 0xbc4a9dbe02a79053U, 
+0x3cb3ff8d3452abbbU, 0xae6aa72fe2b95c2eU, 0x89dbac3fed95d495U, 0x83de61b441e701bbU, 
+0x8a05176b054eb66eU, 0xd79c5f36bbce4291U, 0xa6bfb6af8c4e1563U, 0x32f0e334a34c609fU, 
+0x88b11064df2e6ffaU, 0x46be9f37b7155763U, 0x1445bb6a94750d46U, 0x53fe8af98f9419fbU, 
+0x2a1eb37264e92eb5U, 0x5fb5f8e603bd70c2U, 0x1640cf6c4464de5cU, 0x9328817e7b515462U, 
+0xe9688c26f59276f1U, 0x33ae25b292a17b15U, 0x1a8bb5c00f7cd868U, 0x3d7663898f50c1dbU, 
+0x1e4a65b859cbcb3U, 0xf321982019b19786U, 0x60976e34dad8333eU, 0xd37669737a187ddbU, 
+0x358d6c86dd45e458U, 0x2f0aa6cea250e7fdU, 0xb3a546d3e549de04U, 0x8481bde0e4e4d885U, 
+0x6d64b1b59779057eU, 0x900a79c42b262e55U, 0x84a25bf39cecb2caU, 0x38ee7b8cba5404ddU, 
+0xe54433526ce9f114U, 0x392ed605299561ddU, 0x9fd43c6cd1d492bfU, 0x9629a450bd383a8bU, 
+0xca3972c4a24aa391U, 0xb925593e5c56af8dU, 0x576befd220cef64dU, 0xbf439b280c5fb6d7U, 
+0x160a0fa4152da17dU, 0x11dc13db08d0646bU, 0x894e6b05fe00bc8U, 0x3beaed1e0f518c5fU, 
+0xce704985ecc768d2U, 0x54cde77b8dfec416U, 0xfef4a8bebe80e1b5U, 0xc3b0d7f55aff7acdU, 
+0x83d38d9626ca6cc3U, 0x1477d747e187e183U, 0xeb1730da7cc893dfU, 0xb73b1c47ef1e4688U, 
+0xfac35d76a54fdba3U, 0x7322a25209757f5aU, 0xa57d64bbcc80509U, 0x584315cb294922a9U, 
+0x234fa17dba4edcc5U, 0xe74e3221420311b7U, 0x8752dfc039275997U, 0x6e73dba0cbdc9d61U, 
+0x7b31f7cdd59da0e4U, 0x278a77da70067903U, 0xbea4550888828693U, 0xee0ac1fc49eecc48U, 
+0xc1b9ad04d063e1beU, 0xa92429a2f7e39a75U, 0x722615253dbcf027U, 0x131641d11d602b14U, 
+0xfdd1ff3e21fec890U, 0xbd0faec0f9745b77U, 0x6a42e30fcdbd2bebU, 0x4c3bda61796039f0U, 
+0x409c4c424a80b979U, 0x490f5fa329abb31U, 0x7627d97eaa47c310U, 0x7706dd8937e5b592U, 
+0x14cf48104126cfdeU, 0x17fa0a34fd7efe32U, 0x7778dd7991ea9c71U, 0x8a02a9827d5bb714U, 
+0x9c6e2192d38f93e0U, 0xd05b2a3bb676899fU, 0x11f9892007a2fef7U, 0xedfe16b2db401803U, 
+0x3d01793de29405adU, 0x5b3d5100c46e227eU, 0x94d74faa4b05d0d2U, 0xee6902f1fca5db36U, 
+0xdcdb9c4b726fe285U, 0xa45bac29413ef127U, 0xd2f3c7a41f9e06aU, 0x16d422c5929bc0f8U, 
+0x33e0ffe6c155b441U, 0xe93f0c1137364d42U, 0xa8ab7e69a63531b1U, 0xdf888fa51e22641U, 
+0x5d3132b869e306a5U, 0xb8b5f624c4c247f1U, 0x4927129b35f2e5c6U, 0x972cb363f9f30c33U, 
+0xd061fd40b6e86295U, 0xb85702edccad4f35U, 0x5f9e77fe5bc65079U, 0xae634704e2df92aaU, 
+0xae310bcabacfa513U, 0x4e24079f9a60e3aeU, 0xaa5a344750f56a9cU, 0x1fcc0e47eec76d63U, 
+0x75075ba4107afc9cU, 0x4bededd164983918U, 0xb48e38754339f9b4U, 0x165dc1a041e35478U, 
+0xd12a03527c46e079U, 0xab66930b85e9c78dU, 0xfef75adb02ba374U, 0xab86c2ad2acfac53U, 
+0xec428bc17636ffe1U, 0xce7728e84850d7c0U, 0xcf5c46d4d73200c9U, 0x1209c286019f29abU, 
+0x21a2707cfedc69b2U, 0xa50a6089b26b7717U, 0x7306430435caa386U, 0xc12b9073ad6cb8a1U, 
+0x32ae9b020dd41ddU, 0xb8ee1dbe3d27b2a0U, 0xd9772dc89f894976U, 0x3173c43fe534cdf1U, 
+0xd3ec7bce9e341142U, 0x7ae684eb76472760U, 0x1ba1bd2179a11668U, 0xc6701c110c2da3b0U, 
+0x8924c6159e0f4dadU, 0x5d07fcba5bc9be57U, 0x52f869bbde19f5a1U, 0x2a020eb38d6cdd99U, 
+0xab6f585df961fe4dU, 0x8a14886f8b107197U, 0xa3f3e931312ca73eU, 0xd059bf85dc327a8fU, 
+0xb9935b066ae823c2U, 0xfd388ba1f4dab64cU, 0x3fe0765dc84955b4U, 0x45107a60c08b525eU, 
+0xbcd6303f6caf666bU, 0x7ffcfed3c4b1ce30U, 0x62b6979ae817f463U, 0x13464a57a78102aaU, 
+0x3f495a907f6ecc27U, 0x48f300a81d0942e1U, 0xef7e433453ccb0caU, 0x69be159004614580U, 
+0xc75849c6065084aeU, 0x9182be7dceabe577U, 0xec05c88c85fe12d1U, 0xeb3cf8f532245362U, 
+0x6f67c1fff96b9480U, 0xf52b45c5e7dbd2a6U, 0x43fe63dcefdca4a1U, 0xc833c78222d9d700U, 
+0xf216b2098eca5f51U, 0xddea171b94fc9aebU, 0x2c6ed6b2bf05b5cfU, 0xdde9d514dd9ee696U, 
+0x9ad69a73d0c638f7U, 0x50feebe8de89571fU, 0xd891f34b0a7f8f09U, 0xb84e69133ce28111U, 
+0xf8e5bcbcc2e9a5d0U, 0xa576fcf984a201d9U, 0x4f7a60f2184519b2U, 0xbdf1a67d092d9997U, 
+0xcdb4f7018562ff7bU, 0xa6280b61e5626461U, 0xa80be54a86bf7baaU, 0x4095902bab65a1aaU, 
+0x2f906b05999c88e4U, 0x9aed513e20ad46ecU, 0x6e9f406eb1204b17U, 0xfd1a621023699373U, 
+0x99c8c916595bc8dfU, 0xdc6b71d495cc00f2U, 0xfb13c06954977782U, 0x1ac97b54b9c8c20bU, 
+0x1ccc6a55a09b0ccaU, 0xa345758924a4d6f0U, 0xd5c454f68a28da59U, 0xd538cb1dbb0f4c8U, 
+0x731b147e0c929e05U, 0x8534cd99d89134c9U, 0xcb0a8d5c40eed7cfU, 0xc8196bac7a3ec110U, 
+0xbd515b5b5f8018ceU, 0xcf2da5738d892d68U, 0xf13ffce4f2c86dc7U, 0x4ee48531d8c296b9U, 
+0x3c35a61b1e48381fU, 0x71074971b4e80601U, 0xfc7b4408d0c7c5e6U, 0xb68f9ed4810bf8b5U, 
+0xbde5fc173b27e771U, 0x8c3b4196477da62aU, 0xcd5be267b64483b4U, 0x68856a6eddc4ec29U, 
+0x6118d62a07bbdab6U, 0x331d22f293b0733aU, 0x13b6fd49c19f7b4aU, 0x77a33df14f79a1fbU, 
+0x2852e91f1473678U, 0xcba05795094392f7U, 0xff5e314c55b8c070U, 0xfd76cc9c34c400dbU, 
+0x7e164eea8d144f4fU, 0x60628eee1401c843U, 0xe0fee0a73d032cd6U, 0xf2046543787143daU, 
+0xb5f00532cee66b24U, 0xe8b9c60fed7b8366U, 0x80e44d99bf1aded2U, 0x4cd5d8cfb9e9c7b8U, 
+0x221efdbaf40932fdU, 0xca61e45e12d2faedU, 0x9fe4e8c39cd6d103U, 0x576eae82deb94b55U, 
+0xdf00b7148d7a2193U, 0x2c691e44f197546eU, 0x19e6ce8274b4ea21U, 0x85a2aba33123b402U, 
+0x7f0c83d4b0cdcf3aU, 0xe1c6dadf9c3b1242U, 0xd82c6082d1cc029fU, 0x9c129857eb2b0516U, 
+0x6ae303ceedd7e577U, 0xd3a0f2568536c4d5U, 0x5ac6047270ea2107U, 0xc352d50f8828f7b2U, 
+0x3ca4ff88f8d9b570U, 0xa8abb2b6121706U, 0x6abd53145bce79fbU, 0xbe772838ba76b9b9U, 
+0x35b0305b377568b0U, 0x35ae8dd019e03b05U, 0x440b6d6c5783650fU, 0xd25ddbfc73cffe74U, 
+0x60a13926df39929cU, 0x832273881e3c3f00U, 0x8beaef74cde7d92bU, 0x7a3aff7593f84893U, 
+0xa33563e81e712536U, 0xa85051f56ff5fe71U, 0xe086de71ab635e9eU, 0x6914e86b0a43a9fU, 
+0x2a247713801128f1U, 0x896c226b0af7a9daU, 0x27d8aceae5ac28c0U, 0x2b7e792852d9bd05U, 
+0x55fe5118a71d7c13U, 0x641ab5f7fa0ffa38U, 0x55f07e9a97aac805U, 0x4581353143e94a72U, 
+0x9638bc553aff63cfU, 0x7020065542bd96b9U, 0xb57f50f177dd69c9U, 0x9f5858ec14979ad8U, 
+0xcada3a0d2d83f366U, 0xcd9ccede2f28588U, 0x9aef430bcc1dc97aU, 0xbc4a9df5b713fe2eU, 
+0xd758d666581f33c1U, 0xa6e8a9fbfa547b16U, 0x383937adf4b798caU, 0xd3a81ca6e785c06U, 
+0x282de545f3fceb19U, 0x2e89b221f785c409U, 0xabc5c7626ce7bab4U, 0xda433d5e11ceccc0U, 
+0x684e7120a6f5cc64U, 0x8e77fc2d9227b277U, 0x1debbdc4af95e521U, 0xe498dbd321a81030U, 
+0xb06a2e32f712be3cU, 0x7295f18eda146a66U, 0xd3c725dbab001534U, 0x39d7349d9331b378U, 
+0xcc3019f41c6ff65cU, 0xef5ef7a5eca41644U, 0xfb127554c66812e8U, 0x8f929b4f56ef3bf7U, 
+0x54de275c5acf692aU, 0xbcc4838a72207e06U, 0x1c1c116981c16efdU, 0x31e8e1ee9e8c7ecU, 
+0x9cc2a84eb16f667aU, 0x70649827c5bf73b0U, 0xd9d0970290d6743bU, 0xad7e7f5b465b353dU, 
+0x5aae4fbcdf77f22bU, 0xc699723994f82e03U, 0x9e51cd6c2995af26U, 0xf0cba617f7dc1dd0U, 
+0x1fc8e2c75909a03cU, 0x4f18c7e90a09566U, 0x9ef326c36516d040U, 0x1a25ab4313f9df98U, 
+0xdec0aa4a77829372U, 0xc49b300c88ba4553U, 0x313626ae5385796bU, 0xb4319cc90f3e0d3bU, 
+0x7729ccc00add5427U, 0x707b1215ca3e11bbU, 0xffb7afe09c21c5a2U, 0x4707d4499a6f502bU, 
+0x58acdcd4c6509c12U, 0x8d6bfe235bd1f476U, 0x21d170e8d87268edU, 0x381d7ab9db2154d3U, 
+0x54642a8e2eb46102U, 0x205828586ce6eaf7U, 0xeb5d24573a6581e7U, 0xa47aab5b7fda3da9U, 
+0x92bbd7ff81f488b6U, 0xe9c9bf363fc7a915U, 0x5d3e00d862657f73U, 0xa9878607a88d6115U, 
+0x495a7bbb031dab1dU, 0x39d0f01964ad5c6dU, 0x1c063e7c82157c22U, 0xd181a1abd58895d6U, 
+0x8db3b4d6384fe955U, 0xf69956a5a063bce4U, 0x4793b73e694c8a53U, 0xa703f05467ab87e6U, 
+0xa26b2efbd61344bdU, 0x539e1629c597277fU, 0xc0ea792d6b19199bU, 0xd500f935a2b047adU, 
+0xe64093b6c38a8cc6U, 0xba2e121e9f69f8fbU, 0x48e279ff6ed7f3dcU, 0x331924c750b3417eU, 
+0xc4e8e0fb46587810U, 0x7fb99e9ace9e9b54U, 0x2ba5b601be2ffb31U, 0xca8f79411b33f018U, 
+0x3499656c06eace58U, 0x1b7e4563a2f3211dU, 0x46c6ad0d7053a03fU, 0x73c6b3c5aad550d7U, 
+0x7170a9172af8654eU, 0xaa6a878dbbb8d291U, 0x1ba90991366d91c6U, 0x3a2fb4a4733a4f74U, 
+0xf4bf1126cdcbcb9eU, 0xd6fa5689dcd83c3dU, 0x9ecc32447fd43761U, 0xcdcb12d7119d337aU, 
+0xa08a585ac961cfd1U, 0xa199af24358df340U, 0xbfefbea096de9949U, 0xe699e2e17bb9f11fU, 
+0x54b388bf00181d5eU, 0xde71b3a9b95aaf20U, 0xa1d00d3a1c0eddb8U, 0xc627f3e7506d47fdU, 
+0x927900a6369f886dU, 0x8ef6b00549cbe2c3U, 0xb2d6960138a1f7d6U, 0xd78f9dd71e442a63U, 
+0x1d747cf7325fe9ccU, 0xfbb883bb349d88dbU, 0x3704110842d4ac23U, 0xc6ed5e6328ec31b1U, 
+0xc0bce1c4a8fd94bU, 0x844f972b60f22cf1U, 0x2932ee125c7f7b2aU, 0xde47405b49d7f830U, 
+0x34e28d9fb7828b16U, 0xa047958f28a4847fU, 0xfa25f40a6f06de53U, 0xbb88fabe0edfd233U, 
+0xc51473a20aea5df7U, 0xec4a8174e3a1e969U, 0x345dc59601159163U, 0xb73676b304f5e8ddU, 
+0x954ab30fe5324caaU, 0x694b65e30a9472a3U, 0xd23d8c749452a32eU, 0x8c28a97bf8298bc0U, 
+0x9e71dc73cbef9482U, 0x7ae784f0451cb945U, 0x378fedf31f7cc0ebU, 0x40a30463a3305193U, 
+0x5dfb201f7611d8e2U, 0xc8130fe8de49fc4dU, 0x96bed5a6047f0da2U, 0xab1ac1872a38a2f1U, 
+0x1a581f3c429d15bU, 0xf7ef93d33e1e545fU, 0xe9aa5f39db6a42b6U, 0x13f4a37a324d17a1U, 
+0x863e87154754dd40U, 0xa2422631fc3466cfU, 0x45b4841fcd72f6e9U, 0x9729247032c0dfcfU, 
+0x384b492f2aa36143U, 0x90dae85255acaf49U, 0xcd15c75dcbd4df36U, 0x91d1a244265fea1dU, 
+0x226aee642651b3faU, 0x8ea1b365772df434U, 0x3703a607253f31efU, 0x2564fe9b5beef82dU, 
+0xdb82e6a301e5122dU, 0x14f37dab6b79816eU, 0x95fa14ae1203925fU, 0x8ad9f7a606783890U, 
+0x3c2d82eb8c2ca7ffU, 0x1803645d95df021aU, 0x50791ad5a2f27afU, 0x89637f97580a796eU, 
+0xbed415e170493e68U, 0xf87bc6a38e42eab7U, 0xd57b9cf154357489U, 0x2d1fe1248c888424U, 
+0x57c35330c7a89eeU, 0x4bdbc59c7ab6d4f8U, 0x12860b88fc98658aU, 0x71efa4e26a4179e1U, 
+0x4f489329c1366a2eU, 0x2aaafab88e5e9a0bU, 0x9efb2c32b17294a2U, 0x145fa81f8bb624aeU, 
+0x6186d63a0ca8dd7fU, 0x1bc7280356a1381aU, 0x2fdc9da03d535742U, 0x308138e71be25e09U, 
+0xe415f2478a92c7f2U, 0xc8165646434ad915U, 0x5e39ec45d1408e18U, 0x28d1e2d28828fc92U, 
+0xb178e3d3ae180068U, 0x7ea3d56c20bd3103U, 0xbfc6c5c0c30dc01aU, 0xff3d6136ffac5b0cU, 
+0x70a6bb6e188c6077U, 0x547676f24001f5e6U, 0x40d0372cdd96adc1U, 0x133239be84e4000eU, 
+0xc0dcc568866a3fb1U, 0x6ec009281992e206U, 0xd1e5750c85b6862fU, 0x575fc4e82a6deb65U, 
+0x9b8e90a902655adU, 0xed33b573c6a3af2fU, 0xd671dbc2978e87daU, 0x6f6edb9042a6fca2U, 
+0x954e7fdcbd21250aU, 0xdf45e17583998ad4U, 0x531e342ba43555e7U, 0x3fa915480bab8ad2U, 
+0x91c86c02faa76731U, 0x2e45e55a032b5fb7U, 0xcf5bdf9603bb127cU, 0xbf9b66905499b030U, 
+0x21b6a8a4790117dfU, 0xda253bbbce201029U, 0x227f26f81eea2a8fU, 0xa5ec9036b64eab7aU, 
+0xd8128133f86462feU, 0x1c8461f05614a363U, 0xc597983ad1fa0f7U, 0xb79dc6625ec14040U, 
+0x5cb023498de0545fU, 0x80e625da2106c74fU, 0xa375ea004b3508acU, 0x52045bcc58e07124U, 
+0x36ea34c0506c3d91U, 0x793b9d0f2a8fdaf2U, 0xd430ed9c20ce312bU, 0x1b3f31fcebe3123aU, 
+0xb0f975c172ad712U, 0x5a398cb0de104729U, 0x49de7976146349b9U, 0xa153dfe913310b09U, 
+0xc8a5f6538d48fdd2U, 0xbd053f285af0b329U, 0xc48318d5f1f1b89aU, 0xfd94d8413fb05b2fU, 
+0x89f13d0c3220479fU, 0x5de47b95e5e5b38aU, 0x80162c8d23760363U, 0x58b5436ebe472fdbU, 
+0x44a7375e567db17aU, 0x96af27c4829bb341U, 0x4e2913a252f6de83U, 0x85d7b6b055cd672cU, 
+0x30c370111cf5b3aU, 0xc4433a83bdb5a781U, 0x935c34d088edc824U, 0x9a541ac6af794615U, 
+0x63f5575f36a44ae4U, 0x5548fee2521ea52dU, 0xcafe1af3688f475fU, 0xb66148c1cb106ab7U, 
+0x48c4ba111faccae0U, 0x3c8b350c5a4bb337U, 0xc1dd94ce4f071fd2U, 0x8ea9666139527a8U, 
+0x55af34a30e62b945U, 0x35b783be9cf0f8e9U, 0xe24e7c0cfb95c5d7U, 0x620efabbc8ee2782U, 
+0xa293131da190b632U, 0x63cf2a23a4ab5ab9U, 0xf3a66df315559d82U, 0xc25f637176220cd9U, 
+0x6eebf3d6fc9590cfU, 0xa9f04ff9e027a1dU, 0x989049903809d798U, 0x53154fede94d2873U, 
+0x21a40b5966a06f5eU, 0xa34192516ea08370U, 0xc37b0d421263b716U, 0x383b24fbea14253aU, 
+0x89f4786d3c6e772U, 0xe8f6ae74bb8c2b04U, 0x44cf566d54ea5a19U, 0x54cf706ac4edba20U, 
+0xe2ccb3b7d466d561U, 0xc7b55dc31978b4dU, 0x3e82d82a5688544cU, 0x2a9e8dfe3cce6babU, 
+0xf96ccf5252e76373U, 0x5e01eaec17a02182U, 0xbac7b5ad608b96cfU, 0x1dfeda5c16e651fU, 
+0xc7975c1d4638a136U, 0x2b0d1ce336838195U, 0x789e59c6b60d790cU, 0xe68432d03e02ed6dU, 
+0xaafd18108c6c2584U, 0x2e09e3ebdb357336U, 0x24d2a7303a01e647U, 0xca5be41398e35a66U, 
+0x2139b408dbcf2dceU, 0x68114a105c1dc6c0U, 0xbd49e4c992ff9980U, 0x95e62d4292e46218U, 
+0x62bddfdf58c86594U, 0x5e7b30603704d20eU, 0x183a26e2b428d52eU, 0x6b68184296c2875U, 
+0x7ce87c4416e8c10cU, 0xb472985f391bd680U, 0xeefbdece7306e7fU, 0x395dd559e2fe5c2aU, 
+0xbc3d6d9305fe638eU, 0x4c909c04dc66922cU, 0xd0413e87affa4e27U, 0xfd62dcd4b4592ac5U, 
+0xe8bd32043f8be384U, 0x71ec0aada31db6c3U, 0x251ad6c94fdef072U, 0xb23790a42be63e1bU, 
+0xd10a473deb19880eU, 0x17f004f4149ecb58U, 0xe8d50f88aa81f945U, 0xfc6b694919d55edbU, 
+0x51664db20d6c14efU, 0x858fc7506f93c8fU, 0x9f6eed5beee26480U, 0x7a514adc35525dcbU, 
+0x7ad3e1870b3fbd13U, 0x29beaef72aa6e24fU, 0xe897f0b94c8f5c37U, 0x56edd1fed152e4d8U, 
+0xff9f053d097ec94bU, 0x27ed7091c8d59c2dU, 0x1ee215aa8ae68181U, 0xb2113bcb7b4aefedU, 
+0xbd5fbffc687831adU, 0x943220b2357d0fdU, 0x105a0b53454cb4ebU, 0x93be9e7399e8ee73U, 
+0x4a9463d04f6d65ebU, 0x5a99107754402152U, 0x8ea8ef3bf4908f23U, 0x1ee1fd584325d90dU, 
+0x1e036b925d22941cU, 0xca32f4e9863582b1U, 0x1cfab9fc4f42fcfaU, 0xbb692891bdd6c73cU, 
+0xb805264597a6257fU, 0x1873c3b1a27a6c40U, 0xa6424274ab07e789U, 0x71e935c8e1f54f25U, 
+0x5b217461d1b1e582U, 0xef2523540cf70f7aU, 0x3ded86ba47ae2a52U, 0x78d93e59f47c2251U, 
+0x1f1950ef0e36cb44U, 0x617e8b6c8dca2019U, 0xbc058fd0d883357dU, 0x15515634d38faaa8U, 
+0x329af4651f495a68U, 0xa8c37175f020c1e5U, 0xe370e3f0b463205dU, 0xab4fffc755575215U, 
+0xbf08472479ca950eU, 0x39e015762bb13bacU, 0xc52f8be79ee2c461U, 0xabc451ca4ee795caU, 
+0x7ce7d8c9a9490d2U, 0x52684000cea553ecU, 0xdb1dfb80c2c91456U, 0xae2718befe820a59U, 
+0x51f946107427baccU, 0x9e733164dd2d62e1U, 0x36358eb0958dc4aaU, 0x3bc6bc6446bf5201U, 
+0x14c33fd5ead6fda6U, 0xd71b75a5228beb47U, 0xcdb62ee226d6c02bU, 0x8e305cc07176c305U, 
+};
+
+static const unsigned char Generator_Table_Infinity_Flags_secp256k1[] =
+{
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+
+};
+
+const TCurvesRegistryEntry Curves_Registry_Entries[] =
+{
+	{"w256-001", 4, Parameters_w256_001, 4, 64, Generator_Table_Points_w256_001, Generator_Table_Infinity_Flags_w256_001},
+	{"Test", 1, Parameters_Test, 4, 7, Generator_Table_Points_Test, Generator_Table_Infinity_Flags_Test},
+	{"P-256", 4, Parameters_P_256, 4, 64, Generator_Table_Points_P_256, Generator_Table_Infinity_Flags_P_256},
+	{"secp256k1", 4, Parameters_secp256k1, 4, 64, Generator_Table_Points_secp256k1, Generator_Table_Infinity_Flags_secp256k1},
+};
+
+const int Curves_Registry_Entries_Count = 4;
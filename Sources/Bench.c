@@ -0,0 +1,635 @@
+/** @file Bench.c
+ * Time every elliptic curve primitive on several curves. Each operation is warmed up, then measured by samples until the samples are stable.
+ * The results are displayed as a table or as JSON (with -json) so they can be compared between two builds.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Curves_Registry.h"
+#include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Models.h"
+#include "Encodings.h"
+#include "Modular_Inversion.h"
+#include "Network.h"
+#include "Point.h"
+#include "Protocols.h"
+#include "Scalar_Field.h"
+#include "Schnorr_Signature.h"
+#include "Utils.h"
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Minimum duration of a sample in nanoseconds, the iterations count is doubled until a sample lasts this long. */
+#define BENCH_MINIMUM_SAMPLE_DURATION 10000000LL
+/** How long an operation is run before being measured (in nanoseconds). */
+#define BENCH_WARM_UP_DURATION 50000000LL
+/** Minimum amount of samples per operation. */
+#define BENCH_MINIMUM_SAMPLES_COUNT 5
+/** Maximum amount of samples per operation, the measure is reported as unstable if this count is reached. */
+#define BENCH_MAXIMUM_SAMPLES_COUNT 50
+/** The measure is stable when the relative standard deviation of the last samples is lower than this value. */
+#define BENCH_MAXIMUM_RELATIVE_DEVIATION 0.02
+/** How many bytes are hashed by the hashing benchmark. */
+#define BENCH_HASHED_DATA_SIZE 1024
+/** How many random points and factors the operations cycle through. */
+#define BENCH_OPERANDS_COUNT 16
+/** How many bytes of the random data are hashed to a curve point. */
+#define BENCH_HASHED_MESSAGE_SIZE 32
+/** How many signatures a batch verification checks, they are made by BENCH_OPERANDS_COUNT signers in turn. */
+#define BENCH_SIGNATURES_COUNT 1024
+/** The longest decimal string of a number below 2^MODULAR_INVERSION_MAXIMUM_BITS, with its terminating zero (log10(2) < 1/3). */
+#define BENCH_MAXIMUM_DECIMAL_NUMBER_SIZE (MODULAR_INVERSION_MAXIMUM_BITS / 3 + 2)
+
+/** The curves measured when none is given on the command line. */
+static char *Bench_Default_Curves[] = {"../Curves/Test.gp", "../Curves/w256-001.gp", "../Curves/Ed25519.gp", "../Curves/Curve25519.gp"};
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Everything the measured operations work on. */
+typedef struct
+{
+	TEllipticCurve Curve; //! The curve the operations are done on.
+	TPoint Points[BENCH_OPERANDS_COUNT]; //! Random points of the curve.
+	TPoint Model_Points[BENCH_OPERANDS_COUNT]; //! The same points in the curve model coordinates, so the model formulas can be compared to the Weierstrass ones.
+	mpz_t Factors[BENCH_OPERANDS_COUNT]; //! Random numbers in [0, n - 1].
+	TScalar Scalars[BENCH_OPERANDS_COUNT]; //! The factors converted to scalars.
+	TPoint Point_Result; //! Where to store the operations result.
+	TPoint Points_Results[BENCH_OPERANDS_COUNT]; //! Where to store the batch operations results.
+	unsigned char Data[BENCH_HASHED_DATA_SIZE]; //! Random data to hash.
+	int Sockets[2]; //! A connected pair of sockets, points are sent on the first one and received from the second one.
+	TECMapToCurve Map; //! The map from the field elements to the curve points.
+	char Is_Map_Usable; //! Tell if the curve supports the map, the map operations are skipped otherwise.
+	mpz_t Hashes[BENCH_SIGNATURES_COUNT]; //! Random messages hashes.
+	TPoint Public_Keys[BENCH_SIGNATURES_COUNT]; //! The signer public key of each signature.
+	TSchnorrSignature Signatures[BENCH_SIGNATURES_COUNT]; //! The Schnorr signatures of the hashes.
+	unsigned char Raw_Signatures[BENCH_SIGNATURES_COUNT * ENCODING_MAXIMUM_RAW_SIGNATURE_SIZE]; //! The hashes and the Schnorr 's' numbers stored as raw signatures.
+	size_t Raw_Signatures_Size; //! The raw signatures size in bytes.
+	unsigned char DER_Signatures[BENCH_SIGNATURES_COUNT * ENCODING_MAXIMUM_DER_SIGNATURE_SIZE]; //! The same signatures in DER form.
+	size_t DER_Signatures_Size; //! The DER signatures size in bytes.
+	char Decimal_Signatures[BENCH_SIGNATURES_COUNT * 2 * BENCH_MAXIMUM_DECIMAL_NUMBER_SIZE]; //! The same signatures numbers as the zero terminated decimal strings the network functions send.
+	size_t Decimal_Signatures_Size; //! The decimal signatures size in bytes.
+} TBenchContext;
+
+/** Run an operation many times.
+ * @param Pointer_Context The operands.
+ * @param Iterations_Count How many times to run the operation.
+ */
+typedef void (*TBenchFunction)(TBenchContext *Pointer_Context, long long Iterations_Count);
+
+/** An operation to measure. */
+typedef struct
+{
+	char *String_Name; //! The operation name.
+	TBenchFunction Function; //! The function running the operation.
+} TBenchOperation;
+
+/** The measure of an operation. */
+typedef struct
+{
+	double Nanoseconds_Per_Operation; //! Mean duration of an operation on the last samples.
+	double Cycles_Per_Operation; //! Mean processor cycles count of an operation (negative if the processor has no cycles counter).
+	double Relative_Deviation; //! Standard deviation of the last samples divided by their mean.
+	long long Operations_Count; //! How many operations were measured.
+	int Samples_Count; //! How many samples were taken.
+	int Is_Stable; //! Tell if the relative deviation went below BENCH_MAXIMUM_RELATIVE_DEVIATION.
+} TBenchResult;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Get a monotonic time.
+ * @return The time in nanoseconds.
+ */
+static inline long long BenchGetTime(void)
+{
+	struct timespec Time;
+	
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return (long long) Time.tv_sec * 1000000000LL + Time.tv_nsec;
+}
+
+/** Read the processor cycles counter.
+ * @return The cycles count or 0 if the processor has no readable counter.
+ */
+static inline unsigned long long BenchGetCycles(void)
+{
+	#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+	#else
+		return 0;
+	#endif
+}
+
+/** Add two distinct points (see TBenchFunction). */
+static void BenchAddition(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECAddition(&Pointer_Context->Curve, &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Points[(i + 1) % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Double points, ECDouble() is private so it is reached through ECAddition() with twice the same point (see TBenchFunction). */
+static void BenchDoubling(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECAddition(&Pointer_Context->Curve, &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Multiply random points (see TBenchFunction). */
+static void BenchMultiplication(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECMultiplication(&Pointer_Context->Curve, &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT], Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Multiply the generator (see TBenchFunction). */
+static void BenchMultiplicationGenerator(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECMultiplicationGenerator(&Pointer_Context->Curve, Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Multiply the X coordinate of a point (see TBenchFunction). */
+static void BenchMultiplicationXOnly(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECMultiplicationXOnly(&Pointer_Context->Curve, Pointer_Context->Points[i % BENCH_OPERANDS_COUNT].X, Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], Pointer_Context->Point_Result.X);
+}
+
+/** Add two points of a twisted Edwards curve with the model unified formulas (see TBenchFunction). */
+static void BenchEdwardsAddition(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECModelsEdwardsAddition(&Pointer_Context->Curve, &Pointer_Context->Model_Points[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Model_Points[(i + 1) % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Multiply a point of a twisted Edwards curve with the model ladder (see TBenchFunction). */
+static void BenchEdwardsMultiplication(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECModelsEdwardsMultiplication(&Pointer_Context->Curve, &Pointer_Context->Model_Points[i % BENCH_OPERANDS_COUNT], Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Point_Result);
+}
+
+/** Multiply the X coordinate of a point of a Montgomery curve with the X25519 ladder (see TBenchFunction). */
+static void BenchMontgomeryLadder(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECModelsMontgomeryLadder(&Pointer_Context->Curve, Pointer_Context->Model_Points[i % BENCH_OPERANDS_COUNT].X, Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], Pointer_Context->Point_Result.X);
+}
+
+/** Multiply the generator by batches of BENCH_OPERANDS_COUNT factors, an iteration is one multiplication of a batch (see TBenchFunction). */
+static void BenchMultiplicationGeneratorBatch(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i += BENCH_OPERANDS_COUNT) ECMultiplicationGeneratorBatch(&Pointer_Context->Curve, Pointer_Context->Factors, Iterations_Count - i < BENCH_OPERANDS_COUNT ? Iterations_Count - i : BENCH_OPERANDS_COUNT, Pointer_Context->Points_Results);
+}
+
+/** Invert the X coordinates of the random points.
+ * @param Pointer_Context The operands.
+ * @param Iterations_Count How many inversions to do.
+ * @param Method The inversion method.
+ */
+static void BenchInvertFieldElements(TBenchContext *Pointer_Context, long long Iterations_Count, int Method)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ModularInversionInvertNumber(&Pointer_Context->Curve.Field_Inversion, Method, Pointer_Context->Points[i % BENCH_OPERANDS_COUNT].X, Pointer_Context->Point_Result.X);
+}
+
+/** Invert the random scalars.
+ * @param Pointer_Context The operands.
+ * @param Iterations_Count How many inversions to do.
+ * @param Method The inversion method.
+ */
+static void BenchInvertScalars(TBenchContext *Pointer_Context, long long Iterations_Count, int Method)
+{
+	TScalarField *Pointer_Field = &Pointer_Context->Curve.Scalar_Field;
+	TScalar Scalar;
+	long long i;
+	int Default_Method = Pointer_Field->Inversion_Method;
+	
+	Pointer_Field->Inversion_Method = Method;
+	for (i = 0; i < Iterations_Count; i++) ScalarFieldInvert(Pointer_Field, &Pointer_Context->Scalars[i % BENCH_OPERANDS_COUNT], &Scalar);
+	Pointer_Field->Inversion_Method = Default_Method;
+}
+
+/** Invert field elements with the safegcd algorithm (see TBenchFunction). */
+static void BenchFieldInversionSafegcd(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertFieldElements(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_SAFEGCD);
+}
+
+/** Invert field elements with Fermat's little theorem (see TBenchFunction). */
+static void BenchFieldInversionFermat(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertFieldElements(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_FERMAT);
+}
+
+/** Invert field elements with mpz_invert() (see TBenchFunction). */
+static void BenchFieldInversionGMP(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertFieldElements(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_GMP);
+}
+
+/** Invert scalars with the safegcd algorithm (see TBenchFunction). */
+static void BenchScalarInversionSafegcd(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertScalars(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_SAFEGCD);
+}
+
+/** Invert scalars with Fermat's little theorem and the Barrett multiplication, the result is meaningless for the composite n of a test curve (see TBenchFunction). */
+static void BenchScalarInversionFermat(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertScalars(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_FERMAT);
+}
+
+/** Invert scalars with mpz_invert() (see TBenchFunction). */
+static void BenchScalarInversionGMP(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchInvertScalars(Pointer_Context, Iterations_Count, MODULAR_INVERSION_METHOD_GMP);
+}
+
+/** Check that points lie on the curve (see TBenchFunction). */
+static void BenchIsPointOnCurve(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECIsPointOnCurve(&Pointer_Context->Curve, &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT]);
+}
+
+/** Map field elements (the random points X coordinates) to curve points (see TBenchFunction). */
+static void BenchMapToCurve(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECMapToCurve(&Pointer_Context->Curve, &Pointer_Context->Map, Pointer_Context->Points[i % BENCH_OPERANDS_COUNT].X, &Pointer_Context->Point_Result);
+}
+
+/** Hash messages to curve points (see TBenchFunction). */
+static void BenchHashToCurve(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) ECHashToCurve(&Pointer_Context->Curve, &Pointer_Context->Map, Pointer_Context->Data + i % BENCH_OPERANDS_COUNT, BENCH_HASHED_MESSAGE_SIZE, &Pointer_Context->Point_Result);
+}
+
+/** Verify Schnorr signatures one at a time (see TBenchFunction). */
+static void BenchSchnorrVerify(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) SchnorrSignatureVerify(&Pointer_Context->Curve, Pointer_Context->Hashes[i % BENCH_SIGNATURES_COUNT], &Pointer_Context->Public_Keys[i % BENCH_SIGNATURES_COUNT], &Pointer_Context->Signatures[i % BENCH_SIGNATURES_COUNT]);
+}
+
+/** Verify all Schnorr signatures at once, an iteration is the verification of the whole batch (see TBenchFunction). The batch can't be split like the generator multiplications batch,
+ * because the batch size changes the multi-scalar multiplication window and so the cost of each signature.
+ */
+static void BenchSchnorrVerifyBatch(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) SchnorrSignatureVerifyBatch(&Pointer_Context->Curve, Pointer_Context->Hashes, Pointer_Context->Public_Keys, Pointer_Context->Signatures, BENCH_SIGNATURES_COUNT);
+}
+
+/** Parse a buffer of signatures, an iteration converts one signature and the buffer is walked again once its end is reached (see TBenchFunction).
+ * @param Pointer_Context The operands.
+ * @param Iterations_Count How many signatures to parse.
+ * @param Format ENCODING_SIGNATURE_FORMAT_RAW or ENCODING_SIGNATURE_FORMAT_DER.
+ */
+static void BenchParseSignatures(TBenchContext *Pointer_Context, long long Iterations_Count, int Format)
+{
+	TEncodingSignatureParser Parser;
+	TEncodingSignatureView View;
+	long long i;
+	
+	if (Format == ENCODING_SIGNATURE_FORMAT_RAW) EncodingSignatureParserInitialize(&Pointer_Context->Curve, Format, Pointer_Context->Raw_Signatures, Pointer_Context->Raw_Signatures_Size, &Parser);
+	else EncodingSignatureParserInitialize(&Pointer_Context->Curve, Format, Pointer_Context->DER_Signatures, Pointer_Context->DER_Signatures_Size, &Parser);
+	
+	for (i = 0; i < Iterations_Count; i++)
+	{
+		if (!EncodingSignatureParserNext(&Parser, &View))
+		{
+			Parser.Offset = 0;
+			EncodingSignatureParserNext(&Parser, &View);
+		}
+		EncodingImportSignatureView(&View, Pointer_Context->Point_Result.X, Pointer_Context->Point_Result.Y);
+	}
+}
+
+/** Parse raw signatures (see TBenchFunction). */
+static void BenchParseRawSignatures(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchParseSignatures(Pointer_Context, Iterations_Count, ENCODING_SIGNATURE_FORMAT_RAW);
+}
+
+/** Parse DER signatures (see TBenchFunction). */
+static void BenchParseDERSignatures(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	BenchParseSignatures(Pointer_Context, Iterations_Count, ENCODING_SIGNATURE_FORMAT_DER);
+}
+
+/** Parse the decimal strings of signatures, the way they were exchanged before the binary encodings (see TBenchFunction). */
+static void BenchParseDecimalSignatures(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	size_t Offset = 0;
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++)
+	{
+		if (Offset >= Pointer_Context->Decimal_Signatures_Size) Offset = 0;
+		mpz_set_str(Pointer_Context->Point_Result.X, Pointer_Context->Decimal_Signatures + Offset, 10);
+		Offset += strlen(Pointer_Context->Decimal_Signatures + Offset) + 1;
+		mpz_set_str(Pointer_Context->Point_Result.Y, Pointer_Context->Decimal_Signatures + Offset, 10);
+		Offset += strlen(Pointer_Context->Decimal_Signatures + Offset) + 1;
+	}
+}
+
+/** Hash a data buffer (see TBenchFunction). */
+static void BenchHash(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	unsigned char Buffer_Hash[UTILS_HASH_LENGTH];
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++) UtilsComputeHash(Pointer_Context->Data, sizeof(Pointer_Context->Data), Buffer_Hash);
+}
+
+/** Send a point and receive it back through the sockets pair (see TBenchFunction). */
+static void BenchNetworkPoint(TBenchContext *Pointer_Context, long long Iterations_Count)
+{
+	long long i;
+	
+	for (i = 0; i < Iterations_Count; i++)
+	{
+		NetworkSendPoint(Pointer_Context->Sockets[0], &Pointer_Context->Points[i % BENCH_OPERANDS_COUNT]);
+		NetworkReceivePoint(Pointer_Context->Sockets[1], &Pointer_Context->Point_Result);
+	}
+}
+
+/** All measured operations. */
+static TBenchOperation Bench_Operations[] =
+{
+	{"ECAddition", BenchAddition},
+	{"ECDouble", BenchDoubling},
+	{"ECMultiplication", BenchMultiplication},
+	{"ECMultiplicationGenerator", BenchMultiplicationGenerator},
+	{"ECMultiplicationGeneratorBatch", BenchMultiplicationGeneratorBatch},
+	{"ECMultiplicationXOnly", BenchMultiplicationXOnly},
+	{"ECModelsEdwardsAddition", BenchEdwardsAddition},
+	{"ECModelsEdwardsMultiplication", BenchEdwardsMultiplication},
+	{"ECModelsMontgomeryLadder", BenchMontgomeryLadder},
+	{"ECIsPointOnCurve", BenchIsPointOnCurve},
+	{"ECMapToCurve", BenchMapToCurve},
+	{"ECHashToCurve", BenchHashToCurve},
+	{"SchnorrSignatureVerify", BenchSchnorrVerify},
+	{"SchnorrVerifyBatchOf1024", BenchSchnorrVerifyBatch},
+	{"EncodingParseRawSignature", BenchParseRawSignatures},
+	{"EncodingParseDERSignature", BenchParseDERSignatures},
+	{"DecimalParseSignature", BenchParseDecimalSignatures},
+	{"FieldInversionSafegcd", BenchFieldInversionSafegcd},
+	{"FieldInversionFermat", BenchFieldInversionFermat},
+	{"FieldInversionGMP", BenchFieldInversionGMP},
+	{"ScalarInversionSafegcd", BenchScalarInversionSafegcd},
+	{"ScalarInversionFermat", BenchScalarInversionFermat},
+	{"ScalarInversionGMP", BenchScalarInversionGMP},
+	{"UtilsComputeHash", BenchHash},
+	{"NetworkSendReceivePoint", BenchNetworkPoint}
+};
+
+/** Warm an operation up and measure it until the samples are stable.
+ * @param Pointer_Context The operands.
+ * @param Pointer_Operation The operation to measure.
+ * @param Pointer_Result On output, contain the measure.
+ */
+static void BenchMeasure(TBenchContext *Pointer_Context, TBenchOperation *Pointer_Operation, TBenchResult *Pointer_Result)
+{
+	double Samples[BENCH_MAXIMUM_SAMPLES_COUNT], Cycles[BENCH_MAXIMUM_SAMPLES_COUNT], Mean, Mean_Cycles, Variance;
+	long long Iterations_Count = 1, Start_Time, Elapsed_Time;
+	unsigned long long Start_Cycles;
+	int Samples_Count, i, First_Sample;
+	
+	// Find how many iterations a sample needs and warm the caches and the processor frequency up at the same time
+	Start_Time = BenchGetTime();
+	while (1)
+	{
+		Elapsed_Time = BenchGetTime();
+		Pointer_Operation->Function(Pointer_Context, Iterations_Count);
+		Elapsed_Time = BenchGetTime() - Elapsed_Time;
+		if ((Elapsed_Time >= BENCH_MINIMUM_SAMPLE_DURATION) && (BenchGetTime() - Start_Time >= BENCH_WARM_UP_DURATION)) break;
+		if (Elapsed_Time < BENCH_MINIMUM_SAMPLE_DURATION) Iterations_Count *= 2;
+	}
+	
+	// Take samples until the last ones are close enough
+	Pointer_Result->Is_Stable = 0;
+	for (Samples_Count = 0; Samples_Count < BENCH_MAXIMUM_SAMPLES_COUNT; )
+	{
+		Start_Cycles = BenchGetCycles();
+		Start_Time = BenchGetTime();
+		Pointer_Operation->Function(Pointer_Context, Iterations_Count);
+		Elapsed_Time = BenchGetTime() - Start_Time;
+		Cycles[Samples_Count] = (double) (BenchGetCycles() - Start_Cycles) / Iterations_Count;
+		Samples[Samples_Count] = (double) Elapsed_Time / Iterations_Count;
+		Samples_Count++;
+		if (Samples_Count < BENCH_MINIMUM_SAMPLES_COUNT) continue;
+	
+		// Compute the statistics of the last samples
+		First_Sample = Samples_Count - BENCH_MINIMUM_SAMPLES_COUNT;
+		Mean = Mean_Cycles = Variance = 0;
+		for (i = First_Sample; i < Samples_Count; i++)
+		{
+			Mean += Samples[i];
+			Mean_Cycles += Cycles[i];
+		}
+		Mean /= BENCH_MINIMUM_SAMPLES_COUNT;
+		Mean_Cycles /= BENCH_MINIMUM_SAMPLES_COUNT;
+		for (i = First_Sample; i < Samples_Count; i++) Variance += (Samples[i] - Mean) * (Samples[i] - Mean);
+		Variance /= BENCH_MINIMUM_SAMPLES_COUNT - 1;
+	
+		Pointer_Result->Nanoseconds_Per_Operation = Mean;
+		Pointer_Result->Cycles_Per_Operation = Mean_Cycles > 0 ? Mean_Cycles : -1;
+		Pointer_Result->Relative_Deviation = Mean > 0 ? sqrt(Variance) / Mean : 0;
+		if (Pointer_Result->Relative_Deviation < BENCH_MAXIMUM_RELATIVE_DEVIATION)
+		{
+			Pointer_Result->Is_Stable = 1;
+			break;
+		}
+	}
+	Pointer_Result->Samples_Count = Samples_Count;
+	Pointer_Result->Operations_Count = Iterations_Count * Samples_Count;
+}
+
+/** Load a curve and create the operands.
+ * @param String_Curve The curve name or path.
+ * @param Pointer_Context The context to initialize.
+ * @return 1 if the context was created or 0 if the curve could not be loaded or the sockets could not be created.
+ */
+static int BenchCreateContext(char *String_Curve, TBenchContext *Pointer_Context)
+{
+	int i;
+	
+	if (!CurvesRegistryLoadByNameOrPath(String_Curve, &Pointer_Context->Curve)) return 0;
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, Pointer_Context->Sockets) != 0)
+	{
+		ECFree(&Pointer_Context->Curve);
+		return 0;
+	}
+	
+	// Random points are random multiples of the generator
+	for (i = 0; i < BENCH_OPERANDS_COUNT; i++)
+	{
+		mpz_init(Pointer_Context->Factors[i]);
+		PointCreate(0, 0, &Pointer_Context->Points[i]);
+		UtilsGenerateRandomNumber(Pointer_Context->Curve.n, Pointer_Context->Factors[i]);
+		ECMultiplicationGenerator(&Pointer_Context->Curve, Pointer_Context->Factors[i], &Pointer_Context->Points[i]);
+		PointCreate(0, 0, &Pointer_Context->Model_Points[i]);
+		ECModelsPointFromWeierstrass(&Pointer_Context->Curve, &Pointer_Context->Points[i], &Pointer_Context->Model_Points[i]);
+		UtilsGenerateRandomNumber(Pointer_Context->Curve.n, Pointer_Context->Factors[i]);
+		ScalarFieldImport(&Pointer_Context->Curve.Scalar_Field, Pointer_Context->Factors[i], &Pointer_Context->Scalars[i]);
+		PointCreate(0, 0, &Pointer_Context->Points_Results[i]);
+	}
+	PointCreate(0, 0, &Pointer_Context->Point_Result);
+	UtilsGenerateRandomBuffer(Pointer_Context->Data, sizeof(Pointer_Context->Data));
+	Pointer_Context->Is_Map_Usable = ECPrepareMapToCurve(&Pointer_Context->Curve, &Pointer_Context->Map);
+	
+	// The random factors are the signers private keys
+	for (i = 0; i < BENCH_SIGNATURES_COUNT; i++)
+	{
+		mpz_init(Pointer_Context->Hashes[i]);
+		PointCreate(0, 0, &Pointer_Context->Public_Keys[i]);
+		SchnorrSignatureCreate(&Pointer_Context->Signatures[i]);
+		UtilsGenerateRandomNumber(Pointer_Context->Curve.n, Pointer_Context->Hashes[i]);
+		ECMultiplicationGenerator(&Pointer_Context->Curve, Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Public_Keys[i]);
+		SchnorrSignatureSign(&Pointer_Context->Curve, Pointer_Context->Hashes[i], Pointer_Context->Factors[i % BENCH_OPERANDS_COUNT], &Pointer_Context->Public_Keys[i], &Pointer_Context->Signatures[i]);
+	}
+	
+	// The parsed signatures are the hashes and the 's' numbers, both are in [0, n - 1] like DSA signatures numbers
+	Pointer_Context->Raw_Signatures_Size = 0;
+	Pointer_Context->DER_Signatures_Size = 0;
+	Pointer_Context->Decimal_Signatures_Size = 0;
+	for (i = 0; i < BENCH_SIGNATURES_COUNT; i++)
+	{
+		EncodingExportRawSignature(&Pointer_Context->Curve, Pointer_Context->Hashes[i], Pointer_Context->Signatures[i].S, Pointer_Context->Raw_Signatures + Pointer_Context->Raw_Signatures_Size);
+		Pointer_Context->Raw_Signatures_Size += 2 * ProtocolGetScalarSize(&Pointer_Context->Curve);
+		Pointer_Context->DER_Signatures_Size += EncodingExportDERSignature(Pointer_Context->Hashes[i], Pointer_Context->Signatures[i].S, Pointer_Context->DER_Signatures + Pointer_Context->DER_Signatures_Size, sizeof(Pointer_Context->DER_Signatures) - Pointer_Context->DER_Signatures_Size);
+		mpz_get_str(Pointer_Context->Decimal_Signatures + Pointer_Context->Decimal_Signatures_Size, 10, Pointer_Context->Hashes[i]);
+		Pointer_Context->Decimal_Signatures_Size += strlen(Pointer_Context->Decimal_Signatures + Pointer_Context->Decimal_Signatures_Size) + 1;
+		mpz_get_str(Pointer_Context->Decimal_Signatures + Pointer_Context->Decimal_Signatures_Size, 10, Pointer_Context->Signatures[i].S);
+		Pointer_Context->Decimal_Signatures_Size += strlen(Pointer_Context->Decimal_Signatures + Pointer_Context->Decimal_Signatures_Size) + 1;
+	}
+	return 1;
+}
+
+/** Free the operands.
+ * @param Pointer_Context The context to destroy.
+ */
+static void BenchFreeContext(TBenchContext *Pointer_Context)
+{
+	int i;
+	
+	for (i = 0; i < BENCH_OPERANDS_COUNT; i++)
+	{
+		mpz_clear(Pointer_Context->Factors[i]);
+		PointFree(&Pointer_Context->Points[i]);
+		PointFree(&Pointer_Context->Model_Points[i]);
+		PointFree(&Pointer_Context->Points_Results[i]);
+	}
+	for (i = 0; i < BENCH_SIGNATURES_COUNT; i++)
+	{
+		mpz_clear(Pointer_Context->Hashes[i]);
+		PointFree(&Pointer_Context->Public_Keys[i]);
+		SchnorrSignatureFree(&Pointer_Context->Signatures[i]);
+	}
+	PointFree(&Pointer_Context->Point_Result);
+	if (Pointer_Context->Is_Map_Usable) ECFreeMapToCurve(&Pointer_Context->Map);
+	close(Pointer_Context->Sockets[0]);
+	close(Pointer_Context->Sockets[1]);
+	ECFree(&Pointer_Context->Curve);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	TBenchContext Context;
+	TBenchResult Result;
+	char **Pointer_Curves_Names, Is_JSON_Output = 0;
+	int Curves_Count, Operations_Count = sizeof(Bench_Operations) / sizeof(TBenchOperation), i, j;
+	
+	// Check parameters
+	if ((argc >= 2) && (strcmp(argv[1], "-json") == 0))
+	{
+		Is_JSON_Output = 1;
+		argc--;
+		argv++;
+	}
+	if (argc >= 2)
+	{
+		Pointer_Curves_Names = &argv[1];
+		Curves_Count = argc - 1;
+	}
+	else
+	{
+		Pointer_Curves_Names = Bench_Default_Curves;
+		Curves_Count = sizeof(Bench_Default_Curves) / sizeof(char *);
+	}
+	
+	UtilsInitializeRandomGenerator();
+	
+	if (Is_JSON_Output) printf("{\n\t\"curves\": [");
+	for (i = 0; i < Curves_Count; i++)
+	{
+		if (!BenchCreateContext(Pointer_Curves_Names[i], &Context))
+		{
+			fprintf(stderr, "Error : can't load curve %s.\n", Pointer_Curves_Names[i]);
+			return -1;
+		}
+	
+		if (Is_JSON_Output) printf("%s\n\t\t{\n\t\t\t\"curve\": \"%s\",\n\t\t\t\"bits\": %d,\n\t\t\t\"operations\": [", i > 0 ? "," : "", Pointer_Curves_Names[i], (int) mpz_sizeinbase(Context.Curve.p, 2));
+		else printf("%s (%d bits)\n%-30s | %14s | %14s | %12s | %9s\n", Pointer_Curves_Names[i], (int) mpz_sizeinbase(Context.Curve.p, 2), "Operation", "ns/op", "ops/s", "cycles/op", "deviation");
+	
+		for (j = 0; j < Operations_Count; j++)
+		{
+			// Some curves can't map field elements to their points
+			if (!Context.Is_Map_Usable && ((Bench_Operations[j].Function == BenchMapToCurve) || (Bench_Operations[j].Function == BenchHashToCurve))) continue;
+			// The model formulas only work on their own model, the Weierstrass operations measured on the same curve are the reference
+			if ((Context.Curve.Model != EC_MODEL_TWISTED_EDWARDS) && ((Bench_Operations[j].Function == BenchEdwardsAddition) || (Bench_Operations[j].Function == BenchEdwardsMultiplication))) continue;
+			if ((Context.Curve.Model != EC_MODEL_MONTGOMERY) && (Bench_Operations[j].Function == BenchMontgomeryLadder)) continue;
+			BenchMeasure(&Context, &Bench_Operations[j], &Result);
+	
+			if (Is_JSON_Output)
+			{
+				printf("%s\n\t\t\t\t{\"name\": \"%s\", \"ns_per_op\": %.1f, \"ops_per_sec\": %.1f, ", j > 0 ? "," : "", Bench_Operations[j].String_Name, Result.Nanoseconds_Per_Operation, 1e9 / Result.Nanoseconds_Per_Operation);
+				if (Result.Cycles_Per_Operation < 0) printf("\"cycles_per_op\": null, ");
+				else printf("\"cycles_per_op\": %.1f, ", Result.Cycles_Per_Operation);
+				printf("\"relative_deviation\": %.4f, \"samples\": %d, \"operations\": %lld, \"stable\": %s}", Result.Relative_Deviation, Result.Samples_Count, Result.Operations_Count, Result.Is_Stable ? "true" : "false");
+			}
+			else printf("%-30s | %14.1f | %14.1f | %12.1f | %8.2f%%%s\n", Bench_Operations[j].String_Name, Result.Nanoseconds_Per_Operation, 1e9 / Result.Nanoseconds_Per_Operation, Result.Cycles_Per_Operation, Result.Relative_Deviation * 100, Result.Is_Stable ? "" : " (unstable)");
+			fflush(stdout);
+		}
+	
+		if (Is_JSON_Output) printf("\n\t\t\t]\n\t\t}");
+		else putchar('\n');
+		BenchFreeContext(&Context);
+	}
+	if (Is_JSON_Output) printf("\n\t]\n}\n");
+	
+	return 0;
+}
@@ -0,0 +1,43 @@
+/** @file Curve_Converter.c
+ * Convert a .gp curve file to a precompiled binary curve file.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Binary.h"
+
+int main(int argc, char *argv[])
+{
+	TEllipticCurve Curve;
+	int Is_Generator_Table_Saved = 1;
+	
+	// Check parameters
+	if ((argc < 3) || (argc > 4) || ((argc == 4) && (strcmp(argv[3], "-no-table") != 0)))
+	{
+		printf("Error : bad parameters.\n" \
+			"Usage : %s EllipticCurveFile.gp BinaryCurveFile.ecb [-no-table]\n" \
+			"Use -no-table to make a smaller file, the generator table will then be computed each time the binary file is loaded.\n", argv[0]);
+		return -1;
+	}
+	if (argc == 4) Is_Generator_Table_Saved = 0;
+	
+	// Load the curve, this computes the generator table too
+	if (!ECLoadFromFile(argv[1], &Curve))
+	{
+		printf("Error : can't load curve file.\n");
+		return -2;
+	}
+	
+	// Write the binary file
+	if (!ECSaveToBinaryFile(&Curve, argv[2], Is_Generator_Table_Saved))
+	{
+		printf("Error : can't write the binary curve file.\n");
+		ECFree(&Curve);
+		return -3;
+	}
+	
+	printf("Curve converted.\n");
+	ECFree(&Curve);
+	return 0;
+}
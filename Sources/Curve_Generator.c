@@ -0,0 +1,767 @@
+/** @file Curve_Generator.c
+ * Search random curves y^2 = x^3 + a4.x + a6 of prime order over a random prime field and write them to .gp files ECLoadFromFile() can read.
+ * The curve order is counted with the baby-step giant-step algorithm of Shanks and Mestre, which needs about 2.p^(1/4) point additions and p^(1/4) table entries per curve, so
+ * the field size is limited to CURVE_GENERATOR_MAXIMUM_BITS. Before counting, the curves whose order is divisible by a small prime l are rejected by looking for an l-torsion point
+ * over the field with the division polynomials, which discards most curves for a few polynomial operations. Each thread tests its own curves.
+ * The tool is meant for small test curves (the Pollard rho solver targets, the models and loader tests...). Cryptographic size curves need a polynomial time point counting
+ * (Schoof or Schoof-Elkies-Atkin) with fast polynomial arithmetic, which is not implemented, so they must still come from an external tool like PARI/GP ellsea().
+ */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Utils.h"
+
+/** The smallest supported field size in bits. */
+#define CURVE_GENERATOR_MINIMUM_BITS 16
+/** The largest supported field size in bits, the baby steps table of a 80-bit field takes 32 MB per thread and the exponential counting time makes larger fields impractical. */
+#define CURVE_GENERATOR_MAXIMUM_BITS 80
+/** The highest supported degree of the polynomials used to sieve the curves (the 7-division polynomial has degree 24 and products of two reduced polynomials are below 48). */
+#define CURVE_GENERATOR_POLYNOMIAL_MAXIMUM_DEGREE 63
+/** The curves whose embedding degree is not greater than this value are rejected (the discrete logarithm can then be moved to a small extension of the field). */
+#define CURVE_GENERATOR_MINIMUM_EMBEDDING_DEGREE 20
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** A polynomial over the prime field. */
+typedef struct
+{
+	mpz_t Coefficients[CURVE_GENERATOR_POLYNOMIAL_MAXIMUM_DEGREE + 1]; //! Coefficients[i] is the coefficient of x^i.
+	int Degree; //! The polynomial degree, -1 for the null polynomial.
+} TCurveGeneratorPolynomial;
+
+/** A baby step of the order computation. */
+typedef struct
+{
+	uint64_t Key; //! The low bits of the X coordinate of j.P.
+	uint32_t Index; //! The value of j.
+} TCurveGeneratorBabyStep;
+
+/** The state shared by the search threads. */
+typedef struct
+{
+	mpz_t p; //! The field all curves are defined on.
+	char *String_Prefix; //! The curve files are named Prefix-001.gp, Prefix-002.gp...
+	int Curves_Count; //! How many curves to find.
+	int Found_Curves_Count; //! How many curves were written.
+	unsigned long long Tried_Curves_Count; //! How many curves were generated.
+	unsigned long long Counted_Curves_Count; //! How many curves passed the small primes sieve and had their order counted.
+	pthread_mutex_t Mutex; //! Protect the counters and the files numbering.
+} TCurveGeneratorSearch;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The small primes the curve orders are sieved with, their division polynomials have degree (l^2 - 1) / 2. */
+static const int Sieve_Primes[] = { 2, 3, 5, 7 };
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Initialize a null polynomial.
+ * @param Pointer_Polynomial The polynomial to initialize.
+ */
+static void CurveGeneratorPolynomialCreate(TCurveGeneratorPolynomial *Pointer_Polynomial)
+{
+	int i;
+	
+	for (i = 0; i <= CURVE_GENERATOR_POLYNOMIAL_MAXIMUM_DEGREE; i++) mpz_init(Pointer_Polynomial->Coefficients[i]);
+	Pointer_Polynomial->Degree = -1;
+}
+
+/** Free a polynomial.
+ * @param Pointer_Polynomial The polynomial to free.
+ */
+static void CurveGeneratorPolynomialFree(TCurveGeneratorPolynomial *Pointer_Polynomial)
+{
+	int i;
+	
+	for (i = 0; i <= CURVE_GENERATOR_POLYNOMIAL_MAXIMUM_DEGREE; i++) mpz_clear(Pointer_Polynomial->Coefficients[i]);
+}
+
+/** Reduce the coefficients modulo p and compute the real degree.
+ * @param Pointer_Polynomial The polynomial, Degree must be an upper bound of its degree.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialNormalize(TCurveGeneratorPolynomial *Pointer_Polynomial, mpz_t Modulus)
+{
+	int i;
+	
+	for (i = 0; i <= Pointer_Polynomial->Degree; i++) mpz_mod(Pointer_Polynomial->Coefficients[i], Pointer_Polynomial->Coefficients[i], Modulus);
+	while ((Pointer_Polynomial->Degree >= 0) && (mpz_sgn(Pointer_Polynomial->Coefficients[Pointer_Polynomial->Degree]) == 0)) Pointer_Polynomial->Degree--;
+}
+
+/** Copy a polynomial.
+ * @param Pointer_Source The polynomial to copy.
+ * @param Pointer_Destination On output, contain the copy.
+ */
+static void CurveGeneratorPolynomialCopy(TCurveGeneratorPolynomial *Pointer_Source, TCurveGeneratorPolynomial *Pointer_Destination)
+{
+	int i;
+	
+	for (i = 0; i <= Pointer_Source->Degree; i++) mpz_set(Pointer_Destination->Coefficients[i], Pointer_Source->Coefficients[i]);
+	Pointer_Destination->Degree = Pointer_Source->Degree;
+}
+
+/** Compute A - B.
+ * @param Pointer_A First operand.
+ * @param Pointer_B Second operand.
+ * @param Pointer_Output On output, contain the result (it can be one of the operands).
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialSubtract(TCurveGeneratorPolynomial *Pointer_A, TCurveGeneratorPolynomial *Pointer_B, TCurveGeneratorPolynomial *Pointer_Output, mpz_t Modulus)
+{
+	int i, Degree;
+	
+	Degree = Pointer_A->Degree > Pointer_B->Degree ? Pointer_A->Degree : Pointer_B->Degree;
+	for (i = 0; i <= Degree; i++)
+	{
+		if (i > Pointer_A->Degree) mpz_set_ui(Pointer_Output->Coefficients[i], 0);
+		else if (Pointer_Output != Pointer_A) mpz_set(Pointer_Output->Coefficients[i], Pointer_A->Coefficients[i]);
+		if (i <= Pointer_B->Degree) mpz_sub(Pointer_Output->Coefficients[i], Pointer_Output->Coefficients[i], Pointer_B->Coefficients[i]);
+	}
+	Pointer_Output->Degree = Degree;
+	CurveGeneratorPolynomialNormalize(Pointer_Output, Modulus);
+}
+
+/** Multiply two polynomials, the product degree must not exceed CURVE_GENERATOR_POLYNOMIAL_MAXIMUM_DEGREE.
+ * @param Pointer_A First factor.
+ * @param Pointer_B Second factor.
+ * @param Pointer_Output On output, contain the product (it can be one of the factors).
+ * @param Pointer_Temporary A polynomial the function can use.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialMultiply(TCurveGeneratorPolynomial *Pointer_A, TCurveGeneratorPolynomial *Pointer_B, TCurveGeneratorPolynomial *Pointer_Output, TCurveGeneratorPolynomial *Pointer_Temporary, mpz_t Modulus)
+{
+	int i, j;
+	
+	if ((Pointer_A->Degree < 0) || (Pointer_B->Degree < 0))
+	{
+		Pointer_Output->Degree = -1;
+		return;
+	}
+	
+	Pointer_Temporary->Degree = Pointer_A->Degree + Pointer_B->Degree;
+	for (i = 0; i <= Pointer_Temporary->Degree; i++) mpz_set_ui(Pointer_Temporary->Coefficients[i], 0);
+	for (i = 0; i <= Pointer_A->Degree; i++)
+	{
+		for (j = 0; j <= Pointer_B->Degree; j++) mpz_addmul(Pointer_Temporary->Coefficients[i + j], Pointer_A->Coefficients[i], Pointer_B->Coefficients[j]);
+	}
+	CurveGeneratorPolynomialNormalize(Pointer_Temporary, Modulus);
+	CurveGeneratorPolynomialCopy(Pointer_Temporary, Pointer_Output);
+}
+
+/** Multiply a polynomial by a constant.
+ * @param Pointer_Polynomial The polynomial, it contains the product on output.
+ * @param Factor The constant.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialScale(TCurveGeneratorPolynomial *Pointer_Polynomial, long Factor, mpz_t Modulus)
+{
+	int i;
+	
+	for (i = 0; i <= Pointer_Polynomial->Degree; i++) mpz_mul_si(Pointer_Polynomial->Coefficients[i], Pointer_Polynomial->Coefficients[i], Factor);
+	CurveGeneratorPolynomialNormalize(Pointer_Polynomial, Modulus);
+}
+
+/** Compute the remainder of the division of A by M.
+ * @param Pointer_A The polynomial to reduce, it contains the remainder on output.
+ * @param Pointer_Modulus The divisor, it must not be null.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialModulo(TCurveGeneratorPolynomial *Pointer_A, TCurveGeneratorPolynomial *Pointer_Modulus, mpz_t Modulus)
+{
+	mpz_t Number_Inverse, Number_Quotient;
+	int i, Shift;
+	
+	if (Pointer_A->Degree < Pointer_Modulus->Degree) return;
+	
+	mpz_init(Number_Inverse);
+	mpz_init(Number_Quotient);
+	mpz_invert(Number_Inverse, Pointer_Modulus->Coefficients[Pointer_Modulus->Degree], Modulus);
+	
+	// Cancel the leading coefficient until the degree is lower than the divisor one
+	while (Pointer_A->Degree >= Pointer_Modulus->Degree)
+	{
+		Shift = Pointer_A->Degree - Pointer_Modulus->Degree;
+		mpz_mul(Number_Quotient, Pointer_A->Coefficients[Pointer_A->Degree], Number_Inverse);
+		mpz_mod(Number_Quotient, Number_Quotient, Modulus);
+		for (i = 0; i <= Pointer_Modulus->Degree; i++)
+		{
+			mpz_submul(Pointer_A->Coefficients[i + Shift], Number_Quotient, Pointer_Modulus->Coefficients[i]);
+			mpz_mod(Pointer_A->Coefficients[i + Shift], Pointer_A->Coefficients[i + Shift], Modulus);
+		}
+		while ((Pointer_A->Degree >= 0) && (mpz_sgn(Pointer_A->Coefficients[Pointer_A->Degree]) == 0)) Pointer_A->Degree--;
+	}
+	
+	mpz_clear(Number_Inverse);
+	mpz_clear(Number_Quotient);
+}
+
+/** Compute Base^Exponent modulo M.
+ * @param Pointer_Base The polynomial to raise, its degree must be lower than the modulus one.
+ * @param Exponent The exponent.
+ * @param Pointer_Modulus The polynomial modulus.
+ * @param Pointer_Output On output, contain the result (it must not be the base).
+ * @param Pointer_Temporary A polynomial the function can use.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialPowerModulo(TCurveGeneratorPolynomial *Pointer_Base, mpz_t Exponent, TCurveGeneratorPolynomial *Pointer_Modulus, TCurveGeneratorPolynomial *Pointer_Output, TCurveGeneratorPolynomial *Pointer_Temporary, mpz_t Modulus)
+{
+	int i;
+	
+	mpz_set_ui(Pointer_Output->Coefficients[0], 1);
+	Pointer_Output->Degree = 0;
+	for (i = mpz_sizeinbase(Exponent, 2) - 1; i >= 0; i--)
+	{
+		CurveGeneratorPolynomialMultiply(Pointer_Output, Pointer_Output, Pointer_Output, Pointer_Temporary, Modulus);
+		CurveGeneratorPolynomialModulo(Pointer_Output, Pointer_Modulus, Modulus);
+		if (mpz_tstbit(Exponent, i))
+		{
+			CurveGeneratorPolynomialMultiply(Pointer_Output, Pointer_Base, Pointer_Output, Pointer_Temporary, Modulus);
+			CurveGeneratorPolynomialModulo(Pointer_Output, Pointer_Modulus, Modulus);
+		}
+	}
+}
+
+/** Compute the greatest common divisor of two polynomials (up to a constant factor).
+ * @param Pointer_A First polynomial, it contains the divisor on output.
+ * @param Pointer_B Second polynomial, it is destroyed.
+ * @param Modulus The field prime.
+ */
+static void CurveGeneratorPolynomialGCD(TCurveGeneratorPolynomial *Pointer_A, TCurveGeneratorPolynomial *Pointer_B, mpz_t Modulus)
+{
+	TCurveGeneratorPolynomial *Pointer_Dividend = Pointer_A, *Pointer_Divisor = Pointer_B, *Pointer_Temp;
+	
+	while (Pointer_Divisor->Degree >= 0)
+	{
+		CurveGeneratorPolynomialModulo(Pointer_Dividend, Pointer_Divisor, Modulus);
+		Pointer_Temp = Pointer_Dividend;
+		Pointer_Dividend = Pointer_Divisor;
+		Pointer_Divisor = Pointer_Temp;
+	}
+	
+	// The divisor can end in the second polynomial
+	if (Pointer_Dividend != Pointer_A) CurveGeneratorPolynomialCopy(Pointer_Dividend, Pointer_A);
+}
+
+/** Tell if a small prime divides the order of a curve. Every x coordinate of an l-torsion point is a root of the l-division polynomial, so the order is divisible by l when a root
+ * x of the division polynomial lies in the field and x^3 + a4.x + a6 is a square (the point is on the curve and not on its quadratic twist). Both tests are done on all roots at once
+ * with gcd(x^p - x, psi) and gcd(f^((p - 1) / 2) - 1, psi). The 2-torsion points are the roots of f itself.
+ * @param Pointer_Curve The curve (p, a4 and a6 are used).
+ * @param Prime The small prime, it must be 2, 3, 5 or 7.
+ * @param Pointer_Polynomials 6 polynomials the function can use.
+ * @return 1 if the prime divides the curve order or 0 otherwise.
+ */
+static int CurveGeneratorIsOrderDivisible(TEllipticCurve *Pointer_Curve, int Prime, TCurveGeneratorPolynomial *Pointer_Polynomials)
+{
+	TCurveGeneratorPolynomial *Pointer_Function = &Pointer_Polynomials[0], *Pointer_Division = &Pointer_Polynomials[1], *Pointer_Power = &Pointer_Polynomials[2], *Pointer_Temp = &Pointer_Polynomials[3];
+	TCurveGeneratorPolynomial *Pointer_Psi_3 = &Pointer_Polynomials[4], *Pointer_Psi_4 = &Pointer_Polynomials[5];
+	mpz_ptr a4 = Pointer_Curve->a4, a6 = Pointer_Curve->a6;
+	mpz_t Exponent;
+	
+	// f = x^3 + a4.x + a6
+	mpz_set(Pointer_Function->Coefficients[0], a6);
+	mpz_set(Pointer_Function->Coefficients[1], a4);
+	mpz_set_ui(Pointer_Function->Coefficients[2], 0);
+	mpz_set_ui(Pointer_Function->Coefficients[3], 1);
+	Pointer_Function->Degree = 3;
+	
+	if (Prime == 2) CurveGeneratorPolynomialCopy(Pointer_Function, Pointer_Division);
+	else
+	{
+		// psi_3 = 3.x^4 + 6.a4.x^2 + 12.a6.x - a4^2
+		mpz_mul(Pointer_Psi_3->Coefficients[0], a4, a4);
+		mpz_neg(Pointer_Psi_3->Coefficients[0], Pointer_Psi_3->Coefficients[0]);
+		mpz_mul_ui(Pointer_Psi_3->Coefficients[1], a6, 12);
+		mpz_mul_ui(Pointer_Psi_3->Coefficients[2], a4, 6);
+		mpz_set_ui(Pointer_Psi_3->Coefficients[3], 0);
+		mpz_set_ui(Pointer_Psi_3->Coefficients[4], 3);
+		Pointer_Psi_3->Degree = 4;
+		CurveGeneratorPolynomialNormalize(Pointer_Psi_3, Pointer_Curve->p);
+		
+		// psi_4 = 4.(x^6 + 5.a4.x^4 + 20.a6.x^3 - 5.a4^2.x^2 - 4.a4.a6.x - 8.a6^2 - a4^3), without the y factor
+		mpz_mul(Pointer_Psi_4->Coefficients[0], a6, a6);
+		mpz_mul_ui(Pointer_Psi_4->Coefficients[0], Pointer_Psi_4->Coefficients[0], 8);
+		mpz_pow_ui(Pointer_Psi_4->Coefficients[6], a4, 3);
+		mpz_add(Pointer_Psi_4->Coefficients[0], Pointer_Psi_4->Coefficients[0], Pointer_Psi_4->Coefficients[6]);
+		mpz_neg(Pointer_Psi_4->Coefficients[0], Pointer_Psi_4->Coefficients[0]);
+		mpz_mul(Pointer_Psi_4->Coefficients[1], a4, a6);
+		mpz_mul_si(Pointer_Psi_4->Coefficients[1], Pointer_Psi_4->Coefficients[1], -4);
+		mpz_mul(Pointer_Psi_4->Coefficients[2], a4, a4);
+		mpz_mul_si(Pointer_Psi_4->Coefficients[2], Pointer_Psi_4->Coefficients[2], -5);
+		mpz_mul_ui(Pointer_Psi_4->Coefficients[3], a6, 20);
+		mpz_mul_ui(Pointer_Psi_4->Coefficients[4], a4, 5);
+		mpz_set_ui(Pointer_Psi_4->Coefficients[5], 0);
+		mpz_set_ui(Pointer_Psi_4->Coefficients[6], 1);
+		Pointer_Psi_4->Degree = 6;
+		CurveGeneratorPolynomialScale(Pointer_Psi_4, 4, Pointer_Curve->p);
+		
+		if (Prime == 3) CurveGeneratorPolynomialCopy(Pointer_Psi_3, Pointer_Division);
+		// psi_5 = 8.f^2.psi_4 - psi_3^3
+		else if (Prime == 5)
+		{
+			CurveGeneratorPolynomialMultiply(Pointer_Function, Pointer_Function, Pointer_Division, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Division, Pointer_Psi_4, Pointer_Division, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialScale(Pointer_Division, 8, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Psi_3, Pointer_Psi_3, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Power, Pointer_Psi_3, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialSubtract(Pointer_Division, Pointer_Power, Pointer_Division, Pointer_Curve->p);
+		}
+		// psi_7 = psi_5.psi_3^3 - 2.f^2.psi_4^3
+		else
+		{
+			CurveGeneratorPolynomialMultiply(Pointer_Function, Pointer_Function, Pointer_Division, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Division, Pointer_Psi_4, Pointer_Division, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialScale(Pointer_Division, 8, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Psi_3, Pointer_Psi_3, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Power, Pointer_Psi_3, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialSubtract(Pointer_Division, Pointer_Power, Pointer_Division, Pointer_Curve->p); // psi_5
+			CurveGeneratorPolynomialMultiply(Pointer_Division, Pointer_Power, Pointer_Division, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Psi_4, Pointer_Psi_4, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Power, Pointer_Psi_4, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Power, Pointer_Function, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialMultiply(Pointer_Power, Pointer_Function, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+			CurveGeneratorPolynomialScale(Pointer_Power, 2, Pointer_Curve->p);
+			CurveGeneratorPolynomialSubtract(Pointer_Division, Pointer_Power, Pointer_Division, Pointer_Curve->p);
+		}
+	}
+	
+	// Keep the division polynomial roots lying in the field : gcd(x^p - x, psi)
+	mpz_set_ui(Pointer_Temp->Coefficients[0], 0);
+	mpz_set_ui(Pointer_Temp->Coefficients[1], 1);
+	Pointer_Temp->Degree = 1;
+	CurveGeneratorPolynomialCopy(Pointer_Temp, Pointer_Psi_3);
+	CurveGeneratorPolynomialPowerModulo(Pointer_Psi_3, Pointer_Curve->p, Pointer_Division, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+	CurveGeneratorPolynomialSubtract(Pointer_Power, Pointer_Psi_3, Pointer_Power, Pointer_Curve->p);
+	CurveGeneratorPolynomialGCD(Pointer_Division, Pointer_Power, Pointer_Curve->p);
+	if (Pointer_Division->Degree <= 0) return 0;
+	
+	// Any root of f is a 2-torsion point
+	if (Prime == 2) return 1;
+	
+	// Is f a square on one of the roots : gcd(f^((p - 1) / 2) - 1, roots)
+	CurveGeneratorPolynomialModulo(Pointer_Function, Pointer_Division, Pointer_Curve->p);
+	mpz_init(Exponent);
+	mpz_sub_ui(Exponent, Pointer_Curve->p, 1);
+	mpz_tdiv_q_2exp(Exponent, Exponent, 1);
+	CurveGeneratorPolynomialPowerModulo(Pointer_Function, Exponent, Pointer_Division, Pointer_Power, Pointer_Temp, Pointer_Curve->p);
+	mpz_clear(Exponent);
+	mpz_set_ui(Pointer_Temp->Coefficients[0], 1);
+	Pointer_Temp->Degree = 0;
+	CurveGeneratorPolynomialSubtract(Pointer_Power, Pointer_Temp, Pointer_Power, Pointer_Curve->p);
+	CurveGeneratorPolynomialGCD(Pointer_Division, Pointer_Power, Pointer_Curve->p);
+	return Pointer_Division->Degree > 0;
+}
+
+/** Compare two baby steps keys for qsort() and bsearch().
+ * @param Pointer_A First step.
+ * @param Pointer_B Second step.
+ * @return -1, 0 or 1 like strcmp().
+ */
+static int CurveGeneratorCompareBabySteps(const void *Pointer_A, const void *Pointer_B)
+{
+	uint64_t Key_A = ((const TCurveGeneratorBabyStep *) Pointer_A)->Key, Key_B = ((const TCurveGeneratorBabyStep *) Pointer_B)->Key;
+	
+	if (Key_A < Key_B) return -1;
+	return Key_A > Key_B;
+}
+
+/** Get the key of a point X coordinate.
+ * @param Pointer_Point The point.
+ * @return The low 64 bits of X.
+ */
+static inline uint64_t CurveGeneratorGetKey(TPoint *Pointer_Point)
+{
+	uint64_t Key;
+	
+	Key = mpz_getlimbn(Pointer_Point->X, 0);
+	if (GMP_NUMB_BITS < 64) Key |= (uint64_t) mpz_getlimbn(Pointer_Point->X, 1) << (GMP_NUMB_BITS % 64);
+	return Key;
+}
+
+/** Find a multiple of a point order in the Hasse interval [p + 1 - 2.sqrt(p), p + 1 + 2.sqrt(p)] with the baby-step giant-step algorithm. When the curve order is a prime, it is the only
+ * such multiple.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Point A point of the curve, different from the point at infinity.
+ * @param Output_Multiple On output, contain the smallest multiple m of the point order in the interval (m.P = O).
+ * @return 1 if a multiple was found, 0 if the baby steps table could not be allocated.
+ */
+static int CurveGeneratorFindOrderMultiple(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Output_Multiple)
+{
+	TCurveGeneratorBabyStep *Pointer_Baby_Steps, Step, *Pointer_Match;
+	TPoint Point_Baby, Point_Giant, Point_Step;
+	mpz_t Number_Lower_Bound, Number_Temp;
+	uint32_t Steps_Count, i, j;
+	int Is_Found = 0;
+	
+	// The interval starts at L = p + 1 - s with s = floor(2.sqrt(p)) and is 2.s wide, m = ceil(sqrt(2.s + 1)) steps of each kind cover it
+	mpz_init(Number_Lower_Bound);
+	mpz_init(Number_Temp);
+	mpz_mul_2exp(Number_Temp, Pointer_Curve->p, 2);
+	mpz_sqrt(Number_Temp, Number_Temp);
+	mpz_add_ui(Number_Lower_Bound, Pointer_Curve->p, 1);
+	mpz_sub(Number_Lower_Bound, Number_Lower_Bound, Number_Temp);
+	mpz_mul_2exp(Number_Temp, Number_Temp, 1);
+	mpz_add_ui(Number_Temp, Number_Temp, 1);
+	mpz_sqrt(Number_Temp, Number_Temp);
+	Steps_Count = mpz_get_ui(Number_Temp) + 1;
+	
+	Pointer_Baby_Steps = malloc(Steps_Count * sizeof(TCurveGeneratorBabyStep));
+	if (Pointer_Baby_Steps == NULL)
+	{
+		mpz_clear(Number_Lower_Bound);
+		mpz_clear(Number_Temp);
+		return 0;
+	}
+	PointCreate(0, 0, &Point_Baby);
+	PointCreate(0, 0, &Point_Giant);
+	PointCreate(0, 0, &Point_Step);
+	
+	// Baby steps : j.P for j = 1..m (a point and its opposite share the key)
+	PointCopy(Pointer_Point, &Point_Baby);
+	for (j = 1; j <= Steps_Count; j++)
+	{
+		Pointer_Baby_Steps[j - 1].Key = Point_Baby.Is_Infinite ? UINT64_MAX : CurveGeneratorGetKey(&Point_Baby);
+		Pointer_Baby_Steps[j - 1].Index = j;
+		ECAddition(Pointer_Curve, &Point_Baby, Pointer_Point, &Point_Baby);
+	}
+	qsort(Pointer_Baby_Steps, Steps_Count, sizeof(TCurveGeneratorBabyStep), CurveGeneratorCompareBabySteps);
+	
+	// Giant steps : R = -(L + i.m).P, then (L + i.m + j).P = O when R = j.P and (L + i.m - j).P = O when R = -j.P
+	mpz_set_ui(Number_Temp, Steps_Count);
+	ECMultiplication(Pointer_Curve, Pointer_Point, Number_Temp, &Point_Step);
+	ECOpposite(Pointer_Curve, &Point_Step, &Point_Step);
+	ECMultiplication(Pointer_Curve, Pointer_Point, Number_Lower_Bound, &Point_Giant);
+	ECOpposite(Pointer_Curve, &Point_Giant, &Point_Giant);
+	for (i = 0; i <= Steps_Count; i++)
+	{
+		if (Point_Giant.Is_Infinite)
+		{
+			mpz_set_ui(Number_Temp, 0);
+			Is_Found = 1;
+		}
+		else
+		{
+			Step.Key = CurveGeneratorGetKey(&Point_Giant);
+			Pointer_Match = bsearch(&Step, Pointer_Baby_Steps, Steps_Count, sizeof(TCurveGeneratorBabyStep), CurveGeneratorCompareBabySteps);
+			if (Pointer_Match != NULL)
+			{
+				// Go back to the first entry with this key, then check the whole coordinates of the matching ones
+				while ((Pointer_Match > Pointer_Baby_Steps) && (Pointer_Match[-1].Key == Step.Key)) Pointer_Match--;
+				for (; (Pointer_Match < Pointer_Baby_Steps + Steps_Count) && (Pointer_Match->Key == Step.Key); Pointer_Match++)
+				{
+					mpz_set_ui(Number_Temp, Pointer_Match->Index);
+					ECMultiplication(Pointer_Curve, Pointer_Point, Number_Temp, &Point_Baby);
+					if (mpz_cmp(Point_Baby.X, Point_Giant.X) != 0) continue;
+					if (mpz_cmp(Point_Baby.Y, Point_Giant.Y) != 0) mpz_neg(Number_Temp, Number_Temp);
+					Is_Found = 1;
+					break;
+				}
+			}
+		}
+		if (Is_Found)
+		{
+			// m = L + i.m +- j
+			mpz_add(Output_Multiple, Number_Lower_Bound, Number_Temp);
+			mpz_set_ui(Number_Temp, i);
+			mpz_addmul_ui(Output_Multiple, Number_Temp, Steps_Count);
+			break;
+		}
+		ECAddition(Pointer_Curve, &Point_Giant, &Point_Step, &Point_Giant);
+	}
+	
+	free(Pointer_Baby_Steps);
+	PointFree(&Point_Baby);
+	PointFree(&Point_Giant);
+	PointFree(&Point_Step);
+	mpz_clear(Number_Lower_Bound);
+	mpz_clear(Number_Temp);
+	return Is_Found;
+}
+
+/** Pick a random point of the curve, p must be congruent to 3 modulo 4 so a square root is a single exponentiation.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Output_Point On output, contain a point different from the point at infinity.
+ */
+static void CurveGeneratorGetRandomPoint(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Output_Point)
+{
+	mpz_t Number_Right, Exponent;
+	
+	mpz_init(Number_Right);
+	mpz_init(Exponent);
+	
+	do
+	{
+		// x^3 + a4.x + a6
+		UtilsGenerateRandomNumber(Pointer_Curve->p, Pointer_Output_Point->X);
+		mpz_mul(Number_Right, Pointer_Output_Point->X, Pointer_Output_Point->X);
+		mpz_add(Number_Right, Number_Right, Pointer_Curve->a4);
+		mpz_mul(Number_Right, Number_Right, Pointer_Output_Point->X);
+		mpz_add(Number_Right, Number_Right, Pointer_Curve->a6);
+		mpz_mod(Number_Right, Number_Right, Pointer_Curve->p);
+	} while (mpz_legendre(Number_Right, Pointer_Curve->p) != 1);
+	
+	// y = (x^3 + a4.x + a6)^((p + 1) / 4)
+	mpz_add_ui(Exponent, Pointer_Curve->p, 1);
+	mpz_tdiv_q_2exp(Exponent, Exponent, 2);
+	mpz_powm(Pointer_Output_Point->Y, Number_Right, Exponent, Pointer_Curve->p);
+	Pointer_Output_Point->Is_Infinite = 0;
+	
+	mpz_clear(Number_Right);
+	mpz_clear(Exponent);
+}
+
+/** Tell if a prime order curve resists the known attacks on special curves : the order must differ from p (anomalous curves) and p^k - 1 must not be divisible by the order
+ * for small k (pairing-friendly curves).
+ * @param Modulus The field prime.
+ * @param Order The curve order.
+ * @return 1 if the curve is safe or 0 otherwise.
+ */
+static int CurveGeneratorIsOrderSafe(mpz_t Modulus, mpz_t Order)
+{
+	mpz_t Number_Power;
+	int k, Is_Safe = 1;
+	
+	if (mpz_cmp(Modulus, Order) == 0) return 0;
+	
+	mpz_init_set_ui(Number_Power, 1);
+	for (k = 1; k <= CURVE_GENERATOR_MINIMUM_EMBEDDING_DEGREE; k++)
+	{
+		mpz_mul(Number_Power, Number_Power, Modulus);
+		mpz_mod(Number_Power, Number_Power, Order);
+		if (mpz_cmp_ui(Number_Power, 1) == 0)
+		{
+			Is_Safe = 0;
+			break;
+		}
+	}
+	mpz_clear(Number_Power);
+	return Is_Safe;
+}
+
+/** Write a curve to the next .gp file.
+ * @param Pointer_Search The search state (the mutex must be locked).
+ * @param Pointer_Curve The curve to write.
+ * @return 1 if the file was written or 0 if an error occurred.
+ */
+static int CurveGeneratorWriteCurve(TCurveGeneratorSearch *Pointer_Search, TEllipticCurve *Pointer_Curve)
+{
+	char String_Path[4096];
+	FILE *Pointer_File;
+	TEllipticCurve Curve_Loaded;
+	
+	snprintf(String_Path, sizeof(String_Path), "%s-%03d.gp", Pointer_Search->String_Prefix, Pointer_Search->Found_Curves_Count + 1);
+	Pointer_File = fopen(String_Path, "w");
+	if (Pointer_File == NULL)
+	{
+		printf("Error : can't create the file %s.\n", String_Path);
+		return 0;
+	}
+	gmp_fprintf(Pointer_File, "p=%Zd\nn=%Zd\na4=%Zd\na6=%Zd\nh=1\ngx=%Zd\ngy=%Zd", Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->Point_Generator.X,
+		Pointer_Curve->Point_Generator.Y);
+	fclose(Pointer_File);
+	
+	// Make sure the library accepts the file
+	if (!ECLoadFromFile(String_Path, &Curve_Loaded))
+	{
+		printf("Error : the file %s can't be loaded.\n", String_Path);
+		return 0;
+	}
+	ECFree(&Curve_Loaded);
+	
+	Pointer_Search->Found_Curves_Count++;
+	gmp_printf("Found %s (%d/%d) : n = %Zd.\n", String_Path, Pointer_Search->Found_Curves_Count, Pointer_Search->Curves_Count, Pointer_Curve->n);
+	return 1;
+}
+
+/** Generate and test random curves until enough curves are found.
+ * @param Pointer_Parameters The search state.
+ * @return NULL if all files could be written, a non-NULL value otherwise.
+ */
+static void *CurveGeneratorThread(void *Pointer_Parameters)
+{
+	TCurveGeneratorSearch *Pointer_Search = Pointer_Parameters;
+	TEllipticCurve Curve;
+	TCurveGeneratorPolynomial Polynomials[6];
+	mpz_t Number_Temp;
+	int i, Is_Searching = 1, Is_Rejected;
+	void *Pointer_Result = NULL;
+	
+	// A curve the library can compute on, without generator table
+	mpz_init_set(Curve.p, Pointer_Search->p);
+	mpz_init(Curve.n);
+	mpz_init(Curve.a4);
+	mpz_init(Curve.a6);
+	mpz_init_set_ui(Curve.h, 1);
+	mpz_init(Curve.Model_A);
+	mpz_init(Curve.Model_B);
+	PointCreate(0, 0, &Curve.Point_Generator);
+	Curve.Generator_Table.Pointer_Points = NULL;
+	Curve.Is_Read_Only = 0;
+	Curve.Pointer_Mapped_File = NULL;
+	Curve.Pointer_Lanes_Generator_Table = NULL;
+	Curve.Model = EC_MODEL_WEIERSTRASS;
+	for (i = 0; i < (int) (sizeof(Polynomials) / sizeof(Polynomials[0])); i++) CurveGeneratorPolynomialCreate(&Polynomials[i]);
+	mpz_init(Number_Temp);
+	
+	while (Is_Searching)
+	{
+		UtilsGenerateRandomNumber(Curve.p, Curve.a4);
+		UtilsGenerateRandomNumber(Curve.p, Curve.a6);
+		
+		// The curve must not be singular : 4.a4^3 + 27.a6^2 != 0
+		mpz_powm_ui(Number_Temp, Curve.a4, 3, Curve.p);
+		mpz_mul_ui(Number_Temp, Number_Temp, 4);
+		mpz_mul(Curve.n, Curve.a6, Curve.a6);
+		mpz_addmul_ui(Number_Temp, Curve.n, 27);
+		Is_Rejected = mpz_divisible_p(Number_Temp, Curve.p);
+		
+		// Cheap small primes sieve
+		for (i = 0; !Is_Rejected && (i < (int) (sizeof(Sieve_Primes) / sizeof(Sieve_Primes[0]))); i++) Is_Rejected = CurveGeneratorIsOrderDivisible(&Curve, Sieve_Primes[i], Polynomials);
+		
+		pthread_mutex_lock(&Pointer_Search->Mutex);
+		Pointer_Search->Tried_Curves_Count++;
+		if (!Is_Rejected) Pointer_Search->Counted_Curves_Count++;
+		Is_Searching = Pointer_Search->Found_Curves_Count < Pointer_Search->Curves_Count;
+		pthread_mutex_unlock(&Pointer_Search->Mutex);
+		if (Is_Rejected || !Is_Searching) continue;
+		
+		// When the order is a prime, any point generates the curve and its order is the only multiple found in the Hasse interval
+		mpz_set(Curve.n, Curve.p); // n is not known yet and only the field arithmetic is needed, p is an odd placeholder of the same size so the scalar field can be prepared too
+		if (!ECSelectArithmetic(&Curve))
+		{
+			printf("Error : the field arithmetic can't be prepared.\n");
+			pthread_mutex_lock(&Pointer_Search->Mutex);
+			Pointer_Search->Curves_Count = 0; // Stop the other threads
+			pthread_mutex_unlock(&Pointer_Search->Mutex);
+			Pointer_Result = Pointer_Search;
+			break;
+		}
+		CurveGeneratorGetRandomPoint(&Curve, &Curve.Point_Generator);
+		if (!CurveGeneratorFindOrderMultiple(&Curve, &Curve.Point_Generator, Curve.n))
+		{
+			printf("Error : not enough memory for the baby steps.\n");
+			Pointer_Result = Pointer_Search;
+			break;
+		}
+		
+		// A prime multiple can be a smaller point order only if it lies outside the Hasse interval : |p + 1 - n| <= 2.sqrt(p), and the cofactor is 1 only if n > 4.sqrt(p)
+		mpz_add_ui(Number_Temp, Curve.p, 1);
+		mpz_sub(Number_Temp, Number_Temp, Curve.n);
+		mpz_mul(Number_Temp, Number_Temp, Number_Temp);
+		mpz_submul_ui(Number_Temp, Curve.p, 4);
+		if ((mpz_sgn(Number_Temp) > 0) || !mpz_probab_prime_p(Curve.n, 30) || !CurveGeneratorIsOrderSafe(Curve.p, Curve.n)) continue;
+		
+		pthread_mutex_lock(&Pointer_Search->Mutex);
+		if (Pointer_Search->Found_Curves_Count < Pointer_Search->Curves_Count)
+		{
+			if (!CurveGeneratorWriteCurve(Pointer_Search, &Curve))
+			{
+				Pointer_Result = Pointer_Search;
+				Pointer_Search->Curves_Count = 0; // Stop the other threads
+			}
+		}
+		pthread_mutex_unlock(&Pointer_Search->Mutex);
+	}
+	
+	for (i = 0; i < (int) (sizeof(Polynomials) / sizeof(Polynomials[0])); i++) CurveGeneratorPolynomialFree(&Polynomials[i]);
+	mpz_clear(Number_Temp);
+	ECFree(&Curve);
+	return Pointer_Result;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	TCurveGeneratorSearch Search;
+	mpz_t Number_Bound;
+	pthread_t *Pointer_Threads;
+	int i, Bits_Count, Threads_Count, Started_Threads_Count, Return_Value = 0;
+	long long Time;
+	void *Pointer_Thread_Result;
+	
+	// Check parameters
+	if ((argc < 4) || (argc > 5))
+	{
+		printf("Error : bad parameters.\n" \
+			"Usage : %s BitsCount CurvesCount OutputPrefix [ThreadsCount]\n" \
+			"Search CurvesCount prime order curves over a random prime field of BitsCount bits (from %d to %d), the curves are written to OutputPrefix-001.gp, OutputPrefix-002.gp...\n" \
+			"ThreadsCount threads test curves in parallel (default is the processors count).\n" \
+			"The order counting time grows exponentially with the field size, so only small test curves can be generated, cryptographic size curves need a Schoof-Elkies-Atkin implementation like PARI/GP ellsea().\n", argv[0], CURVE_GENERATOR_MINIMUM_BITS, CURVE_GENERATOR_MAXIMUM_BITS);
+		return -1;
+	}
+	Bits_Count = atoi(argv[1]);
+	Search.Curves_Count = atoi(argv[2]);
+	Search.String_Prefix = argv[3];
+	if (argc == 5) Threads_Count = atoi(argv[4]);
+	else Threads_Count = sysconf(_SC_NPROCESSORS_ONLN);
+	if ((Bits_Count < CURVE_GENERATOR_MINIMUM_BITS) || (Bits_Count > CURVE_GENERATOR_MAXIMUM_BITS) || (Search.Curves_Count < 1) || (Threads_Count < 1))
+	{
+		printf("Error : the bits count must be in [%d, %d], the curves and threads counts must be positive.\n", CURVE_GENERATOR_MINIMUM_BITS, CURVE_GENERATOR_MAXIMUM_BITS);
+		return -1;
+	}
+	UtilsInitializeRandomGenerator();
+	
+	// Pick a random prime of the requested size, congruent to 3 modulo 4 to easily compute square roots
+	mpz_init(Search.p);
+	mpz_init(Number_Bound);
+	mpz_setbit(Number_Bound, Bits_Count - 1);
+	do
+	{
+		UtilsGenerateRandomNumber(Number_Bound, Search.p);
+		mpz_setbit(Search.p, Bits_Count - 1);
+		mpz_setbit(Search.p, 0);
+		mpz_setbit(Search.p, 1);
+	} while (!mpz_probab_prime_p(Search.p, 30));
+	mpz_clear(Number_Bound);
+	gmp_printf("p = %Zd\n", Search.p);
+	
+	Search.Found_Curves_Count = 0;
+	Search.Tried_Curves_Count = 0;
+	Search.Counted_Curves_Count = 0;
+	pthread_mutex_init(&Search.Mutex, NULL);
+	Pointer_Threads = malloc(Threads_Count * sizeof(pthread_t));
+	if (Pointer_Threads == NULL)
+	{
+		printf("Error : not enough memory.\n");
+		Return_Value = -2;
+		goto Exit;
+	}
+	
+	// Search in parallel
+	Time = UtilsGetTime();
+	for (Started_Threads_Count = 0; Started_Threads_Count < Threads_Count; Started_Threads_Count++)
+	{
+		if (pthread_create(&Pointer_Threads[Started_Threads_Count], NULL, CurveGeneratorThread, &Search) != 0)
+		{
+			printf("Error : could not create the search threads.\n");
+			pthread_mutex_lock(&Search.Mutex);
+			Search.Curves_Count = 0; // Stop the started threads
+			pthread_mutex_unlock(&Search.Mutex);
+			Return_Value = -3;
+			break;
+		}
+	}
+	for (i = 0; i < Started_Threads_Count; i++)
+	{
+		pthread_join(Pointer_Threads[i], &Pointer_Thread_Result);
+		if (Pointer_Thread_Result != NULL) Return_Value = -3;
+	}
+	Time = UtilsGetTime() - Time;
+	printf("%llu curves tried, %llu passed the small primes sieve, %.3f s.\n", Search.Tried_Curves_Count, Search.Counted_Curves_Count, Time / 1000000.0);
+	free(Pointer_Threads);
+	
+Exit:
+	pthread_mutex_destroy(&Search.Mutex);
+	mpz_clear(Search.p);
+	return Return_Value;
+}
@@ -0,0 +1,73 @@
+/** @file Curves_Registry.c
+ * Curves compiled into the programs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "Curves_Registry.h"
+#include "Elliptic_Curves.h"
+
+int CurvesRegistryLoad(char *String_Name, TEllipticCurve *Pointer_Curve)
+{
+	const TCurvesRegistryEntry *Pointer_Entry = NULL;
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	int i, Points_Count;
+	mpz_ptr Pointer_Numbers[7] = {Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->h, Pointer_Curve->Point_Generator.X, Pointer_Curve->Point_Generator.Y};
+	
+	// Find the curve
+	for (i = 0; i < Curves_Registry_Entries_Count; i++)
+	{
+		if (strcmp(Curves_Registry_Entries[i].String_Name, String_Name) == 0)
+		{
+			Pointer_Entry = &Curves_Registry_Entries[i];
+			break;
+		}
+	}
+	if (Pointer_Entry == NULL) return 0;
+	
+	// Make the curve numbers point to the built-in data
+	Points_Count = Pointer_Entry->Generator_Table_Windows_Count * ((1 << Pointer_Entry->Generator_Table_Window_Size) - 1);
+	Pointer_Table->Pointer_Points = malloc(Points_Count * sizeof(TPoint));
+	if (Pointer_Table->Pointer_Points == NULL) return 0;
+	
+	for (i = 0; i < 7; i++) mpz_roinit_n(Pointer_Numbers[i], Pointer_Entry->Pointer_Parameters + i * Pointer_Entry->Limbs_Count, Pointer_Entry->Limbs_Count);
+	Pointer_Curve->Point_Generator.Is_Infinite = 0;
+	Pointer_Curve->Is_Read_Only = 1;
+	Pointer_Curve->Model = EC_MODEL_WEIERSTRASS;
+	Pointer_Curve->Pointer_Mapped_File = NULL;
+	if (!ECSelectArithmetic(Pointer_Curve))
+	{
+		free(Pointer_Table->Pointer_Points);
+		return 0;
+	}
+	
+	// Same thing for the generator table
+	Pointer_Table->Window_Size = Pointer_Entry->Generator_Table_Window_Size;
+	Pointer_Table->Windows_Count = Pointer_Entry->Generator_Table_Windows_Count;
+	Pointer_Table->Is_Read_Only = 1;
+	for (i = 0; i < Points_Count; i++)
+	{
+		mpz_roinit_n(Pointer_Table->Pointer_Points[i].X, Pointer_Entry->Pointer_Generator_Table_Points + 2 * i * Pointer_Entry->Limbs_Count, Pointer_Entry->Limbs_Count);
+		mpz_roinit_n(Pointer_Table->Pointer_Points[i].Y, Pointer_Entry->Pointer_Generator_Table_Points + (2 * i + 1) * Pointer_Entry->Limbs_Count, Pointer_Entry->Limbs_Count);
+		Pointer_Table->Pointer_Points[i].Is_Infinite = Pointer_Entry->Pointer_Generator_Table_Infinity_Flags[i];
+	}
+	return 1;
+}
+
+int CurvesRegistryLoadByNameOrPath(char *String_Name_Or_Path, TEllipticCurve *Pointer_Curve)
+{
+	if (CurvesRegistryLoad(String_Name_Or_Path, Pointer_Curve)) return 1;
+	return ECLoadFromFile(String_Name_Or_Path, Pointer_Curve);
+}
+
+void CurvesRegistryShowNames(void)
+{
+	int i;
+	
+	for (i = 0; i < Curves_Registry_Entries_Count; i++)
+	{
+		if (i > 0) putchar(' ');
+		printf("%s", Curves_Registry_Entries[i].String_Name);
+	}
+}
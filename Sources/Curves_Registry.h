@@ -0,0 +1,54 @@
+/** @file Curves_Registry.h
+ * Curves compiled into the programs. Their parameters and generator tables are generated at build time from the .gp files by Curves_Registry_Generator,
+ * so loading them needs no file access, no parsing and no table computation.
+ */
+#ifndef H_CURVES_REGISTRY_H
+#define H_CURVES_REGISTRY_H
+
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A built-in curve. Numbers are stored as Limbs_Count native limbs, least significant limb first. */
+typedef struct
+{
+	const char *String_Name; //! The name used to find the curve.
+	int Limbs_Count; //! How many limbs are used to store each number.
+	const mp_limb_t *Pointer_Parameters; //! p, n, a4, a6, h, gx and gy, in this order.
+	int Generator_Table_Window_Size; //! Generator table window size.
+	int Generator_Table_Windows_Count; //! Generator table windows count.
+	const mp_limb_t *Pointer_Generator_Table_Points; //! X then Y of each generator table point.
+	const unsigned char *Pointer_Generator_Table_Infinity_Flags; //! Tell which generator table points are infinite.
+} TCurvesRegistryEntry;
+
+//--------------------------------------------------------------------------------------------------------
+// Variables
+//--------------------------------------------------------------------------------------------------------
+/** All built-in curves (generated at build time). */
+extern const TCurvesRegistryEntry Curves_Registry_Entries[];
+/** How many built-in curves there are. */
+extern const int Curves_Registry_Entries_Count;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Load a built-in curve. The curve numbers are read-only views of the built-in data.
+ * @param String_Name The curve name (like "P-256").
+ * @param Pointer_Curve Where to store the curve.
+ * @return 1 if the curve was found or 0 if there is no built-in curve with this name.
+ */
+int CurvesRegistryLoad(char *String_Name, TEllipticCurve *Pointer_Curve);
+
+/** Load a built-in curve if there is one with this name, otherwise load a curve file with ECLoadFromFile().
+ * @param String_Name_Or_Path A built-in curve name or a path to a .gp or binary curve file.
+ * @param Pointer_Curve Where to store the curve.
+ * @return 1 if the curve was successfully loaded or 0 if it was not found.
+ */
+int CurvesRegistryLoadByNameOrPath(char *String_Name_Or_Path, TEllipticCurve *Pointer_Curve);
+
+/** Display the built-in curves names separated by spaces. */
+void CurvesRegistryShowNames(void);
+
+#endif
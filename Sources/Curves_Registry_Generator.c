@@ -0,0 +1,125 @@
+/** @file Curves_Registry_Generator.c
+ * Build-time tool generating the C source of the built-in curves registry from .gp files.
+ */
+#include <ctype.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <string.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+
+/** Maximum length in characters of a curve name. */
+#define MAXIMUM_NAME_LENGTH 256
+
+/** Write a number as an array initializer using a fixed amount of limbs.
+ * @param File The generated source file.
+ * @param Number The number to write.
+ * @param Limbs_Count How many limbs to write.
+ */
+static void WriteNumber(FILE *File, mpz_t Number, size_t Limbs_Count)
+{
+	size_t i;
+	
+	for (i = 0; i < Limbs_Count; i++) gmp_fprintf(File, "0x%MxU, ", mpz_getlimbn(Number, i)); // mpz_getlimbn() returns 0 for limbs above the number size
+	fputc('\n', File);
+}
+
+/** Write the data of a curve.
+ * @param File The generated source file.
+ * @param Pointer_Curve The curve.
+ * @param String_Identifier The C identifier suffix of the curve.
+ * @return How many limbs are used to store each number.
+ */
+static size_t WriteCurve(FILE *File, TEllipticCurve *Pointer_Curve, char *String_Identifier)
+{
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	size_t Limbs_Count = 1;
+	int i, Points_Count;
+	mpz_ptr Pointer_Numbers[7] = {Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->h, Pointer_Curve->Point_Generator.X, Pointer_Curve->Point_Generator.Y};
+	
+	// All numbers use the same amount of limbs
+	Points_Count = Pointer_Table->Windows_Count * ((1 << Pointer_Table->Window_Size) - 1);
+	for (i = 0; i < 7; i++)
+	{
+		if (mpz_size(Pointer_Numbers[i]) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Numbers[i]);
+	}
+	for (i = 0; i < Points_Count; i++)
+	{
+		if (mpz_size(Pointer_Table->Pointer_Points[i].X) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Table->Pointer_Points[i].X);
+		if (mpz_size(Pointer_Table->Pointer_Points[i].Y) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Table->Pointer_Points[i].Y);
+	}
+	
+	// Parameters
+	fprintf(File, "static const mp_limb_t Parameters_%s[] =\n{\n", String_Identifier);
+	for (i = 0; i < 7; i++) WriteNumber(File, Pointer_Numbers[i], Limbs_Count);
+	fprintf(File, "};\n\n");
+	
+	// Generator table
+	fprintf(File, "static const mp_limb_t Generator_Table_Points_%s[] =\n{\n", String_Identifier);
+	for (i = 0; i < Points_Count; i++)
+	{
+		WriteNumber(File, Pointer_Table->Pointer_Points[i].X, Limbs_Count);
+		WriteNumber(File, Pointer_Table->Pointer_Points[i].Y, Limbs_Count);
+	}
+	fprintf(File, "};\n\n");
+	
+	fprintf(File, "static const unsigned char Generator_Table_Infinity_Flags_%s[] =\n{\n", String_Identifier);
+	for (i = 0; i < Points_Count; i++) fprintf(File, "%d,%c", Pointer_Table->Pointer_Points[i].Is_Infinite, (i % 32 == 31) ? '\n' : ' ');
+	fprintf(File, "\n};\n\n");
+	
+	return Limbs_Count;
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *File;
+	TEllipticCurve Curve;
+	char String_Names[argc][MAXIMUM_NAME_LENGTH], String_Identifiers[argc][MAXIMUM_NAME_LENGTH], *String_Extension;
+	size_t Limbs_Counts[argc];
+	int Windows_Counts[argc], i, j;
+	
+	if (argc < 2)
+	{
+		printf("Error : bad parameters.\nUsage : %s OutputFile.c [EllipticCurveFile.gp...]\nThe curve name is the file name without its extension.\n", argv[0]);
+		return -1;
+	}
+	
+	File = fopen(argv[1], "w");
+	if (File == NULL)
+	{
+		printf("Error : can't create output file.\n");
+		return -2;
+	}
+	fprintf(File, "/** @file Curves_Registry_Data.c\n * Built-in curves, generated by Curves_Registry_Generator. Do not edit.\n */\n#include <gmp.h>\n#include \"Curves_Registry.h\"\n\n");
+	
+	for (i = 2; i < argc; i++)
+	{
+		if (!ECLoadFromFile(argv[i], &Curve))
+		{
+			printf("Error : can't load curve file %s.\n", argv[i]);
+			fclose(File);
+			remove(argv[1]);
+			return -3;
+		}
+		
+		// The curve name is the file name without extension, the identifier is the name made C compliant
+		snprintf(String_Names[i], MAXIMUM_NAME_LENGTH, "%s", basename(argv[i]));
+		String_Extension = strrchr(String_Names[i], '.');
+		if (String_Extension != NULL) *String_Extension = 0;
+		for (j = 0; String_Names[i][j] != 0; j++) String_Identifiers[i][j] = isalnum((unsigned char) String_Names[i][j]) ? String_Names[i][j] : '_';
+		String_Identifiers[i][j] = 0;
+		
+		Limbs_Counts[i] = WriteCurve(File, &Curve, String_Identifiers[i]);
+		Windows_Counts[i] = Curve.Generator_Table.Windows_Count;
+		ECFree(&Curve);
+	}
+	
+	// Registry
+	fprintf(File, "const TCurvesRegistryEntry Curves_Registry_Entries[] =\n{\n");
+	for (i = 2; i < argc; i++) fprintf(File, "\t{\"%s\", %zu, Parameters_%s, %d, %d, Generator_Table_Points_%s, Generator_Table_Infinity_Flags_%s},\n", String_Names[i], Limbs_Counts[i], String_Identifiers[i], EC_GENERATOR_TABLE_WINDOW_SIZE, Windows_Counts[i], String_Identifiers[i], String_Identifiers[i]);
+	if (argc == 2) fprintf(File, "\t{0}\n");
+	fprintf(File, "};\n\nconst int Curves_Registry_Entries_Count = %d;\n", argc - 2);
+	
+	fclose(File);
+	return 0;
+}
@@ -5,198 +5,69 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <string.h>
+#include "Curves_Registry.h"
 #include "Elliptic_Curves.h"
+#include "Encodings.h"
+#include "Instrumentation.h"
+#include "Log.h"
 #include "Network.h"
+#include "Protocols.h"
+#include "Public_Key_Cache.h"
 #include "Utils.h"
 
 /** Maximum number of bytes (including the trailing zero) of the message. */
 #define MAXIMUM_MESSAGE_SIZE 2048
-
-/** Check if the number is comprised between 1 and Number_Order - 1.
- * @param Number The number to check.
- * @param Number_Order The order of the group.
- * @return 1 if the number is in bounds or 0 if not.
- */
-static int IsNumberInBounds(mpz_t Number, mpz_t Number_Order)
-{
-	if (mpz_cmp_ui(Number, 1) < 0) return 0;
-	if (mpz_cmp(Number, Number_Order) >= 0) return 0;
-	return 1;
-}
+/** How many bytes can be used to remember the public keys signatures were checked with. */
+#define PUBLIC_KEYS_CACHE_SIZE (64 * 1024 * 1024)
+/** How many messages Alice signs with the same key, Bob validates the key and builds its table only for the first one. */
+#define MESSAGES_COUNT 4
 
 /** Sign a message.
  * @param Pointer_Curve The curve used for calculations.
  * @param Pointer_Message The message to sign.
  * @param Message_Length Size of the message in bytes.
- * @param Private_Key_Alice Alice's private key.
- * @param Output_Number_U On output, contain the generated signature 'u' number.
- * @param Output_Number_V On output, contain the generated signature 'v' number.
+ * @param Pointer_Private_Key_Alice Alice's private key.
+ * @param Pointer_Output_Signature On output, contain the raw signature ('u' followed by 'v').
+ * @return 1 if the message was signed or 0 if its hash could not be computed.
  */
-static void DSAAlice(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Message, size_t Message_Length, mpz_t Private_Key_Alice, mpz_t Output_Number_U, mpz_t Output_Number_V)
+static int DSAAlice(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Message, size_t Message_Length, unsigned char *Pointer_Private_Key_Alice, unsigned char *Pointer_Output_Signature)
 {
-	unsigned char Buffer_Hash[UTILS_HASH_LENGTH];
-	mpz_t Number_Temp, Number_Hash, Number_Random;
-	TPoint Point;
+	int Return_Value;
 	
-	// Initialize variables
-	mpz_init(Number_Temp);
-	mpz_init(Number_Hash);
-	mpz_init(Number_Random);
-	PointCreate(0, 0, &Point);
+	INSTRUMENTATION_RESET();
 	
-	// Compute message hash
-	printf("Alice is computing message hash...\n");
-	UtilsComputeHash(Pointer_Message, Message_Length, Buffer_Hash);
-	mpz_set_str(Number_Hash, (char *) Buffer_Hash, 16);
-	UtilsShowHash(Buffer_Hash);
-	putchar('\n');
-	
-	// Generate signature pair (u, v)
-	while (1)
-	{
-		// Get a random K between 1 et n - 1
-		do
-		{
-			UtilsGenerateRandomNumber(Pointer_Curve->n, Number_Random);
-		} while (!IsNumberInBounds(Number_Random, Pointer_Curve->n));
-		
-		// Compute a curve point
-		ECMultiplication(Pointer_Curve, &Pointer_Curve->Point_Generator, Number_Random, &Point);
+	// Hash the message and generate the signature pair (u, v)
+	INSTRUMENTATION_START_PHASE("sign");
+	LOG_INFO("Alice is signing the message...\n");
+	Return_Value = ProtocolDSASign(Pointer_Curve, Pointer_Private_Key_Alice, Pointer_Message, Message_Length, Pointer_Output_Signature);
+	if (!Return_Value) LOG_ERROR("Error : could not sign the message.\n");
+	INSTRUMENTATION_SHOW("DSAAlice");
 	
-		// Calculate 'u'
-		mpz_mod(Output_Number_U, Point.X, Pointer_Curve->n);
-		// Retry if the computed 'u' is 0
-		if (mpz_cmp_ui(Output_Number_U, 0) == 0) continue;
-		
-		// Calculate 'v'
-		mpz_mul(Number_Temp, Output_Number_U, Private_Key_Alice); // u * s
-		mpz_add(Number_Temp, Number_Temp, Number_Hash); // H(m) + (u * s)
-		mpz_invert(Output_Number_V, Number_Random, Pointer_Curve->n); // Compute k^-1 mod n
-		mpz_mul(Number_Temp, Output_Number_V, Number_Temp); // (k^-1) * (H(m) + (u * s))
-		mpz_mod(Output_Number_V, Number_Temp, Pointer_Curve->n); // (k^-1) * (H(m) + (u * s)) mod n
-		
-		// Retry if the computed 'v' is 0
-		if (mpz_cmp_ui(Output_Number_V, 0) != 0) break;
-	}
-	
-	// Display signature pair
-	gmp_printf("Signature :\nu = %Zd\nv = %Zd\n\n", Output_Number_U, Output_Number_V);
-	
-	// Free resources
-	mpz_clear(Number_Temp);
-	mpz_clear(Number_Hash);
-	mpz_clear(Number_Random);
-	PointFree(&Point);
+	return Return_Value;
 }
 
 /** Check a message signature.
  * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Public_Keys_Cache The already checked public keys (it avoids validating the same key and computing its multiples again).
  * @param Pointer_Message The message to check.
  * @param Message_Length Size of message in bytes.
- * @param Pointer_Public_Key_Alice Alice's public key.
- * @param Number_U The signature 'u' number.
- * @param Number_V The signature 'v' number.
+ * @param Pointer_Public_Key_Alice Alice's raw public key (X followed by Y).
+ * @param Pointer_Signature The raw signature ('u' followed by 'v').
  * @return 0 if the signature is bad or 1 if there is a signature match.
  */
-static int DSABob(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Message, size_t Message_Length, TPoint *Pointer_Public_Key_Alice, mpz_t Number_U, mpz_t Number_V)
+static int DSABob(TEllipticCurve *Pointer_Curve, TPublicKeyCache *Pointer_Public_Keys_Cache, unsigned char *Pointer_Message, size_t Message_Length, unsigned char *Pointer_Public_Key_Alice, unsigned char *Pointer_Signature)
 {
-	unsigned char Buffer_Hash[UTILS_HASH_LENGTH];
-	mpz_t Number_Hash, Number_Temp;
-	TPoint Point_Temp, Point_Temp_2;
-	int Return_Value = 0;
+	int Return_Value;
 	
-	// Initialize variables
-	mpz_init(Number_Hash);
-	mpz_init(Number_Temp);
-	PointCreate(0, 0, &Point_Temp);
-	PointCreate(0, 0, &Point_Temp_2);
-		
-	// Check parameters correctness
-	printf("Bob is checking parameters correctness... ");
-	fflush(stdout);
-	
-	// 'u' must be between 1 and n - 1)
-	if (!IsNumberInBounds(Number_U, Pointer_Curve->n))
-	{
-		printf("\nError : 'u' is not in [1; n - 1].\n");
-		goto Exit;
-	}
-
-	// 'v' must be between 1 and n - 1)
-	if (!IsNumberInBounds(Number_V, Pointer_Curve->n))
-	{
-		printf("\nError : 'v' is not in [1; n - 1].\n");
-		goto Exit;
-	}
-	
-	// Alice's public key (Q) must not be equal to (0, 0)
-	if (Pointer_Public_Key_Alice->Is_Infinite)
-	{
-		printf("\nError : Alice's public key is equal to (0, 0).\n");
-		goto Exit;
-	}
-	
-	// n * Q must be equal to (0, 0)
-	ECMultiplication(Pointer_Curve, Pointer_Public_Key_Alice, Pointer_Curve->n, &Point_Temp);
-	if (!Point_Temp.Is_Infinite)
-	{
-		printf("\nError : n.Q != (0, 0).\n");
-		PointShow(&Point_Temp);
-		goto Exit;
-	}
-	
-	// Check if Q lies on the curve
-	if (!ECIsPointOnCurve(Pointer_Curve, Pointer_Public_Key_Alice))
-	{
-		printf("\nError : Q is not a point of the curve.\n");
-		goto Exit;
-	}
-	printf("done.\n\n");
+	INSTRUMENTATION_RESET();
 	
-	// Compute message hash
-	printf("Bob is computing message hash...\n");
-	UtilsComputeHash(Pointer_Message, Message_Length, Buffer_Hash);
-	mpz_set_str(Number_Hash, (char *) Buffer_Hash, 16);
-	UtilsShowHash(Buffer_Hash);
-	putchar('\n');
-	
-	printf("Bob is checking signature...\n");
-	// Compute (H(m) / v) mod n using v^-1
-	mpz_invert(Number_V, Number_V, Pointer_Curve->n); // Only v^-1 is used by other calculations
-	mpz_mul(Number_Temp, Number_Hash, Number_V);
-	mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->n);
-
-	// Compute (H(m) / v mod n) * P
-	ECMultiplication(Pointer_Curve, &Pointer_Curve->Point_Generator, Number_Temp, &Point_Temp);
-	
-	// Compute u / v mod n using v^-1
-	mpz_mul(Number_Temp, Number_U, Number_V);
-	mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->n);
-	
-	// Multiply to public key Q
-	ECMultiplication(Pointer_Curve, Pointer_Public_Key_Alice, Number_Temp, &Point_Temp_2);
-	
-	// Add the two points
-	ECAddition(Pointer_Curve, &Point_Temp, &Point_Temp_2, &Point_Temp);
-	
-	// Is resulting point X coordinate equal to u ?
-	mpz_mod(Number_Temp, Point_Temp.X, Pointer_Curve->n);
-	gmp_printf("u = %Zd\nResult = %Zd\n", Number_U, Number_Temp);
-	if (mpz_cmp(Number_U, Number_Temp) == 0)
-	{
-		printf("\033[32mSUCCESS : signature matched.\n");
-		Return_Value = 1;
-	}
-	else printf("\033[31mFAILURE : bad signature.\n");
-	// Reset color attributes
-	printf("\033[0m");
-	
-Exit:
-	// Free resources
-	mpz_clear(Number_Hash);
-	mpz_clear(Number_Temp);
-	PointFree(&Point_Temp);
-	PointFree(&Point_Temp_2);
+	// 'u' and 'v' must be in [1; n - 1] and Alice's public key must be a point of the curve subgroup, the key is checked only the first time it is seen
+	INSTRUMENTATION_START_PHASE("verify");
+	LOG_INFO("Bob is checking signature...\n");
+	Return_Value = ProtocolDSAVerify(Pointer_Curve, Pointer_Public_Keys_Cache, Pointer_Public_Key_Alice, Pointer_Message, Message_Length, Pointer_Signature);
+	if (Return_Value) LOG_INFO("\033[32mSUCCESS : signature matched.\033[0m\n");
+	else LOG_ERROR("\033[31mFAILURE : bad signature.\033[0m\n");
+	INSTRUMENTATION_SHOW("DSABob");
 	
 	return Return_Value;
 }
@@ -206,18 +77,24 @@ int main(int argc, char *argv[])
 	char Is_Alice, *String_Parameter_Character, *String_Parameter_File_Name, *String_Parameter_IP_Address, Message[MAXIMUM_MESSAGE_SIZE];
 	unsigned short Port;
 	TEllipticCurve Curve;
-	int Socket_Alice, Socket_Bob, Message_Length;
-	mpz_t Private_Key_Alice, Signature_Number_U, Signature_Number_V;
+	int Socket_Alice, Socket_Bob, Message_Length, i;
 	TPoint Point_Public_Key_Alice;
+	TPublicKeyCache Public_Keys_Cache;
+	unsigned char Private_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Alice[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Buffer_Public_Key[ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE], Buffer_Signature[ENCODING_MAXIMUM_RAW_SIGNATURE_SIZE];
+	size_t Public_Key_Size, Signature_Size;
 	
 	// Check parameters
 	if (argc != 5)
 	{
 		printf("Error : bad parameters.\n" \
 			"Usages :\n" \
-			"%s -alice ServerIPAddressToBind ServerPort EllipticCurveFile.gp\n" \
-			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurveFile.gp\n" \
+			"%s -alice ServerIPAddressToBind ServerPort EllipticCurve\n" \
+			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurve\n" \
+			"EllipticCurve is a built-in curve name or a curve file path.\n" \
 			"Remember that Alice must be launched first (she will provide the server Bob can connect to).\n", argv[0], argv[0]);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
 		return -1;
 	}
 	String_Parameter_Character = argv[1];
@@ -225,28 +102,30 @@ int main(int argc, char *argv[])
 	Port = atoi(argv[3]);
 	String_Parameter_File_Name = argv[4];
 	
+	// Write the protocol steps from a background thread, the LOG_LEVEL environment variable ("none", "error", "warning", "info" or "debug") selects how much is written, only the errors are written by default
+	LogStart(LogParseLevel(getenv("LOG_LEVEL"), LOG_LEVEL_ERROR), NULL, NULL, 1);
+	
 	// Set server or client mode according to choosen character
 	if (strcmp(String_Parameter_Character, "-alice") == 0) Is_Alice = 1;
 	else if (strcmp(String_Parameter_Character, "-bob") == 0) Is_Alice = 0;
 	else
 	{
-		printf("Error : unknown character. You must select Alice or Bob.\n");
+		LOG_ERROR("Error : unknown character. You must select Alice or Bob.\n");
 		return -2;
 	}
 	
-	// Load elliptic curve file
-	if (!ECLoadFromFile(String_Parameter_File_Name, &Curve))
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(String_Parameter_File_Name, &Curve))
 	{
-		printf("Error : can't load curve file.\n");
+		LOG_ERROR("Error : can't load curve file.\n");
 		return -3;
 	}
 	
 	UtilsInitializeRandomGenerator();
 	
 	// Initialize variables
-	mpz_init(Signature_Number_U);
-	mpz_init(Signature_Number_V);
 	PointCreate(0, 0, &Point_Public_Key_Alice);
+	Signature_Size = 2 * ProtocolGetScalarSize(&Curve);
 	
 	// Alice
 	if (Is_Alice)
@@ -255,71 +134,68 @@ int main(int argc, char *argv[])
 		Socket_Alice = NetworkServerCreate(String_Parameter_IP_Address, Port);
 		if (Socket_Alice < 0)
 		{
-			printf("Error : could not create the server.\n");
+			LOG_ERROR("Error : could not create the server.\n");
 			ECFree(&Curve);
 			return -4;
 		}
 		
 		// Wait for Bob
-		printf("Waiting for Bob... ");
-		fflush(stdout);
+		LOG_INFO("Waiting for Bob... ");
 		Socket_Bob = NetworkServerListen(Socket_Alice);
 		if (Socket_Bob < 0)
 		{
-			printf("Error : server could not accept Bob.\n");
+			LOG_ERROR("Error : server could not accept Bob.\n");
 			close(Socket_Alice);
 			ECFree(&Curve);
 			return -5;
 		}
-		printf("Bob is connected.\n\n");
-		
-		// Initialize variables
-		mpz_init(Private_Key_Alice);
+		LOG_INFO("Bob is connected.\n\n");
 		
-		// Generate Alice's private key 's' once
-		printf("Computing Alice's private key...\n");
-		do
+		// Generate Alice's private key 's' and her public key 'Q' = s.G once
+		LOG_INFO("Computing Alice's key pair...\n");
+		if (!ProtocolGenerateKeys(&Curve, Private_Key_Alice, Public_Key_Alice) || !EncodingImportRawPublicKey(&Curve, Public_Key_Alice, &Point_Public_Key_Alice))
 		{
-			UtilsGenerateRandomNumber(Curve.n, Private_Key_Alice);
-		} while (!IsNumberInBounds(Private_Key_Alice, Curve.n));
-		gmp_printf("%Zd\n\n", Private_Key_Alice);
-		
-		// Generate public key 'Q' = private key * curve point
-		printf("Computing Alice's public key...\n");
-		ECMultiplication(&Curve, &Curve.Point_Generator, Private_Key_Alice, &Point_Public_Key_Alice);
-		PointShow(&Point_Public_Key_Alice);
-		putchar('\n');
-		
-		// Send public key to Bob
-		printf("Sending public key to Bob... ");
-		fflush(stdout);
-		NetworkSendPoint(Socket_Bob, &Point_Public_Key_Alice);
-		printf("done.\n\n");
+			LOG_ERROR("Error : could not generate Alice's key pair.\n");
+			close(Socket_Bob);
+			goto Exit;
+		}
+		LOG_DEBUG("X = %Zd, Y = %Zd\n\n", Point_Public_Key_Alice.X, Point_Public_Key_Alice.Y);
 		
-		// Create message
-		strcpy(Message, "Ceci est un magnifique message de test.");
-		Message_Length = strlen(Message) + 1; // +1 for terminating zero
-
-		// Send message to Bob
-		printf("Sending message to Bob...\n%s\n\n", Message);
-		fflush(stdout);
-		// Send message size
-		write(Socket_Bob, &Message_Length, sizeof(Message_Length));
-		// Send message content
-		write(Socket_Bob, Message, Message_Length);
+		// Send public key to Bob in SEC1 compressed form, Bob finds Y back from X and its parity
+		LOG_INFO("Sending public key to Bob... ");
+		Public_Key_Size = EncodingExportSEC1PublicKey(&Curve, &Point_Public_Key_Alice, 1, Buffer_Public_Key);
+		if (Public_Key_Size == 0)
+		{
+			LOG_ERROR("Error : could not encode Alice's public key.\n");
+			close(Socket_Bob);
+			goto Exit;
+		}
+		NetworkSendBuffer(Socket_Bob, Buffer_Public_Key, Public_Key_Size);
+		LOG_INFO("done.\n\n");
 		
-		// Compute 'u' and 'v' numbers used to sign the message
-		DSAAlice(&Curve, (unsigned char *) Message, Message_Length, Private_Key_Alice, Signature_Number_U, Signature_Number_V);
-				
-		// Send 'u' and 'v' to Bob
-		printf("Sending signature numbers to Bob... ");
-		fflush(stdout);
-		NetworkSendMPZ(Socket_Bob, Signature_Number_U);
-		NetworkSendMPZ(Socket_Bob, Signature_Number_V);
-		printf("done.\n");
+		for (i = 0; i < MESSAGES_COUNT; i++)
+		{
+			// Create message
+			Message_Length = snprintf(Message, sizeof(Message), "Ceci est le magnifique message de test numero %d.", i + 1) + 1; // +1 for terminating zero
+			
+			// Send message to Bob
+			LOG_INFO("Sending message to Bob...\n%s\n\n", Message);
+			// Send message size
+			write(Socket_Bob, &Message_Length, sizeof(Message_Length));
+			// Send message content
+			write(Socket_Bob, Message, Message_Length);
+			
+			// Compute the raw signature, 'u' followed by 'v'
+			if (!DSAAlice(&Curve, (unsigned char *) Message, Message_Length, Private_Key_Alice, Buffer_Signature)) break;
+			
+			// Send the signature to Bob
+			LOG_INFO("Sending signature numbers to Bob... ");
+			NetworkSendBuffer(Socket_Bob, Buffer_Signature, Signature_Size);
+			LOG_INFO("done.\n\n");
+		}
 		
 		// Free resources
-		mpz_clear(Private_Key_Alice);
+		memset(Private_Key_Alice, 0, sizeof(Private_Key_Alice));
 		close(Socket_Bob);
 	}
 	// Bob
@@ -329,45 +205,65 @@ int main(int argc, char *argv[])
 		Socket_Alice = NetworkClientConnect(String_Parameter_IP_Address, Port);
 		if (Socket_Alice < 0)
 		{
-			printf("Error : could not connect to server.\n");
+			LOG_ERROR("Error : could not connect to server.\n");
 			ECFree(&Curve);
 			return 0;
 		}
-		printf("Connected to Alice.\n\n");
+		LOG_INFO("Connected to Alice.\n\n");
 		
-		// Receive Alice's public key
-		printf("Waiting for Alice's public key...\n");
-		NetworkReceivePoint(Socket_Alice, &Point_Public_Key_Alice);
-		PointShow(&Point_Public_Key_Alice);
-		putchar('\n');
+		// Bob only handles public values (keys, messages and signatures), so the variable time inversions can be used if they are faster
+		ECSelectFastestInversions(&Curve);
+		
+		// The cache lives as long as Bob, so Alice's key is validated once for all her messages
+		PublicKeyCacheCreate(&Public_Keys_Cache, PUBLIC_KEYS_CACHE_SIZE);
 		
-		// Receive message length
-		printf("Receiving Alice's message...\n");
-		read(Socket_Alice, &Message_Length, sizeof(Message_Length));
-		if (Message_Length > MAXIMUM_MESSAGE_SIZE)
+		// Receive Alice's public key
+		LOG_INFO("Waiting for Alice's public key...\n");
+		Public_Key_Size = 1 + ProtocolGetFieldElementSize(&Curve);
+		if (!NetworkReceiveBuffer(Socket_Alice, Buffer_Public_Key, Public_Key_Size) || !EncodingImportSEC1PublicKey(&Curve, Buffer_Public_Key, Public_Key_Size, &Point_Public_Key_Alice) || !EncodingExportRawPublicKey(&Curve, &Point_Public_Key_Alice, Public_Key_Alice))
 		{
-			printf("Error : the message is bigger than the buffer.\n");
+			LOG_ERROR("Error : the public key is not a point of the curve.\n");
 			goto Exit;
 		}
-		// Receive message content
-		read(Socket_Alice, Message, Message_Length);
-		printf("%s\n\n", Message);
-		
-		// Receive signature
-		printf("Receiving signature...\n");
-		NetworkReceiveMPZ(Socket_Alice, Signature_Number_U);
-		NetworkReceiveMPZ(Socket_Alice, Signature_Number_V);
-		gmp_printf("r = %Zd\ns = %Zd\n\n", Signature_Number_U, Signature_Number_V);
+		LOG_DEBUG("X = %Zd, Y = %Zd\n\n", Point_Public_Key_Alice.X, Point_Public_Key_Alice.Y);
 		
-		DSABob(&Curve, (unsigned char *) Message, Message_Length, &Point_Public_Key_Alice, Signature_Number_U, Signature_Number_V);
+		for (i = 0; i < MESSAGES_COUNT; i++)
+		{
+			// Receive message length
+			LOG_INFO("Receiving Alice's message...\n");
+			if ((read(Socket_Alice, &Message_Length, sizeof(Message_Length)) != sizeof(Message_Length)) || (Message_Length <= 0) || (Message_Length > MAXIMUM_MESSAGE_SIZE))
+			{
+				LOG_ERROR("Error : the message is empty or bigger than the buffer.\n");
+				goto Exit;
+			}
+			// Receive message content
+			if (!NetworkReceiveBuffer(Socket_Alice, Message, Message_Length))
+			{
+				LOG_ERROR("Error : could not receive the message.\n");
+				goto Exit;
+			}
+			Message[Message_Length - 1] = 0;
+			LOG_INFO("%s\n\n", Message);
+			
+			// Receive signature
+			LOG_INFO("Receiving signature...\n");
+			if (!NetworkReceiveBuffer(Socket_Alice, Buffer_Signature, Signature_Size))
+			{
+				LOG_ERROR("Error : could not receive the signature.\n");
+				goto Exit;
+			}
+			
+			DSABob(&Curve, &Public_Keys_Cache, (unsigned char *) Message, Message_Length, Public_Key_Alice, Buffer_Signature);
+			LOG_INFO("\n");
+		}
+		LOG_INFO("Public keys cache : %llu hit(s), %llu miss(es).\n", Public_Keys_Cache.Hits_Count, Public_Keys_Cache.Misses_Count);
 	}
 	
 Exit:
 	// Free resources
+	if (!Is_Alice) PublicKeyCacheFree(&Public_Keys_Cache);
 	close(Socket_Alice);
 	ECFree(&Curve);
-	mpz_clear(Signature_Number_U);
-	mpz_clear(Signature_Number_V);
 	PointFree(&Point_Public_Key_Alice);
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+/** @file DSA_Signature.c
+ * DSA signatures of message hashes, one at a time or by batches sharing their modular inversions.
+ */
+#include <stdlib.h>
+#include <gmp.h>
+#include "DSA_Signature.h"
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Scalar_Field.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Generate a random nonce in [1, n - 1].
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Output_Nonce On output, contain the nonce.
+ */
+static void DSASignatureGenerateNonce(TEllipticCurve *Pointer_Curve, mpz_t Output_Nonce)
+{
+	do
+	{
+		UtilsGenerateRandomNumber(Pointer_Curve->n, Output_Nonce);
+	} while (mpz_cmp_ui(Output_Nonce, 0) == 0);
+}
+
+/** Compute v = k^-1.(H(m) + u.s) mod n once u and k^-1 are known.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash.
+ * @param Private_Key The signer private key 's'.
+ * @param Pointer_Nonce_Inverse The inverse of the nonce modulo n.
+ * @param Number_U The signature 'u' number, it is set to 0 if 'v' is 0.
+ * @param Output_Number_V On output, contain the signature 'v' number.
+ * @return 1 if the signature is usable or 0 if v = 0.
+ */
+static int DSASignatureComputeV(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, TScalar *Pointer_Nonce_Inverse, mpz_t Number_U, mpz_t Output_Number_V)
+{
+	TScalarField *Pointer_Field = &Pointer_Curve->Scalar_Field;
+	TScalar Hash, Key, V;
+	
+	ScalarFieldImport(Pointer_Field, Number_Hash, &Hash);
+	ScalarFieldImport(Pointer_Field, Private_Key, &Key);
+	ScalarFieldImport(Pointer_Field, Number_U, &V);
+	ScalarFieldMultiply(Pointer_Field, &V, &Key, &V); // u * s
+	ScalarFieldAdd(Pointer_Field, &V, &Hash, &V); // H(m) + (u * s)
+	ScalarFieldMultiply(Pointer_Field, &V, Pointer_Nonce_Inverse, &V); // (k^-1) * (H(m) + (u * s)) mod n
+	ScalarFieldExport(Pointer_Field, &V, Output_Number_V);
+	
+	if (ScalarFieldIsZero(Pointer_Field, &V))
+	{
+		mpz_set_ui(Number_U, 0);
+		return 0;
+	}
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int DSASignatureSignWithNonce(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, mpz_t Nonce, mpz_t Output_Number_U, mpz_t Output_Number_V)
+{
+	TPoint Point;
+	TScalar Nonce_Inverse;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	PointCreate(0, 0, &Point);
+	
+	// Compute a curve point
+	ECMultiplicationGenerator(Pointer_Curve, Nonce, &Point);
+	
+	// Calculate 'u', the nonce can't be used if it is 0
+	if (Point.Is_Infinite) mpz_set_ui(Output_Number_U, 0);
+	else mpz_mod(Output_Number_U, Point.X, Pointer_Curve->n);
+	if (mpz_cmp_ui(Output_Number_U, 0) == 0)
+	{
+		mpz_set_ui(Output_Number_V, 0);
+		goto Exit;
+	}
+	
+	// Calculate 'v'
+	ScalarFieldImport(&Pointer_Curve->Scalar_Field, Nonce, &Nonce_Inverse);
+	if (!ScalarFieldInvert(&Pointer_Curve->Scalar_Field, &Nonce_Inverse, &Nonce_Inverse)) // Compute k^-1 mod n
+	{
+		mpz_set_ui(Output_Number_U, 0);
+		mpz_set_ui(Output_Number_V, 0);
+		goto Exit;
+	}
+	Return_Value = DSASignatureComputeV(Pointer_Curve, Number_Hash, Private_Key, &Nonce_Inverse, Output_Number_U, Output_Number_V);
+	
+Exit:
+	// Free resources
+	PointFree(&Point);
+	return Return_Value;
+}
+
+void DSASignatureSign(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, mpz_t Output_Number_U, mpz_t Output_Number_V)
+{
+	mpz_t Nonce;
+	
+	mpz_init(Nonce);
+	
+	// Retry with another nonce until both signature numbers are not 0
+	do
+	{
+		DSASignatureGenerateNonce(Pointer_Curve, Nonce);
+	} while (!DSASignatureSignWithNonce(Pointer_Curve, Number_Hash, Private_Key, Nonce, Output_Number_U, Output_Number_V));
+	
+	mpz_clear(Nonce);
+}
+
+int DSASignatureSignBatchWithNonces(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, int Hashes_Count, mpz_t Private_Key, mpz_t *Pointer_Nonces, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V)
+{
+	TScalarField *Pointer_Field = &Pointer_Curve->Scalar_Field;
+	TPoint *Pointer_Points;
+	TScalar *Pointer_Products, Inverse, Nonce_Inverse, Nonce;
+	int i, Return_Value = 0;
+	
+	if (Hashes_Count <= 0) return 1;
+	
+	// Initialize variables
+	Pointer_Points = malloc(Hashes_Count * sizeof(TPoint));
+	Pointer_Products = malloc(Hashes_Count * sizeof(TScalar));
+	if ((Pointer_Points == NULL) || (Pointer_Products == NULL))
+	{
+		free(Pointer_Points);
+		free(Pointer_Products);
+		return 0;
+	}
+	for (i = 0; i < Hashes_Count; i++) PointCreate(0, 0, &Pointer_Points[i]);
+	
+	// Compute all k.G points with a single field inversion
+	if (!ECMultiplicationGeneratorBatch(Pointer_Curve, Pointer_Nonces, Hashes_Count, Pointer_Points)) goto Exit;
+	
+	// Products[i] = k0 * k1 * ... * ki mod n
+	ScalarFieldImport(Pointer_Field, Pointer_Nonces[0], &Pointer_Products[0]);
+	for (i = 1; i < Hashes_Count; i++)
+	{
+		ScalarFieldImport(Pointer_Field, Pointer_Nonces[i], &Nonce);
+		ScalarFieldMultiply(Pointer_Field, &Pointer_Products[i - 1], &Nonce, &Pointer_Products[i]);
+	}
+	if (!ScalarFieldInvert(Pointer_Field, &Pointer_Products[Hashes_Count - 1], &Inverse)) goto Exit;
+	
+	// Compute the signatures starting from the last one, so the inverted product can be reduced one nonce after the other
+	for (i = Hashes_Count - 1; i >= 0; i--)
+	{
+		// ki^-1 = (k0 * ... * ki)^-1 * (k0 * ... * ki-1)
+		if (i > 0)
+		{
+			ScalarFieldMultiply(Pointer_Field, &Inverse, &Pointer_Products[i - 1], &Nonce_Inverse);
+			ScalarFieldImport(Pointer_Field, Pointer_Nonces[i], &Nonce);
+			ScalarFieldMultiply(Pointer_Field, &Inverse, &Nonce, &Inverse);
+		}
+		else Nonce_Inverse = Inverse;
+		
+		// Calculate 'u'
+		if (Pointer_Points[i].Is_Infinite) mpz_set_ui(Pointer_Output_Numbers_U[i], 0);
+		else mpz_mod(Pointer_Output_Numbers_U[i], Pointer_Points[i].X, Pointer_Curve->n);
+		if (mpz_cmp_ui(Pointer_Output_Numbers_U[i], 0) == 0)
+		{
+			mpz_set_ui(Pointer_Output_Numbers_V[i], 0);
+			continue;
+		}
+		
+		// Calculate 'v'
+		DSASignatureComputeV(Pointer_Curve, Pointer_Hashes[i], Private_Key, &Nonce_Inverse, Pointer_Output_Numbers_U[i], Pointer_Output_Numbers_V[i]);
+	}
+	Return_Value = 1;
+	
+Exit:
+	// Free resources
+	for (i = 0; i < Hashes_Count; i++) PointFree(&Pointer_Points[i]);
+	free(Pointer_Points);
+	free(Pointer_Products);
+	return Return_Value;
+}
+
+int DSASignatureSignBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, int Hashes_Count, mpz_t Private_Key, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V)
+{
+	mpz_t *Pointer_Nonces;
+	int i, Return_Value;
+	
+	// Generate all nonces
+	Pointer_Nonces = malloc(Hashes_Count * sizeof(mpz_t));
+	if (Pointer_Nonces == NULL) return 0;
+	for (i = 0; i < Hashes_Count; i++)
+	{
+		mpz_init(Pointer_Nonces[i]);
+		DSASignatureGenerateNonce(Pointer_Curve, Pointer_Nonces[i]);
+	}
+	
+	Return_Value = DSASignatureSignBatchWithNonces(Pointer_Curve, Pointer_Hashes, Hashes_Count, Private_Key, Pointer_Nonces, Pointer_Output_Numbers_U, Pointer_Output_Numbers_V);
+	
+	// Sign again with a new nonce the rare hashes whose nonce gave a 0 number
+	if (Return_Value)
+	{
+		for (i = 0; i < Hashes_Count; i++)
+		{
+			if (mpz_cmp_ui(Pointer_Output_Numbers_U[i], 0) == 0) DSASignatureSign(Pointer_Curve, Pointer_Hashes[i], Private_Key, Pointer_Output_Numbers_U[i], Pointer_Output_Numbers_V[i]);
+		}
+	}
+	
+	// Free resources
+	for (i = 0; i < Hashes_Count; i++) mpz_clear(Pointer_Nonces[i]);
+	free(Pointer_Nonces);
+	return Return_Value;
+}
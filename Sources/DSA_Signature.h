@@ -0,0 +1,57 @@
+/** @file DSA_Signature.h
+ * Compute DSA signatures (u, v) of message hashes, one at a time or by batches sharing their modular inversions.
+ */
+#ifndef H_DSA_SIGNATURE_H
+#define H_DSA_SIGNATURE_H
+
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Sign a message hash with a given nonce : u = (k.G).x mod n, v = k^-1.(H(m) + u.s) mod n.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash.
+ * @param Private_Key The signer private key 's'.
+ * @param Nonce The random number 'k' in [1, n - 1], it must never be used for another signature.
+ * @param Output_Number_U On output, contain the signature 'u' number.
+ * @param Output_Number_V On output, contain the signature 'v' number.
+ * @return 1 if the signature was computed or 0 if the nonce gives u = 0 or v = 0 (both numbers are set to 0 then, another nonce must be used).
+ */
+int DSASignatureSignWithNonce(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, mpz_t Nonce, mpz_t Output_Number_U, mpz_t Output_Number_V);
+
+/** Sign a message hash with a random nonce.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash.
+ * @param Private_Key The signer private key 's'.
+ * @param Output_Number_U On output, contain the signature 'u' number.
+ * @param Output_Number_V On output, contain the signature 'v' number.
+ */
+void DSASignatureSign(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, mpz_t Output_Number_U, mpz_t Output_Number_V);
+
+/** Sign many message hashes with the same private key and the given nonces. The results are the ones DSASignatureSignWithNonce() would give for each hash,
+ * but all nonces multiples k.G are converted to affine coordinates with one field inversion and all nonces are inverted with one inversion modulo n (Montgomery's trick).
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Hashes The messages hashes.
+ * @param Hashes_Count How many hashes there are.
+ * @param Private_Key The signer private key 's'.
+ * @param Pointer_Nonces One nonce in [1, n - 1] per hash.
+ * @param Pointer_Output_Numbers_U On output, contain the signatures 'u' numbers (they must be initialized by the user).
+ * @param Pointer_Output_Numbers_V On output, contain the signatures 'v' numbers (they must be initialized by the user).
+ * @return 1 if the signatures were computed (a signature whose nonce gives u = 0 or v = 0 has both numbers set to 0) or 0 if there is not enough memory or a nonce can't be inverted.
+ */
+int DSASignatureSignBatchWithNonces(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, int Hashes_Count, mpz_t Private_Key, mpz_t *Pointer_Nonces, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V);
+
+/** Sign many message hashes with the same private key and random nonces (see DSASignatureSignBatchWithNonces()).
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Hashes The messages hashes.
+ * @param Hashes_Count How many hashes there are.
+ * @param Private_Key The signer private key 's'.
+ * @param Pointer_Output_Numbers_U On output, contain the signatures 'u' numbers (they must be initialized by the user).
+ * @param Pointer_Output_Numbers_V On output, contain the signatures 'v' numbers (they must be initialized by the user).
+ * @return 1 if the signatures were computed or 0 if there is not enough memory.
+ */
+int DSASignatureSignBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, int Hashes_Count, mpz_t Private_Key, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V);
+
+#endif
@@ -1,167 +1,397 @@
 /** @file Diffie_Hellman.c
  * An elliptic curves implementation of the key exchange algorithm.
  */
+#include <signal.h>
 #include <stdio.h>
 #include <gmp.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include "Curves_Registry.h"
 #include "Elliptic_Curves.h"
+#include "Instrumentation.h"
+#include "Log.h"
 #include "Network.h"
-#include "Point.h"
+#include "Protocols.h"
+#include "Session_Cache.h"
 #include "Utils.h"
 
-/** Server part of the Diffie-Hellman key exchanging.
+/** How many sessions Alice remembers. */
+#define SESSIONS_CACHE_CAPACITY 4096
+/** How long a session can be resumed (in seconds). */
+#define SESSIONS_LIFETIME (60 * 60)
+
+/** Receive the X coordinate of a peer public key.
  * @param Pointer_Curve The curve used to make calculations.
- * @param Socket_Bob Client's socket.
- * @param Private_Key On output, hold the private key.
- * @param Pointer_Output_Point On output, hold the shared key.
+ * @param Socket_Peer The peer socket.
+ * @param Pointer_Output_Public_Key On output, contain the X coordinate (ProtocolGetFieldElementSize() bytes).
+ * @return 1 if the X coordinate was received or 0 if it is too large to be a field element.
  */
-static void DiffieHellmanAlice(TEllipticCurve *Pointer_Curve, int Socket_Bob, mpz_t Private_Key, TPoint *Pointer_Output_Point)
+static int DiffieHellmanReceivePublicKey(TEllipticCurve *Pointer_Curve, int Socket_Peer, unsigned char *Pointer_Output_Public_Key)
 {
-	TPoint Point_Temp;
+	mpz_t Number_X;
+	int Return_Value;
+	
+	mpz_init(Number_X);
+	NetworkReceiveMPZ(Socket_Peer, Number_X);
+	LOG_DEBUG("X = %Zd\n\n", Number_X);
+	Return_Value = ProtocolExportNumber(Number_X, ProtocolGetFieldElementSize(Pointer_Curve), Pointer_Output_Public_Key);
+	mpz_clear(Number_X);
+	return Return_Value;
+}
 
-	// Initialize variables
-	PointCreate(0, 0, &Point_Temp);
+/** Send the X coordinate of a public key.
+ * @param Pointer_Curve The curve used to make calculations.
+ * @param Socket_Peer The peer socket.
+ * @param Pointer_Public_Key The public key (X followed by Y).
+ */
+static void DiffieHellmanSendPublicKey(TEllipticCurve *Pointer_Curve, int Socket_Peer, unsigned char *Pointer_Public_Key)
+{
+	mpz_t Number_X;
 	
-	// Choose a random number
-	printf("Choosing a random private key 'a'...\n");
-	UtilsGenerateRandomNumber(Pointer_Curve->p, Private_Key); // Choose a number modulus the order of the curve
-	gmp_printf("a = %Zd\n\n", Private_Key);
+	mpz_init(Number_X);
+	ProtocolImportNumber(Pointer_Public_Key, ProtocolGetFieldElementSize(Pointer_Curve), Number_X);
+	NetworkSendMPZ(Socket_Peer, Number_X);
+	LOG_DEBUG("X = %Zd\n\n", Number_X);
+	mpz_clear(Number_X);
+}
+
+/** Server part of the Diffie-Hellman key exchanging. Only the X coordinates of the points are exchanged and computed.
+ * @param Pointer_Curve The curve used to make calculations.
+ * @param Socket_Bob Client's socket.
+ * @param Output_Shared_Secret On output, hold the X coordinate of the shared point.
+ * @return 1 if the key exchange succeeded or 0 if Bob sent an invalid X coordinate.
+ */
+static int DiffieHellmanAlice(TEllipticCurve *Pointer_Curve, int Socket_Bob, mpz_t Output_Shared_Secret)
+{
+	unsigned char Private_Key[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Bob[PROTOCOL_MAXIMUM_NUMBER_SIZE], Shared_Secret[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	int Return_Value = 0;
+	
+	INSTRUMENTATION_RESET();
+	
+	// Choose a random private key 'a' and compute a.G
+	INSTRUMENTATION_START_PHASE("key pair");
+	LOG_INFO("Choosing a random private key 'a'...\n");
+	if (!ProtocolGenerateKeys(Pointer_Curve, Private_Key, Public_Key)) goto Exit;
 	
 	// Receive Bob's part of the key (so Bob can send it when he wants)
-	printf("Receiving b.G from Bob...\n");
-	NetworkReceivePoint(Socket_Bob, Pointer_Output_Point);
-	PointShow(Pointer_Output_Point);
-	putchar('\n');
-	
-	// Compute a.G
-	printf("Sending a.G to Bob...\n");
-	ECMultiplication(Pointer_Curve, &Pointer_Curve->Point_Generator, Private_Key, &Point_Temp);
-	NetworkSendPoint(Socket_Bob, &Point_Temp);
-	PointShow(&Point_Temp);
-	putchar('\n');
+	INSTRUMENTATION_START_PHASE("receive b.G");
+	LOG_INFO("Receiving X of b.G from Bob...\n");
+	if (!DiffieHellmanReceivePublicKey(Pointer_Curve, Socket_Bob, Public_Key_Bob))
+	{
+		LOG_ERROR("Error : Bob's X coordinate is not valid.\n");
+		goto Exit;
+	}
+	
+	// Send a.G
+	INSTRUMENTATION_START_PHASE("send a.G");
+	LOG_INFO("Sending X of a.G to Bob...\n");
+	DiffieHellmanSendPublicKey(Pointer_Curve, Socket_Bob, Public_Key);
 	
 	// Multiply 'a' to b.G
-	ECMultiplication(Pointer_Curve, Pointer_Output_Point, Private_Key, Pointer_Output_Point);
+	INSTRUMENTATION_START_PHASE("shared secret");
+	if (!ProtocolDiffieHellmanComputeSharedSecret(Pointer_Curve, Private_Key, Public_Key_Bob, Shared_Secret))
+	{
+		LOG_ERROR("Error : Bob's X coordinate is not valid.\n");
+		goto Exit;
+	}
+	ProtocolImportNumber(Shared_Secret, ProtocolGetFieldElementSize(Pointer_Curve), Output_Shared_Secret);
+	Return_Value = 1;
 	
-	// Free resources
-	PointFree(&Point_Temp);
+Exit:
+	INSTRUMENTATION_SHOW("DiffieHellmanAlice");
+	
+	// Do not leave the secrets on the stack
+	memset(Private_Key, 0, sizeof(Private_Key));
+	memset(Shared_Secret, 0, sizeof(Shared_Secret));
+	return Return_Value;
 }
 
-/** Client part of the Diffie-Hellman key exchanging.
+/** Client part of the Diffie-Hellman key exchanging. Only the X coordinates of the points are exchanged and computed.
  * @param Pointer_Curve The curve used to make calculations.
- * @param Socket_Bob Server's socket.
- * @param Private_Key On output, hold the private key.
- * @param Pointer_Output_Point On output, hold the shared key.
+ * @param Socket_Alice Server's socket.
+ * @param Output_Shared_Secret On output, hold the X coordinate of the shared point.
+ * @return 1 if the key exchange succeeded or 0 if Alice sent an invalid X coordinate.
  */
-static void DiffieHellmanBob(TEllipticCurve *Pointer_Curve, int Socket_Alice, mpz_t Private_Key, TPoint *Pointer_Output_Point)
+static int DiffieHellmanBob(TEllipticCurve *Pointer_Curve, int Socket_Alice, mpz_t Output_Shared_Secret)
 {
-	TPoint Point_Temp;
+	unsigned char Private_Key[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Shared_Secret[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	int Return_Value = 0;
 	
-	// Initialize variables
-	PointCreate(0, 0, &Point_Temp);
+	INSTRUMENTATION_RESET();
 	
-	// Choose a random number
-	printf("Choosing a random private key 'b'...\n");
-	UtilsGenerateRandomNumber(Pointer_Curve->p, Private_Key); // Choose a number modulus the order of the curve
-	gmp_printf("b = %Zd\n\n", Private_Key);
+	// Choose a random private key 'b' and compute b.G
+	INSTRUMENTATION_START_PHASE("key pair");
+	LOG_INFO("Choosing a random private key 'b'...\n");
+	if (!ProtocolGenerateKeys(Pointer_Curve, Private_Key, Public_Key)) goto Exit;
 	
-	// Compute b.G
-	printf("Sending b.G to Alice...\n");
-	ECMultiplication(Pointer_Curve, &Pointer_Curve->Point_Generator, Private_Key, &Point_Temp);
-	NetworkSendPoint(Socket_Alice, &Point_Temp);
-	PointShow(&Point_Temp);
-	putchar('\n');
+	// Send b.G
+	INSTRUMENTATION_START_PHASE("send b.G");
+	LOG_INFO("Sending X of b.G to Alice...\n");
+	DiffieHellmanSendPublicKey(Pointer_Curve, Socket_Alice, Public_Key);
 	
 	// Receive Alice's part of the key
-	printf("Receiving a.G from Alice...\n");
-	NetworkReceivePoint(Socket_Alice, Pointer_Output_Point);
-	PointShow(Pointer_Output_Point);
-	putchar('\n');
+	INSTRUMENTATION_START_PHASE("receive a.G");
+	LOG_INFO("Receiving X of a.G from Alice...\n");
+	if (!DiffieHellmanReceivePublicKey(Pointer_Curve, Socket_Alice, Public_Key_Alice))
+	{
+		LOG_ERROR("Error : Alice's X coordinate is not valid.\n");
+		goto Exit;
+	}
 	
-	// Multiply 'a' to b.G
-	ECMultiplication(Pointer_Curve, Pointer_Output_Point, Private_Key, Pointer_Output_Point);
-		
-	// Free resources
-	PointFree(&Point_Temp);
+	// Multiply 'b' to a.G
+	INSTRUMENTATION_START_PHASE("shared secret");
+	if (!ProtocolDiffieHellmanComputeSharedSecret(Pointer_Curve, Private_Key, Public_Key_Alice, Shared_Secret))
+	{
+		LOG_ERROR("Error : Alice's X coordinate is not valid.\n");
+		goto Exit;
+	}
+	ProtocolImportNumber(Shared_Secret, ProtocolGetFieldElementSize(Pointer_Curve), Output_Shared_Secret);
+	Return_Value = 1;
+	
+Exit:
+	INSTRUMENTATION_SHOW("DiffieHellmanBob");
+	
+	// Do not leave the secrets on the stack
+	memset(Private_Key, 0, sizeof(Private_Key));
+	memset(Shared_Secret, 0, sizeof(Shared_Secret));
+	return Return_Value;
+}
+
+/** Server part of the session resumption. If Bob presents a valid ticket the scalar multiplications are skipped.
+ * @param Pointer_Cache Alice's sessions.
+ * @param Socket_Bob Client's socket.
+ * @param Pointer_Output_Key On output, hold the resumed session key if the session was resumed.
+ * @return 1 if the session was resumed, 0 if a full key exchange must be done or -1 if Bob disconnected.
+ */
+static int DiffieHellmanAliceResume(TSessionCache *Pointer_Cache, int Socket_Bob, unsigned char *Pointer_Output_Key)
+{
+	char Is_Resuming, Is_Accepted;
+	unsigned char Ticket[SESSION_CACHE_TICKET_LENGTH], Nonce[SESSION_CACHE_NONCE_LENGTH], Master_Key[SESSION_CACHE_KEY_LENGTH];
+	
+	// Does Bob want to resume a session ?
+	if (!NetworkReceiveBuffer(Socket_Bob, &Is_Resuming, sizeof(Is_Resuming))) return -1;
+	if (!Is_Resuming) return 0;
+	
+	// Retrieve the session
+	LOG_INFO("Bob is presenting a session ticket... ");
+	if (!NetworkReceiveBuffer(Socket_Bob, Ticket, sizeof(Ticket)) || !NetworkReceiveBuffer(Socket_Bob, Nonce, sizeof(Nonce)))
+	{
+		LOG_INFO("Bob disconnected.\n\n");
+		return -1;
+	}
+	Is_Accepted = SessionCacheLookup(Pointer_Cache, Ticket, Master_Key);
+	NetworkSendBuffer(Socket_Bob, &Is_Accepted, sizeof(Is_Accepted));
+	if (!Is_Accepted)
+	{
+		LOG_INFO("unknown or expired, doing a full key exchange.\n\n");
+		return 0;
+	}
+	LOG_INFO("session resumed.\n\n");
+	
+	SessionCacheDeriveResumedKey(Master_Key, Nonce, Pointer_Output_Key);
+	memset(Master_Key, 0, sizeof(Master_Key));
+	return 1;
+}
+
+/** Client part of the session resumption.
+ * @param Socket_Alice Server's socket.
+ * @param String_Ticket_File_Name The file holding the ticket and the master key of a previous session (can be NULL).
+ * @param Pointer_Output_Key On output, hold the resumed session key if the session was resumed.
+ * @return 1 if the session was resumed or 0 if a full key exchange must be done.
+ */
+static int DiffieHellmanBobResume(int Socket_Alice, char *String_Ticket_File_Name, unsigned char *Pointer_Output_Key)
+{
+	char Is_Resuming = 0, Is_Accepted;
+	unsigned char Ticket[SESSION_CACHE_TICKET_LENGTH], Nonce[SESSION_CACHE_NONCE_LENGTH], Master_Key[SESSION_CACHE_KEY_LENGTH];
+	FILE *File;
+	
+	// Load the previous session if there is one
+	if (String_Ticket_File_Name != NULL)
+	{
+		File = fopen(String_Ticket_File_Name, "rb");
+		if (File != NULL)
+		{
+			if ((fread(Ticket, sizeof(Ticket), 1, File) == 1) && (fread(Master_Key, sizeof(Master_Key), 1, File) == 1)) Is_Resuming = 1;
+			fclose(File);
+		}
+	}
+	
+	// The nonce must not be guessable, a full key exchange is done if it can't be generated
+	if (Is_Resuming && !UtilsGenerateSecureRandomBuffer(Nonce, sizeof(Nonce)))
+	{
+		LOG_ERROR("Error : could not generate the resumption nonce.\n");
+		Is_Resuming = 0;
+		memset(Master_Key, 0, sizeof(Master_Key));
+	}
+	
+	NetworkSendBuffer(Socket_Alice, &Is_Resuming, sizeof(Is_Resuming));
+	if (!Is_Resuming) return 0;
+	
+	// Present the ticket with a fresh nonce so the resumed key is never reused
+	LOG_INFO("Presenting session ticket to Alice... ");
+	NetworkSendBuffer(Socket_Alice, Ticket, sizeof(Ticket));
+	NetworkSendBuffer(Socket_Alice, Nonce, sizeof(Nonce));
+	if (!NetworkReceiveBuffer(Socket_Alice, &Is_Accepted, sizeof(Is_Accepted)) || !Is_Accepted)
+	{
+		LOG_INFO("rejected, doing a full key exchange.\n\n");
+		memset(Master_Key, 0, sizeof(Master_Key));
+		return 0;
+	}
+	LOG_INFO("session resumed.\n\n");
+	
+	SessionCacheDeriveResumedKey(Master_Key, Nonce, Pointer_Output_Key);
+	memset(Master_Key, 0, sizeof(Master_Key));
+	return 1;
+}
+
+/** Show the statistics of Alice's sessions cache.
+ * @param Pointer_Cache The cache.
+ */
+static void ShowSessionsStatistics(TSessionCache *Pointer_Cache)
+{
+	TSessionCacheStatistics Statistics;
+	
+	SessionCacheGetStatistics(Pointer_Cache, &Statistics);
+	LOG_INFO("Sessions cache : %d session(s), %llu hit(s), %llu miss(es), hit rate %.1f %%, %llu expired, %llu evicted.\n", Pointer_Cache->Entries_Count, Statistics.Hits_Count, Statistics.Misses_Count, Statistics.Hit_Rate * 100, Statistics.Expirations_Count, Statistics.Evictions_Count);
+	LOG_INFO("Full key exchange average time : %lld us, total saved time : %lld us.\n\n", Statistics.Full_Exchange_Average_Time, Statistics.Saved_Time);
 }
 
 int main(int argc, char *argv[])
 {
-	char Is_Alice, *String_Parameter_Character, *String_Parameter_File_Name, *String_Parameter_IP_Address;
+	char Is_Alice, *String_Parameter_Character, *String_Parameter_File_Name, *String_Parameter_IP_Address, *String_Parameter_Ticket_File_Name = NULL;
 	unsigned short Port;
 	TEllipticCurve Curve;
-	int Socket_Alice, Socket_Bob;
-	mpz_t Private_Key;
-	TPoint Point_Shared_Key;
+	int Socket_Alice, Socket_Bob, Is_Resumed;
+	mpz_t Shared_Secret;
+	TSessionCache Sessions_Cache;
+	unsigned char Session_Key[SESSION_CACHE_KEY_LENGTH], Ticket[SESSION_CACHE_TICKET_LENGTH];
+	char String_Hash[UTILS_HASH_STRING_SIZE];
+	long long Start_Time;
+	FILE *File;
 	
 	// Check parameters
-	if (argc != 5)
+	if ((argc < 5) || (argc > 6))
 	{
 		printf("Error : bad parameters.\n" \
 			"Usages :\n" \
-			"%s -alice ServerIPAddressToBind ServerPort EllipticCurveFile.gp\n" \
-			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurveFile.gp\n" \
-			"Remember that Alice must be launched first (she will provide the server Bob can connect to).\n", argv[0], argv[0]);
+			"%s -alice ServerIPAddressToBind ServerPort EllipticCurve\n" \
+			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurve [SessionTicketFile]\n" \
+			"EllipticCurve is a built-in curve name or a curve file path.\n" \
+			"Remember that Alice must be launched first (she will provide the server Bob can connect to).\n" \
+			"Alice serves Bobs until she is stopped. If Bob is given a session ticket file, he tries to resume the session it holds and stores the new ticket there.\n", argv[0], argv[0]);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
 		return -1;
 	}
 	String_Parameter_Character = argv[1];
 	String_Parameter_IP_Address = argv[2];
 	Port = atoi(argv[3]);
 	String_Parameter_File_Name = argv[4];
+	if (argc == 6) String_Parameter_Ticket_File_Name = argv[5];
+	
+	// Write the protocol steps from a background thread, the LOG_LEVEL environment variable ("none", "error", "warning", "info" or "debug") selects how much is written, only the errors are written by default
+	LogStart(LogParseLevel(getenv("LOG_LEVEL"), LOG_LEVEL_ERROR), NULL, NULL, 1);
 	
 	// Set server or client mode according to choosen character
 	if (strcmp(String_Parameter_Character, "-alice") == 0) Is_Alice = 1;
 	else if (strcmp(String_Parameter_Character, "-bob") == 0) Is_Alice = 0;
 	else
 	{
-		printf("Error : unknown character. You must select Alice or Bob.\n");
+		LOG_ERROR("Error : unknown character. You must select Alice or Bob.\n");
 		return -2;
 	}
 	
-	// Load elliptic curve file
-	if (!ECLoadFromFile(String_Parameter_File_Name, &Curve))
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(String_Parameter_File_Name, &Curve))
 	{
-		printf("Error : can't load curve file.\n");
+		LOG_ERROR("Error : can't load curve file.\n");
 		return -3;
 	}
 	
 	UtilsInitializeRandomGenerator();
 	
 	// Initialize variables
-	PointCreate(0, 0, &Point_Shared_Key);
-	mpz_init(Private_Key);
+	mpz_init(Shared_Secret);
 	
 	// Alice
 	if (Is_Alice)
 	{
-		// Start server
-		Socket_Alice = NetworkServerCreate(String_Parameter_IP_Address, Port);
-		if (Socket_Alice < 0)
+		if (!SessionCacheCreate(&Sessions_Cache, SESSIONS_CACHE_CAPACITY, SESSIONS_LIFETIME))
 		{
-			printf("Error : could not create the server.\n");
+			LOG_ERROR("Error : could not create the sessions cache.\n");
 			ECFree(&Curve);
 			return -4;
 		}
 		
-		// Wait for Bob
-		printf("Waiting for Bob... ");
-		fflush(stdout);
-		Socket_Bob = NetworkServerListen(Socket_Alice);
-		if (Socket_Bob < 0)
+		// Start server
+		Socket_Alice = NetworkServerCreate(String_Parameter_IP_Address, Port);
+		if (Socket_Alice < 0)
 		{
-			printf("Error : server could not accept Bob.\n");
-			close(Socket_Alice);
+			LOG_ERROR("Error : could not create the server.\n");
+			SessionCacheFree(&Sessions_Cache);
 			ECFree(&Curve);
-			return -5;
+			return -4;
 		}
-		printf("Bob is connected.\n\n");
 		
-		// Exchange keys
-		DiffieHellmanAlice(&Curve, Socket_Bob, Private_Key, &Point_Shared_Key);
+		// A Bob leaving in the middle of the exchange must not kill the server
+		signal(SIGPIPE, SIG_IGN);
 		
-		close(Socket_Bob);
+		// Serve Bobs one after the other so their sessions can be resumed
+		while (1)
+		{
+			// Wait for Bob
+			LOG_INFO("Waiting for Bob... ");
+			Socket_Bob = NetworkServerListen(Socket_Alice);
+			if (Socket_Bob < 0)
+			{
+				LOG_ERROR("Error : server could not accept Bob.\n");
+				close(Socket_Alice);
+				SessionCacheFree(&Sessions_Cache);
+				ECFree(&Curve);
+				return -5;
+			}
+			LOG_INFO("Bob is connected.\n\n");
+			Start_Time = UtilsGetTime();
+			
+			// Try to resume a previous session
+			Is_Resumed = DiffieHellmanAliceResume(&Sessions_Cache, Socket_Bob, Session_Key);
+			if (Is_Resumed < 0)
+			{
+				close(Socket_Bob);
+				continue;
+			}
+			if (Is_Resumed) SessionCacheAccountResumption(&Sessions_Cache, UtilsGetTime() - Start_Time);
+			else
+			{
+				// Exchange keys
+				if (!DiffieHellmanAlice(&Curve, Socket_Bob, Shared_Secret))
+				{
+					close(Socket_Bob);
+					continue;
+				}
+				
+				// Show the shared secret
+				LOG_DEBUG("Shared secret is :\n%Zd\n\n", Shared_Secret);
+				
+				// Give Bob a ticket to resume the session later
+				SessionCacheDeriveMasterKey(Shared_Secret, Session_Key);
+				if (!SessionCacheStore(&Sessions_Cache, Session_Key, Ticket))
+				{
+					LOG_ERROR("Error : could not generate the session ticket.\n");
+					close(Socket_Bob);
+					continue;
+				}
+				NetworkSendBuffer(Socket_Bob, Ticket, sizeof(Ticket));
+				SessionCacheAccountFullExchange(&Sessions_Cache, UtilsGetTime() - Start_Time);
+			}
+			close(Socket_Bob);
+			
+			UtilsConvertHashToString(Session_Key, String_Hash);
+			LOG_DEBUG("Session key is : %s\n\n", String_Hash);
+			ShowSessionsStatistics(&Sessions_Cache);
+		}
 	}
 	// Bob
 	else
@@ -170,23 +400,50 @@ int main(int argc, char *argv[])
 		Socket_Alice = NetworkClientConnect(String_Parameter_IP_Address, Port);
 		if (Socket_Alice < 0)
 		{
-			printf("Error : could not connect to server.\n");
+			LOG_ERROR("Error : could not connect to server.\n");
 			ECFree(&Curve);
 			return 0;
 		}
-		printf("Connected to Alice.\n\n");
+		LOG_INFO("Connected to Alice.\n\n");
 		
-		// Exchange keys
-		DiffieHellmanBob(&Curve, Socket_Alice, Private_Key, &Point_Shared_Key);
+		// Try to resume a previous session
+		Is_Resumed = DiffieHellmanBobResume(Socket_Alice, String_Parameter_Ticket_File_Name, Session_Key);
+		if (!Is_Resumed)
+		{
+			// Exchange keys
+			if (!DiffieHellmanBob(&Curve, Socket_Alice, Shared_Secret))
+			{
+				close(Socket_Alice);
+				mpz_clear(Shared_Secret);
+				ECFree(&Curve);
+				return -6;
+			}
+			
+			// Show the shared secret
+			LOG_DEBUG("Shared secret is :\n%Zd\n\n", Shared_Secret);
+			
+			// Keep the session ticket for the next connection
+			SessionCacheDeriveMasterKey(Shared_Secret, Session_Key);
+			if (NetworkReceiveBuffer(Socket_Alice, Ticket, sizeof(Ticket)) && (String_Parameter_Ticket_File_Name != NULL))
+			{
+				File = fopen(String_Parameter_Ticket_File_Name, "wb");
+				if (File == NULL) LOG_ERROR("Error : could not save the session ticket.\n");
+				else
+				{
+					fwrite(Ticket, sizeof(Ticket), 1, File);
+					fwrite(Session_Key, sizeof(Session_Key), 1, File);
+					fclose(File);
+				}
+			}
+		}
+		
+		UtilsConvertHashToString(Session_Key, String_Hash);
+		LOG_DEBUG("Session key is : %s\n", String_Hash);
 	}
 	
-	// Show the shared secret
-	printf("Shared secret is :\n");
-	PointShow(&Point_Shared_Key);
-	
 	// Free resources
 	close(Socket_Alice);
-	PointFree(&Point_Shared_Key);
+	mpz_clear(Shared_Secret);
 	ECFree(&Curve);
 	return 0;
 }
\ No newline at end of file
@@ -6,154 +6,323 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include "Curves_Registry.h"
+#include "ElGamal_Exponential.h"
 #include "Elliptic_Curves.h"
+#include "Instrumentation.h"
+#include "Log.h"
 #include "Point.h"
 #include "Network.h"
+#include "Protocols.h"
 #include "Utils.h"
 
-/** Send public key to Bob and decipher his message (server side of the protocol).
+/** Receive a field element.
+ * @param Pointer_Curve The curve used for computations.
+ * @param Socket_Peer The peer socket.
+ * @param Pointer_Output_Buffer On output, contain the number (ProtocolGetFieldElementSize() bytes).
+ * @return 1 if the number was received or 0 if it is too large to be a field element.
+ */
+static int ElGamalReceiveNumber(TEllipticCurve *Pointer_Curve, int Socket_Peer, unsigned char *Pointer_Output_Buffer)
+{
+	mpz_t Number;
+	int Return_Value;
+	
+	mpz_init(Number);
+	NetworkReceiveMPZ(Socket_Peer, Number);
+	LOG_DEBUG("%Zd\n\n", Number);
+	Return_Value = ProtocolExportNumber(Number, ProtocolGetFieldElementSize(Pointer_Curve), Pointer_Output_Buffer);
+	mpz_clear(Number);
+	return Return_Value;
+}
+
+/** Send a field element.
+ * @param Pointer_Curve The curve used for computations.
+ * @param Socket_Peer The peer socket.
+ * @param Pointer_Buffer The number (ProtocolGetFieldElementSize() bytes).
+ */
+static void ElGamalSendNumber(TEllipticCurve *Pointer_Curve, int Socket_Peer, unsigned char *Pointer_Buffer)
+{
+	mpz_t Number;
+	
+	mpz_init(Number);
+	ProtocolImportNumber(Pointer_Buffer, ProtocolGetFieldElementSize(Pointer_Curve), Number);
+	NetworkSendMPZ(Socket_Peer, Number);
+	LOG_DEBUG("%Zd\n", Number);
+	mpz_clear(Number);
+}
+
+/** Send public key to Bob and decipher his message (server side of the protocol). Only the X coordinates of the points are exchanged.
  * @param Pointer_Curve The curve used for computations.
  * @param Socket_Bob The way used to communicate with Bob.
- * @param Pointer_Point_Public_Key_Alice Alice's public key.
- * @param Private_Key_Alice Alice's private key.
+ * @param Pointer_Private_Key_Alice Alice's private key.
+ * @param Pointer_Public_Key_Alice Alice's public key.
  * @param Output_Message On output, contain the message sent by Bob.
+ * @return 1 if the message was deciphered or 0 if Bob sent an invalid C1.
  */
-static void ElGamalAlice(TEllipticCurve *Pointer_Curve, int Socket_Bob, TPoint *Pointer_Point_Public_Key_Alice, mpz_t Private_Key_Alice, mpz_t Output_Message)
+static int ElGamalAlice(TEllipticCurve *Pointer_Curve, int Socket_Bob, unsigned char *Pointer_Private_Key_Alice, unsigned char *Pointer_Public_Key_Alice, mpz_t Output_Message)
 {
-	TPoint Point_C1, Point_C2;
+	unsigned char C1[PROTOCOL_MAXIMUM_NUMBER_SIZE], C2[PROTOCOL_MAXIMUM_NUMBER_SIZE], Message[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	int Return_Value = 0;
 	
-	// Initialize variables
-	PointCreate(0, 0, &Point_C1);
-	PointCreate(0, 0, &Point_C2);
+	INSTRUMENTATION_RESET();
 				
 	// Send Alice's public key to Bob
-	printf("Alice is sending her public key to Bob... ");
-	fflush(stdout);
-	NetworkSendPoint(Socket_Bob, Pointer_Point_Public_Key_Alice);
-	printf("done.\n\n");
+	INSTRUMENTATION_START_PHASE("send public key");
+	LOG_INFO("Alice is sending her public key to Bob... ");
+	ElGamalSendNumber(Pointer_Curve, Socket_Bob, Pointer_Public_Key_Alice);
+	LOG_INFO("done.\n\n");
 	
 	// Receive points from Bob
-	// Get C1
-	printf("Waiting for Bob's C1 point...\n");
-	NetworkReceivePoint(Socket_Bob, &Point_C1);
-	PointShow(&Point_C1);
-	putchar('\n');
-	
-	// Get C2
-	printf("Waiting for Bob's C2 point...\n");
-	NetworkReceivePoint(Socket_Bob, &Point_C2);
-	PointShow(&Point_C2);
-	putchar('\n');
+	INSTRUMENTATION_START_PHASE("receive C1 and C2");
+	LOG_INFO("Waiting for X of Bob's C1 point and for Bob's C2 number...\n");
+	if (!ElGamalReceiveNumber(Pointer_Curve, Socket_Bob, C1) || !ElGamalReceiveNumber(Pointer_Curve, Socket_Bob, C2))
+	{
+		LOG_ERROR("Error : Bob's ciphertext is not valid.\n");
+		goto Exit;
+	}
 	
 	// Retrieve Bob's message
-	printf("Alice is deciphering the message...\n");
-	// Compute a.C1 ('a' is Alice's private key)
-	ECMultiplication(Pointer_Curve, &Point_C1, Private_Key_Alice, &Point_C1); // Store result in C1 as C1 value will no more be used
-	// Substract C2 to the X coordinate of previous operation
-	mpz_sub(Output_Message, Point_C2.X, Point_C1.X);
-	mpz_mod(Output_Message, Output_Message, Pointer_Curve->p);
-		
-	// Free memory
-	PointFree(&Point_C1);
-	PointFree(&Point_C2);
+	INSTRUMENTATION_START_PHASE("decipher");
+	LOG_INFO("Alice is deciphering the message...\n");
+	if (!ProtocolElGamalDecrypt(Pointer_Curve, Pointer_Private_Key_Alice, C1, C2, Message))
+	{
+		LOG_ERROR("Error : Bob's C1 point is not valid.\n");
+		goto Exit;
+	}
+	ProtocolImportNumber(Message, ProtocolGetFieldElementSize(Pointer_Curve), Output_Message);
+	Return_Value = 1;
+	
+Exit:
+	INSTRUMENTATION_SHOW("ElGamalAlice");
+	return Return_Value;
 }
 
-/** Send a message to Alice (client side of the protocol).
+/** Send a message to Alice (client side of the protocol). Only the X coordinates of the points are exchanged.
  * @param Pointer_Curve The curve used for computations.
  * @param Socket_Alice The way used to communicate with Alice.
- * @param Message The message to send.
+ * @param Message The message to send, it must be lower than p.
+ * @return 1 if the message was sent or 0 if Alice's public key or the message are not valid.
  */
-static void ElGamalBob(TEllipticCurve *Pointer_Curve, int Socket_Alice, mpz_t Message)
+static int ElGamalBob(TEllipticCurve *Pointer_Curve, int Socket_Alice, mpz_t Message)
 {
-	TPoint Point_Public_Key_Alice, Point_Temp;
-	mpz_t Number_K, Number_Temp;
+	unsigned char Public_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Buffer_Message[PROTOCOL_MAXIMUM_NUMBER_SIZE], C1[PROTOCOL_MAXIMUM_NUMBER_SIZE], C2[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	int Return_Value = 0;
+	
+	INSTRUMENTATION_RESET();
+
+	// Receive Alice's public key
+	INSTRUMENTATION_START_PHASE("receive public key");
+	LOG_INFO("Waiting for X of Alice's public key...\n");
+	if (!ElGamalReceiveNumber(Pointer_Curve, Socket_Alice, Public_Key_Alice))
+	{
+		LOG_ERROR("Error : Alice's public key is not valid.\n");
+		goto Exit;
+	}
+	
+	// Compute C1 = k.G and C2 = M + x(k.Q)
+	INSTRUMENTATION_START_PHASE("encrypt");
+	LOG_INFO("Bob is computing C1 and C2...\n");
+	if (!ProtocolExportNumber(Message, ProtocolGetFieldElementSize(Pointer_Curve), Buffer_Message) || !ProtocolElGamalEncrypt(Pointer_Curve, Public_Key_Alice, Buffer_Message, C1, C2))
+	{
+		LOG_ERROR("Error : Alice's public key or the message is not valid.\n");
+		goto Exit;
+	}
+	
+	// Send C1 and C2 to Alice
+	INSTRUMENTATION_START_PHASE("send C1 and C2");
+	ElGamalSendNumber(Pointer_Curve, Socket_Alice, C1);
+	LOG_INFO("C1 sent to Alice.\n\n");
+	ElGamalSendNumber(Pointer_Curve, Socket_Alice, C2);
+	LOG_INFO("C2 sent to Alice.\n\n");
+	Return_Value = 1;
+	
+Exit:
+	INSTRUMENTATION_SHOW("ElGamalBob");
+	return Return_Value;
+}
+
+/** Receive two exponentially encrypted messages from Bob and decipher their sum (server side of the exponential mode). The whole points are exchanged.
+ * @param Pointer_Curve The curve used for computations.
+ * @param Socket_Bob The way used to communicate with Bob.
+ * @param Pointer_Private_Key_Alice Alice's private key.
+ * @param Pointer_Public_Key_Alice Alice's public key.
+ * @param String_Table_File_Name The baby steps table file, it is created if it does not exist.
+ * @param Output_Message On output, contain the sum of the messages sent by Bob.
+ * @return 1 if the sum was deciphered or 0 if the table could not be loaded or Bob sent an invalid ciphertext.
+ */
+static int ElGamalExponentialAlice(TEllipticCurve *Pointer_Curve, int Socket_Bob, unsigned char *Pointer_Private_Key_Alice, unsigned char *Pointer_Public_Key_Alice, char *String_Table_File_Name, mpz_t Output_Message)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	TElGamalExponentialTable Table;
+	TPoint Point_Public_Key_Alice;
+	mpz_t Private_Key_Alice;
+	TElGamalExponentialCiphertext Ciphertexts[2];
+	uint64_t Message;
+	int Return_Value = 0;
 	
 	// Initialize variables
 	PointCreate(0, 0, &Point_Public_Key_Alice);
-	PointCreate(0, 0, &Point_Temp);
-	mpz_init(Number_K);
-	mpz_init(Number_Temp);
+	mpz_init(Private_Key_Alice);
+	ProtocolImportNumber(Pointer_Public_Key_Alice, Field_Element_Size, Point_Public_Key_Alice.X);
+	ProtocolImportNumber(Pointer_Public_Key_Alice + Field_Element_Size, Field_Element_Size, Point_Public_Key_Alice.Y);
+	ProtocolImportNumber(Pointer_Private_Key_Alice, ProtocolGetScalarSize(Pointer_Curve), Private_Key_Alice);
+	ElGamalExponentialCreateCiphertext(&Ciphertexts[0]);
+	ElGamalExponentialCreateCiphertext(&Ciphertexts[1]);
+	INSTRUMENTATION_RESET();
+	
+	// The table is computed once, then all processes map the same file
+	INSTRUMENTATION_START_PHASE("load table");
+	if (!ElGamalExponentialLoadTable(Pointer_Curve, String_Table_File_Name, &Table))
+	{
+		LOG_INFO("Alice is computing the baby steps table (this is done only once)... ");
+		if (!ElGamalExponentialCreateTableFile(Pointer_Curve, String_Table_File_Name, ELGAMAL_EXPONENTIAL_DEFAULT_BABY_STEPS_BITS, ELGAMAL_EXPONENTIAL_DEFAULT_MESSAGE_BITS) || !ElGamalExponentialLoadTable(Pointer_Curve, String_Table_File_Name, &Table))
+		{
+			LOG_ERROR("Error : can't create the table file.\n");
+			goto Exit;
+		}
+		LOG_INFO("done.\n\n");
+	}
+	
+	// Send Alice's public key to Bob
+	INSTRUMENTATION_START_PHASE("send public key");
+	LOG_INFO("Alice is sending her public key to Bob... ");
+	NetworkSendPoint(Socket_Bob, &Point_Public_Key_Alice);
+	LOG_INFO("done.\n\n");
+	
+	// Receive the ciphertexts from Bob
+	INSTRUMENTATION_START_PHASE("receive ciphertexts");
+	LOG_INFO("Waiting for Bob's ciphertexts...\n");
+	NetworkReceivePoint(Socket_Bob, &Ciphertexts[0].Point_C1);
+	NetworkReceivePoint(Socket_Bob, &Ciphertexts[0].Point_C2);
+	NetworkReceivePoint(Socket_Bob, &Ciphertexts[1].Point_C1);
+	NetworkReceivePoint(Socket_Bob, &Ciphertexts[1].Point_C2);
+	
+	// Add them without deciphering them, then decipher the sum
+	INSTRUMENTATION_START_PHASE("decipher");
+	LOG_INFO("Alice is deciphering the sum of the messages...\n");
+	ElGamalExponentialAdd(Pointer_Curve, &Ciphertexts[0], &Ciphertexts[1], &Ciphertexts[0]);
+	if (!ElGamalExponentialDecrypt(Pointer_Curve, &Table, Private_Key_Alice, &Ciphertexts[0], &Message))
+	{
+		LOG_ERROR("Error : Bob's ciphertexts are not valid.\n");
+		ElGamalExponentialFreeTable(&Table);
+		goto Exit;
+	}
+	mpz_import(Output_Message, 1, 1, sizeof(Message), 0, 0, &Message);
+	ElGamalExponentialFreeTable(&Table);
+	Return_Value = 1;
+	
+Exit:
+	INSTRUMENTATION_SHOW("ElGamalExponentialAlice");
+	
+	// Free memory
+	PointFree(&Point_Public_Key_Alice);
+	mpz_set_ui(Private_Key_Alice, 0);
+	mpz_clear(Private_Key_Alice);
+	ElGamalExponentialFreeCiphertext(&Ciphertexts[0]);
+	ElGamalExponentialFreeCiphertext(&Ciphertexts[1]);
+	return Return_Value;
+}
 
+/** Send two exponentially encrypted messages to Alice (client side of the exponential mode).
+ * @param Pointer_Curve The curve used for computations.
+ * @param Socket_Alice The way used to communicate with Alice.
+ * @param Pointer_Messages The two messages to send.
+ * @return 1 if the messages were sent or 0 if Alice's public key is not valid.
+ */
+static int ElGamalExponentialBob(TEllipticCurve *Pointer_Curve, int Socket_Alice, uint64_t *Pointer_Messages)
+{
+	TPoint Point_Public_Key_Alice;
+	TElGamalExponentialCiphertext Ciphertext;
+	int i, Return_Value = 0;
+	
+	// Initialize variables
+	PointCreate(0, 0, &Point_Public_Key_Alice);
+	ElGamalExponentialCreateCiphertext(&Ciphertext);
+	INSTRUMENTATION_RESET();
+	
 	// Receive Alice's public key
-	printf("Waiting for Alice's public key...\n");
+	INSTRUMENTATION_START_PHASE("receive public key");
+	LOG_INFO("Waiting for Alice's public key...\n");
 	NetworkReceivePoint(Socket_Alice, &Point_Public_Key_Alice);
-	PointShow(&Point_Public_Key_Alice);
-	putchar('\n');
-	
-	// Compute C1
-	printf("Bob is computing C1...\n");
-	// Choose random number 'k'
-	UtilsGenerateRandomNumber(Pointer_Curve->p, Number_K);
-	// Do C1 computation
-	ECMultiplication(Pointer_Curve, &Pointer_Curve->Point_Generator, Number_K, &Point_Temp);
-	PointShow(&Point_Temp);
-	// Send C1 to Alice
-	NetworkSendPoint(Socket_Alice, &Point_Temp);
-	printf("C1 sent to Alice.\n\n");
-	
-	// Compute C2
-	printf("Bob is computing C2...\n");
-	// Compute k.Q
-	ECMultiplication(Pointer_Curve, &Point_Public_Key_Alice, Number_K, &Point_Temp);
-	// Add message and the X coordinate of the previous result
-	mpz_add(Number_Temp, Message, Point_Temp.X);
-	mpz_mod(Point_Temp.X, Number_Temp, Pointer_Curve->p); // The number must stay into the group
-	PointShow(&Point_Temp);
-	// Send a "false" C2 to Alice where the only important coordinate is X
-	NetworkSendPoint(Socket_Alice, &Point_Temp);
-	printf("C2 sent to Alice.\n\n");
+	
+	// Encrypt and send both messages
+	INSTRUMENTATION_START_PHASE("encrypt");
+	for (i = 0; i < 2; i++)
+	{
+		if (!ElGamalExponentialEncrypt(Pointer_Curve, &Point_Public_Key_Alice, Pointer_Messages[i], &Ciphertext))
+		{
+			LOG_ERROR("Error : Alice's public key is not valid.\n");
+			goto Exit;
+		}
+		NetworkSendPoint(Socket_Alice, &Ciphertext.Point_C1);
+		NetworkSendPoint(Socket_Alice, &Ciphertext.Point_C2);
+	}
+	LOG_INFO("Ciphertexts sent to Alice.\n\n");
+	Return_Value = 1;
+	
+Exit:
+	INSTRUMENTATION_SHOW("ElGamalExponentialBob");
 	
 	// Free memory
 	PointFree(&Point_Public_Key_Alice);
-	PointFree(&Point_Temp);
-	mpz_clear(Number_K);
-	mpz_clear(Number_Temp);
+	ElGamalExponentialFreeCiphertext(&Ciphertext);
+	return Return_Value;
 }
 
 int main(int argc, char *argv[])
 {
-	char Is_Alice, *String_Parameter_Character, *String_Parameter_File_Name, *String_Parameter_IP_Address;
+	char Is_Alice, *String_Parameter_Character, *String_Parameter_File_Name, *String_Parameter_IP_Address, *String_Parameter_Table_File_Name = NULL;
 	unsigned short Port;
 	TEllipticCurve Curve;
 	int Socket_Alice, Socket_Bob;
-	mpz_t Private_Key_Alice, Message, Number_Temp;
-	TPoint Point_Public_Key_Alice;
+	mpz_t Message, Number_Temp;
+	unsigned char Private_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Alice[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	uint64_t Messages[2];
 		
 	// Check parameters
-	if (argc != 5)
+	if ((argc != 5) && (argc != 6))
 	{
 		printf("Error : bad parameters.\n" \
 			"Usages :\n" \
-			"%s -alice ServerIPAddressToBind ServerPort EllipticCurveFile.gp\n" \
-			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurveFile.gp\n" \
+			"%s -alice ServerIPAddressToBind ServerPort EllipticCurve [TableFile]\n" \
+			"%s -bob IPAddressToConnectTo PortToConnectTo EllipticCurve [TableFile]\n" \
+			"EllipticCurve is a built-in curve name or a curve file path.\n" \
+			"Giving a TableFile selects the exponential mode : Bob sends two encrypted numbers and Alice deciphers their sum from the sum of the ciphertexts.\n" \
+			"Alice creates the baby steps table file if it does not exist, it can then be shared by all processes using the same curve.\n" \
 			"Remember that Alice must be launched first (she will provide the server Bob can connect to).\n", argv[0], argv[0]);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
 		return -1;
 	}
 	String_Parameter_Character = argv[1];
 	String_Parameter_IP_Address = argv[2];
 	Port = atoi(argv[3]);
 	String_Parameter_File_Name = argv[4];
+	if (argc == 6) String_Parameter_Table_File_Name = argv[5];
+	
+	// Write the protocol steps from a background thread, the LOG_LEVEL environment variable ("none", "error", "warning", "info" or "debug") selects how much is written, only the errors are written by default
+	LogStart(LogParseLevel(getenv("LOG_LEVEL"), LOG_LEVEL_ERROR), NULL, NULL, 1);
 	
 	// Set server or client mode according to choosen character
 	if (strcmp(String_Parameter_Character, "-alice") == 0) Is_Alice = 1;
 	else if (strcmp(String_Parameter_Character, "-bob") == 0) Is_Alice = 0;
 	else
 	{
-		printf("Error : unknown character. You must select Alice or Bob.\n");
+		LOG_ERROR("Error : unknown character. You must select Alice or Bob.\n");
 		return -2;
 	}
 	
-	// Load elliptic curve file
-	if (!ECLoadFromFile(String_Parameter_File_Name, &Curve))
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(String_Parameter_File_Name, &Curve))
 	{
-		printf("Error : can't load curve file.\n");
+		LOG_ERROR("Error : can't load curve file.\n");
 		return -3;
 	}
 	
 	UtilsInitializeRandomGenerator();
 	
 	// Initialize variables
-	PointCreate(0, 0, &Point_Public_Key_Alice);
 	mpz_init(Message);
 	
 	// Alice
@@ -163,45 +332,38 @@ int main(int argc, char *argv[])
 		Socket_Alice = NetworkServerCreate(String_Parameter_IP_Address, Port);
 		if (Socket_Alice < 0)
 		{
-			printf("Error : could not create the server.\n");
+			LOG_ERROR("Error : could not create the server.\n");
+			mpz_clear(Message);
 			ECFree(&Curve);
-			mpz_clear(Private_Key_Alice);
 			return -4;
 		}
 		
 		// Wait for Bob
-		printf("Waiting for Bob... ");
-		fflush(stdout);
+		LOG_INFO("Waiting for Bob... ");
 		Socket_Bob = NetworkServerListen(Socket_Alice);
 		if (Socket_Bob < 0)
 		{
-			printf("Error : server could not accept Bob.\n");
+			LOG_ERROR("Error : server could not accept Bob.\n");
 			close(Socket_Alice);
+			mpz_clear(Message);
 			ECFree(&Curve);
-			mpz_clear(Private_Key_Alice);
 			return -5;
 		}
-		printf("Bob is connected.\n\n");
-		
-		// Initialize variables
-		mpz_init(Private_Key_Alice);
+		LOG_INFO("Bob is connected.\n\n");
 		
 		// Generate Alice's key pair once
-		UtilsGenerateRandomNumber(Curve.p, Private_Key_Alice);
-		gmp_printf("Alice's private key is :\n%Zd\n\n", Private_Key_Alice);
-		
-		// Compute Alice's public key 'Q'
-		printf("Alice is computing her public key...\n");
-		ECMultiplication(&Curve, &Curve.Point_Generator, Private_Key_Alice, &Point_Public_Key_Alice);
-		PointShow(&Point_Public_Key_Alice);
-		putchar('\n');
-		
+		LOG_INFO("Alice is computing her key pair...\n\n");
+		if (!ProtocolGenerateKeys(&Curve, Private_Key_Alice, Public_Key_Alice)) LOG_ERROR("Error : could not generate Alice's key pair.\n");
 		// Get Bob's message
-		ElGamalAlice(&Curve, Socket_Bob, &Point_Public_Key_Alice, Private_Key_Alice, Message);
-		gmp_printf("Message is : %Zd\n", Message);
+		else if (String_Parameter_Table_File_Name == NULL)
+		{
+			if (ElGamalAlice(&Curve, Socket_Bob, Private_Key_Alice, Public_Key_Alice, Message)) LOG_DEBUG("Message is : %Zd\n", Message);
+		}
+		// Get the sum of Bob's messages
+		else if (ElGamalExponentialAlice(&Curve, Socket_Bob, Private_Key_Alice, Public_Key_Alice, String_Parameter_Table_File_Name, Message)) LOG_DEBUG("Messages sum is : %Zd\n", Message);
 		
 		// Free resources
-		mpz_clear(Private_Key_Alice);
+		memset(Private_Key_Alice, 0, sizeof(Private_Key_Alice));
 		close(Socket_Bob);
 	}
 	// Bob
@@ -211,11 +373,11 @@ int main(int argc, char *argv[])
 		Socket_Alice = NetworkClientConnect(String_Parameter_IP_Address, Port);
 		if (Socket_Alice < 0)
 		{
-			printf("Error : could not connect to server.\n");
+			LOG_ERROR("Error : could not connect to server.\n");
 			ECFree(&Curve);
 			return 0;
 		}
-		printf("Connected to Alice.\n\n");
+		LOG_INFO("Connected to Alice.\n\n");
 		
 		// Initialize variables
 		mpz_init(Number_Temp);
@@ -223,17 +385,25 @@ int main(int argc, char *argv[])
 		// Find a message to send
 		mpz_set_ui(Number_Temp, 10000); // A number between 0 and 9999
 		UtilsGenerateRandomNumber(Number_Temp, Message);
-		gmp_printf("Message to send :\n%Zd\n\n", Message);
+		LOG_DEBUG("Message to send :\n%Zd\n\n", Message);
 		
 		// Send message to Alice
-		ElGamalBob(&Curve, Socket_Alice, Message);
+		if (String_Parameter_Table_File_Name == NULL) ElGamalBob(&Curve, Socket_Alice, Message);
+		else
+		{
+			// Messages are small numbers, so a second one is needed to make the sum meaningful
+			Messages[0] = mpz_get_ui(Message);
+			UtilsGenerateRandomNumber(Number_Temp, Message);
+			Messages[1] = mpz_get_ui(Message);
+			LOG_DEBUG("Second message to send :\n%Zd\n\n", Message);
+			ElGamalExponentialBob(&Curve, Socket_Alice, Messages);
+		}
 		
 		// Free resources
 		mpz_clear(Number_Temp);
 	}
 	
 	// Free resources
-	PointFree(&Point_Public_Key_Alice);
 	mpz_clear(Message);
 	close(Socket_Alice);
 	ECFree(&Curve);
@@ -0,0 +1,410 @@
+/** @file ElGamal_Exponential.c
+ * Exponential ElGamal with baby-step giant-step decryption.
+ */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "ElGamal_Exponential.h"
+#include "Elliptic_Curves.h"
+#include "Modular_Inversion.h"
+#include "Point.h"
+#include "Protocols.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** How many baby steps are computed at once, so the slopes of their additions share one inversion. */
+#define ELGAMAL_EXPONENTIAL_BATCH_SIZE 256
+/** The bit of an entry value storing the Y coordinate parity. */
+#define ELGAMAL_EXPONENTIAL_PARITY_BIT 31
+/** The mask of an entry value storing the baby step. */
+#define ELGAMAL_EXPONENTIAL_STEP_MASK 0x7FFFFFFF
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Get the 64 lowest bits of an X coordinate, they are uniformly distributed so they are used as the hash table key.
+ * @param X The X coordinate.
+ * @return The key.
+ */
+static inline uint64_t ElGamalExponentialGetKey(mpz_t X)
+{
+	#if GMP_NUMB_BITS >= 64
+		return mpz_getlimbn(X, 0);
+	#else
+		return mpz_getlimbn(X, 0) | ((uint64_t) mpz_getlimbn(X, 1) << 32);
+	#endif
+}
+
+/** Store a baby step in the hash table.
+ * @param Pointer_Entries The hash table.
+ * @param Slots_Mask The slots count minus one.
+ * @param Pointer_Point The point Step.G.
+ * @param Step The baby step.
+ */
+static void ElGamalExponentialInsert(TElGamalExponentialTableEntry *Pointer_Entries, uint32_t Slots_Mask, TPoint *Pointer_Point, uint32_t Step)
+{
+	uint64_t Key;
+	uint32_t Slot;
+	
+	// Linear probing, the table is half full so the sequences stay short
+	Key = ElGamalExponentialGetKey(Pointer_Point->X);
+	for (Slot = Key & Slots_Mask; Pointer_Entries[Slot].Value != 0; Slot = (Slot + 1) & Slots_Mask);
+	Pointer_Entries[Slot].Tag = (uint32_t) (Key >> 32);
+	Pointer_Entries[Slot].Value = Step | ((uint32_t) mpz_odd_p(Pointer_Point->Y) << ELGAMAL_EXPONENTIAL_PARITY_BIT);
+}
+
+/** Compute j.G for all baby steps j and store them in the hash table. The steps are computed by batches : the batch points are all added to the same point,
+ * so the denominators of their slopes are inverted together with Montgomery's trick.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Entries The empty hash table.
+ * @param Slots_Mask The slots count minus one.
+ * @param Baby_Steps_Count The largest baby step.
+ */
+static void ElGamalExponentialComputeBabySteps(TEllipticCurve *Pointer_Curve, TElGamalExponentialTableEntry *Pointer_Entries, uint32_t Slots_Mask, uint32_t Baby_Steps_Count)
+{
+	TPoint Points[ELGAMAL_EXPONENTIAL_BATCH_SIZE], Point_Step;
+	mpz_t Products[ELGAMAL_EXPONENTIAL_BATCH_SIZE], Inverse, Lambda, Difference, Number_Temp;
+	uint32_t Step = 1;
+	int i, Batch_Size;
+	
+	Batch_Size = Baby_Steps_Count < ELGAMAL_EXPONENTIAL_BATCH_SIZE ? Baby_Steps_Count : ELGAMAL_EXPONENTIAL_BATCH_SIZE;
+	for (i = 0; i < Batch_Size; i++)
+	{
+		PointCreate(0, 0, &Points[i]);
+		mpz_init(Products[i]);
+	}
+	PointCreate(0, 0, &Point_Step);
+	mpz_init(Inverse);
+	mpz_init(Lambda);
+	mpz_init(Difference);
+	mpz_init(Number_Temp);
+	
+	// The first batch holds 1.G to Batch_Size.G, the next batches are obtained by adding Batch_Size.G
+	PointCopy(&Pointer_Curve->Point_Generator, &Points[0]);
+	for (i = 1; i < Batch_Size; i++) ECAddition(Pointer_Curve, &Points[i - 1], &Pointer_Curve->Point_Generator, &Points[i]);
+	PointCopy(&Points[Batch_Size - 1], &Point_Step);
+	
+	while (1)
+	{
+		for (i = 0; (i < Batch_Size) && (Step <= Baby_Steps_Count); i++, Step++) ElGamalExponentialInsert(Pointer_Entries, Slots_Mask, &Points[i], Step);
+		if (Step > Baby_Steps_Count) break;
+		
+		// Products[i] = (x0 - xs)(x1 - xs)...(xi - xs), a zero difference (only when the point is the step itself) is replaced by 1 and the point is doubled separately
+		for (i = 0; i < Batch_Size; i++)
+		{
+			mpz_sub(Difference, Points[i].X, Point_Step.X);
+			if (mpz_sgn(Difference) == 0) mpz_set_ui(Difference, 1);
+			if (i == 0) mpz_mod(Products[0], Difference, Pointer_Curve->p);
+			else
+			{
+				mpz_mul(Products[i], Products[i - 1], Difference);
+				mpz_mod(Products[i], Products[i], Pointer_Curve->p);
+			}
+		}
+		ECInvertFieldElement(Pointer_Curve, Products[Batch_Size - 1], Inverse);
+		
+		// Walk back the products, Inverse is the inverse of Products[i] at each step
+		for (i = Batch_Size - 1; i >= 0; i--)
+		{
+			if (mpz_cmp(Points[i].X, Point_Step.X) == 0)
+			{
+				ECAddition(Pointer_Curve, &Points[i], &Point_Step, &Points[i]);
+				continue;
+			}
+			
+			// Lambda = (yi - ys) / (xi - xs)
+			if (i > 0)
+			{
+				mpz_mul(Number_Temp, Inverse, Products[i - 1]);
+				mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->p);
+			}
+			else mpz_set(Number_Temp, Inverse);
+			mpz_sub(Difference, Points[i].X, Point_Step.X);
+			mpz_mul(Inverse, Inverse, Difference);
+			mpz_mod(Inverse, Inverse, Pointer_Curve->p);
+			mpz_sub(Lambda, Points[i].Y, Point_Step.Y);
+			mpz_mul(Lambda, Lambda, Number_Temp);
+			mpz_mod(Lambda, Lambda, Pointer_Curve->p);
+			
+			// x = lambda^2 - xi - xs and y = lambda.(xi - x) - yi
+			mpz_mul(Number_Temp, Lambda, Lambda);
+			mpz_sub(Number_Temp, Number_Temp, Points[i].X);
+			mpz_sub(Number_Temp, Number_Temp, Point_Step.X);
+			mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->p);
+			mpz_sub(Difference, Points[i].X, Number_Temp);
+			mpz_set(Points[i].X, Number_Temp);
+			mpz_mul(Number_Temp, Lambda, Difference);
+			mpz_sub(Number_Temp, Number_Temp, Points[i].Y);
+			mpz_mod(Points[i].Y, Number_Temp, Pointer_Curve->p);
+		}
+	}
+	
+	for (i = 0; i < Batch_Size; i++)
+	{
+		PointFree(&Points[i]);
+		mpz_clear(Products[i]);
+	}
+	PointFree(&Point_Step);
+	mpz_clear(Inverse);
+	mpz_clear(Lambda);
+	mpz_clear(Difference);
+	mpz_clear(Number_Temp);
+}
+
+/** Hash the curve prime and generator, so a table is never used with another curve.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Output_Hash On output, contain the hash (UTILS_HASH_LENGTH bytes).
+ * @return 1 if the hash was computed or 0 if an error occurred.
+ */
+static int ElGamalExponentialComputeCurveHash(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Output_Hash)
+{
+	unsigned char Buffer[3 * ((MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8)];
+	size_t Size;
+	
+	Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	if ((3 * Size > sizeof(Buffer)) || !ProtocolExportNumber(Pointer_Curve->p, Size, Buffer) || !ProtocolExportNumber(Pointer_Curve->Point_Generator.X, Size, Buffer + Size) || !ProtocolExportNumber(Pointer_Curve->Point_Generator.Y, Size, Buffer + 2 * Size)) return 0;
+	return UtilsComputeHash(Buffer, 3 * Size, Pointer_Output_Hash);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ElGamalExponentialCreateTableFile(TEllipticCurve *Pointer_Curve, char *String_Path, int Baby_Steps_Bits, int Message_Bits)
+{
+	TElGamalExponentialTableHeader Header;
+	TElGamalExponentialTableEntry *Pointer_Entries;
+	FILE *File;
+	size_t Slots_Count;
+	char *String_Temporary_Path;
+	int File_Descriptor, Return_Value = 0;
+	
+	// The giant steps count must fit in the header and the messages must stay far from n, so m.G and -m.G never collide
+	if ((Baby_Steps_Bits < 1) || (Baby_Steps_Bits > 30) || (Message_Bits <= Baby_Steps_Bits) || (Message_Bits - Baby_Steps_Bits - 1 > 31) || (Message_Bits > 62) || ((size_t) Message_Bits + 2 >= mpz_sizeinbase(Pointer_Curve->n, 2))) return 0;
+	
+	memset(&Header, 0, sizeof(Header));
+	memcpy(Header.Magic, ELGAMAL_EXPONENTIAL_TABLE_MAGIC, ELGAMAL_EXPONENTIAL_TABLE_MAGIC_LENGTH);
+	Header.Version = ELGAMAL_EXPONENTIAL_TABLE_VERSION;
+	Header.Byte_Order_Mark = ELGAMAL_EXPONENTIAL_TABLE_BYTE_ORDER_MARK;
+	Header.Baby_Steps_Bits = Baby_Steps_Bits;
+	Header.Slots_Bits = Baby_Steps_Bits + 1;
+	Header.Giant_Steps_Count = (1U << (Message_Bits - Baby_Steps_Bits - 1)) + 1; // m = i.2^(Baby_Steps_Bits + 1) + j with |j| <= 2^Baby_Steps_Bits
+	if (!ElGamalExponentialComputeCurveHash(Pointer_Curve, Header.Curve_Hash)) return 0;
+	
+	Slots_Count = (size_t) 1 << Header.Slots_Bits;
+	Pointer_Entries = calloc(Slots_Count, sizeof(TElGamalExponentialTableEntry));
+	if (Pointer_Entries == NULL) return 0;
+	ElGamalExponentialComputeBabySteps(Pointer_Curve, Pointer_Entries, Slots_Count - 1, 1U << Baby_Steps_Bits);
+	
+	// Truncating the file in place would change the tables other processes have mapped, write a new file and replace the old one
+	String_Temporary_Path = malloc(strlen(String_Path) + sizeof(".XXXXXX"));
+	if (String_Temporary_Path == NULL) goto Exit;
+	sprintf(String_Temporary_Path, "%s.XXXXXX", String_Path);
+	File_Descriptor = mkstemp(String_Temporary_Path);
+	if (File_Descriptor == -1) goto Exit_Free_Path;
+	fchmod(File_Descriptor, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH); // mkstemp() makes the file private, the table is meant to be shared
+	File = fdopen(File_Descriptor, "wb");
+	if (File == NULL)
+	{
+		close(File_Descriptor);
+		goto Exit_Remove_File;
+	}
+	
+	// Write the header, the padding and the entries
+	if (fwrite(&Header, sizeof(Header), 1, File) != 1) goto Exit_Close_File;
+	while (ftell(File) < ELGAMAL_EXPONENTIAL_TABLE_ENTRIES_OFFSET)
+	{
+		if (fputc(0, File) == EOF) goto Exit_Close_File;
+	}
+	if (fwrite(Pointer_Entries, sizeof(TElGamalExponentialTableEntry), Slots_Count, File) != Slots_Count) goto Exit_Close_File;
+	
+	// The data must be on disk before the new name is, otherwise a crash could leave an empty table
+	if ((fflush(File) != 0) || (fsync(fileno(File)) != 0)) goto Exit_Close_File;
+	Return_Value = 1;
+	
+Exit_Close_File:
+	if (fclose(File) != 0) Return_Value = 0;
+	if (Return_Value && (rename(String_Temporary_Path, String_Path) != 0)) Return_Value = 0;
+Exit_Remove_File:
+	if (!Return_Value) unlink(String_Temporary_Path);
+Exit_Free_Path:
+	free(String_Temporary_Path);
+Exit:
+	free(Pointer_Entries);
+	return Return_Value;
+}
+
+int ElGamalExponentialLoadTable(TEllipticCurve *Pointer_Curve, char *String_Path, TElGamalExponentialTable *Pointer_Table)
+{
+	int File_Descriptor;
+	struct stat File_Status;
+	unsigned char *Pointer_File, Curve_Hash[UTILS_HASH_LENGTH];
+	TElGamalExponentialTableHeader *Pointer_Header;
+	size_t File_Size;
+	mpz_t Number_Step;
+	
+	// Map the whole file
+	File_Descriptor = open(String_Path, O_RDONLY);
+	if (File_Descriptor == -1) return 0;
+	if ((fstat(File_Descriptor, &File_Status) == -1) || ((size_t) File_Status.st_size < ELGAMAL_EXPONENTIAL_TABLE_ENTRIES_OFFSET))
+	{
+		close(File_Descriptor);
+		return 0;
+	}
+	File_Size = File_Status.st_size;
+	Pointer_File = mmap(NULL, File_Size, PROT_READ, MAP_SHARED, File_Descriptor, 0);
+	close(File_Descriptor); // The mapping stays valid
+	if (Pointer_File == MAP_FAILED) return 0;
+	
+	// Check that the table can be used on this machine with this curve
+	Pointer_Header = (TElGamalExponentialTableHeader *) Pointer_File;
+	if ((memcmp(Pointer_Header->Magic, ELGAMAL_EXPONENTIAL_TABLE_MAGIC, ELGAMAL_EXPONENTIAL_TABLE_MAGIC_LENGTH) != 0) || (Pointer_Header->Version != ELGAMAL_EXPONENTIAL_TABLE_VERSION) || (Pointer_Header->Byte_Order_Mark != ELGAMAL_EXPONENTIAL_TABLE_BYTE_ORDER_MARK)) goto Error;
+	if ((Pointer_Header->Baby_Steps_Bits < 1) || (Pointer_Header->Baby_Steps_Bits > 30) || (Pointer_Header->Slots_Bits <= Pointer_Header->Baby_Steps_Bits) || (Pointer_Header->Slots_Bits > 31)) goto Error;
+	if (File_Size - ELGAMAL_EXPONENTIAL_TABLE_ENTRIES_OFFSET < ((size_t) 1 << Pointer_Header->Slots_Bits) * sizeof(TElGamalExponentialTableEntry)) goto Error;
+	if (!ElGamalExponentialComputeCurveHash(Pointer_Curve, Curve_Hash) || (memcmp(Curve_Hash, Pointer_Header->Curve_Hash, UTILS_HASH_LENGTH) != 0)) goto Error;
+	
+	Pointer_Table->Pointer_Mapped_File = Pointer_File;
+	Pointer_Table->Mapped_File_Size = File_Size;
+	Pointer_Table->Pointer_Entries = (const TElGamalExponentialTableEntry *) (Pointer_File + ELGAMAL_EXPONENTIAL_TABLE_ENTRIES_OFFSET);
+	Pointer_Table->Slots_Mask = (1U << Pointer_Header->Slots_Bits) - 1;
+	Pointer_Table->Baby_Steps_Count = 1U << Pointer_Header->Baby_Steps_Bits;
+	Pointer_Table->Giant_Steps_Count = Pointer_Header->Giant_Steps_Count;
+	
+	// The giant step goes down by twice the baby steps range
+	mpz_init_set_ui(Number_Step, 2 * Pointer_Table->Baby_Steps_Count);
+	PointCreate(0, 0, &Pointer_Table->Point_Giant_Step);
+	ECMultiplicationGenerator(Pointer_Curve, Number_Step, &Pointer_Table->Point_Giant_Step);
+	ECOpposite(Pointer_Curve, &Pointer_Table->Point_Giant_Step, &Pointer_Table->Point_Giant_Step);
+	mpz_clear(Number_Step);
+	return 1;
+	
+Error:
+	munmap(Pointer_File, File_Size);
+	return 0;
+}
+
+void ElGamalExponentialFreeTable(TElGamalExponentialTable *Pointer_Table)
+{
+	munmap(Pointer_Table->Pointer_Mapped_File, Pointer_Table->Mapped_File_Size);
+	PointFree(&Pointer_Table->Point_Giant_Step);
+}
+
+void ElGamalExponentialCreateCiphertext(TElGamalExponentialCiphertext *Pointer_Ciphertext)
+{
+	PointCreate(0, 0, &Pointer_Ciphertext->Point_C1);
+	PointCreate(0, 0, &Pointer_Ciphertext->Point_C2);
+}
+
+void ElGamalExponentialFreeCiphertext(TElGamalExponentialCiphertext *Pointer_Ciphertext)
+{
+	PointFree(&Pointer_Ciphertext->Point_C1);
+	PointFree(&Pointer_Ciphertext->Point_C2);
+}
+
+int ElGamalExponentialEncrypt(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, uint64_t Message, TElGamalExponentialCiphertext *Pointer_Output_Ciphertext)
+{
+	mpz_t Number_K, Number_Message;
+	TPoint Point_Temp;
+	
+	if (!ECIsPublicKeyValid(Pointer_Curve, Pointer_Point_Public_Key)) return 0;
+	
+	mpz_init(Number_K);
+	mpz_init(Number_Message);
+	PointCreate(0, 0, &Point_Temp);
+	
+	// C1 = k.G
+	UtilsGenerateRandomNumber(Pointer_Curve->n, Number_K);
+	ECMultiplicationGenerator(Pointer_Curve, Number_K, &Pointer_Output_Ciphertext->Point_C1);
+	
+	// C2 = m.G + k.Q
+	mpz_import(Number_Message, 1, 1, sizeof(Message), 0, 0, &Message);
+	ECMultiplicationGenerator(Pointer_Curve, Number_Message, &Point_Temp);
+	ECMultiplication(Pointer_Curve, Pointer_Point_Public_Key, Number_K, &Pointer_Output_Ciphertext->Point_C2);
+	ECAddition(Pointer_Curve, &Point_Temp, &Pointer_Output_Ciphertext->Point_C2, &Pointer_Output_Ciphertext->Point_C2);
+	
+	mpz_clear(Number_K);
+	mpz_clear(Number_Message);
+	PointFree(&Point_Temp);
+	return 1;
+}
+
+void ElGamalExponentialAdd(TEllipticCurve *Pointer_Curve, TElGamalExponentialCiphertext *Pointer_Ciphertext_A, TElGamalExponentialCiphertext *Pointer_Ciphertext_B, TElGamalExponentialCiphertext *Pointer_Output_Ciphertext)
+{
+	// (k1 + k2).G and (m1 + m2).G + (k1 + k2).Q
+	ECAddition(Pointer_Curve, &Pointer_Ciphertext_A->Point_C1, &Pointer_Ciphertext_B->Point_C1, &Pointer_Output_Ciphertext->Point_C1);
+	ECAddition(Pointer_Curve, &Pointer_Ciphertext_A->Point_C2, &Pointer_Ciphertext_B->Point_C2, &Pointer_Output_Ciphertext->Point_C2);
+}
+
+int ElGamalExponentialDecrypt(TEllipticCurve *Pointer_Curve, TElGamalExponentialTable *Pointer_Table, mpz_t Private_Key, TElGamalExponentialCiphertext *Pointer_Ciphertext, uint64_t *Pointer_Output_Message)
+{
+	TPoint Point_Message, Point_Current, Point_Check;
+	mpz_t Number_Candidate;
+	uint64_t Key, Giant_Step, Candidate;
+	uint32_t i, Slot, Tag, Value, Step;
+	int Return_Value = 0;
+	
+	// C1 must belong to the generator subgroup, otherwise s.C1 could leak bits of s
+	if (!ECIsPublicKeyValid(Pointer_Curve, &Pointer_Ciphertext->Point_C1) || (!Pointer_Ciphertext->Point_C2.Is_Infinite && !ECIsPointOnCurve(Pointer_Curve, &Pointer_Ciphertext->Point_C2))) return 0;
+	
+	PointCreate(0, 0, &Point_Message);
+	PointCreate(0, 0, &Point_Current);
+	PointCreate(0, 0, &Point_Check);
+	mpz_init(Number_Candidate);
+	
+	// M = C2 - s.C1
+	ECMultiplication(Pointer_Curve, &Pointer_Ciphertext->Point_C1, Private_Key, &Point_Message);
+	ECOpposite(Pointer_Curve, &Point_Message, &Point_Message);
+	ECAddition(Pointer_Curve, &Pointer_Ciphertext->Point_C2, &Point_Message, &Point_Message);
+	PointCopy(&Point_Message, &Point_Current);
+	
+	Giant_Step = 2 * (uint64_t) Pointer_Table->Baby_Steps_Count;
+	for (i = 0; i < Pointer_Table->Giant_Steps_Count; i++)
+	{
+		// M - i.2B.G is the neutral element when m = i.2B
+		if (Point_Current.Is_Infinite)
+		{
+			*Pointer_Output_Message = i * Giant_Step;
+			Return_Value = 1;
+			goto Exit;
+		}
+		
+		// Otherwise it is j.G or -j.G when m = i.2B + j or m = i.2B - j, the Y parity tells which one
+		Key = ElGamalExponentialGetKey(Point_Current.X);
+		Tag = (uint32_t) (Key >> 32);
+		for (Slot = Key & Pointer_Table->Slots_Mask; (Value = Pointer_Table->Pointer_Entries[Slot].Value) != 0; Slot = (Slot + 1) & Pointer_Table->Slots_Mask)
+		{
+			if (Pointer_Table->Pointer_Entries[Slot].Tag != Tag) continue;
+			
+			Step = Value & ELGAMAL_EXPONENTIAL_STEP_MASK;
+			Candidate = i * Giant_Step;
+			if ((Value >> ELGAMAL_EXPONENTIAL_PARITY_BIT) == (uint32_t) mpz_odd_p(Point_Current.Y)) Candidate += Step;
+			else if (Candidate >= Step) Candidate -= Step;
+			else continue;
+			
+			// Only 64 bits of X were compared, make sure the candidate is right
+			mpz_import(Number_Candidate, 1, 1, sizeof(Candidate), 0, 0, &Candidate);
+			ECMultiplicationGenerator(Pointer_Curve, Number_Candidate, &Point_Check);
+			if (PointIsEqual(&Point_Check, &Point_Message))
+			{
+				*Pointer_Output_Message = Candidate;
+				Return_Value = 1;
+				goto Exit;
+			}
+		}
+		
+		ECAddition(Pointer_Curve, &Point_Current, &Pointer_Table->Point_Giant_Step, &Point_Current);
+	}
+	
+Exit:
+	PointFree(&Point_Message);
+	PointFree(&Point_Current);
+	PointFree(&Point_Check);
+	mpz_clear(Number_Candidate);
+	return Return_Value;
+}
@@ -0,0 +1,143 @@
+/** @file ElGamal_Exponential.h
+ * Exponential ElGamal : a small integer m is encrypted as the point m.G, so adding two ciphertexts gives a ciphertext of the messages sum. Decrypting needs a discrete logarithm,
+ * which is found with the baby-step giant-step algorithm and a precomputed table of baby steps.
+ *
+ * The table is stored in a file mapped read-only in memory, so it is computed once and all processes decrypting with the same curve share one physical copy.
+ * The file starts with a TElGamalExponentialTableHeader followed by an open addressing hash table of j.G for j in [1, 2^Baby_Steps_Bits], keyed on the X coordinate.
+ * A point and its opposite have the same X coordinate, so each entry also stores the parity of Y, and a single lookup matches both j.G and -j.G : the giant steps are twice as large.
+ * Like binary curve files, table files are specific to the byte order of the machine which created them.
+ */
+#ifndef H_ELGAMAL_EXPONENTIAL_H
+#define H_ELGAMAL_EXPONENTIAL_H
+
+#include <stdint.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Utils.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** File signature. */
+#define ELGAMAL_EXPONENTIAL_TABLE_MAGIC "ECBSGSTB"
+/** Signature length in bytes. */
+#define ELGAMAL_EXPONENTIAL_TABLE_MAGIC_LENGTH 8
+/** Current format version. */
+#define ELGAMAL_EXPONENTIAL_TABLE_VERSION 1
+/** Written as a native integer to detect byte order mismatches. */
+#define ELGAMAL_EXPONENTIAL_TABLE_BYTE_ORDER_MARK 0x01020304
+/** The hash table entries start at this offset in the file. */
+#define ELGAMAL_EXPONENTIAL_TABLE_ENTRIES_OFFSET 64
+
+/** The default amount of baby steps is 2^21, the table file takes 32MB. */
+#define ELGAMAL_EXPONENTIAL_DEFAULT_BABY_STEPS_BITS 21
+/** By default messages up to 2^32 can be decrypted, with at most 1025 giant steps. */
+#define ELGAMAL_EXPONENTIAL_DEFAULT_MESSAGE_BITS 32
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** An encrypted message : C1 = k.G and C2 = m.G + k.Q, where k is random and Q is the recipient public key. */
+typedef struct
+{
+	TPoint Point_C1; //! k.G
+	TPoint Point_C2; //! m.G + k.Q
+} TElGamalExponentialCiphertext;
+
+/** A baby step of the table. */
+typedef struct
+{
+	uint32_t Tag; //! Bits 32 to 63 of the point X coordinate, the lowest bits select the slot.
+	uint32_t Value; //! j in the low 31 bits and the parity of the j.G Y coordinate in the high bit, 0 if the slot is empty.
+} TElGamalExponentialTableEntry;
+
+/** Table file header. */
+typedef struct
+{
+	char Magic[ELGAMAL_EXPONENTIAL_TABLE_MAGIC_LENGTH]; //! Must be ELGAMAL_EXPONENTIAL_TABLE_MAGIC.
+	uint32_t Version; //! Must be ELGAMAL_EXPONENTIAL_TABLE_VERSION.
+	uint32_t Byte_Order_Mark; //! Must be read as ELGAMAL_EXPONENTIAL_TABLE_BYTE_ORDER_MARK.
+	uint32_t Baby_Steps_Bits; //! The table holds j.G for j in [1, 2^Baby_Steps_Bits].
+	uint32_t Slots_Bits; //! The hash table has 2^Slots_Bits entries.
+	uint32_t Giant_Steps_Count; //! How many giant steps of 2^(Baby_Steps_Bits + 1) are needed to cover the messages range.
+	uint32_t Reserved; //! Keep the following field 64-bit aligned.
+	unsigned char Curve_Hash[UTILS_HASH_LENGTH]; //! The hash of p and of the generator coordinates, so a table can't be used with another curve.
+} TElGamalExponentialTableHeader;
+
+/** A mapped table. */
+typedef struct
+{
+	void *Pointer_Mapped_File; //! The file mapping.
+	size_t Mapped_File_Size; //! Size of the mapping in bytes.
+	const TElGamalExponentialTableEntry *Pointer_Entries; //! The hash table, it points to the mapping.
+	uint32_t Slots_Mask; //! The slots count minus one.
+	uint32_t Baby_Steps_Count; //! The largest baby step.
+	uint32_t Giant_Steps_Count; //! How many giant steps are tried before giving up.
+	TPoint Point_Giant_Step; //! -2.Baby_Steps_Count.G
+} TElGamalExponentialTable;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Compute the baby steps of a curve and store them to a table file. The table is written to a temporary file of the same directory that is renamed once it is on disk, so the processes
+ * mapping a previous table keep reading it unchanged and a crash never leaves a partial table.
+ * @param Pointer_Curve The curve.
+ * @param String_Path Path to the file to create.
+ * @param Baby_Steps_Bits The table holds 2^Baby_Steps_Bits baby steps (in [1, 30]), the file size is 2^(Baby_Steps_Bits + 4) bytes.
+ * @param Message_Bits The messages lower than 2^Message_Bits can be decrypted, it needs about 2^(Message_Bits - Baby_Steps_Bits - 1) giant steps.
+ * @return 1 if the file was successfully written or 0 if the parameters are not supported or an error occurred.
+ */
+int ElGamalExponentialCreateTableFile(TEllipticCurve *Pointer_Curve, char *String_Path, int Baby_Steps_Bits, int Message_Bits);
+
+/** Map a table file.
+ * @param Pointer_Curve The curve the table was computed for.
+ * @param String_Path Path to the file.
+ * @param Pointer_Table On output, contain the table.
+ * @return 1 if the table was loaded or 0 if the file could not be mapped or was computed for another curve or another machine.
+ */
+int ElGamalExponentialLoadTable(TEllipticCurve *Pointer_Curve, char *String_Path, TElGamalExponentialTable *Pointer_Table);
+
+/** Unmap a table.
+ * @param Pointer_Table The table to destroy.
+ */
+void ElGamalExponentialFreeTable(TElGamalExponentialTable *Pointer_Table);
+
+/** Initialize a ciphertext.
+ * @param Pointer_Ciphertext The ciphertext to create.
+ */
+void ElGamalExponentialCreateCiphertext(TElGamalExponentialCiphertext *Pointer_Ciphertext);
+
+/** Free a ciphertext.
+ * @param Pointer_Ciphertext The ciphertext to destroy.
+ */
+void ElGamalExponentialFreeCiphertext(TElGamalExponentialCiphertext *Pointer_Ciphertext);
+
+/** Encrypt a message. The random numbers come from UtilsGenerateRandomNumber(), so UtilsInitializeRandomGenerator() must have been called.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Point_Public_Key The recipient public key.
+ * @param Message The message.
+ * @param Pointer_Output_Ciphertext On output, contain the encrypted message (it must be created by the user).
+ * @return 1 if the message was encrypted or 0 if the public key is not valid.
+ */
+int ElGamalExponentialEncrypt(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, uint64_t Message, TElGamalExponentialCiphertext *Pointer_Output_Ciphertext);
+
+/** Add two ciphertexts encrypted for the same public key, the result decrypts to the sum of the messages.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Ciphertext_A First ciphertext.
+ * @param Pointer_Ciphertext_B Second ciphertext.
+ * @param Pointer_Output_Ciphertext On output, contain the sum (it can be one of the ciphertexts).
+ */
+void ElGamalExponentialAdd(TEllipticCurve *Pointer_Curve, TElGamalExponentialCiphertext *Pointer_Ciphertext_A, TElGamalExponentialCiphertext *Pointer_Ciphertext_B, TElGamalExponentialCiphertext *Pointer_Output_Ciphertext);
+
+/** Decrypt a message : compute M = C2 - s.C1 = m.G, then find m with the table.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Table The baby steps table.
+ * @param Private_Key The recipient private key s.
+ * @param Pointer_Ciphertext The encrypted message.
+ * @param Pointer_Output_Message On output, contain the message.
+ * @return 1 if the message was decrypted or 0 if the ciphertext is not valid or the message is out of the table range.
+ */
+int ElGamalExponentialDecrypt(TEllipticCurve *Pointer_Curve, TElGamalExponentialTable *Pointer_Table, mpz_t Private_Key, TElGamalExponentialCiphertext *Pointer_Ciphertext, uint64_t *Pointer_Output_Message);
+
+#endif
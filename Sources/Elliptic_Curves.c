@@ -1,13 +1,967 @@
 /** @file Elliptic_Curves.c
  * Basic operations for Weierstrass elliptic curves.
  */
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <gmp.h>
 #include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Binary.h"
+#include "Elliptic_Curves_Models.h"
+#include "Field_Lanes.h"
+#include "Instrumentation.h"
+#include "Modular_Inversion.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Maximum size in characters of a curve file line. */
+#define EC_MAXIMUM_FILE_LINE_SIZE 2048
+
+/** How many different values a curve file can contain. */
+#define EC_FILE_VALUES_COUNT 11
+/** Flag telling that the cofactor was found in a curve file (values flags follow the order of the names table in ECLoadFromFile()). */
+#define EC_FILE_VALUE_H (1 << 4)
+/** The values a curve file must provide whatever its model (p, n, gx and gy). */
+#define EC_FILE_MANDATORY_VALUES ((1 << 0) | (1 << 1) | (1 << 5) | (1 << 6))
+/** The coefficients a Weierstrass curve file must provide (a4 and a6). */
+#define EC_FILE_WEIERSTRASS_VALUES ((1 << 2) | (1 << 3))
+/** The coefficients a twisted Edwards curve file must provide (a and d). */
+#define EC_FILE_TWISTED_EDWARDS_VALUES ((1 << 7) | (1 << 8))
+/** The coefficients a Montgomery curve file must provide (A and B). */
+#define EC_FILE_MONTGOMERY_VALUES ((1 << 9) | (1 << 10))
+
+/** The NIST P-256 prime 2^256 - 2^224 + 2^192 + 2^96 - 1. */
+#define EC_P256_PRIME "ffffffff00000001000000000000000000000000ffffffffffffffffffffffff"
+
+/** How many inversions ECSelectFastestInversions() times for each method. */
+#define EC_INVERSION_BENCHMARK_ITERATIONS_COUNT 64
+
+/** The largest window tried by the multi-scalar multiplication, it allocates 2^(Window_Size - 1) buckets. */
+#define EC_MULTI_SCALAR_MAXIMUM_WINDOW_SIZE 14
+
+/** How many temporary numbers the map from field elements to points needs (the square root ratio uses the last 5 ones). */
+#define EC_MAP_TO_CURVE_TEMPORARY_NUMBERS_COUNT 14
+/** How many small integers are tried as the map Z constant before giving up. */
+#define EC_MAP_TO_CURVE_MAXIMUM_Z_CANDIDATES 1000
+/** The domain separation tag of the hash to curve message expansion, so these hashes can't collide with the hashes computed by other protocols. */
+#define EC_MAP_TO_CURVE_DOMAIN_SEPARATION_TAG "ELLIPTIC-CURVES_XMD:SHA-1_SSWU_RO_"
+/** The input block size of the library hash function (SHA-1). */
+#define EC_MAP_TO_CURVE_HASH_BLOCK_SIZE 64
+/** The hashed field elements are this amount of bits longer than p, so their bias modulo p is negligible. */
+#define EC_MAP_TO_CURVE_SECURITY_BITS 128
+/** The size in bytes of the longest hashed field element. */
+#define EC_MAP_TO_CURVE_MAXIMUM_ELEMENT_SIZE ((MODULAR_INVERSION_MAXIMUM_BITS + EC_MAP_TO_CURVE_SECURITY_BITS + 7) / 8)
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The generator table coordinates in the vectorized field representation. */
+struct TECLanesGeneratorTable
+{
+	TFieldLanesModulus Modulus; //! The curve field.
+	char Is_Usable; //! Tell if the field and the processor can use the lanes, the coordinates are not stored when they can't.
+	uint32_t Coordinates[]; //! For each generator table point, the limbs of X followed by the limbs of Y, in Montgomery form.
+};
 
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
 // Private functions
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Reduce a number modulo any prime with a division.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to reduce.
+ */
+static void ECReduceGeneric(TEllipticCurve *Pointer_Curve, mpz_t Number)
+{
+	mpz_mod(Number, Number, Pointer_Curve->p);
+}
+
+/** Reduce a number modulo a pseudo-Mersenne prime p = 2^k - c. As 2^k = c (mod p), the bits above k are multiplied by c and added to the k lowest bits until the number fits in k bits.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to reduce.
+ */
+static void ECReducePseudoMersenne(TEllipticCurve *Pointer_Curve, mpz_t Number)
+{
+	mp_size_t Size = mpz_size(Number), High_Size, Low_Size, Shift_Limbs;
+	int Sign = mpz_sgn(Number), Shift_Bits;
+	mp_limb_t Limbs[Size + 3], High_Limbs[Size + 3], *Pointer_Limbs;
+	
+	if (Sign == 0) return;
+	Low_Size = mpz_size(Pointer_Curve->p);
+	Shift_Limbs = Pointer_Curve->Reduction_Bits_Count / GMP_NUMB_BITS;
+	Shift_Bits = Pointer_Curve->Reduction_Bits_Count % GMP_NUMB_BITS;
+	
+	// Work on the absolute value
+	mpn_copyi(Limbs, mpz_limbs_read(Number), Size);
+	
+	// Fold the bits above k while there are some
+	while ((Size > Low_Size) || ((Size == Low_Size) && (Shift_Bits != 0) && ((Limbs[Size - 1] >> Shift_Bits) != 0)))
+	{
+		// High part multiplied by c
+		High_Size = Size - Shift_Limbs;
+		if (Shift_Bits != 0) mpn_rshift(High_Limbs, Limbs + Shift_Limbs, High_Size, Shift_Bits);
+		else mpn_copyi(High_Limbs, Limbs + Shift_Limbs, High_Size);
+		High_Limbs[High_Size] = mpn_mul_1(High_Limbs, High_Limbs, High_Size, Pointer_Curve->Reduction_Constant);
+		High_Size++;
+		
+		// Keep the k lowest bits
+		if (Shift_Bits != 0) Limbs[Low_Size - 1] &= ((mp_limb_t) 1 << Shift_Bits) - 1;
+		
+		// Add both parts
+		if (High_Size >= Low_Size)
+		{
+			Limbs[High_Size] = mpn_add(Limbs, High_Limbs, High_Size, Limbs, Low_Size);
+			Size = High_Size + 1;
+		}
+		else
+		{
+			Limbs[Low_Size] = mpn_add(Limbs, Limbs, Low_Size, High_Limbs, High_Size);
+			Size = Low_Size + 1;
+		}
+		while ((Size > 0) && (Limbs[Size - 1] == 0)) Size--;
+	}
+	
+	// The number is now lower than 2^k = p + c, so one subtraction is enough
+	if ((Size == Low_Size) && (mpn_cmp(Limbs, mpz_limbs_read(Pointer_Curve->p), Low_Size) >= 0)) mpn_sub_n(Limbs, Limbs, mpz_limbs_read(Pointer_Curve->p), Low_Size);
+	
+	Pointer_Limbs = mpz_limbs_write(Number, Size);
+	mpn_copyi(Pointer_Limbs, Limbs, Size);
+	mpz_limbs_finish(Number, Size);
+	
+	// -x = p - x (mod p)
+	if ((Sign < 0) && (mpz_sgn(Number) != 0)) mpz_sub(Number, Pointer_Curve->p, Number);
+}
+
+/** Reduce a number modulo the P-256 prime using the NIST fast reduction (FIPS 186-4 appendix D.2.3). The number is split in 32-bit words c0..c15 which are added and subtracted in a fixed pattern.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to reduce.
+ */
+static void ECReduceP256(TEllipticCurve *Pointer_Curve, mpz_t Number)
+{
+	const mp_limb_t *Pointer_Input_Limbs;
+	mp_limb_t *Pointer_Limbs;
+	mp_size_t Size = mpz_size(Number);
+	int64_t c[16] = {0}, Words[8], Carry;
+	int Sign = mpz_sgn(Number), i;
+	
+	// The words pattern handles numbers up to 512 bits only
+	if (Size > 512 / GMP_NUMB_BITS)
+	{
+		mpz_mod(Number, Number, Pointer_Curve->p);
+		return;
+	}
+	
+	// Split the absolute value in 32-bit words
+	Pointer_Input_Limbs = mpz_limbs_read(Number);
+	for (i = 0; i < Size * (GMP_NUMB_BITS / 32); i++) c[i] = (uint32_t) (Pointer_Input_Limbs[i * 32 / GMP_NUMB_BITS] >> ((i * 32) % GMP_NUMB_BITS));
+	
+	// s1 + 2.s2 + 2.s3 + s4 + s5 - s6 - s7 - s8 - s9
+	Words[0] = c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14];
+	Words[1] = c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15];
+	Words[2] = c[2] + c[10] + c[11] - c[13] - c[14] - c[15];
+	Words[3] = c[3] + 2 * c[11] + 2 * c[12] + c[13] - c[8] - c[9] - c[15];
+	Words[4] = c[4] + 2 * c[12] + 2 * c[13] + c[14] - c[9] - c[10];
+	Words[5] = c[5] + 2 * c[13] + 2 * c[14] + c[15] - c[10] - c[11];
+	Words[6] = c[6] + c[13] + 3 * c[14] + 2 * c[15] - c[8] - c[9];
+	Words[7] = c[7] + c[8] + 3 * c[15] - c[10] - c[11] - c[12] - c[13];
+	
+	// Propagate the carries, the final carry is a multiple of 2^256 = 2^224 - 2^192 - 2^96 + 1 (mod p) which is folded back until there is none
+	do
+	{
+		Carry = 0;
+		for (i = 0; i < 8; i++)
+		{
+			Words[i] += Carry;
+			Carry = Words[i] >> 32; // Arithmetic shift, so negative words borrow from the next one
+			Words[i] &= 0xFFFFFFFF;
+		}
+		Words[0] += Carry;
+		Words[3] -= Carry;
+		Words[6] -= Carry;
+		Words[7] += Carry;
+	} while (Carry != 0);
+	
+	// The number is now lower than 2^256 < 2.p, so one subtraction is enough
+	Pointer_Limbs = mpz_limbs_write(Number, 256 / GMP_NUMB_BITS);
+	for (i = 0; i < 256 / GMP_NUMB_BITS; i++) Pointer_Limbs[i] = 0;
+	for (i = 0; i < 8; i++) Pointer_Limbs[i * 32 / GMP_NUMB_BITS] |= (mp_limb_t) Words[i] << ((i * 32) % GMP_NUMB_BITS);
+	if (mpn_cmp(Pointer_Limbs, mpz_limbs_read(Pointer_Curve->p), 256 / GMP_NUMB_BITS) >= 0) mpn_sub_n(Pointer_Limbs, Pointer_Limbs, mpz_limbs_read(Pointer_Curve->p), 256 / GMP_NUMB_BITS);
+	mpz_limbs_finish(Number, 256 / GMP_NUMB_BITS);
+	
+	// -x = p - x (mod p)
+	if ((Sign < 0) && (mpz_sgn(Number) != 0)) mpz_sub(Number, Pointer_Curve->p, Number);
+}
+
+/** Reduce a number modulo p with the curve reduction function.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to reduce.
+ */
+static inline void ECReduce(TEllipticCurve *Pointer_Curve, mpz_t Number)
+{
+	INSTRUMENTATION_COUNT(Reductions);
+	Pointer_Curve->Function_Reduce(Pointer_Curve, Number);
+}
+
+/** Multiply two numbers of the field, the result is not reduced.
+ * @param Result On output, contain the product (it can be one of the operands).
+ * @param Number_A First operand.
+ * @param Number_B Second operand, when it is the same variable as the first operand the product is counted as a squaring.
+ */
+static inline void ECMultiply(mpz_t Result, mpz_t Number_A, mpz_t Number_B)
+{
+	if (Number_A == Number_B) INSTRUMENTATION_COUNT(Field_Squarings);
+	else INSTRUMENTATION_COUNT(Field_Multiplications);
+	mpz_mul(Result, Number_A, Number_B);
+}
+
+/** Invert a number of the field.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Result On output, contain the inverse (it can be the same variable as Number).
+ * @param Number The number to invert.
+ * @return 0 if the number has no inverse or another value otherwise.
+ */
+static inline int ECInvert(TEllipticCurve *Pointer_Curve, mpz_t Result, mpz_t Number)
+{
+	INSTRUMENTATION_COUNT(Field_Inversions);
+	
+	// The affine formulas invert unreduced differences and doubled coordinates
+	if ((mpz_sgn(Number) < 0) || (mpz_cmp(Number, Pointer_Curve->p) >= 0))
+	{
+		mpz_mod(Result, Number, Pointer_Curve->p);
+		Number = Result;
+	}
+	return ModularInversionInvertNumber(&Pointer_Curve->Field_Inversion, Pointer_Curve->Field_Inversion_Method, Number, Result);
+}
+
+/** Initialize a point in Jacobian coordinates. The point is infinite.
+ * @param Pointer_Point The point to create.
+ */
+static void ECJacobianCreate(TECJacobianPoint *Pointer_Point)
+{
+	mpz_init(Pointer_Point->X);
+	mpz_init(Pointer_Point->Y);
+	mpz_init(Pointer_Point->Z);
+	Pointer_Point->Is_Infinite = 1;
+}
+
+/** Free a point in Jacobian coordinates.
+ * @param Pointer_Point The point to destroy.
+ */
+static void ECJacobianFree(TECJacobianPoint *Pointer_Point)
+{
+	mpz_clear(Pointer_Point->X);
+	mpz_clear(Pointer_Point->Y);
+	mpz_clear(Pointer_Point->Z);
+}
+
+/** Convert a finite point in Jacobian coordinates to affine coordinates when the inverse of its Z coordinate is known.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Input_Point The point to convert.
+ * @param Z_Inverse The inverse of the point Z coordinate modulo p.
+ * @param Pointer_Output_Point The affine point (it must be created by the user).
+ * @param Z_Inverse_Power A temporary number.
+ */
+static inline void ECJacobianToAffineWithInverse(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Input_Point, mpz_t Z_Inverse, TPoint *Pointer_Output_Point, mpz_t Z_Inverse_Power)
+{
+	ECMultiply(Z_Inverse_Power, Z_Inverse, Z_Inverse); // Z^-2
+	ECReduce(Pointer_Curve, Z_Inverse_Power);
+	ECMultiply(Pointer_Output_Point->X, Pointer_Input_Point->X, Z_Inverse_Power); // X / Z^2
+	ECReduce(Pointer_Curve, Pointer_Output_Point->X);
+	ECMultiply(Z_Inverse_Power, Z_Inverse_Power, Z_Inverse); // Z^-3
+	ECReduce(Pointer_Curve, Z_Inverse_Power);
+	ECMultiply(Pointer_Output_Point->Y, Pointer_Input_Point->Y, Z_Inverse_Power); // Y / Z^3
+	ECReduce(Pointer_Curve, Pointer_Output_Point->Y);
+	Pointer_Output_Point->Is_Infinite = 0;
+}
+
+/** Convert a point in Jacobian coordinates to affine coordinates with one modular inversion.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Input_Point The point to convert.
+ * @param Pointer_Output_Point The affine point (it must be created by the user).
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianToAffine(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Input_Point, TPoint *Pointer_Output_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	if (Pointer_Input_Point->Is_Infinite)
+	{
+		Pointer_Output_Point->Is_Infinite = 1;
+		return;
+	}
+	
+	ECInvert(Pointer_Curve, Pointer_Temporary_Numbers[0], Pointer_Input_Point->Z);
+	ECJacobianToAffineWithInverse(Pointer_Curve, Pointer_Input_Point, Pointer_Temporary_Numbers[0], Pointer_Output_Point, Pointer_Temporary_Numbers[1]);
+}
+
+/** Convert many points in Jacobian coordinates to affine coordinates with a single modular inversion (Montgomery's trick) :
+ * the product of all Z coordinates is inverted, then each Z inverse is recovered from the products of the other coordinates with 3 multiplications.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Input_Points The points to convert.
+ * @param Points_Count How many points there are.
+ * @param Pointer_Output_Points The affine points (they must be created by the user).
+ * @param Pointer_Products Points_Count initialized numbers receiving the products of the Z coordinates.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianToAffineBatch(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Input_Points, int Points_Count, TPoint *Pointer_Output_Points, mpz_t *Pointer_Products, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr Product = Pointer_Temporary_Numbers[0], Inverse = Pointer_Temporary_Numbers[1], Z_Inverse = Pointer_Temporary_Numbers[2];
+	int i;
+	
+	// Products[i] = Z0 * Z1 * ... * Zi (infinite points are skipped)
+	mpz_set_ui(Product, 1);
+	for (i = 0; i < Points_Count; i++)
+	{
+		if (!Pointer_Input_Points[i].Is_Infinite)
+		{
+			ECMultiply(Product, Product, Pointer_Input_Points[i].Z);
+			ECReduce(Pointer_Curve, Product);
+		}
+		mpz_set(Pointer_Products[i], Product);
+	}
+	
+	// Inverse = (Z0 * Z1 * ... * Zi)^-1, starting with the last point
+	ECInvert(Pointer_Curve, Inverse, Product);
+	for (i = Points_Count - 1; i >= 0; i--)
+	{
+		if (Pointer_Input_Points[i].Is_Infinite)
+		{
+			Pointer_Output_Points[i].Is_Infinite = 1;
+			continue;
+		}
+		
+		// Zi^-1 = (Z0 * ... * Zi)^-1 * (Z0 * ... * Zi-1)
+		if (i > 0)
+		{
+			ECMultiply(Z_Inverse, Inverse, Pointer_Products[i - 1]);
+			ECReduce(Pointer_Curve, Z_Inverse);
+		}
+		else mpz_set(Z_Inverse, Inverse);
+		
+		// Remove Zi from the inverted product
+		ECMultiply(Inverse, Inverse, Pointer_Input_Points[i].Z);
+		ECReduce(Pointer_Curve, Inverse);
+		
+		ECJacobianToAffineWithInverse(Pointer_Curve, &Pointer_Input_Points[i], Z_Inverse, &Pointer_Output_Points[i], Pointer_Temporary_Numbers[3]);
+	}
+}
+
+/** End a Jacobian doubling once M = 3.X^2 + a4.Z^4 is known, this part does not depend on a4.
+ * X3 = M^2 - 2.S, Y3 = M.(S - X3) - 8.Y^4, Z3 = 2.Y.Z where S = 4.X.Y^2.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Pointer_Temporary_Numbers Temporary numbers, M is the fourth one.
+ */
+static inline void ECJacobianDoubleEnd(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr Y_Square = Pointer_Temporary_Numbers[0], S = Pointer_Temporary_Numbers[1], Y_Power_4 = Pointer_Temporary_Numbers[2], M = Pointer_Temporary_Numbers[3], Temp = Pointer_Temporary_Numbers[4];
+	
+	INSTRUMENTATION_COUNT(Point_Doublings);
+	ECMultiply(Y_Square, Pointer_Point->Y, Pointer_Point->Y); // Y^2
+	ECReduce(Pointer_Curve, Y_Square);
+	ECMultiply(S, Pointer_Point->X, Y_Square); // X.Y^2
+	mpz_mul_2exp(S, S, 2); // 4.X.Y^2
+	ECReduce(Pointer_Curve, S);
+	ECMultiply(Y_Power_4, Y_Square, Y_Square); // Y^4
+	ECReduce(Pointer_Curve, Y_Power_4);
+	
+	// Z3 = 2.Y.Z
+	ECMultiply(Pointer_Point->Z, Pointer_Point->Y, Pointer_Point->Z);
+	mpz_mul_2exp(Pointer_Point->Z, Pointer_Point->Z, 1);
+	ECReduce(Pointer_Curve, Pointer_Point->Z);
+	
+	// X3 = M^2 - 2.S
+	ECMultiply(Pointer_Point->X, M, M);
+	mpz_submul_ui(Pointer_Point->X, S, 2);
+	ECReduce(Pointer_Curve, Pointer_Point->X);
+	
+	// Y3 = M.(S - X3) - 8.Y^4
+	mpz_sub(Temp, S, Pointer_Point->X);
+	ECMultiply(Pointer_Point->Y, M, Temp);
+	mpz_submul_ui(Pointer_Point->Y, Y_Power_4, 8);
+	ECReduce(Pointer_Curve, Pointer_Point->Y);
+	
+	// The double of a point of order 2 (Y = 0) is infinite
+	if (mpz_sgn(Pointer_Point->Z) == 0) Pointer_Point->Is_Infinite = 1;
+}
+
+/** Double a point in Jacobian coordinates on a curve where a4 = 0 : M = 3.X^2.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianDoubleA4Zero(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr M = Pointer_Temporary_Numbers[3];
+	
+	if (Pointer_Point->Is_Infinite) return;
+	
+	ECMultiply(M, Pointer_Point->X, Pointer_Point->X);
+	mpz_mul_ui(M, M, 3);
+	ECReduce(Pointer_Curve, M);
+	
+	ECJacobianDoubleEnd(Pointer_Curve, Pointer_Point, Pointer_Temporary_Numbers);
+}
+
+/** Double a point in Jacobian coordinates on a curve where a4 = -3 : M = 3.X^2 - 3.Z^4 = 3.(X - Z^2).(X + Z^2).
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianDoubleA4MinusThree(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr M = Pointer_Temporary_Numbers[3], Z_Square = Pointer_Temporary_Numbers[4], Temp = Pointer_Temporary_Numbers[5];
+	
+	if (Pointer_Point->Is_Infinite) return;
+	
+	ECMultiply(Z_Square, Pointer_Point->Z, Pointer_Point->Z);
+	ECReduce(Pointer_Curve, Z_Square);
+	mpz_sub(Temp, Pointer_Point->X, Z_Square); // X - Z^2
+	mpz_add(M, Pointer_Point->X, Z_Square); // X + Z^2
+	ECMultiply(M, M, Temp);
+	ECReduce(Pointer_Curve, M);
+	mpz_mul_ui(M, M, 3);
+	ECReduce(Pointer_Curve, M);
+	
+	ECJacobianDoubleEnd(Pointer_Curve, Pointer_Point, Pointer_Temporary_Numbers);
+}
+
+/** Double a point in Jacobian coordinates on any curve : M = 3.X^2 + a4.Z^4.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianDoubleGeneric(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr M = Pointer_Temporary_Numbers[3], Z_Power = Pointer_Temporary_Numbers[4];
+	
+	if (Pointer_Point->Is_Infinite) return;
+	
+	ECMultiply(Z_Power, Pointer_Point->Z, Pointer_Point->Z); // Z^2
+	ECReduce(Pointer_Curve, Z_Power);
+	ECMultiply(Z_Power, Z_Power, Z_Power); // Z^4
+	ECReduce(Pointer_Curve, Z_Power);
+	ECMultiply(Z_Power, Z_Power, Pointer_Curve->a4); // a4.Z^4
+	ECReduce(Pointer_Curve, Z_Power);
+	ECMultiply(M, Pointer_Point->X, Pointer_Point->X);
+	mpz_mul_ui(M, M, 3);
+	mpz_add(M, M, Z_Power);
+	ECReduce(Pointer_Curve, M);
+	
+	ECJacobianDoubleEnd(Pointer_Curve, Pointer_Point, Pointer_Temporary_Numbers);
+}
+
+/** Add an affine point to a point in Jacobian coordinates (mixed addition).
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point_P The point in Jacobian coordinates, it contains the result on output.
+ * @param Pointer_Point_Q The affine point to add.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianAddAffine(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point_P, TPoint *Pointer_Point_Q, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr Z_Square = Pointer_Temporary_Numbers[0], H = Pointer_Temporary_Numbers[1], R = Pointer_Temporary_Numbers[2], H_Square = Pointer_Temporary_Numbers[3], H_Cube = Pointer_Temporary_Numbers[4], V = Pointer_Temporary_Numbers[5];
+	
+	if (Pointer_Point_Q->Is_Infinite) return;
+	if (Pointer_Point_P->Is_Infinite)
+	{
+		mpz_set(Pointer_Point_P->X, Pointer_Point_Q->X);
+		mpz_set(Pointer_Point_P->Y, Pointer_Point_Q->Y);
+		mpz_set_ui(Pointer_Point_P->Z, 1);
+		Pointer_Point_P->Is_Infinite = 0;
+		return;
+	}
+	
+	INSTRUMENTATION_COUNT(Point_Additions);
+	
+	// H = xq.Z^2 - X
+	ECMultiply(Z_Square, Pointer_Point_P->Z, Pointer_Point_P->Z);
+	ECReduce(Pointer_Curve, Z_Square);
+	ECMultiply(H, Pointer_Point_Q->X, Z_Square);
+	ECReduce(Pointer_Curve, H);
+	mpz_sub(H, H, Pointer_Point_P->X);
+	ECReduce(Pointer_Curve, H);
+	
+	// R = yq.Z^3 - Y
+	ECMultiply(R, Z_Square, Pointer_Point_P->Z);
+	ECReduce(Pointer_Curve, R);
+	ECMultiply(R, R, Pointer_Point_Q->Y);
+	ECReduce(Pointer_Curve, R);
+	mpz_sub(R, R, Pointer_Point_P->Y);
+	ECReduce(Pointer_Curve, R);
+	
+	// Same x coordinate : the points are equal or opposite
+	if (mpz_sgn(H) == 0)
+	{
+		if (mpz_sgn(R) == 0) Pointer_Curve->Function_Double_Jacobian(Pointer_Curve, Pointer_Point_P, Pointer_Temporary_Numbers);
+		else Pointer_Point_P->Is_Infinite = 1;
+		return;
+	}
+	
+	ECMultiply(H_Square, H, H);
+	ECReduce(Pointer_Curve, H_Square);
+	ECMultiply(H_Cube, H_Square, H);
+	ECReduce(Pointer_Curve, H_Cube);
+	ECMultiply(V, Pointer_Point_P->X, H_Square); // X.H^2
+	ECReduce(Pointer_Curve, V);
+	
+	// Z3 = Z.H
+	ECMultiply(Pointer_Point_P->Z, Pointer_Point_P->Z, H);
+	ECReduce(Pointer_Curve, Pointer_Point_P->Z);
+	
+	// X3 = R^2 - H^3 - 2.V
+	ECMultiply(Pointer_Point_P->X, R, R);
+	mpz_sub(Pointer_Point_P->X, Pointer_Point_P->X, H_Cube);
+	mpz_submul_ui(Pointer_Point_P->X, V, 2);
+	ECReduce(Pointer_Curve, Pointer_Point_P->X);
+	
+	// Y3 = R.(V - X3) - Y.H^3
+	ECMultiply(H_Cube, Pointer_Point_P->Y, H_Cube);
+	ECReduce(Pointer_Curve, H_Cube);
+	mpz_sub(V, V, Pointer_Point_P->X);
+	ECMultiply(Pointer_Point_P->Y, R, V);
+	mpz_sub(Pointer_Point_P->Y, Pointer_Point_P->Y, H_Cube);
+	ECReduce(Pointer_Curve, Pointer_Point_P->Y);
+}
+
+/** Add two points in Jacobian coordinates.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point_P The first point, it contains the result on output.
+ * @param Pointer_Point_Q The point to add.
+ * @param Pointer_Temporary_Numbers Temporary numbers.
+ */
+static void ECJacobianAdd(TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point_P, TECJacobianPoint *Pointer_Point_Q, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr Z_Square_P = Pointer_Temporary_Numbers[0], Z_Square_Q = Pointer_Temporary_Numbers[1], U = Pointer_Temporary_Numbers[2], H = Pointer_Temporary_Numbers[3], S = Pointer_Temporary_Numbers[4], R = Pointer_Temporary_Numbers[5];
+	
+	if (Pointer_Point_Q->Is_Infinite) return;
+	if (Pointer_Point_P->Is_Infinite)
+	{
+		mpz_set(Pointer_Point_P->X, Pointer_Point_Q->X);
+		mpz_set(Pointer_Point_P->Y, Pointer_Point_Q->Y);
+		mpz_set(Pointer_Point_P->Z, Pointer_Point_Q->Z);
+		Pointer_Point_P->Is_Infinite = 0;
+		return;
+	}
+	
+	INSTRUMENTATION_COUNT(Point_Additions);
+	
+	// U = X.Zq^2, H = xq.Z^2 - U
+	ECMultiply(Z_Square_P, Pointer_Point_P->Z, Pointer_Point_P->Z);
+	ECReduce(Pointer_Curve, Z_Square_P);
+	ECMultiply(Z_Square_Q, Pointer_Point_Q->Z, Pointer_Point_Q->Z);
+	ECReduce(Pointer_Curve, Z_Square_Q);
+	ECMultiply(U, Pointer_Point_P->X, Z_Square_Q);
+	ECReduce(Pointer_Curve, U);
+	ECMultiply(H, Pointer_Point_Q->X, Z_Square_P);
+	mpz_sub(H, H, U);
+	ECReduce(Pointer_Curve, H);
+	
+	// S = Y.Zq^3, R = Yq.Z^3 - S
+	ECMultiply(S, Z_Square_Q, Pointer_Point_Q->Z);
+	ECReduce(Pointer_Curve, S);
+	ECMultiply(S, S, Pointer_Point_P->Y);
+	ECReduce(Pointer_Curve, S);
+	ECMultiply(R, Z_Square_P, Pointer_Point_P->Z);
+	ECReduce(Pointer_Curve, R);
+	ECMultiply(R, R, Pointer_Point_Q->Y);
+	mpz_sub(R, R, S);
+	ECReduce(Pointer_Curve, R);
+	
+	// Same x coordinate : the points are equal or opposite
+	if (mpz_sgn(H) == 0)
+	{
+		if (mpz_sgn(R) == 0) Pointer_Curve->Function_Double_Jacobian(Pointer_Curve, Pointer_Point_P, Pointer_Temporary_Numbers);
+		else Pointer_Point_P->Is_Infinite = 1;
+		return;
+	}
+	
+	// Z3 = Z.Zq.H
+	ECMultiply(Pointer_Point_P->Z, Pointer_Point_P->Z, Pointer_Point_Q->Z);
+	ECReduce(Pointer_Curve, Pointer_Point_P->Z);
+	ECMultiply(Pointer_Point_P->Z, Pointer_Point_P->Z, H);
+	ECReduce(Pointer_Curve, Pointer_Point_P->Z);
+	
+	// The squares of the Z coordinates are not needed anymore, reuse them for H^2 and H^3
+	ECMultiply(Z_Square_P, H, H);
+	ECReduce(Pointer_Curve, Z_Square_P);
+	ECMultiply(Z_Square_Q, Z_Square_P, H);
+	ECReduce(Pointer_Curve, Z_Square_Q);
+	ECMultiply(U, U, Z_Square_P); // U.H^2
+	ECReduce(Pointer_Curve, U);
+	
+	// X3 = R^2 - H^3 - 2.U.H^2
+	ECMultiply(Pointer_Point_P->X, R, R);
+	mpz_sub(Pointer_Point_P->X, Pointer_Point_P->X, Z_Square_Q);
+	mpz_submul_ui(Pointer_Point_P->X, U, 2);
+	ECReduce(Pointer_Curve, Pointer_Point_P->X);
+	
+	// Y3 = R.(U.H^2 - X3) - S.H^3
+	ECMultiply(S, S, Z_Square_Q);
+	ECReduce(Pointer_Curve, S);
+	mpz_sub(U, U, Pointer_Point_P->X);
+	ECMultiply(Pointer_Point_P->Y, R, U);
+	mpz_sub(Pointer_Point_P->Y, Pointer_Point_P->Y, S);
+	ECReduce(Pointer_Curve, Pointer_Point_P->Y);
+}
+
+/** Extract a window of bits from a factor.
+ * @param Factor The factor, it must not be negative.
+ * @param Bit_Index The window least significant bit.
+ * @param Bits_Count The window size, it must be lower than the bits count of a limb.
+ * @return The window value.
+ */
+static inline int ECGetFactorWindow(mpz_t Factor, int Bit_Index, int Bits_Count)
+{
+	mp_limb_t Window;
+	int Limb_Index = Bit_Index / GMP_NUMB_BITS, Shift = Bit_Index % GMP_NUMB_BITS;
+	
+	// The window can overlap two limbs, mpz_getlimbn() returns 0 for the limbs above the number
+	Window = mpz_getlimbn(Factor, Limb_Index) >> Shift;
+	if (Shift + Bits_Count > GMP_NUMB_BITS) Window |= mpz_getlimbn(Factor, Limb_Index + 1) << (GMP_NUMB_BITS - Shift);
+	return (int) (Window & (((mp_limb_t) 1 << Bits_Count) - 1));
+}
+
+/** Multiply a point with a scalar value, keeping the result in Jacobian coordinates.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Pointer_Point The point to multiply.
+ * @param Factor The scalar value to multiply the point with.
+ * @param Pointer_Output_Point The result (it must be created and infinite).
+ * @param Pointer_Temporary_Numbers EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT temporary numbers.
+ */
+static void ECMultiplicationJacobian(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Factor, TECJacobianPoint *Pointer_Output_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	int Bits_Count, i;
+	
+	// Retrieve how many bits are used to store the factor number
+	Bits_Count = mpz_size(Factor) * mp_bits_per_limb;
+	
+	// Double-and-add starting from most significant bit to minimize computations, in Jacobian coordinates to avoid an inversion per operation
+	for (i = Bits_Count - 1; i >= 0; i--)
+	{
+		// Always double the point
+		Pointer_Curve->Function_Double_Jacobian(Pointer_Curve, Pointer_Output_Point, Pointer_Temporary_Numbers);
+		
+		// But add doubled values only when a factor bit is set
+		if (mpz_tstbit(Factor, i)) ECJacobianAddAffine(Pointer_Curve, Pointer_Output_Point, Pointer_Point, Pointer_Temporary_Numbers);
+	}
+}
+
+/** Multiply the curve generator with a scalar value using the generator table when it is available, keeping the result in Jacobian coordinates.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Factor The scalar value to multiply the generator with.
+ * @param Pointer_Output_Point The result (it must be created and infinite).
+ * @param Pointer_Temporary_Numbers EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT temporary numbers.
+ */
+static void ECMultiplicationGeneratorJacobian(TEllipticCurve *Pointer_Curve, mpz_t Factor, TECJacobianPoint *Pointer_Output_Point, mpz_t *Pointer_Temporary_Numbers)
+{
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	mpz_t Number_Factor;
+	int Digits_Count, i, j, Digit;
+	
+	if (Pointer_Table->Pointer_Points == NULL)
+	{
+		ECMultiplicationJacobian(Pointer_Curve, &Pointer_Curve->Point_Generator, Factor, Pointer_Output_Point, Pointer_Temporary_Numbers);
+		return;
+	}
+	
+	// G has order n, so the factor can be reduced to fit in the table windows
+	mpz_init(Number_Factor);
+	mpz_mod(Number_Factor, Factor, Pointer_Curve->n);
+	
+	// Sum the precomputed multiples of each window
+	Digits_Count = (1 << Pointer_Table->Window_Size) - 1;
+	for (i = 0; i < Pointer_Table->Windows_Count; i++)
+	{
+		// Extract the window value
+		Digit = 0;
+		for (j = Pointer_Table->Window_Size - 1; j >= 0; j--) Digit = (Digit << 1) | mpz_tstbit(Number_Factor, i * Pointer_Table->Window_Size + j);
+		
+		if (Digit != 0) ECJacobianAddAffine(Pointer_Curve, Pointer_Output_Point, &Pointer_Table->Pointer_Points[i * Digits_Count + Digit - 1], Pointer_Temporary_Numbers);
+	}
+	
+	mpz_clear(Number_Factor);
+}
+
+/** Get the generator table converted for the vectorized field arithmetic, converting it the first time. Several threads can call it at the same time, only one conversion is kept.
+ * @param Pointer_Curve The elliptic curve.
+ * @return The converted table or NULL if the curve has no generator table, if the field or the processor can't use the lanes or if there is not enough memory.
+ */
+static struct TECLanesGeneratorTable *ECGetLanesGeneratorTable(TEllipticCurve *Pointer_Curve)
+{
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	struct TECLanesGeneratorTable *Pointer_Lanes_Table, *Pointer_Published_Table = NULL;
+	TFieldLanesModulus Modulus;
+	TFieldLanesElement Element;
+	mpz_t Numbers[FIELD_LANES_COUNT];
+	size_t Coordinates_Size = 0;
+	int Points_Count, Is_Usable, i, j, Lane, Coordinate;
+	
+	Pointer_Lanes_Table = __atomic_load_n(&Pointer_Curve->Pointer_Lanes_Generator_Table, __ATOMIC_ACQUIRE);
+	if (Pointer_Lanes_Table != NULL) return Pointer_Lanes_Table->Is_Usable ? Pointer_Lanes_Table : NULL;
+	if (Pointer_Table->Pointer_Points == NULL) return NULL; // Don't remember this case, the table can be computed later
+	
+	// The portable lanes code is slower than GMP, so the lanes are only worth it with vector instructions
+	Points_Count = Pointer_Table->Windows_Count * ((1 << Pointer_Table->Window_Size) - 1);
+	Is_Usable = FieldLanesPrepareModulus(Pointer_Curve->p, 1, &Modulus) && Modulus.Is_Vectorized;
+	for (i = 0; i < Points_Count; i++)
+	{
+		if (Pointer_Table->Pointer_Points[i].Is_Infinite) Is_Usable = 0;
+	}
+	if (Is_Usable) Coordinates_Size = (size_t) Points_Count * 2 * FIELD_LANES_LIMBS_COUNT * sizeof(uint32_t);
+	
+	Pointer_Lanes_Table = malloc(sizeof(struct TECLanesGeneratorTable) + Coordinates_Size);
+	if (Pointer_Lanes_Table == NULL) return NULL;
+	Pointer_Lanes_Table->Modulus = Modulus;
+	Pointer_Lanes_Table->Is_Usable = Is_Usable;
+	
+	// Convert FIELD_LANES_COUNT coordinates at a time, the last group repeats the last point to fill the lanes
+	if (Is_Usable)
+	{
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) mpz_init(Numbers[Lane]);
+		for (i = 0; i < Points_Count; i += FIELD_LANES_COUNT)
+		{
+			for (Coordinate = 0; Coordinate < 2; Coordinate++)
+			{
+				for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+				{
+					j = (i + Lane < Points_Count) ? i + Lane : Points_Count - 1;
+					mpz_set(Numbers[Lane], Coordinate == 0 ? Pointer_Table->Pointer_Points[j].X : Pointer_Table->Pointer_Points[j].Y);
+				}
+				FieldLanesImport(&Modulus, Numbers, &Element);
+				for (Lane = 0; (Lane < FIELD_LANES_COUNT) && (i + Lane < Points_Count); Lane++) FieldLanesGetLane(&Element, Lane, &Pointer_Lanes_Table->Coordinates[((i + Lane) * 2 + Coordinate) * FIELD_LANES_LIMBS_COUNT]);
+			}
+		}
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) mpz_clear(Numbers[Lane]);
+	}
+	
+	// Another thread may have been faster
+	if (!__atomic_compare_exchange_n(&Pointer_Curve->Pointer_Lanes_Generator_Table, &Pointer_Published_Table, Pointer_Lanes_Table, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+	{
+		free(Pointer_Lanes_Table);
+		Pointer_Lanes_Table = Pointer_Published_Table;
+	}
+	return Pointer_Lanes_Table->Is_Usable ? Pointer_Lanes_Table : NULL;
+}
+
+/** Multiply the curve generator with FIELD_LANES_COUNT scalar values at once, each lane of the vectorized field arithmetic computing one multiplication.
+ * The lanes follow the same steps as ECMultiplicationGeneratorJacobian() : each window adds its table point with the mixed Jacobian-affine formulas
+ * Z2 = Z^2, H = xq.Z2 - X, R = yq.Z2.Z - Y, X3 = R^2 - H^3 - 2.X.H^2, Y3 = R.(X.H^2 - X3) - Y.H^3, Z3 = Z.H, then the lanes whose digit is zero get back their previous value.
+ * The factors are reduced modulo n, so the sum of the lower windows can never be the added point or its opposite and the formulas never need a doubling.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Pointer_Lanes_Table The converted generator table.
+ * @param Pointer_Factors FIELD_LANES_COUNT scalar values.
+ * @param Pointer_Output_Points FIELD_LANES_COUNT results (they must be created and infinite).
+ */
+static void ECMultiplicationGeneratorLanes(TEllipticCurve *Pointer_Curve, struct TECLanesGeneratorTable *Pointer_Lanes_Table, mpz_t *Pointer_Factors, TECJacobianPoint *Pointer_Output_Points)
+{
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	TFieldLanesModulus *Pointer_Modulus = &Pointer_Lanes_Table->Modulus;
+	TFieldLanesElement X, Y, Z, X_Previous, Y_Previous, Z_Previous, X_Point, Y_Point, Element_One, Element_Zero, Z_Square, H, R, H_Square, H_Cube, V, Temporary;
+	mpz_t Numbers_Factors[FIELD_LANES_COUNT], Numbers_Coordinates[FIELD_LANES_COUNT];
+	uint32_t *Pointer_Point_Coordinates;
+	int Digits[FIELD_LANES_COUNT], Is_Infinite[FIELD_LANES_COUNT], Digits_Count, Is_Window_Empty, i, j, Lane;
+	
+	// G has order n, so the factors can be reduced to fit in the table windows
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+	{
+		mpz_init(Numbers_Factors[Lane]);
+		mpz_init(Numbers_Coordinates[Lane]);
+		mpz_mod(Numbers_Factors[Lane], Pointer_Factors[Lane], Pointer_Curve->n);
+		FieldLanesSetLane(&Element_One, Lane, Pointer_Modulus->Montgomery_One);
+		Is_Infinite[Lane] = 1;
+	}
+	memset(&Element_Zero, 0, sizeof(Element_Zero));
+	X = Element_One;
+	Y = Element_One;
+	Z = Element_One;
+	
+	// Sum the precomputed multiples of each window
+	Digits_Count = (1 << Pointer_Table->Window_Size) - 1;
+	for (i = 0; i < Pointer_Table->Windows_Count; i++)
+	{
+		// Gather the table point of each lane (lanes with a zero digit compute with the first point of the window and drop the result)
+		Is_Window_Empty = 1;
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+		{
+			Digits[Lane] = 0;
+			for (j = Pointer_Table->Window_Size - 1; j >= 0; j--) Digits[Lane] = (Digits[Lane] << 1) | mpz_tstbit(Numbers_Factors[Lane], i * Pointer_Table->Window_Size + j);
+			if (Digits[Lane] != 0)
+			{
+				Is_Window_Empty = 0;
+				INSTRUMENTATION_COUNT(Point_Additions);
+			}
+			
+			Pointer_Point_Coordinates = &Pointer_Lanes_Table->Coordinates[(i * Digits_Count + (Digits[Lane] != 0 ? Digits[Lane] - 1 : 0)) * 2 * FIELD_LANES_LIMBS_COUNT];
+			FieldLanesSetLane(&X_Point, Lane, Pointer_Point_Coordinates);
+			FieldLanesSetLane(&Y_Point, Lane, Pointer_Point_Coordinates + FIELD_LANES_LIMBS_COUNT);
+		}
+		if (Is_Window_Empty) continue;
+		X_Previous = X;
+		Y_Previous = Y;
+		Z_Previous = Z;
+		
+		// H = xq.Z^2 - X and R = yq.Z^3 - Y
+		FieldLanesMultiply(Pointer_Modulus, &Z, &Z, &Z_Square);
+		FieldLanesMultiply(Pointer_Modulus, &X_Point, &Z_Square, &H);
+		FieldLanesSubtract(Pointer_Modulus, &H, &X, &H);
+		FieldLanesMultiply(Pointer_Modulus, &Z_Square, &Z, &R);
+		FieldLanesMultiply(Pointer_Modulus, &R, &Y_Point, &R);
+		FieldLanesSubtract(Pointer_Modulus, &R, &Y, &R);
+		
+		// Z3 = Z.H
+		FieldLanesMultiply(Pointer_Modulus, &Z, &H, &Z);
+		
+		// X3 = R^2 - H^3 - 2.V where V = X.H^2, X3 is reduced because it is subtracted below and at the next window
+		FieldLanesMultiply(Pointer_Modulus, &H, &H, &H_Square);
+		FieldLanesMultiply(Pointer_Modulus, &H_Square, &H, &H_Cube);
+		FieldLanesMultiply(Pointer_Modulus, &X, &H_Square, &V);
+		FieldLanesMultiply(Pointer_Modulus, &R, &R, &X);
+		FieldLanesSubtract(Pointer_Modulus, &X, &H_Cube, &X);
+		FieldLanesAdd(&V, &V, &Temporary);
+		FieldLanesSubtract(Pointer_Modulus, &X, &Temporary, &X);
+		FieldLanesMultiply(Pointer_Modulus, &X, &Element_One, &X);
+		
+		// Y3 = R.(V - X3) + Y.(-H^3)
+		FieldLanesSubtract(Pointer_Modulus, &V, &X, &V);
+		FieldLanesMultiply(Pointer_Modulus, &R, &V, &R);
+		FieldLanesSubtract(Pointer_Modulus, &Element_Zero, &H_Cube, &H_Cube);
+		FieldLanesMultiply(Pointer_Modulus, &Y, &H_Cube, &Y);
+		FieldLanesAdd(&R, &Y, &Y);
+		
+		// Keep the previous point when nothing was added, take the table point when adding to infinity
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+		{
+			if (Digits[Lane] == 0)
+			{
+				FieldLanesCopyLane(&X_Previous, &X, Lane);
+				FieldLanesCopyLane(&Y_Previous, &Y, Lane);
+				FieldLanesCopyLane(&Z_Previous, &Z, Lane);
+			}
+			else if (Is_Infinite[Lane])
+			{
+				FieldLanesCopyLane(&X_Point, &X, Lane);
+				FieldLanesCopyLane(&Y_Point, &Y, Lane);
+				FieldLanesCopyLane(&Element_One, &Z, Lane);
+				Is_Infinite[Lane] = 0;
+			}
+		}
+	}
+	
+	// Convert the coordinates back to GMP numbers
+	FieldLanesExport(Pointer_Modulus, &X, Numbers_Coordinates);
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) mpz_swap(Pointer_Output_Points[Lane].X, Numbers_Coordinates[Lane]);
+	FieldLanesExport(Pointer_Modulus, &Y, Numbers_Coordinates);
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) mpz_swap(Pointer_Output_Points[Lane].Y, Numbers_Coordinates[Lane]);
+	FieldLanesExport(Pointer_Modulus, &Z, Numbers_Coordinates);
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+	{
+		mpz_swap(Pointer_Output_Points[Lane].Z, Numbers_Coordinates[Lane]);
+		Pointer_Output_Points[Lane].Is_Infinite = Is_Infinite[Lane];
+		mpz_clear(Numbers_Factors[Lane]);
+		mpz_clear(Numbers_Coordinates[Lane]);
+	}
+}
+
+/** Add two points known by their projective X and Z coordinates when the X coordinate of their difference is known (differential addition).
+ * X3 = 2.(X1.Z2 + X2.Z1).(X1.X2 + a4.Z1.Z2) + 4.a6.(Z1.Z2)^2 - xd.(X1.Z2 - X2.Z1)^2, Z3 = (X1.Z2 - X2.Z1)^2.
+ * @param Pointer_Curve The elliptic curve.
+ * @param X1 First point X coordinate.
+ * @param Z1 First point Z coordinate.
+ * @param X2 Second point X coordinate, it contains the result X coordinate on output.
+ * @param Z2 Second point Z coordinate, it contains the result Z coordinate on output.
+ * @param X_Difference The affine X coordinate of the difference of the points.
+ * @param A6_Times_4 The value 4.a6 mod p.
+ * @param Pointer_Temporary_Numbers EC_X_ONLY_TEMPORARY_NUMBERS_COUNT initialized numbers.
+ */
+static inline void ECXOnlyAdd(TEllipticCurve *Pointer_Curve, mpz_t X1, mpz_t Z1, mpz_t X2, mpz_t Z2, mpz_t X_Difference, mpz_t A6_Times_4, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr X1_Z2 = Pointer_Temporary_Numbers[0], X2_Z1 = Pointer_Temporary_Numbers[1], X1_X2 = Pointer_Temporary_Numbers[2], Z1_Z2 = Pointer_Temporary_Numbers[3], Z3 = Pointer_Temporary_Numbers[4], Temp = Pointer_Temporary_Numbers[5];
+	
+	INSTRUMENTATION_COUNT(Point_Additions);
+	
+	ECMultiply(X1_Z2, X1, Z2);
+	ECReduce(Pointer_Curve, X1_Z2);
+	ECMultiply(X2_Z1, X2, Z1);
+	ECReduce(Pointer_Curve, X2_Z1);
+	ECMultiply(X1_X2, X1, X2);
+	ECReduce(Pointer_Curve, X1_X2);
+	ECMultiply(Z1_Z2, Z1, Z2);
+	ECReduce(Pointer_Curve, Z1_Z2);
+	
+	// Z3 = (X1.Z2 - X2.Z1)^2
+	mpz_sub(Z3, X1_Z2, X2_Z1);
+	ECMultiply(Z3, Z3, Z3);
+	ECReduce(Pointer_Curve, Z3);
+	
+	// 2.(X1.Z2 + X2.Z1).(X1.X2 + a4.Z1.Z2)
+	ECMultiply(Temp, Pointer_Curve->a4, Z1_Z2);
+	mpz_add(Temp, Temp, X1_X2);
+	ECReduce(Pointer_Curve, Temp);
+	mpz_add(X1_Z2, X1_Z2, X2_Z1);
+	ECMultiply(X1_Z2, X1_Z2, Temp);
+	ECReduce(Pointer_Curve, X1_Z2);
+	mpz_mul_2exp(X1_Z2, X1_Z2, 1);
+	
+	// 4.a6.(Z1.Z2)^2
+	ECMultiply(Z1_Z2, Z1_Z2, Z1_Z2);
+	ECReduce(Pointer_Curve, Z1_Z2);
+	ECMultiply(Z1_Z2, Z1_Z2, A6_Times_4);
+	ECReduce(Pointer_Curve, Z1_Z2);
+	
+	// X3
+	mpz_add(X2, X1_Z2, Z1_Z2);
+	mpz_submul(X2, X_Difference, Z3);
+	ECReduce(Pointer_Curve, X2);
+	mpz_swap(Z2, Z3);
+}
+
+/** Double a point known by its projective X and Z coordinates.
+ * X3 = (X^2 - a4.Z^2)^2 - 8.a6.X.Z^3, Z3 = 4.X.Z.(X^2 + a4.Z^2) + 4.a6.Z^4.
+ * @param Pointer_Curve The elliptic curve.
+ * @param X The point X coordinate, it contains the result X coordinate on output.
+ * @param Z The point Z coordinate, it contains the result Z coordinate on output.
+ * @param A6_Times_4 The value 4.a6 mod p.
+ * @param Pointer_Temporary_Numbers EC_X_ONLY_TEMPORARY_NUMBERS_COUNT initialized numbers.
+ */
+static inline void ECXOnlyDouble(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Z, mpz_t A6_Times_4, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr X_Square = Pointer_Temporary_Numbers[0], Z_Square = Pointer_Temporary_Numbers[1], A4_Z_Square = Pointer_Temporary_Numbers[2], Temp = Pointer_Temporary_Numbers[3], X_Z = Pointer_Temporary_Numbers[4], Temp_2 = Pointer_Temporary_Numbers[5];
+	
+	INSTRUMENTATION_COUNT(Point_Doublings);
+	
+	ECMultiply(X_Square, X, X);
+	ECReduce(Pointer_Curve, X_Square);
+	ECMultiply(Z_Square, Z, Z);
+	ECReduce(Pointer_Curve, Z_Square);
+	ECMultiply(A4_Z_Square, Pointer_Curve->a4, Z_Square);
+	ECReduce(Pointer_Curve, A4_Z_Square);
+	ECMultiply(X_Z, X, Z);
+	ECReduce(Pointer_Curve, X_Z);
+	
+	// X3 = (X^2 - a4.Z^2)^2 - 2.(4.a6).X.Z.Z^2
+	mpz_sub(Temp, X_Square, A4_Z_Square);
+	ECMultiply(Temp, Temp, Temp);
+	ECReduce(Pointer_Curve, Temp);
+	ECMultiply(Temp_2, X_Z, Z_Square);
+	ECReduce(Pointer_Curve, Temp_2);
+	ECMultiply(Temp_2, Temp_2, A6_Times_4);
+	ECReduce(Pointer_Curve, Temp_2);
+	mpz_submul_ui(Temp, Temp_2, 2);
+	ECReduce(Pointer_Curve, Temp);
+	mpz_swap(X, Temp);
+	
+	// Z3 = 4.X.Z.(X^2 + a4.Z^2) + (4.a6).Z^2.Z^2
+	mpz_add(X_Square, X_Square, A4_Z_Square);
+	ECMultiply(X_Square, X_Square, X_Z);
+	ECReduce(Pointer_Curve, X_Square);
+	ECMultiply(Z_Square, Z_Square, Z_Square);
+	ECReduce(Pointer_Curve, Z_Square);
+	ECMultiply(Z, Z_Square, A6_Times_4);
+	mpz_addmul_ui(Z, X_Square, 4);
+	ECReduce(Pointer_Curve, Z);
+}
+
 /** Add two points.
  * @param Pointer_Curve Elliptic curve.
  * @param Pointer_Point_P First point to add.
@@ -24,18 +978,16 @@ static inline void ECAdd(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P,
 	mpz_init(Result_Y);
 	
 	// Compute xr
-	mpz_mul(Result_X, Lambda, Lambda); // lambda^2
+	ECMultiply(Result_X, Lambda, Lambda); // lambda^2
 	mpz_sub(Result_X, Result_X, Pointer_Point_P->X); // lambda^2 - xp
 	mpz_sub(Result_X, Result_X, Pointer_Point_Q->X); // lambda^2 - xp - xq
-	mpz_mod(Result_X, Result_X, Pointer_Curve->p);
+	ECReduce(Pointer_Curve, Result_X);
 	
-	// Compute yr
-	mpz_neg(Temp, Lambda); // -lambda
-	mpz_mul(Temp, Temp, Result_X); // -lambda * xr
-	mpz_mul(Result_Y, Lambda, Pointer_Point_P->X); // lambda * xp
-	mpz_add(Result_Y, Temp, Result_Y); // (-lambda * xr) + (lambda * xp)
-	mpz_sub(Result_Y, Result_Y, Pointer_Point_P->Y); // (-lambda * xr) + (lambda * xp) - yp
-	mpz_mod(Result_Y, Result_Y, Pointer_Curve->p);
+	// Compute yr = (-lambda * xr) + (lambda * xp) - yp, factorized to keep the number small enough for the reduction
+	mpz_sub(Temp, Pointer_Point_P->X, Result_X); // xp - xr
+	ECMultiply(Result_Y, Lambda, Temp); // lambda * (xp - xr)
+	mpz_sub(Result_Y, Result_Y, Pointer_Point_P->Y); // lambda * (xp - xr) - yp
+	ECReduce(Pointer_Curve, Result_Y);
 	
 	// Set result
 	mpz_set(Pointer_Output_Point->X, Result_X);
@@ -61,24 +1013,26 @@ static inline void ECDouble(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point
 		return;
 	}	
 	
+	INSTRUMENTATION_COUNT(Point_Doublings);
 	mpz_init(Lambda);
 	mpz_init(Temp);
 	
 	// Compute lambda
 	// Compute numerator
-	mpz_mul(Lambda, Pointer_Point_P->X, Pointer_Point_P->X); // xp^2
+	ECMultiply(Lambda, Pointer_Point_P->X, Pointer_Point_P->X); // xp^2
 	mpz_mul_ui(Lambda, Lambda, 3); // 3*xp^2
 	mpz_add(Lambda, Lambda, Pointer_Curve->a4); // 3*xp^2 + a4
+	ECReduce(Pointer_Curve, Lambda);
 	
 	// Compute denominator
 	mpz_mul_ui(Temp, Pointer_Point_P->Y, 2);
 	// We can't compute integer division as it is not reliable, so invert denominator to compute a*b^-1 instead of a/b
-	mpz_invert(Temp, Temp, Pointer_Curve->p);
+	ECInvert(Pointer_Curve, Temp, Temp);
 	
 	// Compute "division"
-	mpz_mul(Lambda, Lambda, Temp);
+	ECMultiply(Lambda, Lambda, Temp);
 	// Compute remainder to stay on Fp
-	mpz_mod(Lambda, Lambda, Pointer_Curve->p);
+	ECReduce(Pointer_Curve, Lambda);
 	
 	// Double the point
 	ECAdd(Pointer_Curve, Pointer_Point_P, Pointer_Point_P, Lambda, Pointer_Output_Point);
@@ -101,87 +1055,647 @@ static inline void ECAddDifferentPoints(TEllipticCurve *Pointer_Curve, TPoint *P
 {
 	mpz_t Lambda, Temp;
 	
-	mpz_init(Lambda);
-	mpz_init(Temp);
+	INSTRUMENTATION_COUNT(Point_Additions);
+	mpz_init(Lambda);
+	mpz_init(Temp);
+	
+	// Compute lambda
+	// Compute numerator
+	mpz_sub(Lambda, Pointer_Point_P->Y, Pointer_Point_Q->Y); // yp - yq
+	
+	// Compute denominator
+	mpz_sub(Temp, Pointer_Point_P->X, Pointer_Point_Q->X); // xp - xq
+	// We can't compute integer division as it is not reliable, so invert denominator to compute a*b^-1 instead of a/b
+	ECInvert(Pointer_Curve, Temp, Temp);
+	
+	// Compute "division"
+	ECMultiply(Lambda, Lambda, Temp);
+	// Compute remainder to stay on Fp
+	ECReduce(Pointer_Curve, Lambda);
+	
+	// Add the two points
+	ECAdd(Pointer_Curve, Pointer_Point_P, Pointer_Point_Q, Lambda, Pointer_Output_Point);
+	
+	mpz_clear(Lambda);
+	mpz_clear(Temp);
+}
+
+/** Select one of two field elements without branching on the condition.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Output On output, contain the selected number (it can be one of the numbers).
+ * @param Number_If_False The number to select when the condition is zero, it must be in [0, p - 1].
+ * @param Number_If_True The number to select when the condition is not zero, it must be in [0, p - 1].
+ * @param Condition The condition.
+ */
+static void ECSelect(TEllipticCurve *Pointer_Curve, mpz_t Output, mpz_t Number_If_False, mpz_t Number_If_True, int Condition)
+{
+	mp_limb_t Limbs_False[MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT], Limbs_True[MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT], *Pointer_Limbs;
+	int Limbs_Count = Pointer_Curve->Field_Inversion.Number_Limbs_Count;
+	
+	// Pad both numbers to the field size and swap them if the condition is set
+	memset(Limbs_False, 0, sizeof(Limbs_False));
+	memset(Limbs_True, 0, sizeof(Limbs_True));
+	memcpy(Limbs_False, mpz_limbs_read(Number_If_False), mpz_size(Number_If_False) * sizeof(mp_limb_t));
+	memcpy(Limbs_True, mpz_limbs_read(Number_If_True), mpz_size(Number_If_True) * sizeof(mp_limb_t));
+	mpn_cnd_swap(Condition != 0, Limbs_False, Limbs_True, Limbs_Count);
+	
+	Pointer_Limbs = mpz_limbs_write(Output, Limbs_Count);
+	memcpy(Pointer_Limbs, Limbs_False, Limbs_Count * sizeof(mp_limb_t));
+	mpz_limbs_finish(Output, Limbs_Count);
+}
+
+/** Multiply two polynomials of degree 2 modulo p and modulo the monic polynomial x^3 + A.x + C.
+ * @param Pointer_Curve The elliptic curve.
+ * @param A The x coefficient of the modulus polynomial.
+ * @param C The constant coefficient of the modulus polynomial.
+ * @param Pointer_Polynomial_P The 3 coefficients of the first polynomial, constant coefficient first.
+ * @param Pointer_Polynomial_Q The 3 coefficients of the second polynomial.
+ * @param Pointer_Output_Polynomial On output, contain the 3 coefficients of the product (it can be one of the polynomials).
+ * @param Pointer_Temporary_Numbers 6 initialized numbers.
+ */
+static void ECMapToCurveMultiplyPolynomials(TEllipticCurve *Pointer_Curve, mpz_t A, mpz_t C, mpz_t *Pointer_Polynomial_P, mpz_t *Pointer_Polynomial_Q, mpz_t *Pointer_Output_Polynomial, mpz_t *Pointer_Temporary_Numbers)
+{
+	int i, j;
+	
+	// Schoolbook product of degree 4
+	for (i = 0; i < 5; i++) mpz_set_ui(Pointer_Temporary_Numbers[i], 0);
+	for (i = 0; i < 3; i++)
+	{
+		for (j = 0; j < 3; j++) mpz_addmul(Pointer_Temporary_Numbers[i + j], Pointer_Polynomial_P[i], Pointer_Polynomial_Q[j]);
+	}
+	for (i = 0; i < 5; i++) mpz_mod(Pointer_Temporary_Numbers[i], Pointer_Temporary_Numbers[i], Pointer_Curve->p);
+	
+	// Replace x^4 with -A.x^2 - C.x, then x^3 with -A.x - C
+	for (i = 4; i >= 3; i--)
+	{
+		mpz_submul(Pointer_Temporary_Numbers[i - 2], A, Pointer_Temporary_Numbers[i]);
+		mpz_submul(Pointer_Temporary_Numbers[i - 3], C, Pointer_Temporary_Numbers[i]);
+		mpz_mod(Pointer_Temporary_Numbers[i - 2], Pointer_Temporary_Numbers[i - 2], Pointer_Curve->p);
+		mpz_mod(Pointer_Temporary_Numbers[i - 3], Pointer_Temporary_Numbers[i - 3], Pointer_Curve->p);
+	}
+	for (i = 0; i < 3; i++) mpz_set(Pointer_Output_Polynomial[i], Pointer_Temporary_Numbers[i]);
+}
+
+/** Tell if the polynomial x^3 + A.x + C is irreducible modulo p. A cubic polynomial is irreducible when it has no root, that is when it is coprime with x^p - x.
+ * @param Pointer_Curve The elliptic curve.
+ * @param A The x coefficient of the polynomial.
+ * @param C The constant coefficient of the polynomial.
+ * @return 1 if the polynomial is irreducible or 0 otherwise.
+ */
+static int ECMapToCurveIsCubicIrreducible(TEllipticCurve *Pointer_Curve, mpz_t A, mpz_t C)
+{
+	mpz_t Polynomial_Power[4], Polynomial_X[3], Polynomial_Cubic[4], Temporary_Numbers[6], *Pointer_Polynomial_A, *Pointer_Polynomial_B, *Pointer_Polynomial_Swap;
+	int i, Degree_A, Degree_B, Degree_Swap;
+	
+	for (i = 0; i < 4; i++)
+	{
+		mpz_init(Polynomial_Power[i]);
+		mpz_init(Polynomial_Cubic[i]);
+	}
+	for (i = 0; i < 3; i++) mpz_init(Polynomial_X[i]);
+	for (i = 0; i < 6; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// Compute x^p modulo the cubic polynomial with a left to right binary exponentiation
+	mpz_set_ui(Polynomial_Power[0], 1);
+	mpz_set_ui(Polynomial_X[1], 1);
+	for (i = mpz_sizeinbase(Pointer_Curve->p, 2) - 1; i >= 0; i--)
+	{
+		ECMapToCurveMultiplyPolynomials(Pointer_Curve, A, C, Polynomial_Power, Polynomial_Power, Polynomial_Power, Temporary_Numbers);
+		if (mpz_tstbit(Pointer_Curve->p, i)) ECMapToCurveMultiplyPolynomials(Pointer_Curve, A, C, Polynomial_Power, Polynomial_X, Polynomial_Power, Temporary_Numbers);
+	}
+	mpz_sub_ui(Polynomial_Power[1], Polynomial_Power[1], 1);
+	mpz_mod(Polynomial_Power[1], Polynomial_Power[1], Pointer_Curve->p);
+	
+	// Euclid algorithm between the cubic polynomial and x^p - x
+	mpz_set_ui(Polynomial_Cubic[3], 1);
+	mpz_mod(Polynomial_Cubic[1], A, Pointer_Curve->p);
+	mpz_mod(Polynomial_Cubic[0], C, Pointer_Curve->p);
+	Pointer_Polynomial_A = Polynomial_Cubic;
+	Degree_A = 3;
+	Pointer_Polynomial_B = Polynomial_Power;
+	Degree_B = 2;
+	while ((Degree_B >= 0) && (mpz_sgn(Pointer_Polynomial_B[Degree_B]) == 0)) Degree_B--;
+	while (Degree_B >= 0)
+	{
+		// A = A mod B
+		mpz_invert(Temporary_Numbers[0], Pointer_Polynomial_B[Degree_B], Pointer_Curve->p);
+		while (Degree_A >= Degree_B)
+		{
+			mpz_mul(Temporary_Numbers[1], Pointer_Polynomial_A[Degree_A], Temporary_Numbers[0]);
+			mpz_mod(Temporary_Numbers[1], Temporary_Numbers[1], Pointer_Curve->p);
+			for (i = 0; i <= Degree_B; i++)
+			{
+				mpz_submul(Pointer_Polynomial_A[Degree_A - Degree_B + i], Temporary_Numbers[1], Pointer_Polynomial_B[i]);
+				mpz_mod(Pointer_Polynomial_A[Degree_A - Degree_B + i], Pointer_Polynomial_A[Degree_A - Degree_B + i], Pointer_Curve->p);
+			}
+			while ((Degree_A >= 0) && (mpz_sgn(Pointer_Polynomial_A[Degree_A]) == 0)) Degree_A--;
+		}
+		
+		// Continue with (B, A mod B)
+		Pointer_Polynomial_Swap = Pointer_Polynomial_A;
+		Pointer_Polynomial_A = Pointer_Polynomial_B;
+		Pointer_Polynomial_B = Pointer_Polynomial_Swap;
+		Degree_Swap = Degree_A;
+		Degree_A = Degree_B;
+		Degree_B = Degree_Swap;
+	}
+	
+	for (i = 0; i < 4; i++)
+	{
+		mpz_clear(Polynomial_Power[i]);
+		mpz_clear(Polynomial_Cubic[i]);
+	}
+	for (i = 0; i < 3; i++) mpz_clear(Polynomial_X[i]);
+	for (i = 0; i < 6; i++) mpz_clear(Temporary_Numbers[i]);
+	
+	// The gcd is a non-zero constant (if x^p - x is zero modulo the cubic polynomial, the gcd is the cubic polynomial itself)
+	return Degree_A == 0;
+}
+
+/** Find the Z constant of the map with the RFC 9380 appendix H.2 method : Z is the first of 1, -1, 2, -2... that is not a square, is not -1, makes g(x) - Z irreducible and makes
+ * g(B / (Z.A)) a square, where g(x) = x^3 + A.x + B.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Map The map, A and B must be set. On output, Z is set.
+ * @return 1 if Z was found or 0 otherwise.
+ */
+static int ECMapToCurveFindZ(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map)
+{
+	mpz_t Number_Temp, Number_X;
+	int i, Is_Found = 0;
+	
+	mpz_init(Number_Temp);
+	mpz_init(Number_X);
+	
+	for (i = 2; (i <= 2 * EC_MAP_TO_CURVE_MAXIMUM_Z_CANDIDATES + 1) && (mpz_cmp_ui(Pointer_Curve->p, i / 2) > 0); i++)
+	{
+		if (i % 2 == 0) mpz_set_ui(Pointer_Map->Z, i / 2);
+		else mpz_sub_ui(Pointer_Map->Z, Pointer_Curve->p, i / 2);
+		
+		// Z must not be a square and must not be -1
+		if (mpz_legendre(Pointer_Map->Z, Pointer_Curve->p) != -1) continue;
+		mpz_add_ui(Number_Temp, Pointer_Map->Z, 1);
+		if (mpz_cmp(Number_Temp, Pointer_Curve->p) == 0) continue;
+		
+		// g(B / (Z.A)) must be a square
+		mpz_mul(Number_X, Pointer_Map->Z, Pointer_Map->A);
+		ECReduce(Pointer_Curve, Number_X);
+		ECInvert(Pointer_Curve, Number_X, Number_X);
+		ECMultiply(Number_X, Number_X, Pointer_Map->B);
+		ECReduce(Pointer_Curve, Number_X);
+		ECMultiply(Number_Temp, Number_X, Number_X);
+		mpz_add(Number_Temp, Number_Temp, Pointer_Map->A);
+		ECReduce(Pointer_Curve, Number_Temp);
+		ECMultiply(Number_Temp, Number_Temp, Number_X);
+		mpz_add(Number_Temp, Number_Temp, Pointer_Map->B);
+		ECReduce(Pointer_Curve, Number_Temp);
+		if (mpz_legendre(Number_Temp, Pointer_Curve->p) == -1) continue;
+		
+		// x^3 + A.x + B - Z must be irreducible
+		mpz_sub(Number_Temp, Pointer_Map->B, Pointer_Map->Z);
+		if (!ECMapToCurveIsCubicIrreducible(Pointer_Curve, Pointer_Map->A, Number_Temp)) continue;
+		
+		Is_Found = 1;
+		break;
+	}
+	
+	mpz_clear(Number_Temp);
+	mpz_clear(Number_X);
+	return Is_Found;
+}
+
+/** Compute sqrt(U / V) if U / V is a square or sqrt(Z.U / V) otherwise, with a single exponentiation (RFC 9380 appendix F.2.1).
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Map The map constants.
+ * @param U The numerator, in [0, p - 1].
+ * @param V The denominator, in [1, p - 1].
+ * @param Output_Root On output, contain the square root.
+ * @param Pointer_Temporary_Numbers 5 initialized numbers.
+ * @return 1 if U / V is a square or 0 otherwise.
+ */
+static int ECMapToCurveSquareRootRatio(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map, mpz_t U, mpz_t V, mpz_t Output_Root, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_t *Tv1 = &Pointer_Temporary_Numbers[0], *Tv2 = &Pointer_Temporary_Numbers[1], *Tv3 = &Pointer_Temporary_Numbers[2], *Tv4 = &Pointer_Temporary_Numbers[3], *Tv5 = &Pointer_Temporary_Numbers[4];
+	int i, j, Is_Square, Is_One;
+	
+	// p = 3 mod 4 : y1 = (u.v)(u.v^3)^((p - 3) / 4) is sqrt(u / v) when it is a square, otherwise y1.sqrt(-Z) is sqrt(Z.u / v)
+	if (Pointer_Map->Two_Adicity == 1)
+	{
+		ECMultiply(*Tv1, V, V);
+		ECReduce(Pointer_Curve, *Tv1);
+		ECMultiply(*Tv2, U, V);
+		ECReduce(Pointer_Curve, *Tv2);
+		ECMultiply(*Tv1, *Tv1, *Tv2);
+		ECReduce(Pointer_Curve, *Tv1);
+		mpz_powm_sec(*Tv3, *Tv1, Pointer_Map->Square_Root_Exponent, Pointer_Curve->p);
+		ECMultiply(*Tv3, *Tv3, *Tv2);
+		ECReduce(Pointer_Curve, *Tv3);
+		ECMultiply(*Tv4, *Tv3, Pointer_Map->Square_Root_Constant);
+		ECReduce(Pointer_Curve, *Tv4);
+		ECMultiply(*Tv5, *Tv3, *Tv3);
+		ECReduce(Pointer_Curve, *Tv5);
+		ECMultiply(*Tv5, *Tv5, V);
+		ECReduce(Pointer_Curve, *Tv5);
+		Is_Square = mpz_cmp(*Tv5, U) == 0;
+		ECSelect(Pointer_Curve, Output_Root, *Tv4, *Tv3, Is_Square);
+		return Is_Square;
+	}
+	
+	// Otherwise use the Sarkar variant of the Tonelli-Shanks algorithm, the loop length only depends on p
+	mpz_set(*Tv1, Pointer_Map->Square_Root_Constant);
+	mpz_powm_sec(*Tv2, V, Pointer_Map->Square_Root_Small_Exponent, Pointer_Curve->p);
+	ECMultiply(*Tv3, *Tv2, *Tv2);
+	ECReduce(Pointer_Curve, *Tv3);
+	ECMultiply(*Tv3, *Tv3, V);
+	ECReduce(Pointer_Curve, *Tv3);
+	ECMultiply(*Tv5, U, *Tv3);
+	ECReduce(Pointer_Curve, *Tv5);
+	mpz_powm_sec(*Tv5, *Tv5, Pointer_Map->Square_Root_Exponent, Pointer_Curve->p);
+	ECMultiply(*Tv5, *Tv5, *Tv2);
+	ECReduce(Pointer_Curve, *Tv5);
+	ECMultiply(*Tv2, *Tv5, V);
+	ECReduce(Pointer_Curve, *Tv2);
+	ECMultiply(*Tv3, *Tv5, U);
+	ECReduce(Pointer_Curve, *Tv3);
+	ECMultiply(*Tv4, *Tv3, *Tv2);
+	ECReduce(Pointer_Curve, *Tv4);
+	mpz_set(*Tv5, *Tv4);
+	for (i = 1; i < Pointer_Map->Two_Adicity; i++)
+	{
+		ECMultiply(*Tv5, *Tv5, *Tv5);
+		ECReduce(Pointer_Curve, *Tv5);
+	}
+	Is_Square = mpz_cmp_ui(*Tv5, 1) == 0;
+	ECMultiply(*Tv2, *Tv3, Pointer_Map->Square_Root_Constant_2);
+	ECReduce(Pointer_Curve, *Tv2);
+	ECMultiply(*Tv5, *Tv4, *Tv1);
+	ECReduce(Pointer_Curve, *Tv5);
+	ECSelect(Pointer_Curve, *Tv3, *Tv2, *Tv3, Is_Square);
+	ECSelect(Pointer_Curve, *Tv4, *Tv5, *Tv4, Is_Square);
+	
+	for (i = Pointer_Map->Two_Adicity; i >= 2; i--)
+	{
+		mpz_set(*Tv5, *Tv4);
+		for (j = 0; j < i - 2; j++)
+		{
+			ECMultiply(*Tv5, *Tv5, *Tv5);
+			ECReduce(Pointer_Curve, *Tv5);
+		}
+		Is_One = mpz_cmp_ui(*Tv5, 1) == 0;
+		ECMultiply(*Tv2, *Tv3, *Tv1);
+		ECReduce(Pointer_Curve, *Tv2);
+		ECMultiply(*Tv1, *Tv1, *Tv1);
+		ECReduce(Pointer_Curve, *Tv1);
+		ECMultiply(*Tv5, *Tv4, *Tv1);
+		ECReduce(Pointer_Curve, *Tv5);
+		ECSelect(Pointer_Curve, *Tv3, *Tv2, *Tv3, Is_One);
+		ECSelect(Pointer_Curve, *Tv4, *Tv5, *Tv4, Is_One);
+	}
+	mpz_set(Output_Root, *Tv3);
+	return Is_Square;
+}
+
+/** Expand a message to pseudo-random bytes with the library hash (RFC 9380 section 5.3.1 expand_message_xmd).
+ * @param Pointer_Data The message.
+ * @param Data_Size The message size in bytes.
+ * @param Pointer_Output_Bytes On output, contain the bytes.
+ * @param Output_Size How many bytes to generate (at most 255 hashes).
+ * @return 1 if the bytes were generated or 0 if an error occurred.
+ */
+static int ECMapToCurveExpandMessage(unsigned char *Pointer_Data, size_t Data_Size, unsigned char *Pointer_Output_Bytes, int Output_Size)
+{
+	unsigned char *Pointer_Buffer, Hash_0[UTILS_HASH_LENGTH], Hash[UTILS_HASH_LENGTH], Block[UTILS_HASH_LENGTH + sizeof(EC_MAP_TO_CURVE_DOMAIN_SEPARATION_TAG) + 1];
+	int i, j, Tag_Size = sizeof(EC_MAP_TO_CURVE_DOMAIN_SEPARATION_TAG) - 1, Is_Hashed;
+	size_t Size;
+	
+	// b0 = H(zeros block || message || output size on 2 bytes || 0 || tag || tag size)
+	Pointer_Buffer = malloc(EC_MAP_TO_CURVE_HASH_BLOCK_SIZE + Data_Size + 3 + Tag_Size + 1);
+	if (Pointer_Buffer == NULL) return 0;
+	memset(Pointer_Buffer, 0, EC_MAP_TO_CURVE_HASH_BLOCK_SIZE);
+	memcpy(Pointer_Buffer + EC_MAP_TO_CURVE_HASH_BLOCK_SIZE, Pointer_Data, Data_Size);
+	Size = EC_MAP_TO_CURVE_HASH_BLOCK_SIZE + Data_Size;
+	Pointer_Buffer[Size++] = (unsigned char) (Output_Size >> 8);
+	Pointer_Buffer[Size++] = (unsigned char) Output_Size;
+	Pointer_Buffer[Size++] = 0;
+	memcpy(Pointer_Buffer + Size, EC_MAP_TO_CURVE_DOMAIN_SEPARATION_TAG, Tag_Size);
+	Size += Tag_Size;
+	Pointer_Buffer[Size++] = (unsigned char) Tag_Size;
+	Is_Hashed = UtilsComputeHash(Pointer_Buffer, Size, Hash_0);
+	free(Pointer_Buffer);
+	if (!Is_Hashed) return 0;
+	
+	// bi = H((b0 xor b(i-1)) || i || tag || tag size), starting from an all zeros b(i-1) so b1 = H(b0 || 1 || tag || tag size)
+	memset(Hash, 0, sizeof(Hash));
+	memcpy(Block + UTILS_HASH_LENGTH + 1, EC_MAP_TO_CURVE_DOMAIN_SEPARATION_TAG, Tag_Size);
+	Block[UTILS_HASH_LENGTH + 1 + Tag_Size] = (unsigned char) Tag_Size;
+	for (i = 1; Output_Size > 0; i++)
+	{
+		for (j = 0; j < UTILS_HASH_LENGTH; j++) Block[j] = Hash_0[j] ^ Hash[j];
+		Block[UTILS_HASH_LENGTH] = (unsigned char) i;
+		if (!UtilsComputeHash(Block, sizeof(Block), Hash)) return 0;
+		
+		Size = Output_Size < UTILS_HASH_LENGTH ? Output_Size : UTILS_HASH_LENGTH;
+		memcpy(Pointer_Output_Bytes, Hash, Size);
+		Pointer_Output_Bytes += Size;
+		Output_Size -= Size;
+	}
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ECLoadFromFile(char *String_Path, TEllipticCurve *Pointer_Curve)
+{
+	FILE *File;
+	char String_Line[EC_MAXIMUM_FILE_LINE_SIZE], *String_Value;
+	int Found_Values = 0, Model_Values, Is_Model_Known = 1, i;
+	mpz_t Number_Value, Number_Temp;
+	char *String_Value_Names[EC_FILE_VALUES_COUNT] = {"p", "n", "a4", "a6", "h", "gx", "gy", "a", "d", "A", "B"};
+	mpz_ptr Pointer_Value_Destinations[EC_FILE_VALUES_COUNT] = {Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->h, Pointer_Curve->Point_Generator.X, Pointer_Curve->Point_Generator.Y, Pointer_Curve->Model_A, Pointer_Curve->Model_B, Pointer_Curve->Model_A, Pointer_Curve->Model_B};
+	
+	File = fopen(String_Path, "r");
+	if (File == NULL) return 0;
+	
+	// Binary files are mapped instead of being parsed
+	if (ECIsBinaryFile(File))
+	{
+		fclose(File);
+		return ECLoadFromBinaryFile(String_Path, Pointer_Curve);
+	}
+	rewind(File);
+	
+	// Initialize curve members
+	mpz_init(Pointer_Curve->p);
+	mpz_init(Pointer_Curve->n);
+	mpz_init(Pointer_Curve->a4);
+	mpz_init(Pointer_Curve->a6);
+	mpz_init(Pointer_Curve->h);
+	mpz_init(Pointer_Curve->Point_Generator.X);
+	mpz_init(Pointer_Curve->Point_Generator.Y);
+	mpz_init(Pointer_Curve->Model_A);
+	mpz_init(Pointer_Curve->Model_B);
+	Pointer_Curve->Point_Generator.Is_Infinite = 0;
+	Pointer_Curve->Generator_Table.Pointer_Points = NULL;
+	Pointer_Curve->Pointer_Lanes_Generator_Table = NULL;
+	Pointer_Curve->Is_Read_Only = 0;
+	Pointer_Curve->Pointer_Mapped_File = NULL;
+	Pointer_Curve->Model = EC_MODEL_WEIERSTRASS;
+	mpz_init(Number_Value);
+	
+	// Load values, lines which are not understood (like r4 and r6) are bypassed
+	while (fgets(String_Line, sizeof(String_Line), File) != NULL)
+	{
+		// Split the "name=value" line
+		String_Value = strchr(String_Line, '=');
+		if (String_Value == NULL) continue;
+		*String_Value = 0;
+		String_Value++;
+		String_Value[strcspn(String_Value, "\r\n")] = 0;
+		
+		// The model is the only value which is not a number
+		if (strcmp(String_Line, "model") == 0)
+		{
+			if (strcmp(String_Value, "edwards") == 0) Pointer_Curve->Model = EC_MODEL_TWISTED_EDWARDS;
+			else if (strcmp(String_Value, "montgomery") == 0) Pointer_Curve->Model = EC_MODEL_MONTGOMERY;
+			else if (strcmp(String_Value, "weierstrass") != 0) Is_Model_Known = 0;
+			continue;
+		}
+		if (mpz_set_str(Number_Value, String_Value, 10) != 0) continue;
+		
+		// Store the value
+		for (i = 0; i < EC_FILE_VALUES_COUNT; i++)
+		{
+			if (strcmp(String_Line, String_Value_Names[i]) == 0)
+			{
+				mpz_set(Pointer_Value_Destinations[i], Number_Value);
+				Found_Values |= 1 << i;
+				break;
+			}
+		}
+	}
+	fclose(File);
+	mpz_clear(Number_Value);
+	
+	// All mandatory values must be present
+	if (Pointer_Curve->Model == EC_MODEL_TWISTED_EDWARDS) Model_Values = EC_FILE_TWISTED_EDWARDS_VALUES;
+	else if (Pointer_Curve->Model == EC_MODEL_MONTGOMERY) Model_Values = EC_FILE_MONTGOMERY_VALUES;
+	else Model_Values = EC_FILE_WEIERSTRASS_VALUES;
+	if (!Is_Model_Known || ((Found_Values & (EC_FILE_MANDATORY_VALUES | Model_Values)) != (EC_FILE_MANDATORY_VALUES | Model_Values)))
+	{
+		ECFree(Pointer_Curve);
+		return 0;
+	}
+	
+	// Get the Weierstrass form of the other models
+	if ((Pointer_Curve->Model != EC_MODEL_WEIERSTRASS) && !ECModelsConvertCurveToWeierstrass(Pointer_Curve))
+	{
+		ECFree(Pointer_Curve);
+		return 0;
+	}
+	
+	// Compute the cofactor if the file does not provide it
+	if (!(Found_Values & EC_FILE_VALUE_H))
+	{
+		// Hasse theorem tells that the curve order is in [p + 1 - 2.sqrt(p); p + 1 + 2.sqrt(p)], so when n > 4.sqrt(p) only one multiple of n lies in this interval : h = round((p + 1) / n)
+		mpz_init(Number_Temp);
+		mpz_mul(Number_Temp, Pointer_Curve->n, Pointer_Curve->n);
+		mpz_tdiv_q_2exp(Number_Temp, Number_Temp, 4); // n^2 / 16
+		if (mpz_cmp(Number_Temp, Pointer_Curve->p) > 0)
+		{
+			mpz_add_ui(Number_Temp, Pointer_Curve->p, 1);
+			mpz_mul_2exp(Number_Temp, Number_Temp, 1); // 2.(p + 1)
+			mpz_add(Number_Temp, Number_Temp, Pointer_Curve->n); // 2.(p + 1) + n
+			mpz_mul_2exp(Pointer_Curve->h, Pointer_Curve->n, 1);
+			mpz_fdiv_q(Pointer_Curve->h, Number_Temp, Pointer_Curve->h); // (2.(p + 1) + n) / 2.n
+		}
+		// Otherwise the cofactor is unknown and stays 0
+		mpz_clear(Number_Temp);
+	}
+	
+	// Speed up the field and the generator operations
+	if (!ECSelectArithmetic(Pointer_Curve) || !ECPrecomputeGeneratorTable(Pointer_Curve))
+	{
+		ECFree(Pointer_Curve);
+		return 0;
+	}
+	
+	return 1;
+}
+
+void ECFree(TEllipticCurve *Pointer_Curve)
+{
+	int i, Points_Count;
+	
+	if (Pointer_Curve->Generator_Table.Pointer_Points != NULL)
+	{
+		// Mapped points are read-only views of the mapping, they must not be cleared
+		if (!Pointer_Curve->Generator_Table.Is_Read_Only)
+		{
+			Points_Count = Pointer_Curve->Generator_Table.Windows_Count * ((1 << Pointer_Curve->Generator_Table.Window_Size) - 1);
+			for (i = 0; i < Points_Count; i++) PointFree(&Pointer_Curve->Generator_Table.Pointer_Points[i]);
+		}
+		free(Pointer_Curve->Generator_Table.Pointer_Points);
+		Pointer_Curve->Generator_Table.Pointer_Points = NULL;
+	}
+	free(Pointer_Curve->Pointer_Lanes_Generator_Table);
+	Pointer_Curve->Pointer_Lanes_Generator_Table = NULL;
+	
+	// Same thing for the numbers of a mapped or built-in curve
+	if (Pointer_Curve->Is_Read_Only)
+	{
+		if (Pointer_Curve->Pointer_Mapped_File != NULL) munmap(Pointer_Curve->Pointer_Mapped_File, Pointer_Curve->Mapped_File_Size);
+		Pointer_Curve->Pointer_Mapped_File = NULL;
+		return;
+	}
+	
+	mpz_clear(Pointer_Curve->p);
+	mpz_clear(Pointer_Curve->n);
+	mpz_clear(Pointer_Curve->a4);
+	mpz_clear(Pointer_Curve->a6);
+	mpz_clear(Pointer_Curve->h);
+	mpz_clear(Pointer_Curve->Model_A);
+	mpz_clear(Pointer_Curve->Model_B);
+	PointFree(&Pointer_Curve->Point_Generator);
+}
+
+int ECSelectArithmetic(TEllipticCurve *Pointer_Curve)
+{
+	mpz_t Number_Constant;
+	int Bits_Count;
+	
+	Pointer_Curve->Function_Reduce = ECReduceGeneric;
+	Pointer_Curve->Pointer_Lanes_Generator_Table = NULL; // Built on first use
 	
-	// Compute lambda
-	// Compute numerator
-	mpz_sub(Lambda, Pointer_Point_P->Y, Pointer_Point_Q->Y); // yp - yq
+	// Is p = 2^k - c with c fitting in a limb and small enough for the folding to converge quickly ?
+	mpz_init(Number_Constant);
+	Bits_Count = mpz_sizeinbase(Pointer_Curve->p, 2);
+	mpz_setbit(Number_Constant, Bits_Count);
+	mpz_sub(Number_Constant, Number_Constant, Pointer_Curve->p);
+	if ((mpz_cmp_ui(Number_Constant, 0) > 0) && mpz_fits_ulong_p(Number_Constant) && (mpz_sizeinbase(Number_Constant, 2) <= GMP_NUMB_BITS) && (2 * mpz_sizeinbase(Number_Constant, 2) <= (size_t) Bits_Count))
+	{
+		Pointer_Curve->Function_Reduce = ECReducePseudoMersenne;
+		Pointer_Curve->Reduction_Bits_Count = Bits_Count;
+		Pointer_Curve->Reduction_Constant = mpz_get_ui(Number_Constant);
+	}
+	// Is p the P-256 Solinas prime ?
+	else
+	{
+		mpz_set_str(Number_Constant, EC_P256_PRIME, 16);
+		if ((mpz_cmp(Number_Constant, Pointer_Curve->p) == 0) && (GMP_NUMB_BITS % 32 == 0)) Pointer_Curve->Function_Reduce = ECReduceP256;
+	}
 	
-	// Compute denominator
-	mpz_sub(Temp, Pointer_Point_P->X, Pointer_Point_Q->X); // xp - xq
-	// We can't compute integer division as it is not reliable, so invert denominator to compute a*b^-1 instead of a/b
-	mpz_invert(Temp, Temp, Pointer_Curve->p);
+	// Is a4 = 0 or a4 = -3 ?
+	mpz_add_ui(Number_Constant, Pointer_Curve->a4, 3);
+	if (mpz_sgn(Pointer_Curve->a4) == 0) Pointer_Curve->Function_Double_Jacobian = ECJacobianDoubleA4Zero;
+	else if ((mpz_cmp(Number_Constant, Pointer_Curve->p) == 0) || (mpz_sgn(Number_Constant) == 0)) Pointer_Curve->Function_Double_Jacobian = ECJacobianDoubleA4MinusThree;
+	else Pointer_Curve->Function_Double_Jacobian = ECJacobianDoubleGeneric;
 	
-	// Compute "division"
-	mpz_mul(Lambda, Lambda, Temp);
-	// Compute remainder to stay on Fp
-	mpz_mod(Lambda, Lambda, Pointer_Curve->p);
-		
-	// Add the two points
-	ECAdd(Pointer_Curve, Pointer_Point_P, Pointer_Point_Q, Lambda, Pointer_Output_Point);
+	mpz_clear(Number_Constant);
 	
-	mpz_clear(Lambda);
-	mpz_clear(Temp);
+	if (!ModularInversionPrepare(Pointer_Curve->p, &Pointer_Curve->Field_Inversion)) return 0;
+	Pointer_Curve->Field_Inversion_Method = Pointer_Curve->Field_Inversion.Is_Safegcd_Available ? MODULAR_INVERSION_METHOD_SAFEGCD : MODULAR_INVERSION_METHOD_FERMAT;
+	return ScalarFieldPrepare(Pointer_Curve->n, &Pointer_Curve->Scalar_Field);
 }
 
-//-------------------------------------------------------------------------------------------------------------------------------------------------------------
-// Public functions
-//-------------------------------------------------------------------------------------------------------------------------------------------------------------
-int ECLoadFromFile(char *String_Path, TEllipticCurve *Pointer_Curve)
+void ECSelectFastestInversions(TEllipticCurve *Pointer_Curve)
 {
-	FILE *File;
+	TScalarField *Pointer_Field = &Pointer_Curve->Scalar_Field;
+	TScalar Scalar;
+	mpz_t Number;
+	long long Time, Field_Best_Time = -1, Scalar_Best_Time = -1;
+	int Method, Field_Best_Method = Pointer_Curve->Field_Inversion_Method, Scalar_Best_Method = Pointer_Field->Inversion_Method, i;
 	
-	File = fopen(String_Path, "r");
-	if (File == NULL) return 0;
+	mpz_init(Number);
+	for (Method = 0; Method < MODULAR_INVERSION_METHODS_COUNT; Method++)
+	{
+		// The inverted numbers alternate between the generator X coordinate and its inverse
+		if (ModularInversionIsMethodUsable(&Pointer_Curve->Field_Inversion, Method))
+		{
+			mpz_set(Number, Pointer_Curve->Point_Generator.X);
+			Time = UtilsGetTime();
+			for (i = 0; i < EC_INVERSION_BENCHMARK_ITERATIONS_COUNT; i++) ModularInversionInvertNumber(&Pointer_Curve->Field_Inversion, Method, Number, Number);
+			Time = UtilsGetTime() - Time;
+			if ((Field_Best_Time < 0) || (Time < Field_Best_Time))
+			{
+				Field_Best_Time = Time;
+				Field_Best_Method = Method;
+			}
+		}
+		
+		// Same thing for the scalars
+		if (ModularInversionIsMethodUsable(&Pointer_Field->Inversion, Method))
+		{
+			Pointer_Field->Inversion_Method = Method;
+			ScalarFieldImport(Pointer_Field, Pointer_Curve->Point_Generator.X, &Scalar);
+			Time = UtilsGetTime();
+			for (i = 0; i < EC_INVERSION_BENCHMARK_ITERATIONS_COUNT; i++) ScalarFieldInvert(Pointer_Field, &Scalar, &Scalar);
+			Time = UtilsGetTime() - Time;
+			if ((Scalar_Best_Time < 0) || (Time < Scalar_Best_Time))
+			{
+				Scalar_Best_Time = Time;
+				Scalar_Best_Method = Method;
+			}
+		}
+	}
+	mpz_clear(Number);
 	
-	// Initialize curve members
-	mpz_init(Pointer_Curve->p);
-	mpz_init(Pointer_Curve->n);
-	mpz_init(Pointer_Curve->a4);
-	mpz_init(Pointer_Curve->a6);
-	mpz_init(Pointer_Curve->Point_Generator.X);
-	mpz_init(Pointer_Curve->Point_Generator.Y);
-	Pointer_Curve->Point_Generator.Is_Infinite = 0;
+	Pointer_Curve->Field_Inversion_Method = Field_Best_Method;
+	Pointer_Field->Inversion_Method = Scalar_Best_Method;
+}
+
+int ECInvertFieldElement(TEllipticCurve *Pointer_Curve, mpz_t Number, mpz_t Output_Inverse)
+{
+	return ECInvert(Pointer_Curve, Output_Inverse, Number);
+}
+
+int ECPrecomputeGeneratorTable(TEllipticCurve *Pointer_Curve)
+{
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	TPoint Point_Window_Base, *Pointer_Window_Points;
+	int Digits_Count, i, j;
 	
-	// Load values
-	gmp_fscanf(File, "p=%Zd\n", &Pointer_Curve->p);
-	gmp_fscanf(File, "n=%Zd\n", &Pointer_Curve->n);
-	gmp_fscanf(File, "a4=%Zd\n", &Pointer_Curve->a4);
-	gmp_fscanf(File, "a6=%Zd\n", &Pointer_Curve->a6);
+	Pointer_Table->Window_Size = EC_GENERATOR_TABLE_WINDOW_SIZE;
+	Pointer_Table->Windows_Count = (mpz_sizeinbase(Pointer_Curve->n, 2) + EC_GENERATOR_TABLE_WINDOW_SIZE - 1) / EC_GENERATOR_TABLE_WINDOW_SIZE;
+	Digits_Count = (1 << EC_GENERATOR_TABLE_WINDOW_SIZE) - 1;
+	Pointer_Table->Pointer_Points = malloc(Pointer_Table->Windows_Count * Digits_Count * sizeof(TPoint));
+	if (Pointer_Table->Pointer_Points == NULL) return 0;
+	Pointer_Table->Is_Read_Only = 0;
 	
-	// Bypass r4 and r6 (they are not used but they can desynchronize the gmp_scanf())
-	gmp_fscanf(File, "r4=%Zd\n", &Pointer_Curve->Point_Generator.X);
-	gmp_fscanf(File, "r6=%Zd\n", &Pointer_Curve->Point_Generator.X);
+	// Start with G
+	PointCreate(0, 0, &Point_Window_Base);
+	PointCopy(&Pointer_Curve->Point_Generator, &Point_Window_Base);
 	
-	// Continue to load useful values
-	gmp_fscanf(File, "gx=%Zd\n", &Pointer_Curve->Point_Generator.X);
-	gmp_fscanf(File, "gy=%Zd\n", &Pointer_Curve->Point_Generator.Y);
+	for (i = 0; i < Pointer_Table->Windows_Count; i++)
+	{
+		Pointer_Window_Points = &Pointer_Table->Pointer_Points[i * Digits_Count];
+		
+		// d.B = (d - 1).B + B, where B = 2^(Window_Size.i).G
+		PointCreate(0, 0, &Pointer_Window_Points[0]);
+		PointCopy(&Point_Window_Base, &Pointer_Window_Points[0]);
+		for (j = 1; j < Digits_Count; j++)
+		{
+			PointCreate(0, 0, &Pointer_Window_Points[j]);
+			ECAddition(Pointer_Curve, &Pointer_Window_Points[j - 1], &Point_Window_Base, &Pointer_Window_Points[j]);
+		}
+		
+		// Next window base is 2^Window_Size.B = (2^Window_Size - 1).B + B
+		ECAddition(Pointer_Curve, &Pointer_Window_Points[Digits_Count - 1], &Point_Window_Base, &Point_Window_Base);
+	}
 	
-	fclose(File);
+	PointFree(&Point_Window_Base);
 	return 1;
 }
 
-void ECFree(TEllipticCurve *Pointer_Curve)
-{
-	mpz_clear(Pointer_Curve->p);
-	mpz_clear(Pointer_Curve->n);
-	mpz_clear(Pointer_Curve->a4);
-	mpz_clear(Pointer_Curve->a6);
-}
-
 void ECOpposite(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Input_Point, TPoint *Pointer_Output_Point)
 {
 	mpz_set(Pointer_Output_Point->X, Pointer_Input_Point->X);
 	mpz_neg(Pointer_Output_Point->Y, Pointer_Input_Point->Y);
-	mpz_mod(Pointer_Output_Point->Y, Pointer_Output_Point->Y, Pointer_Curve->p);
+	ECReduce(Pointer_Curve, Pointer_Output_Point->Y);
 	Pointer_Output_Point->Is_Infinite = Pointer_Input_Point->Is_Infinite;
 }
 
 void ECAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *Pointer_Point_Q, TPoint *Pointer_Output_Point)
 {
-	TPoint Point_Temp;
-	
 	// Is P infinite ?
 	if (Pointer_Point_P->Is_Infinite)
 	{
@@ -204,12 +1718,8 @@ void ECAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *
 		return;
 	}
 	
-	// Are P and Q opposite ?
-	PointCreate(0, 0, &Point_Temp);
-	ECOpposite(Pointer_Curve, Pointer_Point_Q, &Point_Temp);
-	
-	// Result is infinite
-	if (PointIsEqual(Pointer_Point_P, &Point_Temp))
+	// Are P and Q opposite ? Points with the same X coordinate are either equal or opposite, and a point with Y = 0 is its own opposite
+	if ((mpz_cmp(Pointer_Point_P->X, Pointer_Point_Q->X) == 0) && ((mpz_cmp(Pointer_Point_P->Y, Pointer_Point_Q->Y) != 0) || (mpz_sgn(Pointer_Point_P->Y) == 0)))
 	{
 		Pointer_Output_Point->Is_Infinite = 1;
 		#ifdef DEBUG
@@ -220,7 +1730,7 @@ void ECAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *
 	else
 	{
 		// Is P equal to Q ?
-		if (PointIsEqual(Pointer_Point_P, Pointer_Point_Q)) ECDouble(Pointer_Curve, Pointer_Point_P, Pointer_Output_Point); // Double the point
+		if (mpz_cmp(Pointer_Point_P->X, Pointer_Point_Q->X) == 0) ECDouble(Pointer_Curve, Pointer_Point_P, Pointer_Output_Point); // Double the point
 		else ECAddDifferentPoints(Pointer_Curve, Pointer_Point_P, Pointer_Point_Q, Pointer_Output_Point); // Add the two different points
 		Pointer_Output_Point->Is_Infinite = 0;
 		#ifdef DEBUG
@@ -228,35 +1738,322 @@ void ECAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *
 			PointShow(Pointer_Output_Point);
 		#endif
 	}
-	PointFree(&Point_Temp);
 }
 
 void ECMultiplication(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Factor, TPoint *Pointer_Output_Point)
 {
-	int Bits_Count, i;
-	TPoint Point_Temp;
+	int i;
+	TECJacobianPoint Point_Result;
+	mpz_t Temporary_Numbers[EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT];
 	
 	// Initialize variables
-	PointCreate(0, 0, &Point_Temp);
-	PointCopy(Pointer_Point, &Point_Temp); // Allow using the same variable for Pointer_Point and Pointer_Output_Point
+	ECJacobianCreate(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
 	
-	Pointer_Output_Point->Is_Infinite = 1;
+	ECMultiplicationJacobian(Pointer_Curve, Pointer_Point, Factor, &Point_Result, Temporary_Numbers);
 	
-	// Retrieve how many bits are used to store the factor number
-	Bits_Count = mpz_size(Factor) * mp_bits_per_limb;
+	// The input point is not needed anymore, so it can be the output point too
+	ECJacobianToAffine(Pointer_Curve, &Point_Result, Pointer_Output_Point, Temporary_Numbers);
 	
-	// Double-and-add starting from most significant bit to minimize computations
-	for (i = Bits_Count - 1; i >= 0; i--)
+	// Free resources
+	ECJacobianFree(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+}
+
+void ECMultiplicationGenerator(TEllipticCurve *Pointer_Curve, mpz_t Factor, TPoint *Pointer_Output_Point)
+{
+	TECJacobianPoint Point_Result;
+	mpz_t Temporary_Numbers[EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT];
+	int i;
+	
+	ECJacobianCreate(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	ECMultiplicationGeneratorJacobian(Pointer_Curve, Factor, &Point_Result, Temporary_Numbers);
+	ECJacobianToAffine(Pointer_Curve, &Point_Result, Pointer_Output_Point, Temporary_Numbers);
+	
+	ECJacobianFree(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+}
+
+int ECMultiplicationGeneratorBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Factors, int Factors_Count, TPoint *Pointer_Output_Points)
+{
+	TECJacobianPoint *Pointer_Points;
+	struct TECLanesGeneratorTable *Pointer_Lanes_Table;
+	mpz_t *Pointer_Products, Temporary_Numbers[EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT];
+	int i;
+	
+	Pointer_Points = malloc(Factors_Count * sizeof(TECJacobianPoint));
+	Pointer_Products = malloc(Factors_Count * sizeof(mpz_t));
+	if ((Pointer_Points == NULL) || (Pointer_Products == NULL))
 	{
-		// Always double the point
-		ECDouble(Pointer_Curve, Pointer_Output_Point, Pointer_Output_Point);
+		free(Pointer_Points);
+		free(Pointer_Products);
+		return 0;
+	}
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	for (i = 0; i < Factors_Count; i++)
+	{
+		ECJacobianCreate(&Pointer_Points[i]);
+		mpz_init(Pointer_Products[i]);
+	}
+	
+	// Compute all multiples without converting them, FIELD_LANES_COUNT at a time when the vectorized arithmetic is available
+	i = 0;
+	Pointer_Lanes_Table = ECGetLanesGeneratorTable(Pointer_Curve);
+	if (Pointer_Lanes_Table != NULL)
+	{
+		for (; i + FIELD_LANES_COUNT <= Factors_Count; i += FIELD_LANES_COUNT) ECMultiplicationGeneratorLanes(Pointer_Curve, Pointer_Lanes_Table, &Pointer_Factors[i], &Pointer_Points[i]);
+	}
+	for (; i < Factors_Count; i++) ECMultiplicationGeneratorJacobian(Pointer_Curve, Pointer_Factors[i], &Pointer_Points[i], Temporary_Numbers);
+	
+	// Share the inversion
+	ECJacobianToAffineBatch(Pointer_Curve, Pointer_Points, Factors_Count, Pointer_Output_Points, Pointer_Products, Temporary_Numbers);
+	
+	// Free resources
+	for (i = 0; i < Factors_Count; i++)
+	{
+		ECJacobianFree(&Pointer_Points[i]);
+		mpz_clear(Pointer_Products[i]);
+	}
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	free(Pointer_Points);
+	free(Pointer_Products);
+	return 1;
+}
+
+int ECPrecomputeTable(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, int Window_Size, TPrecomputedTable *Pointer_Table)
+{
+	int i;
+	
+	Pointer_Table->Window_Size = Window_Size;
+	Pointer_Table->Points_Count = (1 << Window_Size) - 1;
+	Pointer_Table->Pointer_Points = malloc(Pointer_Table->Points_Count * sizeof(TPoint));
+	if (Pointer_Table->Pointer_Points == NULL) return 0;
+	
+	// 1.P
+	PointCreate(0, 0, &Pointer_Table->Pointer_Points[0]);
+	PointCopy(Pointer_Point, &Pointer_Table->Pointer_Points[0]);
+	
+	// (i + 1).P = i.P + P
+	for (i = 1; i < Pointer_Table->Points_Count; i++)
+	{
+		PointCreate(0, 0, &Pointer_Table->Pointer_Points[i]);
+		ECAddition(Pointer_Curve, &Pointer_Table->Pointer_Points[i - 1], Pointer_Point, &Pointer_Table->Pointer_Points[i]);
+	}
+	return 1;
+}
+
+void ECFreePrecomputedTable(TPrecomputedTable *Pointer_Table)
+{
+	int i;
+	
+	for (i = 0; i < Pointer_Table->Points_Count; i++) PointFree(&Pointer_Table->Pointer_Points[i]);
+	free(Pointer_Table->Pointer_Points);
+	Pointer_Table->Pointer_Points = NULL;
+	Pointer_Table->Points_Count = 0;
+}
+
+void ECMultiplicationWithTable(TEllipticCurve *Pointer_Curve, TPrecomputedTable *Pointer_Table, mpz_t Factor, TPoint *Pointer_Output_Point)
+{
+	int Windows_Count, i, j, Digit;
+	TECJacobianPoint Point_Result;
+	mpz_t Temporary_Numbers[EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT];
+	
+	ECJacobianCreate(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// Process the factor by windows, starting from the most significant one
+	Windows_Count = (mpz_sizeinbase(Factor, 2) + Pointer_Table->Window_Size - 1) / Pointer_Table->Window_Size;
+	for (i = Windows_Count - 1; i >= 0; i--)
+	{
+		// Make room for the window bits
+		for (j = 0; j < Pointer_Table->Window_Size; j++) Pointer_Curve->Function_Double_Jacobian(Pointer_Curve, &Point_Result, Temporary_Numbers);
 		
-		// But add doubled values only when a factor bit is set
-		if (mpz_tstbit(Factor, i)) ECAddition(Pointer_Curve, Pointer_Output_Point, &Point_Temp, Pointer_Output_Point);
+		// Extract the window value
+		Digit = 0;
+		for (j = Pointer_Table->Window_Size - 1; j >= 0; j--) Digit = (Digit << 1) | mpz_tstbit(Factor, i * Pointer_Table->Window_Size + j);
+		
+		// Add the corresponding precomputed multiple
+		if (Digit != 0) ECJacobianAddAffine(Pointer_Curve, &Point_Result, &Pointer_Table->Pointer_Points[Digit - 1], Temporary_Numbers);
+	}
+	ECJacobianToAffine(Pointer_Curve, &Point_Result, Pointer_Output_Point, Temporary_Numbers);
+	
+	ECJacobianFree(&Point_Result);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+}
+
+// Pippenger's bucket method : for each window of the factors, every point is added to the bucket of its digit, then the buckets are summed with their digit as weight.
+// The digits are signed, a negative digit adds the opposite point to the bucket of its absolute value, so only half the buckets are needed
+int ECMultiplicationMultiScalar(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Points, mpz_t *Pointer_Factors, int Points_Count, TPoint *Pointer_Output_Point)
+{
+	TECJacobianPoint *Pointer_Buckets, Point_Result, Point_Running_Sum, Point_Window_Sum;
+	TPoint Point_Opposite;
+	mpz_t Temporary_Numbers[EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT];
+	short *Pointer_Digits;
+	long long Cost, Best_Cost = -1;
+	int Bits_Count = 0, Window_Size = 1, Windows_Count, Buckets_Count, i, j, Digit, Carry;
+	
+	// The longest factor tells how many windows are needed
+	for (i = 0; i < Points_Count; i++)
+	{
+		if (mpz_sgn(Pointer_Factors[i]) == 0) continue;
+		j = mpz_sizeinbase(Pointer_Factors[i], 2);
+		if (j > Bits_Count) Bits_Count = j;
+	}
+	if (Bits_Count == 0)
+	{
+		Pointer_Output_Point->Is_Infinite = 1;
+		return 1;
+	}
+	
+	// Each window costs an addition per point and two additions per bucket, find the size giving the lowest total (the signed digits carry can need one more bit)
+	for (i = 1; i <= EC_MULTI_SCALAR_MAXIMUM_WINDOW_SIZE; i++)
+	{
+		Cost = (long long) (Bits_Count / i + 1) * (Points_Count + (1LL << i));
+		if ((Best_Cost < 0) || (Cost < Best_Cost))
+		{
+			Best_Cost = Cost;
+			Window_Size = i;
+		}
+	}
+	Windows_Count = Bits_Count / Window_Size + 1;
+	Buckets_Count = 1 << (Window_Size - 1);
+	
+	Pointer_Buckets = malloc(Buckets_Count * sizeof(TECJacobianPoint));
+	Pointer_Digits = malloc((size_t) Points_Count * Windows_Count * sizeof(short));
+	if ((Pointer_Buckets == NULL) || (Pointer_Digits == NULL))
+	{
+		free(Pointer_Buckets);
+		free(Pointer_Digits);
+		return 0;
+	}
+	for (i = 0; i < Buckets_Count; i++) ECJacobianCreate(&Pointer_Buckets[i]);
+	ECJacobianCreate(&Point_Result);
+	ECJacobianCreate(&Point_Running_Sum);
+	ECJacobianCreate(&Point_Window_Sum);
+	PointCreate(0, 0, &Point_Opposite);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// Recode the factors with digits in [-2^(Window_Size - 1) + 1, 2^(Window_Size - 1)], starting from the least significant window to propagate the carries
+	for (i = 0; i < Points_Count; i++)
+	{
+		Carry = 0;
+		for (j = 0; j < Windows_Count; j++)
+		{
+			Digit = ECGetFactorWindow(Pointer_Factors[i], j * Window_Size, Window_Size) + Carry;
+			if (Digit > Buckets_Count)
+			{
+				Digit -= 1 << Window_Size;
+				Carry = 1;
+			}
+			else Carry = 0;
+			Pointer_Digits[i * Windows_Count + j] = (short) Digit;
+		}
+	}
+	
+	// Process the factors by windows, starting from the most significant one
+	for (i = Windows_Count - 1; i >= 0; i--)
+	{
+		// Make room for the window bits
+		for (j = 0; j < Window_Size; j++) Pointer_Curve->Function_Double_Jacobian(Pointer_Curve, &Point_Result, Temporary_Numbers);
+		
+		// Bucket d - 1 receives the sum of the points whose digit is d, minus the sum of the points whose digit is -d
+		for (j = 0; j < Buckets_Count; j++) Pointer_Buckets[j].Is_Infinite = 1;
+		for (j = 0; j < Points_Count; j++)
+		{
+			Digit = Pointer_Digits[j * Windows_Count + i];
+			if (Digit > 0) ECJacobianAddAffine(Pointer_Curve, &Pointer_Buckets[Digit - 1], &Pointer_Points[j], Temporary_Numbers);
+			else if (Digit < 0)
+			{
+				ECOpposite(Pointer_Curve, &Pointer_Points[j], &Point_Opposite);
+				ECJacobianAddAffine(Pointer_Curve, &Pointer_Buckets[-Digit - 1], &Point_Opposite, Temporary_Numbers);
+			}
+		}
+		
+		// Sum of d.Bucket(d) : the running sum of the buckets from the highest one is added once per bucket, so bucket d is counted d times
+		Point_Running_Sum.Is_Infinite = 1;
+		Point_Window_Sum.Is_Infinite = 1;
+		for (j = Buckets_Count - 1; j >= 0; j--)
+		{
+			ECJacobianAdd(Pointer_Curve, &Point_Running_Sum, &Pointer_Buckets[j], Temporary_Numbers);
+			ECJacobianAdd(Pointer_Curve, &Point_Window_Sum, &Point_Running_Sum, Temporary_Numbers);
+		}
+		ECJacobianAdd(Pointer_Curve, &Point_Result, &Point_Window_Sum, Temporary_Numbers);
+	}
+	ECJacobianToAffine(Pointer_Curve, &Point_Result, Pointer_Output_Point, Temporary_Numbers);
+	
+	// Free resources
+	for (i = 0; i < Buckets_Count; i++) ECJacobianFree(&Pointer_Buckets[i]);
+	free(Pointer_Buckets);
+	free(Pointer_Digits);
+	ECJacobianFree(&Point_Result);
+	ECJacobianFree(&Point_Running_Sum);
+	ECJacobianFree(&Point_Window_Sum);
+	PointFree(&Point_Opposite);
+	for (i = 0; i < EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	return 1;
+}
+
+int ECMultiplicationXOnly(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X)
+{
+	mpz_t X_Difference, A6_Times_4, X0, Z0, X1, Z1, Temporary_Numbers[EC_X_ONLY_TEMPORARY_NUMBERS_COUNT];
+	int i, Bit, Is_Finite;
+	
+	// The Montgomery form has a cheaper ladder (see Bench)
+	if (Pointer_Curve->Model == EC_MODEL_MONTGOMERY) return ECModelsMontgomeryMultiplicationXOnly(Pointer_Curve, X, Factor, Output_X);
+	
+	// Initialize variables
+	mpz_init_set(X_Difference, X);
+	ECReduce(Pointer_Curve, X_Difference);
+	mpz_init(A6_Times_4);
+	mpz_mul_2exp(A6_Times_4, Pointer_Curve->a6, 2);
+	ECReduce(Pointer_Curve, A6_Times_4);
+	for (i = 0; i < EC_X_ONLY_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// R0 = O, R1 = P, so R1 - R0 = P all along the ladder
+	mpz_init_set_ui(X0, 1);
+	mpz_init_set_ui(Z0, 0);
+	mpz_init_set(X1, X_Difference);
+	mpz_init_set_ui(Z1, 1);
+	
+	// For each bit, R0 = 2.R0 and R1 = R0 + R1 if the bit is cleared, or R0 = R0 + R1 and R1 = 2.R1 if the bit is set (swapping the points makes both cases identical)
+	for (i = mpz_sizeinbase(Factor, 2) - 1; i >= 0; i--)
+	{
+		Bit = mpz_tstbit(Factor, i);
+		if (Bit)
+		{
+			mpz_swap(X0, X1);
+			mpz_swap(Z0, Z1);
+		}
+		ECXOnlyAdd(Pointer_Curve, X0, Z0, X1, Z1, X_Difference, A6_Times_4, Temporary_Numbers);
+		ECXOnlyDouble(Pointer_Curve, X0, Z0, A6_Times_4, Temporary_Numbers);
+		if (Bit)
+		{
+			mpz_swap(X0, X1);
+			mpz_swap(Z0, Z1);
+		}
+	}
+	
+	// Convert R0 to affine coordinates
+	Is_Finite = (mpz_sgn(Z0) != 0);
+	if (Is_Finite)
+	{
+		ECInvert(Pointer_Curve, Z0, Z0);
+		ECMultiply(Output_X, X0, Z0);
+		ECReduce(Pointer_Curve, Output_X);
 	}
 	
 	// Free resources
-	PointClear(&Point_Temp);
+	mpz_clear(X_Difference);
+	mpz_clear(A6_Times_4);
+	mpz_clear(X0);
+	mpz_clear(Z0);
+	mpz_clear(X1);
+	mpz_clear(Z1);
+	for (i = 0; i < EC_X_ONLY_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	return Is_Finite;
 }
 
 // To check if the point lies on the curve we check if it can be replaced in the curve equation y^2 = x^3 + a4.x + a6
@@ -271,14 +2068,14 @@ int ECIsPointOnCurve(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point)
 	
 	// Compute right part of the equation
 	mpz_powm_ui(Number_Temp, Pointer_Point->X, 3, Pointer_Curve->p); // x^3
-	mpz_mul(Number_Temp_2, Pointer_Curve->a4, Pointer_Point->X); // a4.x
+	ECMultiply(Number_Temp_2, Pointer_Curve->a4, Pointer_Point->X); // a4.x
 	mpz_add(Number_Temp, Number_Temp, Number_Temp_2); // x^3 + a4.x
 	mpz_add(Number_Temp, Number_Temp, Pointer_Curve->a6); // x^3 + a4.x + a6
-	mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->p);
+	ECReduce(Pointer_Curve, Number_Temp);
 	
 	// Compute left part of the equation
-	mpz_mul(Number_Temp_2, Pointer_Point->Y, Pointer_Point->Y);
-	mpz_mod(Number_Temp_2, Number_Temp_2, Pointer_Curve->p);
+	ECMultiply(Number_Temp_2, Pointer_Point->Y, Pointer_Point->Y);
+	ECReduce(Pointer_Curve, Number_Temp_2);
 	
 	// Are the two parts equal (modulo p) ?
 	if (mpz_cmp(Number_Temp_2, Number_Temp) == 0) Return_Value = 1;
@@ -288,4 +2085,438 @@ int ECIsPointOnCurve(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point)
 	mpz_clear(Number_Temp);
 	mpz_clear(Number_Temp_2);
 	return Return_Value;
-}
\ No newline at end of file
+}
+
+int ECPrepareMapToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map)
+{
+	mpz_t Number_Temp, Number_Root;
+	unsigned long Remainder;
+	
+	mpz_init(Pointer_Map->Z);
+	mpz_init(Pointer_Map->A);
+	mpz_init(Pointer_Map->B);
+	mpz_init(Pointer_Map->Square_Root_Exponent);
+	mpz_init(Pointer_Map->Square_Root_Small_Exponent);
+	mpz_init(Pointer_Map->Square_Root_Constant);
+	mpz_init(Pointer_Map->Square_Root_Constant_2);
+	mpz_init(Pointer_Map->Isogeny_X);
+	mpz_init(Pointer_Map->Isogeny_T);
+	mpz_init(Pointer_Map->Isogeny_U);
+	mpz_init(Number_Temp);
+	mpz_init(Number_Root);
+	Pointer_Map->Is_Isogeny_Used = 0;
+	
+	if (mpz_sgn(Pointer_Curve->a4) != 0)
+	{
+		mpz_mod(Pointer_Map->A, Pointer_Curve->a4, Pointer_Curve->p);
+		mpz_mod(Pointer_Map->B, Pointer_Curve->a6, Pointer_Curve->p);
+	}
+	// When a4 = 0 the 3-isogenous curve is given by Velu's formulas with the kernel points of abscissa x0 = cbrt(-4.a6) : A = -30.x0^2 and B = 253.a6, the dual isogeny sending
+	// the points back has x1 = -3.x0, t = -6.x0^2 and u = 4.a6
+	else
+	{
+		mpz_mul_si(Number_Temp, Pointer_Curve->a6, -4);
+		mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->p);
+		
+		// The cube root has a closed form unless p = 1 mod 9
+		Remainder = mpz_fdiv_ui(Pointer_Curve->p, 9);
+		if (Remainder % 3 == 2)
+		{
+			mpz_mul_2exp(Number_Root, Pointer_Curve->p, 1);
+			mpz_sub_ui(Number_Root, Number_Root, 1);
+			mpz_divexact_ui(Number_Root, Number_Root, 3); // (2.p - 1) / 3
+		}
+		else if (Remainder == 7)
+		{
+			mpz_add_ui(Number_Root, Pointer_Curve->p, 2);
+			mpz_divexact_ui(Number_Root, Number_Root, 9); // (p + 2) / 9
+		}
+		else if (Remainder == 4)
+		{
+			mpz_mul_2exp(Number_Root, Pointer_Curve->p, 1);
+			mpz_add_ui(Number_Root, Number_Root, 1);
+			mpz_divexact_ui(Number_Root, Number_Root, 9); // (2.p + 1) / 9
+		}
+		else goto Error;
+		mpz_powm(Number_Root, Number_Temp, Number_Root, Pointer_Curve->p);
+		
+		// -4.a6 may have no cube root at all
+		mpz_powm_ui(Pointer_Map->A, Number_Root, 3, Pointer_Curve->p);
+		if (mpz_cmp(Pointer_Map->A, Number_Temp) != 0) goto Error;
+		
+		mpz_mul(Number_Temp, Number_Root, Number_Root);
+		mpz_mul_si(Pointer_Map->A, Number_Temp, -30);
+		mpz_mod(Pointer_Map->A, Pointer_Map->A, Pointer_Curve->p);
+		mpz_mul_ui(Pointer_Map->B, Pointer_Curve->a6, 253);
+		mpz_mod(Pointer_Map->B, Pointer_Map->B, Pointer_Curve->p);
+		mpz_mul_si(Pointer_Map->Isogeny_X, Number_Root, -3);
+		mpz_mod(Pointer_Map->Isogeny_X, Pointer_Map->Isogeny_X, Pointer_Curve->p);
+		mpz_mul_si(Pointer_Map->Isogeny_T, Number_Temp, -6);
+		mpz_mod(Pointer_Map->Isogeny_T, Pointer_Map->Isogeny_T, Pointer_Curve->p);
+		mpz_mul_ui(Pointer_Map->Isogeny_U, Pointer_Curve->a6, 4);
+		mpz_mod(Pointer_Map->Isogeny_U, Pointer_Map->Isogeny_U, Pointer_Curve->p);
+		Pointer_Map->Is_Isogeny_Used = 1;
+	}
+	if ((mpz_sgn(Pointer_Map->A) == 0) || (mpz_sgn(Pointer_Map->B) == 0) || !ECMapToCurveFindZ(Pointer_Curve, Pointer_Map)) goto Error;
+	
+	// Square root constants, with p - 1 = c2.2^c1
+	mpz_sub_ui(Number_Temp, Pointer_Curve->p, 1);
+	Pointer_Map->Two_Adicity = mpz_scan1(Number_Temp, 0);
+	mpz_tdiv_q_2exp(Number_Temp, Number_Temp, Pointer_Map->Two_Adicity);
+	mpz_sub_ui(Pointer_Map->Square_Root_Exponent, Number_Temp, 1);
+	mpz_tdiv_q_2exp(Pointer_Map->Square_Root_Exponent, Pointer_Map->Square_Root_Exponent, 1); // (c2 - 1) / 2, that is (p - 3) / 4 when c1 = 1
+	if (mpz_sgn(Pointer_Map->Square_Root_Exponent) == 0) goto Error;
+	if (Pointer_Map->Two_Adicity == 1)
+	{
+		mpz_sub(Number_Root, Pointer_Curve->p, Pointer_Map->Z);
+		mpz_add_ui(Pointer_Map->Square_Root_Constant, Pointer_Curve->p, 1);
+		mpz_tdiv_q_2exp(Pointer_Map->Square_Root_Constant, Pointer_Map->Square_Root_Constant, 2);
+		mpz_powm(Pointer_Map->Square_Root_Constant, Number_Root, Pointer_Map->Square_Root_Constant, Pointer_Curve->p); // sqrt(-Z)
+	}
+	else
+	{
+		mpz_setbit(Pointer_Map->Square_Root_Small_Exponent, Pointer_Map->Two_Adicity);
+		mpz_sub_ui(Pointer_Map->Square_Root_Small_Exponent, Pointer_Map->Square_Root_Small_Exponent, 1);
+		mpz_powm(Pointer_Map->Square_Root_Constant, Pointer_Map->Z, Number_Temp, Pointer_Curve->p);
+		mpz_add_ui(Number_Temp, Number_Temp, 1);
+		mpz_tdiv_q_2exp(Number_Temp, Number_Temp, 1);
+		mpz_powm(Pointer_Map->Square_Root_Constant_2, Pointer_Map->Z, Number_Temp, Pointer_Curve->p);
+	}
+	
+	mpz_clear(Number_Temp);
+	mpz_clear(Number_Root);
+	return 1;
+	
+Error:
+	mpz_clear(Number_Temp);
+	mpz_clear(Number_Root);
+	ECFreeMapToCurve(Pointer_Map);
+	return 0;
+}
+
+void ECFreeMapToCurve(TECMapToCurve *Pointer_Map)
+{
+	mpz_clear(Pointer_Map->Z);
+	mpz_clear(Pointer_Map->A);
+	mpz_clear(Pointer_Map->B);
+	mpz_clear(Pointer_Map->Square_Root_Exponent);
+	mpz_clear(Pointer_Map->Square_Root_Small_Exponent);
+	mpz_clear(Pointer_Map->Square_Root_Constant);
+	mpz_clear(Pointer_Map->Square_Root_Constant_2);
+	mpz_clear(Pointer_Map->Isogeny_X);
+	mpz_clear(Pointer_Map->Isogeny_T);
+	mpz_clear(Pointer_Map->Isogeny_U);
+}
+
+// The straight-line simplified SWU map of RFC 9380 appendix F.2 : x = -B / A.(1 + 1 / (Z^2.u^4 + Z.u^2)) is tried first, if g(x) is not a square then g(Z.u^2.x) is,
+// the square root ratio tells which one with the same exponentiation
+void ECMapToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map, mpz_t U, TPoint *Pointer_Output_Point)
+{
+	mpz_t Temporary_Numbers[EC_MAP_TO_CURVE_TEMPORARY_NUMBERS_COUNT];
+	mpz_t *Tv1 = &Temporary_Numbers[0], *Tv2 = &Temporary_Numbers[1], *Tv3 = &Temporary_Numbers[2], *Tv4 = &Temporary_Numbers[3], *Tv5 = &Temporary_Numbers[4], *Tv6 = &Temporary_Numbers[5];
+	mpz_t *X = &Temporary_Numbers[6], *Y = &Temporary_Numbers[7], *Y1 = &Temporary_Numbers[8];
+	int i, Is_Square;
+	
+	for (i = 0; i < EC_MAP_TO_CURVE_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// tv1 = Z.u^2, tv2 = tv1^2 + tv1
+	ECMultiply(*Tv1, U, U);
+	ECReduce(Pointer_Curve, *Tv1);
+	ECMultiply(*Tv1, Pointer_Map->Z, *Tv1);
+	ECReduce(Pointer_Curve, *Tv1);
+	ECMultiply(*Tv2, *Tv1, *Tv1);
+	ECReduce(Pointer_Curve, *Tv2);
+	mpz_add(*Tv2, *Tv2, *Tv1);
+	ECReduce(Pointer_Curve, *Tv2);
+	
+	// x1 = tv3 / tv4 with tv3 = B.(tv2 + 1) and tv4 = A.(tv2 != 0 ? -tv2 : Z)
+	mpz_add_ui(*Tv3, *Tv2, 1);
+	ECMultiply(*Tv3, Pointer_Map->B, *Tv3);
+	ECReduce(Pointer_Curve, *Tv3);
+	mpz_sub(*Tv4, Pointer_Curve->p, *Tv2);
+	ECReduce(Pointer_Curve, *Tv4);
+	ECSelect(Pointer_Curve, *Tv4, Pointer_Map->Z, *Tv4, mpz_sgn(*Tv2) != 0);
+	ECMultiply(*Tv4, Pointer_Map->A, *Tv4);
+	ECReduce(Pointer_Curve, *Tv4);
+	
+	// g(x1) = tv2 / tv6 with tv2 = tv3^3 + A.tv3.tv4^2 + B.tv4^3 and tv6 = tv4^3
+	ECMultiply(*Tv2, *Tv3, *Tv3);
+	ECReduce(Pointer_Curve, *Tv2);
+	ECMultiply(*Tv6, *Tv4, *Tv4);
+	ECReduce(Pointer_Curve, *Tv6);
+	ECMultiply(*Tv5, Pointer_Map->A, *Tv6);
+	ECReduce(Pointer_Curve, *Tv5);
+	mpz_add(*Tv2, *Tv2, *Tv5);
+	ECReduce(Pointer_Curve, *Tv2);
+	ECMultiply(*Tv2, *Tv2, *Tv3);
+	ECReduce(Pointer_Curve, *Tv2);
+	ECMultiply(*Tv6, *Tv6, *Tv4);
+	ECReduce(Pointer_Curve, *Tv6);
+	ECMultiply(*Tv5, Pointer_Map->B, *Tv6);
+	ECReduce(Pointer_Curve, *Tv5);
+	mpz_add(*Tv2, *Tv2, *Tv5);
+	ECReduce(Pointer_Curve, *Tv2);
+	
+	// When g(x1) is not a square, x2 = Z.u^2.x1 and y2 = Z.u^3.sqrt(Z.g(x1)) are used
+	ECMultiply(*X, *Tv1, *Tv3);
+	ECReduce(Pointer_Curve, *X);
+	Is_Square = ECMapToCurveSquareRootRatio(Pointer_Curve, Pointer_Map, *Tv2, *Tv6, *Y1, &Temporary_Numbers[9]);
+	ECMultiply(*Y, *Tv1, U);
+	ECReduce(Pointer_Curve, *Y);
+	ECMultiply(*Y, *Y, *Y1);
+	ECReduce(Pointer_Curve, *Y);
+	ECSelect(Pointer_Curve, *X, *X, *Tv3, Is_Square);
+	ECSelect(Pointer_Curve, *Y, *Y, *Y1, Is_Square);
+	
+	// y has the same parity as u
+	mpz_sub(*Tv5, Pointer_Curve->p, *Y);
+	ECReduce(Pointer_Curve, *Tv5);
+	ECSelect(Pointer_Curve, *Y, *Tv5, *Y, mpz_odd_p(U) == mpz_odd_p(*Y));
+	
+	// The point is (x / tv4, y)
+	Pointer_Output_Point->Is_Infinite = 0;
+	if (!Pointer_Map->Is_Isogeny_Used)
+	{
+		ECInvert(Pointer_Curve, *Tv1, *Tv4);
+		ECMultiply(Pointer_Output_Point->X, *X, *Tv1);
+		ECReduce(Pointer_Curve, Pointer_Output_Point->X);
+		mpz_set(Pointer_Output_Point->Y, *Y);
+	}
+	// Otherwise send it to the curve, with d = x / tv4 - x1 the isogeny gives X = (x.d^2 + t.d.tv4^2 + u.tv4^3) / (9.d^2.tv4) and Y = y.(d^3 - t.d.tv4^2 - 2.u.tv4^3) / (27.d^3)
+	// where d is multiplied by tv4 to stay projective, both denominators are computed from the single inverse of w = 27.d^3.tv4
+	else
+	{
+		ECMultiply(*Tv1, Pointer_Map->Isogeny_X, *Tv4);
+		ECReduce(Pointer_Curve, *Tv1);
+		mpz_sub(*Tv1, *X, *Tv1);
+		ECReduce(Pointer_Curve, *Tv1); // d
+		ECMultiply(*Tv2, *Tv4, *Tv4);
+		ECReduce(Pointer_Curve, *Tv2);
+		ECMultiply(*Tv3, *Tv2, *Tv4);
+		ECReduce(Pointer_Curve, *Tv3);
+		ECMultiply(*Tv3, Pointer_Map->Isogeny_U, *Tv3);
+		ECReduce(Pointer_Curve, *Tv3); // u.tv4^3
+		ECMultiply(*Tv6, *Tv1, *Tv2);
+		ECReduce(Pointer_Curve, *Tv6);
+		ECMultiply(*Tv6, Pointer_Map->Isogeny_T, *Tv6);
+		ECReduce(Pointer_Curve, *Tv6); // t.d.tv4^2
+		ECMultiply(*Tv5, *Tv1, *Tv1);
+		ECReduce(Pointer_Curve, *Tv5);
+		ECMultiply(*Y1, *Tv5, *Tv1);
+		ECReduce(Pointer_Curve, *Y1); // d^3
+		
+		// Numerators
+		ECMultiply(*X, *X, *Tv5);
+		ECReduce(Pointer_Curve, *X);
+		mpz_add(*X, *X, *Tv6);
+		mpz_add(*X, *X, *Tv3);
+		ECReduce(Pointer_Curve, *X);
+		mpz_sub(*Tv5, *Y1, *Tv6);
+		mpz_submul_ui(*Tv5, *Tv3, 2);
+		ECReduce(Pointer_Curve, *Tv5);
+		
+		// 1 / (9.d^2.tv4) = 3.d / w and 1 / (27.d^3) = tv4 / w, w is zero only when the point is sent to the neutral element
+		ECMultiply(*Tv2, *Y1, *Tv4);
+		ECReduce(Pointer_Curve, *Tv2);
+		mpz_mul_ui(*Tv2, *Tv2, 27);
+		ECReduce(Pointer_Curve, *Tv2);
+		if (!ECInvert(Pointer_Curve, *Tv2, *Tv2)) Pointer_Output_Point->Is_Infinite = 1;
+		else
+		{
+			ECMultiply(*X, *X, *Tv1);
+			ECReduce(Pointer_Curve, *X);
+			mpz_mul_ui(*X, *X, 3);
+			ECReduce(Pointer_Curve, *X);
+			ECMultiply(Pointer_Output_Point->X, *X, *Tv2);
+			ECReduce(Pointer_Curve, Pointer_Output_Point->X);
+			ECMultiply(*Y, *Y, *Tv5);
+			ECReduce(Pointer_Curve, *Y);
+			ECMultiply(*Y, *Y, *Tv4);
+			ECReduce(Pointer_Curve, *Y);
+			ECMultiply(Pointer_Output_Point->Y, *Y, *Tv2);
+			ECReduce(Pointer_Curve, Pointer_Output_Point->Y);
+		}
+	}
+	
+	for (i = 0; i < EC_MAP_TO_CURVE_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+}
+
+int ECHashToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map, unsigned char *Pointer_Data, size_t Data_Size, TPoint *Pointer_Output_Point)
+{
+	unsigned char Bytes[2 * EC_MAP_TO_CURVE_MAXIMUM_ELEMENT_SIZE];
+	int Element_Size;
+	mpz_t U;
+	TPoint Point_Temp;
+	
+	// Hash the message to two field elements much longer than p so they are uniformly distributed once reduced
+	Element_Size = (mpz_sizeinbase(Pointer_Curve->p, 2) + EC_MAP_TO_CURVE_SECURITY_BITS + 7) / 8;
+	if (!ECMapToCurveExpandMessage(Pointer_Data, Data_Size, Bytes, 2 * Element_Size)) return 0;
+	
+	// The sum of both mapped points is uniformly distributed on the curve, a single mapped point is not
+	mpz_init(U);
+	PointCreate(0, 0, &Point_Temp);
+	mpz_import(U, Element_Size, 1, 1, 1, 0, Bytes);
+	mpz_mod(U, U, Pointer_Curve->p);
+	ECMapToCurve(Pointer_Curve, Pointer_Map, U, &Point_Temp);
+	mpz_import(U, Element_Size, 1, 1, 1, 0, Bytes + Element_Size);
+	mpz_mod(U, U, Pointer_Curve->p);
+	ECMapToCurve(Pointer_Curve, Pointer_Map, U, Pointer_Output_Point);
+	ECAddition(Pointer_Curve, &Point_Temp, Pointer_Output_Point, Pointer_Output_Point);
+	
+	// Send the point to the subgroup generated by the curve generator
+	if ((mpz_cmp_ui(Pointer_Curve->h, 1) > 0) && !Pointer_Output_Point->Is_Infinite) ECMultiplication(Pointer_Curve, Pointer_Output_Point, Pointer_Curve->h, Pointer_Output_Point);
+	
+	mpz_clear(U);
+	PointFree(&Point_Temp);
+	return 1;
+}
+
+int ECIsPublicKeyValid(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point)
+{
+	TPoint Point_Temp;
+	int Return_Value;
+	
+	// The point at infinity can't be a public key
+	if (Pointer_Point->Is_Infinite) return 0;
+	
+	// Q must lie on the curve
+	if (!ECIsPointOnCurve(Pointer_Curve, Pointer_Point)) return 0;
+	
+	// On a prime order curve every point except infinity generates the whole group
+	if (mpz_cmp_ui(Pointer_Curve->h, 1) == 0) return 1;
+	
+	// Otherwise n.Q must be the point at infinity (the point could belong to a small subgroup, or have a component in one)
+	PointCreate(0, 0, &Point_Temp);
+	ECMultiplication(Pointer_Curve, Pointer_Point, Pointer_Curve->n, &Point_Temp);
+	Return_Value = Point_Temp.Is_Infinite;
+	PointFree(&Point_Temp);
+	
+	return Return_Value;
+}
+
+int ECIsXCoordinateValid(TEllipticCurve *Pointer_Curve, mpz_t X)
+{
+	mpz_t Number_Temp;
+	int Return_Value = 0;
+	
+	if ((mpz_sgn(X) < 0) || (mpz_cmp(X, Pointer_Curve->p) >= 0)) return 0;
+	mpz_init(Number_Temp);
+	
+	// x^3 + a4.x + a6 must be a square for a point with this X coordinate to exist on the curve, if it is zero the point has order 2
+	ECMultiply(Number_Temp, X, X);
+	mpz_add(Number_Temp, Number_Temp, Pointer_Curve->a4);
+	ECReduce(Pointer_Curve, Number_Temp);
+	ECMultiply(Number_Temp, Number_Temp, X);
+	mpz_add(Number_Temp, Number_Temp, Pointer_Curve->a6);
+	ECReduce(Pointer_Curve, Number_Temp);
+	if (mpz_legendre(Number_Temp, Pointer_Curve->p) != 1) goto Exit;
+	
+	// On prime order curves all points belong to the subgroup, otherwise n.P must be infinite
+	if ((mpz_cmp_ui(Pointer_Curve->h, 1) != 0) && ECMultiplicationXOnly(Pointer_Curve, X, Pointer_Curve->n, Number_Temp)) goto Exit;
+	Return_Value = 1;
+	
+Exit:
+	mpz_clear(Number_Temp);
+	return Return_Value;
+}
+
+// y^2 = x^3 + a4.x + a6, the square root is an exponentiation when p = 3 mod 4 and is found with the Tonelli-Shanks algorithm otherwise (the coordinates are public so the loop can depend on them)
+int ECDecompressPoint(TEllipticCurve *Pointer_Curve, mpz_t X, int Is_Y_Odd, TPoint *Pointer_Output_Point)
+{
+	mpz_t Number_Square, Number_Y, Number_Exponent, Number_C, Number_T, Number_B;
+	int Two_Adicity, Order_Exponent, i, Return_Value = 0;
+	
+	if ((mpz_sgn(X) < 0) || (mpz_cmp(X, Pointer_Curve->p) >= 0)) return 0;
+	
+	// Initialize variables
+	mpz_init(Number_Square);
+	mpz_init(Number_Y);
+	mpz_init(Number_Exponent);
+	mpz_init(Number_C);
+	mpz_init(Number_T);
+	mpz_init(Number_B);
+	
+	// Compute the right part of the equation
+	ECMultiply(Number_Square, X, X);
+	mpz_add(Number_Square, Number_Square, Pointer_Curve->a4);
+	ECReduce(Pointer_Curve, Number_Square);
+	ECMultiply(Number_Square, Number_Square, X);
+	mpz_add(Number_Square, Number_Square, Pointer_Curve->a6);
+	ECReduce(Pointer_Curve, Number_Square);
+	
+	// A point of order 2 has Y = 0, which is even
+	if (mpz_sgn(Number_Square) == 0)
+	{
+		if (Is_Y_Odd) goto Exit;
+	}
+	// There is no point with this X coordinate when the right part is not a square
+	else if (mpz_legendre(Number_Square, Pointer_Curve->p) != 1) goto Exit;
+	// Y = a^((p + 1) / 4)
+	else if (mpz_tstbit(Pointer_Curve->p, 1))
+	{
+		mpz_add_ui(Number_Exponent, Pointer_Curve->p, 1);
+		mpz_fdiv_q_2exp(Number_Exponent, Number_Exponent, 2);
+		mpz_powm(Number_Y, Number_Square, Number_Exponent, Pointer_Curve->p);
+	}
+	else
+	{
+		// p - 1 = Q.2^S with Q odd
+		mpz_sub_ui(Number_Exponent, Pointer_Curve->p, 1);
+		Two_Adicity = mpz_scan1(Number_Exponent, 0);
+		mpz_fdiv_q_2exp(Number_Exponent, Number_Exponent, Two_Adicity);
+		
+		// C = z^Q for a non-square z
+		mpz_set_ui(Number_C, 2);
+		while (mpz_legendre(Number_C, Pointer_Curve->p) != -1) mpz_add_ui(Number_C, Number_C, 1);
+		mpz_powm(Number_C, Number_C, Number_Exponent, Pointer_Curve->p);
+		
+		// T = a^Q, Y = a^((Q + 1) / 2)
+		mpz_powm(Number_T, Number_Square, Number_Exponent, Pointer_Curve->p);
+		mpz_add_ui(Number_Exponent, Number_Exponent, 1);
+		mpz_fdiv_q_2exp(Number_Exponent, Number_Exponent, 1);
+		mpz_powm(Number_Y, Number_Square, Number_Exponent, Pointer_Curve->p);
+		
+		// Y^2 = a.T is kept while the order of T decreases until T = 1
+		while (mpz_cmp_ui(Number_T, 1) != 0)
+		{
+			// Find the order 2^i of T
+			mpz_set(Number_B, Number_T);
+			for (Order_Exponent = 0; mpz_cmp_ui(Number_B, 1) != 0; Order_Exponent++)
+			{
+				ECMultiply(Number_B, Number_B, Number_B);
+				ECReduce(Pointer_Curve, Number_B);
+			}
+			
+			// B = C^(2^(S - i - 1)), then Y = Y.B, C = B^2 and T = T.B^2
+			mpz_set(Number_B, Number_C);
+			for (i = 0; i < Two_Adicity - Order_Exponent - 1; i++)
+			{
+				ECMultiply(Number_B, Number_B, Number_B);
+				ECReduce(Pointer_Curve, Number_B);
+			}
+			Two_Adicity = Order_Exponent;
+			ECMultiply(Number_Y, Number_Y, Number_B);
+			ECReduce(Pointer_Curve, Number_Y);
+			ECMultiply(Number_C, Number_B, Number_B);
+			ECReduce(Pointer_Curve, Number_C);
+			ECMultiply(Number_T, Number_T, Number_C);
+			ECReduce(Pointer_Curve, Number_T);
+		}
+	}
+	
+	// Choose the root with the requested parity
+	if ((int) mpz_odd_p(Number_Y) != (Is_Y_Odd != 0)) mpz_sub(Number_Y, Pointer_Curve->p, Number_Y);
+	mpz_set(Pointer_Output_Point->X, X);
+	mpz_set(Pointer_Output_Point->Y, Number_Y);
+	Pointer_Output_Point->Is_Infinite = 0;
+	Return_Value = 1;
+	
+Exit:
+	mpz_clear(Number_Square);
+	mpz_clear(Number_Y);
+	mpz_clear(Number_Exponent);
+	mpz_clear(Number_C);
+	mpz_clear(Number_T);
+	mpz_clear(Number_B);
+	return Return_Value;
+}
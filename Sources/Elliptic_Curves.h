@@ -1,5 +1,5 @@
 /** @file Elliptic_Curves.h
- * Basic operations for Weierstrass elliptic curves.
+ * Basic operations for Weierstrass elliptic curves. Twisted Edwards and Montgomery curves are loaded with their Weierstrass equivalent, see Elliptic_Curves_Models.h for their own formulas.
  */
 #ifndef H_ELLIPTIC_CURVES_H
 #define H_ELLIPTIC_CURVES_H
@@ -7,25 +7,125 @@
 #include <gmp.h>
 #include <assert.h>
 #include "Point.h"
+#include "Scalar_Field.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** How many factor bits are processed at once by the generator table. */
+#define EC_GENERATOR_TABLE_WINDOW_SIZE 4
+/** How many temporary numbers the Jacobian coordinates formulas need. */
+#define EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT 6
+/** How many temporary numbers the X-only ladder formulas need. */
+#define EC_X_ONLY_TEMPORARY_NUMBERS_COUNT 6
+
+/** The curve is y^2 = x^3 + a4.x + a6. */
+#define EC_MODEL_WEIERSTRASS 0
+/** The curve is a.x^2 + y^2 = 1 + d.x^2.y^2. */
+#define EC_MODEL_TWISTED_EDWARDS 1
+/** The curve is B.y^2 = x^3 + A.x^2 + x. */
+#define EC_MODEL_MONTGOMERY 2
 
 //--------------------------------------------------------------------------------------------------------
 // Types
 //--------------------------------------------------------------------------------------------------------
-/** Full elliptic curve description. */
+/** Multiples of the generator d.2^(Window_Size.i).G for every window i and every non-zero digit d, so multiplying the generator needs no doubling. */
 typedef struct
+{
+	TPoint *Pointer_Points; //! Points[i.(2^Window_Size - 1) + d - 1] = d.2^(Window_Size.i).G
+	int Windows_Count; //! How many windows are needed to cover the group order bits.
+	int Window_Size; //! How many factor bits are processed at once.
+	char Is_Read_Only; //! Tell if the points are views of a mapped binary file.
+} TGeneratorTable;
+
+/** A point in Jacobian coordinates (x = X / Z^2, y = Y / Z^3). Points can be added and doubled without modular inversion, only the final conversion to affine coordinates needs one. */
+typedef struct
+{
+	mpz_t X; //! X coordinate.
+	mpz_t Y; //! Y coordinate.
+	mpz_t Z; //! Z coordinate.
+	char Is_Infinite; //! Indicate if the point can be used for computations or not.
+} TECJacobianPoint;
+
+struct TEllipticCurve;
+
+/** Reduce a number modulo the curve prime p.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to reduce, it can be negative but its absolute value must fit in twice the bits of p. On output, contain the reduced number in [0, p - 1].
+ */
+typedef void (*TECReductionFunction)(struct TEllipticCurve *Pointer_Curve, mpz_t Number);
+
+/** Double a point in Jacobian coordinates.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Pointer_Temporary_Numbers EC_JACOBIAN_TEMPORARY_NUMBERS_COUNT initialized numbers the formulas can use.
+ */
+typedef void (*TECJacobianDoublingFunction)(struct TEllipticCurve *Pointer_Curve, TECJacobianPoint *Pointer_Point, mpz_t *Pointer_Temporary_Numbers);
+
+struct TECLanesGeneratorTable;
+
+/** Full elliptic curve description. */
+typedef struct TEllipticCurve
 {
 	mpz_t p;
 	mpz_t n;
 	mpz_t a4;
 	mpz_t a6;
+	mpz_t h; //! Cofactor (curve order divided by n), 0 if it is unknown.
 	TPoint Point_Generator;
+	TGeneratorTable Generator_Table; //! Precomputed multiples of the generator (Pointer_Points is NULL if there is no table).
+	char Is_Read_Only; //! Tell if the numbers are read-only views of a mapped binary file or of built-in data, such a curve must not be modified.
+	void *Pointer_Mapped_File; //! When the curve was loaded from a binary file, the mapping the numbers point to (NULL otherwise).
+	size_t Mapped_File_Size; //! Size of the mapping in bytes.
+	TECReductionFunction Function_Reduce; //! The fastest reduction modulo p available for the form of p (see ECSelectArithmetic()).
+	int Reduction_Bits_Count; //! When p = 2^k - c, the value of k.
+	unsigned long Reduction_Constant; //! When p = 2^k - c, the value of c.
+	TECJacobianDoublingFunction Function_Double_Jacobian; //! The doubling formulas specialized for the value of a4 (see ECSelectArithmetic()).
+	struct TECLanesGeneratorTable *Pointer_Lanes_Generator_Table; //! The generator table converted for the vectorized field arithmetic, built by the first batch multiplication (NULL until then).
+	int Model; //! The equation the curve was given with (EC_MODEL_WEIERSTRASS, EC_MODEL_TWISTED_EDWARDS or EC_MODEL_MONTGOMERY), the Weierstrass parameters above are always set.
+	mpz_t Model_A; //! The twisted Edwards a or the Montgomery A (initialized for curves loaded from .gp files only).
+	mpz_t Model_B; //! The twisted Edwards d or the Montgomery B (initialized for curves loaded from .gp files only).
+	TScalarField Scalar_Field; //! The arithmetic modulo n used by the signatures (see ECSelectArithmetic()).
+	TModularInversionModulus Field_Inversion; //! The inversion constants of p.
+	int Field_Inversion_Method; //! How the field elements are inverted (MODULAR_INVERSION_METHOD_SAFEGCD by default, see ECSelectFastestInversions()).
 } TEllipticCurve;
 
+/** Multiples of a point precomputed to speed up repeated multiplications of this point. */
+typedef struct
+{
+	TPoint *Pointer_Points; //! Points[i] = (i + 1).P
+	int Points_Count; //! How many multiples are stored (2^Window_Size - 1).
+	int Window_Size; //! How many factor bits are processed at once.
+} TPrecomputedTable;
+
+/** The constants of the simplified Shallue-van de Woestijne-Ulas map from the field elements to the curve points (RFC 9380 section 6.6.2). The map needs a4.a6 != 0, so
+ * on a4 = 0 curves the field elements are mapped to a 3-isogenous curve y^2 = x^3 + A.x + B and then sent back to the curve with the isogeny (RFC 9380 section 6.6.3).
+ */
+typedef struct
+{
+	mpz_t Z; //! The non-square constant of the map, chosen with the RFC 9380 appendix H.2 method.
+	mpz_t A; //! The a4 coefficient of the curve the field elements are mapped to (the curve a4 when no isogeny is used).
+	mpz_t B; //! The a6 coefficient of the curve the field elements are mapped to.
+	int Two_Adicity; //! The largest c1 such that 2^c1 divides p - 1, the square root has a faster form when it is 1 (p = 3 mod 4).
+	mpz_t Square_Root_Exponent; //! (p - 3) / 4 when p = 3 mod 4, (c2 - 1) / 2 otherwise with p - 1 = c2.2^c1.
+	mpz_t Square_Root_Small_Exponent; //! 2^c1 - 1 (p = 1 mod 4 only).
+	mpz_t Square_Root_Constant; //! sqrt(-Z) when p = 3 mod 4, Z^c2 otherwise.
+	mpz_t Square_Root_Constant_2; //! Z^((c2 + 1) / 2) (p = 1 mod 4 only).
+	int Is_Isogeny_Used; //! Tell if the points are computed on the isogenous curve first.
+	mpz_t Isogeny_X; //! x1 in the isogeny formulas x = (x' + t / (x' - x1) + u / (x' - x1)^2) / 9 and y = y'.(1 - t / (x' - x1)^2 - 2.u / (x' - x1)^3) / 27.
+	mpz_t Isogeny_T; //! t in the isogeny formulas.
+	mpz_t Isogeny_U; //! u in the isogeny formulas.
+} TECMapToCurve;
+
 //--------------------------------------------------------------------------------------------------------
 // Functions
 //--------------------------------------------------------------------------------------------------------
 
-/** Load an elliptic curve from a .gp file.
+/** Load an elliptic curve from a .gp file or from a binary curve file (see Elliptic_Curves_Binary.h).
+ * The .gp file is made of "name=value" lines. p, n, a4, a6, gx and gy are mandatory. The cofactor h is optional, it is computed from p and n when it is missing.
+ * A "model=edwards" line describes a twisted Edwards curve with a and d instead of a4 and a6, a "model=montgomery" line a Montgomery curve with A and B. The generator coordinates
+ * are then given in the model form, the curve and its generator are converted to the Weierstrass form (see Elliptic_Curves_Models.h). Binary files only hold the Weierstrass form.
+ * The generator table is computed when loading a .gp file, it is directly mapped from a binary file.
  * @param String_Path Path to the file.
  * @param Pointer_Curve Where to store the curve.
  * @return 0 if the file was not found or 1 if the curve was successfully loaded.
@@ -37,6 +137,37 @@ int ECLoadFromFile(char *String_Path, TEllipticCurve *Pointer_Curve);
  */
 void ECFree(TEllipticCurve *Pointer_Curve);
 
+/** Choose the field and point formulas fitting the curve parameters.
+ * Pseudo-Mersenne primes 2^k - c (with c small compared to 2^k, like secp256k1 one) and the P-256 Solinas prime are reduced with shifts and additions, any other prime uses a division.
+ * The Jacobian doubling formulas save multiplications when a4 = 0 (like secp256k1) or a4 = -3 (like P-256).
+ * The Barrett constants of the arithmetic modulo n and the inversion constants of p and n are computed too (see Scalar_Field.h and Modular_Inversion.h), both moduli are inverted
+ * with the constant-time safegcd algorithm.
+ * Curve loading functions call it, so it is needed only when a curve is built by hand.
+ * @param Pointer_Curve The elliptic curve.
+ * @return 1 if the curve can be used or 0 if p or n are not supported (even or longer than MODULAR_INVERSION_MAXIMUM_BITS).
+ */
+int ECSelectArithmetic(TEllipticCurve *Pointer_Curve);
+
+/** Time every inversion method usable with p and with n and keep the fastest ones. The GMP method is usually selected, its running time depends on the inverted numbers,
+ * so programs handling secrets should keep the constant-time default methods. It takes a few milliseconds, so it is best called once after loading the curve.
+ * @param Pointer_Curve The elliptic curve.
+ */
+void ECSelectFastestInversions(TEllipticCurve *Pointer_Curve);
+
+/** Invert a field element with the curve inversion method.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Number The number to invert, it does not need to be reduced.
+ * @param Output_Inverse On output, contain the inverse (it can be the same variable as Number).
+ * @return 0 if the number has no inverse or another value otherwise.
+ */
+int ECInvertFieldElement(TEllipticCurve *Pointer_Curve, mpz_t Number, mpz_t Output_Inverse);
+
+/** Compute the multiples of the generator used by ECMultiplicationGenerator().
+ * @param Pointer_Curve The elliptic curve.
+ * @return 1 if the table was successfully created or 0 if there is not enough memory.
+ */
+int ECPrecomputeGeneratorTable(TEllipticCurve *Pointer_Curve);
+
 /** Compute the opposite of a point.
  * @param Pointer_Curve The elliptic curve.
  * @param Pointer_Input_Point The point to compute the opposite.
@@ -60,6 +191,67 @@ void ECAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *
  */
 void ECMultiplication(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Factor, TPoint *Pointer_Output_Point);
 
+/** Multiply the curve generator with a scalar value, using the generator table when it is available.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Factor The scalar value to multiply the generator with.
+ * @param Pointer_Output_Point The result (it must be created by the user).
+ */
+void ECMultiplicationGenerator(TEllipticCurve *Pointer_Curve, mpz_t Factor, TPoint *Pointer_Output_Point);
+
+/** Multiply the curve generator with many scalar values. The results are converted to affine coordinates with a single modular inversion, which is much faster than calling ECMultiplicationGenerator() for each value.
+ * On prime fields of about 256 bits (see FieldLanesPrepareModulus()) and processors with AVX2, the multiplications are computed FIELD_LANES_COUNT at a time with the vectorized field arithmetic of Field_Lanes.h.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Pointer_Factors The scalar values to multiply the generator with.
+ * @param Factors_Count How many values there are.
+ * @param Pointer_Output_Points The results, Output_Points[i] = Factors[i].G (the points must be created by the user).
+ * @return 1 if the points were successfully computed or 0 if there is not enough memory.
+ */
+int ECMultiplicationGeneratorBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Factors, int Factors_Count, TPoint *Pointer_Output_Points);
+
+/** Precompute the multiples of a point used by ECMultiplicationWithTable().
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The point that will be multiplied.
+ * @param Window_Size How many factor bits will be processed at once (the table holds 2^Window_Size - 1 points).
+ * @param Pointer_Table On output, contain the precomputed points.
+ * @return 1 if the table was successfully created or 0 if there is not enough memory.
+ */
+int ECPrecomputeTable(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, int Window_Size, TPrecomputedTable *Pointer_Table);
+
+/** Free a precomputed table.
+ * @param Pointer_Table The table to destroy.
+ */
+void ECFreePrecomputedTable(TPrecomputedTable *Pointer_Table);
+
+/** Multiply a point with a scalar value using a fixed window and the precomputed multiples of the point.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Pointer_Table The precomputed multiples of the point to multiply.
+ * @param Factor The scalar value to multiply the point with.
+ * @param Pointer_Output_Point The result (it must be created by the user).
+ */
+void ECMultiplicationWithTable(TEllipticCurve *Pointer_Curve, TPrecomputedTable *Pointer_Table, mpz_t Factor, TPoint *Pointer_Output_Point);
+
+/** Compute the sum of many points multiplied by their own scalar value, Factors[0].Points[0] + Factors[1].Points[1] + ... The points share the doublings and, with Pippenger's bucket method,
+ * each point costs about one addition per window of a few factor bits, so the sum is much faster than separate multiplications when there are many points.
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param Pointer_Points The points to multiply.
+ * @param Pointer_Factors One scalar value per point, they must not be negative.
+ * @param Points_Count How many points there are.
+ * @param Pointer_Output_Point The result (it must be created by the user).
+ * @return 1 if the result was computed or 0 if there is not enough memory.
+ */
+int ECMultiplicationMultiScalar(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Points, mpz_t *Pointer_Factors, int Points_Count, TPoint *Pointer_Output_Point);
+
+/** Multiply a point known only by its X coordinate with a scalar value. A Montgomery ladder on projective X and Z coordinates is used, Y is never computed.
+ * This is enough for protocols using only the X coordinate of the result (like Diffie-Hellman or ElGamal) and it halves the size of the exchanged points.
+ * Montgomery curves use their own ladder instead (see ECModelsMontgomeryMultiplicationXOnly()).
+ * @param Pointer_Curve The elliptic curve used for multiplication.
+ * @param X The X coordinate of the point to multiply (see ECIsXCoordinateValid()).
+ * @param Factor The scalar value to multiply the point with.
+ * @param Output_X On output, contain the X coordinate of the result (it can be the same variable as X).
+ * @return 1 if the result is a finite point or 0 if it is the point at infinity (Output_X is not modified then).
+ */
+int ECMultiplicationXOnly(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X);
+
 /** Tell if a point lies on a curve or not.
  * @param Pointer_Curve The elliptic curve.
  * @param Pointer_Point The point to check.
@@ -67,4 +259,61 @@ void ECMultiplication(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_
  */
 int ECIsPointOnCurve(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point);
 
+/** Compute the constants needed to map field elements to the points of a curve.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Map On output, contain the map constants.
+ * @return 1 if the map can be used or 0 if the curve is not supported (a6 = 0, or a4 = 0 with no computable 3-isogeny, or a too small p).
+ */
+int ECPrepareMapToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map);
+
+/** Free the constants of a map.
+ * @param Pointer_Map The map to destroy.
+ */
+void ECFreeMapToCurve(TECMapToCurve *Pointer_Map);
+
+/** Map a field element to a curve point with the simplified SWU map. The operations sequence does not depend on the field element : the map always computes one exponentiation
+ * (the square root) and one inversion (the conversion to affine coordinates).
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Map The map constants.
+ * @param U The field element, in [0, p - 1].
+ * @param Pointer_Output_Point On output, contain the point (it must be created by the user). It is infinite only when the isogeny sends the point to the neutral element.
+ */
+void ECMapToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map, mpz_t U, TPoint *Pointer_Output_Point);
+
+/** Hash a message to a curve point (RFC 9380 hash_to_curve with the library hash) : the message is expanded to two field elements, both are mapped to the curve, the points are added and
+ * the sum is multiplied by the cofactor. Nobody knows the discrete logarithm of the resulting point.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Map The map constants.
+ * @param Pointer_Data The message.
+ * @param Data_Size The message size in bytes.
+ * @param Pointer_Output_Point On output, contain the point (it must be created by the user).
+ * @return 1 if the message was hashed or 0 if an error occurred.
+ */
+int ECHashToCurve(TEllipticCurve *Pointer_Curve, TECMapToCurve *Pointer_Map, unsigned char *Pointer_Data, size_t Data_Size, TPoint *Pointer_Output_Point);
+
+/** Check that a point received from a peer can be used as a public key : it must not be infinite, it must lie on the curve and it must belong to the subgroup generated by the curve generator.
+ * On prime order curves (cofactor 1) all points of the curve belong to the subgroup, so the costly n.Q = O check is skipped.
+ * @param Pointer_Curve The elliptic curve.
+ * @param Pointer_Point The public key to check.
+ * @return 1 if the public key is valid or 0 otherwise.
+ */
+int ECIsPublicKeyValid(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point);
+
+/** Check that an X coordinate received from a peer can be used with ECMultiplicationXOnly() : it must be reduced, x^3 + a4.x + a6 must be a non-zero square (otherwise the point is on the quadratic twist or has order 2)
+ * and, when the cofactor is not 1, the point must belong to the subgroup generated by the curve generator.
+ * @param Pointer_Curve The elliptic curve.
+ * @param X The X coordinate to check.
+ * @return 1 if the X coordinate is valid or 0 otherwise.
+ */
+int ECIsXCoordinateValid(TEllipticCurve *Pointer_Curve, mpz_t X);
+
+/** Find the point with a given X coordinate and a given Y parity, so a point can be stored with its X coordinate and a single bit.
+ * @param Pointer_Curve The elliptic curve.
+ * @param X The X coordinate (it can be the X coordinate of the output point).
+ * @param Is_Y_Odd Tell if the Y coordinate of the point is odd.
+ * @param Pointer_Output_Point On output, contain the point (it must be created by the user).
+ * @return 1 if the point was found or 0 if X is not reduced or is not the X coordinate of a curve point with this Y parity.
+ */
+int ECDecompressPoint(TEllipticCurve *Pointer_Curve, mpz_t X, int Is_Y_Odd, TPoint *Pointer_Output_Point);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,282 @@
+/** @file Elliptic_Curves_Binary.c
+ * Precompiled binary curve files.
+ */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Binary.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** How many numbers are stored in the parameters section. */
+#define EC_BINARY_PARAMETERS_COUNT 7
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Round an offset up to the sections alignment.
+ * @param Offset The offset to align.
+ * @return The aligned offset.
+ */
+static inline uint64_t ECBinaryAlign(uint64_t Offset)
+{
+	return (Offset + EC_BINARY_FILE_ALIGNMENT - 1) & ~((uint64_t) EC_BINARY_FILE_ALIGNMENT - 1);
+}
+
+/** Find a section in a mapped file and check that it lies in the file.
+ * @param Pointer_Header The mapped file header.
+ * @param File_Size The mapped file size in bytes.
+ * @param Type The section type.
+ * @return The section or NULL if it was not found or if it is corrupted.
+ */
+static TECBinarySection *ECBinaryFindSection(TECBinaryHeader *Pointer_Header, size_t File_Size, uint32_t Type)
+{
+	uint32_t i;
+	TECBinarySection *Pointer_Section;
+	
+	for (i = 0; i < Pointer_Header->Sections_Count; i++)
+	{
+		Pointer_Section = &Pointer_Header->Sections[i];
+		if (Pointer_Section->Type != Type) continue;
+		
+		// Numbers must be aligned and the section must not overflow the file
+		if ((Pointer_Section->Offset % EC_BINARY_FILE_ALIGNMENT) != 0) return NULL;
+		if ((Pointer_Section->Offset > File_Size) || (Pointer_Section->Size > File_Size - Pointer_Section->Offset)) return NULL;
+		return Pointer_Section;
+	}
+	return NULL;
+}
+
+/** Write a number using a fixed amount of limbs.
+ * @param File The file to write to.
+ * @param Number The number to write (it must be positive or zero).
+ * @param Limbs_Count How many limbs to write.
+ * @return 1 if the number was written or 0 if an error occured.
+ */
+static int ECBinaryWriteNumber(FILE *File, mpz_t Number, size_t Limbs_Count)
+{
+	mp_limb_t Zero_Limb = 0;
+	size_t i, Size;
+	
+	if (mpz_sgn(Number) < 0) return 0;
+	
+	Size = mpz_size(Number);
+	if (fwrite(mpz_limbs_read(Number), sizeof(mp_limb_t), Size, File) != Size) return 0;
+	for (i = Size; i < Limbs_Count; i++)
+	{
+		if (fwrite(&Zero_Limb, sizeof(mp_limb_t), 1, File) != 1) return 0;
+	}
+	return 1;
+}
+
+/** Write zeros until the file reaches a given offset.
+ * @param File The file to pad.
+ * @param Offset The offset to reach.
+ * @return 1 on success or 0 if an error occured.
+ */
+static int ECBinaryPad(FILE *File, uint64_t Offset)
+{
+	long Position;
+	
+	Position = ftell(File);
+	if (Position < 0) return 0;
+	for (; (uint64_t) Position < Offset; Position++)
+	{
+		if (fputc(0, File) == EOF) return 0;
+	}
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ECIsBinaryFile(FILE *File)
+{
+	char Magic[EC_BINARY_FILE_MAGIC_LENGTH];
+	
+	if (fread(Magic, sizeof(Magic), 1, File) != 1) return 0;
+	if (memcmp(Magic, EC_BINARY_FILE_MAGIC, EC_BINARY_FILE_MAGIC_LENGTH) != 0) return 0;
+	return 1;
+}
+
+int ECLoadFromBinaryFile(char *String_Path, TEllipticCurve *Pointer_Curve)
+{
+	int File_Descriptor, Digits_Count;
+	struct stat File_Status;
+	unsigned char *Pointer_File, *Pointer_Infinity_Flags;
+	TECBinaryHeader *Pointer_Header;
+	TECBinarySection *Pointer_Section;
+	const mp_limb_t *Pointer_Limbs;
+	size_t Number_Size, File_Size, Points_Count, Point_Size, i;
+	mpz_ptr Pointer_Numbers[EC_BINARY_PARAMETERS_COUNT] = {Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->h, Pointer_Curve->Point_Generator.X, Pointer_Curve->Point_Generator.Y};
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	
+	Pointer_Table->Pointer_Points = NULL;
+	
+	// Map the whole file
+	File_Descriptor = open(String_Path, O_RDONLY);
+	if (File_Descriptor == -1) return 0;
+	if ((fstat(File_Descriptor, &File_Status) == -1) || ((size_t) File_Status.st_size < sizeof(TECBinaryHeader)))
+	{
+		close(File_Descriptor);
+		return 0;
+	}
+	File_Size = File_Status.st_size;
+	Pointer_File = mmap(NULL, File_Size, PROT_READ, MAP_SHARED, File_Descriptor, 0);
+	close(File_Descriptor); // The mapping stays valid
+	if (Pointer_File == MAP_FAILED) return 0;
+	
+	// Check that the file can be used on this machine
+	Pointer_Header = (TECBinaryHeader *) Pointer_File;
+	if ((memcmp(Pointer_Header->Magic, EC_BINARY_FILE_MAGIC, EC_BINARY_FILE_MAGIC_LENGTH) != 0) || (Pointer_Header->Version != EC_BINARY_FILE_VERSION) || (Pointer_Header->Limb_Size != sizeof(mp_limb_t)) || (Pointer_Header->Byte_Order_Mark != EC_BINARY_FILE_BYTE_ORDER_MARK) || (Pointer_Header->Sections_Count > EC_BINARY_FILE_MAXIMUM_SECTIONS_COUNT) || (Pointer_Header->Limbs_Count == 0)) goto Error;
+	Number_Size = Pointer_Header->Limbs_Count * sizeof(mp_limb_t);
+	
+	// Make the curve numbers point to the mapped parameters
+	Pointer_Section = ECBinaryFindSection(Pointer_Header, File_Size, EC_BINARY_SECTION_PARAMETERS);
+	if ((Pointer_Section == NULL) || (Pointer_Section->Size != EC_BINARY_PARAMETERS_COUNT * Number_Size)) goto Error;
+	Pointer_Limbs = (const mp_limb_t *) (Pointer_File + Pointer_Section->Offset);
+	for (i = 0; i < EC_BINARY_PARAMETERS_COUNT; i++) mpz_roinit_n(Pointer_Numbers[i], Pointer_Limbs + i * Pointer_Header->Limbs_Count, Pointer_Header->Limbs_Count);
+	Pointer_Curve->Point_Generator.Is_Infinite = 0;
+	Pointer_Curve->Is_Read_Only = 1;
+	Pointer_Curve->Model = EC_MODEL_WEIERSTRASS;
+	Pointer_Curve->Pointer_Mapped_File = Pointer_File;
+	Pointer_Curve->Mapped_File_Size = File_Size;
+	if (!ECSelectArithmetic(Pointer_Curve)) goto Error;
+	
+	// Use the mapped generator table if there is one
+	Pointer_Section = ECBinaryFindSection(Pointer_Header, File_Size, EC_BINARY_SECTION_GENERATOR_TABLE);
+	if (Pointer_Section == NULL)
+	{
+		if (!ECPrecomputeGeneratorTable(Pointer_Curve))
+		{
+			ECFree(Pointer_Curve);
+			return 0;
+		}
+		return 1;
+	}
+	
+	// The table must have one row per window of the group order bits, as ECMultiplicationWithTable() reads a row for each window of the reduced factor
+	if ((Pointer_Section->Parameters[0] < 1) || (Pointer_Section->Parameters[0] > 16)) goto Error;
+	Pointer_Table->Window_Size = Pointer_Section->Parameters[0];
+	if (Pointer_Section->Parameters[1] != (mpz_sizeinbase(Pointer_Curve->n, 2) + Pointer_Table->Window_Size - 1) / Pointer_Table->Window_Size) goto Error;
+	Pointer_Table->Windows_Count = Pointer_Section->Parameters[1];
+	
+	// Compute the points count and the section size without overflowing (the windows count is bounded by the group order size, which fits in the parameters section)
+	Digits_Count = (1 << Pointer_Table->Window_Size) - 1;
+	Points_Count = (size_t) Pointer_Table->Windows_Count * Digits_Count;
+	Point_Size = 2 * Number_Size + 1;
+	if ((Points_Count > SIZE_MAX / Point_Size) || (Pointer_Section->Size != Points_Count * Point_Size)) goto Error;
+	
+	Pointer_Table->Pointer_Points = malloc(Points_Count * sizeof(TPoint));
+	if (Pointer_Table->Pointer_Points == NULL) goto Error;
+	Pointer_Table->Is_Read_Only = 1;
+	Pointer_Limbs = (const mp_limb_t *) (Pointer_File + Pointer_Section->Offset);
+	Pointer_Infinity_Flags = Pointer_File + Pointer_Section->Offset + Points_Count * 2 * Number_Size;
+	for (i = 0; i < Points_Count; i++)
+	{
+		mpz_roinit_n(Pointer_Table->Pointer_Points[i].X, Pointer_Limbs + 2 * i * Pointer_Header->Limbs_Count, Pointer_Header->Limbs_Count);
+		mpz_roinit_n(Pointer_Table->Pointer_Points[i].Y, Pointer_Limbs + (2 * i + 1) * Pointer_Header->Limbs_Count, Pointer_Header->Limbs_Count);
+		Pointer_Table->Pointer_Points[i].Is_Infinite = Pointer_Infinity_Flags[i];
+	}
+	return 1;
+	
+Error:
+	munmap(Pointer_File, File_Size);
+	return 0;
+}
+
+int ECSaveToBinaryFile(TEllipticCurve *Pointer_Curve, char *String_Path, int Is_Generator_Table_Saved)
+{
+	FILE *File;
+	TECBinaryHeader Header;
+	TECBinarySection *Pointer_Section;
+	TGeneratorTable *Pointer_Table = &Pointer_Curve->Generator_Table;
+	size_t Limbs_Count = 0, Number_Size;
+	uint64_t Offset;
+	int Points_Count = 0, i;
+	char Is_Infinite;
+	mpz_ptr Pointer_Numbers[EC_BINARY_PARAMETERS_COUNT] = {Pointer_Curve->p, Pointer_Curve->n, Pointer_Curve->a4, Pointer_Curve->a6, Pointer_Curve->h, Pointer_Curve->Point_Generator.X, Pointer_Curve->Point_Generator.Y};
+	
+	if (Pointer_Table->Pointer_Points == NULL) Is_Generator_Table_Saved = 0;
+	if (Is_Generator_Table_Saved) Points_Count = Pointer_Table->Windows_Count * ((1 << Pointer_Table->Window_Size) - 1);
+	
+	// All numbers use the same amount of limbs, which must be enough to store the biggest one
+	for (i = 0; i < EC_BINARY_PARAMETERS_COUNT; i++)
+	{
+		if (mpz_size(Pointer_Numbers[i]) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Numbers[i]);
+	}
+	for (i = 0; i < Points_Count; i++)
+	{
+		if (mpz_size(Pointer_Table->Pointer_Points[i].X) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Table->Pointer_Points[i].X);
+		if (mpz_size(Pointer_Table->Pointer_Points[i].Y) > Limbs_Count) Limbs_Count = mpz_size(Pointer_Table->Pointer_Points[i].Y);
+	}
+	if (Limbs_Count == 0) Limbs_Count = 1;
+	Number_Size = Limbs_Count * sizeof(mp_limb_t);
+	
+	// Fill the header
+	memset(&Header, 0, sizeof(Header));
+	memcpy(Header.Magic, EC_BINARY_FILE_MAGIC, EC_BINARY_FILE_MAGIC_LENGTH);
+	Header.Version = EC_BINARY_FILE_VERSION;
+	Header.Limb_Size = sizeof(mp_limb_t);
+	Header.Byte_Order_Mark = EC_BINARY_FILE_BYTE_ORDER_MARK;
+	Header.Limbs_Count = Limbs_Count;
+	
+	// Place the sections
+	Offset = ECBinaryAlign(sizeof(Header));
+	Pointer_Section = &Header.Sections[Header.Sections_Count++];
+	Pointer_Section->Type = EC_BINARY_SECTION_PARAMETERS;
+	Pointer_Section->Offset = Offset;
+	Pointer_Section->Size = EC_BINARY_PARAMETERS_COUNT * Number_Size;
+	Offset = ECBinaryAlign(Offset + Pointer_Section->Size);
+	
+	if (Is_Generator_Table_Saved)
+	{
+		Pointer_Section = &Header.Sections[Header.Sections_Count++];
+		Pointer_Section->Type = EC_BINARY_SECTION_GENERATOR_TABLE;
+		Pointer_Section->Parameters[0] = Pointer_Table->Window_Size;
+		Pointer_Section->Parameters[1] = Pointer_Table->Windows_Count;
+		Pointer_Section->Offset = Offset;
+		Pointer_Section->Size = Points_Count * (2 * Number_Size + 1);
+	}
+	
+	// Write everything
+	File = fopen(String_Path, "wb");
+	if (File == NULL) return 0;
+	if (fwrite(&Header, sizeof(Header), 1, File) != 1) goto Error;
+	
+	if (!ECBinaryPad(File, Header.Sections[0].Offset)) goto Error;
+	for (i = 0; i < EC_BINARY_PARAMETERS_COUNT; i++)
+	{
+		if (!ECBinaryWriteNumber(File, Pointer_Numbers[i], Limbs_Count)) goto Error;
+	}
+	
+	if (Is_Generator_Table_Saved)
+	{
+		if (!ECBinaryPad(File, Header.Sections[1].Offset)) goto Error;
+		for (i = 0; i < Points_Count; i++)
+		{
+			if (!ECBinaryWriteNumber(File, Pointer_Table->Pointer_Points[i].X, Limbs_Count)) goto Error;
+			if (!ECBinaryWriteNumber(File, Pointer_Table->Pointer_Points[i].Y, Limbs_Count)) goto Error;
+		}
+		for (i = 0; i < Points_Count; i++)
+		{
+			Is_Infinite = Pointer_Table->Pointer_Points[i].Is_Infinite;
+			if (fwrite(&Is_Infinite, 1, 1, File) != 1) goto Error;
+		}
+	}
+	
+	if (fclose(File) != 0) return 0;
+	return 1;
+	
+Error:
+	fclose(File);
+	remove(String_Path);
+	return 0;
+}
@@ -0,0 +1,84 @@
+/** @file Elliptic_Curves_Binary.h
+ * Precompiled binary curve files. They are mapped read-only in memory, so all processes using the same curve share one physical copy and skip parsing and tables generation.
+ *
+ * A file starts with a TECBinaryHeader followed by sections. Each number is stored as a fixed amount of native GMP limbs (least significant limb first),
+ * so GMP numbers can directly point to the mapped memory. Files are thus specific to the limb size and the byte order of the machine which created them.
+ */
+#ifndef H_ELLIPTIC_CURVES_BINARY_H
+#define H_ELLIPTIC_CURVES_BINARY_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Elliptic_Curves.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** File signature. */
+#define EC_BINARY_FILE_MAGIC "ECBINARY"
+/** Signature length in bytes. */
+#define EC_BINARY_FILE_MAGIC_LENGTH 8
+/** Current format version. */
+#define EC_BINARY_FILE_VERSION 1
+/** Written as a native integer to detect byte order mismatches. */
+#define EC_BINARY_FILE_BYTE_ORDER_MARK 0x01020304
+/** Sections are aligned on this amount of bytes. */
+#define EC_BINARY_FILE_ALIGNMENT 64
+/** Maximum amount of sections in a file. */
+#define EC_BINARY_FILE_MAXIMUM_SECTIONS_COUNT 8
+
+/** Curve parameters p, n, a4, a6, h, gx and gy, in this order. */
+#define EC_BINARY_SECTION_PARAMETERS 1
+/** Generator table points (X then Y limbs for each point) followed by one infinity flag byte per point. Parameters[0] is the window size and Parameters[1] the windows count. */
+#define EC_BINARY_SECTION_GENERATOR_TABLE 2
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** Location of a section in the file. */
+typedef struct
+{
+	uint32_t Type; //! Section content (see EC_BINARY_SECTION_xxx constants).
+	uint32_t Parameters[3]; //! Section specific values.
+	uint64_t Offset; //! Offset of the section from the beginning of the file in bytes.
+	uint64_t Size; //! Section size in bytes.
+} TECBinarySection;
+
+/** Binary file header. */
+typedef struct
+{
+	char Magic[EC_BINARY_FILE_MAGIC_LENGTH]; //! Must be EC_BINARY_FILE_MAGIC.
+	uint32_t Version; //! Must be EC_BINARY_FILE_VERSION.
+	uint32_t Limb_Size; //! Size of a GMP limb in bytes.
+	uint32_t Byte_Order_Mark; //! Must be read as EC_BINARY_FILE_BYTE_ORDER_MARK.
+	uint32_t Limbs_Count; //! How many limbs are used to store each number.
+	uint32_t Sections_Count; //! How many sections follow.
+	uint32_t Reserved; //! Keep following fields 64-bit aligned.
+	TECBinarySection Sections[EC_BINARY_FILE_MAXIMUM_SECTIONS_COUNT]; //! Sections location.
+} TECBinaryHeader;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Tell if an opened file is a binary curve file. The file position is modified.
+ * @param File The file to check.
+ * @return 1 if the file starts with the binary file signature or 0 otherwise.
+ */
+int ECIsBinaryFile(FILE *File);
+
+/** Map a binary curve file. All curve numbers and generator table points directly use the mapped memory, the curve must not be modified.
+ * @param String_Path Path to the file.
+ * @param Pointer_Curve Where to store the curve.
+ * @return 0 if the file could not be mapped or is not compatible with this machine, 1 if the curve was successfully loaded.
+ */
+int ECLoadFromBinaryFile(char *String_Path, TEllipticCurve *Pointer_Curve);
+
+/** Save a curve to a binary curve file.
+ * @param Pointer_Curve The curve to save.
+ * @param String_Path Path to the file to create.
+ * @param Is_Generator_Table_Saved Set to 1 to store the generator table (if the curve has one), set to 0 to make a smaller file.
+ * @return 1 if the file was successfully written or 0 if an error occured.
+ */
+int ECSaveToBinaryFile(TEllipticCurve *Pointer_Curve, char *String_Path, int Is_Generator_Table_Saved);
+
+#endif
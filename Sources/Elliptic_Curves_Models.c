@@ -0,0 +1,658 @@
+/** @file Elliptic_Curves_Models.c
+ * Twisted Edwards and Montgomery curves formulas and their conversion to the Weierstrass form.
+ */
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Models.h"
+#include "Instrumentation.h"
+#include "Point.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** How many temporary numbers the twisted Edwards and Montgomery formulas need. */
+#define EC_MODELS_TEMPORARY_NUMBERS_COUNT 6
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** A twisted Edwards point in extended coordinates (x = X / Z, y = Y / Z, x.y = T / Z), the neutral element is (0, 1, 1, 0). */
+typedef struct
+{
+	mpz_t X; //! X coordinate.
+	mpz_t Y; //! Y coordinate.
+	mpz_t Z; //! Z coordinate.
+	mpz_t T; //! T coordinate.
+} TECModelsEdwardsPoint;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Multiply two numbers of the field and reduce the product.
+ * @param Pointer_Curve The curve.
+ * @param Result On output, contain the reduced product (it can be one of the operands).
+ * @param Number_A First operand.
+ * @param Number_B Second operand, when it is the same variable as the first operand the product is counted as a squaring.
+ */
+static inline void ECModelsMultiply(TEllipticCurve *Pointer_Curve, mpz_t Result, mpz_t Number_A, mpz_t Number_B)
+{
+	if (Number_A == Number_B) INSTRUMENTATION_COUNT(Field_Squarings);
+	else INSTRUMENTATION_COUNT(Field_Multiplications);
+	INSTRUMENTATION_COUNT(Reductions);
+	mpz_mul(Result, Number_A, Number_B);
+	Pointer_Curve->Function_Reduce(Pointer_Curve, Result);
+}
+
+/** Get the coefficients of the Montgomery form of the curve, a twisted Edwards curve is mapped to A = 2.(a + d) / (a - d), B = 4 / (a - d).
+ * @param Pointer_Curve The twisted Edwards or Montgomery curve.
+ * @param Output_A On output, contain A.
+ * @param Output_B On output, contain B.
+ * @return 1 if the coefficients describe a non-singular curve (B != 0 and A^2 != 4) or 0 otherwise.
+ */
+static int ECModelsGetMontgomeryCoefficients(TEllipticCurve *Pointer_Curve, mpz_t Output_A, mpz_t Output_B)
+{
+	mpz_t Number_Temp;
+	int Is_Valid = 1;
+	
+	mpz_init(Number_Temp);
+	if (Pointer_Curve->Model == EC_MODEL_MONTGOMERY)
+	{
+		mpz_mod(Output_A, Pointer_Curve->Model_A, Pointer_Curve->p);
+		mpz_mod(Output_B, Pointer_Curve->Model_B, Pointer_Curve->p);
+	}
+	else
+	{
+		// 1 / (a - d)
+		mpz_sub(Number_Temp, Pointer_Curve->Model_A, Pointer_Curve->Model_B);
+		if (!mpz_invert(Number_Temp, Number_Temp, Pointer_Curve->p)) Is_Valid = 0;
+		
+		mpz_add(Output_A, Pointer_Curve->Model_A, Pointer_Curve->Model_B);
+		mpz_mul_2exp(Output_A, Output_A, 1);
+		mpz_mul(Output_A, Output_A, Number_Temp);
+		mpz_mod(Output_A, Output_A, Pointer_Curve->p);
+		mpz_mul_2exp(Output_B, Number_Temp, 2);
+		mpz_mod(Output_B, Output_B, Pointer_Curve->p);
+	}
+	
+	// A twisted Edwards curve with a = 0 or d = 0 gives A = -2 or A = 2
+	mpz_mul(Number_Temp, Output_A, Output_A);
+	mpz_sub_ui(Number_Temp, Number_Temp, 4);
+	if (mpz_divisible_p(Number_Temp, Pointer_Curve->p) || (mpz_sgn(Output_B) == 0)) Is_Valid = 0;
+	
+	mpz_clear(Number_Temp);
+	return Is_Valid;
+}
+
+/** Tell if the twisted Edwards a coefficient is -1, which saves a multiplication in the formulas.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @return 1 if a = -1 (mod p) or 0 otherwise.
+ */
+static int ECModelsIsEdwardsAMinusOne(TEllipticCurve *Pointer_Curve)
+{
+	mpz_t Number_Temp;
+	int Is_Minus_One;
+	
+	mpz_init(Number_Temp);
+	mpz_add_ui(Number_Temp, Pointer_Curve->Model_A, 1);
+	Is_Minus_One = mpz_divisible_p(Number_Temp, Pointer_Curve->p);
+	mpz_clear(Number_Temp);
+	return Is_Minus_One;
+}
+
+/** Create a twisted Edwards point in extended coordinates from an affine point.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Affine_Point The affine point.
+ * @param Pointer_Point The point to initialize.
+ */
+static void ECModelsEdwardsCreate(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Affine_Point, TECModelsEdwardsPoint *Pointer_Point)
+{
+	mpz_init_set(Pointer_Point->X, Pointer_Affine_Point->X);
+	mpz_init_set(Pointer_Point->Y, Pointer_Affine_Point->Y);
+	mpz_init_set_ui(Pointer_Point->Z, 1);
+	mpz_init(Pointer_Point->T);
+	ECModelsMultiply(Pointer_Curve, Pointer_Point->T, Pointer_Point->X, Pointer_Point->Y);
+}
+
+/** Free a twisted Edwards point in extended coordinates.
+ * @param Pointer_Point The point to destroy.
+ */
+static void ECModelsEdwardsFree(TECModelsEdwardsPoint *Pointer_Point)
+{
+	mpz_clear(Pointer_Point->X);
+	mpz_clear(Pointer_Point->Y);
+	mpz_clear(Pointer_Point->Z);
+	mpz_clear(Pointer_Point->T);
+}
+
+/** Swap two twisted Edwards points in extended coordinates without copying their numbers.
+ * @param Pointer_Point_P First point.
+ * @param Pointer_Point_Q Second point.
+ */
+static inline void ECModelsEdwardsSwap(TECModelsEdwardsPoint *Pointer_Point_P, TECModelsEdwardsPoint *Pointer_Point_Q)
+{
+	mpz_swap(Pointer_Point_P->X, Pointer_Point_Q->X);
+	mpz_swap(Pointer_Point_P->Y, Pointer_Point_Q->Y);
+	mpz_swap(Pointer_Point_P->Z, Pointer_Point_Q->Z);
+	mpz_swap(Pointer_Point_P->T, Pointer_Point_Q->T);
+}
+
+/** Convert a twisted Edwards point in extended coordinates to affine coordinates.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Point The point to convert.
+ * @param Pointer_Output_Point The affine point (it must be created by the user).
+ * @return 1 if the point was converted or 0 if it has no affine coordinates (Pointer_Output_Point is not modified then).
+ */
+static int ECModelsEdwardsToAffine(TEllipticCurve *Pointer_Curve, TECModelsEdwardsPoint *Pointer_Point, TPoint *Pointer_Output_Point)
+{
+	// Z is never zero on a complete curve, an incomplete curve can reach a point at infinity which has no affine coordinates
+	if (!ECInvertFieldElement(Pointer_Curve, Pointer_Point->Z, Pointer_Point->Z)) return 0;
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->X, Pointer_Point->X, Pointer_Point->Z);
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->Y, Pointer_Point->Y, Pointer_Point->Z);
+	Pointer_Output_Point->Is_Infinite = 0;
+	return 1;
+}
+
+/** Add two twisted Edwards points with the unified formulas (Hisil, Wong, Carter and Dawson, 2008) :
+ * A = X1.X2, B = Y1.Y2, C = d.T1.T2, D = Z1.Z2, E = (X1 + Y1).(X2 + Y2) - A - B, F = D - C, G = D + C, H = B - a.A, X3 = E.F, Y3 = G.H, T3 = E.H, Z3 = F.G.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Point_P First operand.
+ * @param Pointer_Point_Q Second operand.
+ * @param Pointer_Output_Point The result (it can be one of the operands).
+ * @param Is_A_Minus_One Tell if a = -1, so a.A is a negation.
+ * @param Pointer_Temporary_Numbers EC_MODELS_TEMPORARY_NUMBERS_COUNT initialized numbers.
+ */
+static void ECModelsEdwardsAdd(TEllipticCurve *Pointer_Curve, TECModelsEdwardsPoint *Pointer_Point_P, TECModelsEdwardsPoint *Pointer_Point_Q, TECModelsEdwardsPoint *Pointer_Output_Point, int Is_A_Minus_One, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr A = Pointer_Temporary_Numbers[0], B = Pointer_Temporary_Numbers[1], C = Pointer_Temporary_Numbers[2], D = Pointer_Temporary_Numbers[3], E = Pointer_Temporary_Numbers[4], F = Pointer_Temporary_Numbers[5];
+	
+	INSTRUMENTATION_COUNT(Point_Additions);
+	
+	ECModelsMultiply(Pointer_Curve, A, Pointer_Point_P->X, Pointer_Point_Q->X);
+	ECModelsMultiply(Pointer_Curve, B, Pointer_Point_P->Y, Pointer_Point_Q->Y);
+	ECModelsMultiply(Pointer_Curve, C, Pointer_Point_P->T, Pointer_Point_Q->T);
+	ECModelsMultiply(Pointer_Curve, C, C, Pointer_Curve->Model_B);
+	ECModelsMultiply(Pointer_Curve, D, Pointer_Point_P->Z, Pointer_Point_Q->Z);
+	
+	// E = (X1 + Y1).(X2 + Y2) - A - B
+	mpz_add(E, Pointer_Point_P->X, Pointer_Point_P->Y);
+	mpz_add(F, Pointer_Point_Q->X, Pointer_Point_Q->Y);
+	ECModelsMultiply(Pointer_Curve, E, E, F);
+	mpz_sub(E, E, A);
+	mpz_sub(E, E, B);
+	
+	// F = D - C, G = D + C (stored in D), H = B - a.A (stored in B)
+	mpz_sub(F, D, C);
+	mpz_add(D, D, C);
+	if (Is_A_Minus_One) mpz_add(B, B, A);
+	else
+	{
+		ECModelsMultiply(Pointer_Curve, A, A, Pointer_Curve->Model_A);
+		mpz_sub(B, B, A);
+	}
+	
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->X, E, F);
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->Y, D, B);
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->T, E, B);
+	ECModelsMultiply(Pointer_Curve, Pointer_Output_Point->Z, F, D);
+}
+
+/** Double a twisted Edwards point (Hisil, Wong, Carter and Dawson, 2008), T is not read :
+ * A = X1^2, B = Y1^2, C = 2.Z1^2, D = a.A, E = (X1 + Y1)^2 - A - B, G = D + B, F = G - C, H = D - B, X3 = E.F, Y3 = G.H, T3 = E.H, Z3 = F.G.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Point The point to double, it contains the result on output.
+ * @param Is_A_Minus_One Tell if a = -1, so a.A is a negation.
+ * @param Pointer_Temporary_Numbers EC_MODELS_TEMPORARY_NUMBERS_COUNT initialized numbers.
+ */
+static void ECModelsEdwardsDouble(TEllipticCurve *Pointer_Curve, TECModelsEdwardsPoint *Pointer_Point, int Is_A_Minus_One, mpz_t *Pointer_Temporary_Numbers)
+{
+	mpz_ptr A = Pointer_Temporary_Numbers[0], B = Pointer_Temporary_Numbers[1], C = Pointer_Temporary_Numbers[2], D = Pointer_Temporary_Numbers[3], E = Pointer_Temporary_Numbers[4], F = Pointer_Temporary_Numbers[5];
+	
+	INSTRUMENTATION_COUNT(Point_Doublings);
+	
+	ECModelsMultiply(Pointer_Curve, A, Pointer_Point->X, Pointer_Point->X);
+	ECModelsMultiply(Pointer_Curve, B, Pointer_Point->Y, Pointer_Point->Y);
+	ECModelsMultiply(Pointer_Curve, C, Pointer_Point->Z, Pointer_Point->Z);
+	mpz_mul_2exp(C, C, 1);
+	if (Is_A_Minus_One) mpz_neg(D, A);
+	else ECModelsMultiply(Pointer_Curve, D, A, Pointer_Curve->Model_A);
+	
+	// E = (X1 + Y1)^2 - A - B
+	mpz_add(E, Pointer_Point->X, Pointer_Point->Y);
+	ECModelsMultiply(Pointer_Curve, E, E, E);
+	mpz_sub(E, E, A);
+	mpz_sub(E, E, B);
+	
+	// G = D + B (stored in A), F = G - C, H = D - B (stored in B)
+	mpz_add(A, D, B);
+	mpz_sub(F, A, C);
+	mpz_sub(B, D, B);
+	
+	ECModelsMultiply(Pointer_Curve, Pointer_Point->X, E, F);
+	ECModelsMultiply(Pointer_Curve, Pointer_Point->Y, A, B);
+	ECModelsMultiply(Pointer_Curve, Pointer_Point->T, E, B);
+	ECModelsMultiply(Pointer_Curve, Pointer_Point->Z, F, A);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ECModelsConvertCurveToWeierstrass(TEllipticCurve *Pointer_Curve)
+{
+	mpz_t A, B, Number_Inverse, Number_Temp;
+	int Is_Valid = 0;
+	
+	mpz_init(A);
+	mpz_init(B);
+	mpz_init(Number_Inverse);
+	mpz_init(Number_Temp);
+	
+	// Keep reduced coefficients, so a = -1 can be written in a curve file
+	mpz_mod(Pointer_Curve->Model_A, Pointer_Curve->Model_A, Pointer_Curve->p);
+	mpz_mod(Pointer_Curve->Model_B, Pointer_Curve->Model_B, Pointer_Curve->p);
+	if (!ECModelsGetMontgomeryCoefficients(Pointer_Curve, A, B)) goto Exit;
+	
+	// a4 = (3 - A^2) / (3.B^2)
+	mpz_mul(Number_Temp, B, B);
+	mpz_mul_ui(Number_Temp, Number_Temp, 3);
+	if (!mpz_invert(Number_Inverse, Number_Temp, Pointer_Curve->p)) goto Exit;
+	mpz_mul(Number_Temp, A, A);
+	mpz_ui_sub(Number_Temp, 3, Number_Temp);
+	mpz_mul(Number_Temp, Number_Temp, Number_Inverse);
+	mpz_mod(Pointer_Curve->a4, Number_Temp, Pointer_Curve->p);
+	
+	// a6 = (2.A^3 - 9.A) / (27.B^3)
+	mpz_powm_ui(Number_Temp, B, 3, Pointer_Curve->p);
+	mpz_mul_ui(Number_Temp, Number_Temp, 27);
+	if (!mpz_invert(Number_Inverse, Number_Temp, Pointer_Curve->p)) goto Exit;
+	mpz_mul(Number_Temp, A, A);
+	mpz_mul_ui(Number_Temp, Number_Temp, 2);
+	mpz_sub_ui(Number_Temp, Number_Temp, 9);
+	mpz_mul(Number_Temp, Number_Temp, A);
+	mpz_mul(Number_Temp, Number_Temp, Number_Inverse);
+	mpz_mod(Pointer_Curve->a6, Number_Temp, Pointer_Curve->p);
+	
+	// The generator must not be the neutral element
+	ECModelsPointToWeierstrass(Pointer_Curve, &Pointer_Curve->Point_Generator, &Pointer_Curve->Point_Generator);
+	Is_Valid = !Pointer_Curve->Point_Generator.Is_Infinite;
+	
+Exit:
+	mpz_clear(A);
+	mpz_clear(B);
+	mpz_clear(Number_Inverse);
+	mpz_clear(Number_Temp);
+	return Is_Valid;
+}
+
+void ECModelsPointToWeierstrass(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Model_Point, TPoint *Pointer_Output_Point)
+{
+	mpz_t A, B, U, V, Number_Inverse;
+	
+	if (Pointer_Curve->Model == EC_MODEL_WEIERSTRASS)
+	{
+		if (Pointer_Output_Point != Pointer_Model_Point) PointCopy(Pointer_Model_Point, Pointer_Output_Point);
+		return;
+	}
+	
+	mpz_init(A);
+	mpz_init(B);
+	mpz_init(U);
+	mpz_init(V);
+	mpz_init(Number_Inverse);
+	ECModelsGetMontgomeryCoefficients(Pointer_Curve, A, B);
+	
+	if (Pointer_Curve->Model == EC_MODEL_TWISTED_EDWARDS)
+	{
+		mpz_mod(U, Pointer_Model_Point->X, Pointer_Curve->p);
+		mpz_mod(V, Pointer_Model_Point->Y, Pointer_Curve->p);
+		
+		// (0, 1) is the neutral element
+		if (mpz_cmp_ui(V, 1) == 0)
+		{
+			Pointer_Output_Point->Is_Infinite = 1;
+			goto Exit;
+		}
+		
+		// (0, -1) has order 2 and maps to (0, 0), any other point maps to u = (1 + y) / (1 - y), v = u / x
+		if (mpz_sgn(U) == 0) mpz_set_ui(V, 0);
+		else
+		{
+			mpz_ui_sub(Number_Inverse, 1, V);
+			mpz_invert(Number_Inverse, Number_Inverse, Pointer_Curve->p);
+			mpz_add_ui(V, V, 1);
+			mpz_mul(V, V, Number_Inverse);
+			mpz_invert(Number_Inverse, U, Pointer_Curve->p);
+			mpz_mod(U, V, Pointer_Curve->p);
+			mpz_mul(V, U, Number_Inverse);
+		}
+	}
+	else
+	{
+		if (Pointer_Model_Point->Is_Infinite)
+		{
+			Pointer_Output_Point->Is_Infinite = 1;
+			goto Exit;
+		}
+		mpz_set(U, Pointer_Model_Point->X);
+		mpz_set(V, Pointer_Model_Point->Y);
+	}
+	
+	// x = (3.u + A) / (3.B), y = v / B
+	mpz_mul_ui(Number_Inverse, B, 3);
+	mpz_invert(Number_Inverse, Number_Inverse, Pointer_Curve->p);
+	mpz_mul_ui(U, U, 3);
+	mpz_add(U, U, A);
+	mpz_mul(U, U, Number_Inverse);
+	mpz_mod(Pointer_Output_Point->X, U, Pointer_Curve->p);
+	mpz_invert(Number_Inverse, B, Pointer_Curve->p);
+	mpz_mul(V, V, Number_Inverse);
+	mpz_mod(Pointer_Output_Point->Y, V, Pointer_Curve->p);
+	Pointer_Output_Point->Is_Infinite = 0;
+	
+Exit:
+	mpz_clear(A);
+	mpz_clear(B);
+	mpz_clear(U);
+	mpz_clear(V);
+	mpz_clear(Number_Inverse);
+}
+
+int ECModelsPointFromWeierstrass(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, TPoint *Pointer_Output_Model_Point)
+{
+	mpz_t A, B, U, V, Number_Inverse;
+	int Is_Converted = 1;
+	
+	if (Pointer_Curve->Model == EC_MODEL_WEIERSTRASS)
+	{
+		if (Pointer_Output_Model_Point != Pointer_Point) PointCopy(Pointer_Point, Pointer_Output_Model_Point);
+		return 1;
+	}
+	
+	// The point at infinity is the twisted Edwards neutral element
+	if (Pointer_Point->Is_Infinite)
+	{
+		if (Pointer_Curve->Model == EC_MODEL_TWISTED_EDWARDS)
+		{
+			mpz_set_ui(Pointer_Output_Model_Point->X, 0);
+			mpz_set_ui(Pointer_Output_Model_Point->Y, 1);
+			Pointer_Output_Model_Point->Is_Infinite = 0;
+		}
+		else Pointer_Output_Model_Point->Is_Infinite = 1;
+		return 1;
+	}
+	
+	mpz_init(A);
+	mpz_init(B);
+	mpz_init(U);
+	mpz_init(V);
+	mpz_init(Number_Inverse);
+	ECModelsGetMontgomeryCoefficients(Pointer_Curve, A, B);
+	
+	// u = (3.B.x - A) / 3, v = B.y
+	mpz_mul(U, B, Pointer_Point->X);
+	mpz_mul_ui(U, U, 3);
+	mpz_sub(U, U, A);
+	mpz_set_ui(Number_Inverse, 3);
+	mpz_invert(Number_Inverse, Number_Inverse, Pointer_Curve->p);
+	mpz_mul(U, U, Number_Inverse);
+	mpz_mod(U, U, Pointer_Curve->p);
+	mpz_mul(V, B, Pointer_Point->Y);
+	mpz_mod(V, V, Pointer_Curve->p);
+	
+	if (Pointer_Curve->Model == EC_MODEL_MONTGOMERY)
+	{
+		mpz_swap(Pointer_Output_Model_Point->X, U);
+		mpz_swap(Pointer_Output_Model_Point->Y, V);
+		Pointer_Output_Model_Point->Is_Infinite = 0;
+		goto Exit;
+	}
+	
+	// (0, 0) maps to (0, -1), the other points of order 2 and the points with u = -1 are at infinity on the twisted Edwards curve
+	if (mpz_sgn(V) == 0)
+	{
+		if (mpz_sgn(U) == 0)
+		{
+			mpz_set_ui(Pointer_Output_Model_Point->X, 0);
+			mpz_sub_ui(Pointer_Output_Model_Point->Y, Pointer_Curve->p, 1);
+			Pointer_Output_Model_Point->Is_Infinite = 0;
+		}
+		else Is_Converted = 0;
+		goto Exit;
+	}
+	mpz_add_ui(A, U, 1);
+	if (mpz_cmp(A, Pointer_Curve->p) == 0)
+	{
+		Is_Converted = 0;
+		goto Exit;
+	}
+	
+	// x = u / v, y = (u - 1) / (u + 1)
+	mpz_invert(Number_Inverse, V, Pointer_Curve->p);
+	mpz_mul(V, U, Number_Inverse);
+	mpz_mod(Pointer_Output_Model_Point->X, V, Pointer_Curve->p);
+	mpz_invert(Number_Inverse, A, Pointer_Curve->p);
+	mpz_sub_ui(U, U, 1);
+	mpz_mul(U, U, Number_Inverse);
+	mpz_mod(Pointer_Output_Model_Point->Y, U, Pointer_Curve->p);
+	Pointer_Output_Model_Point->Is_Infinite = 0;
+	
+Exit:
+	mpz_clear(A);
+	mpz_clear(B);
+	mpz_clear(U);
+	mpz_clear(V);
+	mpz_clear(Number_Inverse);
+	return Is_Converted;
+}
+
+int ECModelsIsPointOnCurve(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Model_Point)
+{
+	mpz_t Number_Left, Number_Right, Number_Temp;
+	int Is_On_Curve;
+	
+	if (Pointer_Curve->Model == EC_MODEL_WEIERSTRASS) return ECIsPointOnCurve(Pointer_Curve, Pointer_Model_Point);
+	if (Pointer_Model_Point->Is_Infinite) return Pointer_Curve->Model == EC_MODEL_MONTGOMERY;
+	
+	mpz_init(Number_Left);
+	mpz_init(Number_Right);
+	mpz_init(Number_Temp);
+	
+	// a.x^2 + y^2 = 1 + d.x^2.y^2
+	if (Pointer_Curve->Model == EC_MODEL_TWISTED_EDWARDS)
+	{
+		mpz_mul(Number_Temp, Pointer_Model_Point->X, Pointer_Model_Point->X);
+		mpz_mul(Number_Left, Pointer_Curve->Model_A, Number_Temp);
+		mpz_mul(Number_Right, Pointer_Model_Point->Y, Pointer_Model_Point->Y);
+		mpz_add(Number_Left, Number_Left, Number_Right);
+		mpz_mul(Number_Right, Number_Right, Number_Temp);
+		mpz_mul(Number_Right, Number_Right, Pointer_Curve->Model_B);
+		mpz_add_ui(Number_Right, Number_Right, 1);
+	}
+	// B.y^2 = x^3 + A.x^2 + x
+	else
+	{
+		mpz_mul(Number_Left, Pointer_Model_Point->Y, Pointer_Model_Point->Y);
+		mpz_mul(Number_Left, Number_Left, Pointer_Curve->Model_B);
+		mpz_add(Number_Right, Pointer_Model_Point->X, Pointer_Curve->Model_A);
+		mpz_mul(Number_Right, Number_Right, Pointer_Model_Point->X);
+		mpz_add_ui(Number_Right, Number_Right, 1);
+		mpz_mul(Number_Right, Number_Right, Pointer_Model_Point->X);
+	}
+	mpz_sub(Number_Temp, Number_Left, Number_Right);
+	Is_On_Curve = mpz_divisible_p(Number_Temp, Pointer_Curve->p);
+	
+	mpz_clear(Number_Left);
+	mpz_clear(Number_Right);
+	mpz_clear(Number_Temp);
+	return Is_On_Curve;
+}
+
+int ECModelsEdwardsAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *Pointer_Point_Q, TPoint *Pointer_Output_Point)
+{
+	TECModelsEdwardsPoint Point_P, Point_Q;
+	mpz_t Temporary_Numbers[EC_MODELS_TEMPORARY_NUMBERS_COUNT];
+	int i, Is_Affine;
+	
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	ECModelsEdwardsCreate(Pointer_Curve, Pointer_Point_P, &Point_P);
+	ECModelsEdwardsCreate(Pointer_Curve, Pointer_Point_Q, &Point_Q);
+	
+	ECModelsEdwardsAdd(Pointer_Curve, &Point_P, &Point_Q, &Point_P, ECModelsIsEdwardsAMinusOne(Pointer_Curve), Temporary_Numbers);
+	Is_Affine = ECModelsEdwardsToAffine(Pointer_Curve, &Point_P, Pointer_Output_Point);
+	
+	ECModelsEdwardsFree(&Point_P);
+	ECModelsEdwardsFree(&Point_Q);
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	return Is_Affine;
+}
+
+int ECModelsEdwardsMultiplication(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Factor, TPoint *Pointer_Output_Point)
+{
+	TECModelsEdwardsPoint Point_R0, Point_R1;
+	TPoint Point_Neutral;
+	mpz_t Temporary_Numbers[EC_MODELS_TEMPORARY_NUMBERS_COUNT];
+	int i, Bit, Is_A_Minus_One, Is_Affine;
+	
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	Is_A_Minus_One = ECModelsIsEdwardsAMinusOne(Pointer_Curve);
+	
+	// R0 = O, R1 = P
+	PointCreate(0, 1, &Point_Neutral);
+	ECModelsEdwardsCreate(Pointer_Curve, &Point_Neutral, &Point_R0);
+	ECModelsEdwardsCreate(Pointer_Curve, Pointer_Point, &Point_R1);
+	
+	// Same ladder as ECMultiplicationXOnly(), the complete formulas need no test on the points
+	for (i = mpz_sizeinbase(Factor, 2) - 1; i >= 0; i--)
+	{
+		Bit = mpz_tstbit(Factor, i);
+		if (Bit) ECModelsEdwardsSwap(&Point_R0, &Point_R1);
+		ECModelsEdwardsAdd(Pointer_Curve, &Point_R0, &Point_R1, &Point_R1, Is_A_Minus_One, Temporary_Numbers);
+		ECModelsEdwardsDouble(Pointer_Curve, &Point_R0, Is_A_Minus_One, Temporary_Numbers);
+		if (Bit) ECModelsEdwardsSwap(&Point_R0, &Point_R1);
+	}
+	Is_Affine = ECModelsEdwardsToAffine(Pointer_Curve, &Point_R0, Pointer_Output_Point);
+	
+	PointFree(&Point_Neutral);
+	ECModelsEdwardsFree(&Point_R0);
+	ECModelsEdwardsFree(&Point_R1);
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	return Is_Affine;
+}
+
+int ECModelsMontgomeryLadder(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X)
+{
+	mpz_t A24, X1, X2, Z2, X3, Z3, Temporary_Numbers[EC_MODELS_TEMPORARY_NUMBERS_COUNT];
+	mpz_ptr Sum_2 = Temporary_Numbers[0], Difference_2 = Temporary_Numbers[1], Sum_3 = Temporary_Numbers[2], Difference_3 = Temporary_Numbers[3];
+	int i, Bit, Is_Swapped = 0, Is_Finite;
+	
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_init(Temporary_Numbers[i]);
+	
+	// a24 = (A - 2) / 4
+	mpz_init_set_ui(A24, 4);
+	mpz_invert(A24, A24, Pointer_Curve->p);
+	mpz_sub_ui(Sum_2, Pointer_Curve->Model_A, 2);
+	mpz_mul(A24, A24, Sum_2);
+	mpz_mod(A24, A24, Pointer_Curve->p);
+	
+	// (X2 : Z2) = O, (X3 : Z3) = P
+	mpz_init(X1);
+	mpz_mod(X1, X, Pointer_Curve->p);
+	mpz_init_set_ui(X2, 1);
+	mpz_init_set_ui(Z2, 0);
+	mpz_init_set(X3, X1);
+	mpz_init_set_ui(Z3, 1);
+	
+	for (i = mpz_sizeinbase(Factor, 2) - 1; i >= 0; i--)
+	{
+		// Swap the points only when the bit differs from the previous one
+		Bit = mpz_tstbit(Factor, i);
+		if (Is_Swapped ^ Bit)
+		{
+			mpz_swap(X2, X3);
+			mpz_swap(Z2, Z3);
+		}
+		Is_Swapped = Bit;
+		
+		INSTRUMENTATION_COUNT(Point_Additions);
+		INSTRUMENTATION_COUNT(Point_Doublings);
+		mpz_add(Sum_2, X2, Z2);
+		mpz_sub(Difference_2, X2, Z2);
+		mpz_add(Sum_3, X3, Z3);
+		mpz_sub(Difference_3, X3, Z3);
+		ECModelsMultiply(Pointer_Curve, Difference_3, Difference_3, Sum_2); // DA
+		ECModelsMultiply(Pointer_Curve, Sum_3, Sum_3, Difference_2); // CB
+		ECModelsMultiply(Pointer_Curve, Sum_2, Sum_2, Sum_2); // AA
+		ECModelsMultiply(Pointer_Curve, Difference_2, Difference_2, Difference_2); // BB
+		
+		// X3 = (DA + CB)^2, Z3 = X1.(DA - CB)^2
+		mpz_add(X3, Difference_3, Sum_3);
+		ECModelsMultiply(Pointer_Curve, X3, X3, X3);
+		mpz_sub(Z3, Difference_3, Sum_3);
+		ECModelsMultiply(Pointer_Curve, Z3, Z3, Z3);
+		ECModelsMultiply(Pointer_Curve, Z3, Z3, X1);
+		
+		// X2 = AA.BB, Z2 = E.(AA + a24.E) where E = AA - BB
+		ECModelsMultiply(Pointer_Curve, X2, Sum_2, Difference_2);
+		mpz_sub(Difference_2, Sum_2, Difference_2);
+		ECModelsMultiply(Pointer_Curve, Sum_3, Difference_2, A24);
+		mpz_add(Sum_3, Sum_3, Sum_2);
+		ECModelsMultiply(Pointer_Curve, Z2, Difference_2, Sum_3);
+	}
+	if (Is_Swapped)
+	{
+		mpz_swap(X2, X3);
+		mpz_swap(Z2, Z3);
+	}
+	
+	// Convert (X2 : Z2) to an affine coordinate
+	Is_Finite = (mpz_sgn(Z2) != 0);
+	if (Is_Finite)
+	{
+		ECInvertFieldElement(Pointer_Curve, Z2, Z2);
+		ECModelsMultiply(Pointer_Curve, Output_X, X2, Z2);
+	}
+	
+	// Free resources
+	mpz_clear(A24);
+	mpz_clear(X1);
+	mpz_clear(X2);
+	mpz_clear(Z2);
+	mpz_clear(X3);
+	mpz_clear(Z3);
+	for (i = 0; i < EC_MODELS_TEMPORARY_NUMBERS_COUNT; i++) mpz_clear(Temporary_Numbers[i]);
+	return Is_Finite;
+}
+
+int ECModelsMontgomeryMultiplicationXOnly(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X)
+{
+	mpz_t A, B, U, A_Over_3;
+	int Is_Finite;
+	
+	mpz_init(A);
+	mpz_init(B);
+	mpz_init(U);
+	mpz_init_set_ui(A_Over_3, 3);
+	ECModelsGetMontgomeryCoefficients(Pointer_Curve, A, B);
+	mpz_invert(A_Over_3, A_Over_3, Pointer_Curve->p);
+	mpz_mul(A_Over_3, A_Over_3, A);
+	
+	// u = B.x - A / 3
+	mpz_mul(U, B, X);
+	mpz_sub(U, U, A_Over_3);
+	mpz_mod(U, U, Pointer_Curve->p);
+	
+	// x = (u + A / 3) / B
+	Is_Finite = ECModelsMontgomeryLadder(Pointer_Curve, U, Factor, U);
+	if (Is_Finite)
+	{
+		mpz_invert(B, B, Pointer_Curve->p);
+		mpz_add(U, U, A_Over_3);
+		mpz_mul(U, U, B);
+		mpz_mod(Output_X, U, Pointer_Curve->p);
+	}
+	
+	mpz_clear(A);
+	mpz_clear(B);
+	mpz_clear(U);
+	mpz_clear(A_Over_3);
+	return Is_Finite;
+}
@@ -0,0 +1,85 @@
+/** @file Elliptic_Curves_Models.h
+ * Twisted Edwards curves a.x^2 + y^2 = 1 + d.x^2.y^2 and Montgomery curves B.y^2 = x^3 + A.x^2 + x (see EC_MODEL_TWISTED_EDWARDS and EC_MODEL_MONTGOMERY).
+ * Such a curve is loaded with its Weierstrass equivalent, so all Elliptic_Curves.h functions and protocols work on it with Weierstrass points. The functions below convert points between
+ * both forms and compute with the model own formulas, which have no special case : the twisted Edwards addition is unified (it can double a point) and complete when a is a square and d
+ * is not (like Ed25519), so it never tests for the neutral element, opposite or equal points. The Montgomery ladder only needs the X coordinate (like X25519).
+ * Twisted Edwards points are affine points whose neutral element is (0, 1), they are never flagged infinite.
+ */
+#ifndef H_ELLIPTIC_CURVES_MODELS_H
+#define H_ELLIPTIC_CURVES_MODELS_H
+
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Compute the Weierstrass parameters of a twisted Edwards or Montgomery curve and convert its generator. A twisted Edwards curve is first mapped to the Montgomery curve
+ * A = 2.(a + d) / (a - d), B = 4 / (a - d), then the Montgomery curve is mapped to y^2 = x^3 + a4.x + a6 with a4 = (3 - A^2) / (3.B^2) and a6 = (2.A^3 - 9.A) / (27.B^3).
+ * ECLoadFromFile() calls it when the file describes another model.
+ * @param Pointer_Curve The curve, p, Model, Model_A, Model_B and the generator in model coordinates must be set. On output, a4, a6 and the generator are set to their Weierstrass values.
+ * @return 1 if the curve was converted or 0 if its parameters describe a singular curve.
+ */
+int ECModelsConvertCurveToWeierstrass(TEllipticCurve *Pointer_Curve);
+
+/** Convert a point of the curve model to the Weierstrass form.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Model_Point The point in model coordinates.
+ * @param Pointer_Output_Point On output, contain the Weierstrass point (the point must be created by the user, it can be the model point).
+ */
+void ECModelsPointToWeierstrass(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Model_Point, TPoint *Pointer_Output_Point);
+
+/** Convert a Weierstrass point to the curve model coordinates.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Point The Weierstrass point.
+ * @param Pointer_Output_Model_Point On output, contain the point in model coordinates (the point must be created by the user, it can be the Weierstrass point).
+ * @return 1 if the point was converted or 0 if it has no affine image on the twisted Edwards curve (only possible when the curve is not complete).
+ */
+int ECModelsPointFromWeierstrass(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, TPoint *Pointer_Output_Model_Point);
+
+/** Tell if a point lies on the curve, in model coordinates.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Model_Point The point to check.
+ * @return 1 if the point lies on the curve or 0 otherwise.
+ */
+int ECModelsIsPointOnCurve(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Model_Point);
+
+/** Add two points of a twisted Edwards curve with the unified formulas, the points can be equal, opposite or neutral.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Point_P First operand.
+ * @param Pointer_Point_Q Second operand.
+ * @param Pointer_Output_Point The result (the point must be created by the user, it can be one of the operands).
+ * @return 1 if the result was computed or 0 if it has no affine coordinates (only possible when the curve is not complete, Pointer_Output_Point is not modified then).
+ */
+int ECModelsEdwardsAddition(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_P, TPoint *Pointer_Point_Q, TPoint *Pointer_Output_Point);
+
+/** Multiply a point of a twisted Edwards curve with a scalar value. A Montgomery ladder on extended coordinates (x = X / Z, y = Y / Z, x.y = T / Z) does one addition and one doubling per factor bit.
+ * @param Pointer_Curve The twisted Edwards curve.
+ * @param Pointer_Point The point to multiply.
+ * @param Factor The scalar value to multiply the point with.
+ * @param Pointer_Output_Point The result (the point must be created by the user, it can be the multiplied point).
+ * @return 1 if the result was computed or 0 if it has no affine coordinates (only possible when the curve is not complete, Pointer_Output_Point is not modified then).
+ */
+int ECModelsEdwardsMultiplication(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point, mpz_t Factor, TPoint *Pointer_Output_Point);
+
+/** Multiply a point of a Montgomery curve known only by its X coordinate with a scalar value, with the ladder of RFC 7748 (which does not depend on B).
+ * @param Pointer_Curve The Montgomery curve.
+ * @param X The X coordinate of the point to multiply.
+ * @param Factor The scalar value to multiply the point with.
+ * @param Output_X On output, contain the X coordinate of the result (it can be the same variable as X).
+ * @return 1 if the result is a finite point or 0 if it is the point at infinity (Output_X is not modified then).
+ */
+int ECModelsMontgomeryLadder(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X);
+
+/** Multiply a point of a Montgomery curve known only by its Weierstrass X coordinate with a scalar value. The coordinate is mapped to u = B.x - A / 3, multiplied with
+ * ECModelsMontgomeryLadder() and mapped back, the ladder is cheaper than the Weierstrass one by far more than the mapping cost. ECMultiplicationXOnly() calls it for Montgomery curves.
+ * @param Pointer_Curve The Montgomery curve.
+ * @param X The Weierstrass X coordinate of the point to multiply.
+ * @param Factor The scalar value to multiply the point with.
+ * @param Output_X On output, contain the Weierstrass X coordinate of the result (it can be the same variable as X).
+ * @return 1 if the result is a finite point or 0 if it is the point at infinity (Output_X is not modified then).
+ */
+int ECModelsMontgomeryMultiplicationXOnly(TEllipticCurve *Pointer_Curve, mpz_t X, mpz_t Factor, mpz_t Output_X);
+
+#endif
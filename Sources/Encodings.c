@@ -0,0 +1,362 @@
+/** @file Encodings.c
+ * See Encodings.h for description.
+ */
+#include <string.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Encodings.h"
+#include "Point.h"
+#include "Protocols.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The DER tag of an integer. */
+#define ENCODING_DER_TAG_INTEGER 0x02
+/** The DER tag of a sequence. */
+#define ENCODING_DER_TAG_SEQUENCE 0x30
+
+/** The SEC1 form of the point at infinity. */
+#define ENCODING_SEC1_INFINITY 0x00
+/** The SEC1 compressed form prefix, the Y parity is added to it. */
+#define ENCODING_SEC1_COMPRESSED 0x02
+/** The SEC1 uncompressed form prefix. */
+#define ENCODING_SEC1_UNCOMPRESSED 0x04
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Tell how many bytes the content of a DER integer takes.
+ * @param Number The number, it must not be negative.
+ * @return The content size, including the leading zero byte needed when the number most significant bit is set.
+ */
+static size_t EncodingGetDERIntegerSize(mpz_t Number)
+{
+	size_t Bits_Count;
+	
+	// 0 is a single zero byte
+	if (mpz_sgn(Number) == 0) return 1;
+	
+	// A set most significant bit would make the integer negative
+	Bits_Count = mpz_sizeinbase(Number, 2);
+	return Bits_Count / 8 + 1;
+}
+
+/** Tell how many bytes a DER length takes.
+ * @param Length The length.
+ * @return The length size.
+ */
+static inline size_t EncodingGetDERLengthSize(size_t Length)
+{
+	if (Length < 0x80) return 1;
+	if (Length <= 0xFF) return 2;
+	return 3;
+}
+
+/** Write a DER length with the fewest bytes (the signatures lengths always fit in 2 bytes).
+ * @param Length The length.
+ * @param Pointer_Output_Buffer On output, contain the length.
+ * @return How many bytes were written.
+ */
+static size_t EncodingWriteDERLength(size_t Length, unsigned char *Pointer_Output_Buffer)
+{
+	if (Length < 0x80)
+	{
+		Pointer_Output_Buffer[0] = (unsigned char) Length;
+		return 1;
+	}
+	if (Length <= 0xFF)
+	{
+		Pointer_Output_Buffer[0] = 0x81;
+		Pointer_Output_Buffer[1] = (unsigned char) Length;
+		return 2;
+	}
+	Pointer_Output_Buffer[0] = 0x82;
+	Pointer_Output_Buffer[1] = (unsigned char) (Length >> 8);
+	Pointer_Output_Buffer[2] = (unsigned char) Length;
+	return 3;
+}
+
+/** Write a DER integer.
+ * @param Number The number, it must not be negative.
+ * @param Content_Size The size given by EncodingGetDERIntegerSize().
+ * @param Pointer_Output_Buffer On output, contain the integer.
+ * @return How many bytes were written.
+ */
+static size_t EncodingWriteDERInteger(mpz_t Number, size_t Content_Size, unsigned char *Pointer_Output_Buffer)
+{
+	size_t Header_Size;
+	
+	Pointer_Output_Buffer[0] = ENCODING_DER_TAG_INTEGER;
+	Header_Size = 1 + EncodingWriteDERLength(Content_Size, Pointer_Output_Buffer + 1);
+	
+	// The number fills the lowest bytes, the leading zero byte is written by the padding
+	ProtocolExportNumber(Number, Content_Size, Pointer_Output_Buffer + Header_Size);
+	return Header_Size + Content_Size;
+}
+
+/** Read a DER length, only the distinguished form is accepted.
+ * @param Pointer_Buffer The length.
+ * @param Buffer_Size How many bytes can be read.
+ * @param Pointer_Output_Length On output, contain the length.
+ * @return How many bytes the length takes or 0 if it is malformed, not minimal or longer than 2 bytes.
+ */
+static inline size_t EncodingReadDERLength(const unsigned char *Pointer_Buffer, size_t Buffer_Size, size_t *Pointer_Output_Length)
+{
+	if (Buffer_Size < 1) return 0;
+	
+	// Short form
+	if (Pointer_Buffer[0] < 0x80)
+	{
+		*Pointer_Output_Length = Pointer_Buffer[0];
+		return 1;
+	}
+	
+	// Long forms, the short form must have been used for lengths below 0x80 and a single byte for lengths below 0x100
+	if ((Pointer_Buffer[0] == 0x81) && (Buffer_Size >= 2) && (Pointer_Buffer[1] >= 0x80))
+	{
+		*Pointer_Output_Length = Pointer_Buffer[1];
+		return 2;
+	}
+	if ((Pointer_Buffer[0] == 0x82) && (Buffer_Size >= 3) && (Pointer_Buffer[1] != 0))
+	{
+		*Pointer_Output_Length = ((size_t) Pointer_Buffer[1] << 8) | Pointer_Buffer[2];
+		return 3;
+	}
+	return 0;
+}
+
+/** Read a non-negative DER integer, only the distinguished form is accepted.
+ * @param Pointer_Buffer The integer.
+ * @param Buffer_Size How many bytes can be read.
+ * @param Pointer_Output_Pointer_Number On output, point to the number bytes (without the leading zero byte).
+ * @param Pointer_Output_Number_Size On output, contain the number size.
+ * @return How many bytes the integer takes or 0 if it is malformed, negative or not minimal.
+ */
+static inline size_t EncodingReadDERInteger(const unsigned char *Pointer_Buffer, size_t Buffer_Size, const unsigned char **Pointer_Output_Pointer_Number, size_t *Pointer_Output_Number_Size)
+{
+	size_t Header_Size, Length;
+	
+	if ((Buffer_Size < 1) || (Pointer_Buffer[0] != ENCODING_DER_TAG_INTEGER)) return 0;
+	Header_Size = EncodingReadDERLength(Pointer_Buffer + 1, Buffer_Size - 1, &Length);
+	if (Header_Size == 0) return 0;
+	Header_Size++;
+	if ((Length == 0) || (Length > Buffer_Size - Header_Size)) return 0;
+	Pointer_Buffer += Header_Size;
+	
+	// The most significant bit is the sign
+	if (Pointer_Buffer[0] & 0x80) return 0;
+	
+	// A leading zero byte is only allowed to clear the sign bit
+	if ((Length > 1) && (Pointer_Buffer[0] == 0))
+	{
+		if (!(Pointer_Buffer[1] & 0x80)) return 0;
+		*Pointer_Output_Pointer_Number = Pointer_Buffer + 1;
+		*Pointer_Output_Number_Size = Length - 1;
+	}
+	else
+	{
+		*Pointer_Output_Pointer_Number = Pointer_Buffer;
+		*Pointer_Output_Number_Size = Length;
+	}
+	return Header_Size + Length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int EncodingExportPrivateKey(TEllipticCurve *Pointer_Curve, mpz_t Private_Key, unsigned char *Pointer_Output_Buffer)
+{
+	if (!ProtocolIsNumberInBounds(Private_Key, Pointer_Curve->n)) return 0;
+	return ProtocolExportNumber(Private_Key, ProtocolGetScalarSize(Pointer_Curve), Pointer_Output_Buffer);
+}
+
+int EncodingImportPrivateKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, mpz_t Output_Private_Key)
+{
+	ProtocolImportNumber(Pointer_Buffer, ProtocolGetScalarSize(Pointer_Curve), Output_Private_Key);
+	return ProtocolIsNumberInBounds(Output_Private_Key, Pointer_Curve->n);
+}
+
+int EncodingExportRawPublicKey(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, unsigned char *Pointer_Output_Buffer)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	
+	if (Pointer_Point_Public_Key->Is_Infinite) return 0;
+	if ((mpz_cmp(Pointer_Point_Public_Key->X, Pointer_Curve->p) >= 0) || (mpz_cmp(Pointer_Point_Public_Key->Y, Pointer_Curve->p) >= 0)) return 0;
+	if (!ProtocolExportNumber(Pointer_Point_Public_Key->X, Field_Element_Size, Pointer_Output_Buffer)) return 0;
+	return ProtocolExportNumber(Pointer_Point_Public_Key->Y, Field_Element_Size, Pointer_Output_Buffer + Field_Element_Size);
+}
+
+int EncodingImportRawPublicKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, TPoint *Pointer_Output_Point_Public_Key)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	
+	ProtocolImportNumber(Pointer_Buffer, Field_Element_Size, Pointer_Output_Point_Public_Key->X);
+	ProtocolImportNumber(Pointer_Buffer + Field_Element_Size, Field_Element_Size, Pointer_Output_Point_Public_Key->Y);
+	Pointer_Output_Point_Public_Key->Is_Infinite = 0;
+	
+	if ((mpz_cmp(Pointer_Output_Point_Public_Key->X, Pointer_Curve->p) >= 0) || (mpz_cmp(Pointer_Output_Point_Public_Key->Y, Pointer_Curve->p) >= 0)) return 0;
+	return ECIsPointOnCurve(Pointer_Curve, Pointer_Output_Point_Public_Key);
+}
+
+size_t EncodingExportSEC1PublicKey(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, int Is_Compressed, unsigned char *Pointer_Output_Buffer)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	
+	if (Pointer_Point_Public_Key->Is_Infinite)
+	{
+		Pointer_Output_Buffer[0] = ENCODING_SEC1_INFINITY;
+		return 1;
+	}
+	
+	// Only the parity of Y is needed to find it back from X
+	if (Is_Compressed)
+	{
+		if (mpz_cmp(Pointer_Point_Public_Key->X, Pointer_Curve->p) >= 0) return 0;
+		Pointer_Output_Buffer[0] = ENCODING_SEC1_COMPRESSED | mpz_odd_p(Pointer_Point_Public_Key->Y);
+		if (!ProtocolExportNumber(Pointer_Point_Public_Key->X, Field_Element_Size, Pointer_Output_Buffer + 1)) return 0;
+		return 1 + Field_Element_Size;
+	}
+	
+	Pointer_Output_Buffer[0] = ENCODING_SEC1_UNCOMPRESSED;
+	if (!EncodingExportRawPublicKey(Pointer_Curve, Pointer_Point_Public_Key, Pointer_Output_Buffer + 1)) return 0;
+	return 1 + 2 * Field_Element_Size;
+}
+
+int EncodingImportSEC1PublicKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, size_t Buffer_Size, TPoint *Pointer_Output_Point_Public_Key)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	
+	if (Buffer_Size < 1) return 0;
+	
+	// Point at infinity
+	if ((Buffer_Size == 1) && (Pointer_Buffer[0] == ENCODING_SEC1_INFINITY))
+	{
+		Pointer_Output_Point_Public_Key->Is_Infinite = 1;
+		return 1;
+	}
+	
+	// Compressed form
+	if ((Buffer_Size == 1 + Field_Element_Size) && ((Pointer_Buffer[0] & ~1) == ENCODING_SEC1_COMPRESSED))
+	{
+		ProtocolImportNumber(Pointer_Buffer + 1, Field_Element_Size, Pointer_Output_Point_Public_Key->X);
+		return ECDecompressPoint(Pointer_Curve, Pointer_Output_Point_Public_Key->X, Pointer_Buffer[0] & 1, Pointer_Output_Point_Public_Key);
+	}
+	
+	// Uncompressed form
+	if ((Buffer_Size == 1 + 2 * Field_Element_Size) && (Pointer_Buffer[0] == ENCODING_SEC1_UNCOMPRESSED)) return EncodingImportRawPublicKey(Pointer_Curve, Pointer_Buffer + 1, Pointer_Output_Point_Public_Key);
+	return 0;
+}
+
+int EncodingExportRawSignature(TEllipticCurve *Pointer_Curve, mpz_t Number_U, mpz_t Number_V, unsigned char *Pointer_Output_Buffer)
+{
+	size_t Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	
+	if (!ProtocolExportNumber(Number_U, Scalar_Size, Pointer_Output_Buffer)) return 0;
+	return ProtocolExportNumber(Number_V, Scalar_Size, Pointer_Output_Buffer + Scalar_Size);
+}
+
+void EncodingImportRawSignature(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, mpz_t Output_Number_U, mpz_t Output_Number_V)
+{
+	size_t Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	
+	ProtocolImportNumber(Pointer_Buffer, Scalar_Size, Output_Number_U);
+	ProtocolImportNumber(Pointer_Buffer + Scalar_Size, Scalar_Size, Output_Number_V);
+}
+
+size_t EncodingExportDERSignature(mpz_t Number_U, mpz_t Number_V, unsigned char *Pointer_Output_Buffer, size_t Buffer_Size)
+{
+	size_t U_Size, V_Size, Sequence_Size, Offset;
+	
+	if ((mpz_sgn(Number_U) < 0) || (mpz_sgn(Number_V) < 0)) return 0;
+	
+	// Compute the sizes first to write the sequence length before its content
+	U_Size = EncodingGetDERIntegerSize(Number_U);
+	V_Size = EncodingGetDERIntegerSize(Number_V);
+	Sequence_Size = 1 + EncodingGetDERLengthSize(U_Size) + U_Size + 1 + EncodingGetDERLengthSize(V_Size) + V_Size;
+	if ((Sequence_Size > 0xFFFF) || (1 + EncodingGetDERLengthSize(Sequence_Size) + Sequence_Size > Buffer_Size)) return 0;
+	
+	Pointer_Output_Buffer[0] = ENCODING_DER_TAG_SEQUENCE;
+	Offset = 1 + EncodingWriteDERLength(Sequence_Size, Pointer_Output_Buffer + 1);
+	Offset += EncodingWriteDERInteger(Number_U, U_Size, Pointer_Output_Buffer + Offset);
+	Offset += EncodingWriteDERInteger(Number_V, V_Size, Pointer_Output_Buffer + Offset);
+	return Offset;
+}
+
+size_t EncodingDecodeDERSignature(const unsigned char *Pointer_Buffer, size_t Buffer_Size, TEncodingSignatureView *Pointer_Output_View)
+{
+	size_t Header_Size, Sequence_Size, U_Size, V_Size;
+	
+	if ((Buffer_Size < 1) || (Pointer_Buffer[0] != ENCODING_DER_TAG_SEQUENCE)) return 0;
+	Header_Size = EncodingReadDERLength(Pointer_Buffer + 1, Buffer_Size - 1, &Sequence_Size);
+	if (Header_Size == 0) return 0;
+	Header_Size++;
+	if (Sequence_Size > Buffer_Size - Header_Size) return 0;
+	
+	// The two integers must fill the sequence exactly
+	U_Size = EncodingReadDERInteger(Pointer_Buffer + Header_Size, Sequence_Size, &Pointer_Output_View->Pointer_U, &Pointer_Output_View->U_Size);
+	if (U_Size == 0) return 0;
+	V_Size = EncodingReadDERInteger(Pointer_Buffer + Header_Size + U_Size, Sequence_Size - U_Size, &Pointer_Output_View->Pointer_V, &Pointer_Output_View->V_Size);
+	if ((V_Size == 0) || (U_Size + V_Size != Sequence_Size)) return 0;
+	return Header_Size + Sequence_Size;
+}
+
+void EncodingImportSignatureView(TEncodingSignatureView *Pointer_View, mpz_t Output_Number_U, mpz_t Output_Number_V)
+{
+	ProtocolImportNumber(Pointer_View->Pointer_U, Pointer_View->U_Size, Output_Number_U);
+	ProtocolImportNumber(Pointer_View->Pointer_V, Pointer_View->V_Size, Output_Number_V);
+}
+
+void EncodingSignatureParserInitialize(TEllipticCurve *Pointer_Curve, int Format, const unsigned char *Pointer_Buffer, size_t Buffer_Size, TEncodingSignatureParser *Pointer_Output_Parser)
+{
+	Pointer_Output_Parser->Pointer_Buffer = Pointer_Buffer;
+	Pointer_Output_Parser->Buffer_Size = Buffer_Size;
+	Pointer_Output_Parser->Offset = 0;
+	Pointer_Output_Parser->Format = Format;
+	Pointer_Output_Parser->Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	Pointer_Output_Parser->Is_Malformed = 0;
+}
+
+int EncodingSignatureParserNext(TEncodingSignatureParser *Pointer_Parser, TEncodingSignatureView *Pointer_Output_View)
+{
+	size_t Remaining_Size = Pointer_Parser->Buffer_Size - Pointer_Parser->Offset, Signature_Size;
+	const unsigned char *Pointer_Signature = Pointer_Parser->Pointer_Buffer + Pointer_Parser->Offset;
+	
+	if ((Remaining_Size == 0) || Pointer_Parser->Is_Malformed) return 0;
+	
+	// Raw signatures have a fixed size, a truncated last one is malformed
+	if (Pointer_Parser->Format == ENCODING_SIGNATURE_FORMAT_RAW)
+	{
+		Signature_Size = 2 * Pointer_Parser->Scalar_Size;
+		if (Remaining_Size < Signature_Size) Signature_Size = 0;
+		else
+		{
+			Pointer_Output_View->Pointer_U = Pointer_Signature;
+			Pointer_Output_View->U_Size = Pointer_Parser->Scalar_Size;
+			Pointer_Output_View->Pointer_V = Pointer_Signature + Pointer_Parser->Scalar_Size;
+			Pointer_Output_View->V_Size = Pointer_Parser->Scalar_Size;
+		}
+	}
+	else Signature_Size = EncodingDecodeDERSignature(Pointer_Signature, Remaining_Size, Pointer_Output_View);
+	
+	if (Signature_Size == 0)
+	{
+		Pointer_Parser->Is_Malformed = 1;
+		return 0;
+	}
+	Pointer_Parser->Offset += Signature_Size;
+	return 1;
+}
+
+int EncodingSignatureParserNextBatch(TEncodingSignatureParser *Pointer_Parser, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V, int Maximum_Count)
+{
+	TEncodingSignatureView View;
+	int i;
+	
+	for (i = 0; i < Maximum_Count; i++)
+	{
+		if (!EncodingSignatureParserNext(Pointer_Parser, &View)) break;
+		EncodingImportSignatureView(&View, Pointer_Output_Numbers_U[i], Pointer_Output_Numbers_V[i]);
+	}
+	return i;
+}
@@ -0,0 +1,174 @@
+/** @file Encodings.h
+ * Binary forms of keys and DSA signatures, so they can be stored and exchanged without the decimal strings of the network functions.
+ * Raw forms are fixed size big endian numbers like the ones of Protocols.h : a private key takes ProtocolGetScalarSize() bytes (this is also its SEC1 form), a public key is X followed by Y
+ * (ProtocolGetFieldElementSize() bytes each) and a signature is 'u' (r) followed by 'v' (s), 64 bytes on 256-bit curves.
+ * Public keys also have the SEC1 forms 0x04 || X || Y and the compressed 0x02 or 0x03 (for an even or odd Y) || X, signatures have the DER form SEQUENCE { INTEGER r, INTEGER s }.
+ * A signatures parser walks a buffer of concatenated signatures, returning views of the numbers bytes inside the buffer, so logs of millions of signatures can be read without any allocation.
+ */
+#ifndef H_ENCODINGS_H
+#define H_ENCODINGS_H
+
+#include <stddef.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Modular_Inversion.h"
+#include "Point.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** The signatures are 'u' followed by 'v', each number taking the scalar size. */
+#define ENCODING_SIGNATURE_FORMAT_RAW 0
+/** The signatures are DER sequences of two integers. */
+#define ENCODING_SIGNATURE_FORMAT_DER 1
+
+/** The largest raw signature. */
+#define ENCODING_MAXIMUM_RAW_SIGNATURE_SIZE (2 * ((MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8))
+/** The largest DER signature : the sequence header with a 2-byte length, then two integers with a 2-byte header and a leading zero byte each. */
+#define ENCODING_MAXIMUM_DER_SIGNATURE_SIZE (3 + 2 * (2 + 1 + (MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8))
+/** The largest SEC1 public key, the uncompressed form. */
+#define ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE (1 + 2 * ((MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8))
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A signature found by the parser, the numbers are big endian byte strings pointing into the parsed buffer. */
+typedef struct
+{
+	const unsigned char *Pointer_U; //! The 'u' (r) number bytes.
+	size_t U_Size; //! How many bytes 'u' takes.
+	const unsigned char *Pointer_V; //! The 'v' (s) number bytes.
+	size_t V_Size; //! How many bytes 'v' takes.
+} TEncodingSignatureView;
+
+/** Walk a buffer of concatenated signatures. */
+typedef struct
+{
+	const unsigned char *Pointer_Buffer; //! The signatures, the buffer is not copied.
+	size_t Buffer_Size; //! The buffer size in bytes.
+	size_t Offset; //! Where the next signature starts.
+	int Format; //! ENCODING_SIGNATURE_FORMAT_RAW or ENCODING_SIGNATURE_FORMAT_DER.
+	size_t Scalar_Size; //! The size of a raw number.
+	int Is_Malformed; //! Set when the parser stopped on a signature that could not be decoded, Offset is then the signature offset.
+} TEncodingSignatureParser;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Store a private key in its raw (and SEC1) form.
+ * @param Pointer_Curve The curve.
+ * @param Private_Key The private key.
+ * @param Pointer_Output_Buffer On output, contain the key (ProtocolGetScalarSize() bytes).
+ * @return 1 if the key was stored or 0 if it is not in [1, n - 1].
+ */
+int EncodingExportPrivateKey(TEllipticCurve *Pointer_Curve, mpz_t Private_Key, unsigned char *Pointer_Output_Buffer);
+
+/** Read a private key in its raw (and SEC1) form.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Buffer The key (ProtocolGetScalarSize() bytes).
+ * @param Output_Private_Key On output, contain the private key.
+ * @return 1 if the key was read or 0 if it is not in [1, n - 1].
+ */
+int EncodingImportPrivateKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, mpz_t Output_Private_Key);
+
+/** Store a public key in its raw form X || Y.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Point_Public_Key The public key.
+ * @param Pointer_Output_Buffer On output, contain the key (twice the field element size).
+ * @return 1 if the key was stored or 0 if it is the point at infinity or its coordinates are not reduced.
+ */
+int EncodingExportRawPublicKey(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, unsigned char *Pointer_Output_Buffer);
+
+/** Read a public key in its raw form X || Y.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Buffer The key (twice the field element size).
+ * @param Pointer_Output_Point_Public_Key On output, contain the public key (it must be created by the user).
+ * @return 1 if the key was read or 0 if it is not a point of the curve.
+ */
+int EncodingImportRawPublicKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, TPoint *Pointer_Output_Point_Public_Key);
+
+/** Store a public key in a SEC1 form (SEC 1 version 2 section 2.3.3), the point at infinity is the single byte 0.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Point_Public_Key The public key.
+ * @param Is_Compressed Set to store only X and the Y parity.
+ * @param Pointer_Output_Buffer On output, contain the key (it must be ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE bytes long or 1 + twice the field element size).
+ * @return The key size in bytes or 0 if the coordinates are not reduced.
+ */
+size_t EncodingExportSEC1PublicKey(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Public_Key, int Is_Compressed, unsigned char *Pointer_Output_Buffer);
+
+/** Read a public key in a SEC1 form, compressed or not (SEC 1 version 2 section 2.3.4).
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Buffer The key.
+ * @param Buffer_Size The key size in bytes, it tells the form.
+ * @param Pointer_Output_Point_Public_Key On output, contain the public key (it must be created by the user).
+ * @return 1 if the key was read or 0 if the form is unknown or if it is not a point of the curve.
+ */
+int EncodingImportSEC1PublicKey(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, size_t Buffer_Size, TPoint *Pointer_Output_Point_Public_Key);
+
+/** Store a signature in its raw form u || v.
+ * @param Pointer_Curve The curve.
+ * @param Number_U The signature 'u' number.
+ * @param Number_V The signature 'v' number.
+ * @param Pointer_Output_Buffer On output, contain the signature (twice the scalar size).
+ * @return 1 if the signature was stored or 0 if a number does not fit in a scalar.
+ */
+int EncodingExportRawSignature(TEllipticCurve *Pointer_Curve, mpz_t Number_U, mpz_t Number_V, unsigned char *Pointer_Output_Buffer);
+
+/** Read a signature in its raw form u || v.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Buffer The signature (twice the scalar size).
+ * @param Output_Number_U On output, contain the signature 'u' number.
+ * @param Output_Number_V On output, contain the signature 'v' number.
+ */
+void EncodingImportRawSignature(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Buffer, mpz_t Output_Number_U, mpz_t Output_Number_V);
+
+/** Store a signature in its DER form.
+ * @param Number_U The signature 'u' number.
+ * @param Number_V The signature 'v' number.
+ * @param Pointer_Output_Buffer On output, contain the signature.
+ * @param Buffer_Size The output buffer size, ENCODING_MAXIMUM_DER_SIGNATURE_SIZE bytes are always enough.
+ * @return The signature size in bytes or 0 if a number is negative or the buffer is too small.
+ */
+size_t EncodingExportDERSignature(mpz_t Number_U, mpz_t Number_V, unsigned char *Pointer_Output_Buffer, size_t Buffer_Size);
+
+/** Find the numbers of the DER signature starting a buffer. Only the distinguished form is accepted : minimal lengths and minimal non-negative integers.
+ * @param Pointer_Buffer The signature, the buffer can be longer.
+ * @param Buffer_Size How many bytes can be read.
+ * @param Pointer_Output_View On output, point to the signature numbers.
+ * @return The signature size in bytes or 0 if the buffer does not start with a valid signature.
+ */
+size_t EncodingDecodeDERSignature(const unsigned char *Pointer_Buffer, size_t Buffer_Size, TEncodingSignatureView *Pointer_Output_View);
+
+/** Convert the numbers of a signature view.
+ * @param Pointer_View The signature.
+ * @param Output_Number_U On output, contain the signature 'u' number.
+ * @param Output_Number_V On output, contain the signature 'v' number.
+ */
+void EncodingImportSignatureView(TEncodingSignatureView *Pointer_View, mpz_t Output_Number_U, mpz_t Output_Number_V);
+
+/** Start walking a buffer of signatures.
+ * @param Pointer_Curve The curve, it tells the raw signatures size.
+ * @param Format ENCODING_SIGNATURE_FORMAT_RAW or ENCODING_SIGNATURE_FORMAT_DER.
+ * @param Pointer_Buffer The signatures, the buffer must stay available while the parser is used.
+ * @param Buffer_Size The buffer size in bytes.
+ * @param Pointer_Output_Parser On output, contain the parser.
+ */
+void EncodingSignatureParserInitialize(TEllipticCurve *Pointer_Curve, int Format, const unsigned char *Pointer_Buffer, size_t Buffer_Size, TEncodingSignatureParser *Pointer_Output_Parser);
+
+/** Get the next signature of the buffer.
+ * @param Pointer_Parser The parser.
+ * @param Pointer_Output_View On output, point to the signature numbers.
+ * @return 1 if a signature was found or 0 if the end of the buffer is reached or the signature is malformed (see Is_Malformed).
+ */
+int EncodingSignatureParserNext(TEncodingSignatureParser *Pointer_Parser, TEncodingSignatureView *Pointer_Output_View);
+
+/** Convert the next signatures of the buffer, the numbers reuse their memory so a batch needs no allocation once the numbers have grown to the scalar size.
+ * @param Pointer_Parser The parser.
+ * @param Pointer_Output_Numbers_U On output, contain the signatures 'u' numbers (they must be initialized by the user).
+ * @param Pointer_Output_Numbers_V On output, contain the signatures 'v' numbers (they must be initialized by the user).
+ * @param Maximum_Count How many signatures can be stored.
+ * @return How many signatures were converted, a count lower than Maximum_Count means the end of the buffer was reached or a signature is malformed (see Is_Malformed).
+ */
+int EncodingSignatureParserNextBatch(TEncodingSignatureParser *Pointer_Parser, mpz_t *Pointer_Output_Numbers_U, mpz_t *Pointer_Output_Numbers_V, int Maximum_Count);
+
+#endif
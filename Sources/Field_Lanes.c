@@ -0,0 +1,306 @@
+/** @file Field_Lanes.c
+ * Arithmetic on several independent prime field elements at once.
+ */
+#include <stdint.h>
+#include <string.h>
+#include <gmp.h>
+#include "Field_Lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	/** The AVX2 multiplication is compiled for x86 processors only. */
+	#define FIELD_LANES_IS_AVX2_AVAILABLE 1
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Keep the bits of a limb. */
+#define FIELD_LANES_LIMB_MASK ((1 << FIELD_LANES_LIMB_BITS) - 1)
+
+/** How many 64-bit words a number of FIELD_LANES_LIMBS_COUNT limbs needs. */
+#define FIELD_LANES_WORDS_COUNT ((FIELD_LANES_LIMBS_COUNT * FIELD_LANES_LIMB_BITS + 63) / 64)
+
+/** The Montgomery constant R = 2^FIELD_LANES_R_BITS. */
+#define FIELD_LANES_R_BITS (FIELD_LANES_LIMBS_COUNT * FIELD_LANES_LIMB_BITS)
+
+/** The bias is p multiplied by 2^(FIELD_LANES_BIAS_BITS - bits of p), the smallest power of two giving a top limb that can lend to the limb below it. */
+#define FIELD_LANES_BIAS_BITS 262
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Split a non-negative number lower than R into limbs.
+ * @param Number The number to split.
+ * @param Pointer_Output_Limbs On output, contain the FIELD_LANES_LIMBS_COUNT limbs.
+ */
+static void FieldLanesNumberToLimbs(mpz_t Number, uint32_t *Pointer_Output_Limbs)
+{
+	uint64_t Words[FIELD_LANES_WORDS_COUNT + 1] = {0}, Value; // One more word so the last limb can always read the next word
+	int i, Bit_Index, Shift;
+	
+	mpz_export(Words, NULL, -1, sizeof(uint64_t), 0, 0, Number);
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+	{
+		Bit_Index = i * FIELD_LANES_LIMB_BITS;
+		Shift = Bit_Index % 64;
+		Value = Words[Bit_Index / 64] >> Shift;
+		if (Shift > 64 - FIELD_LANES_LIMB_BITS) Value |= Words[Bit_Index / 64 + 1] << (64 - Shift); // The limb is split between two words
+		Pointer_Output_Limbs[i] = Value & FIELD_LANES_LIMB_MASK;
+	}
+}
+
+/** Gather normalized limbs into a number.
+ * @param Pointer_Limbs The FIELD_LANES_LIMBS_COUNT limbs, each one lower than 2^FIELD_LANES_LIMB_BITS.
+ * @param Output_Number On output, contain the number.
+ */
+static void FieldLanesLimbsToNumber(const uint32_t *Pointer_Limbs, mpz_t Output_Number)
+{
+	uint64_t Words[FIELD_LANES_WORDS_COUNT + 1] = {0};
+	int i, Bit_Index, Shift;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+	{
+		Bit_Index = i * FIELD_LANES_LIMB_BITS;
+		Shift = Bit_Index % 64;
+		Words[Bit_Index / 64] |= (uint64_t) Pointer_Limbs[i] << Shift;
+		if (Shift > 64 - FIELD_LANES_LIMB_BITS) Words[Bit_Index / 64 + 1] |= (uint64_t) Pointer_Limbs[i] >> (64 - Shift);
+	}
+	
+	mpz_import(Output_Number, FIELD_LANES_WORDS_COUNT + 1, -1, sizeof(uint64_t), 0, 0, Words);
+}
+
+/** Set all lanes of an element to the same value.
+ * @param Pointer_Element The element.
+ * @param Pointer_Limbs FIELD_LANES_LIMBS_COUNT limbs.
+ */
+static void FieldLanesBroadcast(TFieldLanesElement *Pointer_Element, const uint32_t *Pointer_Limbs)
+{
+	int Lane;
+	
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) FieldLanesSetLane(Pointer_Element, Lane, Pointer_Limbs);
+}
+
+/** Montgomery multiplication (A.B.R^-1 mod p) of all lanes with portable C code, one limb of A is processed at a time :
+ * A[i].B is accumulated, then the multiple of p clearing the lowest limb is added and the accumulator is shifted one limb down. Limbs are carried only at the end.
+ * @see TFieldLanesMultiplicationFunction for the parameters.
+ */
+static void FieldLanesMultiplyPortable(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Product)
+{
+	uint64_t Accumulators[FIELD_LANES_LIMBS_COUNT], Limb_A, Reduction_Factor, Carry;
+	int Lane, i, j;
+	
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+	{
+		memset(Accumulators, 0, sizeof(Accumulators));
+		
+		for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+		{
+			// Accumulate A[i].B
+			Limb_A = Pointer_A->Limbs[i][Lane];
+			for (j = 0; j < FIELD_LANES_LIMBS_COUNT; j++) Accumulators[j] += Limb_A * Pointer_B->Limbs[j][Lane];
+			
+			// Add m.p so the lowest limb becomes a multiple of 2^26
+			Reduction_Factor = (Accumulators[0] * Pointer_Modulus->Inverse) & FIELD_LANES_LIMB_MASK;
+			for (j = 0; j < FIELD_LANES_LIMBS_COUNT; j++) Accumulators[j] += Reduction_Factor * Pointer_Modulus->Modulus[j];
+			
+			// Divide by 2^26
+			Carry = Accumulators[0] >> FIELD_LANES_LIMB_BITS;
+			for (j = 0; j < FIELD_LANES_LIMBS_COUNT - 1; j++) Accumulators[j] = Accumulators[j + 1];
+			Accumulators[FIELD_LANES_LIMBS_COUNT - 1] = 0;
+			Accumulators[0] += Carry;
+		}
+		
+		// Normalize the limbs
+		for (j = 0; j < FIELD_LANES_LIMBS_COUNT - 1; j++)
+		{
+			Accumulators[j + 1] += Accumulators[j] >> FIELD_LANES_LIMB_BITS;
+			Pointer_Output_Product->Limbs[j][Lane] = Accumulators[j] & FIELD_LANES_LIMB_MASK;
+		}
+		Pointer_Output_Product->Limbs[FIELD_LANES_LIMBS_COUNT - 1][Lane] = Accumulators[FIELD_LANES_LIMBS_COUNT - 1];
+	}
+}
+
+#ifdef FIELD_LANES_IS_AVX2_AVAILABLE
+/** Same algorithm as FieldLanesMultiplyPortable(), the four lanes being the four 64-bit integers of AVX2 registers (_mm256_mul_epu32() multiplies their low 32 bits).
+ * @see TFieldLanesMultiplicationFunction for the parameters.
+ */
+__attribute__((target("avx2"))) static void FieldLanesMultiplyAVX2(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Product)
+{
+	__m256i Accumulators[FIELD_LANES_LIMBS_COUNT], Limbs_B[FIELD_LANES_LIMBS_COUNT], Limbs_Modulus[FIELD_LANES_LIMBS_COUNT], Limb_A, Reduction_Factor, Carry, Mask, Inverse;
+	int i, j;
+	
+	Mask = _mm256_set1_epi64x(FIELD_LANES_LIMB_MASK);
+	Inverse = _mm256_set1_epi64x(Pointer_Modulus->Inverse);
+	for (j = 0; j < FIELD_LANES_LIMBS_COUNT; j++)
+	{
+		Accumulators[j] = _mm256_setzero_si256();
+		Limbs_B[j] = _mm256_loadu_si256((__m256i *) Pointer_B->Limbs[j]);
+		Limbs_Modulus[j] = _mm256_set1_epi64x(Pointer_Modulus->Modulus[j]);
+	}
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+	{
+		// Accumulate A[i].B
+		Limb_A = _mm256_loadu_si256((__m256i *) Pointer_A->Limbs[i]);
+		for (j = 0; j < FIELD_LANES_LIMBS_COUNT; j++) Accumulators[j] = _mm256_add_epi64(Accumulators[j], _mm256_mul_epu32(Limb_A, Limbs_B[j]));
+		
+		// Add m.p so the lowest limb becomes a multiple of 2^26
+		Reduction_Factor = _mm256_and_si256(_mm256_mul_epu32(Accumulators[0], Inverse), Mask);
+		for (j = 0; j < FIELD_LANES_LIMBS_COUNT; j++) Accumulators[j] = _mm256_add_epi64(Accumulators[j], _mm256_mul_epu32(Reduction_Factor, Limbs_Modulus[j]));
+		
+		// Divide by 2^26
+		Carry = _mm256_srli_epi64(Accumulators[0], FIELD_LANES_LIMB_BITS);
+		for (j = 0; j < FIELD_LANES_LIMBS_COUNT - 1; j++) Accumulators[j] = Accumulators[j + 1];
+		Accumulators[FIELD_LANES_LIMBS_COUNT - 1] = _mm256_setzero_si256();
+		Accumulators[0] = _mm256_add_epi64(Accumulators[0], Carry);
+	}
+	
+	// Normalize the limbs
+	for (j = 0; j < FIELD_LANES_LIMBS_COUNT - 1; j++)
+	{
+		Accumulators[j + 1] = _mm256_add_epi64(Accumulators[j + 1], _mm256_srli_epi64(Accumulators[j], FIELD_LANES_LIMB_BITS));
+		_mm256_storeu_si256((__m256i *) Pointer_Output_Product->Limbs[j], _mm256_and_si256(Accumulators[j], Mask));
+	}
+	_mm256_storeu_si256((__m256i *) Pointer_Output_Product->Limbs[FIELD_LANES_LIMBS_COUNT - 1], Accumulators[FIELD_LANES_LIMBS_COUNT - 1]);
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int FieldLanesPrepareModulus(mpz_t Modulus, int Is_Vectorization_Allowed, TFieldLanesModulus *Pointer_Output_Modulus)
+{
+	mpz_t Number, Number_Power;
+	int i, Bits_Count;
+	
+	// The limbs count and the bias are computed for primes of about 256 bits
+	Bits_Count = mpz_sizeinbase(Modulus, 2);
+	if ((Bits_Count < FIELD_LANES_MINIMUM_MODULUS_BITS) || (Bits_Count > FIELD_LANES_MAXIMUM_MODULUS_BITS) || mpz_even_p(Modulus)) return 0;
+	
+	mpz_init(Number);
+	mpz_init(Number_Power);
+	FieldLanesNumberToLimbs(Modulus, Pointer_Output_Modulus->Modulus);
+	
+	// -p^-1 mod 2^26
+	mpz_setbit(Number_Power, FIELD_LANES_LIMB_BITS);
+	mpz_invert(Number, Modulus, Number_Power);
+	mpz_sub(Number, Number_Power, Number);
+	Pointer_Output_Modulus->Inverse = mpz_get_ui(Number);
+	
+	// R mod p and R^2 mod p
+	mpz_set_ui(Number_Power, 0);
+	mpz_setbit(Number_Power, FIELD_LANES_R_BITS);
+	mpz_mod(Number, Number_Power, Modulus);
+	FieldLanesNumberToLimbs(Number, Pointer_Output_Modulus->Montgomery_One);
+	mpz_mul(Number, Number, Number);
+	mpz_mod(Number, Number, Modulus);
+	FieldLanesNumberToLimbs(Number, Pointer_Output_Modulus->R_Square);
+	
+	// Each limb below the top one borrows 2^27 (2 units of the next limb), so any limb lower than 2^27 can be subtracted from it
+	mpz_mul_2exp(Number, Modulus, FIELD_LANES_BIAS_BITS - Bits_Count);
+	FieldLanesNumberToLimbs(Number, Pointer_Output_Modulus->Bias);
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT - 1; i++)
+	{
+		Pointer_Output_Modulus->Bias[i] += 2 << FIELD_LANES_LIMB_BITS;
+		Pointer_Output_Modulus->Bias[i + 1] -= 2;
+	}
+	
+	// Use vector instructions when the processor has them
+	Pointer_Output_Modulus->Function_Multiply = FieldLanesMultiplyPortable;
+	Pointer_Output_Modulus->Is_Vectorized = 0;
+	#ifdef FIELD_LANES_IS_AVX2_AVAILABLE
+		if (Is_Vectorization_Allowed && __builtin_cpu_supports("avx2"))
+		{
+			Pointer_Output_Modulus->Function_Multiply = FieldLanesMultiplyAVX2;
+			Pointer_Output_Modulus->Is_Vectorized = 1;
+		}
+	#else
+		(void) Is_Vectorization_Allowed;
+	#endif
+	
+	mpz_clear(Number);
+	mpz_clear(Number_Power);
+	return 1;
+}
+
+void FieldLanesImport(TFieldLanesModulus *Pointer_Modulus, mpz_t *Pointer_Numbers, TFieldLanesElement *Pointer_Output_Element)
+{
+	TFieldLanesElement Element_R_Square;
+	uint32_t Limbs[FIELD_LANES_LIMBS_COUNT];
+	int Lane;
+	
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+	{
+		FieldLanesNumberToLimbs(Pointer_Numbers[Lane], Limbs);
+		FieldLanesSetLane(Pointer_Output_Element, Lane, Limbs);
+	}
+	
+	// x.R^2.R^-1 = x.R
+	FieldLanesBroadcast(&Element_R_Square, Pointer_Modulus->R_Square);
+	FieldLanesMultiply(Pointer_Modulus, Pointer_Output_Element, &Element_R_Square, Pointer_Output_Element);
+}
+
+void FieldLanesExport(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_Element, mpz_t *Pointer_Output_Numbers)
+{
+	TFieldLanesElement Element_One, Element_Number;
+	uint32_t Limbs[FIELD_LANES_LIMBS_COUNT] = {1}; // The plain number 1, not R mod p
+	mpz_t Number_Modulus;
+	int Lane;
+	
+	// x.R.1.R^-1 = x, the result is at most p
+	FieldLanesBroadcast(&Element_One, Limbs);
+	FieldLanesMultiply(Pointer_Modulus, Pointer_Element, &Element_One, &Element_Number);
+	
+	mpz_init(Number_Modulus);
+	FieldLanesLimbsToNumber(Pointer_Modulus->Modulus, Number_Modulus);
+	for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++)
+	{
+		FieldLanesGetLane(&Element_Number, Lane, Limbs);
+		FieldLanesLimbsToNumber(Limbs, Pointer_Output_Numbers[Lane]);
+		if (mpz_cmp(Pointer_Output_Numbers[Lane], Number_Modulus) >= 0) mpz_sub(Pointer_Output_Numbers[Lane], Pointer_Output_Numbers[Lane], Number_Modulus);
+	}
+	mpz_clear(Number_Modulus);
+}
+
+void FieldLanesSetLane(TFieldLanesElement *Pointer_Element, int Lane, const uint32_t *Pointer_Limbs)
+{
+	int i;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++) Pointer_Element->Limbs[i][Lane] = Pointer_Limbs[i];
+}
+
+void FieldLanesGetLane(TFieldLanesElement *Pointer_Element, int Lane, uint32_t *Pointer_Output_Limbs)
+{
+	int i;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++) Pointer_Output_Limbs[i] = (uint32_t) Pointer_Element->Limbs[i][Lane];
+}
+
+void FieldLanesCopyLane(TFieldLanesElement *Pointer_Source_Element, TFieldLanesElement *Pointer_Destination_Element, int Lane)
+{
+	int i;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++) Pointer_Destination_Element->Limbs[i][Lane] = Pointer_Source_Element->Limbs[i][Lane];
+}
+
+void FieldLanesAdd(TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Sum)
+{
+	int i, Lane;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+	{
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) Pointer_Output_Sum->Limbs[i][Lane] = Pointer_A->Limbs[i][Lane] + Pointer_B->Limbs[i][Lane];
+	}
+}
+
+void FieldLanesSubtract(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Difference)
+{
+	int i, Lane;
+	
+	for (i = 0; i < FIELD_LANES_LIMBS_COUNT; i++)
+	{
+		for (Lane = 0; Lane < FIELD_LANES_COUNT; Lane++) Pointer_Output_Difference->Limbs[i][Lane] = Pointer_A->Limbs[i][Lane] + Pointer_Modulus->Bias[i] - Pointer_B->Limbs[i][Lane];
+	}
+}
@@ -0,0 +1,131 @@
+/** @file Field_Lanes.h
+ * Arithmetic on FIELD_LANES_COUNT independent elements of a prime field of about 256 bits at once, so the independent multiplications of a batch run side by side in vector registers.
+ * Each element is stored in radix 2^26 (FIELD_LANES_LIMBS_COUNT limbs) and in Montgomery form (x.R mod p with R = 2^286). Limb i of every lane is contiguous, so one vector
+ * instruction processes the same limb of all lanes. The multiplication uses AVX2 when the processor supports it (this is detected at run time), portable C otherwise.
+ * Values are only partially reduced : a product is lower than 2p with limbs lower than 2^26, sums and differences of products are accepted by the multiplication as they are
+ * (see FieldLanesSubtract() for the limits), a final reduction is done when converting back to GMP numbers.
+ */
+#ifndef H_FIELD_LANES_H
+#define H_FIELD_LANES_H
+
+#include <stdint.h>
+#include <gmp.h>
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** How many field elements are processed at once (the 64-bit lanes of an AVX2 register). */
+#define FIELD_LANES_COUNT 4
+/** How many bits a limb holds, a product of two limbs plus the accumulated sums fits in 64 bits. */
+#define FIELD_LANES_LIMB_BITS 26
+/** How many limbs an element has, R = 2^(26 * 11) is more than 2^30 times p so partially reduced values can be multiplied. */
+#define FIELD_LANES_LIMBS_COUNT 11
+/** The size in bits of the smallest supported primes. */
+#define FIELD_LANES_MINIMUM_MODULUS_BITS 250
+/** The size in bits of the largest supported primes. */
+#define FIELD_LANES_MAXIMUM_MODULUS_BITS 256
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** FIELD_LANES_COUNT field elements. */
+typedef struct
+{
+	uint64_t Limbs[FIELD_LANES_LIMBS_COUNT][FIELD_LANES_COUNT]; //! Limbs[i][Lane] is the limb i of the lane element, least significant limb first.
+} TFieldLanesElement;
+
+struct TFieldLanesModulus;
+
+/** Montgomery multiplication of all lanes.
+ * @param Pointer_Modulus The field.
+ * @param Pointer_A First factors.
+ * @param Pointer_B Second factors.
+ * @param Pointer_Output_Product On output, contain the products (it can be one of the factors).
+ */
+typedef void (*TFieldLanesMultiplicationFunction)(struct TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Product);
+
+/** A prime field and the constants its arithmetic needs. */
+typedef struct TFieldLanesModulus
+{
+	uint32_t Modulus[FIELD_LANES_LIMBS_COUNT]; //! The limbs of p.
+	uint32_t Bias[FIELD_LANES_LIMBS_COUNT]; //! A multiple of p (2^(262 - bits of p).p, at most 2^12.p) with limbs 0 to 9 made greater than 2^27 by borrowing from the next limb, it is added before subtracting to keep the limbs positive.
+	uint32_t Montgomery_One[FIELD_LANES_LIMBS_COUNT]; //! R mod p, the value 1 in Montgomery form.
+	uint32_t R_Square[FIELD_LANES_LIMBS_COUNT]; //! R^2 mod p, used to convert numbers to Montgomery form.
+	uint32_t Inverse; //! -p^-1 mod 2^26.
+	TFieldLanesMultiplicationFunction Function_Multiply; //! The fastest multiplication the processor can run.
+	char Is_Vectorized; //! Tell if the multiplication uses vector instructions.
+} TFieldLanesModulus;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Compute the constants of a prime field and select the multiplication implementation.
+ * @param Modulus The prime, it must be odd and from FIELD_LANES_MINIMUM_MODULUS_BITS to FIELD_LANES_MAXIMUM_MODULUS_BITS bits long.
+ * @param Is_Vectorization_Allowed Set to 0 to force the portable implementation (to compare it with the vectorized one).
+ * @param Pointer_Output_Modulus On output, contain the field.
+ * @return 1 if the field can be used or 0 if the prime is not supported.
+ */
+int FieldLanesPrepareModulus(mpz_t Modulus, int Is_Vectorization_Allowed, TFieldLanesModulus *Pointer_Output_Modulus);
+
+/** Convert GMP numbers to Montgomery form.
+ * @param Pointer_Modulus The field.
+ * @param Pointer_Numbers FIELD_LANES_COUNT numbers in [0, p - 1].
+ * @param Pointer_Output_Element On output, contain the numbers.
+ */
+void FieldLanesImport(TFieldLanesModulus *Pointer_Modulus, mpz_t *Pointer_Numbers, TFieldLanesElement *Pointer_Output_Element);
+
+/** Convert elements back to fully reduced GMP numbers.
+ * @param Pointer_Modulus The field.
+ * @param Pointer_Element The elements.
+ * @param Pointer_Output_Numbers On output, contain FIELD_LANES_COUNT numbers in [0, p - 1].
+ */
+void FieldLanesExport(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_Element, mpz_t *Pointer_Output_Numbers);
+
+/** Set one lane of an element.
+ * @param Pointer_Element The element.
+ * @param Lane The lane to set.
+ * @param Pointer_Limbs FIELD_LANES_LIMBS_COUNT limbs (like the ones returned by FieldLanesGetLane() or the modulus constants).
+ */
+void FieldLanesSetLane(TFieldLanesElement *Pointer_Element, int Lane, const uint32_t *Pointer_Limbs);
+
+/** Read one lane of a product (its limbs fit in 32 bits).
+ * @param Pointer_Element The element.
+ * @param Lane The lane to read.
+ * @param Pointer_Output_Limbs On output, contain the FIELD_LANES_LIMBS_COUNT limbs of the lane.
+ */
+void FieldLanesGetLane(TFieldLanesElement *Pointer_Element, int Lane, uint32_t *Pointer_Output_Limbs);
+
+/** Copy one lane of an element to the same lane of another element.
+ * @param Pointer_Source_Element The element to copy from.
+ * @param Pointer_Destination_Element The element to copy to.
+ * @param Lane The lane to copy.
+ */
+void FieldLanesCopyLane(TFieldLanesElement *Pointer_Source_Element, TFieldLanesElement *Pointer_Destination_Element, int Lane);
+
+/** Multiply all lanes. The factors must be lower than 2^14.p and their limbs lower than 2^30, the products are lower than 2p and their limbs lower than 2^26.
+ * @param Pointer_Modulus The field.
+ * @param Pointer_A First factors.
+ * @param Pointer_B Second factors.
+ * @param Pointer_Output_Product On output, contain the products (it can be one of the factors).
+ */
+static inline void FieldLanesMultiply(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Product)
+{
+	Pointer_Modulus->Function_Multiply(Pointer_Modulus, Pointer_A, Pointer_B, Pointer_Output_Product);
+}
+
+/** Add all lanes without any reduction.
+ * @param Pointer_A First terms.
+ * @param Pointer_B Second terms.
+ * @param Pointer_Output_Sum On output, contain the sums (it can be one of the terms).
+ */
+void FieldLanesAdd(TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Sum);
+
+/** Compute A - B + Bias for all lanes. B must be a product or the sum of two products (lower than 4p with limbs not greater than 2^27 - 2), so no limb becomes negative.
+ * @param Pointer_Modulus The field.
+ * @param Pointer_A The numbers to subtract from.
+ * @param Pointer_B The numbers to subtract.
+ * @param Pointer_Output_Difference On output, contain the differences (it can be one of the operands).
+ */
+void FieldLanesSubtract(TFieldLanesModulus *Pointer_Modulus, TFieldLanesElement *Pointer_A, TFieldLanesElement *Pointer_B, TFieldLanesElement *Pointer_Output_Difference);
+
+#endif
@@ -0,0 +1,115 @@
+/** @file Instrumentation.c
+ * Thread-local operation counters and phase timestamps.
+ */
+#include "Instrumentation.h"
+
+#ifdef INSTRUMENTATION
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+__thread TInstrumentationSnapshot Instrumentation_Current;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Get a monotonic time.
+ * @return The time in nanoseconds.
+ */
+static long long InstrumentationGetTime(void)
+{
+	struct timespec Time;
+	
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return (long long) Time.tv_sec * 1000000000LL + Time.tv_nsec;
+}
+
+/** Display counters, or the difference of two counters sets.
+ * @param Pointer_Counters The counters.
+ * @param Pointer_Counters_Start Counters to subtract (can be NULL).
+ */
+static void InstrumentationShowCounters(TInstrumentationCounters *Pointer_Counters, TInstrumentationCounters *Pointer_Counters_Start)
+{
+	TInstrumentationCounters Zero;
+	
+	if (Pointer_Counters_Start == NULL)
+	{
+		memset(&Zero, 0, sizeof(Zero));
+		Pointer_Counters_Start = &Zero;
+	}
+	printf("M = %llu, S = %llu, I = %llu, R = %llu, doublings = %llu, additions = %llu\n", Pointer_Counters->Field_Multiplications - Pointer_Counters_Start->Field_Multiplications,
+		Pointer_Counters->Field_Squarings - Pointer_Counters_Start->Field_Squarings, Pointer_Counters->Field_Inversions - Pointer_Counters_Start->Field_Inversions,
+		Pointer_Counters->Reductions - Pointer_Counters_Start->Reductions, Pointer_Counters->Point_Doublings - Pointer_Counters_Start->Point_Doublings,
+		Pointer_Counters->Point_Additions - Pointer_Counters_Start->Point_Additions);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+void InstrumentationReset(void)
+{
+	memset(&Instrumentation_Current.Counters, 0, sizeof(Instrumentation_Current.Counters));
+	Instrumentation_Current.Phases_Count = 0;
+	Instrumentation_Current.Reset_Time = InstrumentationGetTime();
+}
+
+void InstrumentationStartPhase(const char *String_Name)
+{
+	TInstrumentationPhase *Pointer_Phase;
+	
+	if (Instrumentation_Current.Phases_Count >= INSTRUMENTATION_MAXIMUM_PHASES_COUNT) return;
+	
+	Pointer_Phase = &Instrumentation_Current.Phases[Instrumentation_Current.Phases_Count];
+	Pointer_Phase->String_Name = String_Name;
+	Pointer_Phase->Time = InstrumentationGetTime() - Instrumentation_Current.Reset_Time;
+	Pointer_Phase->Counters = Instrumentation_Current.Counters;
+	Instrumentation_Current.Phases_Count++;
+}
+
+void InstrumentationGetSnapshot(TInstrumentationSnapshot *Pointer_Snapshot)
+{
+	memcpy(Pointer_Snapshot, &Instrumentation_Current, sizeof(TInstrumentationSnapshot));
+	Pointer_Snapshot->Snapshot_Time = InstrumentationGetTime();
+}
+
+void InstrumentationShow(const char *String_Title, TInstrumentationSnapshot *Pointer_Snapshot)
+{
+	long long Elapsed_Time, Phase_End_Time;
+	TInstrumentationCounters *Pointer_Phase_End_Counters;
+	int i;
+	
+	Elapsed_Time = Pointer_Snapshot->Snapshot_Time - Pointer_Snapshot->Reset_Time;
+	printf("[Instrumentation] %s : %.1f us, ", String_Title, Elapsed_Time / 1000.0);
+	InstrumentationShowCounters(&Pointer_Snapshot->Counters, NULL);
+	
+	// A phase lasts until the next one starts
+	for (i = 0; i < Pointer_Snapshot->Phases_Count; i++)
+	{
+		if (i + 1 < Pointer_Snapshot->Phases_Count)
+		{
+			Phase_End_Time = Pointer_Snapshot->Phases[i + 1].Time;
+			Pointer_Phase_End_Counters = &Pointer_Snapshot->Phases[i + 1].Counters;
+		}
+		else
+		{
+			Phase_End_Time = Elapsed_Time;
+			Pointer_Phase_End_Counters = &Pointer_Snapshot->Counters;
+		}
+		printf("[Instrumentation]   %s : %.1f us, ", Pointer_Snapshot->Phases[i].String_Name, (Phase_End_Time - Pointer_Snapshot->Phases[i].Time) / 1000.0);
+		InstrumentationShowCounters(Pointer_Phase_End_Counters, &Pointer_Snapshot->Phases[i].Counters);
+	}
+}
+
+void InstrumentationShowCurrent(const char *String_Title)
+{
+	TInstrumentationSnapshot Snapshot;
+	
+	InstrumentationGetSnapshot(&Snapshot);
+	InstrumentationShow(String_Title, &Snapshot);
+}
+
+#endif
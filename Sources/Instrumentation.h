@@ -0,0 +1,103 @@
+/** @file Instrumentation.h
+ * Optional operation counters and phase timestamps telling where the time goes in a multiplication or a protocol.
+ * Everything is compiled only when INSTRUMENTATION is defined (add -DINSTRUMENTATION to CCFLAGS), otherwise the macros expand to nothing and the hot paths are left untouched.
+ * Counters are thread-local, so each thread measures its own work without any synchronization.
+ */
+#ifndef H_INSTRUMENTATION_H
+#define H_INSTRUMENTATION_H
+
+#ifdef INSTRUMENTATION
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** How many phases can be timestamped between two resets, the following ones are ignored. */
+#define INSTRUMENTATION_MAXIMUM_PHASES_COUNT 32
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** Counted operations. */
+typedef struct
+{
+	unsigned long long Field_Multiplications; //! Products of two different numbers.
+	unsigned long long Field_Squarings; //! Products of a number with itself.
+	unsigned long long Field_Inversions; //! Modular inversions.
+	unsigned long long Reductions; //! Reductions modulo p.
+	unsigned long long Point_Doublings; //! Point doublings, whatever the coordinates.
+	unsigned long long Point_Additions; //! Point additions, whatever the coordinates.
+} TInstrumentationCounters;
+
+/** A timestamped step of a computation. */
+typedef struct
+{
+	const char *String_Name; //! The phase name (it must be a constant string).
+	long long Time; //! When the phase started, in nanoseconds since the last reset.
+	TInstrumentationCounters Counters; //! The counters values when the phase started.
+} TInstrumentationPhase;
+
+/** The counters and phases of a thread. */
+typedef struct
+{
+	TInstrumentationCounters Counters; //! Operations counted since the last reset.
+	TInstrumentationPhase Phases[INSTRUMENTATION_MAXIMUM_PHASES_COUNT]; //! The phases started since the last reset.
+	int Phases_Count; //! How many phases were started.
+	long long Reset_Time; //! When the counters were reset (monotonic time in nanoseconds).
+	long long Snapshot_Time; //! When the snapshot was taken (monotonic time in nanoseconds).
+} TInstrumentationSnapshot;
+
+//--------------------------------------------------------------------------------------------------------
+// Variables
+//--------------------------------------------------------------------------------------------------------
+/** The current thread counters. */
+extern __thread TInstrumentationSnapshot Instrumentation_Current;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Set the current thread counters to zero and forget the phases. */
+void InstrumentationReset(void);
+
+/** Timestamp the start of a phase.
+ * @param String_Name The phase name (it must be a constant string).
+ */
+void InstrumentationStartPhase(const char *String_Name);
+
+/** Copy the current thread counters and phases.
+ * @param Pointer_Snapshot On output, contain the counters and phases.
+ */
+void InstrumentationGetSnapshot(TInstrumentationSnapshot *Pointer_Snapshot);
+
+/** Display the counters and, for each phase, its duration and the operations it did.
+ * @param String_Title What was measured.
+ * @param Pointer_Snapshot The counters to display.
+ */
+void InstrumentationShow(const char *String_Title, TInstrumentationSnapshot *Pointer_Snapshot);
+
+/** Display the current thread counters and phases.
+ * @param String_Title What was measured.
+ */
+void InstrumentationShowCurrent(const char *String_Title);
+
+//--------------------------------------------------------------------------------------------------------
+// Macros
+//--------------------------------------------------------------------------------------------------------
+/** Count one operation (Counter is a TInstrumentationCounters field name). */
+#define INSTRUMENTATION_COUNT(Counter) Instrumentation_Current.Counters.Counter++
+/** Reset the current thread counters. */
+#define INSTRUMENTATION_RESET() InstrumentationReset()
+/** Timestamp the start of a phase. */
+#define INSTRUMENTATION_START_PHASE(String_Name) InstrumentationStartPhase(String_Name)
+/** Display the current thread counters. */
+#define INSTRUMENTATION_SHOW(String_Title) InstrumentationShowCurrent(String_Title)
+
+#else
+
+#define INSTRUMENTATION_COUNT(Counter) do {} while (0)
+#define INSTRUMENTATION_RESET() do {} while (0)
+#define INSTRUMENTATION_START_PHASE(String_Name) do {} while (0)
+#define INSTRUMENTATION_SHOW(String_Title) do {} while (0)
+
+#endif
+
+#endif
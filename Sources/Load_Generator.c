@@ -0,0 +1,597 @@
+/** @file Load_Generator.c
+ * Drive the Alice side of the Diffie-Hellman, ElGamal and DSA protocols with many concurrent Bobs over the loopback interface and measure the end-to-end throughput.
+ * Alice and the Bobs run in the same process and exchange messages in the formats of the Diffie_Hellman, ElGamal and DSA programs, through the Network.c functions (a DSA session
+ * carries a single signed message while the program sends several ones on the same connection).
+ * Alice accepts the Bobs with NetworkServerListen() like the programs do, by default with a single thread (like the programs), so the cost of the one-client backlog and of the text
+ * numbers encoding can be measured. For each concurrency level, the sessions rate, the session latency percentiles, the CPU time consumed by both sides per session and the bytes
+ * exchanged per session are reported.
+ */
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Curves_Registry.h"
+#include "Elliptic_Curves.h"
+#include "Encodings.h"
+#include "Network.h"
+#include "Point.h"
+#include "Protocols.h"
+#include "Session_Cache.h"
+#include "Utils.h"
+
+/** The address Alice listens on. */
+#define LOAD_GENERATOR_ADDRESS "127.0.0.1"
+/** Default amount of sessions per concurrency level. */
+#define LOAD_GENERATOR_DEFAULT_SESSIONS_COUNT 200
+/** Default highest amount of simultaneous Bobs, the concurrency is doubled from 1 up to this value. */
+#define LOAD_GENERATOR_DEFAULT_MAXIMUM_CONCURRENCY 16
+/** Default amount of threads accepting Bobs (1 is the programs design). */
+#define LOAD_GENERATOR_DEFAULT_ALICE_THREADS_COUNT 1
+/** The message Alice signs for DSA, it is the first one of the DSA program. */
+#define LOAD_GENERATOR_DSA_MESSAGE "Ceci est le magnifique message de test numero 1."
+/** How many seconds a Bob waits for Alice's data before giving up. When Alice's one-client backlog is full, the kernel can drop the end of Bob's handshake while Bob believes
+ * he is connected, Bob would then wait forever for protocols where Alice talks first. */
+#define LOAD_GENERATOR_RECEIVE_TIMEOUT 5
+/** How many sessions Alice remembers (the Bobs never resume, it only gives Alice the cost of storing their tickets). */
+#define LOAD_GENERATOR_SESSIONS_CACHE_CAPACITY 4096
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** A protocol to drive. */
+typedef struct
+{
+	char *String_Name; //! The name given on the command line.
+	int (*Function_Alice)(int Socket_Bob); //! Serve one Bob, return 1 on success.
+	int (*Function_Bob)(int Socket_Alice); //! Run one session with Alice, return 1 on success.
+} TLoadGeneratorProtocol;
+
+/** The state shared by Alice and the Bobs during a concurrency level. */
+typedef struct
+{
+	TLoadGeneratorProtocol *Pointer_Protocol; //! The protocol being measured.
+	int Socket_Server; //! Alice's server socket.
+	unsigned short Port; //! The server port.
+	int Is_Stopping; //! Tell Alice's threads to exit after their next accepted connection, accessed with atomic loads and stores only.
+	int Sessions_Count; //! How many sessions to run.
+	int Next_Session_Index; //! The next session a Bob must run.
+	long long *Pointer_Latencies; //! The duration of each session in microseconds.
+	int Failures_Count; //! How many sessions did not complete.
+	unsigned long long Bytes_Count; //! Bytes received by both sides.
+	pthread_mutex_t Mutex; //! Protect the sessions index and the counters.
+} TLoadGeneratorLevel;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The curve all protocols use. */
+static TEllipticCurve Curve;
+
+/** Alice's long-term keys for ElGamal and DSA (the programs generate them once at startup too). */
+static unsigned char Private_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Alice[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE];
+/** Alice's public key in the SEC1 compressed form the DSA program sends. */
+static unsigned char Public_Key_Alice_SEC1[ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE];
+static size_t Public_Key_Alice_SEC1_Size;
+
+/** Alice's Diffie-Hellman sessions, the cache is not thread-safe. */
+static TSessionCache Sessions_Cache;
+static pthread_mutex_t Sessions_Cache_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Tell how many payload bytes a socket received from its peer.
+ * @param Socket The connected socket.
+ * @return The received bytes count, or 0 if the kernel does not provide it.
+ */
+static unsigned long long LoadGeneratorGetReceivedBytesCount(int Socket)
+{
+	struct tcp_info Information;
+	socklen_t Size = sizeof(Information);
+	
+	memset(&Information, 0, sizeof(Information));
+	if (getsockopt(Socket, IPPROTO_TCP, TCP_INFO, &Information, &Size) != 0) return 0;
+	return Information.tcpi_bytes_received;
+}
+
+/** Tell how much CPU time the process consumed (all threads).
+ * @return The user and system times in microseconds.
+ */
+static long long LoadGeneratorGetProcessTime(void)
+{
+	struct rusage Usage;
+	
+	getrusage(RUSAGE_SELF, &Usage);
+	return (Usage.ru_utime.tv_sec + Usage.ru_stime.tv_sec) * 1000000LL + Usage.ru_utime.tv_usec + Usage.ru_stime.tv_usec;
+}
+
+/** Send a number stored in a buffer as the programs do.
+ * @param Socket_Peer The peer socket.
+ * @param Pointer_Buffer The number.
+ * @param Buffer_Size The number size in bytes.
+ */
+static void LoadGeneratorSendNumber(int Socket_Peer, unsigned char *Pointer_Buffer, size_t Buffer_Size)
+{
+	mpz_t Number;
+	
+	mpz_init(Number);
+	ProtocolImportNumber(Pointer_Buffer, Buffer_Size, Number);
+	NetworkSendMPZ(Socket_Peer, Number);
+	mpz_clear(Number);
+}
+
+/** Receive a number sent as the programs do.
+ * @param Socket_Peer The peer socket.
+ * @param Buffer_Size The number size in bytes.
+ * @param Pointer_Output_Buffer On output, contain the number.
+ * @return 1 if the number was received or 0 if it does not fit in the buffer.
+ */
+static int LoadGeneratorReceiveNumber(int Socket_Peer, size_t Buffer_Size, unsigned char *Pointer_Output_Buffer)
+{
+	mpz_t Number;
+	int Return_Value;
+	
+	mpz_init(Number);
+	NetworkReceiveMPZ(Socket_Peer, Number);
+	Return_Value = ProtocolExportNumber(Number, Buffer_Size, Pointer_Output_Buffer);
+	mpz_clear(Number);
+	return Return_Value;
+}
+
+/** Alice's side of the Diffie_Hellman program (a full key exchange, Bob does not resume).
+ * @param Socket_Bob Client's socket.
+ * @return 1 if the key exchange succeeded or 0 if it failed.
+ */
+static int LoadGeneratorDiffieHellmanAlice(int Socket_Bob)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(&Curve);
+	char Is_Resuming;
+	unsigned char Private_Key[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Bob[PROTOCOL_MAXIMUM_NUMBER_SIZE], Shared_Secret[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	unsigned char Master_Key[SESSION_CACHE_KEY_LENGTH], Ticket[SESSION_CACHE_TICKET_LENGTH];
+	mpz_t Number_Shared_Secret;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Number_Shared_Secret);
+	
+	// Bob tells whether he resumes a session
+	if (!NetworkReceiveBuffer(Socket_Bob, &Is_Resuming, sizeof(Is_Resuming)) || Is_Resuming) goto Exit;
+	
+	// Exchange the X coordinates of a.G and b.G
+	if (!ProtocolGenerateKeys(&Curve, Private_Key, Public_Key)) goto Exit;
+	if (!LoadGeneratorReceiveNumber(Socket_Bob, Field_Element_Size, Public_Key_Bob)) goto Exit;
+	LoadGeneratorSendNumber(Socket_Bob, Public_Key, Field_Element_Size);
+	
+	// Compute the shared secret
+	if (!ProtocolDiffieHellmanComputeSharedSecret(&Curve, Private_Key, Public_Key_Bob, Shared_Secret)) goto Exit;
+	ProtocolImportNumber(Shared_Secret, Field_Element_Size, Number_Shared_Secret);
+	
+	// Give Bob a ticket
+	SessionCacheDeriveMasterKey(Number_Shared_Secret, Master_Key);
+	pthread_mutex_lock(&Sessions_Cache_Mutex);
+	Return_Value = SessionCacheStore(&Sessions_Cache, Master_Key, Ticket);
+	pthread_mutex_unlock(&Sessions_Cache_Mutex);
+	if (Return_Value) Return_Value = NetworkSendBuffer(Socket_Bob, Ticket, sizeof(Ticket));
+	
+Exit:
+	mpz_clear(Number_Shared_Secret);
+	return Return_Value;
+}
+
+/** Bob's side of the Diffie_Hellman program, without a session ticket.
+ * @param Socket_Alice Server's socket.
+ * @return 1 if the key exchange succeeded or 0 if it failed.
+ */
+static int LoadGeneratorDiffieHellmanBob(int Socket_Alice)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(&Curve);
+	char Is_Resuming = 0;
+	unsigned char Private_Key[PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Public_Key_Alice[PROTOCOL_MAXIMUM_NUMBER_SIZE], Shared_Secret[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	unsigned char Ticket[SESSION_CACHE_TICKET_LENGTH];
+	
+	if (!NetworkSendBuffer(Socket_Alice, &Is_Resuming, sizeof(Is_Resuming))) return 0;
+	
+	// Exchange the X coordinates of b.G and a.G
+	if (!ProtocolGenerateKeys(&Curve, Private_Key, Public_Key)) return 0;
+	LoadGeneratorSendNumber(Socket_Alice, Public_Key, Field_Element_Size);
+	if (!LoadGeneratorReceiveNumber(Socket_Alice, Field_Element_Size, Public_Key_Alice)) return 0;
+	
+	// Compute the shared secret and receive the ticket
+	if (!ProtocolDiffieHellmanComputeSharedSecret(&Curve, Private_Key, Public_Key_Alice, Shared_Secret)) return 0;
+	return NetworkReceiveBuffer(Socket_Alice, Ticket, sizeof(Ticket));
+}
+
+/** Alice's side of the ElGamal program.
+ * @param Socket_Bob Client's socket.
+ * @return 1 if Bob's message was deciphered or 0 if it failed.
+ */
+static int LoadGeneratorElGamalAlice(int Socket_Bob)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(&Curve);
+	unsigned char C1[PROTOCOL_MAXIMUM_NUMBER_SIZE], C2[PROTOCOL_MAXIMUM_NUMBER_SIZE], Message[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	
+	// Send the public key X coordinate and receive C1 and C2
+	LoadGeneratorSendNumber(Socket_Bob, Public_Key_Alice, Field_Element_Size);
+	if (!LoadGeneratorReceiveNumber(Socket_Bob, Field_Element_Size, C1) || !LoadGeneratorReceiveNumber(Socket_Bob, Field_Element_Size, C2)) return 0;
+	
+	// Decipher the message
+	return ProtocolElGamalDecrypt(&Curve, Private_Key_Alice, C1, C2, Message);
+}
+
+/** Bob's side of the ElGamal program, a random message is ciphered.
+ * @param Socket_Alice Server's socket.
+ * @return 1 if the message was sent or 0 if it failed.
+ */
+static int LoadGeneratorElGamalBob(int Socket_Alice)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(&Curve);
+	unsigned char Public_Key[PROTOCOL_MAXIMUM_NUMBER_SIZE], Message[PROTOCOL_MAXIMUM_NUMBER_SIZE], C1[PROTOCOL_MAXIMUM_NUMBER_SIZE], C2[PROTOCOL_MAXIMUM_NUMBER_SIZE];
+	mpz_t Number_Message;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Number_Message);
+	
+	// Receive Alice's public key
+	if (!LoadGeneratorReceiveNumber(Socket_Alice, Field_Element_Size, Public_Key)) goto Exit;
+	
+	// Send C1 = k.G and C2 = M + x(k.Q)
+	UtilsGenerateRandomNumber(Curve.p, Number_Message);
+	ProtocolExportNumber(Number_Message, Field_Element_Size, Message);
+	if (!ProtocolElGamalEncrypt(&Curve, Public_Key, Message, C1, C2)) goto Exit;
+	LoadGeneratorSendNumber(Socket_Alice, C1, Field_Element_Size);
+	LoadGeneratorSendNumber(Socket_Alice, C2, Field_Element_Size);
+	Return_Value = 1;
+	
+Exit:
+	mpz_clear(Number_Message);
+	return Return_Value;
+}
+
+/** Alice's side of the DSA program.
+ * @param Socket_Bob Client's socket.
+ * @return 1 if the signed message was sent or 0 if it failed.
+ */
+static int LoadGeneratorDSAAlice(int Socket_Bob)
+{
+	char Message[] = LOAD_GENERATOR_DSA_MESSAGE;
+	int Message_Length = sizeof(Message); // With the terminating zero like the program
+	unsigned char Signature[ENCODING_MAXIMUM_RAW_SIGNATURE_SIZE];
+	
+	// Send the compressed public key and the message
+	NetworkSendBuffer(Socket_Bob, Public_Key_Alice_SEC1, Public_Key_Alice_SEC1_Size);
+	NetworkSendBuffer(Socket_Bob, &Message_Length, sizeof(Message_Length));
+	NetworkSendBuffer(Socket_Bob, Message, Message_Length);
+	
+	// Sign the message and send the raw signature
+	if (!ProtocolDSASign(&Curve, Private_Key_Alice, (unsigned char *) Message, Message_Length, Signature)) return 0;
+	return NetworkSendBuffer(Socket_Bob, Signature, 2 * ProtocolGetScalarSize(&Curve));
+}
+
+/** Bob's side of the DSA program, the signature is checked without the public keys cache (each Bob sees Alice's key for the first time).
+ * @param Socket_Alice Server's socket.
+ * @return 1 if the signature matched or 0 if it failed.
+ */
+static int LoadGeneratorDSABob(int Socket_Alice)
+{
+	char Message[sizeof(LOAD_GENERATOR_DSA_MESSAGE)];
+	int Message_Length;
+	size_t Public_Key_SEC1_Size = 1 + ProtocolGetFieldElementSize(&Curve);
+	unsigned char Public_Key_SEC1[ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE], Public_Key[2 * PROTOCOL_MAXIMUM_NUMBER_SIZE], Signature[ENCODING_MAXIMUM_RAW_SIGNATURE_SIZE];
+	TPoint Point_Public_Key;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	PointCreate(0, 0, &Point_Public_Key);
+	
+	// Receive the compressed public key, Y is found back from X and its parity
+	if (!NetworkReceiveBuffer(Socket_Alice, Public_Key_SEC1, Public_Key_SEC1_Size) || !EncodingImportSEC1PublicKey(&Curve, Public_Key_SEC1, Public_Key_SEC1_Size, &Point_Public_Key)) goto Exit;
+	if (!EncodingExportRawPublicKey(&Curve, &Point_Public_Key, Public_Key)) goto Exit;
+	
+	// Receive the message and the raw signature
+	if (!NetworkReceiveBuffer(Socket_Alice, &Message_Length, sizeof(Message_Length)) || (Message_Length <= 0) || (Message_Length > (int) sizeof(Message))) goto Exit;
+	if (!NetworkReceiveBuffer(Socket_Alice, Message, Message_Length)) goto Exit;
+	if (!NetworkReceiveBuffer(Socket_Alice, Signature, 2 * ProtocolGetScalarSize(&Curve))) goto Exit;
+	
+	// Check the signature
+	Return_Value = ProtocolDSAVerify(&Curve, NULL, Public_Key, (unsigned char *) Message, Message_Length, Signature);
+	
+Exit:
+	PointFree(&Point_Public_Key);
+	return Return_Value;
+}
+
+/** Alice's server thread, accept Bobs one after the other until the level is stopped.
+ * @param Pointer_Parameters The level.
+ * @return NULL.
+ */
+static void *LoadGeneratorAliceThread(void *Pointer_Parameters)
+{
+	TLoadGeneratorLevel *Pointer_Level = Pointer_Parameters;
+	int Socket_Bob, Is_Successful;
+	unsigned long long Bytes_Count;
+	
+	while (1)
+	{
+		Socket_Bob = NetworkServerListen(Pointer_Level->Socket_Server);
+		if (Socket_Bob < 0) break;
+	
+		// The connection made to stop the thread carries no session
+		if (__atomic_load_n(&Pointer_Level->Is_Stopping, __ATOMIC_ACQUIRE))
+		{
+			close(Socket_Bob);
+			break;
+		}
+	
+		// Bob has sent everything once the session is over, so all his bytes are accounted
+		Is_Successful = Pointer_Level->Pointer_Protocol->Function_Alice(Socket_Bob);
+		Bytes_Count = LoadGeneratorGetReceivedBytesCount(Socket_Bob);
+		close(Socket_Bob);
+	
+		pthread_mutex_lock(&Pointer_Level->Mutex);
+		Pointer_Level->Bytes_Count += Bytes_Count;
+		if (!Is_Successful) Pointer_Level->Failures_Count++;
+		pthread_mutex_unlock(&Pointer_Level->Mutex);
+	}
+	return NULL;
+}
+
+/** A Bob client thread, run sessions until the level amount is reached.
+ * @param Pointer_Parameters The level.
+ * @return NULL.
+ */
+static void *LoadGeneratorBobThread(void *Pointer_Parameters)
+{
+	TLoadGeneratorLevel *Pointer_Level = Pointer_Parameters;
+	int Session_Index, Socket_Alice, Is_Successful;
+	long long Start_Time;
+	unsigned long long Bytes_Count;
+	struct timeval Timeout = { LOAD_GENERATOR_RECEIVE_TIMEOUT, 0 };
+	
+	while (1)
+	{
+		// Take the next session
+		pthread_mutex_lock(&Pointer_Level->Mutex);
+		Session_Index = Pointer_Level->Next_Session_Index;
+		if (Session_Index < Pointer_Level->Sessions_Count) Pointer_Level->Next_Session_Index++;
+		pthread_mutex_unlock(&Pointer_Level->Mutex);
+		if (Session_Index >= Pointer_Level->Sessions_Count) break;
+	
+		// The latency includes the connection, which waits when Alice's backlog is full
+		Start_Time = UtilsGetTime();
+		Socket_Alice = NetworkClientConnect(LOAD_GENERATOR_ADDRESS, Pointer_Level->Port);
+		if (Socket_Alice < 0)
+		{
+			Is_Successful = 0;
+			Bytes_Count = 0;
+		}
+		else
+		{
+			setsockopt(Socket_Alice, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+			Is_Successful = Pointer_Level->Pointer_Protocol->Function_Bob(Socket_Alice);
+			Bytes_Count = LoadGeneratorGetReceivedBytesCount(Socket_Alice);
+			close(Socket_Alice);
+		}
+		Pointer_Level->Pointer_Latencies[Session_Index] = UtilsGetTime() - Start_Time;
+	
+		pthread_mutex_lock(&Pointer_Level->Mutex);
+		Pointer_Level->Bytes_Count += Bytes_Count;
+		if (!Is_Successful) Pointer_Level->Failures_Count++;
+		pthread_mutex_unlock(&Pointer_Level->Mutex);
+	}
+	return NULL;
+}
+
+/** Sort the latencies with qsort().
+ * @param Pointer_A First latency.
+ * @param Pointer_B Second latency.
+ * @return A negative, null or positive value like strcmp().
+ */
+static int LoadGeneratorCompareLatencies(const void *Pointer_A, const void *Pointer_B)
+{
+	long long A = *((long long *) Pointer_A), B = *((long long *) Pointer_B);
+	
+	if (A < B) return -1;
+	if (A > B) return 1;
+	return 0;
+}
+
+/** Run all sessions of a concurrency level and display the results.
+ * @param Pointer_Protocol The protocol to measure.
+ * @param Sessions_Count How many sessions to run.
+ * @param Concurrency How many Bobs run at the same time.
+ * @param Alice_Threads_Count How many threads accept the Bobs.
+ * @return 1 if the level was measured or 0 if an error occurred.
+ */
+static int LoadGeneratorRunLevel(TLoadGeneratorProtocol *Pointer_Protocol, int Sessions_Count, int Concurrency, int Alice_Threads_Count)
+{
+	TLoadGeneratorLevel Level;
+	pthread_t *Pointer_Alice_Threads, *Pointer_Bob_Threads;
+	struct sockaddr_in Address;
+	socklen_t Address_Size = sizeof(Address);
+	long long Start_Time, Elapsed_Time, Start_Process_Time, Process_Time;
+	int i, Socket, Alice_Threads_Started_Count = 0, Bob_Threads_Started_Count = 0, Return_Value = 0;
+	
+	// Initialize the level
+	memset(&Level, 0, sizeof(Level));
+	Level.Pointer_Protocol = Pointer_Protocol;
+	Level.Sessions_Count = Sessions_Count;
+	pthread_mutex_init(&Level.Mutex, NULL);
+	Level.Pointer_Latencies = malloc(Sessions_Count * sizeof(long long));
+	Pointer_Alice_Threads = malloc(Alice_Threads_Count * sizeof(pthread_t));
+	Pointer_Bob_Threads = malloc(Concurrency * sizeof(pthread_t));
+	if ((Level.Pointer_Latencies == NULL) || (Pointer_Alice_Threads == NULL) || (Pointer_Bob_Threads == NULL))
+	{
+		printf("Error : not enough memory.\n");
+		goto Exit;
+	}
+	
+	// Start Alice's server on a free port
+	Level.Socket_Server = NetworkServerCreate(LOAD_GENERATOR_ADDRESS, 0);
+	if (Level.Socket_Server < 0)
+	{
+		printf("Error : could not create the server.\n");
+		goto Exit;
+	}
+	getsockname(Level.Socket_Server, (struct sockaddr *) &Address, &Address_Size);
+	Level.Port = ntohs(Address.sin_port);
+	listen(Level.Socket_Server, 1); // The port must accept connections before Alice's threads run
+	
+	Start_Time = UtilsGetTime();
+	Start_Process_Time = LoadGeneratorGetProcessTime();
+	for (Alice_Threads_Started_Count = 0; Alice_Threads_Started_Count < Alice_Threads_Count; Alice_Threads_Started_Count++)
+	{
+		if (pthread_create(&Pointer_Alice_Threads[Alice_Threads_Started_Count], NULL, LoadGeneratorAliceThread, &Level) != 0)
+		{
+			printf("Error : could not create Alice's threads.\n");
+			break;
+		}
+	}
+	if (Alice_Threads_Started_Count == Alice_Threads_Count)
+	{
+		for (Bob_Threads_Started_Count = 0; Bob_Threads_Started_Count < Concurrency; Bob_Threads_Started_Count++)
+		{
+			if (pthread_create(&Pointer_Bob_Threads[Bob_Threads_Started_Count], NULL, LoadGeneratorBobThread, &Level) != 0)
+			{
+				printf("Error : could not create the Bobs threads.\n");
+				
+				// The started Bobs stop after their current session
+				pthread_mutex_lock(&Level.Mutex);
+				Level.Next_Session_Index = Sessions_Count;
+				pthread_mutex_unlock(&Level.Mutex);
+				break;
+			}
+		}
+		for (i = 0; i < Bob_Threads_Started_Count; i++) pthread_join(Pointer_Bob_Threads[i], NULL);
+	}
+	Elapsed_Time = UtilsGetTime() - Start_Time;
+	Process_Time = LoadGeneratorGetProcessTime() - Start_Process_Time;
+	
+	// Wake each of Alice's started threads with an empty connection
+	__atomic_store_n(&Level.Is_Stopping, 1, __ATOMIC_RELEASE);
+	for (i = 0; i < Alice_Threads_Started_Count; i++)
+	{
+		Socket = NetworkClientConnect(LOAD_GENERATOR_ADDRESS, Level.Port);
+		if (Socket >= 0) close(Socket);
+	}
+	for (i = 0; i < Alice_Threads_Started_Count; i++) pthread_join(Pointer_Alice_Threads[i], NULL);
+	close(Level.Socket_Server);
+	if ((Alice_Threads_Started_Count < Alice_Threads_Count) || (Bob_Threads_Started_Count < Concurrency)) goto Exit;
+	
+	// Display the results
+	qsort(Level.Pointer_Latencies, Sessions_Count, sizeof(long long), LoadGeneratorCompareLatencies);
+	printf("%-8s %11d %12.1f %9.2f %9.2f %9.2f %9.2f %13lld %13llu %8d\n", Pointer_Protocol->String_Name, Concurrency, Sessions_Count * 1e6 / Elapsed_Time,
+		Level.Pointer_Latencies[Sessions_Count / 2] / 1000.0, Level.Pointer_Latencies[Sessions_Count * 90 / 100] / 1000.0, Level.Pointer_Latencies[Sessions_Count * 99 / 100] / 1000.0,
+		Level.Pointer_Latencies[Sessions_Count - 1] / 1000.0, Process_Time / Sessions_Count, Level.Bytes_Count / Sessions_Count, Level.Failures_Count);
+	fflush(stdout);
+	Return_Value = 1;
+	
+Exit:
+	free(Level.Pointer_Latencies);
+	free(Pointer_Alice_Threads);
+	free(Pointer_Bob_Threads);
+	pthread_mutex_destroy(&Level.Mutex);
+	return Return_Value;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	static TLoadGeneratorProtocol Protocols[] =
+	{
+		{ "dh", LoadGeneratorDiffieHellmanAlice, LoadGeneratorDiffieHellmanBob },
+		{ "elgamal", LoadGeneratorElGamalAlice, LoadGeneratorElGamalBob },
+		{ "dsa", LoadGeneratorDSAAlice, LoadGeneratorDSABob }
+	};
+	int Sessions_Count = LOAD_GENERATOR_DEFAULT_SESSIONS_COUNT, Maximum_Concurrency = LOAD_GENERATOR_DEFAULT_MAXIMUM_CONCURRENCY, Alice_Threads_Count = LOAD_GENERATOR_DEFAULT_ALICE_THREADS_COUNT;
+	int i, Concurrency, Is_Protocol_Found = 0, Return_Value = 0;
+	TPoint Point_Public_Key;
+	
+	// Check parameters
+	if ((argc < 3) || (argc > 6))
+	{
+		printf("Error : bad parameters.\n" \
+			"Usage : %s Protocol EllipticCurve [SessionsCount] [MaximumConcurrency] [AliceThreadsCount]\n" \
+			"Protocol is dh, elgamal, dsa or all. EllipticCurve is a built-in curve name or a curve file path.\n" \
+			"SessionsCount sessions are run for each concurrency level (default %d), the concurrency is doubled from 1 to MaximumConcurrency (default %d).\n" \
+			"AliceThreadsCount threads accept the Bobs (default %d, like the protocol programs).\n", argv[0], LOAD_GENERATOR_DEFAULT_SESSIONS_COUNT, LOAD_GENERATOR_DEFAULT_MAXIMUM_CONCURRENCY,
+			LOAD_GENERATOR_DEFAULT_ALICE_THREADS_COUNT);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
+		return -1;
+	}
+	if (argc >= 4) Sessions_Count = atoi(argv[3]);
+	if (argc >= 5) Maximum_Concurrency = atoi(argv[4]);
+	if (argc == 6) Alice_Threads_Count = atoi(argv[5]);
+	if ((Sessions_Count < 1) || (Maximum_Concurrency < 1) || (Alice_Threads_Count < 1))
+	{
+		printf("Error : the sessions, concurrency and threads counts must be positive.\n");
+		return -1;
+	}
+	
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(argv[2], &Curve))
+	{
+		printf("Error : can't load curve file.\n");
+		return -2;
+	}
+	
+	// A Bob closing early must not kill the process while Alice writes to him
+	signal(SIGPIPE, SIG_IGN);
+	UtilsInitializeRandomGenerator();
+	
+	// Alice's long-term keys
+	PointCreate(0, 0, &Point_Public_Key);
+	if (ProtocolGenerateKeys(&Curve, Private_Key_Alice, Public_Key_Alice) && EncodingImportRawPublicKey(&Curve, Public_Key_Alice, &Point_Public_Key)) Public_Key_Alice_SEC1_Size = EncodingExportSEC1PublicKey(&Curve, &Point_Public_Key, 1, Public_Key_Alice_SEC1);
+	PointFree(&Point_Public_Key);
+	if (Public_Key_Alice_SEC1_Size == 0)
+	{
+		printf("Error : could not generate Alice's keys.\n");
+		Return_Value = -3;
+		goto Exit;
+	}
+	if (!SessionCacheCreate(&Sessions_Cache, LOAD_GENERATOR_SESSIONS_CACHE_CAPACITY, 60 * 60))
+	{
+		printf("Error : could not create the sessions cache.\n");
+		Return_Value = -3;
+		goto Exit;
+	}
+	
+	printf("Protocol Concurrency   Sessions/s  p50 (ms)  p90 (ms)  p99 (ms)  max (ms) CPU/session (us) Bytes/session Failures\n");
+	for (i = 0; i < (int) (sizeof(Protocols) / sizeof(Protocols[0])); i++)
+	{
+		if ((strcmp(argv[1], "all") != 0) && (strcmp(argv[1], Protocols[i].String_Name) != 0)) continue;
+		Is_Protocol_Found = 1;
+	
+		for (Concurrency = 1; Concurrency <= Maximum_Concurrency; Concurrency *= 2)
+		{
+			if (!LoadGeneratorRunLevel(&Protocols[i], Sessions_Count, Concurrency, Alice_Threads_Count))
+			{
+				Return_Value = -4;
+				goto Exit_Sessions_Cache;
+			}
+		}
+	}
+	if (!Is_Protocol_Found)
+	{
+		printf("Error : unknown protocol.\n");
+		Return_Value = -1;
+	}
+	
+Exit_Sessions_Cache:
+	SessionCacheFree(&Sessions_Cache);
+Exit:
+	ECFree(&Curve);
+	return Return_Value;
+}
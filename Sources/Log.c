@@ -0,0 +1,194 @@
+/** @file Log.c
+ * Levelled logging through a pluggable sink, with an optional background writer thread.
+ */
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "Log.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** A formatted message waiting for the writer thread. */
+typedef struct
+{
+	int Level; //! The message level.
+	char String_Message[LOG_MAXIMUM_MESSAGE_SIZE]; //! The formatted message.
+} TLogMessage;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public variables
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int Log_Level = LOG_LEVEL_NONE;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Where messages are written. */
+static TLogSink Log_Function_Sink;
+/** Given to the sink. */
+static void *Log_Pointer_User_Data;
+
+/** Tell if the writer thread is running. */
+static int Log_Is_Asynchronous = 0;
+/** Tell the writer thread to exit once the queue is empty. */
+static int Log_Is_Stopping;
+/** The writer thread. */
+static pthread_t Log_Thread;
+/** Protect the queue. */
+static pthread_mutex_t Log_Mutex = PTHREAD_MUTEX_INITIALIZER;
+/** Signaled when a message is queued or when the thread must stop. */
+static pthread_cond_t Log_Condition_Message_Queued = PTHREAD_COND_INITIALIZER;
+/** Circular buffer of waiting messages. */
+static TLogMessage Log_Queue[LOG_QUEUE_SIZE];
+/** Index of the oldest waiting message. */
+static int Log_Queue_Front = 0;
+/** How many messages are waiting. */
+static int Log_Queue_Messages_Count = 0;
+/** How many messages were dropped because the queue was full. */
+static unsigned long long Log_Dropped_Messages_Count = 0;
+/** Tell if LogStop() was registered to be called at exit. */
+static int Log_Is_Exit_Handler_Registered = 0;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The default sink writing messages as is to the standard output (see TLogSink). */
+static void LogSinkStandardOutput(int __attribute__((unused)) Level, char *String_Message, void __attribute__((unused)) *Pointer_User_Data)
+{
+	fputs(String_Message, stdout);
+	fflush(stdout);
+}
+
+/** Hand the queued messages to the sink until logging is stopped.
+ * @param Pointer_Parameters Not used.
+ * @return Always NULL.
+ */
+static void *LogWriterThread(void __attribute__((unused)) *Pointer_Parameters)
+{
+	TLogMessage Message;
+	unsigned long long Dropped_Messages_Count;
+	char String_Dropped_Message[64];
+	
+	pthread_mutex_lock(&Log_Mutex);
+	while (1)
+	{
+		while ((Log_Queue_Messages_Count == 0) && !Log_Is_Stopping) pthread_cond_wait(&Log_Condition_Message_Queued, &Log_Mutex);
+		if (Log_Queue_Messages_Count == 0) break; // Stopping and nothing left to write
+		
+		// Copy the message so the sink is called without holding the lock
+		memcpy(&Message, &Log_Queue[Log_Queue_Front], sizeof(TLogMessage));
+		Log_Queue_Front = (Log_Queue_Front + 1) % LOG_QUEUE_SIZE;
+		Log_Queue_Messages_Count--;
+		Dropped_Messages_Count = Log_Dropped_Messages_Count;
+		Log_Dropped_Messages_Count = 0;
+		pthread_mutex_unlock(&Log_Mutex);
+		
+		if (Dropped_Messages_Count > 0)
+		{
+			snprintf(String_Dropped_Message, sizeof(String_Dropped_Message), "[Log] %llu message(s) dropped.\n", Dropped_Messages_Count);
+			Log_Function_Sink(LOG_LEVEL_WARNING, String_Dropped_Message, Log_Pointer_User_Data);
+		}
+		Log_Function_Sink(Message.Level, Message.String_Message, Log_Pointer_User_Data);
+		
+		pthread_mutex_lock(&Log_Mutex);
+	}
+	pthread_mutex_unlock(&Log_Mutex);
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int LogStart(int Level, TLogSink Function_Sink, void *Pointer_User_Data, int Is_Asynchronous)
+{
+	// Restart from a clean state if logging was already enabled
+	LogStop();
+	
+	Log_Function_Sink = Function_Sink == NULL ? LogSinkStandardOutput : Function_Sink;
+	Log_Pointer_User_Data = Pointer_User_Data;
+	if (Is_Asynchronous && (Level > LOG_LEVEL_NONE))
+	{
+		Log_Is_Stopping = 0;
+		if (pthread_create(&Log_Thread, NULL, LogWriterThread, NULL) != 0) return 0;
+		Log_Is_Asynchronous = 1;
+	}
+	
+	if (!Log_Is_Exit_Handler_Registered)
+	{
+		atexit(LogStop);
+		Log_Is_Exit_Handler_Registered = 1;
+	}
+	
+	Log_Level = Level;
+	return 1;
+}
+
+void LogStop(void)
+{
+	Log_Level = LOG_LEVEL_NONE;
+	if (!Log_Is_Asynchronous) return;
+	
+	// Let the thread write the remaining messages
+	pthread_mutex_lock(&Log_Mutex);
+	Log_Is_Stopping = 1;
+	pthread_cond_signal(&Log_Condition_Message_Queued);
+	pthread_mutex_unlock(&Log_Mutex);
+	pthread_join(Log_Thread, NULL);
+	Log_Is_Asynchronous = 0;
+}
+
+int LogParseLevel(char *String_Level, int Default_Level)
+{
+	char *String_Names[] = {"none", "error", "warning", "info", "debug"};
+	int i;
+	
+	if (String_Level == NULL) return Default_Level;
+	for (i = LOG_LEVEL_NONE; i <= LOG_LEVEL_DEBUG; i++)
+	{
+		if (strcmp(String_Level, String_Names[i]) == 0) return i;
+	}
+	return Default_Level;
+}
+
+void LogWrite(int Level, const char *String_Format, ...)
+{
+	va_list Arguments_List;
+	TLogMessage *Pointer_Message;
+	char String_Message[LOG_MAXIMUM_MESSAGE_SIZE];
+	int Length;
+	
+	if (Level > Log_Level) return;
+	
+	// Format outside of the lock so concurrent threads format in parallel
+	va_start(Arguments_List, String_Format);
+	Length = gmp_vsnprintf(String_Message, sizeof(String_Message), String_Format, Arguments_List);
+	va_end(Arguments_List);
+	if (Length < 0) return;
+	if (Length >= LOG_MAXIMUM_MESSAGE_SIZE) Length = LOG_MAXIMUM_MESSAGE_SIZE - 1;
+	
+	// Write directly when there is no writer thread
+	if (!Log_Is_Asynchronous)
+	{
+		Log_Function_Sink(Level, String_Message, Log_Pointer_User_Data);
+		return;
+	}
+	
+	pthread_mutex_lock(&Log_Mutex);
+	
+	// Never wait for the sink, drop the message instead
+	if (Log_Queue_Messages_Count >= LOG_QUEUE_SIZE) Log_Dropped_Messages_Count++;
+	else
+	{
+		Pointer_Message = &Log_Queue[(Log_Queue_Front + Log_Queue_Messages_Count) % LOG_QUEUE_SIZE];
+		Pointer_Message->Level = Level;
+		memcpy(Pointer_Message->String_Message, String_Message, Length + 1);
+		Log_Queue_Messages_Count++;
+		pthread_cond_signal(&Log_Condition_Message_Queued);
+	}
+	
+	pthread_mutex_unlock(&Log_Mutex);
+}
@@ -0,0 +1,79 @@
+/** @file Log.h
+ * Levelled logging through a pluggable sink. Messages are formatted by the caller only when their level is enabled, then an optional background thread hands them to the sink,
+ * so the protocol code never waits for the terminal. Logging is off by default.
+ */
+#ifndef H_LOG_H
+#define H_LOG_H
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** Nothing is logged. */
+#define LOG_LEVEL_NONE 0
+/** Failures. */
+#define LOG_LEVEL_ERROR 1
+/** Unexpected but handled situations. */
+#define LOG_LEVEL_WARNING 2
+/** Protocol steps. */
+#define LOG_LEVEL_INFO 3
+/** Protocol values (keys, points, hashes...), formatting them is costly. */
+#define LOG_LEVEL_DEBUG 4
+
+/** Maximum size in characters (including the terminating zero) of a formatted message, longer messages are truncated. */
+#define LOG_MAXIMUM_MESSAGE_SIZE 1024
+/** How many messages can wait for the background thread, the following ones are dropped until the sink catches up. */
+#define LOG_QUEUE_SIZE 256
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** Write a message somewhere.
+ * @param Level The message level.
+ * @param String_Message The formatted message (it is not valid anymore when the function returns).
+ * @param Pointer_User_Data The value given to LogStart().
+ */
+typedef void (*TLogSink)(int Level, char *String_Message, void *Pointer_User_Data);
+
+//--------------------------------------------------------------------------------------------------------
+// Variables
+//--------------------------------------------------------------------------------------------------------
+/** The most verbose level written (read it through the LOG_* macros). */
+extern int Log_Level;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Enable logging. LogStop() is automatically called when the program exits, so no message is lost.
+ * @param Level The most verbose level to write.
+ * @param Function_Sink Where to write the messages, or NULL to write them to the standard output.
+ * @param Pointer_User_Data Given to the sink.
+ * @param Is_Asynchronous Set to 1 to let a background thread call the sink or to 0 to call it from the logging thread.
+ * @return 1 if logging was enabled or 0 if the background thread could not be started.
+ */
+int LogStart(int Level, TLogSink Function_Sink, void *Pointer_User_Data, int Is_Asynchronous);
+
+/** Write the waiting messages, stop the background thread and disable logging. */
+void LogStop(void);
+
+/** Convert a level name to its value.
+ * @param String_Level A level name ("none", "error", "warning", "info" or "debug"), it can be NULL.
+ * @param Default_Level The value to return when the name is NULL or unknown.
+ * @return The level value.
+ */
+int LogParseLevel(char *String_Level, int Default_Level);
+
+/** Format and write a message, use the LOG_* macros instead so nothing is formatted when the level is disabled.
+ * @param Level The message level.
+ * @param String_Format A gmp_printf() format.
+ */
+void LogWrite(int Level, const char *String_Format, ...);
+
+//--------------------------------------------------------------------------------------------------------
+// Macros
+//--------------------------------------------------------------------------------------------------------
+#define LOG_ERROR(...) do { if (Log_Level >= LOG_LEVEL_ERROR) LogWrite(LOG_LEVEL_ERROR, __VA_ARGS__); } while (0)
+#define LOG_WARNING(...) do { if (Log_Level >= LOG_LEVEL_WARNING) LogWrite(LOG_LEVEL_WARNING, __VA_ARGS__); } while (0)
+#define LOG_INFO(...) do { if (Log_Level >= LOG_LEVEL_INFO) LogWrite(LOG_LEVEL_INFO, __VA_ARGS__); } while (0)
+#define LOG_DEBUG(...) do { if (Log_Level >= LOG_LEVEL_DEBUG) LogWrite(LOG_LEVEL_DEBUG, __VA_ARGS__); } while (0)
+
+#endif
@@ -0,0 +1,366 @@
+/** @file Modular_Inversion.c
+ * See Modular_Inversion.h for description.
+ * The safegcd implementation follows "Fast constant-time gcd computation and modular inversion" (Bernstein and Yang, 2019) : divsteps are computed 62 at a time on the low bits
+ * of f and g only, giving a 2x2 transition matrix scaled by 2^62 which is then applied to the full f, g numbers and to the d, e Bezout coefficients. d and e are kept in ]-2.m, m[
+ * by adding multiples of m chosen so the division by 2^62 is exact, like libsecp256k1 does.
+ */
+#include <stdint.h>
+#include <string.h>
+#include <gmp.h>
+#include "Modular_Inversion.h"
+
+#if defined(__SIZEOF_INT128__) && (GMP_NUMB_BITS == 64)
+	/** The safegcd implementation multiplies 64-bit limbs into 128-bit integers and packs the 62-bit limbs into 64-bit GMP limbs. */
+	#define MODULAR_INVERSION_IS_SAFEGCD_AVAILABLE 1
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** How many divsteps are computed on the low bits before updating the full numbers. */
+#define MODULAR_INVERSION_BATCH_DIVSTEPS_COUNT 62
+
+/** Keep the bits of a 62-bit limb. */
+#define MODULAR_INVERSION_LIMB_MASK (UINT64_MAX >> 2)
+
+#ifdef MODULAR_INVERSION_IS_SAFEGCD_AVAILABLE
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The transition matrix of a batch of divsteps, scaled by 2^62 : [f', g'].2^62 = [U V ; Q R].[f, g]. */
+typedef struct
+{
+	int64_t U;
+	int64_t V;
+	int64_t Q;
+	int64_t R;
+} TModularInversionMatrix;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Run a batch of divsteps on the low bits of f and g, without any branch depending on their values.
+ * A divstep computes (delta, f, g) = (1 - delta, g, (g - f) / 2) when delta > 0 and g is odd, or (1 + delta, f, (g + (g mod 2).f) / 2) otherwise.
+ * @param Delta The current delta value.
+ * @param F_Low The 64 low bits of f.
+ * @param G_Low The 64 low bits of g.
+ * @param Pointer_Output_Matrix On output, contain the batch transition matrix.
+ * @return The new delta value.
+ */
+static int64_t ModularInversionDivsteps(int64_t Delta, uint64_t F_Low, uint64_t G_Low, TModularInversionMatrix *Pointer_Output_Matrix)
+{
+	// The matrix entries are signed numbers in [-2^62, 2^62], they are computed as unsigned numbers so they can be shifted left
+	uint64_t U = 1, V = 0, Q = 0, R = 1, F = F_Low, G = G_Low, Mask_Swap, Mask_Odd, X, Y, Z;
+	int i;
+	
+	for (i = 0; i < MODULAR_INVERSION_BATCH_DIVSTEPS_COUNT; i++)
+	{
+		// Compute the condition masks (delta > 0) and (g is odd)
+		Mask_Swap = (uint64_t) (-Delta >> 63);
+		Mask_Odd = -(G & 1);
+		
+		// Add f (or -f when delta > 0) to g when g is odd
+		X = (F ^ Mask_Swap) - Mask_Swap;
+		Y = (U ^ Mask_Swap) - Mask_Swap;
+		Z = (V ^ Mask_Swap) - Mask_Swap;
+		G += X & Mask_Odd;
+		Q += Y & Mask_Odd;
+		R += Z & Mask_Odd;
+		
+		// When both conditions hold, delta becomes 1 - delta and f becomes the old g (f + (g - f)), otherwise delta is incremented
+		Mask_Swap &= Mask_Odd;
+		Delta = (Delta ^ (int64_t) Mask_Swap) - (int64_t) Mask_Swap + 1;
+		F += G & Mask_Swap;
+		U += Q & Mask_Swap;
+		V += R & Mask_Swap;
+		
+		// g is divided by 2, so f coefficients are doubled to keep the same scale
+		G >>= 1;
+		U <<= 1;
+		V <<= 1;
+	}
+	
+	Pointer_Output_Matrix->U = (int64_t) U;
+	Pointer_Output_Matrix->V = (int64_t) V;
+	Pointer_Output_Matrix->Q = (int64_t) Q;
+	Pointer_Output_Matrix->R = (int64_t) R;
+	return Delta;
+}
+
+/** Apply a transition matrix to f and g : [f, g] = [U V ; Q R].[f, g] / 2^62, the division is exact.
+ * @param Pointer_F The f limbs.
+ * @param Pointer_G The g limbs.
+ * @param Pointer_Matrix The transition matrix.
+ * @param Limbs_Count How many limbs f and g have.
+ */
+static void ModularInversionUpdateFG(int64_t *Pointer_F, int64_t *Pointer_G, TModularInversionMatrix *Pointer_Matrix, int Limbs_Count)
+{
+	__int128 Sum_F, Sum_G;
+	int i;
+	
+	Sum_F = (__int128) Pointer_Matrix->U * Pointer_F[0] + (__int128) Pointer_Matrix->V * Pointer_G[0];
+	Sum_G = (__int128) Pointer_Matrix->Q * Pointer_F[0] + (__int128) Pointer_Matrix->R * Pointer_G[0];
+	Sum_F >>= 62; // The 62 low bits are zero
+	Sum_G >>= 62;
+	
+	// Each limb of the product is stored one limb lower, which is the division by 2^62
+	for (i = 1; i < Limbs_Count; i++)
+	{
+		Sum_F += (__int128) Pointer_Matrix->U * Pointer_F[i] + (__int128) Pointer_Matrix->V * Pointer_G[i];
+		Sum_G += (__int128) Pointer_Matrix->Q * Pointer_F[i] + (__int128) Pointer_Matrix->R * Pointer_G[i];
+		Pointer_F[i - 1] = (int64_t) Sum_F & MODULAR_INVERSION_LIMB_MASK;
+		Pointer_G[i - 1] = (int64_t) Sum_G & MODULAR_INVERSION_LIMB_MASK;
+		Sum_F >>= 62;
+		Sum_G >>= 62;
+	}
+	Pointer_F[Limbs_Count - 1] = (int64_t) Sum_F;
+	Pointer_G[Limbs_Count - 1] = (int64_t) Sum_G;
+}
+
+/** Apply a transition matrix to the Bezout coefficients : [d, e] = ([U V ; Q R].[d, e] + m.[md, me]) / 2^62, where md and me are chosen to make the division exact and to keep d and e in ]-2.m, m[.
+ * @param Pointer_D The d limbs.
+ * @param Pointer_E The e limbs.
+ * @param Pointer_Matrix The transition matrix.
+ * @param Pointer_Modulus The modulus.
+ */
+static void ModularInversionUpdateDE(int64_t *Pointer_D, int64_t *Pointer_E, TModularInversionMatrix *Pointer_Matrix, TModularInversionModulus *Pointer_Modulus)
+{
+	int64_t U = Pointer_Matrix->U, V = Pointer_Matrix->V, Q = Pointer_Matrix->Q, R = Pointer_Matrix->R, Sign_D, Sign_E, Multiple_D, Multiple_E;
+	__int128 Sum_D, Sum_E;
+	int Limbs_Count = Pointer_Modulus->Limbs_Count, i;
+	
+	// Start with [U, Q] if d is negative and [V, R] if e is negative, so the results stay above -2.m
+	Sign_D = Pointer_D[Limbs_Count - 1] >> 63;
+	Sign_E = Pointer_E[Limbs_Count - 1] >> 63;
+	Multiple_D = (U & Sign_D) + (V & Sign_E);
+	Multiple_E = (Q & Sign_D) + (R & Sign_E);
+	
+	// Correct the multiples so the 62 low bits of the sums are zero
+	Sum_D = (__int128) U * Pointer_D[0] + (__int128) V * Pointer_E[0];
+	Sum_E = (__int128) Q * Pointer_D[0] + (__int128) R * Pointer_E[0];
+	Multiple_D -= (Pointer_Modulus->Modulus_Inverse * (uint64_t) Sum_D + Multiple_D) & MODULAR_INVERSION_LIMB_MASK;
+	Multiple_E -= (Pointer_Modulus->Modulus_Inverse * (uint64_t) Sum_E + Multiple_E) & MODULAR_INVERSION_LIMB_MASK;
+	Sum_D += (__int128) Pointer_Modulus->Modulus[0] * Multiple_D;
+	Sum_E += (__int128) Pointer_Modulus->Modulus[0] * Multiple_E;
+	Sum_D >>= 62;
+	Sum_E >>= 62;
+	
+	for (i = 1; i < Limbs_Count; i++)
+	{
+		Sum_D += (__int128) U * Pointer_D[i] + (__int128) V * Pointer_E[i] + (__int128) Pointer_Modulus->Modulus[i] * Multiple_D;
+		Sum_E += (__int128) Q * Pointer_D[i] + (__int128) R * Pointer_E[i] + (__int128) Pointer_Modulus->Modulus[i] * Multiple_E;
+		Pointer_D[i - 1] = (int64_t) Sum_D & MODULAR_INVERSION_LIMB_MASK;
+		Pointer_E[i - 1] = (int64_t) Sum_E & MODULAR_INVERSION_LIMB_MASK;
+		Sum_D >>= 62;
+		Sum_E >>= 62;
+	}
+	Pointer_D[Limbs_Count - 1] = (int64_t) Sum_D;
+	Pointer_E[Limbs_Count - 1] = (int64_t) Sum_E;
+}
+
+/** Propagate the carries of 62-bit limbs, all limbs but the last one end in [0, 2^62 - 1].
+ * @param Pointer_Limbs The limbs.
+ * @param Limbs_Count How many limbs there are.
+ */
+static void ModularInversionPropagateCarries(int64_t *Pointer_Limbs, int Limbs_Count)
+{
+	int i;
+	
+	for (i = 0; i < Limbs_Count - 1; i++)
+	{
+		Pointer_Limbs[i + 1] += Pointer_Limbs[i] >> 62;
+		Pointer_Limbs[i] &= MODULAR_INVERSION_LIMB_MASK;
+	}
+}
+
+/** Add the modulus to a number when it is negative.
+ * @param Pointer_Limbs The number limbs, its carries must be propagated.
+ * @param Pointer_Modulus The modulus.
+ */
+static void ModularInversionAddModulusIfNegative(int64_t *Pointer_Limbs, TModularInversionModulus *Pointer_Modulus)
+{
+	int64_t Mask;
+	int i;
+	
+	Mask = Pointer_Limbs[Pointer_Modulus->Limbs_Count - 1] >> 63;
+	for (i = 0; i < Pointer_Modulus->Limbs_Count; i++) Pointer_Limbs[i] += Pointer_Modulus->Modulus[i] & Mask;
+	ModularInversionPropagateCarries(Pointer_Limbs, Pointer_Modulus->Limbs_Count);
+}
+
+/** Negate a number when a mask is set.
+ * @param Pointer_Limbs The number limbs.
+ * @param Limbs_Count How many limbs there are.
+ * @param Mask 0 to keep the number or -1 to negate it.
+ */
+static void ModularInversionNegateIfMasked(int64_t *Pointer_Limbs, int Limbs_Count, int64_t Mask)
+{
+	int i;
+	
+	for (i = 0; i < Limbs_Count; i++) Pointer_Limbs[i] = (Pointer_Limbs[i] ^ Mask) - Mask;
+	ModularInversionPropagateCarries(Pointer_Limbs, Limbs_Count);
+}
+
+/** Split GMP limbs into 62-bit limbs.
+ * @param Pointer_Number_Limbs The GMP limbs.
+ * @param Number_Limbs_Count How many GMP limbs there are.
+ * @param Pointer_Output_Limbs On output, contain the 62-bit limbs.
+ * @param Limbs_Count How many 62-bit limbs to write.
+ */
+static void ModularInversionNumberToLimbs(const mp_limb_t *Pointer_Number_Limbs, int Number_Limbs_Count, int64_t *Pointer_Output_Limbs, int Limbs_Count)
+{
+	uint64_t Value;
+	int i, Word_Index, Shift;
+	
+	for (i = 0; i < Limbs_Count; i++)
+	{
+		Word_Index = i * 62 / 64;
+		Shift = i * 62 % 64;
+		Value = 0;
+		if (Word_Index < Number_Limbs_Count) Value = Pointer_Number_Limbs[Word_Index] >> Shift;
+		if ((Shift > 2) && (Word_Index + 1 < Number_Limbs_Count)) Value |= Pointer_Number_Limbs[Word_Index + 1] << (64 - Shift); // The limb is split between two words
+		Pointer_Output_Limbs[i] = (int64_t) (Value & MODULAR_INVERSION_LIMB_MASK);
+	}
+}
+
+/** Gather non-negative 62-bit limbs into GMP limbs.
+ * @param Pointer_Limbs The 62-bit limbs, the number must fit in the GMP limbs.
+ * @param Limbs_Count How many 62-bit limbs there are.
+ * @param Pointer_Output_Number_Limbs On output, contain the GMP limbs.
+ * @param Number_Limbs_Count How many GMP limbs to write.
+ */
+static void ModularInversionLimbsToNumber(const int64_t *Pointer_Limbs, int Limbs_Count, mp_limb_t *Pointer_Output_Number_Limbs, int Number_Limbs_Count)
+{
+	uint64_t Value;
+	int i, Limb_Index, Shift;
+	
+	for (i = 0; i < Number_Limbs_Count; i++)
+	{
+		// The shift is even, so two 62-bit limbs always fill a word
+		Limb_Index = i * 64 / 62;
+		Shift = i * 64 % 62;
+		Value = (uint64_t) Pointer_Limbs[Limb_Index] >> Shift;
+		if (Limb_Index + 1 < Limbs_Count) Value |= (uint64_t) Pointer_Limbs[Limb_Index + 1] << (62 - Shift);
+		Pointer_Output_Number_Limbs[i] = Value;
+	}
+}
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ModularInversionPrepare(mpz_t Modulus, TModularInversionModulus *Pointer_Output_Modulus)
+{
+	mpz_t Number_Temp;
+	int Bits_Count, Divsteps_Count, Size;
+	
+	Bits_Count = (int) mpz_sizeinbase(Modulus, 2);
+	if ((mpz_cmp_ui(Modulus, 2) <= 0) || mpz_even_p(Modulus) || (Bits_Count > MODULAR_INVERSION_MAXIMUM_BITS)) return 0;
+	
+	// Keep the GMP form for the Fermat and GMP methods
+	Size = (int) mpz_size(Modulus);
+	Pointer_Output_Modulus->Number_Limbs_Count = Size;
+	memcpy(Pointer_Output_Modulus->Modulus_Number_Limbs, mpz_limbs_read(Modulus), Size * sizeof(mp_limb_t));
+	mpz_init(Number_Temp);
+	mpz_sub_ui(Number_Temp, Modulus, 2);
+	memset(Pointer_Output_Modulus->Exponent_Number_Limbs, 0, sizeof(Pointer_Output_Modulus->Exponent_Number_Limbs));
+	memcpy(Pointer_Output_Modulus->Exponent_Number_Limbs, mpz_limbs_read(Number_Temp), mpz_size(Number_Temp) * sizeof(mp_limb_t));
+	Pointer_Output_Modulus->Is_Prime = mpz_probab_prime_p(Modulus, 25) != 0;
+	
+	// Bernstein and Yang theorem 11.2 bounds the divsteps count reaching g = 0 when f and g are lower than 2^bits
+	if (Bits_Count < 46) Divsteps_Count = (49 * Bits_Count + 80) / 17;
+	else Divsteps_Count = (49 * Bits_Count + 57) / 17;
+	Pointer_Output_Modulus->Batches_Count = (Divsteps_Count + MODULAR_INVERSION_BATCH_DIVSTEPS_COUNT - 1) / MODULAR_INVERSION_BATCH_DIVSTEPS_COUNT;
+	Pointer_Output_Modulus->Limbs_Count = Bits_Count / 62 + 1;
+	
+	#ifdef MODULAR_INVERSION_IS_SAFEGCD_AVAILABLE
+		ModularInversionNumberToLimbs(Pointer_Output_Modulus->Modulus_Number_Limbs, Size, Pointer_Output_Modulus->Modulus, Pointer_Output_Modulus->Limbs_Count);
+		
+		// m^-1 mod 2^62
+		mpz_set_ui(Number_Temp, 0);
+		mpz_setbit(Number_Temp, 62);
+		mpz_invert(Number_Temp, Modulus, Number_Temp);
+		Pointer_Output_Modulus->Modulus_Inverse = mpz_getlimbn(Number_Temp, 0);
+		Pointer_Output_Modulus->Is_Safegcd_Available = 1;
+	#else
+		Pointer_Output_Modulus->Is_Safegcd_Available = 0;
+	#endif
+	
+	mpz_clear(Number_Temp);
+	return 1;
+}
+
+int ModularInversionSafegcd(TModularInversionModulus *Pointer_Modulus, const mp_limb_t *Pointer_Number, mp_limb_t *Pointer_Output_Inverse)
+{
+	#ifdef MODULAR_INVERSION_IS_SAFEGCD_AVAILABLE
+		int64_t F[MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT], G[MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT], D[MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT] = {0}, E[MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT] = {0}, Delta = 1, Sign_Mask, Bits;
+		TModularInversionMatrix Matrix;
+		int Limbs_Count = Pointer_Modulus->Limbs_Count, i;
+		
+		// f = m, g = x, d = 0, e = 1 (d.x = f and e.x = g modulo m all along)
+		memcpy(F, Pointer_Modulus->Modulus, Limbs_Count * sizeof(int64_t));
+		ModularInversionNumberToLimbs(Pointer_Number, Pointer_Modulus->Number_Limbs_Count, G, Limbs_Count);
+		E[0] = 1;
+		
+		// The same batches count is run for all numbers, g stays 0 once it is reached
+		for (i = 0; i < Pointer_Modulus->Batches_Count; i++)
+		{
+			Delta = ModularInversionDivsteps(Delta, (uint64_t) F[0], (uint64_t) G[0], &Matrix);
+			ModularInversionUpdateFG(F, G, &Matrix, Limbs_Count);
+			ModularInversionUpdateDE(D, E, &Matrix, Pointer_Modulus);
+		}
+		
+		// f is now +-gcd(m, x), the inverse is +-d
+		Sign_Mask = F[Limbs_Count - 1] >> 63;
+		ModularInversionAddModulusIfNegative(D, Pointer_Modulus); // d in ]-m, m[
+		ModularInversionNegateIfMasked(D, Limbs_Count, Sign_Mask);
+		ModularInversionAddModulusIfNegative(D, Pointer_Modulus); // d in [0, m[
+		ModularInversionLimbsToNumber(D, Limbs_Count, Pointer_Output_Inverse, Pointer_Modulus->Number_Limbs_Count);
+		
+		// The number is invertible when the gcd is 1
+		ModularInversionNegateIfMasked(F, Limbs_Count, Sign_Mask);
+		Bits = F[0] ^ 1;
+		for (i = 1; i < Limbs_Count; i++) Bits |= F[i];
+		return Bits == 0;
+	#else
+		(void) Pointer_Modulus;
+		(void) Pointer_Number;
+		(void) Pointer_Output_Inverse;
+		return 0;
+	#endif
+}
+
+int ModularInversionInvertNumber(TModularInversionModulus *Pointer_Modulus, int Method, mpz_t Number, mpz_t Output_Inverse)
+{
+	mp_limb_t Limbs[MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT], *Pointer_Limbs;
+	mpz_t Number_Modulus, Number_Exponent;
+	int Size, Is_Invertible;
+	
+	mpz_roinit_n(Number_Modulus, Pointer_Modulus->Modulus_Number_Limbs, Pointer_Modulus->Number_Limbs_Count);
+	if (Method == MODULAR_INVERSION_METHOD_SAFEGCD)
+	{
+		Size = (int) mpz_size(Number);
+		memcpy(Limbs, mpz_limbs_read(Number), Size * sizeof(mp_limb_t));
+		memset(Limbs + Size, 0, (Pointer_Modulus->Number_Limbs_Count - Size) * sizeof(mp_limb_t));
+		Is_Invertible = ModularInversionSafegcd(Pointer_Modulus, Limbs, Limbs);
+		
+		Pointer_Limbs = mpz_limbs_write(Output_Inverse, Pointer_Modulus->Number_Limbs_Count);
+		memcpy(Pointer_Limbs, Limbs, Pointer_Modulus->Number_Limbs_Count * sizeof(mp_limb_t));
+		mpz_limbs_finish(Output_Inverse, Pointer_Modulus->Number_Limbs_Count);
+		return Is_Invertible;
+	}
+	if (Method == MODULAR_INVERSION_METHOD_FERMAT)
+	{
+		if (mpz_sgn(Number) == 0) return 0;
+		mpz_roinit_n(Number_Exponent, Pointer_Modulus->Exponent_Number_Limbs, Pointer_Modulus->Number_Limbs_Count);
+		mpz_powm_sec(Output_Inverse, Number, Number_Exponent, Number_Modulus);
+		return 1;
+	}
+	return mpz_invert(Output_Inverse, Number, Number_Modulus);
+}
+
+int ModularInversionIsMethodUsable(TModularInversionModulus *Pointer_Modulus, int Method)
+{
+	if (Method == MODULAR_INVERSION_METHOD_SAFEGCD) return Pointer_Modulus->Is_Safegcd_Available;
+	if (Method == MODULAR_INVERSION_METHOD_FERMAT) return Pointer_Modulus->Is_Prime;
+	return Method == MODULAR_INVERSION_METHOD_GMP;
+}
@@ -0,0 +1,84 @@
+/** @file Modular_Inversion.h
+ * Modular inversion engine for the odd moduli of a curve (the field prime p and the group order n). Three methods are available :
+ * - the safegcd algorithm of Bernstein and Yang, which runs a fixed amount of "divsteps" (depending only on the modulus size) on fixed width signed limbs, so it never allocates memory
+ *   and its running time does not depend on the inverted number,
+ * - Fermat's little theorem a^(m - 2), with the GMP side-channel silent exponentiation (the modulus must be prime),
+ * - the GMP extended Euclid algorithm, usually the fastest one but its running time depends on the inverted number and it allocates memory.
+ */
+#ifndef H_MODULAR_INVERSION_H
+#define H_MODULAR_INVERSION_H
+
+#include <stdint.h>
+#include <gmp.h>
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** The size in bits of the largest supported moduli (enough for the P-521 curve). */
+#define MODULAR_INVERSION_MAXIMUM_BITS 576
+/** How many GMP limbs the largest supported moduli have. */
+#define MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT ((MODULAR_INVERSION_MAXIMUM_BITS + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS)
+/** How many 62-bit signed limbs the safegcd numbers need (one more than the modulus size so the numbers in ]-2.m, m[ always fit). */
+#define MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT (MODULAR_INVERSION_MAXIMUM_BITS / 62 + 1)
+
+/** The safegcd constant-time inversion. */
+#define MODULAR_INVERSION_METHOD_SAFEGCD 0
+/** Fermat's little theorem inversion, constant-time too but slower. */
+#define MODULAR_INVERSION_METHOD_FERMAT 1
+/** The variable time GMP inversion. */
+#define MODULAR_INVERSION_METHOD_GMP 2
+/** How many methods there are. */
+#define MODULAR_INVERSION_METHODS_COUNT 3
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A modulus and the constants of its inversions. */
+typedef struct
+{
+	int64_t Modulus[MODULAR_INVERSION_MAXIMUM_LIMBS_COUNT]; //! The modulus in 62-bit limbs.
+	uint64_t Modulus_Inverse; //! m^-1 mod 2^62.
+	mp_limb_t Modulus_Number_Limbs[MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT]; //! The modulus GMP limbs.
+	mp_limb_t Exponent_Number_Limbs[MODULAR_INVERSION_MAXIMUM_NUMBER_LIMBS_COUNT]; //! m - 2, the Fermat inversion exponent.
+	int Limbs_Count; //! How many 62-bit limbs the safegcd numbers have.
+	int Number_Limbs_Count; //! How many GMP limbs the modulus has, the inverted numbers have the same size.
+	int Batches_Count; //! How many batches of 62 divsteps are needed to reach the gcd whatever the inverted number is.
+	int Is_Safegcd_Available; //! Tell if the platform has the 128-bit integers and 64-bit GMP limbs the safegcd implementation needs.
+	int Is_Prime; //! Tell if the Fermat inversion can be used.
+} TModularInversionModulus;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Compute the constants of the inversions modulo a number.
+ * @param Modulus The modulus, it must be odd, greater than 2 and at most MODULAR_INVERSION_MAXIMUM_BITS long.
+ * @param Pointer_Output_Modulus On output, contain the modulus constants.
+ * @return 1 if the modulus can be used or 0 if it is not supported.
+ */
+int ModularInversionPrepare(mpz_t Modulus, TModularInversionModulus *Pointer_Output_Modulus);
+
+/** Invert a number with the safegcd algorithm. The operations sequence only depends on the modulus size.
+ * @param Pointer_Modulus The modulus, Is_Safegcd_Available must be set.
+ * @param Pointer_Number The Number_Limbs_Count limbs of the number to invert, it must be lower than the modulus.
+ * @param Pointer_Output_Inverse On output, contain the Number_Limbs_Count limbs of the inverse (it can be the inverted number).
+ * @return 1 if the number was inverted or 0 if it has no inverse (the output content is undefined then).
+ */
+int ModularInversionSafegcd(TModularInversionModulus *Pointer_Modulus, const mp_limb_t *Pointer_Number, mp_limb_t *Pointer_Output_Inverse);
+
+/** Invert a GMP number with any method.
+ * @param Pointer_Modulus The modulus.
+ * @param Method The inversion method (see MODULAR_INVERSION_METHOD_SAFEGCD, MODULAR_INVERSION_METHOD_FERMAT and MODULAR_INVERSION_METHOD_GMP), it must be usable with this modulus.
+ * @param Number The number to invert, in [0, m - 1].
+ * @param Output_Inverse On output, contain the inverse (it can be the same variable as Number).
+ * @return 1 if the number was inverted or 0 if it has no inverse (the output content is undefined then).
+ */
+int ModularInversionInvertNumber(TModularInversionModulus *Pointer_Modulus, int Method, mpz_t Number, mpz_t Output_Inverse);
+
+/** Tell if an inversion method can be used with a modulus.
+ * @param Pointer_Modulus The modulus.
+ * @param Method The inversion method.
+ * @return 1 if the method can be used or 0 otherwise.
+ */
+int ModularInversionIsMethodUsable(TModularInversionModulus *Pointer_Modulus, int Method);
+
+#endif
@@ -0,0 +1,302 @@
+/** @file Multiplication_Pool.c
+ * Thread pool running independent scalar multiplications.
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Multiplication_Pool.h"
+#include "Point.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private variables
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The worker running on the current thread (NULL if the thread does not belong to a pool). Jobs submitted by a job go to the queue of its worker. */
+static __thread TMultiplicationPoolWorker *Pointer_Current_Worker = NULL;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Append jobs to the back of a worker queue.
+ * @param Pointer_Worker The worker.
+ * @param Pointer_Jobs The jobs to append.
+ * @param Jobs_Count How many jobs to append.
+ * @return 1 if the jobs were appended or 0 if the queue could not grow.
+ */
+static int MultiplicationPoolPushJobs(TMultiplicationPoolWorker *Pointer_Worker, TMultiplicationPoolJob *Pointer_Jobs, int Jobs_Count)
+{
+	TMultiplicationPoolJob **Pointer_New_Queue;
+	int New_Capacity, i;
+	
+	pthread_mutex_lock(&Pointer_Worker->Mutex_Queue);
+	
+	// Grow the queue if needed, keeping the jobs order
+	if (Pointer_Worker->Queue_Jobs_Count + Jobs_Count > Pointer_Worker->Queue_Capacity)
+	{
+		New_Capacity = Pointer_Worker->Queue_Capacity;
+		while (New_Capacity < Pointer_Worker->Queue_Jobs_Count + Jobs_Count) New_Capacity *= 2;
+		Pointer_New_Queue = malloc(New_Capacity * sizeof(TMultiplicationPoolJob *));
+		if (Pointer_New_Queue == NULL)
+		{
+			pthread_mutex_unlock(&Pointer_Worker->Mutex_Queue);
+			return 0;
+		}
+		for (i = 0; i < Pointer_Worker->Queue_Jobs_Count; i++) Pointer_New_Queue[i] = Pointer_Worker->Pointer_Queue[(Pointer_Worker->Queue_Front + i) % Pointer_Worker->Queue_Capacity];
+		free(Pointer_Worker->Pointer_Queue);
+		Pointer_Worker->Pointer_Queue = Pointer_New_Queue;
+		Pointer_Worker->Queue_Capacity = New_Capacity;
+		Pointer_Worker->Queue_Front = 0;
+	}
+	
+	for (i = 0; i < Jobs_Count; i++) Pointer_Worker->Pointer_Queue[(Pointer_Worker->Queue_Front + Pointer_Worker->Queue_Jobs_Count + i) % Pointer_Worker->Queue_Capacity] = &Pointer_Jobs[i];
+	Pointer_Worker->Queue_Jobs_Count += Jobs_Count;
+	
+	pthread_mutex_unlock(&Pointer_Worker->Mutex_Queue);
+	return 1;
+}
+
+/** Take up to MULTIPLICATION_POOL_BATCH_SIZE jobs from a worker queue.
+ * @param Pointer_Worker The worker owning the queue.
+ * @param Is_Stealing Set to 0 to take the most recent jobs (the owner does that) or to 1 to take the oldest ones (thieves do that).
+ * @param Pointer_Output_Jobs On output, contain the taken jobs.
+ * @return How many jobs were taken.
+ */
+static int MultiplicationPoolPopJobs(TMultiplicationPoolWorker *Pointer_Worker, int Is_Stealing, TMultiplicationPoolJob **Pointer_Output_Jobs)
+{
+	int Jobs_Count, i;
+	
+	pthread_mutex_lock(&Pointer_Worker->Mutex_Queue);
+	
+	Jobs_Count = Pointer_Worker->Queue_Jobs_Count;
+	if (Jobs_Count > MULTIPLICATION_POOL_BATCH_SIZE) Jobs_Count = MULTIPLICATION_POOL_BATCH_SIZE;
+	// Thieves take at most half of the queue so the owner keeps working too
+	if (Is_Stealing && (Jobs_Count > 1) && (Jobs_Count > Pointer_Worker->Queue_Jobs_Count / 2)) Jobs_Count = (Pointer_Worker->Queue_Jobs_Count + 1) / 2;
+	
+	for (i = 0; i < Jobs_Count; i++)
+	{
+		if (Is_Stealing)
+		{
+			Pointer_Output_Jobs[i] = Pointer_Worker->Pointer_Queue[Pointer_Worker->Queue_Front];
+			Pointer_Worker->Queue_Front = (Pointer_Worker->Queue_Front + 1) % Pointer_Worker->Queue_Capacity;
+		}
+		else Pointer_Output_Jobs[i] = Pointer_Worker->Pointer_Queue[(Pointer_Worker->Queue_Front + Pointer_Worker->Queue_Jobs_Count - 1 - i) % Pointer_Worker->Queue_Capacity];
+	}
+	Pointer_Worker->Queue_Jobs_Count -= Jobs_Count;
+	
+	pthread_mutex_unlock(&Pointer_Worker->Mutex_Queue);
+	return Jobs_Count;
+}
+
+/** Account submitted jobs and wake up sleeping workers.
+ * @param Pointer_Pool The pool.
+ * @param Jobs_Count How many jobs were queued.
+ */
+static void MultiplicationPoolSignalJobs(TMultiplicationPool *Pointer_Pool, int Jobs_Count)
+{
+	pthread_mutex_lock(&Pointer_Pool->Mutex);
+	Pointer_Pool->Queued_Jobs_Count += Jobs_Count;
+	pthread_cond_broadcast(&Pointer_Pool->Condition_Work_Available);
+	pthread_mutex_unlock(&Pointer_Pool->Mutex);
+}
+
+/** Worker thread body.
+ * @param Pointer_Parameters The worker.
+ * @return Always NULL.
+ */
+static void *MultiplicationPoolWorkerThread(void *Pointer_Parameters)
+{
+	TMultiplicationPoolWorker *Pointer_Worker = Pointer_Parameters;
+	TMultiplicationPool *Pointer_Pool = Pointer_Worker->Pointer_Pool;
+	TMultiplicationPoolJob *Pointer_Jobs[MULTIPLICATION_POOL_BATCH_SIZE], *Pointer_Job;
+	int Jobs_Count, Worker_Index, i;
+	
+	Pointer_Current_Worker = Pointer_Worker;
+	Worker_Index = Pointer_Worker - Pointer_Pool->Pointer_Workers;
+	
+	while (1)
+	{
+		// Take jobs from the own queue first, then from the other workers
+		Jobs_Count = MultiplicationPoolPopJobs(Pointer_Worker, 0, Pointer_Jobs);
+		for (i = 1; (Jobs_Count == 0) && (i < Pointer_Pool->Workers_Count); i++)
+		{
+			Jobs_Count = MultiplicationPoolPopJobs(&Pointer_Pool->Pointer_Workers[(Worker_Index + i) % Pointer_Pool->Workers_Count], 1, Pointer_Jobs);
+			Pointer_Worker->Stolen_Jobs_Count += Jobs_Count;
+		}
+		
+		// Sleep until some work is available
+		pthread_mutex_lock(&Pointer_Pool->Mutex);
+		Pointer_Pool->Queued_Jobs_Count -= Jobs_Count;
+		if (Jobs_Count == 0)
+		{
+			while ((Pointer_Pool->Queued_Jobs_Count <= 0) && !Pointer_Pool->Is_Stopping) pthread_cond_wait(&Pointer_Pool->Condition_Work_Available, &Pointer_Pool->Mutex);
+			if ((Pointer_Pool->Queued_Jobs_Count <= 0) && Pointer_Pool->Is_Stopping)
+			{
+				pthread_mutex_unlock(&Pointer_Pool->Mutex);
+				break;
+			}
+			pthread_mutex_unlock(&Pointer_Pool->Mutex);
+			continue;
+		}
+		pthread_mutex_unlock(&Pointer_Pool->Mutex);
+		
+		// Run the jobs, the curve functions keep their temporary numbers on the worker stack so workers share nothing but the read-only curve
+		for (i = 0; i < Jobs_Count; i++)
+		{
+			Pointer_Job = Pointer_Jobs[i];
+			if (Pointer_Job->Pointer_Point == NULL) ECMultiplicationGenerator(Pointer_Job->Pointer_Curve, Pointer_Job->Factor, Pointer_Job->Pointer_Output_Point);
+			else ECMultiplication(Pointer_Job->Pointer_Curve, Pointer_Job->Pointer_Point, Pointer_Job->Factor, Pointer_Job->Pointer_Output_Point);
+			if (Pointer_Job->Function_Callback != NULL) Pointer_Job->Function_Callback(Pointer_Job);
+		}
+		Pointer_Worker->Executed_Jobs_Count += Jobs_Count;
+		
+		// Publish the results of the whole batch at once
+		pthread_mutex_lock(&Pointer_Pool->Mutex);
+		for (i = 0; i < Jobs_Count; i++) Pointer_Jobs[i]->Is_Done = 1;
+		Pointer_Pool->Pending_Jobs_Count -= Jobs_Count;
+		pthread_cond_broadcast(&Pointer_Pool->Condition_Job_Done);
+		pthread_mutex_unlock(&Pointer_Pool->Mutex);
+	}
+	
+	return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int MultiplicationPoolCreate(TMultiplicationPool *Pointer_Pool, int Workers_Count)
+{
+	TMultiplicationPoolWorker *Pointer_Worker;
+	int i;
+	
+	memset(Pointer_Pool, 0, sizeof(TMultiplicationPool));
+	if (Workers_Count < 1) Workers_Count = 1;
+	Pointer_Pool->Pointer_Workers = calloc(Workers_Count, sizeof(TMultiplicationPoolWorker));
+	if (Pointer_Pool->Pointer_Workers == NULL) return 0;
+	pthread_mutex_init(&Pointer_Pool->Mutex, NULL);
+	pthread_cond_init(&Pointer_Pool->Condition_Work_Available, NULL);
+	pthread_cond_init(&Pointer_Pool->Condition_Job_Done, NULL);
+	
+	// All queues must exist before the first worker starts stealing
+	for (i = 0; i < Workers_Count; i++)
+	{
+		Pointer_Worker = &Pointer_Pool->Pointer_Workers[i];
+		Pointer_Worker->Pointer_Queue = malloc(MULTIPLICATION_POOL_QUEUE_INITIAL_CAPACITY * sizeof(TMultiplicationPoolJob *));
+		if (Pointer_Worker->Pointer_Queue == NULL)
+		{
+			MultiplicationPoolFree(Pointer_Pool);
+			return 0;
+		}
+		Pointer_Worker->Queue_Capacity = MULTIPLICATION_POOL_QUEUE_INITIAL_CAPACITY;
+		Pointer_Worker->Pointer_Pool = Pointer_Pool;
+		pthread_mutex_init(&Pointer_Worker->Mutex_Queue, NULL);
+		Pointer_Pool->Workers_Count++;
+	}
+	
+	for (i = 0; i < Workers_Count; i++)
+	{
+		if (pthread_create(&Pointer_Pool->Pointer_Workers[i].Thread, NULL, MultiplicationPoolWorkerThread, &Pointer_Pool->Pointer_Workers[i]) != 0)
+		{
+			// The started workers keep stealing from all queues until they are joined, so the workers count must not change
+			MultiplicationPoolFree(Pointer_Pool);
+			return 0;
+		}
+		Pointer_Pool->Started_Workers_Count++;
+	}
+	return 1;
+}
+
+void MultiplicationPoolFree(TMultiplicationPool *Pointer_Pool)
+{
+	TMultiplicationPoolWorker *Pointer_Worker;
+	int i;
+	
+	if (Pointer_Pool->Pointer_Workers == NULL) return;
+	
+	// Let the workers empty their queues and exit
+	pthread_mutex_lock(&Pointer_Pool->Mutex);
+	Pointer_Pool->Is_Stopping = 1;
+	pthread_cond_broadcast(&Pointer_Pool->Condition_Work_Available);
+	pthread_mutex_unlock(&Pointer_Pool->Mutex);
+	
+	// Only the started threads can be joined, but all queues were initialized
+	for (i = 0; i < Pointer_Pool->Started_Workers_Count; i++) pthread_join(Pointer_Pool->Pointer_Workers[i].Thread, NULL);
+	for (i = 0; i < Pointer_Pool->Workers_Count; i++)
+	{
+		Pointer_Worker = &Pointer_Pool->Pointer_Workers[i];
+		pthread_mutex_destroy(&Pointer_Worker->Mutex_Queue);
+		free(Pointer_Worker->Pointer_Queue);
+	}
+	free(Pointer_Pool->Pointer_Workers);
+	Pointer_Pool->Pointer_Workers = NULL;
+	
+	pthread_mutex_destroy(&Pointer_Pool->Mutex);
+	pthread_cond_destroy(&Pointer_Pool->Condition_Work_Available);
+	pthread_cond_destroy(&Pointer_Pool->Condition_Job_Done);
+}
+
+int MultiplicationPoolSubmit(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Job)
+{
+	return MultiplicationPoolSubmitBatch(Pointer_Pool, Pointer_Job, 1);
+}
+
+int MultiplicationPoolSubmitBatch(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Jobs, int Jobs_Count)
+{
+	TMultiplicationPoolWorker *Pointer_Worker;
+	int Chunk_Size, Submitted_Jobs_Count = 0, Is_Successful = 1, i;
+	
+	if (Jobs_Count <= 0) return 1;
+	for (i = 0; i < Jobs_Count; i++) Pointer_Jobs[i].Is_Done = 0;
+	
+	pthread_mutex_lock(&Pointer_Pool->Mutex);
+	Pointer_Pool->Pending_Jobs_Count += Jobs_Count;
+	pthread_mutex_unlock(&Pointer_Pool->Mutex);
+	
+	// A job submitted by a job stays on the same worker, the others are spread over all queues
+	if ((Pointer_Current_Worker != NULL) && (Pointer_Current_Worker->Pointer_Pool == Pointer_Pool))
+	{
+		if (MultiplicationPoolPushJobs(Pointer_Current_Worker, Pointer_Jobs, Jobs_Count)) Submitted_Jobs_Count = Jobs_Count;
+	}
+	else
+	{
+		Chunk_Size = (Jobs_Count + Pointer_Pool->Workers_Count - 1) / Pointer_Pool->Workers_Count;
+		while (Submitted_Jobs_Count < Jobs_Count)
+		{
+			if (Chunk_Size > Jobs_Count - Submitted_Jobs_Count) Chunk_Size = Jobs_Count - Submitted_Jobs_Count;
+			
+			pthread_mutex_lock(&Pointer_Pool->Mutex);
+			Pointer_Worker = &Pointer_Pool->Pointer_Workers[Pointer_Pool->Next_Worker];
+			Pointer_Pool->Next_Worker = (Pointer_Pool->Next_Worker + 1) % Pointer_Pool->Workers_Count;
+			pthread_mutex_unlock(&Pointer_Pool->Mutex);
+			
+			if (!MultiplicationPoolPushJobs(Pointer_Worker, &Pointer_Jobs[Submitted_Jobs_Count], Chunk_Size)) break;
+			Submitted_Jobs_Count += Chunk_Size;
+		}
+	}
+	
+	// Forget the jobs that could not be queued
+	if (Submitted_Jobs_Count < Jobs_Count)
+	{
+		pthread_mutex_lock(&Pointer_Pool->Mutex);
+		Pointer_Pool->Pending_Jobs_Count -= Jobs_Count - Submitted_Jobs_Count;
+		pthread_mutex_unlock(&Pointer_Pool->Mutex);
+		Is_Successful = 0;
+	}
+	
+	MultiplicationPoolSignalJobs(Pointer_Pool, Submitted_Jobs_Count);
+	return Is_Successful;
+}
+
+void MultiplicationPoolWait(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Job)
+{
+	pthread_mutex_lock(&Pointer_Pool->Mutex);
+	while (!Pointer_Job->Is_Done) pthread_cond_wait(&Pointer_Pool->Condition_Job_Done, &Pointer_Pool->Mutex);
+	pthread_mutex_unlock(&Pointer_Pool->Mutex);
+}
+
+void MultiplicationPoolWaitAll(TMultiplicationPool *Pointer_Pool)
+{
+	pthread_mutex_lock(&Pointer_Pool->Mutex);
+	while (Pointer_Pool->Pending_Jobs_Count > 0) pthread_cond_wait(&Pointer_Pool->Condition_Job_Done, &Pointer_Pool->Mutex);
+	pthread_mutex_unlock(&Pointer_Pool->Mutex);
+}
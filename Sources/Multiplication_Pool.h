@@ -0,0 +1,112 @@
+/** @file Multiplication_Pool.h
+ * Thread pool running independent scalar multiplications. Each worker owns a jobs queue and steals jobs from the other workers when its own queue is empty.
+ */
+#ifndef H_MULTIPLICATION_POOL_H
+#define H_MULTIPLICATION_POOL_H
+
+#include <pthread.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** How many jobs a worker takes at once from a queue, so small jobs do not spend their time in locks. */
+#define MULTIPLICATION_POOL_BATCH_SIZE 8
+/** Initial capacity of a worker queue (it grows when needed). */
+#define MULTIPLICATION_POOL_QUEUE_INITIAL_CAPACITY 64
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+struct TMultiplicationPoolJob;
+
+/** Called by the worker thread when a job is done.
+ * @param Pointer_Job The finished job.
+ */
+typedef void (*TMultiplicationPoolCallback)(struct TMultiplicationPoolJob *Pointer_Job);
+
+/** A scalar multiplication to compute. All fields except Is_Done are filled by the user and must stay valid until the job is done. */
+typedef struct TMultiplicationPoolJob
+{
+	TEllipticCurve *Pointer_Curve; //! The curve (it is only read, so any amount of jobs can share it).
+	TPoint *Pointer_Point; //! The point to multiply, or NULL to multiply the curve generator.
+	mpz_ptr Factor; //! The scalar value to multiply the point with.
+	TPoint *Pointer_Output_Point; //! The result (the point must be created by the user).
+	TMultiplicationPoolCallback Function_Callback; //! Called from the worker thread when the job is done (can be NULL).
+	void *Pointer_User_Data; //! Free for the user.
+	int Is_Done; //! Set by the pool when the result is available (use MultiplicationPoolWait() to read it safely).
+} TMultiplicationPoolJob;
+
+/** A worker thread with its jobs queue. The worker takes jobs from the back of its queue, thieves take jobs from the front. */
+typedef struct
+{
+	pthread_t Thread; //! The worker thread.
+	pthread_mutex_t Mutex_Queue; //! Protect the queue.
+	TMultiplicationPoolJob **Pointer_Queue; //! Circular buffer of waiting jobs.
+	int Queue_Capacity; //! Size of the circular buffer.
+	int Queue_Front; //! Index of the oldest job.
+	int Queue_Jobs_Count; //! How many jobs are waiting.
+	unsigned long long Executed_Jobs_Count; //! How many jobs this worker ran.
+	unsigned long long Stolen_Jobs_Count; //! How many of them were taken from another worker queue.
+	struct TMultiplicationPool *Pointer_Pool; //! The pool the worker belongs to.
+} TMultiplicationPoolWorker;
+
+/** A pool of workers. */
+typedef struct TMultiplicationPool
+{
+	TMultiplicationPoolWorker *Pointer_Workers; //! All workers.
+	int Workers_Count; //! How many workers there are.
+	int Started_Workers_Count; //! How many worker threads were started (the first ones of the workers array).
+	int Next_Worker; //! Worker receiving the next job submitted from outside the pool.
+	pthread_mutex_t Mutex; //! Protect the following fields and the jobs Is_Done field.
+	pthread_cond_t Condition_Work_Available; //! Signaled when jobs are submitted.
+	pthread_cond_t Condition_Job_Done; //! Signaled when jobs are done.
+	int Queued_Jobs_Count; //! How many jobs wait in the queues.
+	int Pending_Jobs_Count; //! How many jobs are not done yet (queued or running).
+	char Is_Stopping; //! Tell the workers to exit when the queues are empty.
+} TMultiplicationPool;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Create a pool and start its workers.
+ * @param Pointer_Pool The pool to initialize.
+ * @param Workers_Count How many threads to start (use the processors count to use the whole machine).
+ * @return 1 if the pool was successfully created or 0 if there is not enough memory or a thread could not be started.
+ */
+int MultiplicationPoolCreate(TMultiplicationPool *Pointer_Pool, int Workers_Count);
+
+/** Wait for all submitted jobs, stop the workers and free the pool resources.
+ * @param Pointer_Pool The pool to destroy.
+ */
+void MultiplicationPoolFree(TMultiplicationPool *Pointer_Pool);
+
+/** Submit one job. The function returns immediately.
+ * @param Pointer_Pool The pool.
+ * @param Pointer_Job The job to run.
+ * @return 1 if the job was queued or 0 if there is not enough memory.
+ */
+int MultiplicationPoolSubmit(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Job);
+
+/** Submit many jobs at once, they are spread in chunks over the workers queues.
+ * @param Pointer_Pool The pool.
+ * @param Pointer_Jobs The jobs to run.
+ * @param Jobs_Count How many jobs there are.
+ * @return 1 if all jobs were queued or 0 if there is not enough memory (some jobs may have been queued).
+ */
+int MultiplicationPoolSubmitBatch(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Jobs, int Jobs_Count);
+
+/** Wait for a job to be done.
+ * @param Pointer_Pool The pool the job was submitted to.
+ * @param Pointer_Job The job.
+ */
+void MultiplicationPoolWait(TMultiplicationPool *Pointer_Pool, TMultiplicationPoolJob *Pointer_Job);
+
+/** Wait for all submitted jobs to be done.
+ * @param Pointer_Pool The pool.
+ */
+void MultiplicationPoolWaitAll(TMultiplicationPool *Pointer_Pool);
+
+#endif
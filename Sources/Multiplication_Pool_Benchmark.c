@@ -0,0 +1,134 @@
+/** @file Multiplication_Pool_Benchmark.c
+ * Measure how the scalar multiplications throughput scales with the multiplication pool workers count.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Curves_Registry.h"
+#include "Elliptic_Curves.h"
+#include "Multiplication_Pool.h"
+#include "Point.h"
+#include "Utils.h"
+
+/** Default amount of multiplications per measure. */
+#define DEFAULT_JOBS_COUNT 2000
+
+int main(int argc, char *argv[])
+{
+	TEllipticCurve Curve;
+	TMultiplicationPool Pool;
+	TMultiplicationPoolJob *Pointer_Jobs;
+	TPoint *Pointer_Points, *Pointer_Results, Point_Expected;
+	mpz_t *Pointer_Factors;
+	int Jobs_Count = DEFAULT_JOBS_COUNT, Maximum_Workers_Count, Workers_Count, i, Return_Value = 0;
+	long long Start_Time, Single_Thread_Time = 0, Elapsed_Time;
+	unsigned long long Stolen_Jobs_Count;
+	
+	// Check parameters
+	if ((argc < 2) || (argc > 4))
+	{
+		printf("Error : bad parameters.\n" \
+			"Usage : %s EllipticCurve [JobsCount] [MaximumWorkersCount]\n" \
+			"EllipticCurve is a built-in curve name or a curve file path. The default workers count is the processors count.\n", argv[0]);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
+		return -1;
+	}
+	if (argc >= 3) Jobs_Count = atoi(argv[2]);
+	if (argc == 4) Maximum_Workers_Count = atoi(argv[3]);
+	else Maximum_Workers_Count = sysconf(_SC_NPROCESSORS_ONLN);
+	if ((Jobs_Count < 1) || (Maximum_Workers_Count < 1))
+	{
+		printf("Error : the jobs and workers counts must be positive.\n");
+		return -1;
+	}
+	
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(argv[1], &Curve))
+	{
+		printf("Error : can't load curve file.\n");
+		return -2;
+	}
+	
+	UtilsInitializeRandomGenerator();
+	
+	// Prepare random points and factors (the points are random multiples of the generator)
+	Pointer_Jobs = malloc(Jobs_Count * sizeof(TMultiplicationPoolJob));
+	Pointer_Points = malloc(Jobs_Count * sizeof(TPoint));
+	Pointer_Results = malloc(Jobs_Count * sizeof(TPoint));
+	Pointer_Factors = malloc(Jobs_Count * sizeof(mpz_t));
+	if ((Pointer_Jobs == NULL) || (Pointer_Points == NULL) || (Pointer_Results == NULL) || (Pointer_Factors == NULL))
+	{
+		printf("Error : not enough memory.\n");
+		return -3;
+	}
+	for (i = 0; i < Jobs_Count; i++)
+	{
+		mpz_init(Pointer_Factors[i]);
+		UtilsGenerateRandomNumber(Curve.n, Pointer_Factors[i]);
+		PointCreate(0, 0, &Pointer_Points[i]);
+		ECMultiplicationGenerator(&Curve, Pointer_Factors[i], &Pointer_Points[i]);
+		UtilsGenerateRandomNumber(Curve.n, Pointer_Factors[i]);
+		PointCreate(0, 0, &Pointer_Results[i]);
+		
+		Pointer_Jobs[i].Pointer_Curve = &Curve;
+		Pointer_Jobs[i].Pointer_Point = &Pointer_Points[i];
+		Pointer_Jobs[i].Factor = Pointer_Factors[i];
+		Pointer_Jobs[i].Pointer_Output_Point = &Pointer_Results[i];
+		Pointer_Jobs[i].Function_Callback = NULL;
+		Pointer_Jobs[i].Pointer_User_Data = NULL;
+	}
+	PointCreate(0, 0, &Point_Expected);
+	
+	printf("%d multiplications per measure.\n", Jobs_Count);
+	printf("Workers | Time (ms) | Multiplications/s | Speedup | Stolen jobs\n");
+	for (Workers_Count = 1; Workers_Count <= Maximum_Workers_Count; Workers_Count++)
+	{
+		if (!MultiplicationPoolCreate(&Pool, Workers_Count))
+		{
+			printf("Error : could not create the pool.\n");
+			Return_Value = -4;
+			break;
+		}
+		
+		Start_Time = UtilsGetTime();
+		MultiplicationPoolSubmitBatch(&Pool, Pointer_Jobs, Jobs_Count);
+		MultiplicationPoolWaitAll(&Pool);
+		Elapsed_Time = UtilsGetTime() - Start_Time;
+		if (Workers_Count == 1) Single_Thread_Time = Elapsed_Time;
+		
+		// Count how many jobs were stolen
+		Stolen_Jobs_Count = 0;
+		for (i = 0; i < Pool.Workers_Count; i++) Stolen_Jobs_Count += Pool.Pointer_Workers[i].Stolen_Jobs_Count;
+		printf("%7d | %9.1f | %17.0f | %7.2f | %llu\n", Workers_Count, Elapsed_Time / 1000.0, Jobs_Count * 1000000.0 / Elapsed_Time, (double) Single_Thread_Time / Elapsed_Time, Stolen_Jobs_Count);
+		MultiplicationPoolFree(&Pool);
+	}
+	
+	// Check a few results against the single-threaded multiplication
+	for (i = 0; i < Jobs_Count; i += (Jobs_Count + 9) / 10)
+	{
+		ECMultiplication(&Curve, &Pointer_Points[i], Pointer_Factors[i], &Point_Expected);
+		if ((Point_Expected.Is_Infinite != Pointer_Results[i].Is_Infinite) || (!Point_Expected.Is_Infinite && !PointIsEqual(&Point_Expected, &Pointer_Results[i])))
+		{
+			printf("Error : job %d result is wrong.\n", i);
+			Return_Value = -5;
+		}
+	}
+	
+	// Free resources
+	for (i = 0; i < Jobs_Count; i++)
+	{
+		mpz_clear(Pointer_Factors[i]);
+		PointFree(&Pointer_Points[i]);
+		PointFree(&Pointer_Results[i]);
+	}
+	PointFree(&Point_Expected);
+	free(Pointer_Jobs);
+	free(Pointer_Points);
+	free(Pointer_Results);
+	free(Pointer_Factors);
+	ECFree(&Curve);
+	return Return_Value;
+}
@@ -75,6 +75,38 @@ int NetworkClientConnect(char *String_IP_Address, unsigned short Port)
 	return Socket;
 }
 
+int NetworkSendBuffer(int Socket_Destination, void *Pointer_Buffer, size_t Buffer_Size)
+{
+	unsigned char *Pointer_Bytes = Pointer_Buffer;
+	ssize_t Sent_Bytes_Count;
+	
+	// write() can send less bytes than requested
+	while (Buffer_Size > 0)
+	{
+		Sent_Bytes_Count = write(Socket_Destination, Pointer_Bytes, Buffer_Size);
+		if (Sent_Bytes_Count <= 0) return 0;
+		Pointer_Bytes += Sent_Bytes_Count;
+		Buffer_Size -= Sent_Bytes_Count;
+	}
+	return 1;
+}
+
+int NetworkReceiveBuffer(int Socket_Source, void *Pointer_Buffer, size_t Buffer_Size)
+{
+	unsigned char *Pointer_Bytes = Pointer_Buffer;
+	ssize_t Received_Bytes_Count;
+	
+	// read() can return before all bytes are received
+	while (Buffer_Size > 0)
+	{
+		Received_Bytes_Count = read(Socket_Source, Pointer_Bytes, Buffer_Size);
+		if (Received_Bytes_Count <= 0) return 0;
+		Pointer_Bytes += Received_Bytes_Count;
+		Buffer_Size -= Received_Bytes_Count;
+	}
+	return 1;
+}
+
 void NetworkSendMPZ(int Socket_Destination, mpz_t Number)
 {
 	char String[NETWORK_MAXIMUM_STRINGIFIED_NUMBER_SIZE];
@@ -83,8 +115,8 @@ void NetworkSendMPZ(int Socket_Destination, mpz_t Number)
 	// Send a string to avoid architecture specific binary encoding issues
 	Length = gmp_snprintf(String, NETWORK_MAXIMUM_STRINGIFIED_NUMBER_SIZE, "%Zd", Number) + 1; // +1 for terminating zero
 	// Send size
-	write(Socket_Destination, &Length, sizeof(Length));
-	write(Socket_Destination, String, Length);
+	if (!NetworkSendBuffer(Socket_Destination, &Length, sizeof(Length))) return;
+	NetworkSendBuffer(Socket_Destination, String, Length);
 }
 
 void NetworkReceiveMPZ(int Socket_Source, mpz_t Number)
@@ -92,11 +124,14 @@ void NetworkReceiveMPZ(int Socket_Source, mpz_t Number)
 	char String[NETWORK_MAXIMUM_STRINGIFIED_NUMBER_SIZE];
 	int Length;
 	
-	// Retrieve string length
-	read(Socket_Source, &Length, sizeof(Length));
+	// Retrieve string length, a number that can't be received is set to 0
+	mpz_set_ui(Number, 0);
+	if (!NetworkReceiveBuffer(Socket_Source, &Length, sizeof(Length))) return;
+	if ((Length <= 0) || (Length > NETWORK_MAXIMUM_STRINGIFIED_NUMBER_SIZE)) return;
 	
-	// Receive string
-	read(Socket_Source, String, Length);
+	// Receive string (a busy peer can deliver it in several parts)
+	if (!NetworkReceiveBuffer(Socket_Source, String, Length)) return;
+	String[Length - 1] = 0;
 	mpz_set_str(Number, String, 10);
 }
 
@@ -106,7 +141,7 @@ void NetworkSendPoint(int Socket_Destination, TPoint *Pointer_Point)
 	
 	// Send infinity flag first to avoid sending coordinates if the point is infinite
 	Is_Infinite = Pointer_Point->Is_Infinite; // Force cast to a single byte to avoid compiler optimizations issues
-	write(Socket_Destination, &Is_Infinite, sizeof(Is_Infinite));
+	if (!NetworkSendBuffer(Socket_Destination, &Is_Infinite, sizeof(Is_Infinite))) return;
 	if (Is_Infinite) return;
 	
 	// Send coordinates
@@ -119,7 +154,7 @@ void NetworkReceivePoint(int Socket_Source, TPoint *Pointer_Point)
 	char Is_Infinite;
 	
 	// Receive infinity flag
-	read(Socket_Source, &Is_Infinite, sizeof(Is_Infinite));
+	if (!NetworkReceiveBuffer(Socket_Source, &Is_Infinite, sizeof(Is_Infinite))) Is_Infinite = 1;
 	Pointer_Point->Is_Infinite = Is_Infinite;
 	if (Is_Infinite) return;
 	
@@ -33,6 +33,22 @@ int NetworkServerListen(int Socket_Server);
  */
 int NetworkClientConnect(char *String_IP_Address, unsigned short Port);
 
+/** Send raw bytes over the network.
+ * @param Socket_Destination Where to send the bytes.
+ * @param Pointer_Buffer The bytes to send.
+ * @param Buffer_Size How many bytes to send.
+ * @return 1 if all bytes were sent or 0 if an error occured.
+ */
+int NetworkSendBuffer(int Socket_Destination, void *Pointer_Buffer, size_t Buffer_Size);
+
+/** Receive raw bytes from the network.
+ * @param Socket_Source The socket from which to receive the bytes.
+ * @param Pointer_Buffer On output, contain the received bytes.
+ * @param Buffer_Size How many bytes to receive (the function waits until all bytes are received).
+ * @return 1 if all bytes were received or 0 if an error occured or if the connection was closed.
+ */
+int NetworkReceiveBuffer(int Socket_Source, void *Pointer_Buffer, size_t Buffer_Size);
+
 /** Send a GMP MPZ number over the network using a string format.
  * @param Socket_Destination Where to send the number.
  * @param Number The number to send.
@@ -0,0 +1,563 @@
+/** @file Pollard_Rho.c
+ * Solve a random discrete logarithm Q = k.G on a curve with the parallel Pollard rho method of van Oorschot and Wiener, to check how much work a curve really resists and to
+ * stress the point addition. Each thread runs POLLARD_RHO_WALKERS_COUNT r-adding walks X = a.G + b.Q, X <- X + R[h(X)] with R[i] = c[i].G + d[i].Q, and adds them all together so
+ * the slopes of the affine additions share a single modular inversion (Montgomery trick). The points whose X coordinate ends with enough zero bits are distinguished, they are stored
+ * in a hash table shared by all threads without any lock. When two walks reach the same distinguished point, a.G + b.Q = +-(a'.G + b'.Q) gives k.
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <gmp.h>
+#include "Curves_Registry.h"
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Utils.h"
+
+/** How many precomputed points the walks add (r), 16 to 32 make walks close to random ones. */
+#define POLLARD_RHO_ADDENDS_COUNT 32
+/** How many walks a thread adds at once to share the inversion. */
+#define POLLARD_RHO_WALKERS_COUNT 64
+/** The distinguished points count the default distinguished bits count aims at. */
+#define POLLARD_RHO_TARGET_DISTINGUISHED_POINTS_BITS 14
+/** A walk is restarted when it did not meet a distinguished point for this many times the expected distance, it is then probably trapped in a cycle. */
+#define POLLARD_RHO_MAXIMUM_WALK_FACTOR 20
+/** The largest group order the program accepts, larger ones would not be solved in a lifetime. */
+#define POLLARD_RHO_MAXIMUM_ORDER_BITS 100
+/** How many microseconds between two throughput reports. */
+#define POLLARD_RHO_REPORT_PERIOD 2000000
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** A distinguished point, the walk coefficients are enough to compute it again. */
+typedef struct
+{
+	uint64_t Key; //! The low bits of the point X coordinate.
+	mpz_t a; //! The point is a.G + b.Q.
+	mpz_t b; //! The point is a.G + b.Q.
+} TPollardRhoRecord;
+
+/** The state shared by all threads. */
+typedef struct
+{
+	TEllipticCurve *Pointer_Curve; //! The curve.
+	TPoint Point_Q; //! The point whose logarithm is searched.
+	TPoint Addends[POLLARD_RHO_ADDENDS_COUNT]; //! R[i] = c[i].G + d[i].Q.
+	mpz_t Addends_C[POLLARD_RHO_ADDENDS_COUNT]; //! The c[i] values.
+	mpz_t Addends_D[POLLARD_RHO_ADDENDS_COUNT]; //! The d[i] values.
+	uint64_t Distinguished_Mask; //! A point is distinguished when its key and this mask is zero.
+	unsigned long long Maximum_Walk_Length; //! Restart a walk after this many steps without distinguished point.
+	TPollardRhoRecord **Pointer_Table; //! The distinguished points hash table, written with atomic compare-and-swap only.
+	unsigned long Table_Mask; //! The table capacity minus one (the capacity is a power of 2).
+	int Is_Finished; //! Tell the threads to stop, accessed with atomic loads and stores only.
+	pthread_mutex_t Mutex; //! Protect the result.
+	mpz_t Logarithm; //! The result k.
+	int Is_Solved; //! Tell if the logarithm was found.
+	int Is_Table_Full; //! Tell if the search stopped because the table is full.
+} TPollardRhoSearch;
+
+/** A thread state. */
+typedef struct
+{
+	TPollardRhoSearch *Pointer_Search; //! The shared state.
+	pthread_t Thread; //! The thread.
+	unsigned long long Steps_Count; //! Point additions done so far, read by the main thread with atomic loads.
+	unsigned long long Distinguished_Points_Count; //! Distinguished points found.
+} TPollardRhoThread;
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Get the key of a point X coordinate.
+ * @param X The X coordinate (it must be reduced).
+ * @return The low 64 bits of X.
+ */
+static inline uint64_t PollardRhoGetKey(mpz_t X)
+{
+	uint64_t Key;
+	
+	Key = mpz_getlimbn(X, 0);
+	if (GMP_NUMB_BITS < 64) Key |= (uint64_t) mpz_getlimbn(X, 1) << (GMP_NUMB_BITS % 64);
+	return Key;
+}
+
+/** Mix the key bits to choose the next addend and the table slot, so they are independent from the distinguishing bits.
+ * @param Key The key.
+ * @return A well distributed 64-bit value.
+ */
+static inline uint64_t PollardRhoHash(uint64_t Key)
+{
+	Key ^= Key >> 31;
+	Key *= 0x9E3779B97F4A7C15ULL;
+	return Key ^ (Key >> 29);
+}
+
+/** Compute a.G + b.Q.
+ * @param Pointer_Search The search.
+ * @param a The generator coefficient.
+ * @param b The searched point coefficient.
+ * @param Pointer_Output_Point On output, contain the point.
+ */
+static void PollardRhoComputeCombination(TPollardRhoSearch *Pointer_Search, mpz_t a, mpz_t b, TPoint *Pointer_Output_Point)
+{
+	TPoint Point_Temp;
+	
+	PointCreate(0, 0, &Point_Temp);
+	ECMultiplicationGenerator(Pointer_Search->Pointer_Curve, a, Pointer_Output_Point);
+	ECMultiplication(Pointer_Search->Pointer_Curve, &Pointer_Search->Point_Q, b, &Point_Temp);
+	ECAddition(Pointer_Search->Pointer_Curve, Pointer_Output_Point, &Point_Temp, Pointer_Output_Point);
+	PointFree(&Point_Temp);
+}
+
+/** Store a distinguished point in the table, or find the one with the same key. Several threads can call this function at the same time.
+ * @param Pointer_Search The search.
+ * @param Pointer_Record The point to store, it belongs to the table if it is stored.
+ * @param Pointer_Pointer_Output_Record On output, contain the stored point with the same key if there is one.
+ * @return 1 if the point was stored, 0 if a point with the same key is already stored, -1 if the table is full.
+ */
+static int PollardRhoTableInsert(TPollardRhoSearch *Pointer_Search, TPollardRhoRecord *Pointer_Record, TPollardRhoRecord **Pointer_Pointer_Output_Record)
+{
+	TPollardRhoRecord *Pointer_Slot_Record;
+	unsigned long Slot, i;
+	
+	// Linear probing, a slot goes from NULL to a record only once so a record never moves
+	Slot = PollardRhoHash(Pointer_Record->Key) & Pointer_Search->Table_Mask;
+	for (i = 0; i <= Pointer_Search->Table_Mask; i++)
+	{
+		Pointer_Slot_Record = __atomic_load_n(&Pointer_Search->Pointer_Table[Slot], __ATOMIC_ACQUIRE);
+		if (Pointer_Slot_Record == NULL)
+		{
+			if (__atomic_compare_exchange_n(&Pointer_Search->Pointer_Table[Slot], &Pointer_Slot_Record, Pointer_Record, 0, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) return 1;
+			// Another thread took the slot first, Pointer_Slot_Record now contains its record
+		}
+		if (Pointer_Slot_Record->Key == Pointer_Record->Key)
+		{
+			*Pointer_Pointer_Output_Record = Pointer_Slot_Record;
+			return 0;
+		}
+		Slot = (Slot + 1) & Pointer_Search->Table_Mask;
+	}
+	return -1;
+}
+
+/** Try to compute the logarithm from two walks reaching the same point.
+ * @param Pointer_Search The search.
+ * @param Pointer_Point The point reached by the current walk.
+ * @param a The current walk generator coefficient.
+ * @param b The current walk searched point coefficient.
+ * @param Pointer_Record The stored distinguished point with the same key.
+ * @return 1 if the logarithm was found or 0 if the walks are useless (a key collision or a walk meeting itself).
+ */
+static int PollardRhoSolve(TPollardRhoSearch *Pointer_Search, TPoint *Pointer_Point, mpz_t a, mpz_t b, TPollardRhoRecord *Pointer_Record)
+{
+	TEllipticCurve *Pointer_Curve = Pointer_Search->Pointer_Curve;
+	TPoint Point_Stored;
+	mpz_t Number_Numerator, Number_Denominator;
+	int Is_Solved = 0;
+	
+	PointCreate(0, 0, &Point_Stored);
+	mpz_init(Number_Numerator);
+	mpz_init(Number_Denominator);
+	PollardRhoComputeCombination(Pointer_Search, Pointer_Record->a, Pointer_Record->b, &Point_Stored);
+	if (mpz_cmp(Point_Stored.X, Pointer_Point->X) != 0) goto Exit;
+	
+	// a.G + b.Q = a'.G + b'.Q gives k = (a' - a) / (b - b'), a.G + b.Q = -(a'.G + b'.Q) gives k = -(a + a') / (b + b')
+	if (mpz_cmp(Point_Stored.Y, Pointer_Point->Y) == 0)
+	{
+		mpz_sub(Number_Numerator, Pointer_Record->a, a);
+		mpz_sub(Number_Denominator, b, Pointer_Record->b);
+	}
+	else
+	{
+		mpz_add(Number_Numerator, a, Pointer_Record->a);
+		mpz_neg(Number_Numerator, Number_Numerator);
+		mpz_add(Number_Denominator, b, Pointer_Record->b);
+	}
+	if (!mpz_invert(Number_Denominator, Number_Denominator, Pointer_Curve->n)) goto Exit;
+	mpz_mul(Number_Numerator, Number_Numerator, Number_Denominator);
+	mpz_mod(Number_Numerator, Number_Numerator, Pointer_Curve->n);
+	
+	// Check the result before publishing it
+	ECMultiplicationGenerator(Pointer_Curve, Number_Numerator, &Point_Stored);
+	if (Point_Stored.Is_Infinite || (mpz_cmp(Point_Stored.X, Pointer_Search->Point_Q.X) != 0) || (mpz_cmp(Point_Stored.Y, Pointer_Search->Point_Q.Y) != 0)) goto Exit;
+	pthread_mutex_lock(&Pointer_Search->Mutex);
+	if (!Pointer_Search->Is_Solved)
+	{
+		mpz_set(Pointer_Search->Logarithm, Number_Numerator);
+		Pointer_Search->Is_Solved = 1;
+	}
+	__atomic_store_n(&Pointer_Search->Is_Finished, 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&Pointer_Search->Mutex);
+	Is_Solved = 1;
+	
+Exit:
+	PointFree(&Point_Stored);
+	mpz_clear(Number_Numerator);
+	mpz_clear(Number_Denominator);
+	return Is_Solved;
+}
+
+/** Start a walk from a random combination a.G + b.Q.
+ * @param Pointer_Search The search.
+ * @param Pointer_Point On output, contain the walk start point (it is never the point at infinity).
+ * @param a On output, contain the generator coefficient.
+ * @param b On output, contain the searched point coefficient.
+ */
+static void PollardRhoStartWalk(TPollardRhoSearch *Pointer_Search, TPoint *Pointer_Point, mpz_t a, mpz_t b)
+{
+	do
+	{
+		UtilsGenerateRandomNumber(Pointer_Search->Pointer_Curve->n, a);
+		UtilsGenerateRandomNumber(Pointer_Search->Pointer_Curve->n, b);
+		PollardRhoComputeCombination(Pointer_Search, a, b, Pointer_Point);
+	} while (Pointer_Point->Is_Infinite);
+}
+
+/** Run POLLARD_RHO_WALKERS_COUNT walks until a thread finds the logarithm.
+ * @param Pointer_Parameters The thread state.
+ * @return Always NULL.
+ */
+static void *PollardRhoThread(void *Pointer_Parameters)
+{
+	TPollardRhoThread *Pointer_Thread = Pointer_Parameters;
+	TPollardRhoSearch *Pointer_Search = Pointer_Thread->Pointer_Search;
+	TEllipticCurve *Pointer_Curve = Pointer_Search->Pointer_Curve;
+	TPoint Points[POLLARD_RHO_WALKERS_COUNT], *Pointer_Addend;
+	TPollardRhoRecord *Pointer_Record, *Pointer_Stored_Record;
+	mpz_t a[POLLARD_RHO_WALKERS_COUNT], b[POLLARD_RHO_WALKERS_COUNT], Differences[POLLARD_RHO_WALKERS_COUNT], Products[POLLARD_RHO_WALKERS_COUNT], Number_Inverse, Number_Slope, Number_Temp;
+	unsigned long long Walk_Lengths[POLLARD_RHO_WALKERS_COUNT];
+	int Addend_Indexes[POLLARD_RHO_WALKERS_COUNT], i, Result;
+	uint64_t Key;
+	
+	for (i = 0; i < POLLARD_RHO_WALKERS_COUNT; i++)
+	{
+		PointCreate(0, 0, &Points[i]);
+		mpz_init(a[i]);
+		mpz_init(b[i]);
+		mpz_init(Differences[i]);
+		mpz_init(Products[i]);
+		PollardRhoStartWalk(Pointer_Search, &Points[i], a[i], b[i]);
+		Walk_Lengths[i] = 0;
+	}
+	mpz_init(Number_Inverse);
+	mpz_init(Number_Slope);
+	mpz_init(Number_Temp);
+	
+	while (!__atomic_load_n(&Pointer_Search->Is_Finished, __ATOMIC_ACQUIRE))
+	{
+		// Products of the X differences, a walk reaching +-R[i] (the only case the affine addition formula can't handle) is restarted
+		for (i = 0; i < POLLARD_RHO_WALKERS_COUNT; i++)
+		{
+			while (1)
+			{
+				Addend_Indexes[i] = PollardRhoHash(PollardRhoGetKey(Points[i].X)) % POLLARD_RHO_ADDENDS_COUNT;
+				mpz_sub(Differences[i], Pointer_Search->Addends[Addend_Indexes[i]].X, Points[i].X);
+				if (mpz_sgn(Differences[i]) != 0) break;
+				PollardRhoStartWalk(Pointer_Search, &Points[i], a[i], b[i]);
+				Walk_Lengths[i] = 0;
+			}
+			if (i == 0) mpz_set(Products[0], Differences[0]);
+			else
+			{
+				mpz_mul(Products[i], Products[i - 1], Differences[i]);
+				Pointer_Curve->Function_Reduce(Pointer_Curve, Products[i]);
+			}
+		}
+		mpz_invert(Number_Inverse, Products[POLLARD_RHO_WALKERS_COUNT - 1], Pointer_Curve->p);
+		
+		// Add the walks from the last one, peeling one difference off the inverse at a time
+		for (i = POLLARD_RHO_WALKERS_COUNT - 1; i >= 0; i--)
+		{
+			Pointer_Addend = &Pointer_Search->Addends[Addend_Indexes[i]];
+			
+			// 1 / (x2 - x1)
+			if (i > 0)
+			{
+				mpz_mul(Number_Temp, Number_Inverse, Products[i - 1]);
+				Pointer_Curve->Function_Reduce(Pointer_Curve, Number_Temp);
+				mpz_mul(Number_Inverse, Number_Inverse, Differences[i]);
+				Pointer_Curve->Function_Reduce(Pointer_Curve, Number_Inverse);
+			}
+			else mpz_set(Number_Temp, Number_Inverse);
+			
+			// s = (y2 - y1) / (x2 - x1), x3 = s^2 - x1 - x2, y3 = s.(x1 - x3) - y1
+			mpz_sub(Number_Slope, Pointer_Addend->Y, Points[i].Y);
+			mpz_mul(Number_Slope, Number_Slope, Number_Temp);
+			Pointer_Curve->Function_Reduce(Pointer_Curve, Number_Slope);
+			mpz_mul(Number_Temp, Number_Slope, Number_Slope);
+			mpz_sub(Number_Temp, Number_Temp, Points[i].X);
+			mpz_sub(Number_Temp, Number_Temp, Pointer_Addend->X);
+			Pointer_Curve->Function_Reduce(Pointer_Curve, Number_Temp);
+			mpz_sub(Points[i].X, Points[i].X, Number_Temp);
+			mpz_mul(Points[i].X, Points[i].X, Number_Slope);
+			mpz_sub(Points[i].Y, Points[i].X, Points[i].Y);
+			Pointer_Curve->Function_Reduce(Pointer_Curve, Points[i].Y);
+			mpz_swap(Points[i].X, Number_Temp);
+			
+			// a <- a + c[i], b <- b + d[i]
+			mpz_add(a[i], a[i], Pointer_Search->Addends_C[Addend_Indexes[i]]);
+			if (mpz_cmp(a[i], Pointer_Curve->n) >= 0) mpz_sub(a[i], a[i], Pointer_Curve->n);
+			mpz_add(b[i], b[i], Pointer_Search->Addends_D[Addend_Indexes[i]]);
+			if (mpz_cmp(b[i], Pointer_Curve->n) >= 0) mpz_sub(b[i], b[i], Pointer_Curve->n);
+			Walk_Lengths[i]++;
+			
+			// Store the distinguished points, the walk goes on after them
+			Key = PollardRhoGetKey(Points[i].X);
+			if ((Key & Pointer_Search->Distinguished_Mask) == 0)
+			{
+				Pointer_Thread->Distinguished_Points_Count++;
+				Walk_Lengths[i] = 0;
+				Pointer_Record = malloc(sizeof(TPollardRhoRecord));
+				if (Pointer_Record == NULL) Result = -1;
+				else
+				{
+					Pointer_Record->Key = Key;
+					mpz_init_set(Pointer_Record->a, a[i]);
+					mpz_init_set(Pointer_Record->b, b[i]);
+					Result = PollardRhoTableInsert(Pointer_Search, Pointer_Record, &Pointer_Stored_Record);
+				}
+				if (Result != 1)
+				{
+					if (Pointer_Record != NULL)
+					{
+						mpz_clear(Pointer_Record->a);
+						mpz_clear(Pointer_Record->b);
+						free(Pointer_Record);
+					}
+					if (Result == -1)
+					{
+						Pointer_Search->Is_Table_Full = 1;
+						__atomic_store_n(&Pointer_Search->Is_Finished, 1, __ATOMIC_RELEASE);
+						break;
+					}
+					if (PollardRhoSolve(Pointer_Search, &Points[i], a[i], b[i], Pointer_Stored_Record)) break;
+					
+					// The walk met itself or a walk it already merged with, it would only follow the same path again
+					PollardRhoStartWalk(Pointer_Search, &Points[i], a[i], b[i]);
+				}
+			}
+			// A walk trapped in a cycle without distinguished point would never end
+			else if (Walk_Lengths[i] > Pointer_Search->Maximum_Walk_Length)
+			{
+				PollardRhoStartWalk(Pointer_Search, &Points[i], a[i], b[i]);
+				Walk_Lengths[i] = 0;
+			}
+		}
+		__atomic_add_fetch(&Pointer_Thread->Steps_Count, POLLARD_RHO_WALKERS_COUNT, __ATOMIC_RELAXED);
+	}
+	
+	for (i = 0; i < POLLARD_RHO_WALKERS_COUNT; i++)
+	{
+		PointFree(&Points[i]);
+		mpz_clear(a[i]);
+		mpz_clear(b[i]);
+		mpz_clear(Differences[i]);
+		mpz_clear(Products[i]);
+	}
+	mpz_clear(Number_Inverse);
+	mpz_clear(Number_Slope);
+	mpz_clear(Number_Temp);
+	return NULL;
+}
+
+/** Sum the steps done by all threads.
+ * @param Pointer_Threads The threads.
+ * @param Threads_Count How many threads there are.
+ * @return The total steps count.
+ */
+static unsigned long long PollardRhoGetStepsCount(TPollardRhoThread *Pointer_Threads, int Threads_Count)
+{
+	unsigned long long Steps_Count = 0;
+	int i;
+	
+	for (i = 0; i < Threads_Count; i++) Steps_Count += __atomic_load_n(&Pointer_Threads[i].Steps_Count, __ATOMIC_RELAXED);
+	return Steps_Count;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Entry point
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+	TEllipticCurve Curve;
+	TPollardRhoSearch Search;
+	TPollardRhoThread *Pointer_Threads;
+	TPollardRhoRecord *Pointer_Record;
+	mpz_t Number_Logarithm;
+	int i, Threads_Count, Started_Threads_Count, Distinguished_Bits_Count, Return_Value = 0;
+	unsigned long Table_Capacity;
+	unsigned long long Steps_Count, Previous_Steps_Count = 0, Distinguished_Points_Count = 0;
+	long long Start_Time, Time, Previous_Time;
+	double Expected_Steps_Count;
+	
+	// Check parameters
+	if ((argc < 2) || (argc > 4))
+	{
+		printf("Error : bad parameters.\n" \
+			"Usage : %s EllipticCurve [ThreadsCount] [DistinguishedBitsCount]\n" \
+			"Compute the discrete logarithm of a random point of the curve (a built-in curve name or a curve file path) with the parallel Pollard rho method.\n" \
+			"ThreadsCount defaults to the processors count, DistinguishedBitsCount (the zero bits ending a distinguished point X coordinate) is chosen from the group order by default.\n", argv[0]);
+		printf("Built-in curves : ");
+		CurvesRegistryShowNames();
+		putchar('\n');
+		return -1;
+	}
+	if (argc >= 3) Threads_Count = atoi(argv[2]);
+	else Threads_Count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (Threads_Count < 1)
+	{
+		printf("Error : the threads count must be positive.\n");
+		return -1;
+	}
+	
+	// Load elliptic curve
+	if (!CurvesRegistryLoadByNameOrPath(argv[1], &Curve))
+	{
+		printf("Error : can't load curve file.\n");
+		return -2;
+	}
+	if (!mpz_probab_prime_p(Curve.n, 30) || (mpz_sizeinbase(Curve.n, 2) > POLLARD_RHO_MAXIMUM_ORDER_BITS))
+	{
+		printf("Error : the generator order must be a prime of at most %d bits.\n", POLLARD_RHO_MAXIMUM_ORDER_BITS);
+		ECFree(&Curve);
+		return -2;
+	}
+	UtilsInitializeRandomGenerator();
+	
+	// About sqrt(pi.n / 2) steps are expected
+	mpz_init(Number_Logarithm);
+	Expected_Steps_Count = sqrt(3.14159265358979 * mpz_get_d(Curve.n) / 2);
+	if (argc == 4) Distinguished_Bits_Count = atoi(argv[3]);
+	else
+	{
+		Distinguished_Bits_Count = mpz_sizeinbase(Curve.n, 2) / 2 - POLLARD_RHO_TARGET_DISTINGUISHED_POINTS_BITS;
+		if (Distinguished_Bits_Count < 0) Distinguished_Bits_Count = 0;
+	}
+	if ((Distinguished_Bits_Count < 0) || (Distinguished_Bits_Count > 40))
+	{
+		printf("Error : the distinguished bits count must be in [0, 40].\n");
+		Return_Value = -1;
+		goto Exit;
+	}
+	
+	// The table holds 4 times the expected distinguished points count, and at least all the walks first points
+	Table_Capacity = 1024;
+	while ((Table_Capacity < 4 * Expected_Steps_Count / ((double) (1ULL << Distinguished_Bits_Count))) || (Table_Capacity < 4UL * POLLARD_RHO_WALKERS_COUNT * Threads_Count)) Table_Capacity *= 2;
+	
+	// Shared state
+	Search.Pointer_Curve = &Curve;
+	Search.Distinguished_Mask = (1ULL << Distinguished_Bits_Count) - 1;
+	Search.Maximum_Walk_Length = POLLARD_RHO_MAXIMUM_WALK_FACTOR * (1ULL << Distinguished_Bits_Count);
+	Search.Table_Mask = Table_Capacity - 1;
+	Search.Pointer_Table = calloc(Table_Capacity, sizeof(TPollardRhoRecord *));
+	Pointer_Threads = calloc(Threads_Count, sizeof(TPollardRhoThread));
+	if ((Search.Pointer_Table == NULL) || (Pointer_Threads == NULL))
+	{
+		printf("Error : not enough memory.\n");
+		free(Search.Pointer_Table);
+		free(Pointer_Threads);
+		Return_Value = -3;
+		goto Exit;
+	}
+	Search.Is_Finished = 0;
+	Search.Is_Solved = 0;
+	Search.Is_Table_Full = 0;
+	pthread_mutex_init(&Search.Mutex, NULL);
+	mpz_init(Search.Logarithm);
+	
+	// The problem : Q = k.G with a random k
+	UtilsGenerateRandomNumber(Curve.n, Number_Logarithm);
+	PointCreate(0, 0, &Search.Point_Q);
+	ECMultiplicationGenerator(&Curve, Number_Logarithm, &Search.Point_Q);
+	for (i = 0; i < POLLARD_RHO_ADDENDS_COUNT; i++)
+	{
+		mpz_init(Search.Addends_C[i]);
+		mpz_init(Search.Addends_D[i]);
+		PointCreate(0, 0, &Search.Addends[i]);
+		PollardRhoStartWalk(&Search, &Search.Addends[i], Search.Addends_C[i], Search.Addends_D[i]);
+	}
+	gmp_printf("n = %Zd (%d bits), %d threads of %d walks, %d distinguished bits, %.3g steps expected.\n", Curve.n, (int) mpz_sizeinbase(Curve.n, 2), Threads_Count, POLLARD_RHO_WALKERS_COUNT,
+		Distinguished_Bits_Count, Expected_Steps_Count);
+	
+	// Walk in parallel and report the throughput until the logarithm is found
+	Start_Time = UtilsGetTime();
+	Previous_Time = Start_Time;
+	for (Started_Threads_Count = 0; Started_Threads_Count < Threads_Count; Started_Threads_Count++)
+	{
+		Pointer_Threads[Started_Threads_Count].Pointer_Search = &Search;
+		if (pthread_create(&Pointer_Threads[Started_Threads_Count].Thread, NULL, PollardRhoThread, &Pointer_Threads[Started_Threads_Count]) != 0)
+		{
+			// Stop the started threads, they are joined below
+			__atomic_store_n(&Search.Is_Finished, 1, __ATOMIC_RELEASE);
+			break;
+		}
+	}
+	while (!__atomic_load_n(&Search.Is_Finished, __ATOMIC_ACQUIRE))
+	{
+		usleep(10000);
+		Time = UtilsGetTime();
+		if (Time - Previous_Time < POLLARD_RHO_REPORT_PERIOD) continue;
+		
+		Steps_Count = PollardRhoGetStepsCount(Pointer_Threads, Threads_Count);
+		printf("%llu steps (%.1f%% of the expected ones), %.0f steps/s.\n", Steps_Count, 100.0 * Steps_Count / Expected_Steps_Count, (Steps_Count - Previous_Steps_Count) * 1000000.0 / (Time - Previous_Time));
+		fflush(stdout);
+		Previous_Steps_Count = Steps_Count;
+		Previous_Time = Time;
+	}
+	for (i = 0; i < Started_Threads_Count; i++)
+	{
+		pthread_join(Pointer_Threads[i].Thread, NULL);
+		Distinguished_Points_Count += Pointer_Threads[i].Distinguished_Points_Count;
+	}
+	Time = UtilsGetTime() - Start_Time;
+	Steps_Count = PollardRhoGetStepsCount(Pointer_Threads, Threads_Count);
+	
+	// Show the result and the throughput
+	if (Started_Threads_Count < Threads_Count)
+	{
+		printf("Error : could not create the walking threads.\n");
+		Return_Value = -6;
+	}
+	else if (Search.Is_Table_Full)
+	{
+		printf("Error : the distinguished points table is full, use more distinguished bits.\n");
+		Return_Value = -4;
+	}
+	else if (mpz_cmp(Search.Logarithm, Number_Logarithm) != 0)
+	{
+		gmp_printf("Error : found k = %Zd instead of %Zd.\n", Search.Logarithm, Number_Logarithm);
+		Return_Value = -5;
+	}
+	else gmp_printf("Found k = %Zd.\n", Search.Logarithm);
+	printf("%llu steps (%.2f times the expected ones), %llu distinguished points, %.3f s, %.0f steps/s (%.0f steps/s per thread).\n", Steps_Count, Steps_Count / Expected_Steps_Count,
+		Distinguished_Points_Count, Time / 1000000.0, Steps_Count * 1000000.0 / Time, Steps_Count * 1000000.0 / Time / Threads_Count);
+	
+	// Free resources
+	for (i = 0; i <= (int) Search.Table_Mask; i++)
+	{
+		Pointer_Record = Search.Pointer_Table[i];
+		if (Pointer_Record == NULL) continue;
+		mpz_clear(Pointer_Record->a);
+		mpz_clear(Pointer_Record->b);
+		free(Pointer_Record);
+	}
+	for (i = 0; i < POLLARD_RHO_ADDENDS_COUNT; i++)
+	{
+		mpz_clear(Search.Addends_C[i]);
+		mpz_clear(Search.Addends_D[i]);
+		PointFree(&Search.Addends[i]);
+	}
+	PointFree(&Search.Point_Q);
+	mpz_clear(Search.Logarithm);
+	pthread_mutex_destroy(&Search.Mutex);
+	free(Search.Pointer_Table);
+	free(Pointer_Threads);
+	
+Exit:
+	mpz_clear(Number_Logarithm);
+	ECFree(&Curve);
+	return Return_Value;
+}
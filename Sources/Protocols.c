@@ -0,0 +1,306 @@
+/** @file Protocols.c
+ * See Protocols.h for description.
+ */
+#include <string.h>
+#include <gmp.h>
+#include "DSA_Signature.h"
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Protocols.h"
+#include "Public_Key_Cache.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Convert a message to the number signed by DSA.
+ * @param Pointer_Message The message.
+ * @param Message_Size The message size in bytes.
+ * @param Output_Number_Hash On output, contain the message hash read as a big endian number.
+ * @return 1 if the hash was computed or 0 if an error occurred.
+ */
+static int ProtocolHashMessage(const unsigned char *Pointer_Message, size_t Message_Size, mpz_t Output_Number_Hash)
+{
+	unsigned char Buffer_Hash[UTILS_HASH_LENGTH];
+	
+	if (!UtilsComputeHash((unsigned char *) Pointer_Message, Message_Size, Buffer_Hash)) return 0;
+	ProtocolImportNumber(Buffer_Hash, sizeof(Buffer_Hash), Output_Number_Hash);
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+size_t ProtocolGetFieldElementSize(TEllipticCurve *Pointer_Curve)
+{
+	return (mpz_sizeinbase(Pointer_Curve->p, 2) + 7) / 8;
+}
+
+size_t ProtocolGetScalarSize(TEllipticCurve *Pointer_Curve)
+{
+	return (mpz_sizeinbase(Pointer_Curve->n, 2) + 7) / 8;
+}
+
+void ProtocolImportNumber(const unsigned char *Pointer_Buffer, size_t Buffer_Size, mpz_t Output_Number)
+{
+	mpz_import(Output_Number, Buffer_Size, 1, 1, 1, 0, Pointer_Buffer);
+}
+
+int ProtocolExportNumber(mpz_t Number, size_t Buffer_Size, unsigned char *Pointer_Output_Buffer)
+{
+	size_t Number_Size;
+	
+	// Make sure the number fits (mpz_sizeinbase() returns 1 for 0)
+	if (mpz_sgn(Number) < 0) return 0;
+	Number_Size = (mpz_sizeinbase(Number, 2) + 7) / 8;
+	if (Number_Size > Buffer_Size) return 0;
+	
+	// Store the number in the lowest bytes and pad the highest ones
+	memset(Pointer_Output_Buffer, 0, Buffer_Size);
+	mpz_export(Pointer_Output_Buffer + Buffer_Size - Number_Size, NULL, 1, 1, 1, 0, Number);
+	return 1;
+}
+
+int ProtocolIsNumberInBounds(mpz_t Number, mpz_t Number_Order)
+{
+	if (mpz_cmp_ui(Number, 1) < 0) return 0;
+	if (mpz_cmp(Number, Number_Order) >= 0) return 0;
+	return 1;
+}
+
+int ProtocolGenerateKeys(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Output_Private_Key, unsigned char *Pointer_Output_Public_Key)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	mpz_t Private_Key;
+	TPoint Point_Public_Key;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Private_Key);
+	PointCreate(0, 0, &Point_Public_Key);
+	
+	// Generate the private key 's'
+	do
+	{
+		UtilsGenerateRandomNumber(Pointer_Curve->n, Private_Key);
+	} while (!ProtocolIsNumberInBounds(Private_Key, Pointer_Curve->n));
+	
+	// Compute the public key 'Q' = s.G
+	ECMultiplicationGenerator(Pointer_Curve, Private_Key, &Point_Public_Key);
+	if (Point_Public_Key.Is_Infinite) goto Exit;
+	
+	ProtocolExportNumber(Private_Key, ProtocolGetScalarSize(Pointer_Curve), Pointer_Output_Private_Key);
+	ProtocolExportNumber(Point_Public_Key.X, Field_Element_Size, Pointer_Output_Public_Key);
+	ProtocolExportNumber(Point_Public_Key.Y, Field_Element_Size, Pointer_Output_Public_Key + Field_Element_Size);
+	Return_Value = 1;
+	
+Exit:
+	// Do not leave the private key in freed memory
+	mpz_set_ui(Private_Key, 0);
+	mpz_clear(Private_Key);
+	PointFree(&Point_Public_Key);
+	return Return_Value;
+}
+
+int ProtocolDiffieHellmanComputeSharedSecret(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_Peer_Public_Key, unsigned char *Pointer_Output_Shared_Secret)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	mpz_t Private_Key, Number_X;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Private_Key);
+	mpz_init(Number_X);
+	ProtocolImportNumber(Pointer_Private_Key, ProtocolGetScalarSize(Pointer_Curve), Private_Key);
+	ProtocolImportNumber(Pointer_Peer_Public_Key, Field_Element_Size, Number_X);
+	
+	// The peer point must be a curve point of the generator subgroup, and a finite result is required
+	if (!ECIsXCoordinateValid(Pointer_Curve, Number_X)) goto Exit;
+	if (!ECMultiplicationXOnly(Pointer_Curve, Number_X, Private_Key, Number_X)) goto Exit;
+	
+	ProtocolExportNumber(Number_X, Field_Element_Size, Pointer_Output_Shared_Secret);
+	Return_Value = 1;
+	
+Exit:
+	mpz_set_ui(Private_Key, 0);
+	mpz_clear(Private_Key);
+	mpz_clear(Number_X);
+	return Return_Value;
+}
+
+int ProtocolElGamalEncrypt(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Public_Key, const unsigned char *Pointer_Message, unsigned char *Pointer_Output_C1, unsigned char *Pointer_Output_C2)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	mpz_t Number_Public_Key, Number_Message, Number_K, Number_Temp;
+	TPoint Point_Temp;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Number_Public_Key);
+	mpz_init(Number_Message);
+	mpz_init(Number_K);
+	mpz_init(Number_Temp);
+	PointCreate(0, 0, &Point_Temp);
+	ProtocolImportNumber(Pointer_Public_Key, Field_Element_Size, Number_Public_Key);
+	ProtocolImportNumber(Pointer_Message, Field_Element_Size, Number_Message);
+	
+	// Check parameters
+	if (!ECIsXCoordinateValid(Pointer_Curve, Number_Public_Key)) goto Exit;
+	if (mpz_cmp(Number_Message, Pointer_Curve->p) >= 0) goto Exit;
+	
+	// Choose a random 'k' giving finite points
+	do
+	{
+		do
+		{
+			UtilsGenerateRandomNumber(Pointer_Curve->n, Number_K);
+		} while (!ProtocolIsNumberInBounds(Number_K, Pointer_Curve->n));
+		ECMultiplicationGenerator(Pointer_Curve, Number_K, &Point_Temp); // C1 = k.G
+	} while (Point_Temp.Is_Infinite || !ECMultiplicationXOnly(Pointer_Curve, Number_Public_Key, Number_K, Number_Temp)); // x(k.Q)
+	
+	// C2 = M + x(k.Q) mod p
+	mpz_add(Number_Temp, Number_Message, Number_Temp);
+	mpz_mod(Number_Temp, Number_Temp, Pointer_Curve->p);
+	
+	ProtocolExportNumber(Point_Temp.X, Field_Element_Size, Pointer_Output_C1);
+	ProtocolExportNumber(Number_Temp, Field_Element_Size, Pointer_Output_C2);
+	Return_Value = 1;
+	
+Exit:
+	mpz_set_ui(Number_K, 0);
+	mpz_clear(Number_Public_Key);
+	mpz_clear(Number_Message);
+	mpz_clear(Number_K);
+	mpz_clear(Number_Temp);
+	PointFree(&Point_Temp);
+	return Return_Value;
+}
+
+int ProtocolElGamalDecrypt(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_C1, const unsigned char *Pointer_C2, unsigned char *Pointer_Output_Message)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve);
+	mpz_t Private_Key, Number_C1, Number_C2;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Private_Key);
+	mpz_init(Number_C1);
+	mpz_init(Number_C2);
+	ProtocolImportNumber(Pointer_Private_Key, ProtocolGetScalarSize(Pointer_Curve), Private_Key);
+	ProtocolImportNumber(Pointer_C1, Field_Element_Size, Number_C1);
+	ProtocolImportNumber(Pointer_C2, Field_Element_Size, Number_C2);
+	
+	// Compute x(s.C1), C1 must be a point of the generator subgroup
+	if (!ECIsXCoordinateValid(Pointer_Curve, Number_C1) || !ECMultiplicationXOnly(Pointer_Curve, Number_C1, Private_Key, Number_C1)) goto Exit;
+	
+	// M = C2 - x(s.C1) mod p
+	mpz_sub(Number_C2, Number_C2, Number_C1);
+	mpz_mod(Number_C2, Number_C2, Pointer_Curve->p);
+	
+	ProtocolExportNumber(Number_C2, Field_Element_Size, Pointer_Output_Message);
+	Return_Value = 1;
+	
+Exit:
+	mpz_set_ui(Private_Key, 0);
+	mpz_clear(Private_Key);
+	mpz_clear(Number_C1);
+	mpz_clear(Number_C2);
+	return Return_Value;
+}
+
+int ProtocolDSASign(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_Message, size_t Message_Size, unsigned char *Pointer_Output_Signature)
+{
+	size_t Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	mpz_t Private_Key, Number_Hash, Number_U, Number_V;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Private_Key);
+	mpz_init(Number_Hash);
+	mpz_init(Number_U);
+	mpz_init(Number_V);
+	ProtocolImportNumber(Pointer_Private_Key, Scalar_Size, Private_Key);
+	
+	if (!ProtocolHashMessage(Pointer_Message, Message_Size, Number_Hash)) goto Exit;
+	DSASignatureSign(Pointer_Curve, Number_Hash, Private_Key, Number_U, Number_V);
+	
+	// 'u' and 'v' are reduced modulo n so they always fit
+	ProtocolExportNumber(Number_U, Scalar_Size, Pointer_Output_Signature);
+	ProtocolExportNumber(Number_V, Scalar_Size, Pointer_Output_Signature + Scalar_Size);
+	Return_Value = 1;
+	
+Exit:
+	mpz_set_ui(Private_Key, 0);
+	mpz_clear(Private_Key);
+	mpz_clear(Number_Hash);
+	mpz_clear(Number_U);
+	mpz_clear(Number_V);
+	return Return_Value;
+}
+
+int ProtocolDSAVerify(TEllipticCurve *Pointer_Curve, TPublicKeyCache *Pointer_Public_Keys_Cache, const unsigned char *Pointer_Public_Key, const unsigned char *Pointer_Message, size_t Message_Size, const unsigned char *Pointer_Signature)
+{
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve), Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	mpz_t Number_Hash, Number_U, Number_V, Number_Temp;
+	TScalar Inverse, Factor;
+	TPoint Point_Public_Key, Point_Temp, Point_Temp_2;
+	TPublicKeyCacheEntry *Pointer_Public_Key_Entry = NULL;
+	int Return_Value = 0;
+	
+	// Initialize variables
+	mpz_init(Number_Hash);
+	mpz_init(Number_U);
+	mpz_init(Number_V);
+	mpz_init(Number_Temp);
+	PointCreate(0, 0, &Point_Public_Key);
+	PointCreate(0, 0, &Point_Temp);
+	PointCreate(0, 0, &Point_Temp_2);
+	ProtocolImportNumber(Pointer_Public_Key, Field_Element_Size, Point_Public_Key.X);
+	ProtocolImportNumber(Pointer_Public_Key + Field_Element_Size, Field_Element_Size, Point_Public_Key.Y);
+	ProtocolImportNumber(Pointer_Signature, Scalar_Size, Number_U);
+	ProtocolImportNumber(Pointer_Signature + Scalar_Size, Scalar_Size, Number_V);
+	
+	// 'u' and 'v' must be between 1 and n - 1
+	if (!ProtocolIsNumberInBounds(Number_U, Pointer_Curve->n) || !ProtocolIsNumberInBounds(Number_V, Pointer_Curve->n)) goto Exit;
+	
+	// The public key must be a valid point of the curve subgroup, the cache remembers the result and the key multiples
+	if (Pointer_Public_Keys_Cache != NULL)
+	{
+		Pointer_Public_Key_Entry = PublicKeyCacheGet(Pointer_Public_Keys_Cache, Pointer_Curve, &Point_Public_Key);
+		if ((Pointer_Public_Key_Entry == NULL) || !Pointer_Public_Key_Entry->Is_Valid) goto Exit;
+	}
+	else if (!ECIsPublicKeyValid(Pointer_Curve, &Point_Public_Key)) goto Exit;
+	
+	if (!ProtocolHashMessage(Pointer_Message, Message_Size, Number_Hash)) goto Exit;
+	
+	// Compute (H(m) / v mod n).G using v^-1
+	ScalarFieldImport(&Pointer_Curve->Scalar_Field, Number_V, &Inverse);
+	ScalarFieldInvert(&Pointer_Curve->Scalar_Field, &Inverse, &Inverse);
+	ScalarFieldImport(&Pointer_Curve->Scalar_Field, Number_Hash, &Factor);
+	ScalarFieldMultiply(&Pointer_Curve->Scalar_Field, &Factor, &Inverse, &Factor);
+	ScalarFieldExport(&Pointer_Curve->Scalar_Field, &Factor, Number_Temp);
+	ECMultiplicationGenerator(Pointer_Curve, Number_Temp, &Point_Temp);
+	
+	// Compute (u / v mod n).Q
+	ScalarFieldImport(&Pointer_Curve->Scalar_Field, Number_U, &Factor);
+	ScalarFieldMultiply(&Pointer_Curve->Scalar_Field, &Factor, &Inverse, &Factor);
+	ScalarFieldExport(&Pointer_Curve->Scalar_Field, &Factor, Number_Temp);
+	if (Pointer_Public_Key_Entry != NULL) ECMultiplicationWithTable(Pointer_Curve, &Pointer_Public_Key_Entry->Table, Number_Temp, &Point_Temp_2);
+	else ECMultiplication(Pointer_Curve, &Point_Public_Key, Number_Temp, &Point_Temp_2);
+	
+	// The signature matches if the X coordinate of the sum is equal to 'u'
+	ECAddition(Pointer_Curve, &Point_Temp, &Point_Temp_2, &Point_Temp);
+	if (Point_Temp.Is_Infinite) goto Exit;
+	mpz_mod(Number_Temp, Point_Temp.X, Pointer_Curve->n);
+	if (mpz_cmp(Number_U, Number_Temp) == 0) Return_Value = 1;
+	
+Exit:
+	mpz_clear(Number_Hash);
+	mpz_clear(Number_U);
+	mpz_clear(Number_V);
+	mpz_clear(Number_Temp);
+	PointFree(&Point_Public_Key);
+	PointFree(&Point_Temp);
+	PointFree(&Point_Temp_2);
+	return Return_Value;
+}
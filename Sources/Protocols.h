@@ -0,0 +1,117 @@
+/** @file Protocols.h
+ * Key generation, Diffie-Hellman, ElGamal and DSA working on caller-supplied byte buffers, without any input/output, so they can be embedded in any program.
+ * Numbers are stored as fixed size big endian byte strings : a field element (a coordinate or an ElGamal message) takes ProtocolGetFieldElementSize() bytes and a scalar (a private key or
+ * a signature number) takes ProtocolGetScalarSize() bytes. A public key is its X coordinate followed by its Y coordinate. A signature is 'u' followed by 'v'.
+ * The random numbers come from UtilsGenerateRandomNumber(), so UtilsInitializeRandomGenerator() must have been called.
+ */
+#ifndef H_PROTOCOLS_H
+#define H_PROTOCOLS_H
+
+#include <stddef.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Modular_Inversion.h"
+#include "Public_Key_Cache.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** The largest field element or scalar of the supported curves, so buffers can be allocated before the curve is known. */
+#define PROTOCOL_MAXIMUM_NUMBER_SIZE ((MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8)
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Tell how many bytes a field element takes in a buffer.
+ * @param Pointer_Curve The curve.
+ * @return The size in bytes of p.
+ */
+size_t ProtocolGetFieldElementSize(TEllipticCurve *Pointer_Curve);
+
+/** Tell how many bytes a scalar takes in a buffer.
+ * @param Pointer_Curve The curve.
+ * @return The size in bytes of n.
+ */
+size_t ProtocolGetScalarSize(TEllipticCurve *Pointer_Curve);
+
+/** Convert a big endian byte string to a number.
+ * @param Pointer_Buffer The bytes.
+ * @param Buffer_Size How many bytes to read.
+ * @param Output_Number On output, contain the number.
+ */
+void ProtocolImportNumber(const unsigned char *Pointer_Buffer, size_t Buffer_Size, mpz_t Output_Number);
+
+/** Convert a non-negative number to a fixed size big endian byte string.
+ * @param Number The number to convert.
+ * @param Buffer_Size How many bytes to write, the number is padded with leading zeros.
+ * @param Pointer_Output_Buffer On output, contain the bytes.
+ * @return 1 if the number was converted or 0 if it does not fit in the buffer.
+ */
+int ProtocolExportNumber(mpz_t Number, size_t Buffer_Size, unsigned char *Pointer_Output_Buffer);
+
+/** Tell if a number is comprised between 1 and Number_Order - 1.
+ * @param Number The number to check.
+ * @param Number_Order The order of the group.
+ * @return 1 if the number is in bounds or 0 if not.
+ */
+int ProtocolIsNumberInBounds(mpz_t Number, mpz_t Number_Order);
+
+/** Generate a key pair.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Output_Private_Key On output, contain the private key s in [1, n - 1] (scalar size).
+ * @param Pointer_Output_Public_Key On output, contain the public key s.G (twice the field element size).
+ * @return 1 if the keys were generated or 0 if the public key is infinite (only possible with a broken curve).
+ */
+int ProtocolGenerateKeys(TEllipticCurve *Pointer_Curve, unsigned char *Pointer_Output_Private_Key, unsigned char *Pointer_Output_Public_Key);
+
+/** Compute the Diffie-Hellman shared secret, the X coordinate of the private key multiplied with the peer public key.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Private_Key The private key (scalar size).
+ * @param Pointer_Peer_Public_Key The peer public key X coordinate (field element size), a full public key can be given as only its X coordinate is read.
+ * @param Pointer_Output_Shared_Secret On output, contain the shared secret (field element size).
+ * @return 1 if the secret was computed or 0 if the peer public key is not valid.
+ */
+int ProtocolDiffieHellmanComputeSharedSecret(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_Peer_Public_Key, unsigned char *Pointer_Output_Shared_Secret);
+
+/** Encrypt a message with an ElGamal public key : C1 = k.G and C2 = M + x(k.Q) mod p, where k is random. Only the X coordinate of C1 is output.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Public_Key The recipient public key X coordinate (field element size), a full public key can be given as only its X coordinate is read.
+ * @param Pointer_Message The message, a number lower than p (field element size).
+ * @param Pointer_Output_C1 On output, contain the X coordinate of C1 (field element size).
+ * @param Pointer_Output_C2 On output, contain C2 (field element size).
+ * @return 1 if the message was encrypted or 0 if the public key is not valid or the message is not lower than p.
+ */
+int ProtocolElGamalEncrypt(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Public_Key, const unsigned char *Pointer_Message, unsigned char *Pointer_Output_C1, unsigned char *Pointer_Output_C2);
+
+/** Decrypt an ElGamal message : M = C2 - x(s.C1) mod p.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Private_Key The recipient private key (scalar size).
+ * @param Pointer_C1 The X coordinate of C1 (field element size).
+ * @param Pointer_C2 C2 (field element size).
+ * @param Pointer_Output_Message On output, contain the message (field element size).
+ * @return 1 if the message was decrypted or 0 if C1 is not valid.
+ */
+int ProtocolElGamalDecrypt(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_C1, const unsigned char *Pointer_C2, unsigned char *Pointer_Output_Message);
+
+/** Sign a message with DSA (see DSA_Signature.h), the message is hashed with UtilsComputeHash().
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Private_Key The signer private key (scalar size).
+ * @param Pointer_Message The message to sign.
+ * @param Message_Size The message size in bytes.
+ * @param Pointer_Output_Signature On output, contain 'u' followed by 'v' (twice the scalar size).
+ * @return 1 if the message was signed or 0 if the message could not be hashed.
+ */
+int ProtocolDSASign(TEllipticCurve *Pointer_Curve, const unsigned char *Pointer_Private_Key, const unsigned char *Pointer_Message, size_t Message_Size, unsigned char *Pointer_Output_Signature);
+
+/** Check a DSA signature.
+ * @param Pointer_Curve The curve.
+ * @param Pointer_Public_Keys_Cache The already checked public keys, it avoids validating the same key and computing its multiples again (it can be NULL).
+ * @param Pointer_Public_Key The signer public key (twice the field element size).
+ * @param Pointer_Message The signed message.
+ * @param Message_Size The message size in bytes.
+ * @param Pointer_Signature 'u' followed by 'v' (twice the scalar size).
+ * @return 1 if the signature matches or 0 if the signature, the public key or the message is not valid.
+ */
+int ProtocolDSAVerify(TEllipticCurve *Pointer_Curve, TPublicKeyCache *Pointer_Public_Keys_Cache, const unsigned char *Pointer_Public_Key, const unsigned char *Pointer_Message, size_t Message_Size, const unsigned char *Pointer_Signature);
+
+#endif
@@ -0,0 +1,151 @@
+/** @file Public_Key_Cache.c
+ * Memory-bounded LRU cache of already validated public keys and of their precomputed multiples.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+#include "Public_Key_Cache.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Compute the bucket of a key.
+ * @param Pointer_Point_Key The key.
+ * @return The bucket index.
+ */
+static inline int PublicKeyCacheGetBucket(TPoint *Pointer_Point_Key)
+{
+	// Coordinates are uniformly distributed so the lowest limb is a good enough hash
+	return mpz_getlimbn(Pointer_Point_Key->X, 0) % PUBLIC_KEY_CACHE_BUCKETS_COUNT;
+}
+
+/** Compute how many bytes a point uses.
+ * @param Pointer_Point The point.
+ * @return The point size in bytes.
+ */
+static inline size_t PublicKeyCacheGetPointSize(TPoint *Pointer_Point)
+{
+	return sizeof(TPoint) + (mpz_size(Pointer_Point->X) + mpz_size(Pointer_Point->Y)) * sizeof(mp_limb_t);
+}
+
+/** Remove an entry from the LRU list.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Entry The entry to unlink.
+ */
+static void PublicKeyCacheUnlinkFromList(TPublicKeyCache *Pointer_Cache, TPublicKeyCacheEntry *Pointer_Entry)
+{
+	if (Pointer_Entry->Pointer_Previous_Entry != NULL) Pointer_Entry->Pointer_Previous_Entry->Pointer_Next_Entry = Pointer_Entry->Pointer_Next_Entry;
+	else Pointer_Cache->Pointer_Most_Recent_Entry = Pointer_Entry->Pointer_Next_Entry;
+	
+	if (Pointer_Entry->Pointer_Next_Entry != NULL) Pointer_Entry->Pointer_Next_Entry->Pointer_Previous_Entry = Pointer_Entry->Pointer_Previous_Entry;
+	else Pointer_Cache->Pointer_Least_Recent_Entry = Pointer_Entry->Pointer_Previous_Entry;
+}
+
+/** Insert an entry at the head of the LRU list.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Entry The entry to mark as the most recently used.
+ */
+static void PublicKeyCacheLinkToListHead(TPublicKeyCache *Pointer_Cache, TPublicKeyCacheEntry *Pointer_Entry)
+{
+	Pointer_Entry->Pointer_Previous_Entry = NULL;
+	Pointer_Entry->Pointer_Next_Entry = Pointer_Cache->Pointer_Most_Recent_Entry;
+	if (Pointer_Cache->Pointer_Most_Recent_Entry != NULL) Pointer_Cache->Pointer_Most_Recent_Entry->Pointer_Previous_Entry = Pointer_Entry;
+	else Pointer_Cache->Pointer_Least_Recent_Entry = Pointer_Entry;
+	Pointer_Cache->Pointer_Most_Recent_Entry = Pointer_Entry;
+}
+
+/** Remove an entry from the cache and free it.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Entry The entry to remove.
+ */
+static void PublicKeyCacheRemove(TPublicKeyCache *Pointer_Cache, TPublicKeyCacheEntry *Pointer_Entry)
+{
+	TPublicKeyCacheEntry **Pointer_Pointer_Link;
+	
+	// Remove the entry from its bucket
+	Pointer_Pointer_Link = &Pointer_Cache->Pointer_Buckets[PublicKeyCacheGetBucket(&Pointer_Entry->Point_Key)];
+	while (*Pointer_Pointer_Link != Pointer_Entry) Pointer_Pointer_Link = &(*Pointer_Pointer_Link)->Pointer_Next_Bucket_Entry;
+	*Pointer_Pointer_Link = Pointer_Entry->Pointer_Next_Bucket_Entry;
+	
+	PublicKeyCacheUnlinkFromList(Pointer_Cache, Pointer_Entry);
+	Pointer_Cache->Size -= Pointer_Entry->Size;
+	Pointer_Cache->Entries_Count--;
+	
+	// Free the entry
+	PointFree(&Pointer_Entry->Point_Key);
+	if (Pointer_Entry->Is_Valid) ECFreePrecomputedTable(&Pointer_Entry->Table);
+	free(Pointer_Entry);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+void PublicKeyCacheCreate(TPublicKeyCache *Pointer_Cache, size_t Maximum_Size)
+{
+	memset(Pointer_Cache, 0, sizeof(TPublicKeyCache));
+	Pointer_Cache->Maximum_Size = Maximum_Size;
+}
+
+void PublicKeyCacheFree(TPublicKeyCache *Pointer_Cache)
+{
+	while (Pointer_Cache->Pointer_Least_Recent_Entry != NULL) PublicKeyCacheRemove(Pointer_Cache, Pointer_Cache->Pointer_Least_Recent_Entry);
+}
+
+TPublicKeyCacheEntry *PublicKeyCacheGet(TPublicKeyCache *Pointer_Cache, TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Key)
+{
+	TPublicKeyCacheEntry *Pointer_Entry;
+	int Bucket_Index, i;
+	
+	// Is the key already known ?
+	Bucket_Index = PublicKeyCacheGetBucket(Pointer_Point_Key);
+	for (Pointer_Entry = Pointer_Cache->Pointer_Buckets[Bucket_Index]; Pointer_Entry != NULL; Pointer_Entry = Pointer_Entry->Pointer_Next_Bucket_Entry)
+	{
+		if (PointIsEqual(&Pointer_Entry->Point_Key, Pointer_Point_Key))
+		{
+			// The key becomes the most recently used one
+			PublicKeyCacheUnlinkFromList(Pointer_Cache, Pointer_Entry);
+			PublicKeyCacheLinkToListHead(Pointer_Cache, Pointer_Entry);
+			Pointer_Cache->Hits_Count++;
+			return Pointer_Entry;
+		}
+	}
+	Pointer_Cache->Misses_Count++;
+	
+	// Create a new entry
+	Pointer_Entry = malloc(sizeof(TPublicKeyCacheEntry));
+	if (Pointer_Entry == NULL) return NULL;
+	PointCreate(0, 0, &Pointer_Entry->Point_Key);
+	PointCopy(Pointer_Point_Key, &Pointer_Entry->Point_Key);
+	Pointer_Entry->Size = sizeof(TPublicKeyCacheEntry) + PublicKeyCacheGetPointSize(Pointer_Point_Key);
+	
+	// Validate the key once, invalid keys are remembered too so they are rejected quickly
+	Pointer_Entry->Is_Valid = ECIsPublicKeyValid(Pointer_Curve, Pointer_Point_Key);
+	if (Pointer_Entry->Is_Valid)
+	{
+		if (!ECPrecomputeTable(Pointer_Curve, Pointer_Point_Key, PUBLIC_KEY_CACHE_WINDOW_SIZE, &Pointer_Entry->Table))
+		{
+			PointFree(&Pointer_Entry->Point_Key);
+			free(Pointer_Entry);
+			return NULL;
+		}
+		for (i = 0; i < Pointer_Entry->Table.Points_Count; i++) Pointer_Entry->Size += PublicKeyCacheGetPointSize(&Pointer_Entry->Table.Pointer_Points[i]);
+	}
+	
+	// Make room for the new entry (the most recent entry is always kept even if it is bigger than the cap alone)
+	while ((Pointer_Cache->Pointer_Least_Recent_Entry != NULL) && (Pointer_Cache->Size + Pointer_Entry->Size > Pointer_Cache->Maximum_Size))
+	{
+		PublicKeyCacheRemove(Pointer_Cache, Pointer_Cache->Pointer_Least_Recent_Entry);
+		Pointer_Cache->Evictions_Count++;
+	}
+	
+	// Index the entry
+	Pointer_Entry->Pointer_Next_Bucket_Entry = Pointer_Cache->Pointer_Buckets[Bucket_Index];
+	Pointer_Cache->Pointer_Buckets[Bucket_Index] = Pointer_Entry;
+	PublicKeyCacheLinkToListHead(Pointer_Cache, Pointer_Entry);
+	Pointer_Cache->Size += Pointer_Entry->Size;
+	Pointer_Cache->Entries_Count++;
+	
+	return Pointer_Entry;
+}
@@ -0,0 +1,71 @@
+/** @file Public_Key_Cache.h
+ * Memory-bounded LRU cache of already validated public keys and of their precomputed multiples.
+ */
+#ifndef H_PUBLIC_KEY_CACHE_H
+#define H_PUBLIC_KEY_CACHE_H
+
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** How many factor bits are processed at once by the cached tables. */
+#define PUBLIC_KEY_CACHE_WINDOW_SIZE 4
+/** How many hash buckets are used to find a key. */
+#define PUBLIC_KEY_CACHE_BUCKETS_COUNT 4096
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A cached public key. */
+typedef struct TPublicKeyCacheEntry
+{
+	TPoint Point_Key; //! The public key.
+	char Is_Valid; //! The validation result (the table is computed only for valid keys).
+	TPrecomputedTable Table; //! The multiples of the key.
+	size_t Size; //! Memory consumed by the entry in bytes.
+	struct TPublicKeyCacheEntry *Pointer_Previous_Entry; //! More recently used entry (or NULL).
+	struct TPublicKeyCacheEntry *Pointer_Next_Entry; //! Less recently used entry (or NULL).
+	struct TPublicKeyCacheEntry *Pointer_Next_Bucket_Entry; //! Next entry in the same hash bucket (or NULL).
+} TPublicKeyCacheEntry;
+
+/** A public keys cache. */
+typedef struct
+{
+	TPublicKeyCacheEntry *Pointer_Buckets[PUBLIC_KEY_CACHE_BUCKETS_COUNT]; //! Entries sorted by the hash of their key.
+	TPublicKeyCacheEntry *Pointer_Most_Recent_Entry; //! Head of the LRU list.
+	TPublicKeyCacheEntry *Pointer_Least_Recent_Entry; //! Tail of the LRU list.
+	size_t Maximum_Size; //! Memory cap in bytes.
+	size_t Size; //! Memory currently used by all entries.
+	int Entries_Count; //! How many keys are cached.
+	unsigned long long Hits_Count; //! How many lookups found the key.
+	unsigned long long Misses_Count; //! How many lookups had to validate the key and build its table.
+	unsigned long long Evictions_Count; //! How many keys were dropped to respect the memory cap.
+} TPublicKeyCache;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Create an empty cache.
+ * @param Pointer_Cache The cache to initialize.
+ * @param Maximum_Size How many bytes the cache can use.
+ */
+void PublicKeyCacheCreate(TPublicKeyCache *Pointer_Cache, size_t Maximum_Size);
+
+/** Free all cache resources.
+ * @param Pointer_Cache The cache to destroy.
+ */
+void PublicKeyCacheFree(TPublicKeyCache *Pointer_Cache);
+
+/** Find a public key in the cache, validating it and building its table if it is not already cached.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Curve The curve the key belongs to (a cache must always be used with the same curve).
+ * @param Pointer_Point_Key The public key.
+ * @return The cache entry (check its Is_Valid field before using its table) or NULL if there is not enough memory.
+ * @warning The returned entry is valid only until the next call to PublicKeyCacheGet().
+ */
+TPublicKeyCacheEntry *PublicKeyCacheGet(TPublicKeyCache *Pointer_Cache, TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_Key);
+
+#endif
@@ -0,0 +1,209 @@
+/** @file Scalar_Field.c
+ * See Scalar_Field.h for description.
+ */
+#include <gmp.h>
+#include <string.h>
+#include "Scalar_Field.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** How many exponent bits the inversion processes at a time. */
+#define SCALAR_FIELD_INVERSION_WINDOW_SIZE 4
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Copy the limbs of a GMP number to a fixed size buffer, padding it with zeros.
+ * @param Number The number, it must fit in the buffer.
+ * @param Pointer_Output_Limbs On output, contain the number limbs.
+ * @param Limbs_Count The buffer size in limbs.
+ */
+static void ScalarFieldCopyNumberLimbs(mpz_t Number, mp_limb_t *Pointer_Output_Limbs, int Limbs_Count)
+{
+	int Size;
+	
+	Size = (int) mpz_size(Number);
+	memcpy(Pointer_Output_Limbs, mpz_limbs_read(Number), Size * sizeof(mp_limb_t));
+	memset(Pointer_Output_Limbs + Size, 0, (Limbs_Count - Size) * sizeof(mp_limb_t));
+}
+
+/** Barrett reduction (Handbook of Applied Cryptography, algorithm 14.42) of a number lower than b^(2.k), where b = 2^GMP_NUMB_BITS and k is the field limbs count.
+ * The quotient estimate q = floor(floor(X / b^(k - 1)) * mu / b^(k + 1)) is at most 2 below the real quotient, so two conditional subtractions always give the canonical remainder.
+ * @param Pointer_Field The field.
+ * @param Pointer_Number The 2.k limbs of the number to reduce.
+ * @param Pointer_Output_Scalar On output, contain the number modulo n.
+ */
+static void ScalarFieldReduce(TScalarField *Pointer_Field, const mp_limb_t *Pointer_Number, TScalar *Pointer_Output_Scalar)
+{
+	mp_limb_t Quotient[2 * SCALAR_FIELD_MAXIMUM_LIMBS_COUNT + 2], Product[2 * SCALAR_FIELD_MAXIMUM_LIMBS_COUNT + 1], Remainder[SCALAR_FIELD_MAXIMUM_LIMBS_COUNT + 1], Borrow;
+	int k = Pointer_Field->Limbs_Count, i;
+	
+	// Estimate the quotient from the k + 1 most significant limbs
+	mpn_mul_n(Quotient, Pointer_Number + k - 1, Pointer_Field->Barrett_Constant, k + 1);
+	mpn_mul(Product, Quotient + k + 1, k + 1, Pointer_Field->Modulus, k);
+	
+	// The remainder is lower than 3.n < b^(k + 1), so only the low limbs of the subtraction are needed
+	mpn_sub_n(Remainder, Pointer_Number, Product, k + 1);
+	for (i = 0; i < 2; i++)
+	{
+		Borrow = mpn_sub_n(Remainder, Remainder, Pointer_Field->Modulus, k + 1);
+		mpn_cnd_add_n(Borrow, Remainder, Remainder, Pointer_Field->Modulus, k + 1);
+	}
+	memcpy(Pointer_Output_Scalar->Limbs, Remainder, k * sizeof(mp_limb_t));
+}
+
+/** Compute A^-1 = A^(n - 2) mod n with a fixed window exponentiation, the windows are selected by the public exponent only.
+ * @param Pointer_Field The field, n must be prime.
+ * @param Pointer_A The scalar to invert, it must not be zero.
+ * @param Pointer_Output_Inverse On output, contain the inverse (it can be the inverted scalar).
+ */
+static void ScalarFieldInvertFermat(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_Output_Inverse)
+{
+	TScalar Powers[1 << SCALAR_FIELD_INVERSION_WINDOW_SIZE], Result;
+	mp_limb_t *Pointer_Exponent = Pointer_Field->Inversion.Exponent_Number_Limbs;
+	int k = Pointer_Field->Limbs_Count, i, j, Bit_Index, Window;
+	
+	// Powers[i] = A^i
+	memset(Powers[0].Limbs, 0, k * sizeof(mp_limb_t));
+	Powers[0].Limbs[0] = 1;
+	memcpy(Powers[1].Limbs, Pointer_A->Limbs, k * sizeof(mp_limb_t));
+	for (i = 2; i < (1 << SCALAR_FIELD_INVERSION_WINDOW_SIZE); i++) ScalarFieldMultiply(Pointer_Field, &Powers[i - 1], Pointer_A, &Powers[i]);
+	
+	Result = Powers[0];
+	for (Bit_Index = k * GMP_NUMB_BITS - SCALAR_FIELD_INVERSION_WINDOW_SIZE; Bit_Index >= 0; Bit_Index -= SCALAR_FIELD_INVERSION_WINDOW_SIZE)
+	{
+		for (j = 0; j < SCALAR_FIELD_INVERSION_WINDOW_SIZE; j++) ScalarFieldMultiply(Pointer_Field, &Result, &Result, &Result);
+		Window = (Pointer_Exponent[Bit_Index / GMP_NUMB_BITS] >> (Bit_Index % GMP_NUMB_BITS)) & ((1 << SCALAR_FIELD_INVERSION_WINDOW_SIZE) - 1);
+		ScalarFieldMultiply(Pointer_Field, &Result, &Powers[Window], &Result);
+	}
+	
+	memcpy(Pointer_Output_Inverse->Limbs, Result.Limbs, k * sizeof(mp_limb_t));
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int ScalarFieldPrepare(mpz_t Modulus, TScalarField *Pointer_Output_Field)
+{
+	mpz_t Number_Temp;
+	int k;
+	
+	Pointer_Output_Field->Limbs_Count = 0;
+	if ((mpz_sizeinbase(Modulus, 2) > SCALAR_FIELD_MAXIMUM_BITS) || !ModularInversionPrepare(Modulus, &Pointer_Output_Field->Inversion)) return 0;
+	k = (int) mpz_size(Modulus);
+	
+	ScalarFieldCopyNumberLimbs(Modulus, Pointer_Output_Field->Modulus, k + 1);
+	
+	// mu = b^(2.k) / n fits in k + 1 limbs because n is odd so it can't be b^(k - 1)
+	mpz_init(Number_Temp);
+	mpz_setbit(Number_Temp, 2 * k * GMP_NUMB_BITS);
+	mpz_tdiv_q(Number_Temp, Number_Temp, Modulus);
+	ScalarFieldCopyNumberLimbs(Number_Temp, Pointer_Output_Field->Barrett_Constant, k + 1);
+	mpz_clear(Number_Temp);
+	
+	// Prefer the constant-time inversions
+	if (Pointer_Output_Field->Inversion.Is_Safegcd_Available) Pointer_Output_Field->Inversion_Method = MODULAR_INVERSION_METHOD_SAFEGCD;
+	else if (Pointer_Output_Field->Inversion.Is_Prime) Pointer_Output_Field->Inversion_Method = MODULAR_INVERSION_METHOD_FERMAT;
+	else Pointer_Output_Field->Inversion_Method = MODULAR_INVERSION_METHOD_GMP;
+	Pointer_Output_Field->Limbs_Count = k;
+	return 1;
+}
+
+void ScalarFieldImport(TScalarField *Pointer_Field, mpz_t Number, TScalar *Pointer_Output_Scalar)
+{
+	mp_limb_t Limbs[2 * SCALAR_FIELD_MAXIMUM_LIMBS_COUNT];
+	const mp_limb_t *Pointer_Number_Limbs;
+	int k = Pointer_Field->Limbs_Count, Size, i;
+	
+	Size = (int) mpz_size(Number);
+	Pointer_Number_Limbs = mpz_limbs_read(Number);
+	
+	// Most numbers are lower than b^(2.k) and need a single reduction
+	if (Size <= 2 * k)
+	{
+		memcpy(Limbs, Pointer_Number_Limbs, Size * sizeof(mp_limb_t));
+		memset(Limbs + Size, 0, (2 * k - Size) * sizeof(mp_limb_t));
+		ScalarFieldReduce(Pointer_Field, Limbs, Pointer_Output_Scalar);
+		return;
+	}
+	
+	// Longer numbers (like a big hash with a small curve) are reduced one limb at a time, from the most significant one : R = R.b + limb mod n
+	memset(Pointer_Output_Scalar->Limbs, 0, k * sizeof(mp_limb_t));
+	memset(Limbs, 0, 2 * k * sizeof(mp_limb_t));
+	for (i = Size - 1; i >= 0; i--)
+	{
+		Limbs[0] = Pointer_Number_Limbs[i];
+		memcpy(Limbs + 1, Pointer_Output_Scalar->Limbs, k * sizeof(mp_limb_t));
+		ScalarFieldReduce(Pointer_Field, Limbs, Pointer_Output_Scalar);
+	}
+}
+
+void ScalarFieldExport(TScalarField *Pointer_Field, TScalar *Pointer_Scalar, mpz_t Output_Number)
+{
+	mp_limb_t *Pointer_Limbs;
+	int k = Pointer_Field->Limbs_Count;
+	
+	Pointer_Limbs = mpz_limbs_write(Output_Number, k);
+	memcpy(Pointer_Limbs, Pointer_Scalar->Limbs, k * sizeof(mp_limb_t));
+	mpz_limbs_finish(Output_Number, k); // Remove the most significant zero limbs
+}
+
+int ScalarFieldIsZero(TScalarField *Pointer_Field, TScalar *Pointer_Scalar)
+{
+	mp_limb_t Bits = 0;
+	int i;
+	
+	for (i = 0; i < Pointer_Field->Limbs_Count; i++) Bits |= Pointer_Scalar->Limbs[i];
+	return Bits == 0;
+}
+
+void ScalarFieldAdd(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Sum)
+{
+	mp_limb_t Carry, Borrow;
+	int k = Pointer_Field->Limbs_Count;
+	
+	// The sum is lower than 2.n, subtract n and add it back if the sum was lower than n (the subtraction borrows without the addition having carried)
+	Carry = mpn_add_n(Pointer_Output_Sum->Limbs, Pointer_A->Limbs, Pointer_B->Limbs, k);
+	Borrow = mpn_sub_n(Pointer_Output_Sum->Limbs, Pointer_Output_Sum->Limbs, Pointer_Field->Modulus, k);
+	mpn_cnd_add_n(Borrow & (Carry ^ 1), Pointer_Output_Sum->Limbs, Pointer_Output_Sum->Limbs, Pointer_Field->Modulus, k);
+}
+
+void ScalarFieldSubtract(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Difference)
+{
+	mp_limb_t Borrow;
+	int k = Pointer_Field->Limbs_Count;
+	
+	Borrow = mpn_sub_n(Pointer_Output_Difference->Limbs, Pointer_A->Limbs, Pointer_B->Limbs, k);
+	mpn_cnd_add_n(Borrow, Pointer_Output_Difference->Limbs, Pointer_Output_Difference->Limbs, Pointer_Field->Modulus, k);
+}
+
+void ScalarFieldMultiply(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Product)
+{
+	mp_limb_t Product[2 * SCALAR_FIELD_MAXIMUM_LIMBS_COUNT];
+	
+	mpn_mul_n(Product, Pointer_A->Limbs, Pointer_B->Limbs, Pointer_Field->Limbs_Count);
+	ScalarFieldReduce(Pointer_Field, Product, Pointer_Output_Product);
+}
+
+int ScalarFieldInvert(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_Output_Inverse)
+{
+	mpz_t Number_A;
+	int Is_Invertible;
+	
+	if (ScalarFieldIsZero(Pointer_Field, Pointer_A)) return 0;
+	
+	if (Pointer_Field->Inversion_Method == MODULAR_INVERSION_METHOD_SAFEGCD) return ModularInversionSafegcd(&Pointer_Field->Inversion, Pointer_A->Limbs, Pointer_Output_Inverse->Limbs);
+	if (Pointer_Field->Inversion_Method == MODULAR_INVERSION_METHOD_FERMAT)
+	{
+		ScalarFieldInvertFermat(Pointer_Field, Pointer_A, Pointer_Output_Inverse);
+		return 1;
+	}
+	
+	mpz_init(Number_A);
+	ScalarFieldExport(Pointer_Field, Pointer_A, Number_A);
+	Is_Invertible = ModularInversionInvertNumber(&Pointer_Field->Inversion, MODULAR_INVERSION_METHOD_GMP, Number_A, Number_A);
+	if (Is_Invertible) ScalarFieldImport(Pointer_Field, Number_A, Pointer_Output_Inverse);
+	mpz_clear(Number_A);
+	return Is_Invertible;
+}
@@ -0,0 +1,101 @@
+/** @file Scalar_Field.h
+ * Arithmetic modulo the group order n of a curve, used by the signatures. Scalars have a fixed width (the limbs count of n) and the products are reduced with the Barrett method
+ * using a constant precomputed once per curve, so the operations never allocate memory and their running time does not depend on the scalar values.
+ */
+#ifndef H_SCALAR_FIELD_H
+#define H_SCALAR_FIELD_H
+
+#include <gmp.h>
+#include "Modular_Inversion.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** The size in bits of the largest supported group orders (enough for the P-521 curve). */
+#define SCALAR_FIELD_MAXIMUM_BITS MODULAR_INVERSION_MAXIMUM_BITS
+/** How many limbs the largest supported scalars have. */
+#define SCALAR_FIELD_MAXIMUM_LIMBS_COUNT ((SCALAR_FIELD_MAXIMUM_BITS + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS)
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A number in [0, n - 1], the limbs above the field limbs count are not used. */
+typedef struct
+{
+	mp_limb_t Limbs[SCALAR_FIELD_MAXIMUM_LIMBS_COUNT]; //! Least significant limb first.
+} TScalar;
+
+/** The group order and the constants of its arithmetic. */
+typedef struct
+{
+	mp_limb_t Modulus[SCALAR_FIELD_MAXIMUM_LIMBS_COUNT + 1]; //! The limbs of n, followed by a zero limb.
+	mp_limb_t Barrett_Constant[SCALAR_FIELD_MAXIMUM_LIMBS_COUNT + 1]; //! mu = floor(2^(2.k.GMP_NUMB_BITS) / n) where k is the limbs count.
+	int Limbs_Count; //! The limbs count k of n, all scalars have k limbs (0 if the field is not usable).
+	TModularInversionModulus Inversion; //! The inversion constants.
+	int Inversion_Method; //! How ScalarFieldInvert() computes (MODULAR_INVERSION_METHOD_SAFEGCD by default, the Barrett arithmetic is used for MODULAR_INVERSION_METHOD_FERMAT).
+} TScalarField;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Compute the constants of the arithmetic modulo a group order.
+ * @param Modulus The group order, it must be odd, greater than 2 and at most SCALAR_FIELD_MAXIMUM_BITS long.
+ * @param Pointer_Output_Field On output, contain the field.
+ * @return 1 if the field can be used or 0 if the group order is not supported.
+ */
+int ScalarFieldPrepare(mpz_t Modulus, TScalarField *Pointer_Output_Field);
+
+/** Reduce a GMP number to a scalar.
+ * @param Pointer_Field The field.
+ * @param Number A non-negative number (numbers lower than n^2, like the message hashes, are reduced without allocating memory).
+ * @param Pointer_Output_Scalar On output, contain the number modulo n.
+ */
+void ScalarFieldImport(TScalarField *Pointer_Field, mpz_t Number, TScalar *Pointer_Output_Scalar);
+
+/** Convert a scalar to a GMP number.
+ * @param Pointer_Field The field.
+ * @param Pointer_Scalar The scalar.
+ * @param Output_Number On output, contain the scalar value (no memory is allocated when the number is large enough to hold n).
+ */
+void ScalarFieldExport(TScalarField *Pointer_Field, TScalar *Pointer_Scalar, mpz_t Output_Number);
+
+/** Tell if a scalar is zero.
+ * @param Pointer_Field The field.
+ * @param Pointer_Scalar The scalar.
+ * @return 1 if the scalar is zero or 0 otherwise.
+ */
+int ScalarFieldIsZero(TScalarField *Pointer_Field, TScalar *Pointer_Scalar);
+
+/** Compute A + B mod n.
+ * @param Pointer_Field The field.
+ * @param Pointer_A First term.
+ * @param Pointer_B Second term.
+ * @param Pointer_Output_Sum On output, contain the sum (it can be one of the terms).
+ */
+void ScalarFieldAdd(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Sum);
+
+/** Compute A - B mod n.
+ * @param Pointer_Field The field.
+ * @param Pointer_A The scalar to subtract from.
+ * @param Pointer_B The scalar to subtract.
+ * @param Pointer_Output_Difference On output, contain the difference (it can be one of the operands).
+ */
+void ScalarFieldSubtract(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Difference);
+
+/** Compute A * B mod n.
+ * @param Pointer_Field The field.
+ * @param Pointer_A First factor.
+ * @param Pointer_B Second factor.
+ * @param Pointer_Output_Product On output, contain the product (it can be one of the factors).
+ */
+void ScalarFieldMultiply(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_B, TScalar *Pointer_Output_Product);
+
+/** Compute A^-1 mod n with the field inversion method. The safegcd and Fermat (A^(n - 2) with a fixed window) methods have an operations sequence depending on n only.
+ * @param Pointer_Field The field.
+ * @param Pointer_A The scalar to invert.
+ * @param Pointer_Output_Inverse On output, contain the inverse (it can be the inverted scalar).
+ * @return 1 if the scalar was inverted or 0 if it is not invertible (zero or, for the composite n of some test curves, sharing a factor with n).
+ */
+int ScalarFieldInvert(TScalarField *Pointer_Field, TScalar *Pointer_A, TScalar *Pointer_Output_Inverse);
+
+#endif
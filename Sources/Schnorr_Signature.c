@@ -0,0 +1,268 @@
+/** @file Schnorr_Signature.c
+ * See Schnorr_Signature.h for description.
+ */
+#include <stdlib.h>
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Modular_Inversion.h"
+#include "Point.h"
+#include "Protocols.h"
+#include "Scalar_Field.h"
+#include "Schnorr_Signature.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private constants
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** The largest field element or scalar size in bytes. */
+#define SCHNORR_SIGNATURE_MAXIMUM_ELEMENT_SIZE ((MODULAR_INVERSION_MAXIMUM_BITS + 7) / 8)
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Tell if a point can be hashed and used by the verification equation.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Point The point to check.
+ * @return 1 if the point is a finite point of the curve with reduced coordinates or 0 otherwise.
+ */
+static int SchnorrSignatureIsPointValid(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point)
+{
+	if (Pointer_Point->Is_Infinite) return 0;
+	if ((mpz_sgn(Pointer_Point->X) < 0) || (mpz_cmp(Pointer_Point->X, Pointer_Curve->p) >= 0) || (mpz_sgn(Pointer_Point->Y) < 0) || (mpz_cmp(Pointer_Point->Y, Pointer_Curve->p) >= 0)) return 0;
+	return ECIsPointOnCurve(Pointer_Curve, Pointer_Point);
+}
+
+/** Compute the challenge e = H(R || Q || H(m) mod n) mod n, binding the signature to the nonce point, to the signer and to the message.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Point_R The nonce point.
+ * @param Pointer_Point_Public_Key The signer public key.
+ * @param Number_Hash The message hash.
+ * @param Output_Challenge On output, contain the challenge.
+ * @return 1 if the challenge was computed or 0 if a point coordinate is not reduced or the hash could not be computed.
+ */
+static int SchnorrSignatureComputeChallenge(TEllipticCurve *Pointer_Curve, TPoint *Pointer_Point_R, TPoint *Pointer_Point_Public_Key, mpz_t Number_Hash, mpz_t Output_Challenge)
+{
+	unsigned char Buffer[5 * SCHNORR_SIGNATURE_MAXIMUM_ELEMENT_SIZE], Buffer_Hash[UTILS_HASH_LENGTH];
+	size_t Field_Element_Size = ProtocolGetFieldElementSize(Pointer_Curve), Scalar_Size = ProtocolGetScalarSize(Pointer_Curve);
+	
+	if (!ProtocolExportNumber(Pointer_Point_R->X, Field_Element_Size, Buffer)) return 0;
+	if (!ProtocolExportNumber(Pointer_Point_R->Y, Field_Element_Size, Buffer + Field_Element_Size)) return 0;
+	if (!ProtocolExportNumber(Pointer_Point_Public_Key->X, Field_Element_Size, Buffer + 2 * Field_Element_Size)) return 0;
+	if (!ProtocolExportNumber(Pointer_Point_Public_Key->Y, Field_Element_Size, Buffer + 3 * Field_Element_Size)) return 0;
+	
+	// Any hash size is accepted, the reduced hash always fits in a scalar
+	mpz_mod(Output_Challenge, Number_Hash, Pointer_Curve->n);
+	ProtocolExportNumber(Output_Challenge, Scalar_Size, Buffer + 4 * Field_Element_Size);
+	
+	if (!UtilsComputeHash(Buffer, 4 * Field_Element_Size + Scalar_Size, Buffer_Hash)) return 0;
+	ProtocolImportNumber(Buffer_Hash, sizeof(Buffer_Hash), Output_Challenge);
+	mpz_mod(Output_Challenge, Output_Challenge, Pointer_Curve->n);
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+void SchnorrSignatureCreate(TSchnorrSignature *Pointer_Signature)
+{
+	PointCreate(0, 0, &Pointer_Signature->Point_R);
+	mpz_init(Pointer_Signature->S);
+}
+
+void SchnorrSignatureFree(TSchnorrSignature *Pointer_Signature)
+{
+	PointFree(&Pointer_Signature->Point_R);
+	mpz_clear(Pointer_Signature->S);
+}
+
+int SchnorrSignatureSignWithNonce(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, TPoint *Pointer_Point_Public_Key, mpz_t Nonce, TSchnorrSignature *Pointer_Output_Signature)
+{
+	TScalarField *Pointer_Field = &Pointer_Curve->Scalar_Field;
+	TScalar Challenge, Key, S;
+	mpz_t Number_Challenge;
+	int Return_Value = 0;
+	
+	mpz_init(Number_Challenge);
+	
+	// R = k.G
+	ECMultiplicationGenerator(Pointer_Curve, Nonce, &Pointer_Output_Signature->Point_R);
+	if (!SchnorrSignatureComputeChallenge(Pointer_Curve, &Pointer_Output_Signature->Point_R, Pointer_Point_Public_Key, Number_Hash, Number_Challenge)) goto Exit;
+	
+	// s = k + e.x mod n
+	ScalarFieldImport(Pointer_Field, Number_Challenge, &Challenge);
+	ScalarFieldImport(Pointer_Field, Private_Key, &Key);
+	ScalarFieldImport(Pointer_Field, Nonce, &S);
+	ScalarFieldMultiply(Pointer_Field, &Challenge, &Key, &Challenge);
+	ScalarFieldAdd(Pointer_Field, &S, &Challenge, &S);
+	ScalarFieldExport(Pointer_Field, &S, Pointer_Output_Signature->S);
+	Return_Value = 1;
+	
+Exit:
+	mpz_clear(Number_Challenge);
+	return Return_Value;
+}
+
+int SchnorrSignatureSign(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, TPoint *Pointer_Point_Public_Key, TSchnorrSignature *Pointer_Output_Signature)
+{
+	mpz_t Nonce;
+	int Return_Value;
+	
+	mpz_init(Nonce);
+	
+	// The nonce must be in [1, n - 1]
+	do
+	{
+		UtilsGenerateRandomNumber(Pointer_Curve->n, Nonce);
+	} while (mpz_cmp_ui(Nonce, 0) == 0);
+	
+	Return_Value = SchnorrSignatureSignWithNonce(Pointer_Curve, Number_Hash, Private_Key, Pointer_Point_Public_Key, Nonce, Pointer_Output_Signature);
+	
+	// Anyone knowing the nonce can recover the private key from the signature
+	mpz_set_ui(Nonce, 0);
+	mpz_clear(Nonce);
+	return Return_Value;
+}
+
+int SchnorrSignatureVerify(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, TPoint *Pointer_Point_Public_Key, TSchnorrSignature *Pointer_Signature)
+{
+	mpz_t Number_Challenge;
+	TPoint Point_Temp, Point_Temp_2;
+	int Return_Value = 0;
+	
+	// 's' must be in [0, n - 1], R and Q must be finite points of the curve
+	if ((mpz_sgn(Pointer_Signature->S) < 0) || (mpz_cmp(Pointer_Signature->S, Pointer_Curve->n) >= 0)) return 0;
+	if (!SchnorrSignatureIsPointValid(Pointer_Curve, &Pointer_Signature->Point_R) || !SchnorrSignatureIsPointValid(Pointer_Curve, Pointer_Point_Public_Key)) return 0;
+	
+	// Initialize variables
+	mpz_init(Number_Challenge);
+	PointCreate(0, 0, &Point_Temp);
+	PointCreate(0, 0, &Point_Temp_2);
+	
+	if (!SchnorrSignatureComputeChallenge(Pointer_Curve, &Pointer_Signature->Point_R, Pointer_Point_Public_Key, Number_Hash, Number_Challenge)) goto Exit;
+	
+	// s.G - e.Q
+	ECMultiplicationGenerator(Pointer_Curve, Pointer_Signature->S, &Point_Temp);
+	ECMultiplication(Pointer_Curve, Pointer_Point_Public_Key, Number_Challenge, &Point_Temp_2);
+	ECOpposite(Pointer_Curve, &Point_Temp_2, &Point_Temp_2);
+	ECAddition(Pointer_Curve, &Point_Temp, &Point_Temp_2, &Point_Temp);
+	
+	// On prime order curves it must be R, otherwise the difference with R must vanish once multiplied by the cofactor
+	if (mpz_cmp_ui(Pointer_Curve->h, 1) <= 0) Return_Value = PointIsEqual(&Point_Temp, &Pointer_Signature->Point_R);
+	else
+	{
+		ECOpposite(Pointer_Curve, &Pointer_Signature->Point_R, &Point_Temp_2);
+		ECAddition(Pointer_Curve, &Point_Temp, &Point_Temp_2, &Point_Temp);
+		if (!Point_Temp.Is_Infinite) ECMultiplication(Pointer_Curve, &Point_Temp, Pointer_Curve->h, &Point_Temp);
+		Return_Value = Point_Temp.Is_Infinite;
+	}
+	
+Exit:
+	mpz_clear(Number_Challenge);
+	PointFree(&Point_Temp);
+	PointFree(&Point_Temp_2);
+	return Return_Value;
+}
+
+int SchnorrSignatureVerifyBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, TPoint *Pointer_Public_Keys, TSchnorrSignature *Pointer_Signatures, int Signatures_Count)
+{
+	TPoint *Pointer_Points = NULL, Point_Result;
+	mpz_t *Pointer_Factors = NULL, Number_Coefficient, Number_Challenge;
+	unsigned char Buffer_Coefficient[SCHNORR_SIGNATURE_BATCH_COEFFICIENT_BITS / 8];
+	int Points_Count = 0, Allocated_Points_Count = 2 * Signatures_Count + 1, Key_Index = 0, i, Return_Value = 0;
+	
+	if (Signatures_Count <= 0) return 1;
+	
+	// Check what can be checked on each signature alone before allocating anything
+	for (i = 0; i < Signatures_Count; i++)
+	{
+		if ((mpz_sgn(Pointer_Signatures[i].S) < 0) || (mpz_cmp(Pointer_Signatures[i].S, Pointer_Curve->n) >= 0)) return 0;
+		if (!SchnorrSignatureIsPointValid(Pointer_Curve, &Pointer_Signatures[i].Point_R)) return 0;
+		
+		// Consecutive signatures of the same signer are common, its key is checked once
+		if ((i > 0) && PointIsEqual(&Pointer_Public_Keys[i], &Pointer_Public_Keys[i - 1])) continue;
+		if (!SchnorrSignatureIsPointValid(Pointer_Curve, &Pointer_Public_Keys[i])) return 0;
+	}
+	
+	// Initialize variables
+	Pointer_Points = malloc(Allocated_Points_Count * sizeof(TPoint));
+	Pointer_Factors = malloc(Allocated_Points_Count * sizeof(mpz_t));
+	if ((Pointer_Points == NULL) || (Pointer_Factors == NULL))
+	{
+		free(Pointer_Points);
+		free(Pointer_Factors);
+		return 0;
+	}
+	for (i = 0; i < Allocated_Points_Count; i++)
+	{
+		PointCreate(0, 0, &Pointer_Points[i]);
+		mpz_init(Pointer_Factors[i]);
+	}
+	mpz_init(Number_Coefficient);
+	mpz_init(Number_Challenge);
+	PointCreate(0, 0, &Point_Result);
+	
+	// The generator factor receives -sum(a(i).s(i)), it is stored first
+	PointCopy(&Pointer_Curve->Point_Generator, &Pointer_Points[0]);
+	Points_Count = 1;
+	
+	for (i = 0; i < Signatures_Count; i++)
+	{
+		// The first coefficient can be 1 without weakening the check, the other ones are unpredictable and not 0 (errors made to cancel each other with known coefficients would pass)
+		if (i == 0) mpz_set_ui(Number_Coefficient, 1);
+		else
+		{
+			do
+			{
+				if (!UtilsGenerateSecureRandomBuffer(Buffer_Coefficient, sizeof(Buffer_Coefficient))) goto Exit;
+				ProtocolImportNumber(Buffer_Coefficient, sizeof(Buffer_Coefficient), Number_Coefficient);
+			} while (mpz_sgn(Number_Coefficient) == 0);
+		}
+		
+		if (!SchnorrSignatureComputeChallenge(Pointer_Curve, &Pointer_Signatures[i].Point_R, &Pointer_Public_Keys[i], Pointer_Hashes[i], Number_Challenge)) goto Exit;
+		
+		// a(i).R(i)
+		PointCopy(&Pointer_Signatures[i].Point_R, &Pointer_Points[Points_Count]);
+		mpz_set(Pointer_Factors[Points_Count], Number_Coefficient);
+		Points_Count++;
+		
+		// a(i).e(i).Q(i), added to the previous key factor when the signer did not change
+		mpz_mul(Number_Challenge, Number_Challenge, Number_Coefficient);
+		if ((i > 0) && PointIsEqual(&Pointer_Public_Keys[i], &Pointer_Public_Keys[i - 1]))
+		{
+			mpz_add(Pointer_Factors[Key_Index], Pointer_Factors[Key_Index], Number_Challenge);
+			mpz_mod(Pointer_Factors[Key_Index], Pointer_Factors[Key_Index], Pointer_Curve->n);
+		}
+		else
+		{
+			Key_Index = Points_Count;
+			PointCopy(&Pointer_Public_Keys[i], &Pointer_Points[Key_Index]);
+			mpz_mod(Pointer_Factors[Key_Index], Number_Challenge, Pointer_Curve->n);
+			Points_Count++;
+		}
+		
+		mpz_addmul(Pointer_Factors[0], Number_Coefficient, Pointer_Signatures[i].S);
+	}
+	
+	// G has order n, so -sum(a(i).s(i)).G = (n - sum(a(i).s(i)) mod n).G
+	mpz_mod(Pointer_Factors[0], Pointer_Factors[0], Pointer_Curve->n);
+	if (mpz_sgn(Pointer_Factors[0]) != 0) mpz_sub(Pointer_Factors[0], Pointer_Curve->n, Pointer_Factors[0]);
+	
+	// The signatures match if the combination of their equations is the point at infinity
+	if (!ECMultiplicationMultiScalar(Pointer_Curve, Pointer_Points, Pointer_Factors, Points_Count, &Point_Result)) goto Exit;
+	if ((mpz_cmp_ui(Pointer_Curve->h, 1) > 0) && !Point_Result.Is_Infinite) ECMultiplication(Pointer_Curve, &Point_Result, Pointer_Curve->h, &Point_Result);
+	Return_Value = Point_Result.Is_Infinite;
+	
+Exit:
+	// Free resources
+	for (i = 0; i < Allocated_Points_Count; i++)
+	{
+		PointFree(&Pointer_Points[i]);
+		mpz_clear(Pointer_Factors[i]);
+	}
+	free(Pointer_Points);
+	free(Pointer_Factors);
+	mpz_clear(Number_Coefficient);
+	mpz_clear(Number_Challenge);
+	PointFree(&Point_Result);
+	return Return_Value;
+}
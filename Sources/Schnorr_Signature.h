@@ -0,0 +1,86 @@
+/** @file Schnorr_Signature.h
+ * EC-Schnorr signatures (R, s) of message hashes, where R = k.G is the nonce point, s = k + e.x mod n, x is the private key and e the hash of R, of the public key and of the message hash.
+ * The signature carries the whole point R instead of a number derived from it like DSA does, so the verification equation s.G = R + e.Q is linear in the signatures points :
+ * many signatures can be checked at once with a random linear combination of their equations and one multi-scalar multiplication.
+ * The equation is checked multiplied by the curve cofactor, so the small subgroup components of R and Q are ignored the same way by the single and the batch verifications.
+ */
+#ifndef H_SCHNORR_SIGNATURE_H
+#define H_SCHNORR_SIGNATURE_H
+
+#include <gmp.h>
+#include "Elliptic_Curves.h"
+#include "Point.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** The batch verification coefficients are random numbers of this size, an invalid signature passes the batch verification with a probability of 2^-SCHNORR_SIGNATURE_BATCH_COEFFICIENT_BITS. */
+#define SCHNORR_SIGNATURE_BATCH_COEFFICIENT_BITS 128
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A signature. */
+typedef struct
+{
+	TPoint Point_R; //! The nonce point k.G.
+	mpz_t S; //! k + e.x mod n.
+} TSchnorrSignature;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Initialize a signature.
+ * @param Pointer_Signature The signature to create.
+ */
+void SchnorrSignatureCreate(TSchnorrSignature *Pointer_Signature);
+
+/** Free a signature.
+ * @param Pointer_Signature The signature to destroy.
+ */
+void SchnorrSignatureFree(TSchnorrSignature *Pointer_Signature);
+
+/** Sign a message hash with a given nonce.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash, it is reduced modulo n before being hashed with R and Q.
+ * @param Private_Key The signer private key 'x'.
+ * @param Pointer_Point_Public_Key The signer public key Q = x.G.
+ * @param Nonce The random number 'k' in [1, n - 1], it must never be used for another signature.
+ * @param Pointer_Output_Signature On output, contain the signature (it must be created by the user).
+ * @return 1 if the signature was computed or 0 if the challenge could not be hashed.
+ */
+int SchnorrSignatureSignWithNonce(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, TPoint *Pointer_Point_Public_Key, mpz_t Nonce, TSchnorrSignature *Pointer_Output_Signature);
+
+/** Sign a message hash with a random nonce. The random numbers come from UtilsGenerateRandomNumber(), so UtilsInitializeRandomGenerator() must have been called.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash.
+ * @param Private_Key The signer private key 'x'.
+ * @param Pointer_Point_Public_Key The signer public key Q = x.G.
+ * @param Pointer_Output_Signature On output, contain the signature (it must be created by the user).
+ * @return 1 if the signature was computed or 0 if the challenge could not be hashed.
+ */
+int SchnorrSignatureSign(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, mpz_t Private_Key, TPoint *Pointer_Point_Public_Key, TSchnorrSignature *Pointer_Output_Signature);
+
+/** Check a signature : h.(s.G - e.Q - R) must be the point at infinity.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Number_Hash The message hash.
+ * @param Pointer_Point_Public_Key The signer public key.
+ * @param Pointer_Signature The signature.
+ * @return 1 if the signature matches or 0 if the signature or the public key is not valid.
+ */
+int SchnorrSignatureVerify(TEllipticCurve *Pointer_Curve, mpz_t Number_Hash, TPoint *Pointer_Point_Public_Key, TSchnorrSignature *Pointer_Signature);
+
+/** Check many signatures at once : with random coefficients a(i), h.(sum(a(i).R(i)) + sum(a(i).e(i).Q(i)) - sum(a(i).s(i)).G) must be the point at infinity.
+ * The sum is computed with a single multi-scalar multiplication (see ECMultiplicationMultiScalar()), consecutive signatures made with the same public key share its point.
+ * The coefficients come from the OpenSSL generator (see UtilsGenerateSecureRandomBuffer()), a signer knowing them could make the errors of several signatures cancel out. When the batch is
+ * rejected, SchnorrSignatureVerify() tells which signatures are wrong.
+ * @param Pointer_Curve The curve used for calculations.
+ * @param Pointer_Hashes The messages hashes.
+ * @param Pointer_Public_Keys The signers public keys, one per signature.
+ * @param Pointer_Signatures The signatures.
+ * @param Signatures_Count How many signatures there are.
+ * @return 1 if all signatures match or 0 if a signature or a public key is not valid, if there is not enough memory or if no random coefficient could be generated.
+ */
+int SchnorrSignatureVerifyBatch(TEllipticCurve *Pointer_Curve, mpz_t *Pointer_Hashes, TPoint *Pointer_Public_Keys, TSchnorrSignature *Pointer_Signatures, int Signatures_Count);
+
+#endif
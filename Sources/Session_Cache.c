@@ -0,0 +1,254 @@
+/** @file Session_Cache.c
+ * Bounded LRU cache of Diffie-Hellman sessions that can be resumed without doing any scalar multiplication.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "Session_Cache.h"
+#include "Utils.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Private functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+/** Compute the bucket of a ticket. Tickets are random so their first bytes are a good enough hash.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Ticket The ticket.
+ * @return The bucket index.
+ */
+static inline int SessionCacheGetBucket(TSessionCache *Pointer_Cache, unsigned char *Pointer_Ticket)
+{
+	unsigned int Hash;
+	
+	Hash = ((unsigned int) Pointer_Ticket[0] << 24) | ((unsigned int) Pointer_Ticket[1] << 16) | ((unsigned int) Pointer_Ticket[2] << 8) | Pointer_Ticket[3];
+	return Hash % Pointer_Cache->Capacity;
+}
+
+/** Remove an entry from the LRU list.
+ * @param Pointer_Cache The cache.
+ * @param Entry_Index The entry to unlink.
+ */
+static void SessionCacheUnlinkFromList(TSessionCache *Pointer_Cache, int Entry_Index)
+{
+	TSessionCacheEntry *Pointer_Entry = &Pointer_Cache->Pointer_Entries[Entry_Index];
+	
+	if (Pointer_Entry->Previous_Entry != -1) Pointer_Cache->Pointer_Entries[Pointer_Entry->Previous_Entry].Next_Entry = Pointer_Entry->Next_Entry;
+	else Pointer_Cache->Most_Recent_Entry = Pointer_Entry->Next_Entry;
+	
+	if (Pointer_Entry->Next_Entry != -1) Pointer_Cache->Pointer_Entries[Pointer_Entry->Next_Entry].Previous_Entry = Pointer_Entry->Previous_Entry;
+	else Pointer_Cache->Least_Recent_Entry = Pointer_Entry->Previous_Entry;
+}
+
+/** Insert an entry at the head of the LRU list.
+ * @param Pointer_Cache The cache.
+ * @param Entry_Index The entry to mark as the most recently used.
+ */
+static void SessionCacheLinkToListHead(TSessionCache *Pointer_Cache, int Entry_Index)
+{
+	TSessionCacheEntry *Pointer_Entry = &Pointer_Cache->Pointer_Entries[Entry_Index];
+	
+	Pointer_Entry->Previous_Entry = -1;
+	Pointer_Entry->Next_Entry = Pointer_Cache->Most_Recent_Entry;
+	if (Pointer_Cache->Most_Recent_Entry != -1) Pointer_Cache->Pointer_Entries[Pointer_Cache->Most_Recent_Entry].Previous_Entry = Entry_Index;
+	else Pointer_Cache->Least_Recent_Entry = Entry_Index;
+	Pointer_Cache->Most_Recent_Entry = Entry_Index;
+}
+
+/** Remove a session from the cache.
+ * @param Pointer_Cache The cache.
+ * @param Entry_Index The session to remove.
+ */
+static void SessionCacheRemove(TSessionCache *Pointer_Cache, int Entry_Index)
+{
+	TSessionCacheEntry *Pointer_Entry = &Pointer_Cache->Pointer_Entries[Entry_Index];
+	int *Pointer_Link;
+	
+	// Remove the entry from its bucket
+	Pointer_Link = &Pointer_Cache->Pointer_Buckets[SessionCacheGetBucket(Pointer_Cache, Pointer_Entry->Ticket)];
+	while (*Pointer_Link != Entry_Index) Pointer_Link = &Pointer_Cache->Pointer_Entries[*Pointer_Link].Next_Bucket_Entry;
+	*Pointer_Link = Pointer_Entry->Next_Bucket_Entry;
+	
+	SessionCacheUnlinkFromList(Pointer_Cache, Entry_Index);
+	
+	// Do not keep secrets in unused memory
+	memset(Pointer_Entry->Master_Key, 0, SESSION_CACHE_KEY_LENGTH);
+	Pointer_Entry->Is_Used = 0;
+	
+	// Make the entry available again
+	Pointer_Entry->Next_Bucket_Entry = Pointer_Cache->First_Free_Entry;
+	Pointer_Cache->First_Free_Entry = Entry_Index;
+	Pointer_Cache->Entries_Count--;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+// Public functions
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------
+int SessionCacheCreate(TSessionCache *Pointer_Cache, int Capacity, int Lifetime_Seconds)
+{
+	int i;
+	
+	memset(Pointer_Cache, 0, sizeof(TSessionCache));
+	// The buckets count is the capacity, it must not be zero
+	if ((Capacity < 1) || (Lifetime_Seconds < 1)) return 0;
+	
+	Pointer_Cache->Pointer_Entries = calloc(Capacity, sizeof(TSessionCacheEntry));
+	Pointer_Cache->Pointer_Buckets = malloc(Capacity * sizeof(int));
+	if ((Pointer_Cache->Pointer_Entries == NULL) || (Pointer_Cache->Pointer_Buckets == NULL))
+	{
+		SessionCacheFree(Pointer_Cache);
+		return 0;
+	}
+	for (i = 0; i < Capacity; i++)
+	{
+		Pointer_Cache->Pointer_Buckets[i] = -1;
+		// Chain all entries into the free list
+		if (i < Capacity - 1) Pointer_Cache->Pointer_Entries[i].Next_Bucket_Entry = i + 1;
+		else Pointer_Cache->Pointer_Entries[i].Next_Bucket_Entry = -1;
+	}
+	
+	Pointer_Cache->Capacity = Capacity;
+	Pointer_Cache->Most_Recent_Entry = -1;
+	Pointer_Cache->Least_Recent_Entry = -1;
+	Pointer_Cache->First_Free_Entry = 0;
+	Pointer_Cache->Lifetime = (long long) Lifetime_Seconds * 1000000LL;
+	return 1;
+}
+
+void SessionCacheFree(TSessionCache *Pointer_Cache)
+{
+	if (Pointer_Cache->Pointer_Entries != NULL)
+	{
+		memset(Pointer_Cache->Pointer_Entries, 0, Pointer_Cache->Capacity * sizeof(TSessionCacheEntry));
+		free(Pointer_Cache->Pointer_Entries);
+	}
+	free(Pointer_Cache->Pointer_Buckets);
+	Pointer_Cache->Pointer_Entries = NULL;
+	Pointer_Cache->Pointer_Buckets = NULL;
+}
+
+void SessionCacheDeriveMasterKey(mpz_t Shared_Secret, unsigned char *Pointer_Output_Key)
+{
+	char String_Shared_Secret[2048];
+	int Length;
+	
+	// Hash the textual form of the secret, it is independent of the architecture
+	Length = gmp_snprintf(String_Shared_Secret, sizeof(String_Shared_Secret), "%Zx", Shared_Secret);
+	UtilsComputeHash((unsigned char *) String_Shared_Secret, Length, Pointer_Output_Key);
+}
+
+void SessionCacheDeriveResumedKey(unsigned char *Pointer_Master_Key, unsigned char *Pointer_Nonce, unsigned char *Pointer_Output_Key)
+{
+	unsigned char Buffer[SESSION_CACHE_KEY_LENGTH + SESSION_CACHE_NONCE_LENGTH];
+	
+	memcpy(Buffer, Pointer_Master_Key, SESSION_CACHE_KEY_LENGTH);
+	memcpy(Buffer + SESSION_CACHE_KEY_LENGTH, Pointer_Nonce, SESSION_CACHE_NONCE_LENGTH);
+	UtilsComputeHash(Buffer, sizeof(Buffer), Pointer_Output_Key);
+	memset(Buffer, 0, sizeof(Buffer));
+}
+
+int SessionCacheStore(TSessionCache *Pointer_Cache, unsigned char *Pointer_Master_Key, unsigned char *Pointer_Output_Ticket)
+{
+	TSessionCacheEntry *Pointer_Entry;
+	int Entry_Index, Bucket_Index;
+	
+	// Tickets must not be guessable, they are the only credential needed to resume a session
+	if (!UtilsGenerateSecureRandomBuffer(Pointer_Output_Ticket, SESSION_CACHE_TICKET_LENGTH)) return 0;
+	
+	// Make room for the new session
+	if (Pointer_Cache->Entries_Count == Pointer_Cache->Capacity)
+	{
+		Entry_Index = Pointer_Cache->Least_Recent_Entry;
+		// Tell apart sessions that expired from sessions that were still usable
+		if (Pointer_Cache->Pointer_Entries[Entry_Index].Expiration_Time <= UtilsGetTime()) Pointer_Cache->Statistics.Expirations_Count++;
+		else Pointer_Cache->Statistics.Evictions_Count++;
+		SessionCacheRemove(Pointer_Cache, Entry_Index);
+	}
+	
+	// Take a free entry
+	Entry_Index = Pointer_Cache->First_Free_Entry;
+	Pointer_Entry = &Pointer_Cache->Pointer_Entries[Entry_Index];
+	Pointer_Cache->First_Free_Entry = Pointer_Entry->Next_Bucket_Entry;
+	
+	// Fill the session
+	memcpy(Pointer_Entry->Ticket, Pointer_Output_Ticket, SESSION_CACHE_TICKET_LENGTH);
+	memcpy(Pointer_Entry->Master_Key, Pointer_Master_Key, SESSION_CACHE_KEY_LENGTH);
+	Pointer_Entry->Expiration_Time = UtilsGetTime() + Pointer_Cache->Lifetime;
+	Pointer_Entry->Is_Used = 1;
+	
+	// Index it
+	Bucket_Index = SessionCacheGetBucket(Pointer_Cache, Pointer_Entry->Ticket);
+	Pointer_Entry->Next_Bucket_Entry = Pointer_Cache->Pointer_Buckets[Bucket_Index];
+	Pointer_Cache->Pointer_Buckets[Bucket_Index] = Entry_Index;
+	SessionCacheLinkToListHead(Pointer_Cache, Entry_Index);
+	Pointer_Cache->Entries_Count++;
+	return 1;
+}
+
+int SessionCacheLookup(TSessionCache *Pointer_Cache, unsigned char *Pointer_Ticket, unsigned char *Pointer_Output_Master_Key)
+{
+	int Entry_Index;
+	TSessionCacheEntry *Pointer_Entry;
+	
+	// Search the ticket in its bucket
+	Entry_Index = Pointer_Cache->Pointer_Buckets[SessionCacheGetBucket(Pointer_Cache, Pointer_Ticket)];
+	while (Entry_Index != -1)
+	{
+		Pointer_Entry = &Pointer_Cache->Pointer_Entries[Entry_Index];
+		if (memcmp(Pointer_Entry->Ticket, Pointer_Ticket, SESSION_CACHE_TICKET_LENGTH) == 0) break;
+		Entry_Index = Pointer_Entry->Next_Bucket_Entry;
+	}
+	
+	// Unknown ticket
+	if (Entry_Index == -1)
+	{
+		Pointer_Cache->Statistics.Misses_Count++;
+		return 0;
+	}
+	
+	// Expired session
+	if (Pointer_Entry->Expiration_Time <= UtilsGetTime())
+	{
+		SessionCacheRemove(Pointer_Cache, Entry_Index);
+		Pointer_Cache->Statistics.Expirations_Count++;
+		Pointer_Cache->Statistics.Misses_Count++;
+		return 0;
+	}
+	
+	// The session becomes the most recently used one
+	SessionCacheUnlinkFromList(Pointer_Cache, Entry_Index);
+	SessionCacheLinkToListHead(Pointer_Cache, Entry_Index);
+	
+	memcpy(Pointer_Output_Master_Key, Pointer_Entry->Master_Key, SESSION_CACHE_KEY_LENGTH);
+	Pointer_Cache->Statistics.Hits_Count++;
+	return 1;
+}
+
+void SessionCacheAccountFullExchange(TSessionCache *Pointer_Cache, long long Duration)
+{
+	Pointer_Cache->Full_Exchanges_Count++;
+	Pointer_Cache->Full_Exchanges_Total_Time += Duration;
+}
+
+void SessionCacheAccountResumption(TSessionCache *Pointer_Cache, long long Duration)
+{
+	long long Full_Exchange_Average_Time;
+	
+	// Nothing can be estimated until a full exchange has been timed
+	if (Pointer_Cache->Full_Exchanges_Count == 0) return;
+	
+	Full_Exchange_Average_Time = Pointer_Cache->Full_Exchanges_Total_Time / (long long) Pointer_Cache->Full_Exchanges_Count;
+	if (Full_Exchange_Average_Time > Duration) Pointer_Cache->Statistics.Saved_Time += Full_Exchange_Average_Time - Duration;
+}
+
+void SessionCacheGetStatistics(TSessionCache *Pointer_Cache, TSessionCacheStatistics *Pointer_Output_Statistics)
+{
+	unsigned long long Lookups_Count;
+	
+	*Pointer_Output_Statistics = Pointer_Cache->Statistics;
+	
+	Lookups_Count = Pointer_Cache->Statistics.Hits_Count + Pointer_Cache->Statistics.Misses_Count;
+	if (Lookups_Count > 0) Pointer_Output_Statistics->Hit_Rate = (double) Pointer_Cache->Statistics.Hits_Count / Lookups_Count;
+	else Pointer_Output_Statistics->Hit_Rate = 0;
+	
+	if (Pointer_Cache->Full_Exchanges_Count > 0) Pointer_Output_Statistics->Full_Exchange_Average_Time = Pointer_Cache->Full_Exchanges_Total_Time / (long long) Pointer_Cache->Full_Exchanges_Count;
+	else Pointer_Output_Statistics->Full_Exchange_Average_Time = 0;
+}
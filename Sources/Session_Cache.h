@@ -0,0 +1,126 @@
+/** @file Session_Cache.h
+ * Bounded LRU cache of Diffie-Hellman sessions that can be resumed without doing any scalar multiplication.
+ */
+#ifndef H_SESSION_CACHE_H
+#define H_SESSION_CACHE_H
+
+#include <gmp.h>
+#include "Utils.h"
+
+//--------------------------------------------------------------------------------------------------------
+// Constants
+//--------------------------------------------------------------------------------------------------------
+/** Length in bytes of a session ticket. */
+#define SESSION_CACHE_TICKET_LENGTH 16
+/** Length in bytes of a session key (master key or resumed key). */
+#define SESSION_CACHE_KEY_LENGTH UTILS_HASH_LENGTH
+/** Length in bytes of the nonce sent by the client when resuming a session. */
+#define SESSION_CACHE_NONCE_LENGTH 16
+
+//--------------------------------------------------------------------------------------------------------
+// Types
+//--------------------------------------------------------------------------------------------------------
+/** A cached session. */
+typedef struct
+{
+	unsigned char Ticket[SESSION_CACHE_TICKET_LENGTH]; //! The ticket given to the client.
+	unsigned char Master_Key[SESSION_CACHE_KEY_LENGTH]; //! The key derived from the shared point.
+	long long Expiration_Time; //! When the session will become unusable (in microseconds, see UtilsGetTime()).
+	int Previous_Entry; //! More recently used entry index (or -1).
+	int Next_Entry; //! Less recently used entry index (or -1).
+	int Next_Bucket_Entry; //! Next entry in the same hash bucket, or next free entry if the entry is unused (or -1).
+	char Is_Used; //! Tell if the entry contains a session or not.
+} TSessionCacheEntry;
+
+/** Cache usage statistics. */
+typedef struct
+{
+	unsigned long long Hits_Count; //! How many sessions were resumed.
+	unsigned long long Misses_Count; //! How many tickets were unknown or expired.
+	unsigned long long Expirations_Count; //! How many sessions were dropped because they were too old.
+	unsigned long long Evictions_Count; //! How many sessions were dropped because the cache was full.
+	double Hit_Rate; //! Hits count divided by lookups count (0 if there was no lookup).
+	long long Full_Exchange_Average_Time; //! Average duration of a full key exchange in microseconds.
+	long long Saved_Time; //! Total time saved by resumed sessions in microseconds.
+} TSessionCacheStatistics;
+
+/** A sessions cache. */
+typedef struct
+{
+	TSessionCacheEntry *Pointer_Entries; //! All sessions.
+	int *Pointer_Buckets; //! First entry index of each hash bucket (or -1).
+	int Capacity; //! Maximum amount of sessions.
+	int Entries_Count; //! Amount of stored sessions.
+	int Most_Recent_Entry; //! Head of the LRU list (or -1).
+	int Least_Recent_Entry; //! Tail of the LRU list (or -1).
+	int First_Free_Entry; //! Head of the unused entries list (or -1).
+	long long Lifetime; //! How long a session can be resumed in microseconds.
+	unsigned long long Full_Exchanges_Count; //! How many full key exchanges were timed.
+	long long Full_Exchanges_Total_Time; //! Sum of all timed full key exchanges durations.
+	TSessionCacheStatistics Statistics; //! Usage statistics.
+} TSessionCache;
+
+//--------------------------------------------------------------------------------------------------------
+// Functions
+//--------------------------------------------------------------------------------------------------------
+/** Create an empty cache.
+ * @param Pointer_Cache The cache to initialize.
+ * @param Capacity Maximum amount of simultaneous sessions.
+ * @param Lifetime_Seconds How long a session can be resumed after it was created.
+ * @return 1 if the cache was successfully created or 0 if a parameter is lower than 1 or if there is not enough memory.
+ */
+int SessionCacheCreate(TSessionCache *Pointer_Cache, int Capacity, int Lifetime_Seconds);
+
+/** Free all cache resources.
+ * @param Pointer_Cache The cache to destroy.
+ */
+void SessionCacheFree(TSessionCache *Pointer_Cache);
+
+/** Derive a session master key from a Diffie-Hellman shared secret.
+ * @param Shared_Secret The X coordinate of the shared point.
+ * @param Pointer_Output_Key On output, contain the master key (the buffer must be SESSION_CACHE_KEY_LENGTH bytes long).
+ */
+void SessionCacheDeriveMasterKey(mpz_t Shared_Secret, unsigned char *Pointer_Output_Key);
+
+/** Derive the key of a resumed session, so each resumed connection uses a different key.
+ * @param Pointer_Master_Key The master key of the session.
+ * @param Pointer_Nonce The client nonce (SESSION_CACHE_NONCE_LENGTH bytes).
+ * @param Pointer_Output_Key On output, contain the session key (the buffer must be SESSION_CACHE_KEY_LENGTH bytes long).
+ */
+void SessionCacheDeriveResumedKey(unsigned char *Pointer_Master_Key, unsigned char *Pointer_Nonce, unsigned char *Pointer_Output_Key);
+
+/** Store a new session and issue its ticket. The least recently used session is evicted if the cache is full.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Master_Key The session master key.
+ * @param Pointer_Output_Ticket On output, contain the ticket to give to the client (SESSION_CACHE_TICKET_LENGTH bytes).
+ * @return 1 if the session was stored or 0 if no random ticket could be generated.
+ */
+int SessionCacheStore(TSessionCache *Pointer_Cache, unsigned char *Pointer_Master_Key, unsigned char *Pointer_Output_Ticket);
+
+/** Retrieve a session from its ticket.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Ticket The ticket sent by the client.
+ * @param Pointer_Output_Master_Key On output, contain the session master key if the session was found.
+ * @return 1 if the session can be resumed or 0 if the ticket is unknown or expired.
+ */
+int SessionCacheLookup(TSessionCache *Pointer_Cache, unsigned char *Pointer_Ticket, unsigned char *Pointer_Output_Master_Key);
+
+/** Tell the cache how long a full key exchange took, so saved time can be estimated.
+ * @param Pointer_Cache The cache.
+ * @param Duration Full key exchange duration in microseconds.
+ */
+void SessionCacheAccountFullExchange(TSessionCache *Pointer_Cache, long long Duration);
+
+/** Tell the cache how long a resumed session handshake took.
+ * @param Pointer_Cache The cache.
+ * @param Duration Resumed handshake duration in microseconds.
+ */
+void SessionCacheAccountResumption(TSessionCache *Pointer_Cache, long long Duration);
+
+/** Get the cache usage statistics.
+ * @param Pointer_Cache The cache.
+ * @param Pointer_Output_Statistics On output, contain the statistics.
+ */
+void SessionCacheGetStatistics(TSessionCache *Pointer_Cache, TSessionCacheStatistics *Pointer_Output_Statistics);
+
+#endif
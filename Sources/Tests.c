@@ -1,15 +1,54 @@
 /** @file Main.c
  */
+#include <sys/stat.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include <gmp.h>
+#include "Curves_Registry.h"
+#include "DSA_Signature.h"
+#include "ElGamal_Exponential.h"
 #include "Elliptic_Curves.h"
+#include "Elliptic_Curves_Binary.h"
+#include "Elliptic_Curves_Models.h"
+#include "Encodings.h"
+#include "Field_Lanes.h"
+#include "Modular_Inversion.h"
 #include "Point.h"
+#include "Protocols.h"
+#include "Scalar_Field.h"
+#include "Schnorr_Signature.h"
+#include "Session_Cache.h"
+#include "Utils.h"
 
 int main(void)
 {
-	TEllipticCurve Curve;
+	TEllipticCurve Curve, Curve_P256, Curve_Edwards, Curve_Montgomery, Curve_Secp256k1, Curve_Binary, *Pointer_Curves[3];
 	TPoint A, B, C;
-	mpz_t Number;
+	TPrecomputedTable Table;
+	TECMapToCurve Map;
+	TElGamalExponentialTable ElGamal_Table;
+	TElGamalExponentialCiphertext Ciphertext_A, Ciphertext_B;
+	TPoint Public_Keys[16];
+	TSchnorrSignature Schnorr_Signatures[16];
+	TEncodingSignatureParser Parser;
+	TEncodingSignatureView View;
+	uint64_t Messages[4] = {1234, 4321, 0, 65535}, Decrypted_Message;
+	mpz_t Number, Hashes[16], Nonces[16], Numbers_U[16], Numbers_V[16];
+	int i, j, Method;
+	TFieldLanesModulus Modulus;
+	TFieldLanesElement Element_A, Element_B;
+	TScalar Scalar_A, Scalar_B, Scalar_C;
+	unsigned char Private_Key_Alice[32], Public_Key_Alice[64], Private_Key_Bob[32], Public_Key_Bob[64], Secret_Alice[32], Secret_Bob[32], Message[32], C1[32], C2[32], Signature[64];
+	unsigned char DER_Signatures[16 * ENCODING_MAXIMUM_DER_SIGNATURE_SIZE], Raw_Signatures[16 * 64], Public_Key[ENCODING_MAXIMUM_SEC1_PUBLIC_KEY_SIZE];
+	unsigned char DER_Expected_Signature[9] = {0x30, 0x07, 0x02, 0x01, 0x01, 0x02, 0x02, 0x00, 0x80}, DER_Non_Minimal_Signature[10] = {0x30, 0x08, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x00, 0x80};
+	size_t Size, DER_Size;
+	TSessionCache Sessions_Cache;
+	unsigned char Tickets[3][SESSION_CACHE_TICKET_LENGTH], Master_Keys[3][SESSION_CACHE_KEY_LENGTH], Session_Keys[2][SESSION_CACHE_KEY_LENGTH], Nonce[SESSION_CACHE_NONCE_LENGTH];
+	struct stat File_Status;
+	FILE *File;
+	uint32_t Limb_Size;
 	
 	printf("--- TESTS ---\n");
 	
@@ -63,5 +102,560 @@ int main(void)
 	}	
 	printf("SUCCESS\n\n");
 	
+	// Test multiplying by a scalar with precomputed multiples
+	printf("Multiplying by a scalar with a precomputed table : (expected value is X = 3, Y = 4)\n");
+	ECPrecomputeTable(&Curve, &A, 4, &Table);
+	ECMultiplicationWithTable(&Curve, &Table, Number, &C);
+	ECFreePrecomputedTable(&Table);
+	PointShow(&C);
+	// Check values
+	if ((mpz_cmp_ui(C.X, 3) != 0) || (mpz_cmp_ui(C.Y, 4) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test batch signing
+	printf("Signing a batch of hashes : (expected values are the ones of the single hash signer)\n");
+	if (!CurvesRegistryLoad("P-256", &Curve_P256))
+	{
+		printf("Error : can't load built-in curve.\n");
+		return -1;
+	}
+	UtilsInitializeRandomGenerator();
+	UtilsGenerateRandomNumber(Curve_P256.n, Number); // Private key
+	for (i = 0; i < 16; i++)
+	{
+		mpz_init(Hashes[i]);
+		mpz_init(Nonces[i]);
+		mpz_init(Numbers_U[i]);
+		mpz_init(Numbers_V[i]);
+		UtilsGenerateRandomNumber(Curve_P256.n, Hashes[i]);
+		UtilsGenerateRandomNumber(Curve_P256.n, Nonces[i]);
+	}
+	DSASignatureSignBatchWithNonces(&Curve_P256, Hashes, 16, Number, Nonces, Numbers_U, Numbers_V);
+	// Check values
+	for (i = 0; i < 16; i++)
+	{
+		DSASignatureSignWithNonce(&Curve_P256, Hashes[i], Number, Nonces[i], C.X, C.Y);
+		if ((mpz_cmp(C.X, Numbers_U[i]) != 0) || (mpz_cmp(C.Y, Numbers_V[i]) != 0))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the vectorized field arithmetic with both multiplication implementations (the first factors of the batch are reused as field elements)
+	printf("Multiplying field elements in lanes : (expected values are the GMP products)\n");
+	for (i = 0; i <= 1; i++)
+	{
+		if (!FieldLanesPrepareModulus(Curve_P256.p, i, &Modulus))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		FieldLanesImport(&Modulus, Hashes, &Element_A);
+		FieldLanesImport(&Modulus, Nonces, &Element_B);
+		FieldLanesMultiply(&Modulus, &Element_A, &Element_B, &Element_A);
+		FieldLanesExport(&Modulus, &Element_A, Numbers_U);
+		for (j = 0; j < FIELD_LANES_COUNT; j++)
+		{
+			mpz_mul(Number, Hashes[j], Nonces[j]);
+			mpz_mod(Number, Number, Curve_P256.p);
+			if (mpz_cmp(Number, Numbers_U[j]) != 0)
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+		}
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the scalar arithmetic against GMP (the last check imports a number much longer than n^2)
+	printf("Computing modulo the group order : (expected values are the GMP results)\n");
+	for (i = 0; i < 16; i++)
+	{
+		ScalarFieldImport(&Curve_P256.Scalar_Field, Hashes[i], &Scalar_A);
+		ScalarFieldImport(&Curve_P256.Scalar_Field, Nonces[i], &Scalar_B);
+		ScalarFieldMultiply(&Curve_P256.Scalar_Field, &Scalar_A, &Scalar_B, &Scalar_C);
+		ScalarFieldAdd(&Curve_P256.Scalar_Field, &Scalar_C, &Scalar_A, &Scalar_C);
+		ScalarFieldSubtract(&Curve_P256.Scalar_Field, &Scalar_C, &Scalar_B, &Scalar_C);
+		ScalarFieldInvert(&Curve_P256.Scalar_Field, &Scalar_C, &Scalar_C);
+		ScalarFieldExport(&Curve_P256.Scalar_Field, &Scalar_C, Numbers_U[i]);
+		mpz_mul(Number, Hashes[i], Nonces[i]);
+		mpz_add(Number, Number, Hashes[i]);
+		mpz_sub(Number, Number, Nonces[i]);
+		mpz_invert(Number, Number, Curve_P256.n);
+		if (mpz_cmp(Number, Numbers_U[i]) != 0)
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	mpz_ui_pow_ui(Number, 3, 1000);
+	ScalarFieldImport(&Curve_P256.Scalar_Field, Number, &Scalar_A);
+	ScalarFieldExport(&Curve_P256.Scalar_Field, &Scalar_A, Numbers_U[0]);
+	mpz_mod(Number, Number, Curve_P256.n);
+	if (mpz_cmp(Number, Numbers_U[0]) != 0)
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test every inversion method modulo both P-256 primes, then safegcd modulo the composite order of the test curve
+	printf("Inverting with every method : (expected values are the mpz_invert() results)\n");
+	for (Method = 0; Method < MODULAR_INVERSION_METHODS_COUNT; Method++)
+	{
+		for (i = 0; i < 16; i++)
+		{
+			mpz_invert(Number, Hashes[i], Curve_P256.n);
+			if (!ModularInversionInvertNumber(&Curve_P256.Scalar_Field.Inversion, Method, Hashes[i], Numbers_U[i]) || (mpz_cmp(Number, Numbers_U[i]) != 0))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+			mpz_mod(Numbers_V[i], Hashes[i], Curve_P256.p);
+			mpz_invert(Number, Numbers_V[i], Curve_P256.p);
+			if (!ModularInversionInvertNumber(&Curve_P256.Field_Inversion, Method, Numbers_V[i], Numbers_V[i]) || (mpz_cmp(Number, Numbers_V[i]) != 0))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+		}
+	}
+	mpz_set_ui(Numbers_V[0], 1000);
+	mpz_invert(Number, Numbers_V[0], Curve.n);
+	if (!ModularInversionInvertNumber(&Curve.Scalar_Field.Inversion, MODULAR_INVERSION_METHOD_SAFEGCD, Numbers_V[0], Numbers_U[0]) || (mpz_cmp(Number, Numbers_U[0]) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the protocols library
+	printf("Running the library protocols : (expected values are the same shared secrets, the decrypted message and a matching signature)\n");
+	if (!ProtocolGenerateKeys(&Curve_P256, Private_Key_Alice, Public_Key_Alice) || !ProtocolGenerateKeys(&Curve_P256, Private_Key_Bob, Public_Key_Bob))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// Diffie-Hellman
+	if (!ProtocolDiffieHellmanComputeSharedSecret(&Curve_P256, Private_Key_Alice, Public_Key_Bob, Secret_Alice) || !ProtocolDiffieHellmanComputeSharedSecret(&Curve_P256, Private_Key_Bob, Public_Key_Alice, Secret_Bob)
+		|| (memcmp(Secret_Alice, Secret_Bob, sizeof(Secret_Alice)) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// ElGamal
+	memcpy(Message, Secret_Alice, sizeof(Message)); // Any number lower than p
+	if (!ProtocolElGamalEncrypt(&Curve_P256, Public_Key_Alice, Message, C1, C2) || !ProtocolElGamalDecrypt(&Curve_P256, Private_Key_Alice, C1, C2, Secret_Bob)
+		|| (memcmp(Message, Secret_Bob, sizeof(Message)) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// DSA, a modified message must be rejected
+	if (!ProtocolDSASign(&Curve_P256, Private_Key_Alice, Message, sizeof(Message), Signature) || !ProtocolDSAVerify(&Curve_P256, NULL, Public_Key_Alice, Message, sizeof(Message), Signature))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	Message[0] ^= 1;
+	if (ProtocolDSAVerify(&Curve_P256, NULL, Public_Key_Alice, Message, sizeof(Message), Signature))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test twisted Edwards and Montgomery curves against their Weierstrass equivalent
+	printf("Using twisted Edwards and Montgomery curves :\n");
+	if (!ECLoadFromFile("../Curves/Ed25519.gp", &Curve_Edwards) || !ECLoadFromFile("../Curves/Curve25519.gp", &Curve_Montgomery))
+	{
+		printf("Error : can't load curve file.\n");
+		return -1;
+	}
+	mpz_set_str(Number, "1234567890123456789012345678901234567890", 10);
+	// k.G computed with the Edwards ladder must match the Weierstrass multiplication
+	ECModelsPointFromWeierstrass(&Curve_Edwards, &Curve_Edwards.Point_Generator, &A);
+	if (!ECModelsEdwardsMultiplication(&Curve_Edwards, &A, Number, &B))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	ECModelsPointToWeierstrass(&Curve_Edwards, &B, &B);
+	ECMultiplicationGenerator(&Curve_Edwards, Number, &C);
+	if (!ECModelsIsPointOnCurve(&Curve_Edwards, &A) || (mpz_cmp(B.X, C.X) != 0) || (mpz_cmp(B.Y, C.Y) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// G + G = 2.G and n.G is the neutral element (0, 1)
+	mpz_set_ui(Number, 2);
+	if (!ECModelsEdwardsAddition(&Curve_Edwards, &A, &A, &B) || !ECModelsEdwardsMultiplication(&Curve_Edwards, &A, Number, &C) || (mpz_cmp(B.X, C.X) != 0) || (mpz_cmp(B.Y, C.Y) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	if (!ECModelsEdwardsMultiplication(&Curve_Edwards, &A, Curve_Edwards.n, &B) || (mpz_cmp_ui(B.X, 0) != 0) || (mpz_cmp_ui(B.Y, 1) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// The X25519 ladder must match the Weierstrass multiplication
+	mpz_set_str(Number, "9876543210987654321098765432109876543210", 10);
+	ECMultiplicationGenerator(&Curve_Montgomery, Number, &C);
+	// The Weierstrass X-only multiplication goes through the Montgomery ladder on this curve
+	if (!ECMultiplicationXOnly(&Curve_Montgomery, Curve_Montgomery.Point_Generator.X, Number, B.X) || (mpz_cmp(B.X, C.X) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	ECModelsPointFromWeierstrass(&Curve_Montgomery, &C, &C);
+	ECModelsPointFromWeierstrass(&Curve_Montgomery, &Curve_Montgomery.Point_Generator, &A);
+	if ((mpz_cmp_ui(A.X, 9) != 0) || !ECModelsMontgomeryLadder(&Curve_Montgomery, A.X, Number, Number) || (mpz_cmp(Number, C.X) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the map to curve with p = 3 mod 4, with the 3-isogeny of an a4 = 0 curve and with p = 1 mod 4 (the hashed points must belong to the generator subgroup)
+	printf("Mapping field elements to curve points : (expected values are points on the curves and the RFC 9380 P-256 Z = -10)\n");
+	if (!ECLoadFromFile("../Curves/secp256k1.gp", &Curve_Secp256k1))
+	{
+		printf("Error : can't load curve file.\n");
+		return -1;
+	}
+	Pointer_Curves[0] = &Curve_P256;
+	Pointer_Curves[1] = &Curve_Secp256k1;
+	Pointer_Curves[2] = &Curve_Montgomery;
+	for (j = 0; j < 3; j++)
+	{
+		if (!ECPrepareMapToCurve(Pointer_Curves[j], &Map))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		mpz_add_ui(Number, Map.Z, 10);
+		if ((j == 0) && (mpz_cmp(Number, Curve_P256.p) != 0))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		for (i = 0; i < 16; i++)
+		{
+			mpz_mod(Number, Hashes[i], Pointer_Curves[j]->p);
+			ECMapToCurve(Pointer_Curves[j], &Map, Number, &A);
+			Message[0] = i;
+			if (!ECIsPointOnCurve(Pointer_Curves[j], &A) || !ECHashToCurve(Pointer_Curves[j], &Map, Message, sizeof(Message), &B) || !ECIsPublicKeyValid(Pointer_Curves[j], &B))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+		}
+		ECFreeMapToCurve(&Map);
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test exponential ElGamal with a small table (messages below 2^16), the sum of two ciphertexts must decrypt to the sum of the messages and a too large message must be rejected
+	printf("Adding exponential ElGamal ciphertexts : (expected values are the messages sum, the range bounds and a rejected out of range message)\n");
+	mpz_set_ui(Number, 987654321);
+	ECMultiplicationGenerator(&Curve_P256, Number, &A);
+	ElGamalExponentialCreateCiphertext(&Ciphertext_A);
+	ElGamalExponentialCreateCiphertext(&Ciphertext_B);
+	if (!ElGamalExponentialCreateTableFile(&Curve_P256, "ElGamal_Test_Table.bin", 6, 16) || !ElGamalExponentialLoadTable(&Curve_P256, "ElGamal_Test_Table.bin", &ElGamal_Table))
+	{
+		printf("Error : can't create the table file.\n");
+		return -1;
+	}
+	remove("ElGamal_Test_Table.bin"); // The mapping stays valid
+	if (!ElGamalExponentialEncrypt(&Curve_P256, &A, Messages[0], &Ciphertext_A) || !ElGamalExponentialEncrypt(&Curve_P256, &A, Messages[1], &Ciphertext_B))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	ElGamalExponentialAdd(&Curve_P256, &Ciphertext_A, &Ciphertext_B, &Ciphertext_A);
+	if (!ElGamalExponentialDecrypt(&Curve_P256, &ElGamal_Table, Number, &Ciphertext_A, &Decrypted_Message) || (Decrypted_Message != Messages[0] + Messages[1]))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	for (i = 2; i < 4; i++)
+	{
+		if (!ElGamalExponentialEncrypt(&Curve_P256, &A, Messages[i], &Ciphertext_A) || !ElGamalExponentialDecrypt(&Curve_P256, &ElGamal_Table, Number, &Ciphertext_A, &Decrypted_Message) || (Decrypted_Message != Messages[i]))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	if (!ElGamalExponentialEncrypt(&Curve_P256, &A, 1 << 20, &Ciphertext_A) || ElGamalExponentialDecrypt(&Curve_P256, &ElGamal_Table, Number, &Ciphertext_A, &Decrypted_Message))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	ElGamalExponentialFreeCiphertext(&Ciphertext_A);
+	ElGamalExponentialFreeCiphertext(&Ciphertext_B);
+	ElGamalExponentialFreeTable(&ElGamal_Table);
+	printf("SUCCESS\n\n");
+	
+	// Test Schnorr signatures on a prime order curve and on a curve with a cofactor, two signers share the batch
+	printf("Verifying Schnorr signatures by batches : (expected values are accepted signatures, then rejected ones once a signature is altered or two signatures are altered by opposite amounts)\n");
+	Pointer_Curves[0] = &Curve_P256;
+	Pointer_Curves[1] = &Curve_Edwards;
+	for (i = 0; i < 16; i++)
+	{
+		PointCreate(0, 0, &Public_Keys[i]);
+		SchnorrSignatureCreate(&Schnorr_Signatures[i]);
+	}
+	for (j = 0; j < 2; j++)
+	{
+		for (i = 0; i < 16; i++)
+		{
+			// Private keys are 1000 and 1001
+			mpz_set_ui(Number, 1000 + i / 8);
+			ECMultiplicationGenerator(Pointer_Curves[j], Number, &Public_Keys[i]);
+			if (!SchnorrSignatureSign(Pointer_Curves[j], Hashes[i], Number, &Public_Keys[i], &Schnorr_Signatures[i]) || !SchnorrSignatureVerify(Pointer_Curves[j], Hashes[i], &Public_Keys[i], &Schnorr_Signatures[i]))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+		}
+		if (!SchnorrSignatureVerifyBatch(Pointer_Curves[j], Hashes, Public_Keys, Schnorr_Signatures, 16))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		mpz_add_ui(Schnorr_Signatures[5].S, Schnorr_Signatures[5].S, 1);
+		if (SchnorrSignatureVerify(Pointer_Curves[j], Hashes[5], &Public_Keys[5], &Schnorr_Signatures[5]) || SchnorrSignatureVerifyBatch(Pointer_Curves[j], Hashes, Public_Keys, Schnorr_Signatures, 16))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		
+		// Two errors cancelling each other are caught because the coefficients can't be guessed
+		mpz_sub_ui(Schnorr_Signatures[5].S, Schnorr_Signatures[5].S, 1);
+		mpz_add_ui(Schnorr_Signatures[2].S, Schnorr_Signatures[2].S, 12345);
+		mpz_mod(Schnorr_Signatures[2].S, Schnorr_Signatures[2].S, Pointer_Curves[j]->n);
+		mpz_sub_ui(Schnorr_Signatures[3].S, Schnorr_Signatures[3].S, 12345);
+		mpz_mod(Schnorr_Signatures[3].S, Schnorr_Signatures[3].S, Pointer_Curves[j]->n);
+		if (SchnorrSignatureVerifyBatch(Pointer_Curves[j], Hashes, Public_Keys, Schnorr_Signatures, 16))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	for (i = 0; i < 16; i++)
+	{
+		PointFree(&Public_Keys[i]);
+		SchnorrSignatureFree(&Schnorr_Signatures[i]);
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the signatures encodings with a known DER vector and round trips of DSA signatures, then the keys encodings (Ed25519 has p = 5 mod 8)
+	printf("Encoding keys and signatures : (expected values are the DER vector, the original signatures and keys, then rejected malformed ones)\n");
+	mpz_set_ui(Numbers_U[0], 1);
+	mpz_set_ui(Numbers_V[0], 0x80);
+	if ((EncodingExportDERSignature(Numbers_U[0], Numbers_V[0], DER_Signatures, sizeof(DER_Signatures)) != sizeof(DER_Expected_Signature)) || (memcmp(DER_Signatures, DER_Expected_Signature, sizeof(DER_Expected_Signature)) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	mpz_set_ui(Number, 1000);
+	DSASignatureSignBatchWithNonces(&Curve_P256, Hashes, 16, Number, Nonces, Numbers_U, Numbers_V);
+	DER_Size = 0;
+	for (i = 0; i < 16; i++)
+	{
+		Size = EncodingExportDERSignature(Numbers_U[i], Numbers_V[i], DER_Signatures + DER_Size, sizeof(DER_Signatures) - DER_Size);
+		if ((Size == 0) || !EncodingExportRawSignature(&Curve_P256, Numbers_U[i], Numbers_V[i], Raw_Signatures + i * 64))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		DER_Size += Size;
+	}
+	// Walk the DER signatures one by one and convert the raw ones in a single batch
+	EncodingSignatureParserInitialize(&Curve_P256, ENCODING_SIGNATURE_FORMAT_DER, DER_Signatures, DER_Size, &Parser);
+	for (i = 0; i < 16; i++)
+	{
+		if (!EncodingSignatureParserNext(&Parser, &View))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		EncodingImportSignatureView(&View, C.X, C.Y);
+		if ((mpz_cmp(C.X, Numbers_U[i]) != 0) || (mpz_cmp(C.Y, Numbers_V[i]) != 0))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	if (EncodingSignatureParserNext(&Parser, &View) || Parser.Is_Malformed)
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	EncodingSignatureParserInitialize(&Curve_P256, ENCODING_SIGNATURE_FORMAT_RAW, Raw_Signatures, sizeof(Raw_Signatures), &Parser);
+	if (EncodingSignatureParserNextBatch(&Parser, Hashes, Nonces, 16) != 16)
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	for (i = 0; i < 16; i++)
+	{
+		if ((mpz_cmp(Hashes[i], Numbers_U[i]) != 0) || (mpz_cmp(Nonces[i], Numbers_V[i]) != 0))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+	}
+	// The parser must stop on the malformed signature following a valid one
+	memcpy(DER_Signatures, DER_Expected_Signature, sizeof(DER_Expected_Signature));
+	memcpy(DER_Signatures + sizeof(DER_Expected_Signature), DER_Non_Minimal_Signature, sizeof(DER_Non_Minimal_Signature));
+	EncodingSignatureParserInitialize(&Curve_P256, ENCODING_SIGNATURE_FORMAT_DER, DER_Signatures, sizeof(DER_Expected_Signature) + sizeof(DER_Non_Minimal_Signature), &Parser);
+	if (!EncodingSignatureParserNext(&Parser, &View) || EncodingSignatureParserNext(&Parser, &View) || !Parser.Is_Malformed || (Parser.Offset != sizeof(DER_Expected_Signature)))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	Pointer_Curves[0] = &Curve_P256;
+	Pointer_Curves[1] = &Curve_Secp256k1;
+	Pointer_Curves[2] = &Curve_Edwards;
+	for (j = 0; j < 3; j++)
+	{
+		for (i = 0; i < 16; i++)
+		{
+			mpz_set_ui(Number, 1000 + i);
+			ECMultiplicationGenerator(Pointer_Curves[j], Number, &A);
+			if (!EncodingExportPrivateKey(Pointer_Curves[j], Number, Public_Key) || !EncodingImportPrivateKey(Pointer_Curves[j], Public_Key, Number) || (mpz_cmp_ui(Number, 1000 + i) != 0))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+			// Alternate the compressed and uncompressed forms, an altered Y must be rejected
+			Size = EncodingExportSEC1PublicKey(Pointer_Curves[j], &A, i & 1, Public_Key);
+			if ((Size == 0) || !EncodingImportSEC1PublicKey(Pointer_Curves[j], Public_Key, Size, &B) || (mpz_cmp(A.X, B.X) != 0) || (mpz_cmp(A.Y, B.Y) != 0))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+			Public_Key[Size - 1] ^= 1;
+			if (!(i & 1) && EncodingImportSEC1PublicKey(Pointer_Curves[j], Public_Key, Size, &B))
+			{
+				printf("FAILED\n");
+				return 0;
+			}
+		}
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the sessions cache with 2 entries, so the third session evicts the least recently used one
+	printf("Caching sessions : (expected values are a hit, a miss on an unknown ticket, a miss on an expired ticket, the eviction of the least recently used session and nonce-dependent resumed keys)\n");
+	if (SessionCacheCreate(&Sessions_Cache, 0, 60) || !SessionCacheCreate(&Sessions_Cache, 2, 60))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	for (i = 0; i < 3; i++) memset(Master_Keys[i], i + 1, SESSION_CACHE_KEY_LENGTH);
+	if (!SessionCacheStore(&Sessions_Cache, Master_Keys[0], Tickets[0]) || !SessionCacheLookup(&Sessions_Cache, Tickets[0], Session_Keys[0]) || (memcmp(Session_Keys[0], Master_Keys[0], SESSION_CACHE_KEY_LENGTH) != 0))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	memcpy(Tickets[1], Tickets[0], SESSION_CACHE_TICKET_LENGTH);
+	Tickets[1][SESSION_CACHE_TICKET_LENGTH - 1] ^= 1;
+	if (SessionCacheLookup(&Sessions_Cache, Tickets[1], Session_Keys[0]))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// Touch the first session after the second one was stored, so the second one is evicted by the third one
+	if (!SessionCacheStore(&Sessions_Cache, Master_Keys[1], Tickets[1]) || !SessionCacheLookup(&Sessions_Cache, Tickets[0], Session_Keys[0]) || !SessionCacheStore(&Sessions_Cache, Master_Keys[2], Tickets[2]))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	if (SessionCacheLookup(&Sessions_Cache, Tickets[1], Session_Keys[0]) || !SessionCacheLookup(&Sessions_Cache, Tickets[0], Session_Keys[0]) || !SessionCacheLookup(&Sessions_Cache, Tickets[2], Session_Keys[0]) || (memcmp(Session_Keys[0], Master_Keys[2], SESSION_CACHE_KEY_LENGTH) != 0) || (Sessions_Cache.Statistics.Evictions_Count != 1))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	// Expire the next sessions as soon as they are stored instead of waiting for the minimum lifetime
+	Sessions_Cache.Lifetime = 0;
+	if (!SessionCacheStore(&Sessions_Cache, Master_Keys[1], Tickets[1]) || SessionCacheLookup(&Sessions_Cache, Tickets[1], Session_Keys[0]) || (Sessions_Cache.Statistics.Expirations_Count != 1) || (Sessions_Cache.Statistics.Misses_Count != 3))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	SessionCacheFree(&Sessions_Cache);
+	memset(Nonce, 0, sizeof(Nonce));
+	SessionCacheDeriveResumedKey(Master_Keys[0], Nonce, Session_Keys[0]);
+	Nonce[0] = 1;
+	SessionCacheDeriveResumedKey(Master_Keys[0], Nonce, Session_Keys[1]);
+	if (memcmp(Session_Keys[0], Session_Keys[1], SESSION_CACHE_KEY_LENGTH) == 0)
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	printf("SUCCESS\n\n");
+	
+	// Test the binary curve files with and without the generator table, then truncated and corrupted files
+	printf("Saving and loading binary curve files : (expected values are the original parameters and generator multiple, then rejected truncated and corrupted files)\n");
+	mpz_set_ui(Number, 123456789);
+	ECMultiplicationGenerator(&Curve_P256, Number, &A);
+	for (j = 1; j >= 0; j--)
+	{
+		if (!ECSaveToBinaryFile(&Curve_P256, "Test_Curve.ecb", j) || !ECLoadFromBinaryFile("Test_Curve.ecb", &Curve_Binary))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		// Without the table in the file, the table is computed when the file is loaded
+		ECMultiplicationGenerator(&Curve_Binary, Number, &B);
+		if ((mpz_cmp(Curve_Binary.p, Curve_P256.p) != 0) || (mpz_cmp(Curve_Binary.n, Curve_P256.n) != 0) || (mpz_cmp(A.X, B.X) != 0) || (mpz_cmp(A.Y, B.Y) != 0) || (Curve_Binary.Generator_Table.Is_Read_Only != j))
+		{
+			printf("FAILED\n");
+			return 0;
+		}
+		ECFree(&Curve_Binary);
+	}
+	// The parameters section is the last one of a file without table, so removing a byte makes it overflow the file
+	if ((stat("Test_Curve.ecb", &File_Status) != 0) || (truncate("Test_Curve.ecb", File_Status.st_size - 1) != 0) || ECLoadFromBinaryFile("Test_Curve.ecb", &Curve_Binary))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	if (!ECSaveToBinaryFile(&Curve_P256, "Test_Curve.ecb", 0) || ((File = fopen("Test_Curve.ecb", "r+b")) == NULL))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	fputc('X', File);
+	fclose(File);
+	if (ECLoadFromBinaryFile("Test_Curve.ecb", &Curve_Binary))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	if (!ECSaveToBinaryFile(&Curve_P256, "Test_Curve.ecb", 0) || ((File = fopen("Test_Curve.ecb", "r+b")) == NULL))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	Limb_Size = 2 * sizeof(mp_limb_t);
+	fseek(File, offsetof(TECBinaryHeader, Limb_Size), SEEK_SET);
+	fwrite(&Limb_Size, sizeof(Limb_Size), 1, File);
+	fclose(File);
+	if (ECLoadFromBinaryFile("Test_Curve.ecb", &Curve_Binary))
+	{
+		printf("FAILED\n");
+		return 0;
+	}
+	remove("Test_Curve.ecb");
+	printf("SUCCESS\n\n");
+	
 	return 0;
 }
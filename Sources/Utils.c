@@ -2,13 +2,19 @@
  * Utility functions.
  */
 #include <sys/time.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <gmp.h>
 #include <openssl/evp.h>
+#include <openssl/rand.h>
 #include "Utils.h"
 
 /** Internal random state. */
 static gmp_randstate_t Random_State;
+/** The GMP random state is not thread-safe, serialize the threads drawing numbers. */
+static pthread_mutex_t Random_State_Mutex = PTHREAD_MUTEX_INITIALIZER;
 
 void UtilsInitializeRandomGenerator(void)
 {
@@ -24,47 +30,89 @@ void UtilsInitializeRandomGenerator(void)
 
 void UtilsGenerateRandomNumber(mpz_t Modulus, mpz_t Random_Number)
 {
+	pthread_mutex_lock(&Random_State_Mutex);
 	mpz_urandomm(Random_Number, Random_State, Modulus);
+	pthread_mutex_unlock(&Random_State_Mutex);
 }
 
-int UtilsComputeHash(unsigned char *Pointer_Data_Buffer, size_t Data_Buffer_Size, unsigned char *Pointer_Output_Hash)
+void UtilsGenerateRandomBuffer(unsigned char *Pointer_Buffer, size_t Buffer_Size)
 {
-	EVP_MD_CTX Context;
+	mpz_t Number;
+	size_t Written_Bytes_Count;
+	
+	mpz_init(Number);
+	
+	// Generate exactly the requested amount of random bits
+	pthread_mutex_lock(&Random_State_Mutex);
+	mpz_urandomb(Number, Random_State, Buffer_Size * 8);
+	pthread_mutex_unlock(&Random_State_Mutex);
 	
-	OpenSSL_add_all_digests();
+	// Export the number as a big endian bytes string, padding with zeros if the number is shorter than the buffer
+	memset(Pointer_Buffer, 0, Buffer_Size);
+	mpz_export(NULL, &Written_Bytes_Count, 1, 1, 1, 0, Number);
+	mpz_export(Pointer_Buffer + Buffer_Size - Written_Bytes_Count, NULL, 1, 1, 1, 0, Number);
+	
+	mpz_clear(Number);
+}
+
+int UtilsGenerateSecureRandomBuffer(unsigned char *Pointer_Buffer, size_t Buffer_Size)
+{
+	if (RAND_bytes(Pointer_Buffer, (int) Buffer_Size) != 1) return 0;
+	return 1;
+}
+
+int UtilsComputeHash(unsigned char *Pointer_Data_Buffer, size_t Data_Buffer_Size, unsigned char *Pointer_Output_Hash)
+{
+	EVP_MD_CTX *Pointer_Context;
 	
-	// Initialize SSL context
-	EVP_MD_CTX_init(&Context);
+	// Initialize SSL context (OpenSSL 1.1 and later do not allow to allocate it on the stack)
+	Pointer_Context = EVP_MD_CTX_new();
+	if (Pointer_Context == NULL) return 0;
 	
 	// Select SHA-1 algorithm
-	if (!EVP_DigestInit_ex(&Context, EVP_sha1(), NULL))
+	if (!EVP_DigestInit_ex(Pointer_Context, EVP_sha1(), NULL))
 	{
-		EVP_MD_CTX_cleanup(&Context);
+		EVP_MD_CTX_free(Pointer_Context);
 		return 0;
 	}
 	
 	// "Digest" data to hash
-	if (!EVP_DigestUpdate(&Context, Pointer_Data_Buffer, Data_Buffer_Size))
+	if (!EVP_DigestUpdate(Pointer_Context, Pointer_Data_Buffer, Data_Buffer_Size))
 	{
-		EVP_MD_CTX_cleanup(&Context);
+		EVP_MD_CTX_free(Pointer_Context);
 		return 0;
 	}
 	
 	// output hash
-	if (!EVP_DigestFinal_ex(&Context, Pointer_Output_Hash, NULL))
+	if (!EVP_DigestFinal_ex(Pointer_Context, Pointer_Output_Hash, NULL))
 	{
-		EVP_MD_CTX_cleanup(&Context);
+		EVP_MD_CTX_free(Pointer_Context);
 		return 0;
 	}
 	
-	EVP_MD_CTX_cleanup(&Context);
+	EVP_MD_CTX_free(Pointer_Context);
 	return 1;
 }
 
-void UtilsShowHash(unsigned char *Pointer_Hash_Buffer)
+void UtilsConvertHashToString(unsigned char *Pointer_Hash_Buffer, char *String_Output)
 {
 	int i;
 	
-	for (i = 0; i < UTILS_HASH_LENGTH; i++) printf("%02x", Pointer_Hash_Buffer[i]);
-	putchar('\n');
+	for (i = 0; i < UTILS_HASH_LENGTH; i++) sprintf(&String_Output[i * 2], "%02x", Pointer_Hash_Buffer[i]);
+}
+
+void UtilsShowHash(unsigned char *Pointer_Hash_Buffer)
+{
+	char String_Hash[UTILS_HASH_STRING_SIZE];
+	
+	UtilsConvertHashToString(Pointer_Hash_Buffer, String_Hash);
+	puts(String_Hash);
+}
+
+long long UtilsGetTime(void)
+{
+	struct timespec Time;
+	
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return (long long) Time.tv_sec * 1000000LL + Time.tv_nsec / 1000;
 }
\ No newline at end of file
@@ -6,16 +6,31 @@
 
 /** Length in bytes of a hash computed by the UtilsComputeHash() function. */
 #define UTILS_HASH_LENGTH 20
+/** Size in characters (including the terminating zero) of a hash converted to hexadecimal by UtilsConvertHashToString(). */
+#define UTILS_HASH_STRING_SIZE (UTILS_HASH_LENGTH * 2 + 1)
 
 /** Initialize the GMP random generator (same as srand()). */
 void UtilsInitializeRandomGenerator(void);
 
-/** Generate a random number.
+/** Generate a random number. This function can be called from several threads.
  * @param Modulus The number will be in range 0..Modulus - 1.
  * @param Output_Number On output, store the generated random number.
  */
 void UtilsGenerateRandomNumber(mpz_t Modulus, mpz_t Output_Number);
 
+/** Fill a buffer with random bytes. This function can be called from several threads.
+ * @param Pointer_Buffer The buffer to fill.
+ * @param Buffer_Size How many bytes to generate.
+ */
+void UtilsGenerateRandomBuffer(unsigned char *Pointer_Buffer, size_t Buffer_Size);
+
+/** Fill a buffer with unpredictable random bytes from the OpenSSL generator, for the values an attacker must not guess (the GMP generator is seeded with the time only). This function can be called from several threads.
+ * @param Pointer_Buffer The buffer to fill.
+ * @param Buffer_Size How many bytes to generate.
+ * @return 1 if the buffer was filled or 0 if the OpenSSL generator could not be seeded.
+ */
+int UtilsGenerateSecureRandomBuffer(unsigned char *Pointer_Buffer, size_t Buffer_Size);
+
 /** Use the SHA-1 algorithm to compute the hash of the data.
  * @param Pointer_Data_Buffer The buffer containing the data to hash.
  * @param Data_Buffer_Size Size of the data to hash.
@@ -24,9 +39,20 @@ void UtilsGenerateRandomNumber(mpz_t Modulus, mpz_t Output_Number);
  */
 int UtilsComputeHash(unsigned char *Pointer_Data_Buffer, size_t Data_Buffer_Size, unsigned char *Pointer_Output_Hash);
 
+/** Convert a hash to an hexadecimal string.
+ * @param Pointer_Hash_Buffer The hash to convert.
+ * @param String_Output On output, contain the hash in hexadecimal (the buffer must be UTILS_HASH_STRING_SIZE bytes long).
+ */
+void UtilsConvertHashToString(unsigned char *Pointer_Hash_Buffer, char *String_Output);
+
 /** Display a previously computed hash.
  * @param Pointer_Hash_Buffer The buffer containing the hash to display.
  */
 void UtilsShowHash(unsigned char *Pointer_Hash_Buffer);
 
+/** Get a monotonic time value.
+ * @return The elapsed time in microseconds since an unspecified starting point.
+ */
+long long UtilsGetTime(void);
+
 #endif
\ No newline at end of file